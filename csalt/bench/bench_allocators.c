@@ -0,0 +1,621 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_allocators.c
+// - Purpose: Replays a fixed set of allocation traces through the vtable of
+//            every general allocator in c_allocator.h and reports, per
+//            allocator and trace:
+//
+//              ns/op      wall time of an untimed replay divided by the
+//                         number of operations
+//              p50, p99   per-operation latency from a second replay in
+//                         which every call is timed (timer cost subtracted)
+//              RSS KiB    growth of the resident set from just before the
+//                         allocator is created to the trace's sample point
+//              frag %     internal fragmentation at the sample point:
+//                         1 - requested live bytes / bytes the allocator
+//                         reports as consumed
+//
+//            The sample point is the peak of live bytes, except in the churn
+//            traces, whose peak is the initial fill; there it is the last
+//            churn operation, after every slot has been recycled many
+//            times.  The arena never reuses returned memory, so its frag %
+//            in the churn traces counts every block it has ever handed out.
+//
+//            Fixed-size allocators (pool, slab) are sized for the largest
+//            request in a trace and skipped when that exceeds
+//            FIXED_MAX_SIZE.
+//
+//            Traces (generated from a fixed seed so every run is identical):
+//              uniform   64-byte objects, steady-state churn
+//              mixed     16..4095 bytes, skewed small, steady-state churn
+//              lifo      N small allocations freed in reverse order
+//              fifo      N small allocations freed in allocation order
+//              random    N small allocations freed in random order
+//              realloc   buffers grown by 1.5x from 16 bytes to 64 KiB
+//
+//            The batch traces (lifo, fifo, random) fold the mixed sizes into
+//            16..256 bytes, skewed small.
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 16, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2026, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "c_allocator.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__GLIBC__)
+#include <malloc.h>   // malloc_usable_size, malloc_trim
+#endif
+// ================================================================================
+// ================================================================================
+
+#define CHURN_SLOTS     1024u             /* live objects in the churn traces  */
+#define CHURN_OPS       (1u << 17)
+#define BATCH_OBJECTS   (1u << 15)        /* lifo / fifo / random              */
+#define GROW_BUFFERS    256u
+#define GROW_LIMIT      ((size_t)64u << 10)
+#define FIXED_MAX_SIZE  4096u             /* largest pool / slab block tried   */
+#define BUDDY_POOL      ((size_t)256u << 20)
+
+typedef enum { OP_ALLOC, OP_FREE, OP_REALLOC } op_kind_t;
+
+typedef struct {
+    uint32_t kind;
+    uint32_t slot;
+    uint32_t size;       /* new size for OP_ALLOC / OP_REALLOC */
+} op_t;
+
+typedef struct {
+    const char *name;
+    op_t       *ops;
+    size_t      n_ops;
+    size_t      cap;
+    size_t      slots;
+    size_t      max_size;
+    size_t      peak_op;     /* index just after which live bytes peak */
+    size_t      peak_bytes;
+    size_t      sample_op;   /* index after which RSS and frag are read */
+    size_t      sample_bytes;/* live bytes at sample_op                 */
+} trace_t;
+// --------------------------------------------------------------------------------
+
+typedef struct {
+    allocator_vtable_t v;
+    buddy_t           *buddy;     /* backing pool for buddy and slab */
+    void              *obj;       /* arena / pool / freelist / slab  */
+} bench_ctx_t;
+
+typedef struct {
+    const char *name;
+    bool   (*make)(size_t max_size, bench_ctx_t *out);
+    size_t (*consumed)(const bench_ctx_t *c, void *const *live, size_t slots);
+    void   (*destroy)(bench_ctx_t *c);
+} bench_alloc_t;
+// ================================================================================
+// ================================================================================
+// UTILITIES
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+
+static uint64_t rng_next(void) {
+    uint64_t x = rng_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return rng_state = x;
+}
+// --------------------------------------------------------------------------------
+
+/* 16..4095 bytes, log-uniform so small requests dominate */
+static uint32_t mixed_size(void) {
+    uint32_t const shift = 4u + (uint32_t)(rng_next() % 8u);
+    uint32_t const lo    = 1u << shift;
+    return lo + (uint32_t)(rng_next() % lo);
+}
+// --------------------------------------------------------------------------------
+
+/* Resident set in KiB, or -1 where /proc is unavailable */
+static long rss_kib(void) {
+    FILE *f = fopen("/proc/self/statm", "r");
+    if (!f) {
+        return -1;
+    }
+    long pages = 0, resident = 0;
+    int const n = fscanf(f, "%ld %ld", &pages, &resident);
+    fclose(f);
+    if (n != 2) {
+        return -1;
+    }
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+// --------------------------------------------------------------------------------
+
+static int cmp_double(const void *a, const void *b) {
+    double const x = *(const double *)a;
+    double const y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+// ================================================================================
+// ================================================================================
+// TRACES
+
+static void trace_push(trace_t *t, op_kind_t kind, size_t slot, size_t size) {
+    if (t->n_ops == t->cap) {
+        t->cap = t->cap ? t->cap * 2u : 1024u;
+        t->ops = realloc(t->ops, t->cap * sizeof(op_t));
+        if (!t->ops) {
+            fprintf(stderr, "out of memory building trace %s\n", t->name);
+            exit(EXIT_FAILURE);
+        }
+    }
+    t->ops[t->n_ops++] = (op_t){ (uint32_t)kind, (uint32_t)slot, (uint32_t)size };
+    if (size > t->max_size) {
+        t->max_size = size;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* Record where live bytes peak and how many are live at `sample_op`, the
+ * point where RSS and fragmentation are read; SIZE_MAX samples the peak. */
+static void trace_finish(trace_t *t, size_t sample_op) {
+    size_t *len = calloc(t->slots, sizeof(size_t));
+    if (!len) {
+        exit(EXIT_FAILURE);
+    }
+    size_t live = 0u;
+    for (size_t i = 0u; i < t->n_ops; i++) {
+        op_t const *op = &t->ops[i];
+        live -= len[op->slot];
+        len[op->slot] = (op->kind == OP_FREE) ? 0u : op->size;
+        live += len[op->slot];
+        if (live > t->peak_bytes) {
+            t->peak_bytes = live;
+            t->peak_op    = i;
+        }
+        if (i == sample_op) {
+            t->sample_bytes = live;
+        }
+    }
+    free(len);
+
+    if (sample_op >= t->n_ops) {
+        t->sample_op    = t->peak_op;
+        t->sample_bytes = t->peak_bytes;
+    } else {
+        t->sample_op = sample_op;
+    }
+}
+// --------------------------------------------------------------------------------
+
+static trace_t make_churn(const char *name, bool uniform) {
+    trace_t t = { .name = name, .slots = CHURN_SLOTS };
+    bool live[CHURN_SLOTS] = { false };
+
+    for (size_t s = 0u; s < CHURN_SLOTS; s++) {
+        trace_push(&t, OP_ALLOC, s, uniform ? 64u : mixed_size());
+        live[s] = true;
+    }
+    for (size_t i = 0u; i < CHURN_OPS; i++) {
+        size_t const s = (size_t)(rng_next() % CHURN_SLOTS);
+        if (live[s]) {
+            trace_push(&t, OP_FREE, s, 0u);
+        } else {
+            trace_push(&t, OP_ALLOC, s, uniform ? 64u : mixed_size());
+        }
+        live[s] = !live[s];
+    }
+    size_t const steady = t.n_ops - 1u;   /* last churn operation */
+    for (size_t s = 0u; s < CHURN_SLOTS; s++) {
+        if (live[s]) {
+            trace_push(&t, OP_FREE, s, 0u);
+        }
+    }
+    trace_finish(&t, steady);
+    return t;
+}
+// --------------------------------------------------------------------------------
+
+typedef enum { ORDER_LIFO, ORDER_FIFO, ORDER_RANDOM } free_order_t;
+
+static trace_t make_batch(const char *name, free_order_t order) {
+    trace_t t = { .name = name, .slots = BATCH_OBJECTS };
+    for (size_t s = 0u; s < BATCH_OBJECTS; s++) {
+        uint32_t const size = mixed_size();   /* folded into 16..256 */
+        trace_push(&t, OP_ALLOC, s, size > 256u ? 16u + size % 241u : size);
+    }
+
+    size_t *perm = malloc(BATCH_OBJECTS * sizeof(size_t));
+    if (!perm) {
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0u; i < BATCH_OBJECTS; i++) {
+        perm[i] = (order == ORDER_LIFO) ? BATCH_OBJECTS - 1u - i : i;
+    }
+    if (order == ORDER_RANDOM) {
+        for (size_t i = BATCH_OBJECTS - 1u; i > 0u; i--) {
+            size_t const j = (size_t)(rng_next() % (i + 1u));
+            size_t const tmp = perm[i];
+            perm[i] = perm[j];
+            perm[j] = tmp;
+        }
+    }
+    for (size_t i = 0u; i < BATCH_OBJECTS; i++) {
+        trace_push(&t, OP_FREE, perm[i], 0u);
+    }
+    free(perm);
+    trace_finish(&t, SIZE_MAX);
+    return t;
+}
+// --------------------------------------------------------------------------------
+
+/* Buffers grow round-robin so their reallocations interleave */
+static trace_t make_realloc_growth(void) {
+    trace_t t = { .name = "realloc", .slots = GROW_BUFFERS };
+    size_t size = 16u;
+    for (size_t s = 0u; s < GROW_BUFFERS; s++) {
+        trace_push(&t, OP_ALLOC, s, size);
+    }
+    while (size < GROW_LIMIT) {
+        size = size + size / 2u;
+        if (size > GROW_LIMIT) {
+            size = GROW_LIMIT;
+        }
+        for (size_t s = 0u; s < GROW_BUFFERS; s++) {
+            trace_push(&t, OP_REALLOC, s, size);
+        }
+    }
+    for (size_t s = 0u; s < GROW_BUFFERS; s++) {
+        trace_push(&t, OP_FREE, s, 0u);
+    }
+    trace_finish(&t, SIZE_MAX);
+    return t;
+}
+// ================================================================================
+// ================================================================================
+// ALLOCATORS UNDER TEST
+
+static bool make_heap(size_t max_size, bench_ctx_t *c) {
+    (void)max_size;
+    c->v = heap_allocator();
+    return true;
+}
+
+static size_t consumed_heap(const bench_ctx_t *c, void *const *live, size_t slots) {
+    (void)c;
+#if defined(__GLIBC__)
+    size_t sum = 0u;
+    for (size_t s = 0u; s < slots; s++) {
+        if (live[s]) {
+            sum += malloc_usable_size(live[s]);
+        }
+    }
+    return sum;
+#else
+    (void)live; (void)slots;
+    return 0u;
+#endif
+}
+
+static void destroy_heap(bench_ctx_t *c) { (void)c; }
+// --------------------------------------------------------------------------------
+
+static bool make_arena(size_t max_size, bench_ctx_t *c) {
+    (void)max_size;
+    arena_expect_t r = init_dynamic_arena((size_t)1u << 20, true, (size_t)1u << 20, 0u);
+    if (!r.has_value) {
+        return false;
+    }
+    c->obj = r.u.value;
+    c->v   = arena_allocator(r.u.value);
+    return true;
+}
+
+static size_t consumed_arena(const bench_ctx_t *c, void *const *live, size_t slots) {
+    (void)live; (void)slots;
+    return arena_size((const arena_t *)c->obj);
+}
+
+static void destroy_arena(bench_ctx_t *c) { free_arena((arena_t *)c->obj); }
+// --------------------------------------------------------------------------------
+
+static bool make_pool(size_t max_size, bench_ctx_t *c) {
+    if (max_size > FIXED_MAX_SIZE) {
+        return false;
+    }
+    pool_expect_t r = init_dynamic_pool(max_size, 0u, 1024u, (size_t)1u << 20,
+                                        (size_t)1u << 20, true, true);
+    if (!r.has_value) {
+        return false;
+    }
+    c->obj = r.u.value;
+    c->v   = pool_allocator(r.u.value);
+    return true;
+}
+
+static size_t consumed_pool(const bench_ctx_t *c, void *const *live, size_t slots) {
+    (void)live; (void)slots;
+    const pool_t *p = (const pool_t *)c->obj;
+    return pool_in_use_blocks(p) * pool_stride(p);
+}
+
+static void destroy_pool(bench_ctx_t *c) { free_pool((pool_t *)c->obj); }
+// --------------------------------------------------------------------------------
+
+static bool make_freelist(size_t max_size, bench_ctx_t *c) {
+    (void)max_size;
+    freelist_expect_t r = init_dynamic_freelist((size_t)64u << 20, 0u, true);
+    if (!r.has_value) {
+        return false;
+    }
+    c->obj = r.u.value;
+    c->v   = freelist_allocator(r.u.value);
+    return true;
+}
+
+static size_t consumed_freelist(const bench_ctx_t *c, void *const *live, size_t slots) {
+    (void)live; (void)slots;
+    return freelist_size((const freelist_t *)c->obj);
+}
+
+static void destroy_freelist(bench_ctx_t *c) { free_freelist((freelist_t *)c->obj); }
+// --------------------------------------------------------------------------------
+
+static bool make_buddy(size_t max_size, bench_ctx_t *c) {
+    (void)max_size;
+    buddy_expect_t r = init_buddy_allocator(BUDDY_POOL, 32u, 0u);
+    if (!r.has_value) {
+        return false;
+    }
+    c->buddy = r.u.value;
+    c->v     = buddy_allocator(r.u.value);
+    return true;
+}
+
+static size_t consumed_buddy(const bench_ctx_t *c, void *const *live, size_t slots) {
+    (void)live; (void)slots;
+    return buddy_alloc(c->buddy);
+}
+
+static void destroy_buddy(bench_ctx_t *c) { free_buddy(c->buddy); }
+// --------------------------------------------------------------------------------
+
+static bool make_slab(size_t max_size, bench_ctx_t *c) {
+    if (max_size > FIXED_MAX_SIZE || !make_buddy(max_size, c)) {
+        return false;
+    }
+    slab_expect_t r = init_slab_allocator(c->buddy, max_size, 0u, 0u);
+    if (!r.has_value) {
+        free_buddy(c->buddy);
+        return false;
+    }
+    c->obj = r.u.value;
+    c->v   = slab_allocator(r.u.value);
+    return true;
+}
+
+static size_t consumed_slab(const bench_ctx_t *c, void *const *live, size_t slots) {
+    (void)live; (void)slots;
+    const slab_t *s = (const slab_t *)c->obj;
+    return slab_in_use_blocks(s) * slab_stride(s);
+}
+
+/* The slab lives inside its buddy pool */
+static void destroy_slab(bench_ctx_t *c) { free_buddy(c->buddy); }
+// --------------------------------------------------------------------------------
+
+static const bench_alloc_t allocators[] = {
+    { "heap",     make_heap,     consumed_heap,     destroy_heap     },
+    { "arena",    make_arena,    consumed_arena,    destroy_arena    },
+    { "pool",     make_pool,     consumed_pool,     destroy_pool     },
+    { "freelist", make_freelist, consumed_freelist, destroy_freelist },
+    { "buddy",    make_buddy,    consumed_buddy,    destroy_buddy    },
+    { "slab",     make_slab,     consumed_slab,     destroy_slab     },
+};
+static const size_t allocator_count = sizeof(allocators) / sizeof(allocators[0]);
+// ================================================================================
+// ================================================================================
+// REPLAY
+
+typedef struct {
+    void   **ptr;
+    size_t  *len;
+    double  *lat;       /* per-op latency, NULL for the untimed replay */
+    double   timer_ns;  /* cost of one now_ns() pair, subtracted from lat */
+    long     rss_sample;
+    size_t   consumed_sample;
+} replay_t;
+// --------------------------------------------------------------------------------
+
+static bool replay_op(allocator_vtable_t const *v, op_t const *op, replay_t *r) {
+    void  **slot = &r->ptr[op->slot];
+    size_t *len  = &r->len[op->slot];
+
+    switch ((op_kind_t)op->kind) {
+        case OP_ALLOC: {
+            void_ptr_expect_t e = v->allocate(v->ctx, op->size, false);
+            if (!e.has_value) {
+                return false;
+            }
+            *slot = e.u.value;
+            *len  = op->size;
+            /* Touch the block so RSS reflects what the program would use */
+            memset(*slot, 0x5A, op->size);
+            return true;
+        }
+        case OP_REALLOC: {
+            void_ptr_expect_t e = v->reallocate(v->ctx, *slot, *len, op->size, false);
+            if (!e.has_value) {
+                return false;
+            }
+            memset((uint8_t *)e.u.value + *len, 0x5A, op->size - *len);
+            *slot = e.u.value;
+            *len  = op->size;
+            return true;
+        }
+        case OP_FREE:
+            v->return_element(v->ctx, *slot);
+            *slot = NULL;
+            *len  = 0u;
+            return true;
+    }
+    return false;
+}
+// --------------------------------------------------------------------------------
+
+static bool replay(const bench_alloc_t *ba, const trace_t *t, replay_t *r,
+                   double *elapsed_ns) {
+    bench_ctx_t c = { 0 };
+    memset(r->ptr, 0, t->slots * sizeof(void *));
+    memset(r->len, 0, t->slots * sizeof(size_t));
+
+#if defined(__GLIBC__)
+    /* Hand memory freed by earlier runs back to the OS so it is not
+     * silently reused and the RSS delta reflects this run alone */
+    malloc_trim(0);
+#endif
+    long const rss0 = rss_kib();
+    if (!ba->make(t->max_size, &c)) {
+        return false;
+    }
+
+    bool ok = true;
+    double const t0 = now_ns();
+    for (size_t i = 0u; i < t->n_ops && ok; i++) {
+        if (r->lat) {
+            double const a = now_ns();
+            ok = replay_op(&c.v, &t->ops[i], r);
+            double const b = now_ns();
+            r->lat[i] = (b - a) - r->timer_ns;
+        } else {
+            ok = replay_op(&c.v, &t->ops[i], r);
+        }
+        if (ok && r->lat && i == t->sample_op) {
+            long const rss = rss_kib();
+            r->rss_sample      = (rss < 0 || rss0 < 0) ? -1 : rss - rss0;
+            r->consumed_sample = ba->consumed(&c, r->ptr, t->slots);
+        }
+    }
+    *elapsed_ns = now_ns() - t0;
+
+    ba->destroy(&c);
+    return ok;
+}
+// --------------------------------------------------------------------------------
+
+static double timer_overhead(void) {
+    enum { SAMPLES = 4096 };
+    static double s[SAMPLES];
+    for (int i = 0; i < SAMPLES; i++) {
+        double const a = now_ns();
+        s[i] = now_ns() - a;
+    }
+    qsort(s, SAMPLES, sizeof(double), cmp_double);
+    return s[SAMPLES / 2];
+}
+// --------------------------------------------------------------------------------
+
+static void run_trace(const trace_t *t, double timer_ns) {
+    printf("\nTrace: %s (%zu ops, peak live %.1f KiB, max request %zu bytes, "
+           "sampled at op %zu with %.1f KiB live)\n",
+           t->name, t->n_ops, (double)t->peak_bytes / 1024.0, t->max_size,
+           t->sample_op, (double)t->sample_bytes / 1024.0);
+    printf("  %-9s %9s %9s %9s %10s %8s\n",
+           "allocator", "ns/op", "p50 ns", "p99 ns", "RSS KiB", "frag %");
+
+    replay_t r = {
+        .ptr = malloc(t->slots * sizeof(void *)),
+        .len = malloc(t->slots * sizeof(size_t)),
+        .timer_ns = timer_ns
+    };
+    double *lat = malloc(t->n_ops * sizeof(double));
+    if (!r.ptr || !r.len || !lat) {
+        fprintf(stderr, "out of memory replaying %s\n", t->name);
+        exit(EXIT_FAILURE);
+    }
+
+    for (size_t k = 0u; k < allocator_count; k++) {
+        const bench_alloc_t *ba = &allocators[k];
+        double elapsed = 0.0;
+
+        r.lat = NULL;
+        if (!replay(ba, t, &r, &elapsed)) {
+            printf("  %-9s %9s\n", ba->name, "n/a");
+            continue;
+        }
+        double const ns_op = elapsed / (double)t->n_ops;
+
+        r.lat           = lat;
+        r.rss_sample      = -1;
+        r.consumed_sample = 0u;
+        if (!replay(ba, t, &r, &elapsed)) {
+            printf("  %-9s %9s\n", ba->name, "n/a");
+            continue;
+        }
+        qsort(lat, t->n_ops, sizeof(double), cmp_double);
+        double const p50 = lat[t->n_ops / 2u];
+        double const p99 = lat[(t->n_ops * 99u) / 100u];
+
+        char frag[16] = "n/a";
+        if (r.consumed_sample >= t->sample_bytes && r.consumed_sample > 0u) {
+            snprintf(frag, sizeof(frag), "%.1f",
+                     100.0 * (1.0 - (double)t->sample_bytes / (double)r.consumed_sample));
+        }
+        char rss[16] = "n/a";
+        if (r.rss_sample >= 0) {
+            snprintf(rss, sizeof(rss), "%ld", r.rss_sample);
+        }
+
+        printf("  %-9s %9.1f %9.1f %9.1f %10s %8s\n", ba->name, ns_op,
+               p50 > 0.0 ? p50 : 0.0, p99 > 0.0 ? p99 : 0.0, rss, frag);
+    }
+
+    free(lat);
+    free(r.len);
+    free(r.ptr);
+}
+// ================================================================================
+// ================================================================================
+
+int main(void) {
+    trace_t traces[] = {
+        make_churn("uniform", true),
+        make_churn("mixed", false),
+        make_batch("lifo", ORDER_LIFO),
+        make_batch("fifo", ORDER_FIFO),
+        make_batch("random", ORDER_RANDOM),
+        make_realloc_growth(),
+    };
+    size_t const trace_count = sizeof(traces) / sizeof(traces[0]);
+
+    double const timer_ns = timer_overhead();
+    printf("Allocator trace replay (timer overhead %.1f ns subtracted from p50/p99)\n",
+           timer_ns);
+
+    for (size_t i = 0u; i < trace_count; i++) {
+        run_trace(&traces[i], timer_ns);
+        free(traces[i].ops);
+    }
+    return EXIT_SUCCESS;
+}
+// ================================================================================
+// ================================================================================
+// eof
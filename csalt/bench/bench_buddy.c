@@ -0,0 +1,110 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_buddy.c
+// - Purpose: Measures return_buddy_element() latency as the number of free
+//            blocks of one order grows.  Coalescing consults a per-level
+//            free bitmap, so the cost per free should stay flat instead of
+//            growing with the length of the free list.
+//
+//            Layout per run: 4N minimum blocks are allocated and every
+//            block with index % 4 == 0 is freed, leaving N free blocks none
+//            of which can merge.  The timed loop then frees a block with
+//            index % 4 == 2 (its buddy is allocated, so no merge happens and
+//            a list scan would have to walk all N entries) and immediately
+//            re-allocates it, restoring the layout.
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 16, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2026, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "c_allocator.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+// ================================================================================
+// ================================================================================
+
+#define MIN_BLOCK  64u
+#define CYCLES     (1u << 16)
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+// --------------------------------------------------------------------------------
+
+static int run(size_t free_blocks) {
+    size_t const total = 4u * free_blocks;
+
+    buddy_expect_t be = init_buddy_allocator(total * MIN_BLOCK, MIN_BLOCK, 0u);
+    if (!be.has_value) {
+        fprintf(stderr, "init_buddy_allocator failed for N=%zu\n", free_blocks);
+        return 1;
+    }
+    buddy_t *b = be.u.value;
+
+    void **blocks = malloc(total * sizeof(void *));
+    if (!blocks) {
+        free_buddy(b);
+        return 1;
+    }
+
+    for (size_t i = 0u; i < total; i++) {
+        void_ptr_expect_t r = alloc_buddy(b, 1u, false);
+        if (!r.has_value) {
+            fprintf(stderr, "pool exhausted at block %zu\n", i);
+            free(blocks);
+            free_buddy(b);
+            return 1;
+        }
+        blocks[i] = r.u.value;
+    }
+    for (size_t i = 0u; i < total; i += 4u) {
+        (void)return_buddy_element(b, blocks[i]);
+    }
+
+    double free_ns = 0.0;
+    for (size_t c = 0u; c < CYCLES; c++) {
+        size_t const i = 4u * (c % free_blocks) + 2u;
+
+        double const t0 = now_ns();
+        (void)return_buddy_element(b, blocks[i]);
+        double const t1 = now_ns();
+        free_ns += t1 - t0;
+
+        /* LIFO free list: this hands back the block just returned */
+        blocks[i] = alloc_buddy(b, 1u, false).u.value;
+    }
+
+    printf("  %10zu  %12.1f\n", free_blocks, free_ns / (double)CYCLES);
+
+    free(blocks);
+    free_buddy(b);
+    return 0;
+}
+// ================================================================================
+// ================================================================================
+
+int main(void) {
+    printf("Buddy free latency vs. free-list length (min block %u bytes)\n",
+           MIN_BLOCK);
+    printf("  %10s  %12s\n", "free blocks", "ns / free");
+
+    for (size_t n = 1024u; n <= ((size_t)1u << 18); n <<= 2) {
+        if (run(n) != 0) {
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+// ================================================================================
+// ================================================================================
+// eof
@@ -21,9 +21,14 @@
 #include <stddef.h>  // max_align_t
 #include <stdalign.h> // alignof
 #include <stdatomic.h> // _Atomic
+#include <time.h>    // clock_gettime
 #define _GNU_SOURCE
 #include <sys/mman.h>
 #include <unistd.h>
+#include <pthread.h>
+#if defined(__linux__)
+#include <sys/syscall.h> // SYS_mbind
+#endif
 
 #include "c_allocator.h"
 // ================================================================================ 
@@ -63,8 +68,38 @@ struct arena_t{
     uint8_t mem_type;  // type of memory used
     uint8_t resize;    // allows resizing if true with mem_type == DYNAMIC
     uint8_t owns_memory; // true if struct owns memory false otherwise
-    uint8_t _pad[5];   // keep 8 byte passing
+    uint8_t flags;       // ARENA_BACKING_* page policy bits, ARENA_CONCURRENT
+    int16_t want_node;   // NUMA node requested for chunks, -1 for none
+    int16_t have_node;   // NUMA node every chunk is bound to, -1 for none
 };
+
+/* arena_t::flags layout.  A non-default backing request means every chunk
+ * the arena owns, including the head region, is an OS mapping rather than a
+ * malloc block. */
+#define ARENA_BACKING_WANT_MASK  0x03u  /* page_policy_t requested           */
+#define ARENA_BACKING_HAVE_SHIFT 2u     /* page_policy_t granted (weakest)   */
+#define ARENA_BACKING_STRICT     0x10u  /* fail instead of falling back      */
+#define ARENA_CONCURRENT         0x20u  /* lock-free multi-producer bumping  */
+
+static inline page_policy_t _arena_want_pages(const arena_t *a) {
+    return (page_policy_t)(a->flags & ARENA_BACKING_WANT_MASK);
+}
+
+static inline page_policy_t _arena_have_pages(const arena_t *a) {
+    return (page_policy_t)((a->flags >> ARENA_BACKING_HAVE_SHIFT) &
+                           ARENA_BACKING_WANT_MASK);
+}
+
+static inline void _arena_set_backing(arena_t *a, page_policy_t want,
+                                      page_policy_t have, bool strict,
+                                      int want_node, int have_node) {
+    a->flags     = (uint8_t)(((unsigned)want & ARENA_BACKING_WANT_MASK) |
+                             (((unsigned)have & ARENA_BACKING_WANT_MASK)
+                              << ARENA_BACKING_HAVE_SHIFT) |
+                             (strict ? ARENA_BACKING_STRICT : 0u));
+    a->want_node = (int16_t)want_node;
+    a->have_node = (int16_t)have_node;
+}
 // -------------------------------------------------------------------------------- 
 
 typedef struct {
@@ -125,23 +160,363 @@ static inline size_t _align_up_size(size_t x, size_t a) {
 static inline uintptr_t _align_up_uintptr(uintptr_t p, size_t a) {
     return (p + (a - 1)) & ~(a - 1);
 }
+// ================================================================================ 
+// ================================================================================ 
+// OS PAGE BACKING 
+//
+// Page-granular regions for buddy pools and for dynamic arenas created with a
+// non-default mem_backing_t.  Huge-page and NUMA requests are best effort: a
+// refusal from the kernel degrades to base pages / no binding, and the caller
+// learns what was actually applied through the 'got' argument of _os_map().
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#endif
+
+#define OS_MAX_NUMA_NODES 1024  /* width of the node mask handed to mbind */
+// -------------------------------------------------------------------------------- 
+
+static void _os_unmap(void *p, size_t len) {
+    if (p == NULL || len == 0u) {
+        return;
+    }
+#ifdef _WIN32
+    (void)len; /* not needed for MEM_RELEASE */
+    VirtualFree(p, 0, MEM_RELEASE);
+#else
+    (void)munmap(p, len);
+#endif
+}
+// -------------------------------------------------------------------------------- 
+
+/* Release a block obtained from either malloc (map_bytes == 0) or _os_map. */
+static inline void _backing_free(void *p, size_t map_bytes) {
+    if (map_bytes == 0u) {
+        free(p);
+    } else {
+        _os_unmap(p, map_bytes);
+    }
+}
+// -------------------------------------------------------------------------------- 
+
+/* Length of the OS mapping that starts at 'block' and holds chunk 'c', or 0
+ * when the arena's chunks come from malloc.  Mapped chunks give the whole
+ * mapping to the data region, so the length follows from the chunk itself. */
+static inline size_t _chunk_map_bytes(const arena_t *a, const Chunk *c,
+                                      const void *block) {
+    if ((a->want_node < 0) && (_arena_want_pages(a) == PAGES_DEFAULT)) {
+        return 0u;
+    }
+    return (size_t)(c->chunk - (const uint8_t *)block) + c->alloc;
+}
+// -------------------------------------------------------------------------------- 
+
+#if ARENA_ENABLE_DYNAMIC
+static size_t _os_page_size(void) {
+#ifdef _WIN32
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return (size_t)si.dwPageSize;
+#else
+    long const ps = sysconf(_SC_PAGESIZE);
+    return (ps > 0) ? (size_t)ps : (size_t)4096u;
+#endif
+}
+// -------------------------------------------------------------------------------- 
+
+/* Default huge page size, read once from /proc/meminfo (2 MiB elsewhere). */
+static size_t _os_huge_page_size(void) {
+    static _Atomic size_t cached = 0u;
+    size_t hp = atomic_load_explicit(&cached, memory_order_relaxed);
+    if (hp != 0u) {
+        return hp;
+    }
+
+    hp = (size_t)2u << 20;
+#if defined(__linux__)
+    FILE *f = fopen("/proc/meminfo", "r");
+    if (f != NULL) {
+        char line[128];
+        unsigned long kb = 0ul;
+        while (fgets(line, (int)sizeof(line), f) != NULL) {
+            if (sscanf(line, "Hugepagesize: %lu kB", &kb) == 1) {
+                if ((kb != 0ul) && ((kb & (kb - 1ul)) == 0ul)) {
+                    hp = (size_t)kb * 1024u;
+                }
+                break;
+            }
+        }
+        fclose(f);
+    }
+#endif
+    atomic_store_explicit(&cached, hp, memory_order_relaxed);
+    return hp;
+}
+// -------------------------------------------------------------------------------- 
+
+/* madvise(MADV_HUGEPAGE) succeeds even when THP is switched off, so the
+ * sysfs mode is what decides whether the advice can take effect. */
+static bool _os_thp_enabled(void) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    FILE *f = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+    if (f == NULL) {
+        return false;
+    }
+    char mode[64] = {0};
+    bool const ok = (fgets(mode, (int)sizeof(mode), f) != NULL) &&
+                    (strstr(mode, "[never]") == NULL);
+    fclose(f);
+    return ok;
+#else
+    return false;
+#endif
+}
+// -------------------------------------------------------------------------------- 
+
+
+/* Map 'len' bytes (a multiple of 'align') starting on an 'align' boundary.
+ * Over-maps by align - page and trims both ends. */
+static void *_os_map_aligned(size_t len, size_t align) {
+#ifdef _WIN32
+    (void)align;
+    return VirtualAlloc(NULL, len, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+    size_t const page = _os_page_size();
+    size_t const slack = (align > page) ? (align - page) : 0u;
+    if (len > SIZE_MAX - slack) {
+        return NULL;
+    }
+
+    uint8_t *raw = (uint8_t *)mmap(NULL, len + slack, PROT_READ | PROT_WRITE,
+                                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if ((void *)raw == MAP_FAILED) {
+        return NULL;
+    }
+    if (slack == 0u) {
+        return raw;
+    }
+
+    uint8_t *p = (uint8_t *)_align_up_uintptr((uintptr_t)raw, align);
+    size_t const head = (size_t)(p - raw);
+    size_t const tail = slack - head;
+    if (head != 0u) {
+        (void)munmap(raw, head);
+    }
+    if (tail != 0u) {
+        (void)munmap(p + len, tail);
+    }
+    return p;
+#endif
+}
+// -------------------------------------------------------------------------------- 
+
+/* Reserved huge pages; NULL when the pool is empty or the flag is missing. */
+static void *_os_map_hugetlb(size_t len) {
+#if defined(MAP_HUGETLB)
+    void *p = mmap(NULL, len, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    return (p == MAP_FAILED) ? NULL : p;
+#else
+    (void)len;
+    return NULL;
+#endif
+}
+// -------------------------------------------------------------------------------- 
+
+/* Bind [p, p + len) to one node with MPOL_BIND.  Uses the raw syscall so the
+ * library does not pick up a libnuma dependency.  Must run before the pages
+ * are first touched for the placement to apply. */
+static bool _os_bind_node(void *p, size_t len, int node) {
+#if defined(__linux__) && defined(SYS_mbind)
+    enum { MASK_BITS = 8 * (int)sizeof(unsigned long) };
+    unsigned long mask[OS_MAX_NUMA_NODES / MASK_BITS] = {0};
+    mask[node / MASK_BITS] |= 1ul << (node % MASK_BITS);
+
+    long const rc = syscall(SYS_mbind, p, (unsigned long)len,
+                            2 /* MPOL_BIND */, mask,
+                            (unsigned long)OS_MAX_NUMA_NODES + 1ul, 0u);
+    return rc == 0;
+#else
+    (void)p; (void)len; (void)node;
+    return false;
+#endif
+}
+// -------------------------------------------------------------------------------- 
+
+static bool _backing_valid(mem_backing_t want) {
+    return ((unsigned)want.pages <= (unsigned)PAGES_HUGETLB) &&
+           (want.numa_node >= -1) && (want.numa_node < OS_MAX_NUMA_NODES);
+}
+// -------------------------------------------------------------------------------- 
+
+static inline bool _backing_is_default(mem_backing_t want) {
+    return (want.pages == PAGES_DEFAULT) && (want.numa_node < 0);
+}
+// -------------------------------------------------------------------------------- 
+
+/* Map at least 'bytes' with the requested backing.  PAGES_HUGETLB falls back
+ * to PAGES_THP, which falls back to base pages; a failed NUMA bind leaves the
+ * range unbound.  With want.strict set any fallback is reported as
+ * UNSUPPORTED instead.  On success *map_bytes is the length to unmap and
+ * *got the backing in effect. */
+static error_code_t _os_map(size_t bytes, mem_backing_t want,
+                            void **out, size_t *map_bytes, mem_backing_t *got) {
+    *out       = NULL;
+    *map_bytes = 0u;
+    *got = (mem_backing_t){ .pages = PAGES_DEFAULT, .numa_node = -1,
+                            .strict = want.strict };
+
+    if (bytes == 0u || !_backing_valid(want)) {
+        return INVALID_ARG;
+    }
+
+    size_t const page = _os_page_size();
+    size_t const huge = _os_huge_page_size();
+    if (bytes > SIZE_MAX - (huge - 1u)) {
+        return LENGTH_OVERFLOW;
+    }
+
+    void  *p   = NULL;
+    size_t len = 0u;
+
+    if (want.pages == PAGES_HUGETLB) {
+        len = _align_up_size(bytes, huge);
+        p   = _os_map_hugetlb(len);
+        if (p != NULL) {
+            got->pages = PAGES_HUGETLB;
+        } else if (want.strict) {
+            return UNSUPPORTED;
+        }
+    }
+
+    if (p == NULL) {
+        bool const thp = (want.pages != PAGES_DEFAULT) && _os_thp_enabled();
+        if (want.pages != PAGES_DEFAULT && !thp && want.strict) {
+            return UNSUPPORTED;
+        }
+
+        size_t const align = thp ? huge : page;
+        len = _align_up_size(bytes, align);
+        p   = _os_map_aligned(len, align);
+        if (p == NULL) {
+            return BAD_ALLOC;
+        }
+#if defined(MADV_HUGEPAGE)
+        if (thp && madvise(p, len, MADV_HUGEPAGE) == 0) {
+            got->pages = PAGES_THP;
+        }
+#endif
+        if (got->pages != want.pages && want.strict) {
+            _os_unmap(p, len);
+            return UNSUPPORTED;
+        }
+    }
+
+    if (want.numa_node >= 0) {
+        if (_os_bind_node(p, len, want.numa_node)) {
+            got->numa_node = want.numa_node;
+        } else if (want.strict) {
+            _os_unmap(p, len);
+            return UNSUPPORTED;
+        }
+    }
+
+    *out       = p;
+    *map_bytes = len;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+#endif
+// -------------------------------------------------------------------------------- 
+
+/* "none" or the node number, for the stats reports */
+static const char *_numa_node_str(int node, char *buf, size_t len) {
+    if (node < 0) {
+        return "none";
+    }
+    (void)snprintf(buf, len, "%d", node);
+    return buf;
+}
+// -------------------------------------------------------------------------------- 
+
+const char *page_policy_name(page_policy_t pages) {
+    switch (pages) {
+        case PAGES_DEFAULT: return "default";
+        case PAGES_THP:     return "thp";
+        case PAGES_HUGETLB: return "hugetlb";
+        default:            return "unknown";
+    }
+}
 // -------------------------------------------------------------------------------- 
 
 #if ARENA_ENABLE_DYNAMIC
-static struct Chunk* _chunk_new_ex(size_t data_bytes, size_t data_align){
+/* Lower the arena's reported backing to what a new chunk was granted.
+ * Concurrent arenas can grow from several threads at once, so the update
+ * is a CAS on the flag byte. */
+static void _arena_note_backing(arena_t *arena, mem_backing_t got) {
+    uint8_t old = __atomic_load_n(&arena->flags, __ATOMIC_RELAXED);
+    for (;;) {
+        page_policy_t const have = (page_policy_t)
+            ((old >> ARENA_BACKING_HAVE_SHIFT) & ARENA_BACKING_WANT_MASK);
+        if (got.pages >= have) {
+            break;
+        }
+        uint8_t const upd = (uint8_t)((old & ~(ARENA_BACKING_WANT_MASK << ARENA_BACKING_HAVE_SHIFT)) |
+                                      ((unsigned)got.pages << ARENA_BACKING_HAVE_SHIFT));
+        if (__atomic_compare_exchange_n(&arena->flags, &old, upd, false,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            break;
+        }
+    }
+    if (got.numa_node != __atomic_load_n(&arena->have_node, __ATOMIC_RELAXED)) {
+        __atomic_store_n(&arena->have_node, (int16_t)-1, __ATOMIC_RELAXED);
+    }
+}
+// -------------------------------------------------------------------------------- 
+
+/* Growth chunks come from malloc unless the arena asked for a non-default
+ * backing, in which case the whole mapping becomes usable data and the
+ * arena's effective backing drops to the weakest policy granted so far. */
+static struct Chunk* _chunk_new_ex(size_t data_bytes, size_t data_align,
+                                   arena_t *arena, error_code_t *err){
+    *err = BAD_ALLOC;
     if ((data_bytes == 0U) || (data_align == 0U) || ((data_align & (data_align - 1U)) != 0U)) {
+        *err = INVALID_ARG;
         return NULL;
     }
 
     /* Worst-case header+pad before data: sizeof(Chunk) + (data_align - 1) */
     if (data_bytes > SIZE_MAX - (sizeof(struct Chunk) + (data_align - 1U))) {
+        *err = LENGTH_OVERFLOW;
         return NULL;
     }
     size_t const total = sizeof(struct Chunk) + (data_align - 1U) + data_bytes;
 
-    struct Chunk* ch = (struct Chunk*)malloc(total);
-    if (ch == NULL) {
-        return NULL;
+    mem_backing_t const want = {
+        .pages     = _arena_want_pages(arena),
+        .numa_node = arena->want_node,
+        .strict    = (arena->flags & ARENA_BACKING_STRICT) != 0u
+    };
+
+    struct Chunk* ch     = NULL;
+    size_t        mapped = 0U;
+    if (_backing_is_default(want)) {
+        ch = (struct Chunk*)malloc(total);
+        if (ch == NULL) {
+            return NULL;
+        }
+    } else {
+        void *p = NULL;
+        mem_backing_t got;
+        error_code_t const ec = _os_map(total, want, &p, &mapped, &got);
+        if (ec != NO_ERROR) {
+            *err = ec;
+            return NULL;
+        }
+        ch = (struct Chunk*)p;
+        _arena_note_backing(arena, got);
     }
 
     uintptr_t const base   = (uintptr_t)ch;
@@ -150,10 +525,11 @@ static struct Chunk* _chunk_new_ex(size_t data_bytes, size_t data_align){
 
     ch->chunk = (uint8_t*)data_p;      /* now truly aligned to data_align */
     ch->len   = 0U;
-    ch->alloc = data_bytes;            /* usable data capacity */
+    ch->alloc = mapped ? (size_t)((base + mapped) - data_p) : data_bytes;
     ch->next  = NULL;
 
-    return ch; /* free(ch) later frees header+pad+data in one go */
+    *err = NO_ERROR;
+    return ch; /* _backing_free(ch, _chunk_map_bytes(...)) releases it all */
 }
 #endif
 // -------------------------------------------------------------------------------- 
@@ -255,10 +631,15 @@ static inline arena_expect_t arena_err(error_code_t e) {
 // -------------------------------------------------------------------------------- 
 
 #if ARENA_ENABLE_DYNAMIC
-arena_expect_t init_dynamic_arena(size_t bytes,
-                                  bool   resize,
-                                  size_t min_chunk_in,
-                                  size_t base_align_in) {
+arena_expect_t init_dynamic_arena_with_backing(size_t        bytes,
+                                               bool          resize,
+                                               size_t        min_chunk_in,
+                                               size_t        base_align_in,
+                                               mem_backing_t backing) {
+    if (!_backing_valid(backing)) {
+        return arena_err(INVALID_ARG);
+    }
+
     /* Normalize min_chunk (0 allowed) */
     size_t min_chunk = min_chunk_in;
     if (min_chunk && !_is_pow2(min_chunk)) {
@@ -291,9 +672,20 @@ arena_expect_t init_dynamic_arena(size_t bytes,
         return arena_err(INVALID_ARG);
     }
 
-    void *base = malloc(total);
-    if (!base) {
-        return arena_err(BAD_ALLOC);
+    void         *base     = NULL;
+    size_t        map_len  = 0u;
+    mem_backing_t got      = { PAGES_DEFAULT, -1, backing.strict };
+    if (_backing_is_default(backing)) {
+        base = malloc(total);
+        if (!base) {
+            return arena_err(BAD_ALLOC);
+        }
+    } else {
+        error_code_t const ec = _os_map(total, backing, &base, &map_len, &got);
+        if (ec != NO_ERROR) {
+            return arena_err(ec);
+        }
+        total = map_len;   /* the rest of the last page is usable too */
     }
 
     uintptr_t const b = (uintptr_t)base;
@@ -304,7 +696,7 @@ arena_expect_t init_dynamic_arena(size_t bytes,
     uintptr_t arena_end = p_arena + sizeof(arena_t);
     if (arena_end < p_arena) {
         /* overflow in addition */
-        free(base);
+        _backing_free(base, map_len);
         return arena_err(LENGTH_OVERFLOW);
     }
 
@@ -312,20 +704,20 @@ arena_expect_t init_dynamic_arena(size_t bytes,
     uintptr_t chunk_end = p_chunk + sizeof(Chunk);
     if (chunk_end < p_chunk || chunk_end > b + total) {
         /* overflow or not enough room */
-        free(base);
+        _backing_free(base, map_len);
         return arena_err(LENGTH_OVERFLOW);
     }
 
     /* Data starts aligned to base_align */
     uintptr_t p_data = _align_up_uintptr(chunk_end, base_align);
     if (p_data > b + total) {
-        free(base);
+        _backing_free(base, map_len);
         return arena_err(ALIGNMENT_ERROR);
     }
 
     size_t usable = (size_t)((b + total) - p_data);
     if (!usable) {
-        free(base);
+        _backing_free(base, map_len);
         return arena_err(OUT_OF_MEMORY);
     }
 
@@ -348,12 +740,24 @@ arena_expect_t init_dynamic_arena(size_t bytes,
     a->mem_type    = (uint8_t)DYNAMIC;
     a->resize      = (uint8_t)(resize ? 1u : 0u);
     a->owns_memory = (uint8_t)1u;
+    _arena_set_backing(a, backing.pages, got.pages, backing.strict,
+                       backing.numa_node, got.numa_node);
 
     return arena_ok(a);
-#endif
 }
 // -------------------------------------------------------------------------------- 
 
+arena_expect_t init_dynamic_arena(size_t bytes,
+                                  bool   resize,
+                                  size_t min_chunk_in,
+                                  size_t base_align_in) {
+    mem_backing_t const backing = { PAGES_DEFAULT, -1, false };
+    return init_dynamic_arena_with_backing(bytes, resize, min_chunk_in,
+                                           base_align_in, backing);
+}
+#endif
+// -------------------------------------------------------------------------------- 
+
 arena_expect_t init_static_arena(void *buffer,
                                  size_t bytes,
                                  size_t alignment_in) {
@@ -442,6 +846,7 @@ arena_expect_t init_static_arena(void *buffer,
     a->mem_type    = (uint8_t)STATIC;
     a->resize      = (uint8_t)0u;
     a->owns_memory = (uint8_t)1u;
+    _arena_set_backing(a, PAGES_DEFAULT, PAGES_DEFAULT, false, -1, -1);
 
     return arena_ok(a);
 }
@@ -545,6 +950,8 @@ arena_expect_t init_arena_with_arena(arena_t *parent,
     a->mem_type    = parent->mem_type;    /* inherit from parent */
     a->resize      = (uint8_t)0u;         /* fixed capacity, cannot grow */
     a->owns_memory = (uint8_t)0u;         /* does NOT own backing memory */
+    _arena_set_backing(a, PAGES_DEFAULT, _arena_have_pages(parent), false,
+                       -1, parent->have_node); /* carved from parent's pages */
 
     return arena_ok(a);
 }
@@ -664,6 +1071,10 @@ arena_expect_t init_arena_with_buddy(buddy_t *buddy,
     a->resize      = 0u;               /* fixed-capacity arena */
     a->owns_memory = 0u;               /* buddy owns the underlying memory */
 
+    mem_backing_t const pool_backing = buddy_backing(buddy);
+    _arena_set_backing(a, PAGES_DEFAULT, pool_backing.pages, false,
+                       -1, pool_backing.numa_node);
+
     /* IMPORTANT: 'a' == 'buffer', so later you can call return_buddy_element(buddy, a). */
 
     return arena_ok(a);
@@ -715,13 +1126,16 @@ void free_arena(arena_t* arena) {
         struct Chunk* cur = arena->head->next;
         while (cur != NULL) {
             struct Chunk* next = cur->next;
-            free(cur);                  /* single malloc frees header+data */
+            _backing_free(cur, _chunk_map_bytes(arena, cur, cur)); /* header+data */
             cur = next;
         }
         arena->head->next = NULL;
     }
 
-    free(arena);
+    /* The head chunk's mapping starts at the arena header itself */
+    size_t const head_map = (arena->head != NULL)
+                          ? _chunk_map_bytes(arena, arena->head, arena) : 0u;
+    _backing_free(arena, head_map);
 }
 // ================================================================================ 
 // ================================================================================ 
@@ -743,6 +1157,136 @@ static inline void_ptr_expect_t vp_err(error_code_t e) {
 }
 // -------------------------------------------------------------------------------- 
 
+/* Next free byte of the tail chunk.  Concurrent arenas do not maintain
+ * arena->cur, and a racing over-reservation can leave Chunk::len briefly past
+ * the end of the chunk, so the cursor is derived from the clamped length. */
+static inline uint8_t *_arena_cursor(const arena_t *arena) {
+    if (((arena->flags & ARENA_CONCURRENT) == 0u) || (arena->tail == NULL)) {
+        return arena->cur;
+    }
+    Chunk const *tail = arena->tail;
+    return tail->chunk + ((tail->len < tail->alloc) ? tail->len : tail->alloc);
+}
+// -------------------------------------------------------------------------------- 
+
+/* Undo the overshoot of a failed fetch-add so len stays within the chunk
+ * once the producers are done.  Successful reservations always end at or
+ * below alloc, so lowering len to alloc never hands out the same bytes. */
+static inline void _chunk_clamp_len(Chunk *c) {
+    size_t seen = __atomic_load_n(&c->len, __ATOMIC_RELAXED);
+    while ((seen > c->alloc) &&
+           !__atomic_compare_exchange_n(&c->len, &seen, c->alloc, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+// -------------------------------------------------------------------------------- 
+
+/* Pad the tail chunk's cursor up to the arena alignment.  The concurrent
+ * bump below only reserves whole multiples of the alignment, so it needs
+ * every offset it starts from to be aligned already; single-threaded
+ * allocations and restore_arena() can leave it anywhere.  The pad is
+ * charged like alloc_arena() padding, and a cursor that cannot be padded
+ * inside the chunk is parked at its end so the next reservation grows. */
+static void _arena_align_tail(arena_t *arena) {
+    Chunk *tail = arena->tail;
+    uintptr_t const start = (uintptr_t)tail->chunk;
+    size_t    const used  = (tail->len < tail->alloc) ? tail->len : tail->alloc;
+    size_t          off   = (size_t)(_align_up_uintptr(start + used, arena->alignment) - start);
+    if (off > tail->alloc) {
+        off = tail->alloc;
+    }
+    arena->len += off - used;
+    tail->len   = off;
+    arena->cur  = tail->chunk + off;
+}
+// -------------------------------------------------------------------------------- 
+
+/* Lock-free bump allocation for arenas in concurrent mode.
+ *
+ * Chunk::len is only advanced with a fetch-add, so each request reserves its
+ * worst-case padding up front: the size is rounded up to the arena alignment,
+ * which keeps every offset in a chunk base-aligned, plus a - base for a
+ * stricter alignment.  A reservation that runs past the chunk end is clamped
+ * back and the thread grows the arena.  A new chunk is published with a CAS
+ * on arena->tail, so one racer installs its chunk and the others release
+ * theirs and retry against the new tail.  The GCC/Clang __atomic builtins
+ * are used so the plain fields keep their cost in the single-threaded path.
+ */
+static void_ptr_expect_t _alloc_arena_concurrent(arena_t *arena, size_t bytes,
+                                                 size_t a, bool zeroed) {
+    size_t const base  = arena->alignment;
+    size_t const slack = a - base;
+    if (bytes > SIZE_MAX - (base - 1u) - slack) {
+        return vp_err(LENGTH_OVERFLOW);
+    }
+    size_t const step = _align_up_size(bytes, base) + slack;
+
+    for (;;) {
+        Chunk *tail = __atomic_load_n(&arena->tail, __ATOMIC_ACQUIRE);
+        if (tail == NULL) {
+            return vp_err(ILLEGAL_STATE);
+        }
+
+        size_t const off = __atomic_fetch_add(&tail->len, step, __ATOMIC_RELAXED);
+        if ((off <= tail->alloc) && (step <= tail->alloc - off)) {
+            uint8_t *p = (uint8_t *)_align_up_uintptr((uintptr_t)(tail->chunk + off), a);
+            __atomic_fetch_add(&arena->len, step, __ATOMIC_RELAXED);
+            if (zeroed) {
+                memset(p, 0, bytes);
+            }
+            return vp_ok(p);
+        }
+        _chunk_clamp_len(tail);
+
+#if ARENA_ENABLE_DYNAMIC
+        if (arena->mem_type == STATIC || !arena->resize) {
+            return vp_err(OPERATION_UNAVAILABLE);
+        }
+
+        /* Someone else may already have replaced the full chunk */
+        if (__atomic_load_n(&arena->tail, __ATOMIC_ACQUIRE) != tail) {
+            continue;
+        }
+
+        size_t const grow_data = _next_chunk_size(tail->alloc, step, base, arena->min_chunk);
+        if (grow_data == 0u) {
+            return vp_err(LENGTH_OVERFLOW);
+        }
+
+        error_code_t grow_err = NO_ERROR;
+        Chunk *nc = _chunk_new_ex(grow_data, base, arena, &grow_err);
+        if (nc == NULL) {
+            return vp_err(grow_err);
+        }
+        nc->len = step;   /* our block, claimed before the chunk is visible */
+
+        Chunk *expected = tail;
+        if (!__atomic_compare_exchange_n(&arena->tail, &expected, nc, false,
+                                         __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            _backing_free(nc, _chunk_map_bytes(arena, nc, nc));
+            continue;
+        }
+
+        /* The chain is only walked by quiescent operations */
+        __atomic_store_n(&tail->next, nc, __ATOMIC_RELEASE);
+        __atomic_fetch_add(&arena->alloc, nc->alloc, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&arena->tot_alloc,
+                           _align_up_size(sizeof(Chunk), base) + nc->alloc,
+                           __ATOMIC_RELAXED);
+        __atomic_fetch_add(&arena->len, step, __ATOMIC_RELAXED);
+
+        uint8_t *p = (uint8_t *)_align_up_uintptr((uintptr_t)nc->chunk, a);
+        if (zeroed) {
+            memset(p, 0, bytes);
+        }
+        return vp_ok(p);
+#else
+        return vp_err(UNSUPPORTED);
+#endif
+    }
+}
+// -------------------------------------------------------------------------------- 
+
 inline void_ptr_expect_t alloc_arena(arena_t *arena, size_t bytes, bool zeroed) {
     /* Basic argument validation */
     if (arena == NULL) {
@@ -758,6 +1302,10 @@ inline void_ptr_expect_t alloc_arena(arena_t *arena, size_t bytes, bool zeroed)
         return vp_err(ALIGNMENT_ERROR);
     }
 
+    if (arena->flags & ARENA_CONCURRENT) {
+        return _alloc_arena_concurrent(arena, bytes, a, zeroed);
+    }
+
     Chunk *tail = arena->tail;
     if (tail == NULL) {
         return vp_err(ILLEGAL_STATE); /* corrupted or uninitialized arena state */
@@ -799,9 +1347,10 @@ inline void_ptr_expect_t alloc_arena(arena_t *arena, size_t bytes, bool zeroed)
         return vp_err(LENGTH_OVERFLOW);
     }
 
-    Chunk *nc = _chunk_new_ex(grow_data, a);
+    error_code_t grow_err = NO_ERROR;
+    Chunk *nc = _chunk_new_ex(grow_data, a, arena, &grow_err);
     if (nc == NULL) {
-        return vp_err(BAD_ALLOC);
+        return vp_err(grow_err);
     }
 
     /* Link new chunk as tail */
@@ -897,6 +1446,10 @@ inline void_ptr_expect_t alloc_arena_aligned(arena_t *arena,
     }
     size_t const a = (a_req < base_align) ? base_align : a_req;
 
+    if (arena->flags & ARENA_CONCURRENT) {
+        return _alloc_arena_concurrent(arena, bytes, a, zeroed);
+    }
+
     Chunk *tail = arena->tail;
     if (tail == NULL) {
         return vp_err(ILLEGAL_STATE); /* corrupted/uninitialized arena */
@@ -941,9 +1494,10 @@ inline void_ptr_expect_t alloc_arena_aligned(arena_t *arena,
         return vp_err(LENGTH_OVERFLOW);
     }
 
-    Chunk *nc = _chunk_new_ex(grow_data, a);
+    error_code_t grow_err = NO_ERROR;
+    Chunk *nc = _chunk_new_ex(grow_data, a, arena, &grow_err);
     if (nc == NULL) {
-        return vp_err(BAD_ALLOC);
+        return vp_err(grow_err);
     }
 
     /* Link new chunk */
@@ -1118,7 +1672,7 @@ bool reset_arena(arena_t *arena, bool trim_extra_chunks) {
 
             /* IMPORTANT: free the header pointer (owns the whole block),
                NOT to_free->chunk which is interior. */
-            free(to_free);
+            _backing_free(to_free, _chunk_map_bytes(arena, to_free, to_free));
             to_free = next;
         }
 
@@ -1148,7 +1702,7 @@ ArenaCheckPoint save_arena(const arena_t* arena) {
     ArenaCheckPointRep rep = {0};
     if (arena) {
         rep.chunk = arena->tail;   // save tail chunk (point-in-time tail)
-        rep.cur   = arena->cur;    // save cursor within that chunk
+        rep.cur   = _arena_cursor(arena);  // save cursor within that chunk
         rep.len   = arena->len;    // optional: total used at save time
     }
     _cp_pack(&pub, &rep);
@@ -1209,7 +1763,7 @@ bool restore_arena(arena_t* arena, ArenaCheckPoint cp) {
                 arena->tot_alloc = 0;  // defensive clamp
             }
             
-            free(to_free);  // Free the chunk header (owns the entire block)
+            _backing_free(to_free, _chunk_map_bytes(arena, to_free, to_free));  // Chunk header owns the entire block
             to_free = next;
         }
         
@@ -1262,6 +1816,12 @@ bool restore_arena(arena_t* arena, ArenaCheckPoint cp) {
     // so we keep that value (it should match total_foot, but the incremental
     // approach is more precise if there were any rounding differences)
 
+    // A checkpoint taken in single-threaded mode may sit off the alignment
+    // the concurrent bump relies on
+    if (arena->flags & ARENA_CONCURRENT) {
+        _arena_align_tail(arena);
+    }
+
     return true;
 }
 // ================================================================================ 
@@ -1349,6 +1909,26 @@ inline bool arena_owns_memory(const arena_t* arena) {
     }
     return (bool)arena->owns_memory;
 }
+// -------------------------------------------------------------------------------- 
+
+bool arena_is_concurrent(const arena_t* arena) {
+    if (!arena) {
+        return false;
+    }
+    return (arena->flags & ARENA_CONCURRENT) != 0u;
+}
+// -------------------------------------------------------------------------------- 
+
+mem_backing_t arena_backing(const arena_t* arena) {
+    if (!arena) {
+        return (mem_backing_t){ PAGES_DEFAULT, -1, false };
+    }
+    return (mem_backing_t){
+        .pages     = _arena_have_pages(arena),
+        .numa_node = arena->have_node,
+        .strict    = (arena->flags & ARENA_BACKING_STRICT) != 0u
+    };
+}
 // ================================================================================ 
 // ================================================================================ 
 // SETTER FUNCTIONS 
@@ -1379,12 +1959,31 @@ inline void toggle_arena_resize(arena_t* arena, bool toggle) {
     return;
 #endif
 }
+// -------------------------------------------------------------------------------- 
+
+void toggle_arena_concurrent(arena_t* arena, bool toggle) {
+    if (!arena || !arena->tail) {
+        return;
+    }
+
+    if (toggle) {
+        if ((arena->flags & ARENA_CONCURRENT) == 0u) {
+            _arena_align_tail(arena);
+        }
+        arena->flags |= (uint8_t)ARENA_CONCURRENT;
+    } else {
+        /* Back to single-threaded bumping from where the producers stopped */
+        arena->cur    = _arena_cursor(arena);
+        arena->flags &= (uint8_t)~ARENA_CONCURRENT;
+    }
+}
 // ================================================================================ 
 // ================================================================================ 
 // LOG FUNCTIONS 
 
 bool arena_stats(const arena_t *arena, char *buffer, size_t buffer_size) {
     size_t offset = 0U;
+    char   node_str[16];
 
     if ((buffer == NULL) || (buffer_size == 0U)) {
         return false;
@@ -1405,6 +2004,13 @@ bool arena_stats(const arena_t *arena, char *buffer, size_t buffer_size) {
         return false;
     }
 
+    if (!_buf_appendf(buffer, buffer_size, &offset,
+                     "  Backing: %s pages, NUMA node %s\n",
+                     page_policy_name(_arena_have_pages(arena)),
+                     _numa_node_str(arena->have_node, node_str, sizeof(node_str)))) {
+        return false;
+    }
+
     if (!_buf_appendf(buffer, buffer_size, &offset,
                      "  Used: %zu bytes\n", arena->len)) {
         return false;
@@ -2439,9 +3045,29 @@ inline bool pool_owns_memory(const pool_t* pool) {
 
 static size_t FREELIST_DEFAULT_MIN_ALLOC = 4096;
 
+/* Segregated-fit index (two-level, TLSF style).  Every block, free or
+ * allocated, starts with a size_t tag holding its size and two flag bits;
+ * sizes and block addresses are multiples of FREELIST_GRANULE so the low
+ * bits are free.  A free block also stores its size in its last word, so
+ * the block after it can find its start when coalescing.
+ *
+ * Free blocks are binned by size: the first level is floor(log2(size)),
+ * the second splits each power-of-two range into FREELIST_SL_COUNT equal
+ * bins.  Two bitmaps mark the non-empty bins, so finding a large enough
+ * block and coalescing with both neighbours are O(1). */
+#define FREELIST_GRANULE   ((size_t)16u)
+#define FREELIST_TAG_FREE  ((size_t)1u)   /* this block is free */
+#define FREELIST_TAG_PREV  ((size_t)2u)   /* the block before this one is free */
+#define FREELIST_TAG_MASK  (FREELIST_GRANULE - 1u)
+#define FREELIST_SL_LOG2   3u
+#define FREELIST_SL_COUNT  (1u << FREELIST_SL_LOG2)
+#define FREELIST_FL_SHIFT  5u             /* log2(FREELIST_MIN_BLOCK) */
+#define FREELIST_MIN_BLOCK ((size_t)1u << FREELIST_FL_SHIFT)
+
 typedef struct free_block {
-    size_t size;
-    struct free_block* next;
+    size_t             tag;   // size | FREELIST_TAG_* flags
+    struct free_block* next;  // bin list
+    struct free_block* prev;
 } free_block_t;
 // -------------------------------------------------------------------------------- 
 
@@ -2452,35 +3078,219 @@ typedef struct freelist_header {
 // -------------------------------------------------------------------------------- 
 
 struct freelist_t {
-    free_block_t* head;     // Head of free list - accessed first in alloc
-    uint8_t*      cur;      // High-water mark - updated on alloc
-    size_t        len;      // Current usage - updated on alloc/free
-    size_t        alignment;// Checked on every alloc
-    void*         memory;   // Start of memory region (for reset/bounds checking)
-    size_t        alloc;    // Total usable memory
-    size_t        tot_alloc;// Total including overhead
-    arena_t*      parent_arena;  // Parent arena reference
-    bool          owns_memory;   // Ownership flag
-    uint8_t       _pad[7];       // Explicit padding to 8-byte boundary
+    free_block_t** bins;    // fl_count * FREELIST_SL_COUNT bin heads - accessed first in alloc
+    uint32_t*      sl_bits; // per first level: non-empty second-level bins
+    size_t         fl_bits; // non-empty first levels
+    uint8_t*       cur;      // High-water mark - updated on alloc
+    size_t         len;      // Current usage - updated on alloc/free
+    size_t         alignment;// Checked on every alloc
+    void*          memory;   // Start of memory region (for reset/bounds checking)
+    size_t         alloc;    // Total usable memory
+    size_t         tot_alloc;// Total including overhead
+    arena_t*       parent_arena;  // Parent arena reference
+    uint32_t       fl_count;      // First-level classes indexed
+    bool           owns_memory;   // Ownership flag
+    uint8_t        _pad[3];       // Explicit padding to 8-byte boundary
 };
 // -------------------------------------------------------------------------------- 
 
-static size_t  freelist_min_request = sizeof(free_block_t);
+static size_t  freelist_min_request = FREELIST_MIN_BLOCK;
 // -------------------------------------------------------------------------------- 
 
-static inline freelist_expect_t freelist_ok(freelist_t* fl) {
-    return (freelist_expect_t){
-        .has_value = true,
-        .u.value   = fl
-    };
+/* floor(log2(x)) and index of the lowest set bit; x must be non-zero. */
+static inline uint32_t _freelist_fls(size_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)(63 - __builtin_clzll((unsigned long long)x));
+#else
+    uint32_t r = 0u;
+    while (x >>= 1u) r++;
+    return r;
+#endif
 }
-// -------------------------------------------------------------------------------- 
 
-static inline freelist_expect_t freelist_err(error_code_t e) {
-    return (freelist_expect_t){
-        .has_value = false,
-        .u.error   = e
-    };
+static inline uint32_t _freelist_ffs(size_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_ctzll((unsigned long long)x);
+#else
+    uint32_t r = 0u;
+    while ((x & 1u) == 0u) { x >>= 1u; r++; }
+    return r;
+#endif
+}
+// -------------------------------------------------------------------------------- 
+
+/* First-level classes needed to index blocks of up to region bytes. */
+static inline uint32_t _freelist_fl_count(size_t region) {
+    if (region < FREELIST_MIN_BLOCK) {
+        region = FREELIST_MIN_BLOCK;
+    }
+    return _freelist_fls(region) - FREELIST_FL_SHIFT + 1u;
+}
+// -------------------------------------------------------------------------------- 
+
+/* Bytes of bin heads and second-level bitmaps stored after freelist_t. */
+static inline size_t _freelist_index_bytes(uint32_t fl_count) {
+    return (size_t)fl_count * FREELIST_SL_COUNT * sizeof(free_block_t*) +
+           (size_t)fl_count * sizeof(uint32_t);
+}
+// -------------------------------------------------------------------------------- 
+
+/* Bytes reserved ahead of the managed region for freelist_t and its index. */
+static inline size_t _freelist_struct_bytes(size_t region, size_t alignment) {
+    return _align_up_size(sizeof(freelist_t) +
+                          _freelist_index_bytes(_freelist_fl_count(region)),
+                          alignment);
+}
+// -------------------------------------------------------------------------------- 
+
+static inline size_t _freelist_block_size(size_t tag) {
+    return tag & ~FREELIST_TAG_MASK;
+}
+// -------------------------------------------------------------------------------- 
+
+static inline void _freelist_mapping(size_t size, uint32_t* fli, uint32_t* sli) {
+    uint32_t const f = _freelist_fls(size);
+    *sli = (uint32_t)(size >> (f - FREELIST_SL_LOG2)) & (FREELIST_SL_COUNT - 1u);
+    *fli = f - FREELIST_FL_SHIFT;
+}
+// -------------------------------------------------------------------------------- 
+
+static inline free_block_t** _freelist_bin(const freelist_t* fl,
+                                           uint32_t fli, uint32_t sli) {
+    return &fl->bins[(size_t)fli * FREELIST_SL_COUNT + sli];
+}
+// -------------------------------------------------------------------------------- 
+
+static void _freelist_bin_insert(freelist_t* fl, free_block_t* block) {
+    uint32_t fli, sli;
+    _freelist_mapping(_freelist_block_size(block->tag), &fli, &sli);
+
+    free_block_t** head = _freelist_bin(fl, fli, sli);
+    block->prev = NULL;
+    block->next = *head;
+    if (*head) (*head)->prev = block;
+    *head = block;
+
+    fl->fl_bits      |= (size_t)1u << fli;
+    fl->sl_bits[fli] |= 1u << sli;
+}
+// -------------------------------------------------------------------------------- 
+
+static void _freelist_bin_remove(freelist_t* fl, free_block_t* block) {
+    uint32_t fli, sli;
+    _freelist_mapping(_freelist_block_size(block->tag), &fli, &sli);
+
+    if (block->next) block->next->prev = block->prev;
+    if (block->prev) {
+        block->prev->next = block->next;
+    } else {
+        free_block_t** head = _freelist_bin(fl, fli, sli);
+        *head = block->next;
+        if (*head == NULL) {
+            fl->sl_bits[fli] &= ~(1u << sli);
+            if (fl->sl_bits[fli] == 0u) {
+                fl->fl_bits &= ~((size_t)1u << fli);
+            }
+        }
+    }
+}
+// -------------------------------------------------------------------------------- 
+
+/* A free block of at least size bytes, or NULL.  The request is rounded up
+ * to the next bin boundary so the head of any non-empty bin found fits;
+ * when no such bin exists the request's own bin is searched. */
+static free_block_t* _freelist_find(const freelist_t* fl, size_t size) {
+    uint32_t fli, sli;
+    uint32_t const f     = _freelist_fls(size);
+    size_t   const round = ((size_t)1u << (f - FREELIST_SL_LOG2)) - 1u;
+
+    if (size <= SIZE_MAX - round) {
+        _freelist_mapping(size + round, &fli, &sli);
+        if (fli < fl->fl_count) {
+            uint32_t sl_map = fl->sl_bits[fli] & (~0u << sli);
+            if (sl_map == 0u) {
+                size_t const fl_map = (fli + 1u < sizeof(size_t) * 8u)
+                    ? fl->fl_bits & (~(size_t)0u << (fli + 1u)) : 0u;
+                if (fl_map != 0u) {
+                    fli    = _freelist_ffs(fl_map);
+                    sl_map = fl->sl_bits[fli];
+                }
+            }
+            if (sl_map != 0u) {
+                return *_freelist_bin(fl, fli, _freelist_ffs(sl_map));
+            }
+        }
+    }
+
+    /* Blocks in the request's own bin may still be large enough. */
+    _freelist_mapping(size, &fli, &sli);
+    if (fli >= fl->fl_count) {
+        return NULL;
+    }
+    for (free_block_t* b = *_freelist_bin(fl, fli, sli); b; b = b->next) {
+        if (_freelist_block_size(b->tag) >= size) {
+            return b;
+        }
+    }
+    return NULL;
+}
+// -------------------------------------------------------------------------------- 
+
+/* Turn [block, block + size) into a free block and bin it. */
+static void _freelist_make_free(freelist_t* fl, uint8_t* block, size_t size) {
+    free_block_t* fb = (free_block_t*)block;
+    fb->tag = size | FREELIST_TAG_FREE;
+    *(size_t*)(block + size - sizeof(size_t)) = size;   /* footer */
+    _freelist_bin_insert(fl, fb);
+}
+// -------------------------------------------------------------------------------- 
+
+/* Clear the bins and make the whole region one free block. */
+static void _freelist_seed(freelist_t* fl) {
+    memset(fl->bins, 0,
+           (size_t)fl->fl_count * FREELIST_SL_COUNT * sizeof(free_block_t*));
+    memset(fl->sl_bits, 0, (size_t)fl->fl_count * sizeof(uint32_t));
+    fl->fl_bits = 0u;
+    fl->cur     = (uint8_t*)fl->memory;
+    fl->len     = 0u;
+
+    _freelist_make_free(fl, (uint8_t*)fl->memory, fl->alloc);
+}
+// -------------------------------------------------------------------------------- 
+
+/* Lay out freelist_t, its index and the managed region inside base. */
+static freelist_t* _freelist_layout(void*    base,
+                                    size_t   struct_size,
+                                    size_t   region,
+                                    uint32_t fl_count) {
+    freelist_t* fl = (freelist_t*)base;
+    memset(fl, 0, sizeof *fl);
+
+    uint8_t* index = (uint8_t*)base + sizeof(freelist_t);
+    fl->fl_count = fl_count;
+    fl->bins     = (free_block_t**)index;
+    fl->sl_bits  = (uint32_t*)(index + (size_t)fl_count * FREELIST_SL_COUNT *
+                                       sizeof(free_block_t*));
+
+    fl->memory = (uint8_t*)base + struct_size;
+    fl->alloc  = region & ~(FREELIST_GRANULE - 1u);
+    return fl;
+}
+// -------------------------------------------------------------------------------- 
+
+static inline freelist_expect_t freelist_ok(freelist_t* fl) {
+    return (freelist_expect_t){
+        .has_value = true,
+        .u.value   = fl
+    };
+}
+// -------------------------------------------------------------------------------- 
+
+static inline freelist_expect_t freelist_err(error_code_t e) {
+    return (freelist_expect_t){
+        .has_value = false,
+        .u.error   = e
+    };
 }
 // -------------------------------------------------------------------------------- 
 
@@ -2508,13 +3318,14 @@ freelist_expect_t init_freelist_with_arena(arena_t* arena,
         alignment = alignof(max_align_t);
     }
 
-    /* Compute struct and usable sizes (both aligned) */
-    size_t struct_size = _align_up_size(sizeof(freelist_t), alignment);
+    /* Compute usable and struct sizes (both aligned); the struct region
+       also holds the bin index for a region of usable_size bytes */
     size_t usable_size = _align_up_size(size, alignment);
 
-    if (usable_size < sizeof(free_block_t)) {
-        usable_size = sizeof(free_block_t);
+    if (usable_size < FREELIST_MIN_BLOCK) {
+        usable_size = FREELIST_MIN_BLOCK;
     }
+    size_t struct_size = _freelist_struct_bytes(usable_size, alignment);
 
     /* Overflow guard: total_alloc = struct_size + usable_size */
     if (struct_size > (SIZE_MAX - usable_size)) {
@@ -2535,27 +3346,19 @@ freelist_expect_t init_freelist_with_arena(arena_t* arena,
         return freelist_err(BAD_ALLOC);
     }
 
-    /* freelist_t struct at the beginning */
-    freelist_t* fl = (freelist_t*)base;
-    memset(fl, 0, sizeof *fl);
-
-    /* Usable memory starts after the struct region (already aligned) */
-    void* memory = (uint8_t*)base + struct_size;
+    /* freelist_t struct and bin index at the beginning; usable memory
+       starts after the struct region (already aligned) */
+    freelist_t* fl = _freelist_layout(base, struct_size, usable_size,
+                                      _freelist_fl_count(usable_size));
 
     /* Initialize freelist metadata */
-    fl->memory       = memory;
-    fl->cur          = (uint8_t*)memory;
-    fl->len          = 0u;
-    fl->alloc        = usable_size;
     fl->tot_alloc    = total_alloc;
     fl->alignment    = alignment;
     fl->owns_memory  = false;     /* arena owns the backing allocation */
     fl->parent_arena = arena;
 
     /* Initialize with one large free block */
-    fl->head       = (free_block_t*)memory;
-    fl->head->size = usable_size;
-    fl->head->next = NULL;
+    _freelist_seed(fl);
 
     return freelist_ok(fl);
 }
@@ -2596,9 +3399,12 @@ freelist_expect_t init_dynamic_freelist(size_t bytes, size_t alignment, bool res
     }
 
     /* Compute minimum user-space required:
-       [aligned freelist_t] + [at least one free_block_t] + [payload bytes] */
-    const size_t struct_size_aligned = _align_up_size(sizeof(freelist_t), a);
-    const size_t min_free_region     = sizeof(free_block_t);
+       [aligned freelist_t + bin index] + [at least one free block] + [payload bytes].
+       The index is sized generously since the arena may hand back more
+       than requested. */
+    const size_t struct_size_aligned =
+        _freelist_struct_bytes((bytes <= SIZE_MAX / 2u) ? 2u * bytes : bytes, a);
+    const size_t min_free_region     = FREELIST_MIN_BLOCK;
     const size_t requested_payload   = bytes;
 
     /* Overflow guard */
@@ -2637,9 +3443,10 @@ freelist_expect_t init_dynamic_freelist(size_t bytes, size_t alignment, bool res
         };
     }
 
-    /* Determine actual usable bytes exposed by arena */
-    const size_t available = arena_remaining(arena);
-    if (available < (struct_size_aligned + min_free_region)) {
+    /* Determine actual usable bytes exposed by arena and index them */
+    const size_t available   = arena_remaining(arena);
+    const size_t struct_size = _freelist_struct_bytes(available, a);
+    if (available < (struct_size + min_free_region)) {
         (void)free_arena(arena);
         return (freelist_expect_t){
             .has_value = false,
@@ -2659,28 +3466,20 @@ freelist_expect_t init_dynamic_freelist(size_t bytes, size_t alignment, bool res
 
     void* base = mem.u.value;
 
-    /* freelist_t at the beginning */
-    freelist_t* fl = (freelist_t*)base;
-    memset(fl, 0, sizeof *fl);
-
-    /* Usable memory starts after the aligned freelist_t */
-    void*  memory    = (uint8_t*)base + struct_size_aligned;
-    size_t usable_sz = available - struct_size_aligned;
+    /* freelist_t and bin index at the beginning; usable memory starts
+       after the aligned struct region */
+    freelist_t* fl = _freelist_layout(base, struct_size,
+                                      available - struct_size,
+                                      _freelist_fl_count(available));
 
     /* Initialize freelist */
-    fl->memory       = memory;
-    fl->cur          = (uint8_t*)memory;
-    fl->len          = 0u;
-    fl->alloc        = usable_sz;
     fl->tot_alloc    = available;
     fl->alignment    = a;
     fl->parent_arena = arena;
     fl->owns_memory  = true;
 
     /* One large free block spans the entire usable region */
-    fl->head       = (free_block_t*)memory;
-    fl->head->size = usable_sz;
-    fl->head->next = NULL;
+    _freelist_seed(fl);
 
     return (freelist_expect_t){
         .has_value = true,
@@ -2706,7 +3505,7 @@ freelist_expect_t init_static_freelist(void* buffer, size_t bytes, size_t alignm
     }
 
     /* Must at least fit control structs in the caller buffer */
-    if (bytes < (sizeof(freelist_t) + sizeof(free_block_t))) {
+    if (bytes < (sizeof(freelist_t) + FREELIST_MIN_BLOCK)) {
         return freelist_err(INVALID_ARG);
     }
 
@@ -2734,12 +3533,12 @@ freelist_expect_t init_static_freelist(void* buffer, size_t bytes, size_t alignm
         return freelist_err(INVALID_ARG);
     }
 
-    /* Space for freelist header inside arena user space */
-    const size_t fl_hdr = _align_up_size(sizeof(freelist_t), a);
-
     /* Use arena usable capacity (data capacity, not total footprint) */
     const size_t arena_bytes = arena_alloc(arena); /* or arena->alloc */
-    if (arena_bytes < (fl_hdr + sizeof(free_block_t))) {
+
+    /* Space for freelist header and bin index inside arena user space */
+    const size_t fl_hdr = _freelist_struct_bytes(arena_bytes, a);
+    if (arena_bytes < (fl_hdr + FREELIST_MIN_BLOCK)) {
         return freelist_err(INVALID_ARG);
     }
 
@@ -2754,23 +3553,15 @@ freelist_expect_t init_static_freelist(void* buffer, size_t bytes, size_t alignm
     void* base = mem.u.value;
 
     /* Stitch in-place */
-    freelist_t* fl = (freelist_t*)base;
-    memset(fl, 0, sizeof *fl);
+    freelist_t* fl = _freelist_layout(base, fl_hdr, usable_size,
+                                      _freelist_fl_count(arena_bytes));
 
-    void* region = (uint8_t*)base + fl_hdr;
-
-    fl->memory       = region;
-    fl->cur          = (uint8_t*)region;
-    fl->len          = 0u;
-    fl->alloc        = usable_size;
     fl->tot_alloc    = total_needed;
     fl->alignment    = a;
     fl->parent_arena = arena;
     fl->owns_memory  = false; /* caller owns the static buffer */
 
-    fl->head       = (free_block_t*)region;
-    fl->head->size = usable_size;
-    fl->head->next = NULL;
+    _freelist_seed(fl);
 
     return freelist_ok(fl);
 }
@@ -2809,90 +3600,83 @@ static void_ptr_expect_t alloc_freelist_internal(freelist_t* fl,
     if ((eff_align & (eff_align - 1u)) != 0u) {
         return (void_ptr_expect_t){ .has_value = false, .u.error = ALIGNMENT_ERROR };
     }
+    if (eff_align < FREELIST_GRANULE) {
+        eff_align = FREELIST_GRANULE;
+    }
 
     const size_t header_size = sizeof(freelist_header_t);
 
-    /* Overflow guard for: user_addr = align_up(block_addr + header_size, eff_align)
-       and user_end = user_addr + bytes */
-    if (bytes > SIZE_MAX - header_size - (eff_align - 1u)) {
+    /* Overflow guard for the worst-case block: the header plus alignment
+       padding ahead of the user region, then bytes rounded to the granule */
+    if (bytes > SIZE_MAX - header_size - eff_align - FREELIST_GRANULE) {
         return (void_ptr_expect_t){ .has_value = false, .u.error = CAPACITY_OVERFLOW };
     }
 
-    free_block_t** current = &fl->head;
-
-    while (*current) {
-        free_block_t* block      = *current;
-        uintptr_t     block_addr = (uintptr_t)block;
-
-        /* Defensive overflow check for block_end */
-        if (block->size > (size_t)(UINTPTR_MAX - block_addr)) {
-            return (void_ptr_expect_t){ .has_value = false, .u.error = CAPACITY_OVERFLOW };
-        }
-        uintptr_t block_end = block_addr + (uintptr_t)block->size;
-
-        uintptr_t after_header = block_addr + (uintptr_t)header_size;
-        uintptr_t user_addr    = _align_up_uintptr(after_header, eff_align);
-
-        /* Defensive overflow check for user_end */
-        if ((uintptr_t)bytes > (UINTPTR_MAX - user_addr)) {
-            return (void_ptr_expect_t){ .has_value = false, .u.error = CAPACITY_OVERFLOW };
-        }
-        uintptr_t user_end = user_addr + (uintptr_t)bytes;
-
-        if (user_end > block_end) {
-            current = &block->next;
-            continue;
-        }
+    /* Block addresses are granule aligned, so the user region starts at
+       most max(header_size, eff_align) bytes into any block. */
+    const size_t lead = (eff_align > header_size) ? eff_align : header_size;
+    size_t need = _align_up_size(lead + bytes, FREELIST_GRANULE);
+    if (need < FREELIST_MIN_BLOCK) {
+        need = FREELIST_MIN_BLOCK;
+    }
 
-        size_t offset    = (size_t)(user_addr - block_addr);
-        size_t used_size = (size_t)(user_end  - block_addr);
-        size_t remaining = block->size - used_size;
+    free_block_t* block = _freelist_find(fl, need);
+    if (!block) {
+        /* No block large enough */
+        return (void_ptr_expect_t){ .has_value = false, .u.error = CAPACITY_OVERFLOW };
+    }
+    _freelist_bin_remove(fl, block);
 
-        size_t block_size_for_hdr;
+    uint8_t*  block_start = (uint8_t*)block;
+    size_t    block_size  = _freelist_block_size(block->tag);
+    uintptr_t block_addr  = (uintptr_t)block_start;
+    uintptr_t user_addr   = _align_up_uintptr(block_addr + header_size, eff_align);
 
-        if (remaining >= sizeof(free_block_t)) {
-            /* Split block: front portion used, remainder stays free */
-            free_block_t* new_block = (free_block_t*)((uint8_t*)block + used_size);
-            new_block->size = remaining;
-            new_block->next = block->next;
+    size_t offset    = (size_t)(user_addr - block_addr);
+    size_t used_size = _align_up_size(offset + bytes, FREELIST_GRANULE);
+    size_t remaining = block_size - used_size;
 
-            block->size = used_size;
-            *current    = new_block;
+    uint8_t* mem_end = (uint8_t*)fl->memory + fl->alloc;
 
-            block_size_for_hdr = used_size;
-        } else {
-            /* Consume entire block */
-            block_size_for_hdr = block->size;
-            *current           = block->next;
+    if (remaining >= FREELIST_MIN_BLOCK) {
+        /* Split block: front portion used, remainder stays free.  The
+           block after the remainder already records a free predecessor. */
+        _freelist_make_free(fl, block_start + used_size, remaining);
+    } else {
+        /* Consume entire block */
+        used_size = block_size;
 
-            /* user_end is no longer meaningful; the header records real block size */
+        uint8_t* next = block_start + block_size;
+        if (next < mem_end) {
+            *(size_t*)next &= ~FREELIST_TAG_PREV;
         }
+    }
 
-        uint8_t* user_ptr = (uint8_t*)user_addr;
+    /* Free blocks are always coalesced, so the predecessor is in use.
+       The tag is written first: with no padding the header overlays it. */
+    *(size_t*)block_start = used_size;
 
-        freelist_header_t* hdr =
-            (freelist_header_t*)(user_ptr - header_size);
+    uint8_t* user_ptr = (uint8_t*)user_addr;
 
-        hdr->block_size = block_size_for_hdr;
-        hdr->offset     = offset;
+    freelist_header_t* hdr =
+        (freelist_header_t*)(user_ptr - header_size);
 
-        /* Account full block consumption */
-        fl->len += block_size_for_hdr;
+    hdr->block_size = used_size;
+    hdr->offset     = offset;
 
-        uint8_t* block_used_end = (uint8_t*)block + block_size_for_hdr;
-        if (block_used_end > fl->cur) {
-            fl->cur = block_used_end;
-        }
+    /* Account full block consumption */
+    fl->len += used_size;
 
-        if (zeroed) {
-            memset(user_ptr, 0, bytes);
-        }
+    uint8_t* block_used_end = block_start + used_size;
+    if (block_used_end > fl->cur) {
+        fl->cur = block_used_end;
+    }
 
-        return (void_ptr_expect_t){ .has_value = true, .u.value = user_ptr };
+    if (zeroed) {
+        memset(user_ptr, 0, bytes);
     }
 
-    /* No block large enough */
-    return (void_ptr_expect_t){ .has_value = false, .u.error = CAPACITY_OVERFLOW };
+    return (void_ptr_expect_t){ .has_value = true, .u.value = user_ptr };
 }
 // --------------------------------------------------------------------------------
 
@@ -2977,26 +3761,30 @@ void return_freelist_element(freelist_t* fl, void* ptr) {
     freelist_header_t* hdr =
         (freelist_header_t*)(user_ptr - header_size);
 
-    size_t   block_size = hdr->block_size;
+    size_t   block_size = _freelist_block_size(hdr->block_size);
     size_t   offset     = hdr->offset;
 
+    // Sanity checks on block size and offset before touching block_start
+    if (block_size < FREELIST_MIN_BLOCK || block_size > fl->alloc) {
+        return;
+    }
+    if (offset < header_size || offset > block_size ||
+        offset > (size_t)(user_ptr - mem_start8)) {
+        return;
+    }
+
     // Reconstruct block start
     uint8_t* block_start = user_ptr - offset;
 
-    uintptr_t block_addr = (uintptr_t)block_start;
-    uintptr_t mem_start  = (uintptr_t)fl->memory;
-    uintptr_t mem_end    = mem_start + fl->alloc;
-
-    // Sanity checks on block size and bounds
-    if (block_size < sizeof(free_block_t) || block_size > fl->alloc) {
-        return;
-    }
-    if (block_addr < mem_start || block_addr + block_size > mem_end) {
+    if (((size_t)(block_start - mem_start8) & FREELIST_TAG_MASK) != 0u ||
+        block_size > (size_t)(mem_end8 - block_start)) {
         return;
     }
 
-    // Also ensure offset is sane (block_size must cover offset + header at least)
-    if (offset > block_size) {
+    // The block's own tag must agree and not already be free (double free)
+    size_t const tag = *(size_t*)block_start;
+    if ((tag & FREELIST_TAG_FREE) != 0u ||
+        _freelist_block_size(tag) != block_size) {
         return;
     }
 
@@ -3006,42 +3794,35 @@ void return_freelist_element(freelist_t* fl, void* ptr) {
     }
     fl->len -= block_size;
 
-    // Turn region back into a free block
-    free_block_t* block = (free_block_t*)block_start;
-    block->size = block_size;
-
-    // Insert into free list in address order
-    free_block_t* prev = NULL;
-    free_block_t* curr = fl->head;
-
-    while (curr && curr < block) {
-        prev = curr;
-        curr = curr->next;
+    // Mark the old tag free first, so a repeated free of ptr is rejected
+    // even after the block has been merged into a predecessor
+    *(size_t*)block_start = tag | FREELIST_TAG_FREE;
+
+    // Coalesce with next block if it is free
+    uint8_t* next = block_start + block_size;
+    if (next < mem_end8) {
+        free_block_t* nb = (free_block_t*)next;
+        if ((nb->tag & FREELIST_TAG_FREE) != 0u) {
+            _freelist_bin_remove(fl, nb);
+            block_size += _freelist_block_size(nb->tag);
+        }
     }
 
-    block->next = curr;
-    if (prev) {
-        prev->next = block;
-    } else {
-        fl->head = block;
+    // Coalesce with previous block if it is free; its footer gives its size
+    if ((tag & FREELIST_TAG_PREV) != 0u) {
+        size_t const prev_size = *(size_t*)(block_start - sizeof(size_t));
+        free_block_t* pb = (free_block_t*)(block_start - prev_size);
+        _freelist_bin_remove(fl, pb);
+        block_start  = (uint8_t*)pb;
+        block_size  += prev_size;
     }
 
-    // Coalesce with next block if adjacent
-    if (block->next) {
-        uint8_t* block_end = (uint8_t*)block + block->size;
-        if (block_end == (uint8_t*)block->next) {
-            block->size += block->next->size;
-            block->next  = block->next->next;
-        }
-    }
+    _freelist_make_free(fl, block_start, block_size);
 
-    // Coalesce with previous block if adjacent
-    if (prev) {
-        uint8_t* prev_end = (uint8_t*)prev + prev->size;
-        if (prev_end == (uint8_t*)block) {
-            prev->size += block->size;
-            prev->next  = block->next;
-        }
+    // Tell the following block its predecessor is now free
+    next = block_start + block_size;
+    if (next < mem_end8) {
+        *(size_t*)next |= FREELIST_TAG_PREV;
     }
 }
 // -------------------------------------------------------------------------------- 
@@ -3148,16 +3929,9 @@ inline void reset_freelist(freelist_t* fl) {
         return;
     }
 
-    // Reset accounting
-    fl->cur = (uint8_t*)fl->memory;
-    fl->len = 0;
-
-    // Recreate a single large free block covering the entire region
-    free_block_t* head = (free_block_t*)fl->memory;
-    head->size = fl->alloc;
-    head->next = NULL;
-
-    fl->head = head;
+    // Reset accounting, empty the bins and recreate a single large free
+    // block covering the entire region
+    _freelist_seed(fl);
 }
 // -------------------------------------------------------------------------------- 
 
@@ -3183,7 +3957,7 @@ bool is_freelist_ptr(const freelist_t* fl, const void* ptr) {
     const freelist_header_t* hdr =
         (const freelist_header_t*)(user_ptr - header_size);
 
-    size_t block_size = hdr->block_size;
+    size_t block_size = _freelist_block_size(hdr->block_size);
     size_t offset     = hdr->offset;
 
     // Reconstruct block start
@@ -3195,7 +3969,7 @@ bool is_freelist_ptr(const freelist_t* fl, const void* ptr) {
     if (offset > block_size) {
         return false;
     }
-    if (block_size < sizeof(free_block_t) || block_size > fl->alloc) {
+    if (block_size < FREELIST_MIN_BLOCK || block_size > fl->alloc) {
         return false;
     }
 
@@ -3235,7 +4009,7 @@ bool is_freelist_ptr_sized(const freelist_t* fl, const void* ptr, size_t size) {
     const freelist_header_t* hdr =
         (const freelist_header_t*)(user_ptr - header_size);
 
-    size_t block_size = hdr->block_size;
+    size_t block_size = _freelist_block_size(hdr->block_size);
     size_t offset     = hdr->offset;
 
     if (offset > block_size) {
@@ -3410,25 +4184,39 @@ bool freelist_stats(const freelist_t *fl, char *buffer, size_t buffer_size) {
         }
     }
 
-    /* Free list layout */
+    /* Free block layout, in address order (every block starts with its
+       size tag, so the region can be walked block by block) */
     {
-        const free_block_t *current = fl->head;
-        int   block_count           = 0;
-        size_t free_bytes           = 0u;
-
-        while (current != NULL) {
-            block_count += 1;
-            free_bytes  += current->size;
+        const uint8_t *current  = (const uint8_t *)fl->memory;
+        const uint8_t *end      = current + fl->alloc;
+        int    block_count      = 0;
+        size_t free_bytes       = 0u;
+        size_t largest          = 0u;
+
+        while (current < end) {
+            size_t const tag  = *(const size_t *)current;
+            size_t const size = _freelist_block_size(tag);
+            if (size == 0u || size > (size_t)(end - current)) {
+                break;  /* corrupted tag; stop rather than run off the region */
+            }
 
-            if (!_buf_appendf(buffer, buffer_size, &offset,
-                              "  Free block %d: %p, %zu bytes\n",
-                              block_count,
-                              (const void *)current,
-                              current->size)) {
-                return false;
+            if ((tag & FREELIST_TAG_FREE) != 0u) {
+                block_count += 1;
+                free_bytes  += size;
+                if (size > largest) {
+                    largest = size;
+                }
+
+                if (!_buf_appendf(buffer, buffer_size, &offset,
+                                  "  Free block %d: %p, %zu bytes\n",
+                                  block_count,
+                                  (const void *)current,
+                                  size)) {
+                    return false;
+                }
             }
 
-            current = current->next;
+            current += size;
         }
 
         if (!_buf_appendf(buffer, buffer_size, &offset,
@@ -3436,6 +4224,26 @@ bool freelist_stats(const freelist_t *fl, char *buffer, size_t buffer_size) {
                           block_count, free_bytes)) {
             return false;
         }
+
+        if (!_buf_appendf(buffer, buffer_size, &offset,
+                          "  Largest free block: %zu bytes\n", largest)) {
+            return false;
+        }
+
+        /* External fragmentation: share of free bytes that cannot be
+           handed out as one block, 1 - largest / total free */
+        if (free_bytes == 0u) {
+            if (!_buf_appendf(buffer, buffer_size, &offset,
+                              "%s", "  Fragmentation: N/A (no free bytes)\n")) {
+                return false;
+            }
+        } else {
+            double frag = 100.0 * (1.0 - (double)largest / (double)free_bytes);
+            if (!_buf_appendf(buffer, buffer_size, &offset,
+                              "  Fragmentation: %.1f%%\n", frag)) {
+                return false;
+            }
+        }
     }
 
     return true;
@@ -3445,9 +4253,12 @@ bool freelist_stats(const freelist_t *fl, char *buffer, size_t buffer_size) {
 // BUDDY ALLOCATOR 
 
 #if ARENA_ENABLE_DYNAMIC
-/* Free block node (stored in the block memory itself when free). */
+/* Free block node (stored in the block memory itself when free).  The
+ * list is doubly linked so a buddy found through the free bitmap can be
+ * unlinked in O(1). */
 typedef struct buddy_block {
     struct buddy_block *next;
+    struct buddy_block *prev;
 } buddy_block_t;
 
 /* Per-block header (stored at the start of every allocated block). */
@@ -3461,12 +4272,15 @@ struct buddy_t {
     /* Hot-ish fields used in most operations */
     void           *base;
     buddy_block_t **free_lists;
+    uint64_t       *free_bits;    /* one bit per block per level: on a free list */
+    size_t         *bit_offsets;  /* first free_bits word of each level */
 
     /* Usage / capacity */
     size_t          pool_size;
     size_t          len;
     size_t          alloc;
     size_t          total_alloc;
+    size_t          map_bytes;    /* length of the OS mapping at base */
 
     /* Alignment policy */
     size_t          base_align;   /* per-allocator minimum alignment  */
@@ -3476,53 +4290,13 @@ struct buddy_t {
     uint32_t        min_order;
     uint32_t        max_order;
     uint32_t        num_levels;
-    uint8_t         _pad[4];      /* keep sizeof(buddy_t) % 8 == 0    */
+    int32_t         numa_node;    /* node the pool is bound to, or -1 */
+    uint8_t         pages;        /* page_policy_t in effect for base */
+    uint8_t         strict;       /* backing was requested as strict  */
+    uint8_t         _pad[6];      /* keep sizeof(buddy_t) % 8 == 0    */
 };
 // -------------------------------------------------------------------------------- 
 
-/* --- OS abstraction layer: get/release a big contiguous region --- */
-
-#ifdef _WIN32
-    #define WIN32_LEAN_AND_MEAN
-    #include <windows.h>
-
-    static void *buddy_os_alloc(size_t size) {
-        /* Round to page size if you want to be strict; VirtualAlloc
-           already works in page granularity. */
-        return VirtualAlloc(NULL, size,
-                            MEM_RESERVE | MEM_COMMIT,
-                            PAGE_READWRITE);
-    }
-
-    static void buddy_os_free(void *ptr, size_t size) {
-        (void)size; /* not needed for MEM_RELEASE */
-        if (ptr) {
-            VirtualFree(ptr, 0, MEM_RELEASE);
-        }
-    }
-
-#else  /* POSIX: Linux, BSD, macOS, etc. */
-
-    #define _GNU_SOURCE
-    #include <sys/mman.h>
-    #include <unistd.h>
-
-    static void *buddy_os_alloc(size_t size) {
-        void *p = mmap(NULL, size,
-                       PROT_READ | PROT_WRITE,
-                       MAP_PRIVATE | MAP_ANONYMOUS,
-                       -1, 0);
-        return (p == MAP_FAILED) ? NULL : p;
-    }
-
-    static void buddy_os_free(void *ptr, size_t size) {
-        if (ptr && size) {
-            (void)munmap(ptr, size);
-        }
-    }
-
-#endif
-// -------------------------------------------------------------------------------- 
 
 static uint32_t _ilog2_size(size_t x) {
     uint32_t r = 0;
@@ -3549,34 +4323,77 @@ static int32_t _find_nonempty_level(const buddy_t *b, uint32_t desired_level) {
 }
 // -------------------------------------------------------------------------------- 
 
-static void _freelist_push(buddy_block_t **head, buddy_block_t *blk) {
-    blk->next = *head;
-    *head = blk;
+/* Number of free_bits words needed for one level of the pool. */
+static inline size_t _level_bit_words(size_t pool, uint32_t order) {
+    size_t const blocks = pool >> order;
+    return (blocks + 63u) / 64u;
 }
 // -------------------------------------------------------------------------------- 
 
-static bool _freelist_remove(buddy_block_t **head, buddy_block_t *blk) {
-    buddy_block_t *prev = NULL;
-    buddy_block_t *cur  = *head;
-    while (cur) {
-        if (cur == blk) {
-            if (prev) prev->next = cur->next;
-            else      *head = cur->next;
-            return true;
-        }
-        prev = cur;
-        cur  = cur->next;
-    }
-    return false;
+/* Bit position of the block at byte offset `off` on `level`. */
+static inline size_t _freebit_index(const buddy_t *b, uint32_t level, size_t off) {
+    return b->bit_offsets[level] * 64u + (off >> (b->min_order + level));
+}
+// -------------------------------------------------------------------------------- 
+
+static inline bool _freebit_test(const buddy_t *b, uint32_t level, size_t off) {
+    size_t const i = _freebit_index(b, level, off);
+    return (b->free_bits[i >> 6] >> (i & 63u)) & 1u;
+}
+// -------------------------------------------------------------------------------- 
+
+static inline void _freebit_set(buddy_t *b, uint32_t level, size_t off) {
+    size_t const i = _freebit_index(b, level, off);
+    b->free_bits[i >> 6] |= (uint64_t)1u << (i & 63u);
+}
+// -------------------------------------------------------------------------------- 
+
+static inline void _freebit_clear(buddy_t *b, uint32_t level, size_t off) {
+    size_t const i = _freebit_index(b, level, off);
+    b->free_bits[i >> 6] &= ~((uint64_t)1u << (i & 63u));
+}
+// -------------------------------------------------------------------------------- 
+
+static inline size_t _block_offset(const buddy_t *b, const buddy_block_t *blk) {
+    return (size_t)((const uint8_t *)blk - (const uint8_t *)b->base);
+}
+// -------------------------------------------------------------------------------- 
+
+static void _freelist_push(buddy_t *b, uint32_t level, buddy_block_t *blk) {
+    buddy_block_t *head = b->free_lists[level];
+    blk->prev = NULL;
+    blk->next = head;
+    if (head) head->prev = blk;
+    b->free_lists[level] = blk;
+    _freebit_set(b, level, _block_offset(b, blk));
+}
+// -------------------------------------------------------------------------------- 
+
+static void _freelist_remove(buddy_t *b, uint32_t level, buddy_block_t *blk) {
+    if (blk->prev) blk->prev->next   = blk->next;
+    else           b->free_lists[level] = blk->next;
+    if (blk->next) blk->next->prev   = blk->prev;
+    blk->next = NULL;
+    blk->prev = NULL;
+    _freebit_clear(b, level, _block_offset(b, blk));
 }
 // -------------------------------------------------------------------------------- 
 
-static buddy_block_t *_freelist_find(buddy_block_t *head, void *addr) {
-    while (head) {
-        if ((void *)head == addr) return head;
-        head = head->next;
+static buddy_block_t *_freelist_pop(buddy_t *b, uint32_t level) {
+    buddy_block_t *blk = b->free_lists[level];
+    if (blk) {
+        _freelist_remove(b, level, blk);
     }
-    return NULL;
+    return blk;
+}
+// -------------------------------------------------------------------------------- 
+
+/* Clear every free list and bitmap, then make the whole pool one free block. */
+static void _buddy_seed(buddy_t *b) {
+    memset(b->free_lists, 0, b->num_levels * sizeof(buddy_block_t *));
+    memset(b->free_bits, 0,
+           b->bit_offsets[b->num_levels] * sizeof(uint64_t));
+    _freelist_push(b, _order_to_level(b, b->max_order), (buddy_block_t *)b->base);
 }
 // -------------------------------------------------------------------------------- 
 
@@ -3595,11 +4412,12 @@ static inline buddy_expect_t buddy_err(error_code_t e) {
 }
 // -------------------------------------------------------------------------------- 
 
-buddy_expect_t init_buddy_allocator(size_t pool_size,
-                                    size_t min_block_size,
-                                    size_t base_align) {
+buddy_expect_t init_buddy_allocator_with_backing(size_t        pool_size,
+                                                 size_t        min_block_size,
+                                                 size_t        base_align,
+                                                 mem_backing_t backing) {
     /* ---- validate obvious inputs */
-    if (pool_size == 0u || min_block_size == 0u) {
+    if (pool_size == 0u || min_block_size == 0u || !_backing_valid(backing)) {
         return buddy_err(INVALID_ARG);
     }
 
@@ -3644,6 +4462,11 @@ buddy_expect_t init_buddy_allocator(size_t pool_size,
         min_block_size = user_offset;
     }
 
+    /* ... and the free-list links written into a free block */
+    if (min_block_size < sizeof(buddy_block_t)) {
+        min_block_size = sizeof(buddy_block_t);
+    }
+
     /* ---- round sizes up to powers of two (overflow -> CAPACITY_OVERFLOW) */
     size_t const min_blk = _next_pow2(min_block_size);
     if (min_blk == 0u) {
@@ -3673,15 +4496,41 @@ buddy_expect_t init_buddy_allocator(size_t pool_size,
     }
 
     /* ---- allocate backing pool */
-    void *base = buddy_os_alloc(pool);
-    if (!base) {
+    void         *base     = NULL;
+    size_t        map_len  = 0u;
+    mem_backing_t got;
+    error_code_t const map_err = _os_map(pool, backing, &base, &map_len, &got);
+    if (map_err != NO_ERROR) {
         free(b);
-        return buddy_err(BAD_ALLOC);
+        return buddy_err(map_err);
     }
 
     buddy_block_t **free_lists = calloc(num_levels, sizeof(buddy_block_t *));
     if (!free_lists) {
-        buddy_os_free(base, pool);
+        _os_unmap(base, map_len);
+        free(b);
+        return buddy_err(BAD_ALLOC);
+    }
+
+    /* Per-level free bitmaps, packed back to back: level L needs one bit for
+     * each of the pool >> (min_order + L) blocks at that level. */
+    size_t *bit_offsets = calloc(num_levels + 1u, sizeof(size_t));
+    if (!bit_offsets) {
+        _os_unmap(base, map_len);
+        free(free_lists);
+        free(b);
+        return buddy_err(BAD_ALLOC);
+    }
+    for (uint32_t lvl = 0u; lvl < num_levels; ++lvl) {
+        bit_offsets[lvl + 1u] = bit_offsets[lvl]
+                              + _level_bit_words(pool, min_order + lvl);
+    }
+
+    uint64_t *free_bits = calloc(bit_offsets[num_levels], sizeof(uint64_t));
+    if (!free_bits) {
+        _os_unmap(base, map_len);
+        free(bit_offsets);
+        free(free_lists);
         free(b);
         return buddy_err(BAD_ALLOC);
     }
@@ -3689,10 +4538,16 @@ buddy_expect_t init_buddy_allocator(size_t pool_size,
     /* ---- populate buddy struct */
     b->base       = base;
     b->pool_size  = pool;
+    b->map_bytes  = map_len;
+    b->pages      = (uint8_t)got.pages;
+    b->numa_node  = got.numa_node;
+    b->strict     = (uint8_t)(backing.strict ? 1u : 0u);
     b->min_order  = min_order;
     b->max_order  = max_order;
-    b->num_levels = num_levels;
-    b->free_lists = free_lists;
+    b->num_levels  = num_levels;
+    b->free_lists  = free_lists;
+    b->free_bits   = free_bits;
+    b->bit_offsets = bit_offsets;
 
     b->alloc       = pool;
     b->len         = 0u;
@@ -3701,7 +4556,9 @@ buddy_expect_t init_buddy_allocator(size_t pool_size,
     size_t total = pool;
 
     if (num_levels > SIZE_MAX / sizeof(buddy_block_t *)) {
-        buddy_os_free(base, pool);
+        _os_unmap(base, map_len);
+        free(free_bits);
+        free(bit_offsets);
         free(free_lists);
         free(b);
         return buddy_err(CAPACITY_OVERFLOW);
@@ -3709,15 +4566,31 @@ buddy_expect_t init_buddy_allocator(size_t pool_size,
     size_t const lists_bytes = (size_t)num_levels * sizeof(buddy_block_t *);
 
     if (total > SIZE_MAX - lists_bytes) {
-        buddy_os_free(base, pool);
+        _os_unmap(base, map_len);
+        free(free_bits);
+        free(bit_offsets);
         free(free_lists);
         free(b);
         return buddy_err(CAPACITY_OVERFLOW);
     }
     total += lists_bytes;
 
+    size_t const bits_bytes = bit_offsets[num_levels] * sizeof(uint64_t)
+                            + (num_levels + 1u) * sizeof(size_t);
+    if (total > SIZE_MAX - bits_bytes) {
+        _os_unmap(base, map_len);
+        free(free_bits);
+        free(bit_offsets);
+        free(free_lists);
+        free(b);
+        return buddy_err(CAPACITY_OVERFLOW);
+    }
+    total += bits_bytes;
+
     if (total > SIZE_MAX - sizeof(*b)) {
-        buddy_os_free(base, pool);
+        _os_unmap(base, map_len);
+        free(free_bits);
+        free(bit_offsets);
         free(free_lists);
         free(b);
         return buddy_err(CAPACITY_OVERFLOW);
@@ -3730,24 +4603,31 @@ buddy_expect_t init_buddy_allocator(size_t pool_size,
     b->user_offset = user_offset;
 
     /* ---- seed top free list */
-    buddy_block_t *initial_block = (buddy_block_t *)base;
-    initial_block->next = NULL;
-
-    uint32_t const top_level = _order_to_level(b, max_order);
-    b->free_lists[top_level] = initial_block;
+    _buddy_seed(b);
 
     return buddy_ok(b);
 }
 // -------------------------------------------------------------------------------- 
 
+buddy_expect_t init_buddy_allocator(size_t pool_size,
+                                    size_t min_block_size,
+                                    size_t base_align) {
+    mem_backing_t const backing = { PAGES_DEFAULT, -1, false };
+    return init_buddy_allocator_with_backing(pool_size, min_block_size,
+                                             base_align, backing);
+}
+// -------------------------------------------------------------------------------- 
+
 void free_buddy(buddy_t *b) {
     if (!b) return;
 
-    if (b->base && b->pool_size) {
-        buddy_os_free(b->base, b->pool_size);
+    if (b->base && b->map_bytes) {
+        _os_unmap(b->base, b->map_bytes);
     }
 
     free(b->free_lists);
+    free(b->free_bits);
+    free(b->bit_offsets);
     memset(b, 0, sizeof(*b));
     free(b);
 }
@@ -3795,9 +4675,7 @@ void_ptr_expect_t alloc_buddy(buddy_t *b, size_t size, bool zeroed) {
     }
 
     /* Pop a block from level 'lvl'. */
-    buddy_block_t *block = b->free_lists[lvl];
-    b->free_lists[lvl]   = block->next;
-    block->next          = NULL;
+    buddy_block_t *block = _freelist_pop(b, (uint32_t)lvl);
 
     uint32_t current_order = _level_to_order(b, (uint32_t)lvl);
     size_t   current_size  = (size_t)1u << current_order;
@@ -3809,10 +4687,9 @@ void_ptr_expect_t alloc_buddy(buddy_t *b, size_t size, bool zeroed) {
 
         buddy_block_t *split_block =
             (buddy_block_t *)((uint8_t *)block + current_size);
-        split_block->next = NULL;
 
         uint32_t split_level = _order_to_level(b, current_order);
-        _freelist_push(&b->free_lists[split_level], split_block);
+        _freelist_push(b, split_level, split_block);
     }
 
     /* Final block is size 2^order. */
@@ -3900,9 +4777,7 @@ void_ptr_expect_t alloc_buddy_aligned(buddy_t *b,
     }
 
     /* Take a block from level 'lvl'. */
-    buddy_block_t *block = b->free_lists[lvl];
-    b->free_lists[lvl]   = block->next;
-    block->next          = NULL;
+    buddy_block_t *block = _freelist_pop(b, (uint32_t)lvl);
 
     uint32_t current_order = _level_to_order(b, (uint32_t)lvl);
     size_t   current_size  = (size_t)1u << current_order;
@@ -3914,10 +4789,9 @@ void_ptr_expect_t alloc_buddy_aligned(buddy_t *b,
 
         buddy_block_t *split_block =
             (buddy_block_t *)((uint8_t *)block + current_size);
-        split_block->next = NULL;
 
         uint32_t split_level = _order_to_level(b, current_order);
-        _freelist_push(&b->free_lists[split_level], split_block);
+        _freelist_push(b, split_level, split_block);
     }
 
     size_t   block_size  = (size_t)1u << order;
@@ -3930,7 +4804,7 @@ void_ptr_expect_t alloc_buddy_aligned(buddy_t *b,
     if ((uintptr_t)sizeof(buddy_header_t) > (UINTPTR_MAX - block_addr)) {
         /* Should never happen in practice; treat as overflow and undo allocation. */
         uint32_t lvl_final = _order_to_level(b, order);
-        _freelist_push(&b->free_lists[lvl_final], block);
+        _freelist_push(b, lvl_final, block);
         return (void_ptr_expect_t){ .has_value = false, .u.error = CAPACITY_OVERFLOW };
     }
     uintptr_t min_user = block_addr + (uintptr_t)sizeof(buddy_header_t);
@@ -3943,7 +4817,7 @@ void_ptr_expect_t alloc_buddy_aligned(buddy_t *b,
     if ((uintptr_t)size > (UINTPTR_MAX - aligned_user) || (aligned_user + (uintptr_t)size) > block_end) {
         /* Defensive: return block to free list */
         uint32_t lvl_final = _order_to_level(b, order);
-        _freelist_push(&b->free_lists[lvl_final], block);
+        _freelist_push(b, lvl_final, block);
         return (void_ptr_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
     }
 
@@ -3997,6 +4871,11 @@ bool return_buddy_element(buddy_t *b, void *ptr) {
 
     buddy_block_t *block = (buddy_block_t *)(base + off);
 
+    /* Already on a free list: a double free, refuse it. */
+    if (_freebit_test(b, _order_to_level(b, order), off)) {
+        return false;
+    }
+
     /* ---- accounting: undo the allocation ---- */
     if (b->len >= block_size) {
         b->len -= block_size;
@@ -4015,15 +4894,13 @@ bool return_buddy_element(buddy_t *b, void *ptr) {
 
         uint32_t lvl = _order_to_level(b, cur_order);
 
-        buddy_block_t *buddy_in_list =
-            _freelist_find(b->free_lists[lvl], (void *)buddy_addr);
-
-        if (!buddy_in_list) {
+        /* O(1): the bitmap says whether the buddy is free at this order. */
+        if (!_freebit_test(b, lvl, buddy_off)) {
             break;
         }
 
         /* Remove buddy from free list. */
-        _freelist_remove(&b->free_lists[lvl], buddy_in_list);
+        _freelist_remove(b, lvl, (buddy_block_t *)buddy_addr);
 
         /* New merged block starts at the lower address. */
         if (buddy_off < cur_off) {
@@ -4035,7 +4912,7 @@ bool return_buddy_element(buddy_t *b, void *ptr) {
     }
 
     uint32_t final_level = _order_to_level(b, cur_order);
-    _freelist_push(&b->free_lists[final_level], block);
+    _freelist_push(b, final_level, block);
 
     return true;
 }
@@ -4283,15 +5160,8 @@ bool reset_buddy(buddy_t *b) {
         return false;
     }
 
-    /* Clear all free lists. */
-    memset(b->free_lists, 0, b->num_levels * sizeof(buddy_block_t*));
-
-    /* Single big free block spanning the whole pool. */
-    buddy_block_t *initial_block = (buddy_block_t *)b->base;
-    initial_block->next = NULL;
-
-    uint32_t top_level = _order_to_level(b, b->max_order);
-    b->free_lists[top_level] = initial_block;
+    /* Clear all free lists and bitmaps; single free block spanning the pool. */
+    _buddy_seed(b);
 
     /* No bytes “in use” from the pool any more. */
     b->len = 0;
@@ -4355,8 +5225,21 @@ inline size_t buddy_largest_block(const buddy_t *b) {
 }
 // -------------------------------------------------------------------------------- 
 
+mem_backing_t buddy_backing(const buddy_t *b) {
+    if (!b) {
+        return (mem_backing_t){ PAGES_DEFAULT, -1, false };
+    }
+    return (mem_backing_t){
+        .pages     = (page_policy_t)b->pages,
+        .numa_node = b->numa_node,
+        .strict    = b->strict != 0u
+    };
+}
+// -------------------------------------------------------------------------------- 
+
 bool buddy_stats(const buddy_t *buddy, char *buffer, size_t buffer_size) {
     size_t offset = 0U;
+    char   node_str[16];
 
     if ((buffer == NULL) || (buffer_size == 0U)) {
         return false;
@@ -4397,6 +5280,14 @@ bool buddy_stats(const buddy_t *buddy, char *buffer, size_t buffer_size) {
         return false;
     }
 
+    if (!_buf_appendf(buffer, buffer_size, &offset,
+                      "  Backing: %s pages, NUMA node %s\n",
+                      page_policy_name((page_policy_t)buddy->pages),
+                      _numa_node_str(buddy->numa_node, node_str,
+                                     sizeof(node_str)))) {
+        return false;
+    }
+
     if (!_buf_appendf(buffer, buffer_size, &offset,
                       "  Used: %zu bytes\n", used)) {
         return false;
@@ -4489,10 +5380,16 @@ typedef struct slab_slot {
 } slab_slot_t;
 // -------------------------------------------------------------------------------- 
 
-/* Per-page header, stored at the beginning of each slab page. */
+/* Per-page header, stored at the beginning of each slab page.  Every page
+ * keeps its own free list so a page whose slots have all come back can be
+ * returned to the buddy allocator. */
 typedef struct slab_page {
-    struct slab_page *next;
-    /* You could add free-count, etc., here later if you want. */
+    struct slab_page *next;        /* all pages */
+    struct slab_page *prev;
+    struct slab_page *avail_next;  /* pages with at least one free slot */
+    struct slab_page *avail_prev;
+    slab_slot_t      *free;        /* free slots of this page */
+    size_t            in_use;      /* slots handed out from this page */
 } slab_page_t;
 // -------------------------------------------------------------------------------- 
 
@@ -4509,8 +5406,19 @@ typedef struct slab_t {
 
     size_t   len;          /* bytes currently in-use by this slab (obj_size * live objects) */
 
-    slab_page_t *pages;    /* linked list of pages (headers sit at page base) */
-    slab_slot_t *free_list;/* global free-list of free slots */
+    slab_page_t  *pages;      /* all pages (headers sit at page base) */
+    slab_page_t  *avail;      /* pages with free slots, most recently used first */
+    size_t        page_count;
+    size_t        empty_pages;/* pages with in_use == 0 */
+
+    /* Radix map from buddy block to page: every page is one buddy block of
+     * order page_order, so (ptr - buddy base) >> page_order indexes the
+     * page that owns ptr. */
+    slab_page_t **page_map;
+    size_t        map_len;
+    size_t        map_bytes;
+    uint32_t      page_order;
+    uint8_t       _pad[4];
 } slab_t;
 // -------------------------------------------------------------------------------- 
 
@@ -4520,71 +5428,144 @@ static inline size_t _slab_align_up(size_t x, size_t a) {
 }
 // -------------------------------------------------------------------------------- 
 
-static bool _slab_grow(slab_t *slab) {
-    if (!slab || !slab->buddy) {
-        return false;
+/* Order of the buddy block alloc_buddy_aligned(b, size, align) will use,
+ * or 0 if the request cannot be satisfied. */
+static uint32_t _slab_block_order(const buddy_t *b, size_t size, size_t align) {
+    if (size > SIZE_MAX - sizeof(buddy_header_t) - (align - 1u)) {
+        return 0u;
     }
-
-    /* Allocate one slab page from the buddy allocator. */
-    void_ptr_expect_t expect = alloc_buddy_aligned(slab->buddy,
-                                                   slab->slab_bytes,
-                                                   slab->align,
-                                                   false); 
-    if (!expect.has_value) {
-        return false;
+    size_t total = _next_pow2(size + sizeof(buddy_header_t) + (align - 1u));
+    if (total == 0u || total > b->pool_size) {
+        return 0u;
     }
-    void *mem = expect.u.value;
-    
-    uint8_t    *raw  = (uint8_t *)mem;
-    slab_page_t *page = (slab_page_t *)raw;
-
-    /* Link page into page list. */
-    page->next = slab->pages;
-    slab->pages = page;
+    uint32_t order = _ilog2_size(total);
+    return (order < b->min_order) ? b->min_order : order;
+}
+// -------------------------------------------------------------------------------- 
 
-    /* Slots start after the (aligned) page header. */
-    uint8_t *slots_base = raw + slab->page_hdr_bytes;
+/* Page owning ptr, or NULL.  O(1) through the page map. */
+static slab_page_t *_slab_find_page(const slab_t *slab, const void *ptr) {
+    if (!slab || !ptr) return NULL;
 
-    /* Carve page into slots and push them on the global free-list. */
-    uint8_t *p = slots_base;
-    for (size_t i = 0; i < slab->objs_per_slab; ++i) {
-        slab_slot_t *slot = (slab_slot_t *)p;
-        slot->next = slab->free_list;
-        slab->free_list = slot;
+    const uint8_t *p    = (const uint8_t *)ptr;
+    const uint8_t *base = (const uint8_t *)slab->buddy->base;
+    if (p < base || p >= base + slab->buddy->pool_size) {
+        return NULL;
+    }
 
-        p += slab->slot_size;
+    slab_page_t *page = slab->page_map[(size_t)(p - base) >> slab->page_order];
+    if (!page) {
+        return NULL;
     }
 
-    return true;
+    const uint8_t *page_base = (const uint8_t *)page;
+    if (p < page_base || p >= page_base + slab->slab_bytes) {
+        return NULL;
+    }
+    return page;
 }
 // -------------------------------------------------------------------------------- 
 
-static slab_page_t *_slab_find_page(slab_t *slab, void *ptr) {
-    if (!slab || !ptr) return NULL;
+static inline size_t _slab_map_index(const slab_t *slab, const slab_page_t *page) {
+    return (size_t)((const uint8_t *)page - (const uint8_t *)slab->buddy->base)
+           >> slab->page_order;
+}
+// -------------------------------------------------------------------------------- 
 
-    uint8_t *p = (uint8_t *)ptr;
+static void _slab_avail_push(slab_t *slab, slab_page_t *page) {
+    page->avail_prev = NULL;
+    page->avail_next = slab->avail;
+    if (slab->avail) slab->avail->avail_prev = page;
+    slab->avail = page;
+}
+// -------------------------------------------------------------------------------- 
 
-    for (slab_page_t *page = slab->pages; page != NULL; page = page->next) {
-        uint8_t *base = (uint8_t *)page;                  /* page starts at header */
-        uint8_t *end  = base + slab->slab_bytes;          /* we only use slab_bytes */
+static void _slab_avail_remove(slab_t *slab, slab_page_t *page) {
+    if (page->avail_prev) page->avail_prev->avail_next = page->avail_next;
+    else                  slab->avail                  = page->avail_next;
+    if (page->avail_next) page->avail_next->avail_prev = page->avail_prev;
+    page->avail_next = NULL;
+    page->avail_prev = NULL;
+}
+// -------------------------------------------------------------------------------- 
 
-        if (p >= base && p < end) {
-            return page;
-        }
+/* Rebuild a page's free list so that every slot is free. */
+static void _slab_carve_page(const slab_t *slab, slab_page_t *page) {
+    uint8_t *slots_base = (uint8_t *)page + slab->page_hdr_bytes;
+
+    page->free   = NULL;
+    page->in_use = 0u;
+
+    /* Push in reverse so slots are handed out in address order. */
+    for (size_t i = slab->objs_per_slab; i-- > 0u; ) {
+        slab_slot_t *slot = (slab_slot_t *)(slots_base + i * slab->slot_size);
+        slot->next = page->free;
+        page->free = slot;
     }
-    return NULL;
 }
 // -------------------------------------------------------------------------------- 
 
-static size_t _slab_snapshot_size(const slab_t *slab) {
-    size_t page_count = 0;
+static bool _slab_grow(slab_t *slab) {
+    if (!slab || !slab->buddy) {
+        return false;
+    }
 
-    for (const slab_page_t *p = slab->pages; p != NULL; p = p->next) {
-        ++page_count;
+    /* Allocate one slab page from the buddy allocator. */
+    void_ptr_expect_t expect = alloc_buddy_aligned(slab->buddy,
+                                                   slab->slab_bytes,
+                                                   slab->align,
+                                                   false); 
+    if (!expect.has_value) {
+        return false;
+    }
+
+    slab_page_t *page = (slab_page_t *)expect.u.value;
+
+    /* Defensive: the map assumes every page is one block of page_order. */
+    const buddy_header_t *hdr =
+        (const buddy_header_t *)((uint8_t *)page - sizeof(buddy_header_t));
+    if (hdr->order != slab->page_order) {
+        (void)return_buddy_element(slab->buddy, page);
+        return false;
     }
 
+    /* Link page into page list. */
+    page->prev = NULL;
+    page->next = slab->pages;
+    if (slab->pages) slab->pages->prev = page;
+    slab->pages = page;
+    slab->page_count++;
+
+    slab->page_map[_slab_map_index(slab, page)] = page;
+
+    /* Carve page into slots on its own free list. */
+    _slab_carve_page(slab, page);
+    _slab_avail_push(slab, page);
+    slab->empty_pages++;
+
+    return true;
+}
+// -------------------------------------------------------------------------------- 
+
+/* Hand an empty page back to the buddy allocator. */
+static void _slab_release_page(slab_t *slab, slab_page_t *page) {
+    _slab_avail_remove(slab, page);
+
+    if (page->prev) page->prev->next = page->next;
+    else            slab->pages      = page->next;
+    if (page->next) page->next->prev = page->prev;
+
+    slab->page_map[_slab_map_index(slab, page)] = NULL;
+    slab->page_count--;
+    slab->empty_pages--;
+
+    (void)return_buddy_element(slab->buddy, page);
+}
+// -------------------------------------------------------------------------------- 
+
+static size_t _slab_snapshot_size(const slab_t *slab) {
     /* slab_t struct + all pages */
-    return sizeof(*slab) + page_count * slab->slab_bytes;
+    return sizeof(*slab) + slab->page_count * slab->slab_bytes;
 }
 // -------------------------------------------------------------------------------- 
 
@@ -4608,34 +5589,14 @@ slab_expect_t init_slab_allocator(buddy_t *buddy,
         }
     }
 
-    /* Allocate the slab_t itself from the buddy allocator. */
-    size_t slab_struct_bytes = _slab_align_up(sizeof(slab_t), alignof(max_align_t));
-
-    void_ptr_expect_t sexpect =
-        alloc_buddy_aligned(buddy,
-                            slab_struct_bytes,
-                            alignof(max_align_t),
-                            /*zeroed=*/true);
-    if (!sexpect.has_value) {
-        return (slab_expect_t){ .has_value = false, .u.error = sexpect.u.error };
-    }
-
-    slab_t *slab = (slab_t *)sexpect.u.value;
-
-    slab->buddy    = buddy;
-    slab->obj_size = obj_size;
-    slab->align    = align;
-
     /* Determine slot size: must hold object and slab_slot_t linkage. */
     size_t slot_size = _slab_align_up(obj_size, align);
     if (slot_size < sizeof(slab_slot_t)) {
         slot_size = _slab_align_up(sizeof(slab_slot_t), align);
     }
-    slab->slot_size = slot_size;
 
     /* Determine page header bytes (aligned). */
     size_t page_hdr_bytes = _slab_align_up(sizeof(slab_page_t), align);
-    slab->page_hdr_bytes  = page_hdr_bytes;
 
     /* Choose slab page size. */
     size_t slab_bytes = slab_bytes_hint;
@@ -4670,12 +5631,52 @@ slab_expect_t init_slab_allocator(buddy_t *buddy,
         slab_bytes       = page_hdr_bytes + usable_for_slots;
     }
 
-    slab->slab_bytes    = slab_bytes;
-    slab->objs_per_slab = objs_per_slab;
+    /* Every page is one buddy block of this order; size the page map. */
+    uint32_t const page_order = _slab_block_order(buddy, slab_bytes, align);
+    if (page_order == 0u) {
+        return (slab_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+    size_t const map_len   = buddy->pool_size >> page_order;
+    size_t const map_bytes = map_len * sizeof(slab_page_t *);
+
+    /* Allocate the slab_t itself from the buddy allocator. */
+    size_t slab_struct_bytes = _slab_align_up(sizeof(slab_t), alignof(max_align_t));
+
+    void_ptr_expect_t sexpect =
+        alloc_buddy_aligned(buddy,
+                            slab_struct_bytes,
+                            alignof(max_align_t),
+                            /*zeroed=*/true);
+    if (!sexpect.has_value) {
+        return (slab_expect_t){ .has_value = false, .u.error = sexpect.u.error };
+    }
+
+    void_ptr_expect_t mexpect = alloc_buddy(buddy, map_bytes, /*zeroed=*/true);
+    if (!mexpect.has_value) {
+        (void)return_buddy_element(buddy, sexpect.u.value);
+        return (slab_expect_t){ .has_value = false, .u.error = mexpect.u.error };
+    }
+
+    slab_t *slab = (slab_t *)sexpect.u.value;
 
-    slab->len       = 0u;
-    slab->pages     = NULL;
-    slab->free_list = NULL;
+    slab->buddy          = buddy;
+    slab->obj_size       = obj_size;
+    slab->align          = align;
+    slab->slot_size      = slot_size;
+    slab->page_hdr_bytes = page_hdr_bytes;
+    slab->slab_bytes     = slab_bytes;
+    slab->objs_per_slab  = objs_per_slab;
+
+    slab->page_order = page_order;
+    slab->page_map   = (slab_page_t **)mexpect.u.value;
+    slab->map_len    = map_len;
+    slab->map_bytes  = map_bytes;
+
+    slab->len         = 0u;
+    slab->pages       = NULL;
+    slab->avail       = NULL;
+    slab->page_count  = 0u;
+    slab->empty_pages = 0u;
 
     return (slab_expect_t){ .has_value = true, .u.value = slab };
 }
@@ -4689,19 +5690,9 @@ void_ptr_expect_t alloc_slab(slab_t *slab, bool zeroed) {
         };
     }
 
-    /* Grow if no free slots. */
-    if (slab->free_list == NULL) {
-        /* Prefer: _slab_grow returns void_ptr_expect_t (or similar) */
-        bool g = _slab_grow(slab);
-        if (!g) {
-            return (void_ptr_expect_t){
-                .has_value = false,
-                .u.error   = BAD_ALLOC
-            };
-        }
-
-        /* Defensive: grow should populate free_list. If it didn't, treat as alloc failure. */
-        if (slab->free_list == NULL) {
+    /* Grow if no page has a free slot. */
+    if (slab->avail == NULL) {
+        if (!_slab_grow(slab) || slab->avail == NULL) {
             return (void_ptr_expect_t){
                 .has_value = false,
                 .u.error   = BAD_ALLOC
@@ -4709,9 +5700,17 @@ void_ptr_expect_t alloc_slab(slab_t *slab, bool zeroed) {
         }
     }
 
-    /* Pop from global free list. */
-    slab_slot_t *slot = slab->free_list;
-    slab->free_list   = slot->next;
+    /* Pop from the most recently used page that has room. */
+    slab_page_t *page = slab->avail;
+    slab_slot_t *slot = page->free;
+    page->free        = slot->next;
+
+    if (page->in_use++ == 0u) {
+        slab->empty_pages--;
+    }
+    if (page->free == NULL) {
+        _slab_avail_remove(slab, page);
+    }
 
     void *user_ptr = (void *)slot;
 
@@ -4763,10 +5762,18 @@ bool return_slab(slab_t *slab, void *ptr) {
         return false;
     }
 
-    /* Return to free list. */
+    /* Defensive: a page with nothing handed out cannot take a slot back. */
+    if (page->in_use == 0u) {
+        return false;
+    }
+
+    /* Return to the page's free list. */
     slab_slot_t *slot = (slab_slot_t *)ptr;
-    slot->next        = slab->free_list;
-    slab->free_list   = slot;
+    if (page->free == NULL) {
+        _slab_avail_push(slab, page);   /* page was full */
+    }
+    slot->next = page->free;
+    page->free = slot;
 
     if (slab->len >= slab->obj_size) {
         slab->len -= slab->obj_size;
@@ -4774,6 +5781,15 @@ bool return_slab(slab_t *slab, void *ptr) {
         slab->len = 0u; /* defensive */
     }
 
+    /* Keep one empty page to absorb alloc/free churn; give any further
+     * empty page back to the buddy allocator. */
+    if (--page->in_use == 0u) {
+        slab->empty_pages++;
+        if (slab->empty_pages > 1u) {
+            _slab_release_page(slab, page);
+        }
+    }
+
     return true;
 }
 // -------------------------------------------------------------------------------- 
@@ -4791,12 +5807,7 @@ inline size_t slab_size(const slab_t *slab) {
         return 0;
     }
 
-    size_t total = 0;
-    for (slab_page_t *p = slab->pages; p != NULL; p = p->next) {
-        total += slab->slab_bytes;
-    }
-
-    return total;
+    return slab->page_count * slab->slab_bytes;
 }
 // -------------------------------------------------------------------------------- 
 
@@ -4805,15 +5816,10 @@ inline size_t total_slab_alloc(const slab_t *slab) {
         return 0;
     }
 
-    /* Start with the slab_t struct itself */
-    size_t total = _slab_align_up(sizeof(slab_t), alignof(max_align_t));
-
-    /* Add each page */
-    for (slab_page_t *p = slab->pages; p != NULL; p = p->next) {
-        total += slab->slab_bytes;
-    }
-
-    return total;
+    /* The slab_t struct, the page map and every page */
+    return _slab_align_up(sizeof(slab_t), alignof(max_align_t)) +
+           slab->map_bytes +
+           slab->page_count * slab->slab_bytes;
 }
 // -------------------------------------------------------------------------------- 
 
@@ -4832,13 +5838,8 @@ inline size_t slab_total_blocks(const slab_t *slab) {
         return 0;
     }
 
-    /* Count pages and multiply by objs_per_slab: total capacity in slots. */
-    size_t page_count = 0;
-    for (const slab_page_t *p = slab->pages; p != NULL; p = p->next) {
-        ++page_count;
-    }
-
-    return page_count * slab->objs_per_slab;
+    /* Pages times objs_per_slab: total capacity in slots. */
+    return slab->page_count * slab->objs_per_slab;
 }
 // -------------------------------------------------------------------------------- 
 
@@ -4847,15 +5848,10 @@ inline size_t slab_free_blocks(const slab_t *slab) {
         return 0;
     }
 
-    size_t count = 0;
-    const slab_slot_t *slot = slab->free_list;
-
-    while (slot) {
-        ++count;
-        slot = slot->next;
-    }
+    size_t const total  = slab->page_count * slab->objs_per_slab;
+    size_t const in_use = (slab->obj_size != 0u) ? slab->len / slab->obj_size : 0u;
 
-    return count;
+    return (total > in_use) ? total - in_use : 0u;
 }
 // -------------------------------------------------------------------------------- 
 
@@ -4886,38 +5882,21 @@ bool is_slab_ptr(const slab_t *slab, const void *ptr) {
         return false;
     }
 
-    uint8_t *p = (uint8_t *)ptr;
-
     /* Step 1: find which page this pointer belongs to */
-    for (slab_page_t *page = slab->pages; page != NULL; page = page->next) {
-
-        uint8_t *page_base   = (uint8_t *)page;            /* header at base */
-        uint8_t *slots_start = page_base + slab->page_hdr_bytes;
-        uint8_t *page_end    = page_base + slab->slab_bytes;
-
-        /* Step 2: check if it lies in the page at all */
-        if (p < page_base || p >= page_end) {
-            continue;
-        }
-
-        /* Step 3: reject pointers inside the header region */
-        if (p < slots_start) {
-            return false;
-        }
-
-        /* Step 4: must be aligned to slot boundaries */
-        size_t offset = (size_t)(p - slots_start);
-
-        if ((offset % slab->slot_size) != 0u) {
-            return false;
-        }
+    const slab_page_t *page = _slab_find_page(slab, ptr);
+    if (!page) {
+        return false;
+    }
 
-        /* Pointer is valid */
-        return true;
+    /* Step 2: reject pointers inside the header region */
+    const uint8_t *p           = (const uint8_t *)ptr;
+    const uint8_t *slots_start = (const uint8_t *)page + slab->page_hdr_bytes;
+    if (p < slots_start) {
+        return false;
     }
 
-    /* Pointer not found in any page */
-    return false;
+    /* Step 3: must be aligned to slot boundaries */
+    return ((size_t)(p - slots_start) % slab->slot_size) == 0u;
 }
 // -------------------------------------------------------------------------------- 
 
@@ -4933,25 +5912,16 @@ bool reset_slab(slab_t *slab) {
         return false;
     }
 
-    /* After reset, nothing is in use and free_list is rebuilt. */
-    slab->len       = 0u;
-    slab->free_list = NULL;
+    /* After reset, nothing is in use and every page is empty.  Pages are
+     * kept so a reset slab does not have to grow again. */
+    slab->len         = 0u;
+    slab->avail       = NULL;
+    slab->empty_pages = slab->page_count;
 
     /* Walk all pages and re-carve them into free slots. */
     for (slab_page_t *page = slab->pages; page != NULL; page = page->next) {
-        uint8_t *page_base   = (uint8_t *)page;              /* header at base */
-        uint8_t *slots_start = page_base + slab->page_hdr_bytes;
-        uint8_t *slots_end   = page_base + slab->slab_bytes;
-
-        /* Carve the slots region into slot_size chunks. */
-        for (uint8_t *p = slots_start;
-             p + slab->slot_size <= slots_end;
-             p += slab->slot_size) {
-
-            slab_slot_t *slot = (slab_slot_t *)p;
-            slot->next        = slab->free_list;
-            slab->free_list   = slot;
-        }
+        _slab_carve_page(slab, page);
+        _slab_avail_push(slab, page);
     }
 
     return true;
@@ -5010,13 +5980,11 @@ bool restore_slab(slab_t *slab,
     memcpy(&snap_header, src, sizeof(snap_header));
     src += sizeof(snap_header);
 
-    /* 2) Count pages from the snapshot's perspective */
-    size_t page_count = 0;
-    const slab_page_t *snap_page = snap_header.pages;
-
-    while (snap_page != NULL) {
-        ++page_count;
-        snap_page = snap_page->next;
+    /* 2) Check size from the snapshot's page count */
+    size_t const page_count = snap_header.page_count;
+    if (snap_header.slab_bytes != 0u &&
+        page_count > (SIZE_MAX - sizeof(snap_header)) / snap_header.slab_bytes) {
+        return false;
     }
 
     size_t needed = sizeof(snap_header) + page_count * snap_header.slab_bytes;
@@ -5030,29 +5998,44 @@ bool restore_slab(slab_t *slab,
         snap_header.align         != slab->align         ||
         snap_header.slab_bytes    != slab->slab_bytes    ||
         snap_header.page_hdr_bytes!= slab->page_hdr_bytes||
-        snap_header.objs_per_slab != slab->objs_per_slab) {
+        snap_header.objs_per_slab != slab->objs_per_slab ||
+        snap_header.page_map      != slab->page_map      ||
+        snap_header.page_order    != slab->page_order) {
+
+        return false;
+    }
 
+    /* 4) Pages are the addresses of the real page headers at the time of
+       save_slab.  Empty pages may have been handed back to the buddy
+       allocator since then, so confirm the live slab owns exactly the
+       snapshot's pages before writing anything.  Each saved page header
+       carries the snapshot's next pointer. */
+    if (page_count != slab->page_count) {
         return false;
     }
 
-    /* 4) Restore pages using snapshot's page list.
-       NOTE: the pointers in snap_header.pages are the addresses
-       of the real page headers in memory at the time of save_slab.
-       We assume the slab has not grown/shrunk pages since then, so
-       those addresses are still valid.
-    */
+    const slab_page_t *snap_page = snap_header.pages;
+    const uint8_t     *page_src  = src;
+
+    for (size_t i = 0; i < page_count; ++i) {
+        if (snap_page == NULL ||
+            _slab_find_page(slab, snap_page) != snap_page) {
+            return false;
+        }
+
+        slab_page_t saved;
+        memcpy(&saved, page_src, sizeof(saved));
+        page_src += snap_header.slab_bytes;
+        snap_page = saved.next;
+    }
+
     snap_page = snap_header.pages;
 
-    for (size_t i = 0; i < page_count && snap_page != NULL; ++i) {
-        memcpy((void *)snap_page, src, snap_header.slab_bytes);
+    for (size_t i = 0; i < page_count; ++i) {
+        slab_page_t *dst = (slab_page_t *)snap_page;
+        memcpy(dst, src, snap_header.slab_bytes);
         src += snap_header.slab_bytes;
-
-        /* Important: use the *snapshot's* next pointer from the buffer,
-           not the live one, which we just overwrote.
-           We already loaded the snapshot header, so snap_page->next
-           is still the next pointer from the snapshot's perspective.
-         */
-        snap_page = snap_page->next;
+        snap_page = dst->next;
     }
 
     /* 5) Finally restore the slab_t itself */
@@ -5079,11 +6062,7 @@ bool slab_stats(const slab_t *slab, char *buffer, size_t buffer_size) {
         return false;
     }
 
-    /* Count pages */
-    size_t page_count = 0U;
-    for (const slab_page_t *p = slab->pages; p != NULL; p = p->next) {
-        ++page_count;
-    }
+    size_t const page_count = slab->page_count;
 
     /* Capacity / usage in bytes */
     size_t const capacity_bytes = page_count * slab->slab_bytes;
@@ -5094,7 +6073,7 @@ bool slab_stats(const slab_t *slab, char *buffer, size_t buffer_size) {
     /* Total footprint including slab_t struct itself */
     size_t const slab_struct_bytes =
         _slab_align_up(sizeof(slab_t), alignof(max_align_t));
-    size_t const total_overhead = slab_struct_bytes + capacity_bytes;
+    size_t const total_overhead = slab_struct_bytes + slab->map_bytes + capacity_bytes;
 
     /* Blocks info */
     size_t const total_blocks   = page_count * slab->objs_per_slab;
@@ -5104,12 +6083,12 @@ bool slab_stats(const slab_t *slab, char *buffer, size_t buffer_size) {
     size_t const free_blocks_geom =
         (total_blocks > in_use_blocks) ? (total_blocks - in_use_blocks) : 0U;
 
-    /* Free blocks counted from the free list (cross-check) */
+    /* Free blocks counted from the per-page free lists (cross-check) */
     size_t free_blocks_list = 0U;
-    for (const slab_slot_t *slot = slab->free_list;
-         slot != NULL;
-         slot = slot->next) {
-        ++free_blocks_list;
+    for (const slab_page_t *p = slab->pages; p != NULL; p = p->next) {
+        for (const slab_slot_t *slot = p->free; slot != NULL; slot = slot->next) {
+            ++free_blocks_list;
+        }
     }
 
     /* Basic geometry info */
@@ -5144,6 +6123,11 @@ bool slab_stats(const slab_t *slab, char *buffer, size_t buffer_size) {
         return false;
     }
 
+    if (!_buf_appendf(buffer, buffer_size, &offset,
+                      "  Empty pages: %zu\n", slab->empty_pages)) {
+        return false;
+    }
+
     if (!_buf_appendf(buffer, buffer_size, &offset,
                       "  Blocks per page: %zu\n", slab->objs_per_slab)) {
         return false;
@@ -5212,10 +6196,11 @@ bool slab_stats(const slab_t *slab, char *buffer, size_t buffer_size) {
             ++page_index;
 
             if (!_buf_appendf(buffer, buffer_size, &offset,
-                              "  Page %zu: %zu bytes, %zu blocks\n",
+                              "  Page %zu: %zu bytes, %zu blocks, %zu in use\n",
                               page_index,
                               slab->slab_bytes,
-                              slab->objs_per_slab)) {
+                              slab->objs_per_slab,
+                              current->in_use)) {
                 return false;
             }
 
@@ -5225,6 +6210,1499 @@ bool slab_stats(const slab_t *slab, char *buffer, size_t buffer_size) {
 
     return true;
 }
+// ================================================================================ 
+// ================================================================================ 
+// THREAD CACHE ALLOCATOR 
+
+#define TCACHE_DEFAULT_BATCH  32u
+#define TCACHE_MAX_BATCH      4096u
+#define TCACHE_BUDDY_CLASSES  8u                    /* smallest buddy orders cached */
+#define TCACHE_SLAB_CLASS     TCACHE_BUDDY_CLASSES  /* magazine index of slab slots */
+#define TCACHE_NUM_CLASSES    (TCACHE_BUDDY_CLASSES + 1u)
+
+/* One per (thread, cache) pair.  Only the owning thread touches counts and
+ * items, except at thread exit and in free_tcache(), which run under the
+ * cache lock when no other user of this record can exist. */
+typedef struct tcache_local {
+    struct tcache_local *next;     /* registry of all thread records */
+    struct tcache_local *prev;
+    tcache_t            *owner;
+    size_t               counts[TCACHE_NUM_CLASSES];
+    void                *items[];  /* TCACHE_NUM_CLASSES * capacity entries */
+} tcache_local_t;
+// -------------------------------------------------------------------------------- 
+
+struct tcache_t {
+    buddy_t         *buddy;      /* may be NULL */
+    slab_t          *slab;       /* may be NULL */
+
+    pthread_mutex_t  lock;       /* guards backends, registry and counters */
+    pthread_key_t    key;        /* per-thread tcache_local_t */
+    tcache_local_t  *threads;
+
+    size_t           batch;      /* blocks per refill / drain */
+    size_t           capacity;   /* magazine size, 2 * batch */
+    size_t           refills;
+    size_t           drains;
+
+    uint32_t         classes;    /* cached buddy orders: min_order .. +classes-1 */
+    uint8_t          _pad[4];
+};
+// -------------------------------------------------------------------------------- 
+
+static inline void **_tcache_mag(const tcache_t *tc, tcache_local_t *local,
+                                 uint32_t cls) {
+    return local->items + (size_t)cls * tc->capacity;
+}
+// -------------------------------------------------------------------------------- 
+
+/* Usable bytes of a buddy block of class `cls` placed by alloc_buddy(). */
+static inline size_t _tcache_class_bytes(const tcache_t *tc, uint32_t cls) {
+    return ((size_t)1u << (tc->buddy->min_order + cls)) - sizeof(buddy_header_t);
+}
+// -------------------------------------------------------------------------------- 
+
+/* Buddy class serving `size` bytes, or tc->classes if it is not cached. */
+static uint32_t _tcache_class_for(const tcache_t *tc, size_t size) {
+    if (tc->classes == 0u || size > _tcache_class_bytes(tc, tc->classes - 1u)) {
+        return tc->classes;
+    }
+    size_t const total = size + sizeof(buddy_header_t);
+    uint32_t const order = _ilog2_size(_next_pow2(total));
+    return (order <= tc->buddy->min_order) ? 0u : order - tc->buddy->min_order;
+}
+// -------------------------------------------------------------------------------- 
+
+/* Blocks fetched per refill.  Large classes take fewer so that one thread
+ * cannot pull more than 1/16 of the pool into its magazine at once. */
+static size_t _tcache_refill_count(const tcache_t *tc, uint32_t cls) {
+    if (cls == TCACHE_SLAB_CLASS) {
+        return tc->batch;
+    }
+    size_t const block = (size_t)1u << (tc->buddy->min_order + cls);
+    size_t const share = (tc->buddy->pool_size >> 4) / block;
+    if (share == 0u) return 1u;
+    return (share < tc->batch) ? share : tc->batch;
+}
+// -------------------------------------------------------------------------------- 
+
+/* Pointer lies in the buddy pool; with a slab attached anything else is
+ * taken to be a slab slot (init_tcache() keeps the two pools disjoint). */
+static inline bool _tcache_in_buddy(const tcache_t *tc, const void *ptr) {
+    if (!tc->buddy) return false;
+    const uint8_t *p    = (const uint8_t *)ptr;
+    const uint8_t *base = (const uint8_t *)tc->buddy->base;
+    return p >= base && p < base + tc->buddy->pool_size;
+}
+// -------------------------------------------------------------------------------- 
+
+/* Caller holds tc->lock.  Return the `n` coldest (bottom) blocks of one
+ * magazine to the backend. */
+static void _tcache_drain_locked(tcache_t *tc, tcache_local_t *local,
+                                 uint32_t cls, size_t n) {
+    void **mag   = _tcache_mag(tc, local, cls);
+    size_t count = local->counts[cls];
+    if (n > count) n = count;
+    if (n == 0u) return;
+
+    for (size_t i = 0u; i < n; ++i) {
+        if (cls == TCACHE_SLAB_CLASS) {
+            (void)return_slab(tc->slab, mag[i]);
+        } else {
+            (void)return_buddy_element(tc->buddy, mag[i]);
+        }
+    }
+
+    memmove(mag, mag + n, (count - n) * sizeof(void *));
+    local->counts[cls] = count - n;
+    tc->drains++;
+}
+// -------------------------------------------------------------------------------- 
+
+static void _tcache_drain_all_locked(tcache_t *tc, tcache_local_t *local) {
+    for (uint32_t cls = 0u; cls < TCACHE_NUM_CLASSES; ++cls) {
+        _tcache_drain_locked(tc, local, cls, local->counts[cls]);
+    }
+}
+// -------------------------------------------------------------------------------- 
+
+/* pthread key destructor: a thread is exiting with cached blocks. */
+static void _tcache_thread_exit(void *arg) {
+    tcache_local_t *local = (tcache_local_t *)arg;
+    tcache_t       *tc    = local->owner;
+
+    pthread_mutex_lock(&tc->lock);
+    _tcache_drain_all_locked(tc, local);
+    if (local->prev) local->prev->next = local->next;
+    else             tc->threads       = local->next;
+    if (local->next) local->next->prev = local->prev;
+    pthread_mutex_unlock(&tc->lock);
+
+    free(local);
+}
+// -------------------------------------------------------------------------------- 
+
+/* Calling thread's record, created and registered on first use. */
+static tcache_local_t *_tcache_local(tcache_t *tc) {
+    tcache_local_t *local = (tcache_local_t *)pthread_getspecific(tc->key);
+    if (local) {
+        return local;
+    }
+
+    size_t const slots = (size_t)TCACHE_NUM_CLASSES * tc->capacity;
+    local = calloc(1, sizeof(*local) + slots * sizeof(void *));
+    if (!local) {
+        return NULL;
+    }
+    local->owner = tc;
+
+    if (pthread_setspecific(tc->key, local) != 0) {
+        free(local);
+        return NULL;
+    }
+
+    pthread_mutex_lock(&tc->lock);
+    local->next = tc->threads;
+    if (tc->threads) tc->threads->prev = local;
+    tc->threads = local;
+    pthread_mutex_unlock(&tc->lock);
+
+    return local;
+}
+// -------------------------------------------------------------------------------- 
+
+/* Refill an empty magazine from the backend.  If the backend is exhausted,
+ * this thread's other magazines are drained so their blocks can coalesce,
+ * and the refill is tried once more. */
+static error_code_t _tcache_refill(tcache_t *tc, tcache_local_t *local,
+                                   uint32_t cls) {
+    void       **mag  = _tcache_mag(tc, local, cls);
+    size_t const want = _tcache_refill_count(tc, cls);
+    error_code_t err  = NO_ERROR;
+
+    pthread_mutex_lock(&tc->lock);
+    for (int attempt = 0; attempt < 2 && local->counts[cls] == 0u; ++attempt) {
+        if (attempt == 1) {
+            _tcache_drain_all_locked(tc, local);
+        }
+        while (local->counts[cls] < want) {
+            void_ptr_expect_t e = (cls == TCACHE_SLAB_CLASS)
+                                ? alloc_slab(tc->slab, false)
+                                : alloc_buddy(tc->buddy,
+                                              _tcache_class_bytes(tc, cls),
+                                              false);
+            if (!e.has_value) {
+                err = e.u.error;
+                break;
+            }
+            mag[local->counts[cls]++] = e.u.value;
+        }
+    }
+    tc->refills++;
+    pthread_mutex_unlock(&tc->lock);
+
+    return (local->counts[cls] > 0u) ? NO_ERROR : err;
+}
+// -------------------------------------------------------------------------------- 
+
+static void_ptr_expect_t _tcache_pop(tcache_t *tc, uint32_t cls, bool zeroed) {
+    tcache_local_t *local = _tcache_local(tc);
+    if (!local) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+
+    if (local->counts[cls] == 0u) {
+        error_code_t err = _tcache_refill(tc, local, cls);
+        if (err != NO_ERROR) {
+            return (void_ptr_expect_t){ .has_value = false, .u.error = err };
+        }
+    }
+
+    void *ptr = _tcache_mag(tc, local, cls)[--local->counts[cls]];
+
+    if (zeroed) {
+        size_t const bytes = (cls == TCACHE_SLAB_CLASS)
+                           ? tc->slab->obj_size
+                           : _tcache_class_bytes(tc, cls);
+        memset(ptr, 0, bytes);
+    }
+    return (void_ptr_expect_t){ .has_value = true, .u.value = ptr };
+}
+// -------------------------------------------------------------------------------- 
+
+static bool _tcache_push(tcache_t *tc, uint32_t cls, void *ptr) {
+    tcache_local_t *local = _tcache_local(tc);
+    if (!local) {
+        /* No thread record: hand the block straight back. */
+        pthread_mutex_lock(&tc->lock);
+        bool ok = (cls == TCACHE_SLAB_CLASS) ? return_slab(tc->slab, ptr)
+                                             : return_buddy_element(tc->buddy, ptr);
+        pthread_mutex_unlock(&tc->lock);
+        return ok;
+    }
+
+    if (local->counts[cls] == tc->capacity) {
+        pthread_mutex_lock(&tc->lock);
+        _tcache_drain_locked(tc, local, cls, tc->batch);
+        pthread_mutex_unlock(&tc->lock);
+    }
+
+    _tcache_mag(tc, local, cls)[local->counts[cls]++] = ptr;
+    return true;
+}
+// -------------------------------------------------------------------------------- 
+
+/* Bytes usable from `ptr` to the end of its block, or 0 if unknown. */
+static size_t _tcache_usable(const tcache_t *tc, const void *ptr) {
+    if (_tcache_in_buddy(tc, ptr)) {
+        if (!is_buddy_ptr(tc->buddy, ptr)) return 0u;
+        const buddy_header_t *hdr =
+            (const buddy_header_t *)((const uint8_t *)ptr - sizeof(buddy_header_t));
+        const uint8_t *end = (const uint8_t *)tc->buddy->base
+                           + hdr->block_offset + ((size_t)1u << hdr->order);
+        return (size_t)(end - (const uint8_t *)ptr);
+    }
+    return tc->slab ? tc->slab->obj_size : 0u;
+}
+// -------------------------------------------------------------------------------- 
+
+static void_ptr_expect_t _tcache_locked_buddy(tcache_t *tc, size_t size,
+                                              size_t align, bool zeroed) {
+    pthread_mutex_lock(&tc->lock);
+    void_ptr_expect_t r = (align == 0u)
+                        ? alloc_buddy(tc->buddy, size, zeroed)
+                        : alloc_buddy_aligned(tc->buddy, size, align, zeroed);
+    pthread_mutex_unlock(&tc->lock);
+    return r;
+}
+// -------------------------------------------------------------------------------- 
+
+tcache_expect_t init_tcache(buddy_t *buddy, slab_t *slab, size_t batch) {
+    if (!buddy && !slab) {
+        return (tcache_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+    /* Shared pool would make slab slots indistinguishable from buddy blocks. */
+    if (buddy && slab && slab->buddy == buddy) {
+        return (tcache_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+
+    if (batch == 0u) {
+        batch = TCACHE_DEFAULT_BATCH;
+    }
+    if (batch > TCACHE_MAX_BATCH) {
+        batch = TCACHE_MAX_BATCH;
+    }
+
+    tcache_t *tc = calloc(1, sizeof(*tc));
+    if (!tc) {
+        return (tcache_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+
+    if (pthread_mutex_init(&tc->lock, NULL) != 0) {
+        free(tc);
+        return (tcache_expect_t){ .has_value = false, .u.error = LOCK_FAILED };
+    }
+    if (pthread_key_create(&tc->key, _tcache_thread_exit) != 0) {
+        pthread_mutex_destroy(&tc->lock);
+        free(tc);
+        return (tcache_expect_t){ .has_value = false, .u.error = LOCK_FAILED };
+    }
+
+    tc->buddy    = buddy;
+    tc->slab     = slab;
+    tc->batch    = batch;
+    tc->capacity = 2u * batch;
+
+    /* Never cache the top order: that block is the whole pool. */
+    if (buddy && buddy->num_levels > 1u) {
+        uint32_t const levels = buddy->num_levels - 1u;
+        tc->classes = (levels < TCACHE_BUDDY_CLASSES) ? levels : TCACHE_BUDDY_CLASSES;
+    }
+
+    return (tcache_expect_t){ .has_value = true, .u.value = tc };
+}
+// -------------------------------------------------------------------------------- 
+
+void free_tcache(tcache_t *tc) {
+    if (!tc) return;
+
+    /* Keep the destructor from running on a record freed below. */
+    (void)pthread_setspecific(tc->key, NULL);
+
+    pthread_mutex_lock(&tc->lock);
+    tcache_local_t *local = tc->threads;
+    while (local) {
+        tcache_local_t *next = local->next;
+        _tcache_drain_all_locked(tc, local);
+        free(local);
+        local = next;
+    }
+    tc->threads = NULL;
+    pthread_mutex_unlock(&tc->lock);
+
+    pthread_key_delete(tc->key);
+    pthread_mutex_destroy(&tc->lock);
+    free(tc);
+}
+// -------------------------------------------------------------------------------- 
+
+void_ptr_expect_t alloc_tcache(tcache_t *tc, size_t size, bool zeroed) {
+    if (!tc || size == 0u) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+
+    if (tc->slab && size <= tc->slab->obj_size) {
+        return _tcache_pop(tc, TCACHE_SLAB_CLASS, zeroed);
+    }
+    if (!tc->buddy) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+
+    uint32_t const cls = _tcache_class_for(tc, size);
+    if (cls < tc->classes) {
+        return _tcache_pop(tc, cls, zeroed);
+    }
+    return _tcache_locked_buddy(tc, size, 0u, zeroed);
+}
+// -------------------------------------------------------------------------------- 
+
+void_ptr_expect_t alloc_tcache_aligned(tcache_t *tc, size_t size,
+                                       size_t align, bool zeroed) {
+    if (!tc || size == 0u) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+
+    if (align == 0u) {
+        align = alignof(max_align_t);
+    }
+    if (!_is_pow2(align)) {
+        align = _next_pow2(align);
+        if (align == 0u) {
+            return (void_ptr_expect_t){ .has_value = false, .u.error = ALIGNMENT_ERROR };
+        }
+    }
+
+    if (tc->slab && size <= tc->slab->obj_size && align <= tc->slab->align) {
+        return _tcache_pop(tc, TCACHE_SLAB_CLASS, zeroed);
+    }
+    if (!tc->buddy) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = ALIGNMENT_ERROR };
+    }
+
+    /* alloc_buddy() places the user pointer sizeof(buddy_header_t) past a
+     * block boundary, so that is the alignment the cached path provides. */
+    size_t const natural = sizeof(buddy_header_t) & (~sizeof(buddy_header_t) + 1u);
+    if (align <= natural) {
+        uint32_t const cls = _tcache_class_for(tc, size);
+        if (cls < tc->classes) {
+            return _tcache_pop(tc, cls, zeroed);
+        }
+        return _tcache_locked_buddy(tc, size, 0u, zeroed);
+    }
+    return _tcache_locked_buddy(tc, size, align, zeroed);
+}
+// -------------------------------------------------------------------------------- 
+
+bool return_tcache_element(tcache_t *tc, void *ptr) {
+    if (!tc) {
+        return false;
+    }
+    if (!ptr) {
+        return true;
+    }
+
+    if (_tcache_in_buddy(tc, ptr)) {
+        /* Header fields and the pool bounds are stable while the block is
+         * owned by the caller, so this check needs no lock. */
+        if (!is_buddy_ptr(tc->buddy, ptr)) {
+            return false;
+        }
+        const buddy_header_t *hdr =
+            (const buddy_header_t *)((uint8_t *)ptr - sizeof(buddy_header_t));
+        uint32_t const cls = hdr->order - tc->buddy->min_order;
+        bool const standard =
+            (uint8_t *)ptr == (uint8_t *)tc->buddy->base + hdr->block_offset
+                              + sizeof(buddy_header_t);
+
+        if (standard && cls < tc->classes) {
+            return _tcache_push(tc, cls, ptr);
+        }
+
+        pthread_mutex_lock(&tc->lock);
+        bool ok = return_buddy_element(tc->buddy, ptr);
+        pthread_mutex_unlock(&tc->lock);
+        return ok;
+    }
+
+    /* The page map entry of a slot the caller owns cannot change, so this
+     * check needs no lock either. */
+    if (!tc->slab || !is_slab_ptr(tc->slab, ptr)) {
+        return false;
+    }
+    return _tcache_push(tc, TCACHE_SLAB_CLASS, ptr);
+}
+// -------------------------------------------------------------------------------- 
+
+static void_ptr_expect_t _tcache_realloc(tcache_t *tc, void *old_ptr,
+                                         size_t old_size, size_t new_size,
+                                         size_t align, bool zeroed) {
+    if (!tc) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+
+    if (!old_ptr) {
+        if (new_size == 0u) {
+            return (void_ptr_expect_t){ .has_value = true, .u.value = NULL };
+        }
+        return (align == 0u) ? alloc_tcache(tc, new_size, zeroed)
+                             : alloc_tcache_aligned(tc, new_size, align, zeroed);
+    }
+
+    if (new_size == 0u) {
+        (void)return_tcache_element(tc, old_ptr);
+        return (void_ptr_expect_t){ .has_value = true, .u.value = NULL };
+    }
+
+    if (old_size == 0u) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+
+    size_t const usable_old = _tcache_usable(tc, old_ptr);
+    if (usable_old == 0u) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+
+    bool const aligned = (align == 0u) || (((uintptr_t)old_ptr & (align - 1u)) == 0u);
+    if (new_size <= usable_old && aligned) {
+        if (zeroed && new_size > old_size) {
+            size_t const logical_old = (old_size < usable_old) ? old_size : usable_old;
+            memset((uint8_t *)old_ptr + logical_old, 0, new_size - logical_old);
+        }
+        return (void_ptr_expect_t){ .has_value = true, .u.value = old_ptr };
+    }
+
+    void_ptr_expect_t nex = (align == 0u)
+                          ? alloc_tcache(tc, new_size, zeroed)
+                          : alloc_tcache_aligned(tc, new_size, align, zeroed);
+    if (!nex.has_value) {
+        return nex;
+    }
+
+    size_t copy_bytes = (old_size < usable_old) ? old_size : usable_old;
+    if (copy_bytes > new_size) copy_bytes = new_size;
+    memcpy(nex.u.value, old_ptr, copy_bytes);
+
+    (void)return_tcache_element(tc, old_ptr);
+    return nex;
+}
+// -------------------------------------------------------------------------------- 
+
+void_ptr_expect_t realloc_tcache(tcache_t *tc, void *old_ptr, size_t old_size,
+                                 size_t new_size, bool zeroed) {
+    return _tcache_realloc(tc, old_ptr, old_size, new_size, 0u, zeroed);
+}
+// -------------------------------------------------------------------------------- 
+
+void_ptr_expect_t realloc_tcache_aligned(tcache_t *tc, void *old_ptr,
+                                         size_t old_size, size_t new_size,
+                                         size_t align, bool zeroed) {
+    if (align == 0u) {
+        align = alignof(max_align_t);
+    }
+    if (!_is_pow2(align)) {
+        align = _next_pow2(align);
+        if (align == 0u) {
+            return (void_ptr_expect_t){ .has_value = false, .u.error = ALIGNMENT_ERROR };
+        }
+    }
+    return _tcache_realloc(tc, old_ptr, old_size, new_size, align, zeroed);
+}
+// -------------------------------------------------------------------------------- 
+
+bool flush_tcache(tcache_t *tc) {
+    if (!tc) {
+        return false;
+    }
+
+    tcache_local_t *local = (tcache_local_t *)pthread_getspecific(tc->key);
+    if (!local) {
+        return true;   /* nothing cached by this thread */
+    }
+
+    pthread_mutex_lock(&tc->lock);
+    _tcache_drain_all_locked(tc, local);
+    pthread_mutex_unlock(&tc->lock);
+    return true;
+}
+// -------------------------------------------------------------------------------- 
+
+size_t tcache_batch(const tcache_t *tc) {
+    if (!tc) {
+        return 0;
+    }
+    return tc->batch;
+}
+// -------------------------------------------------------------------------------- 
+
+bool tcache_stats(const tcache_t *tc, char *buffer, size_t buffer_size) {
+    size_t offset = 0U;
+
+    if ((buffer == NULL) || (buffer_size == 0U)) {
+        return false;
+    }
+
+    if (tc == NULL) {
+        (void)_buf_appendf(buffer, buffer_size, &offset, "%s", "Thread Cache: NULL\n");
+        return true;
+    }
+
+    /* Counters and the registry are only consistent under the lock. */
+    tcache_t *mtc = (tcache_t *)tc;
+    pthread_mutex_lock(&mtc->lock);
+    size_t const refills = tc->refills;
+    size_t const drains  = tc->drains;
+    size_t threads = 0U;
+    for (const tcache_local_t *l = tc->threads; l != NULL; l = l->next) {
+        ++threads;
+    }
+    pthread_mutex_unlock(&mtc->lock);
+
+    if (!_buf_appendf(buffer, buffer_size, &offset,
+                      "%s", "Thread Cache Statistics:\n")) {
+        return false;
+    }
+
+    if (!_buf_appendf(buffer, buffer_size, &offset,
+                      "  Batch size: %zu blocks\n", tc->batch)) {
+        return false;
+    }
+
+    if (tc->buddy && tc->classes > 0U) {
+        size_t const lo = (size_t)1u << tc->buddy->min_order;
+        size_t const hi = (size_t)1u << (tc->buddy->min_order + tc->classes - 1u);
+        if (!_buf_appendf(buffer, buffer_size, &offset,
+                          "  Cached buddy blocks: %zu to %zu bytes\n", lo, hi)) {
+            return false;
+        }
+    } else {
+        if (!_buf_appendf(buffer, buffer_size, &offset,
+                          "%s", "  Cached buddy blocks: none\n")) {
+            return false;
+        }
+    }
+
+    if (tc->slab) {
+        if (!_buf_appendf(buffer, buffer_size, &offset,
+                          "  Slab object size: %zu bytes\n", tc->slab->obj_size)) {
+            return false;
+        }
+    } else {
+        if (!_buf_appendf(buffer, buffer_size, &offset,
+                          "%s", "  Slab object size: none\n")) {
+            return false;
+        }
+    }
+
+    if (!_buf_appendf(buffer, buffer_size, &offset,
+                      "  Threads: %zu\n", threads)) {
+        return false;
+    }
+
+    if (!_buf_appendf(buffer, buffer_size, &offset,
+                      "  Backend refills: %zu\n", refills)) {
+        return false;
+    }
+
+    if (!_buf_appendf(buffer, buffer_size, &offset,
+                      "  Backend drains: %zu\n", drains)) {
+        return false;
+    }
+
+    return true;
+}
+// ================================================================================ 
+// ================================================================================ 
+// TRACING ALLOCATOR 
+
+#define TRACER_DEFAULT_SAMPLES  1024u
+#define TRACER_SHARDS           16u  /* counter shards; threads map by slot id  */
+#define TRACER_TABLE_SHARDS     16u  /* independently locked size tables        */
+#define TRACER_TABLE_MIN        64u  /* initial slots in each size table        */
+
+/* Sits immediately below every user pointer handed out by a tracer. */
+typedef struct {
+    size_t size;   /* bytes requested by the caller                  */
+    size_t pad;    /* distance from the inner block to the user data */
+} tracer_header_t;
+
+/* Counters updated by the threads that map to one shard.  Each shard starts
+ * on its own cache line, so threads on different shards never contend.
+ * live_bytes wraps when a block is freed by a thread on another shard; only
+ * the sum over all shards is meaningful. */
+typedef struct {
+    alignas(64) _Atomic size_t events;
+    _Atomic size_t allocs;
+    _Atomic size_t reallocs;
+    _Atomic size_t frees;
+    _Atomic size_t failures;
+    _Atomic size_t bytes_allocated;
+    _Atomic size_t bytes_freed;
+    _Atomic size_t live_bytes;
+    _Atomic size_t peak_live_bytes;  /* high-water of this shard's live_bytes */
+    _Atomic size_t size_classes[TRACER_SIZE_CLASSES];
+} tracer_shard_t;
+
+typedef struct {
+    void  *ptr;    /* NULL marks an empty slot */
+    size_t size;
+} tracer_slot_t;
+
+/* One lock stripe of the pointer -> size table that replaces the header
+ * for fixed-block inner allocators.  Linear probing, at most half full. */
+typedef struct {
+    alignas(64) pthread_mutex_t lock;
+    size_t         count;
+    size_t         mask;    /* slot count - 1 */
+    tracer_slot_t *slots;
+} tracer_table_t;
+
+struct tracer_t {
+    allocator_vtable_t inner;
+    tracer_shard_t    *shards;        /* TRACER_SHARDS counter shards         */
+    tracer_table_t    *tables;        /* NULL when sizes live in headers      */
+
+    size_t           sample_every;    /* 0 disables sampling */
+    size_t           capacity;        /* ring slots in samples[] */
+    pthread_mutex_t  lock;            /* guards samples[], taken and peak */
+    size_t           taken;           /* samples written, including overwritten */
+    size_t           peak_live_bytes; /* highest live total seen under the lock */
+    trace_sample_t   samples[];
+};
+// -------------------------------------------------------------------------------- 
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define TRACER_CALL_SITE() ((uint64_t)(uintptr_t)__builtin_return_address(0))
+#else
+#  define TRACER_CALL_SITE() ((uint64_t)0u)
+#endif
+// -------------------------------------------------------------------------------- 
+
+static _Atomic size_t        _tracer_next_slot;
+static _Thread_local size_t  _tracer_slot;   /* 0 until the thread first traces */
+
+/* The calling thread's counter shard.  Slots are handed out once per thread,
+ * so the only shared write is the first call a thread ever makes. */
+static inline tracer_shard_t *_tracer_shard(tracer_t *tr) {
+    size_t slot = _tracer_slot;
+    if (slot == 0u) {
+        slot = atomic_fetch_add_explicit(&_tracer_next_slot, 1u,
+                                         memory_order_relaxed) + 1u;
+        _tracer_slot = slot;
+    }
+    return &tr->shards[slot % TRACER_SHARDS];
+}
+// -------------------------------------------------------------------------------- 
+
+static inline tracer_header_t *_tracer_header(void *user) {
+    return (tracer_header_t *)((uint8_t *)user - sizeof(tracer_header_t));
+}
+// -------------------------------------------------------------------------------- 
+
+/* Header room for a block aligned to `align`: the smallest multiple of the
+ * alignment that holds the header, so the user pointer keeps it. */
+static inline size_t _tracer_pad(size_t align) {
+    return _align_up_size(sizeof(tracer_header_t), align);
+}
+// -------------------------------------------------------------------------------- 
+
+static inline uint32_t _tracer_size_class(size_t size) {
+    if (size <= 1u) {
+        return 0u;
+    }
+    uint32_t const cls = 64u - (uint32_t)__builtin_clzll((unsigned long long)(size - 1u));
+    return cls < TRACER_SIZE_CLASSES ? cls : TRACER_SIZE_CLASSES - 1u;
+}
+// -------------------------------------------------------------------------------- 
+
+/* Live totals are sums of wrapping shard counters, so compare them signed. */
+static inline bool _tracer_live_above(size_t live, size_t peak) {
+    return (ptrdiff_t)live > (ptrdiff_t)peak;
+}
+// -------------------------------------------------------------------------------- 
+
+static void _tracer_move_live(tracer_shard_t *sh, size_t freed, size_t added) {
+    size_t const delta = added - freed;    /* wraps for a net release */
+    size_t const live  = atomic_fetch_add_explicit(&sh->live_bytes, delta,
+                                                   memory_order_relaxed) + delta;
+    if (_tracer_live_above(live, atomic_load_explicit(&sh->peak_live_bytes,
+                                                      memory_order_relaxed))) {
+        atomic_store_explicit(&sh->peak_live_bytes, live, memory_order_relaxed);
+    }
+}
+// -------------------------------------------------------------------------------- 
+
+/* Counts the event on the caller's shard and, one time in sample_every,
+ * records it.  Only the sampled path reads the clock, takes the lock or
+ * looks at the other shards. */
+static void _tracer_event(tracer_t *tr, tracer_shard_t *sh, trace_op_t op,
+                          size_t size, const void *ptr, uint64_t site, bool ok) {
+    size_t const n = atomic_fetch_add_explicit(&sh->events, 1u,
+                                               memory_order_relaxed);
+    if (!ok) {
+        atomic_fetch_add_explicit(&sh->failures, 1u, memory_order_relaxed);
+    }
+    if (tr->sample_every == 0u || (n % tr->sample_every) != 0u) {
+        return;
+    }
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    pthread_mutex_lock(&tr->lock);
+    size_t seq  = 0u;
+    size_t live = 0u;
+    for (size_t i = 0u; i < TRACER_SHARDS; ++i) {
+        seq  += atomic_load_explicit(&tr->shards[i].events, memory_order_relaxed);
+        live += atomic_load_explicit(&tr->shards[i].live_bytes, memory_order_relaxed);
+    }
+    if (_tracer_live_above(live, tr->peak_live_bytes)) {
+        tr->peak_live_bytes = live;
+    }
+    tr->samples[tr->taken % tr->capacity] = (trace_sample_t){
+        .seq     = (uint64_t)(seq - 1u),
+        .time_ns = (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec,
+        .size    = (uint64_t)size,
+        .ptr     = (uint64_t)(uintptr_t)ptr,
+        .site    = site,
+        .op      = (uint32_t)op,
+        .ok      = ok ? 1u : 0u
+    };
+    tr->taken++;
+    pthread_mutex_unlock(&tr->lock);
+}
+// -------------------------------------------------------------------------------- 
+
+static inline uint64_t _tracer_ptr_hash(const void *ptr) {
+    return (uint64_t)(uintptr_t)ptr * 0x9E3779B97F4A7C15ull;
+}
+// -------------------------------------------------------------------------------- 
+
+static inline tracer_table_t *_tracer_table(tracer_t *tr, uint64_t h) {
+    return &tr->tables[(h >> 58) % TRACER_TABLE_SHARDS];
+}
+// -------------------------------------------------------------------------------- 
+
+/* Slot holding `ptr`, or the empty slot where it belongs. */
+static inline size_t _tracer_table_probe(const tracer_slot_t *slots, size_t mask,
+                                         const void *ptr, uint64_t h) {
+    size_t i = (size_t)(h >> 20) & mask;
+    while (slots[i].ptr && slots[i].ptr != ptr) {
+        i = (i + 1u) & mask;
+    }
+    return i;
+}
+// -------------------------------------------------------------------------------- 
+
+static bool _tracer_table_grow(tracer_table_t *t) {
+    size_t const cap = (t->mask + 1u) * 2u;
+    tracer_slot_t *slots = calloc(cap, sizeof(*slots));
+    if (!slots) {
+        return false;
+    }
+    for (size_t i = 0u; i <= t->mask; ++i) {
+        void *const p = t->slots[i].ptr;
+        if (p) {
+            slots[_tracer_table_probe(slots, cap - 1u, p, _tracer_ptr_hash(p))] = t->slots[i];
+        }
+    }
+    free(t->slots);
+    t->slots = slots;
+    t->mask  = cap - 1u;
+    return true;
+}
+// -------------------------------------------------------------------------------- 
+
+/* Records or updates the size of `ptr`.  Fails only when the table cannot
+ * grow and has no free slot left. */
+static bool _tracer_table_put(tracer_t *tr, void *ptr, size_t size) {
+    uint64_t const h = _tracer_ptr_hash(ptr);
+    tracer_table_t *t = _tracer_table(tr, h);
+    bool ok = true;
+
+    pthread_mutex_lock(&t->lock);
+    size_t i = _tracer_table_probe(t->slots, t->mask, ptr, h);
+    if (!t->slots[i].ptr) {
+        /* A failed grow is harmless while a slot is still free */
+        if (2u * (t->count + 1u) > t->mask + 1u && _tracer_table_grow(t)) {
+            i = _tracer_table_probe(t->slots, t->mask, ptr, h);
+        }
+        ok = t->count + 1u <= t->mask;
+        t->count += ok ? 1u : 0u;
+    }
+    if (ok) {
+        t->slots[i] = (tracer_slot_t){ .ptr = ptr, .size = size };
+    }
+    pthread_mutex_unlock(&t->lock);
+    return ok;
+}
+// -------------------------------------------------------------------------------- 
+
+/* Looks `ptr` up and, when `take` is set, removes it by shifting the rest
+ * of its probe run back. */
+static bool _tracer_table_get(tracer_t *tr, void *ptr, size_t *size, bool take) {
+    uint64_t const h = _tracer_ptr_hash(ptr);
+    tracer_table_t *t = _tracer_table(tr, h);
+
+    pthread_mutex_lock(&t->lock);
+    size_t i = _tracer_table_probe(t->slots, t->mask, ptr, h);
+    bool const found = t->slots[i].ptr != NULL;
+    if (found) {
+        *size = t->slots[i].size;
+    }
+    if (found && take) {
+        size_t j = i;
+        for (;;) {
+            j = (j + 1u) & t->mask;
+            void *const p = t->slots[j].ptr;
+            if (!p) {
+                break;
+            }
+            size_t const home = (size_t)(_tracer_ptr_hash(p) >> 20) & t->mask;
+            /* Leave entries whose home lies cyclically in (i, j] */
+            if ((i <= j) ? (i < home && home <= j) : (i < home || home <= j)) {
+                continue;
+            }
+            t->slots[i] = t->slots[j];
+            i = j;
+        }
+        t->slots[i].ptr = NULL;
+        t->count--;
+    }
+    pthread_mutex_unlock(&t->lock);
+    return found;
+}
+// -------------------------------------------------------------------------------- 
+
+static void_ptr_expect_t _tracer_inner_alloc(tracer_t *tr, size_t bytes,
+                                             size_t align, bool zeroed) {
+    void_ptr_expect_t r = (align == alignof(max_align_t))
+          ? tr->inner.allocate(tr->inner.ctx, bytes, zeroed)
+          : tr->inner.allocate_aligned(tr->inner.ctx, bytes, align, zeroed);
+
+    /* An inner allocator that ignores the alignment would leave the header,
+     * and so the user pointer, misaligned */
+    if (r.has_value && !tr->tables && ((uintptr_t)r.u.value & (align - 1u)) != 0u) {
+        tr->inner.return_element(tr->inner.ctx, r.u.value);
+        r = (void_ptr_expect_t){ .has_value = false, .u.error = ALIGNMENT_ERROR };
+    }
+    return r;
+}
+// -------------------------------------------------------------------------------- 
+
+static void_ptr_expect_t _tracer_alloc(tracer_t *tr, size_t size, size_t align,
+                                       bool zeroed, uint64_t site) {
+    tracer_shard_t *sh = _tracer_shard(tr);
+    void_ptr_expect_t r = { .has_value = false, .u.error = INVALID_ARG };
+    size_t const pad = tr->tables ? 0u : _tracer_pad(align);
+
+    if (size != 0u && size <= SIZE_MAX - pad) {
+        r = _tracer_inner_alloc(tr, size + pad, align, zeroed);
+    }
+    if (r.has_value && tr->tables && !_tracer_table_put(tr, r.u.value, size)) {
+        tr->inner.return_element(tr->inner.ctx, r.u.value);
+        r = (void_ptr_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+    if (!r.has_value) {
+        _tracer_event(tr, sh, TRACE_ALLOC, size, NULL, site, false);
+        return r;
+    }
+
+    uint8_t *user = (uint8_t *)r.u.value + pad;
+    if (!tr->tables) {
+        *_tracer_header(user) = (tracer_header_t){ .size = size, .pad = pad };
+    }
+
+    atomic_fetch_add_explicit(&sh->allocs, 1u, memory_order_relaxed);
+    atomic_fetch_add_explicit(&sh->bytes_allocated, size, memory_order_relaxed);
+    atomic_fetch_add_explicit(&sh->size_classes[_tracer_size_class(size)], 1u,
+                              memory_order_relaxed);
+    _tracer_move_live(sh, 0u, size);
+    _tracer_event(tr, sh, TRACE_ALLOC, size, user, site, true);
+
+    r.u.value = user;
+    return r;
+}
+// -------------------------------------------------------------------------------- 
+
+static void _tracer_return(tracer_t *tr, void *ptr, uint64_t site) {
+    tracer_shard_t *sh = _tracer_shard(tr);
+    size_t size = 0u;
+    void  *raw  = ptr;
+
+    if (!tr->tables) {
+        tracer_header_t const h = *_tracer_header(ptr);
+        size = h.size;
+        raw  = (uint8_t *)ptr - h.pad;
+    } else if (!_tracer_table_get(tr, ptr, &size, true)) {
+        /* Not handed out by this tracer: pass it on, but report it */
+        tr->inner.return_element(tr->inner.ctx, ptr);
+        _tracer_event(tr, sh, TRACE_FREE, 0u, ptr, site, false);
+        return;
+    }
+
+    tr->inner.return_element(tr->inner.ctx, raw);
+
+    atomic_fetch_add_explicit(&sh->frees, 1u, memory_order_relaxed);
+    atomic_fetch_add_explicit(&sh->bytes_freed, size, memory_order_relaxed);
+    _tracer_move_live(sh, size, 0u);
+    _tracer_event(tr, sh, TRACE_FREE, size, ptr, site, true);
+}
+// -------------------------------------------------------------------------------- 
+
+/* Size-table flavour of realloc: the inner allocator resizes the block as
+ * is and the table entry follows it. */
+static void_ptr_expect_t _tracer_realloc_table(tracer_t *tr, tracer_shard_t *sh,
+                                               void *old_ptr, size_t *old_size,
+                                               size_t new_size, size_t align,
+                                               bool zeroed, uint64_t site,
+                                               bool *tracked) {
+    if (!_tracer_table_get(tr, old_ptr, old_size, false)) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+
+    void_ptr_expect_t r = (align == alignof(max_align_t))
+          ? tr->inner.reallocate(tr->inner.ctx, old_ptr, *old_size, new_size, zeroed)
+          : tr->inner.reallocate_aligned(tr->inner.ctx, old_ptr, *old_size,
+                                         new_size, zeroed, align);
+    if (!r.has_value) {
+        return r;
+    }
+
+    size_t ignored = 0u;
+    if (r.u.value != old_ptr) {
+        (void)_tracer_table_get(tr, old_ptr, &ignored, true);
+    }
+    if (!_tracer_table_put(tr, r.u.value, new_size)) {
+        /* The block moved and cannot be tracked: the caller keeps it, but
+         * from here on it is accounted as freed */
+        atomic_fetch_add_explicit(&sh->frees, 1u, memory_order_relaxed);
+        atomic_fetch_add_explicit(&sh->bytes_freed, *old_size, memory_order_relaxed);
+        _tracer_move_live(sh, *old_size, 0u);
+        _tracer_event(tr, sh, TRACE_REALLOC, new_size, r.u.value, site, false);
+        *tracked = false;
+    }
+    return r;
+}
+// -------------------------------------------------------------------------------- 
+
+static void_ptr_expect_t _tracer_realloc(tracer_t *tr, void *old_ptr,
+                                         size_t new_size, size_t align,
+                                         bool zeroed, uint64_t site) {
+    if (!old_ptr) {
+        return _tracer_alloc(tr, new_size, align, zeroed, site);
+    }
+    if (new_size == 0u) {
+        _tracer_return(tr, old_ptr, site);
+        return (void_ptr_expect_t){ .has_value = true, .u.value = NULL };
+    }
+
+    tracer_shard_t *sh = _tracer_shard(tr);
+    void_ptr_expect_t r = { .has_value = false, .u.error = INVALID_ARG };
+    size_t old_size = 0u;
+    size_t pad      = 0u;
+    bool   tracked  = true;
+
+    if (tr->tables) {
+        r = _tracer_realloc_table(tr, sh, old_ptr, &old_size, new_size, align,
+                                  zeroed, site, &tracked);
+        if (!tracked) {
+            return r;
+        }
+    } else {
+        tracer_header_t const h = *_tracer_header(old_ptr);
+        void *const raw = (uint8_t *)old_ptr - h.pad;
+        old_size = h.size;
+        pad      = _tracer_pad(align);
+
+        if (new_size > SIZE_MAX - pad) {
+            /* INVALID_ARG */
+        } else if (pad == h.pad) {
+            /* Same header layout: the inner allocator can move the whole block */
+            r = (align == alignof(max_align_t))
+                  ? tr->inner.reallocate(tr->inner.ctx, raw, h.size + h.pad,
+                                         new_size + pad, zeroed)
+                  : tr->inner.reallocate_aligned(tr->inner.ctx, raw, h.size + h.pad,
+                                                 new_size + pad, zeroed, align);
+        } else {
+            /* A stricter alignment needs a larger header, so copy by hand */
+            r = _tracer_inner_alloc(tr, new_size + pad, align, zeroed);
+            if (r.has_value) {
+                size_t const keep = h.size < new_size ? h.size : new_size;
+                memcpy((uint8_t *)r.u.value + pad, old_ptr, keep);
+                tr->inner.return_element(tr->inner.ctx, raw);
+            }
+        }
+        if (r.has_value) {
+            r.u.value = (uint8_t *)r.u.value + pad;
+            *_tracer_header(r.u.value) = (tracer_header_t){ .size = new_size, .pad = pad };
+        }
+    }
+    if (!r.has_value) {
+        _tracer_event(tr, sh, TRACE_REALLOC, new_size, old_ptr, site, false);
+        return r;
+    }
+
+    atomic_fetch_add_explicit(&sh->reallocs, 1u, memory_order_relaxed);
+    atomic_fetch_add_explicit(&sh->bytes_allocated, new_size, memory_order_relaxed);
+    atomic_fetch_add_explicit(&sh->bytes_freed, old_size, memory_order_relaxed);
+    atomic_fetch_add_explicit(&sh->size_classes[_tracer_size_class(new_size)], 1u,
+                              memory_order_relaxed);
+    _tracer_move_live(sh, old_size, new_size);
+    _tracer_event(tr, sh, TRACE_REALLOC, new_size, r.u.value, site, true);
+    return r;
+}
+// -------------------------------------------------------------------------------- 
+
+/* 0 selects the default alignment; anything else is rounded up to a power
+ * of two as the other allocators do.  Returns 0 if that overflows. */
+static inline size_t _tracer_align(size_t align) {
+    if (align <= alignof(max_align_t)) {
+        return alignof(max_align_t);
+    }
+    return _is_pow2(align) ? align : _next_pow2(align);
+}
+// -------------------------------------------------------------------------------- 
+
+/* The adapters are reached only through the vtable, so each has a real
+ * frame and its return address is the caller's call site. */
+static void_ptr_expect_t _tracer_v_alloc(void *ctx, size_t size, bool zeroed) {
+    uint64_t const site = TRACER_CALL_SITE();
+    if (!ctx) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+    return _tracer_alloc((tracer_t *)ctx, size, alignof(max_align_t), zeroed, site);
+}
+// -------------------------------------------------------------------------------- 
+
+static void_ptr_expect_t _tracer_v_alloc_aligned(void *ctx, size_t size,
+                                                 size_t align, bool zeroed) {
+    uint64_t const site = TRACER_CALL_SITE();
+    if (!ctx) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+    align = _tracer_align(align);
+    if (align == 0u) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = ALIGNMENT_ERROR };
+    }
+    return _tracer_alloc((tracer_t *)ctx, size, align, zeroed, site);
+}
+// -------------------------------------------------------------------------------- 
+
+static void_ptr_expect_t _tracer_v_realloc(void *ctx, void *old_ptr,
+                                           size_t old_size, size_t new_size,
+                                           bool zeroed) {
+    uint64_t const site = TRACER_CALL_SITE();
+    (void)old_size;  /* the header holds the authoritative size */
+    if (!ctx) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+    return _tracer_realloc((tracer_t *)ctx, old_ptr, new_size,
+                           alignof(max_align_t), zeroed, site);
+}
+// -------------------------------------------------------------------------------- 
+
+static void_ptr_expect_t _tracer_v_realloc_aligned(void *ctx, void *old_ptr,
+                                                   size_t old_size, size_t new_size,
+                                                   bool zeroed, size_t align) {
+    uint64_t const site = TRACER_CALL_SITE();
+    (void)old_size;
+    if (!ctx) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+    align = _tracer_align(align);
+    if (align == 0u) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = ALIGNMENT_ERROR };
+    }
+    return _tracer_realloc((tracer_t *)ctx, old_ptr, new_size, align, zeroed, site);
+}
+// -------------------------------------------------------------------------------- 
+
+static void _tracer_v_return(void *ctx, void *ptr) {
+    uint64_t const site = TRACER_CALL_SITE();
+    if (!ctx || !ptr) {
+        return;
+    }
+    _tracer_return((tracer_t *)ctx, ptr, site);
+}
+// -------------------------------------------------------------------------------- 
+
+static void _tracer_v_free(void *ctx) {
+    free_tracer((tracer_t *)ctx);
+}
+// -------------------------------------------------------------------------------- 
+
+static tracer_expect_t _init_tracer(allocator_vtable_t inner, size_t sample_every,
+                                    size_t sample_capacity, bool size_table) {
+    if (!inner.allocate || !inner.allocate_aligned || !inner.reallocate ||
+        !inner.reallocate_aligned || !inner.return_element) {
+        return (tracer_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+
+    if (sample_every == 0u) {
+        sample_capacity = 0u;
+    } else if (sample_capacity == 0u) {
+        sample_capacity = TRACER_DEFAULT_SAMPLES;
+    }
+    if (sample_capacity > (SIZE_MAX - sizeof(tracer_t)) / sizeof(trace_sample_t)) {
+        return (tracer_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+
+    tracer_t *tr = calloc(1, sizeof(*tr) + sample_capacity * sizeof(trace_sample_t));
+    if (!tr) {
+        return (tracer_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+    tr->shards = aligned_alloc(alignof(tracer_shard_t),
+                               TRACER_SHARDS * sizeof(tracer_shard_t));
+    if (!tr->shards) {
+        free(tr);
+        return (tracer_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+    memset(tr->shards, 0, TRACER_SHARDS * sizeof(tracer_shard_t));
+
+    if (pthread_mutex_init(&tr->lock, NULL) != 0) {
+        free(tr->shards);
+        free(tr);
+        return (tracer_expect_t){ .has_value = false, .u.error = LOCK_FAILED };
+    }
+
+    tr->inner        = inner;
+    tr->sample_every = sample_every;
+    tr->capacity     = sample_capacity;
+
+    if (size_table) {
+        tr->tables = aligned_alloc(alignof(tracer_table_t),
+                                   TRACER_TABLE_SHARDS * sizeof(tracer_table_t));
+        if (!tr->tables) {
+            free_tracer(tr);
+            return (tracer_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+        }
+        memset(tr->tables, 0, TRACER_TABLE_SHARDS * sizeof(tracer_table_t));
+        for (size_t i = 0u; i < TRACER_TABLE_SHARDS; ++i) {
+            tracer_table_t *t = &tr->tables[i];
+            t->slots = calloc(TRACER_TABLE_MIN, sizeof(*t->slots));
+            t->mask  = TRACER_TABLE_MIN - 1u;
+            if (!t->slots || pthread_mutex_init(&t->lock, NULL) != 0) {
+                error_code_t const err = t->slots ? LOCK_FAILED : BAD_ALLOC;
+                free(t->slots);
+                t->slots = NULL;    /* marks where free_tracer stops */
+                free_tracer(tr);
+                return (tracer_expect_t){ .has_value = false, .u.error = err };
+            }
+        }
+    }
+
+    return (tracer_expect_t){ .has_value = true, .u.value = tr };
+}
+// -------------------------------------------------------------------------------- 
+
+tracer_expect_t init_tracer(allocator_vtable_t inner,
+                            size_t sample_every,
+                            size_t sample_capacity) {
+    return _init_tracer(inner, sample_every, sample_capacity, false);
+}
+// -------------------------------------------------------------------------------- 
+
+tracer_expect_t init_tracer_with_size_table(allocator_vtable_t inner,
+                                            size_t sample_every,
+                                            size_t sample_capacity) {
+    return _init_tracer(inner, sample_every, sample_capacity, true);
+}
+// -------------------------------------------------------------------------------- 
+
+void free_tracer(tracer_t *tr) {
+    if (!tr) return;
+    if (tr->tables) {
+        for (size_t i = 0u; i < TRACER_TABLE_SHARDS && tr->tables[i].slots; ++i) {
+            pthread_mutex_destroy(&tr->tables[i].lock);
+            free(tr->tables[i].slots);
+        }
+        free(tr->tables);
+    }
+    pthread_mutex_destroy(&tr->lock);
+    free(tr->shards);
+    free(tr);
+}
+// -------------------------------------------------------------------------------- 
+
+allocator_vtable_t tracer_allocator(tracer_t *tr) {
+    allocator_vtable_t v = {
+        .allocate           = _tracer_v_alloc,
+        .allocate_aligned   = _tracer_v_alloc_aligned,
+        .reallocate         = _tracer_v_realloc,
+        .reallocate_aligned = _tracer_v_realloc_aligned,
+        .return_element     = _tracer_v_return,
+        .deallocate         = _tracer_v_free,
+        .ctx                = tr
+    };
+    return v;
+}
+// -------------------------------------------------------------------------------- 
+
+bool tracer_summary(const tracer_t *tr, tracer_summary_t *out) {
+    if (!tr || !out) {
+        return false;
+    }
+    tracer_t *mtr = (tracer_t *)tr;
+
+    memset(out, 0, sizeof(*out));
+    size_t active    = 0u;
+    size_t solo_peak = 0u;
+    for (size_t i = 0u; i < TRACER_SHARDS; ++i) {
+        tracer_shard_t *sh = &mtr->shards[i];
+        size_t const events = atomic_load_explicit(&sh->events, memory_order_relaxed);
+        size_t const live   = atomic_load_explicit(&sh->live_bytes, memory_order_relaxed);
+
+        out->events          += events;
+        out->allocs          += atomic_load_explicit(&sh->allocs, memory_order_relaxed);
+        out->reallocs        += atomic_load_explicit(&sh->reallocs, memory_order_relaxed);
+        out->frees           += atomic_load_explicit(&sh->frees, memory_order_relaxed);
+        out->failures        += atomic_load_explicit(&sh->failures, memory_order_relaxed);
+        out->bytes_allocated += atomic_load_explicit(&sh->bytes_allocated, memory_order_relaxed);
+        out->bytes_freed     += atomic_load_explicit(&sh->bytes_freed, memory_order_relaxed);
+        out->live_bytes      += live;
+        for (size_t c = 0u; c < TRACER_SIZE_CLASSES; ++c) {
+            out->size_classes[c] += atomic_load_explicit(&sh->size_classes[c],
+                                                         memory_order_relaxed);
+        }
+        if (events != 0u || live != 0u) {
+            active++;
+            solo_peak = atomic_load_explicit(&sh->peak_live_bytes, memory_order_relaxed);
+        }
+    }
+    /* A free can be counted before the alloc it matches on another shard */
+    if ((ptrdiff_t)out->live_bytes < 0) {
+        out->live_bytes = 0u;
+    }
+
+    /* One shard saw every call, so its own high-water mark is exact;
+     * otherwise fold the current total into the sampled peak. */
+    size_t const seen = (active == 1u) ? solo_peak : out->live_bytes;
+    pthread_mutex_lock(&mtr->lock);
+    if (_tracer_live_above(seen, mtr->peak_live_bytes)) {
+        mtr->peak_live_bytes = seen;
+    }
+    out->peak_live_bytes = mtr->peak_live_bytes;
+    out->samples         = mtr->taken;
+    pthread_mutex_unlock(&mtr->lock);
+    return true;
+}
+// -------------------------------------------------------------------------------- 
+
+size_t tracer_samples(const tracer_t *tr, trace_sample_t *out, size_t cap) {
+    if (!tr) {
+        return 0u;
+    }
+    tracer_t *mtr = (tracer_t *)tr;
+
+    pthread_mutex_lock(&mtr->lock);
+    size_t const held  = tr->taken < tr->capacity ? tr->taken : tr->capacity;
+    size_t const first = tr->taken - held;    /* oldest retained sample */
+    size_t n = held;
+    if (out) {
+        n = held < cap ? held : cap;
+        for (size_t i = 0u; i < n; ++i) {
+            out[i] = tr->samples[(first + i) % tr->capacity];
+        }
+    }
+    pthread_mutex_unlock(&mtr->lock);
+    return n;
+}
+// -------------------------------------------------------------------------------- 
+
+bool reset_tracer(tracer_t *tr) {
+    if (!tr) {
+        return false;
+    }
+
+    size_t live = 0u;
+    for (size_t i = 0u; i < TRACER_SHARDS; ++i) {
+        tracer_shard_t *sh = &tr->shards[i];
+        size_t const held = atomic_load_explicit(&sh->live_bytes, memory_order_relaxed);
+
+        atomic_store_explicit(&sh->events, 0u, memory_order_relaxed);
+        atomic_store_explicit(&sh->allocs, 0u, memory_order_relaxed);
+        atomic_store_explicit(&sh->reallocs, 0u, memory_order_relaxed);
+        atomic_store_explicit(&sh->frees, 0u, memory_order_relaxed);
+        atomic_store_explicit(&sh->failures, 0u, memory_order_relaxed);
+        atomic_store_explicit(&sh->bytes_allocated, 0u, memory_order_relaxed);
+        atomic_store_explicit(&sh->bytes_freed, 0u, memory_order_relaxed);
+        atomic_store_explicit(&sh->peak_live_bytes, held, memory_order_relaxed);
+        for (size_t c = 0u; c < TRACER_SIZE_CLASSES; ++c) {
+            atomic_store_explicit(&sh->size_classes[c], 0u, memory_order_relaxed);
+        }
+        live += held;
+    }
+
+    pthread_mutex_lock(&tr->lock);
+    tr->taken           = 0u;
+    tr->peak_live_bytes = ((ptrdiff_t)live < 0) ? 0u : live;
+    pthread_mutex_unlock(&tr->lock);
+    return true;
+}
+// -------------------------------------------------------------------------------- 
+
+static const char *_trace_op_name(uint32_t op) {
+    switch (op) {
+        case TRACE_ALLOC:   return "alloc";
+        case TRACE_REALLOC: return "realloc";
+        case TRACE_FREE:    return "free";
+        default:            return "unknown";
+    }
+}
+// -------------------------------------------------------------------------------- 
+
+/* Snapshot of the ring, so no lock is held while writing to the stream. */
+static trace_sample_t *_tracer_snapshot(const tracer_t *tr, size_t *count) {
+    size_t const held = tracer_samples(tr, NULL, 0u);
+    trace_sample_t *s = malloc((held ? held : 1u) * sizeof(*s));
+    if (s) {
+        *count = tracer_samples(tr, s, held);
+    }
+    return s;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t tracer_write_csv(const tracer_t *tr, FILE *stream) {
+    if (!tr || !stream) {
+        return NULL_POINTER;
+    }
+
+    size_t n = 0u;
+    trace_sample_t *s = _tracer_snapshot(tr, &n);
+    if (!s) {
+        return BAD_ALLOC;
+    }
+
+    bool ok = fprintf(stream, "seq,time_ns,op,size,ptr,site,ok\n") > 0;
+    for (size_t i = 0u; ok && i < n; ++i) {
+        ok = fprintf(stream, "%llu,%llu,%s,%llu,0x%llx,0x%llx,%u\n",
+                     (unsigned long long)s[i].seq,
+                     (unsigned long long)s[i].time_ns,
+                     _trace_op_name(s[i].op),
+                     (unsigned long long)s[i].size,
+                     (unsigned long long)s[i].ptr,
+                     (unsigned long long)s[i].site,
+                     (unsigned)s[i].ok) > 0;
+    }
+    free(s);
+    return (ok && !ferror(stream)) ? NO_ERROR : FILE_WRITE;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t tracer_write_binary(const tracer_t *tr, FILE *stream) {
+    if (!tr || !stream) {
+        return NULL_POINTER;
+    }
+
+    tracer_summary_t sum;
+    (void)tracer_summary(tr, &sum);
+
+    size_t n = 0u;
+    trace_sample_t *s = _tracer_snapshot(tr, &n);
+    if (!s) {
+        return BAD_ALLOC;
+    }
+
+    uint32_t const version[2] = { 1u, (uint32_t)sizeof(trace_sample_t) };
+    uint64_t counters[11u + TRACER_SIZE_CLASSES] = {
+        tr->sample_every, sum.events, sum.allocs, sum.reallocs, sum.frees,
+        sum.failures, sum.bytes_allocated, sum.bytes_freed, sum.live_bytes,
+        sum.peak_live_bytes, sum.samples
+    };
+    for (size_t i = 0u; i < TRACER_SIZE_CLASSES; ++i) {
+        counters[11u + i] = sum.size_classes[i];
+    }
+    uint64_t const count = n;
+
+    bool const ok =
+        fwrite("CSALTTRC", 1u, 8u, stream) == 8u &&
+        fwrite(version, sizeof(version), 1u, stream) == 1u &&
+        fwrite(counters, sizeof(counters), 1u, stream) == 1u &&
+        fwrite(&count, sizeof(count), 1u, stream) == 1u &&
+        (n == 0u || fwrite(s, sizeof(*s), n, stream) == n);
+    free(s);
+    return ok ? NO_ERROR : FILE_WRITE;
+}
+// -------------------------------------------------------------------------------- 
+
+bool tracer_stats(const tracer_t *tr, char *buffer, size_t buffer_size) {
+    size_t offset = 0U;
+
+    if ((buffer == NULL) || (buffer_size == 0U)) {
+        return false;
+    }
+
+    if (tr == NULL) {
+        (void)_buf_appendf(buffer, buffer_size, &offset, "%s", "Tracer: NULL\n");
+        return true;
+    }
+
+    tracer_summary_t s;
+    (void)tracer_summary(tr, &s);
+
+    if (!_buf_appendf(buffer, buffer_size, &offset,
+                      "%s", "Tracer Statistics:\n")) {
+        return false;
+    }
+
+    if (!_buf_appendf(buffer, buffer_size, &offset,
+                      "  Calls: %zu (%zu alloc, %zu realloc, %zu free, %zu failed)\n",
+                      s.events, s.allocs, s.reallocs, s.frees, s.failures)) {
+        return false;
+    }
+
+    if (!_buf_appendf(buffer, buffer_size, &offset,
+                      "  Bytes allocated: %zu\n  Bytes freed: %zu\n",
+                      s.bytes_allocated, s.bytes_freed)) {
+        return false;
+    }
+
+    if (!_buf_appendf(buffer, buffer_size, &offset,
+                      "  Live bytes: %zu (peak %zu)\n",
+                      s.live_bytes, s.peak_live_bytes)) {
+        return false;
+    }
+
+    if (tr->sample_every == 0u) {
+        if (!_buf_appendf(buffer, buffer_size, &offset,
+                          "%s", "  Sampling: off\n")) {
+            return false;
+        }
+    } else {
+        if (!_buf_appendf(buffer, buffer_size, &offset,
+                          "  Sampling: 1 in %zu, %zu taken, %zu retained\n",
+                          tr->sample_every, s.samples,
+                          s.samples < tr->capacity ? s.samples : tr->capacity)) {
+            return false;
+        }
+    }
+
+    if (!_buf_appendf(buffer, buffer_size, &offset, "%s", "  Size classes:\n")) {
+        return false;
+    }
+    for (size_t i = 0u; i < TRACER_SIZE_CLASSES; ++i) {
+        if (s.size_classes[i] == 0u) {
+            continue;
+        }
+        size_t const hi = (size_t)1u << i;
+        if (!_buf_appendf(buffer, buffer_size, &offset,
+                          "    <= %zu bytes: %zu\n", hi, s.size_classes[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
 #endif /* ARENA_ENABLE_DYNAMIC */
 // ================================================================================
 // ================================================================================
@@ -17,27 +17,7 @@
 
 #include <math.h>
 
-#if defined(__AVX512BW__)
-#  include "simd_avx512_double.inl"
-#elif defined(__AVX2__)
-#  include "simd_avx2_double.inl"
-#elif defined(__AVX__)
-#  include "simd_avx_double.inl"
-#elif defined(__SSE4_1__)
-#  include "simd_sse41_double.inl"
-#elif defined(__SSSE3__)
-#  include "simd_sse3_double.inl"
-#elif defined(__SSE2__)
-#  include "simd_sse2_double.inl"
-#elif defined(__ARM_FEATURE_SVE2)
-#  include "simd_sve2_double.inl"
-#elif defined(__ARM_FEATURE_SVE)
-#  include "simd_sve_double.inl"
-#elif defined(__ARM_NEON)
-#  include "simd_neon_double.inl"
-#else
-#  include "simd_scalar_double.inl"
-#endif
+#include "simd_dispatch.h"
 
 // ================================================================================ 
 // ================================================================================ 
@@ -355,4 +335,302 @@ error_code_t min_double_tensor(const double_tensor_t* t, double* value) {
 }
 // ================================================================================
 // ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+error_code_t add_double_tensor(double_tensor_t*       out,
+                               const double_tensor_t* a,
+                               const double_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_add_double((double*)out->base->data, (const double*)a->base->data,
+                    (const double*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t sub_double_tensor(double_tensor_t*       out,
+                               const double_tensor_t* a,
+                               const double_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_sub_double((double*)out->base->data, (const double*)a->base->data,
+                    (const double*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t mul_double_tensor(double_tensor_t*       out,
+                               const double_tensor_t* a,
+                               const double_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_mul_double((double*)out->base->data, (const double*)a->base->data,
+                    (const double*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t div_double_tensor(double_tensor_t*       out,
+                               const double_tensor_t* a,
+                               const double_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_div_double((double*)out->base->data, (const double*)a->base->data,
+                    (const double*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t muladd_double_tensor(double_tensor_t*       out,
+                                  const double_tensor_t* a,
+                                  double                 mul,
+                                  double                 add) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_muladd_double((double*)out->base->data, (const double*)a->base->data, mul,
+                       add, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t clamp_double_tensor(double_tensor_t*       out,
+                                 const double_tensor_t* a,
+                                 double                 lo,
+                                 double                 hi) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    if (!(lo <= hi))              return INVALID_ARG;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_clamp_double((double*)out->base->data, (const double*)a->base->data, lo,
+                      hi, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t abs_double_tensor(double_tensor_t*       out,
+                               const double_tensor_t* a) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_abs_double((double*)out->base->data, (const double*)a->base->data,
+                    a->base->len);
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+#define DOUBLE_REDUCE_BLOCK 128u
+
+/* Pairwise summation: leaves of at most DOUBLE_REDUCE_BLOCK elements
+ * are summed by the SIMD kernels and the halves are combined
+ * recursively, so the error bound grows with log2(n / block) rather
+ * than n.  y selects a dot product, absolute an L1 sum. */
+static double _pairwise_double(const double* x, const double* y, size_t n,
+                               bool absolute) {
+    if (n <= DOUBLE_REDUCE_BLOCK) {
+        if (y != NULL) return simd_dot_double(x, y, n);
+        return absolute ? simd_asum_double(x, n) : simd_sum_double(x, n);
+    }
+    /* Split on a block boundary so every leaf but the last is full */
+    size_t const half = (n / 2u + DOUBLE_REDUCE_BLOCK - 1u) / DOUBLE_REDUCE_BLOCK
+                      * DOUBLE_REDUCE_BLOCK;
+    return _pairwise_double(x, y, half, absolute) +
+           _pairwise_double(x + half, (y != NULL) ? y + half : NULL,
+                            n - half, absolute);
+}
+// -------------------------------------------------------------------------------- 
+
+static error_code_t _reduce_guard(const double_tensor_t* t, const void* out) {
+    if (t == NULL || out == NULL)  return NULL_POINTER;
+    if (t->base == NULL)           return NULL_POINTER;
+    if (t->base->data == NULL)     return EMPTY;
+    if (t->base->len == 0u)        return EMPTY;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+static error_code_t _dot_guard(const double_tensor_t* a, const double_tensor_t* b,
+                               const void* out) {
+    if (a == NULL || b == NULL || out == NULL) return NULL_POINTER;
+    if (a->base == NULL || b->base == NULL)    return NULL_POINTER;
+    if (a->base->len == 0u)                    return EMPTY;
+    if (b->base->len != a->base->len)          return SIZE_MISMATCH;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t max_double_tensor(const double_tensor_t* t,
+                               double*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    *value = -INFINITY;
+    return simd_max_double((const double*)t->base->data, t->base->len, value);
+}
+// -------------------------------------------------------------------------------- 
+
+/* First index holding v.  lsearch matches |x - v| <= 0, which is exact
+ * equality for finite v; NaN and the infinities are found directly. */
+static size_t _first_index_double(const double* x, size_t n, double v) {
+    if (isfinite(v)) return simd_lsearch_double(x, n, v, 0.0);
+    for (size_t i = 0u; i < n; i++) {
+        if (isnan(v) ? isnan(x[i]) : x[i] == v) return i;
+    }
+    return SIZE_MAX;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t argmin_double_tensor(const double_tensor_t* t,
+                                  size_t*                index) {
+    error_code_t err = _reduce_guard(t, index);
+    if (err != NO_ERROR) return err;
+
+    const double* x = (const double*)t->base->data;
+    double        v = INFINITY;
+    simd_min_double(x, t->base->len, &v);
+    *index = _first_index_double(x, t->base->len, v);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t argmax_double_tensor(const double_tensor_t* t,
+                                  size_t*                index) {
+    error_code_t err = _reduce_guard(t, index);
+    if (err != NO_ERROR) return err;
+
+    const double* x = (const double*)t->base->data;
+    double        v = -INFINITY;
+    simd_max_double(x, t->base->len, &v);
+    *index = _first_index_double(x, t->base->len, v);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t sum_double_tensor(const double_tensor_t* t,
+                               double*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const double* x = (const double*)t->base->data;
+    *value = _pairwise_double(x, NULL, t->base->len, false);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t mean_double_tensor(const double_tensor_t* t,
+                                double*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const double* x = (const double*)t->base->data;
+    *value = _pairwise_double(x, NULL, t->base->len, false) / (double)t->base->len;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t l1_norm_double_tensor(const double_tensor_t* t,
+                                   double*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const double* x = (const double*)t->base->data;
+    *value = _pairwise_double(x, NULL, t->base->len, true);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t l2_norm_double_tensor(const double_tensor_t* t,
+                                   double*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const double* x = (const double*)t->base->data;
+    *value = sqrt(_pairwise_double(x, x, t->base->len, false));
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t dot_double_tensor(const double_tensor_t* a,
+                               const double_tensor_t* b,
+                               double*                value) {
+    error_code_t err = _dot_guard(a, b, value);
+    if (err != NO_ERROR) return err;
+
+    const double* x = (const double*)a->base->data;
+    const double* y = (const double*)b->base->data;
+    *value = _pairwise_double(x, y, a->base->len, false);
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// AXIS REDUCTIONS
+
+double_tensor_expect_t reduce_double_tensor_axis(const double_tensor_t* t,
+                                                 uint8_t                axis,
+                                                 reduce_op_t            op,
+                                                 allocator_vtable_t     alloc_v) {
+    if (t == NULL)
+        return (double_tensor_expect_t){ .has_value = false,
+                                         .u.error   = NULL_POINTER };
+
+    tensor_expect_t r = reduce_tensor_axis(t->base, axis, op, alloc_v);
+    if (!r.has_value)
+        return (double_tensor_expect_t){ .has_value = false,
+                                         .u.error   = r.u.error };
+
+    /* Wrap the result on the allocator it was built with */
+    allocator_vtable_t av = r.u.value->alloc_v;
+    void_ptr_expect_t wr = av.allocate(av.ctx, sizeof(double_tensor_t), true);
+    if (!wr.has_value) {
+        return_tensor(r.u.value);
+        return (double_tensor_expect_t){ .has_value = false,
+                                         .u.error   = BAD_ALLOC };
+    }
+
+    double_tensor_t* a = (double_tensor_t*)wr.u.value;
+    a->base = r.u.value;
+    return (double_tensor_expect_t){ .has_value = true, .u.value = a };
+}
+// ================================================================================
+// ================================================================================
+// FILE STORAGE
+
+double_tensor_expect_t map_double_tensor_file(const char*        path,
+                                              allocator_vtable_t alloc_v) {
+    tensor_expect_t r = map_tensor_file(path, alloc_v);
+    if (!r.has_value)
+        return (double_tensor_expect_t){ .has_value = false, .u.error = r.u.error };
+    if (r.u.value->dtype != DOUBLE_TYPE) {
+        return_tensor(r.u.value);
+        return (double_tensor_expect_t){ .has_value = false, .u.error = TYPE_MISMATCH };
+    }
+
+    /* Allocate the wrapper through the mapped tensor's allocator, which
+     * keeps the mapping's bookkeeping alive until the wrapper is returned */
+    allocator_vtable_t av = r.u.value->alloc_v;
+    void_ptr_expect_t wr = av.allocate(av.ctx, sizeof(double_tensor_t), true);
+    if (!wr.has_value) {
+        return_tensor(r.u.value);
+        return (double_tensor_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+
+    double_tensor_t* a = (double_tensor_t*)wr.u.value;
+    a->base = r.u.value;
+    return (double_tensor_expect_t){ .has_value = true, .u.value = a };
+}
+// ================================================================================
+// ================================================================================
 // eof
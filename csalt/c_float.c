@@ -14,30 +14,11 @@
 //
 #include "c_float.h"
 #include "c_dtypes.h"
+#include <math.h>
 
 #include <float.h>
 
-#if defined(__AVX512BW__)
-#  include "simd_avx512_float.inl"
-#elif defined(__AVX2__)
-#  include "simd_avx2_float.inl"
-#elif defined(__AVX__)
-#  include "simd_avx_float.inl"
-#elif defined(__SSE4_1__)
-#  include "simd_sse41_float.inl"
-#elif defined(__SSSE3__)
-#  include "simd_sse3_float.inl"
-#elif defined(__SSE2__)
-#  include "simd_sse2_float.inl"
-#elif defined(__ARM_FEATURE_SVE2)
-#  include "simd_sve2_float.inl"
-#elif defined(__ARM_FEATURE_SVE)
-#  include "simd_sve_float.inl"
-#elif defined(__ARM_NEON)
-#  include "simd_neon_float.inl"
-#else
-#  include "simd_scalar_float.inl"
-#endif
+#include "simd_dispatch.h"
 // ================================================================================ 
 // ================================================================================ 
 
@@ -363,4 +344,302 @@ error_code_t min_float_tensor(const float_tensor_t* t, float* value) {
 }
 // ================================================================================
 // ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+error_code_t add_float_tensor(float_tensor_t*       out,
+                              const float_tensor_t* a,
+                              const float_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_add_float((float*)out->base->data, (const float*)a->base->data,
+                   (const float*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t sub_float_tensor(float_tensor_t*       out,
+                              const float_tensor_t* a,
+                              const float_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_sub_float((float*)out->base->data, (const float*)a->base->data,
+                   (const float*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t mul_float_tensor(float_tensor_t*       out,
+                              const float_tensor_t* a,
+                              const float_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_mul_float((float*)out->base->data, (const float*)a->base->data,
+                   (const float*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t div_float_tensor(float_tensor_t*       out,
+                              const float_tensor_t* a,
+                              const float_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_div_float((float*)out->base->data, (const float*)a->base->data,
+                   (const float*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t muladd_float_tensor(float_tensor_t*       out,
+                                 const float_tensor_t* a,
+                                 float                 mul,
+                                 float                 add) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_muladd_float((float*)out->base->data, (const float*)a->base->data, mul,
+                      add, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t clamp_float_tensor(float_tensor_t*       out,
+                                const float_tensor_t* a,
+                                float                 lo,
+                                float                 hi) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    if (!(lo <= hi))              return INVALID_ARG;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_clamp_float((float*)out->base->data, (const float*)a->base->data, lo, hi,
+                     a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t abs_float_tensor(float_tensor_t*       out,
+                              const float_tensor_t* a) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_abs_float((float*)out->base->data, (const float*)a->base->data,
+                   a->base->len);
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+#define FLOAT_REDUCE_BLOCK 256u
+
+/* Pairwise summation: leaves of at most FLOAT_REDUCE_BLOCK elements
+ * are summed by the SIMD kernels and the halves are combined
+ * recursively, so the error bound grows with log2(n / block) rather
+ * than n.  y selects a dot product, absolute an L1 sum. */
+static float _pairwise_float(const float* x, const float* y, size_t n,
+                             bool absolute) {
+    if (n <= FLOAT_REDUCE_BLOCK) {
+        if (y != NULL) return simd_dot_float(x, y, n);
+        return absolute ? simd_asum_float(x, n) : simd_sum_float(x, n);
+    }
+    /* Split on a block boundary so every leaf but the last is full */
+    size_t const half = (n / 2u + FLOAT_REDUCE_BLOCK - 1u) / FLOAT_REDUCE_BLOCK
+                      * FLOAT_REDUCE_BLOCK;
+    return _pairwise_float(x, y, half, absolute) +
+           _pairwise_float(x + half, (y != NULL) ? y + half : NULL,
+                           n - half, absolute);
+}
+// -------------------------------------------------------------------------------- 
+
+static error_code_t _reduce_guard(const float_tensor_t* t, const void* out) {
+    if (t == NULL || out == NULL)  return NULL_POINTER;
+    if (t->base == NULL)           return NULL_POINTER;
+    if (t->base->data == NULL)     return EMPTY;
+    if (t->base->len == 0u)        return EMPTY;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+static error_code_t _dot_guard(const float_tensor_t* a, const float_tensor_t* b,
+                               const void* out) {
+    if (a == NULL || b == NULL || out == NULL) return NULL_POINTER;
+    if (a->base == NULL || b->base == NULL)    return NULL_POINTER;
+    if (a->base->len == 0u)                    return EMPTY;
+    if (b->base->len != a->base->len)          return SIZE_MISMATCH;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t max_float_tensor(const float_tensor_t* t,
+                              float*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    *value = -INFINITY;
+    return simd_max_float((const float*)t->base->data, t->base->len, value);
+}
+// -------------------------------------------------------------------------------- 
+
+/* First index holding v.  lsearch matches |x - v| <= 0, which is exact
+ * equality for finite v; NaN and the infinities are found directly. */
+static size_t _first_index_float(const float* x, size_t n, float v) {
+    if (isfinite(v)) return simd_lsearch_float(x, n, v, 0.0f);
+    for (size_t i = 0u; i < n; i++) {
+        if (isnan(v) ? isnan(x[i]) : x[i] == v) return i;
+    }
+    return SIZE_MAX;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t argmin_float_tensor(const float_tensor_t* t,
+                                 size_t*               index) {
+    error_code_t err = _reduce_guard(t, index);
+    if (err != NO_ERROR) return err;
+
+    const float* x = (const float*)t->base->data;
+    float        v = INFINITY;
+    simd_min_float(x, t->base->len, &v);
+    *index = _first_index_float(x, t->base->len, v);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t argmax_float_tensor(const float_tensor_t* t,
+                                 size_t*               index) {
+    error_code_t err = _reduce_guard(t, index);
+    if (err != NO_ERROR) return err;
+
+    const float* x = (const float*)t->base->data;
+    float        v = -INFINITY;
+    simd_max_float(x, t->base->len, &v);
+    *index = _first_index_float(x, t->base->len, v);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t sum_float_tensor(const float_tensor_t* t,
+                              float*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const float* x = (const float*)t->base->data;
+    *value = _pairwise_float(x, NULL, t->base->len, false);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t mean_float_tensor(const float_tensor_t* t,
+                               float*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const float* x = (const float*)t->base->data;
+    *value = _pairwise_float(x, NULL, t->base->len, false) / (float)t->base->len;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t l1_norm_float_tensor(const float_tensor_t* t,
+                                  float*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const float* x = (const float*)t->base->data;
+    *value = _pairwise_float(x, NULL, t->base->len, true);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t l2_norm_float_tensor(const float_tensor_t* t,
+                                  float*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const float* x = (const float*)t->base->data;
+    *value = sqrtf(_pairwise_float(x, x, t->base->len, false));
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t dot_float_tensor(const float_tensor_t* a,
+                              const float_tensor_t* b,
+                              float*                value) {
+    error_code_t err = _dot_guard(a, b, value);
+    if (err != NO_ERROR) return err;
+
+    const float* x = (const float*)a->base->data;
+    const float* y = (const float*)b->base->data;
+    *value = _pairwise_float(x, y, a->base->len, false);
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// AXIS REDUCTIONS
+
+float_tensor_expect_t reduce_float_tensor_axis(const float_tensor_t* t,
+                                               uint8_t               axis,
+                                               reduce_op_t           op,
+                                               allocator_vtable_t    alloc_v) {
+    if (t == NULL)
+        return (float_tensor_expect_t){ .has_value = false,
+                                        .u.error   = NULL_POINTER };
+
+    tensor_expect_t r = reduce_tensor_axis(t->base, axis, op, alloc_v);
+    if (!r.has_value)
+        return (float_tensor_expect_t){ .has_value = false,
+                                        .u.error   = r.u.error };
+
+    /* Wrap the result on the allocator it was built with */
+    allocator_vtable_t av = r.u.value->alloc_v;
+    void_ptr_expect_t wr = av.allocate(av.ctx, sizeof(float_tensor_t), true);
+    if (!wr.has_value) {
+        return_tensor(r.u.value);
+        return (float_tensor_expect_t){ .has_value = false,
+                                        .u.error   = BAD_ALLOC };
+    }
+
+    float_tensor_t* a = (float_tensor_t*)wr.u.value;
+    a->base = r.u.value;
+    return (float_tensor_expect_t){ .has_value = true, .u.value = a };
+}
+// ================================================================================
+// ================================================================================
+// FILE STORAGE
+
+float_tensor_expect_t map_float_tensor_file(const char*        path,
+                                            allocator_vtable_t alloc_v) {
+    tensor_expect_t r = map_tensor_file(path, alloc_v);
+    if (!r.has_value)
+        return (float_tensor_expect_t){ .has_value = false, .u.error = r.u.error };
+    if (r.u.value->dtype != FLOAT_TYPE) {
+        return_tensor(r.u.value);
+        return (float_tensor_expect_t){ .has_value = false, .u.error = TYPE_MISMATCH };
+    }
+
+    /* Allocate the wrapper through the mapped tensor's allocator, which
+     * keeps the mapping's bookkeeping alive until the wrapper is returned */
+    allocator_vtable_t av = r.u.value->alloc_v;
+    void_ptr_expect_t wr = av.allocate(av.ctx, sizeof(float_tensor_t), true);
+    if (!wr.has_value) {
+        return_tensor(r.u.value);
+        return (float_tensor_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+
+    float_tensor_t* a = (float_tensor_t*)wr.u.value;
+    a->base = r.u.value;
+    return (float_tensor_expect_t){ .has_value = true, .u.value = a };
+}
+// ================================================================================
+// ================================================================================
 // eof
@@ -16,38 +16,9 @@
 #include "c_dtypes.h"
 
 #include <inttypes.h>
+#include <math.h>
 
-#if defined(__AVX512BW__)
-#  include "simd_avx512_uint32.inl"
-#  include "simd_avx512_int32.inl"
-#elif defined(__AVX2__)
-#  include "simd_avx2_uint32.inl"
-#  include "simd_avx2_int32.inl"
-#elif defined(__AVX__)
-#  include "simd_avx_uint32.inl"
-#  include "simd_avx_int32.inl"
-#elif defined(__SSE4_1__)
-#  include "simd_sse41_uint32.inl"
-#  include "simd_sse41_int32.inl"
-#elif defined(__SSSE3__)
-#  include "simd_sse3_uint32.inl"
-#  include "simd_sse3.int32.inl"
-#elif defined(__SSE2__)
-#  include "simd_sse2_uint32.inl"
-#  include "simd_sse2_int32.inl"
-#elif defined(__ARM_FEATURE_SVE2)
-#  include "simd_sve2_uint32.inl"
-#  include "simd_sve2_int32.inl"
-#elif defined(__ARM_FEATURE_SVE)
-#  include "simd_sve_uint32.inl"
-#  include "simd_sve_int32.inl"
-#elif defined(__ARM_NEON)
-#  include "simd_neon_uint32.inl"
-#  include "simd_neon_int32.inl"
-#else
-#  include "simd_scalar_uint32.inl"
-#  include "simd_scalar_int32.inl"
-#endif
+#include "simd_dispatch.h"
 // ================================================================================ 
 // ================================================================================ 
 
@@ -316,4 +287,290 @@ error_code_t min_int32_tensor(const int32_tensor_t* t, int32_t* value) {
 }
 // ================================================================================
 // ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+error_code_t add_int32_tensor(int32_tensor_t*       out,
+                              const int32_tensor_t* a,
+                              const int32_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_add_uint32((uint32_t*)out->base->data, (const uint32_t*)a->base->data,
+                    (const uint32_t*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t sub_int32_tensor(int32_tensor_t*       out,
+                              const int32_tensor_t* a,
+                              const int32_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_sub_uint32((uint32_t*)out->base->data, (const uint32_t*)a->base->data,
+                    (const uint32_t*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t mul_int32_tensor(int32_tensor_t*       out,
+                              const int32_tensor_t* a,
+                              const int32_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_mul_uint32((uint32_t*)out->base->data, (const uint32_t*)a->base->data,
+                    (const uint32_t*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t div_int32_tensor(int32_tensor_t*       out,
+                              const int32_tensor_t* a,
+                              const int32_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    if (b->base == NULL)                       return NULL_POINTER;
+
+    const int32_t* y = (const int32_t*)b->base->data;
+    for (size_t i = 0u; i < b->base->len; i++) {
+        if (y[i] == 0) return DIV_BY_ZERO;
+    }
+
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    int32_t*       z = (int32_t*)out->base->data;
+    const int32_t* x = (const int32_t*)a->base->data;
+    /* INT32_MIN / -1 overflows; negate in unsigned arithmetic instead */
+    for (size_t i = 0u; i < a->base->len; i++)
+        z[i] = (y[i] == -1) ? (int32_t)(0u - (uint32_t)x[i]) : x[i] / y[i];
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t muladd_int32_tensor(int32_tensor_t*       out,
+                                 const int32_tensor_t* a,
+                                 int32_t               mul,
+                                 int32_t               add) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_muladd_uint32((uint32_t*)out->base->data, (const uint32_t*)a->base->data,
+                       (uint32_t)mul, (uint32_t)add, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t clamp_int32_tensor(int32_tensor_t*       out,
+                                const int32_tensor_t* a,
+                                int32_t               lo,
+                                int32_t               hi) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    if (lo > hi)                  return INVALID_ARG;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_clamp_int32((int32_t*)out->base->data, (const int32_t*)a->base->data, lo,
+                     hi, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t abs_int32_tensor(int32_tensor_t*       out,
+                              const int32_tensor_t* a) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_abs_int32((int32_t*)out->base->data, (const int32_t*)a->base->data,
+                   a->base->len);
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t _reduce_guard(const int32_tensor_t* t, const void* out) {
+    if (t == NULL || out == NULL)  return NULL_POINTER;
+    if (t->base == NULL)           return NULL_POINTER;
+    if (t->base->data == NULL)     return EMPTY;
+    if (t->base->len == 0u)        return EMPTY;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+static error_code_t _dot_guard(const int32_tensor_t* a, const int32_tensor_t* b,
+                               const void* out) {
+    if (a == NULL || b == NULL || out == NULL) return NULL_POINTER;
+    if (a->base == NULL || b->base == NULL)    return NULL_POINTER;
+    if (a->base->len == 0u)                    return EMPTY;
+    if (b->base->len != a->base->len)          return SIZE_MISMATCH;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t max_int32_tensor(const int32_tensor_t* t,
+                              int32_t*              value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    *value = INT32_MIN;
+    return simd_max_int32((const int32_t*)t->base->data, t->base->len, value);
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t argmin_int32_tensor(const int32_tensor_t* t,
+                                 size_t*               index) {
+    error_code_t err = _reduce_guard(t, index);
+    if (err != NO_ERROR) return err;
+
+    const int32_t* x = (const int32_t*)t->base->data;
+    int32_t        v = INT32_MAX;
+    simd_min_int32(x, t->base->len, &v);
+    *index = simd_lsearch_uint32((const uint32_t*)x, t->base->len, (uint32_t)v);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t argmax_int32_tensor(const int32_tensor_t* t,
+                                 size_t*               index) {
+    error_code_t err = _reduce_guard(t, index);
+    if (err != NO_ERROR) return err;
+
+    const int32_t* x = (const int32_t*)t->base->data;
+    int32_t        v = INT32_MIN;
+    simd_max_int32(x, t->base->len, &v);
+    *index = simd_lsearch_uint32((const uint32_t*)x, t->base->len, (uint32_t)v);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t sum_int32_tensor(const int32_tensor_t* t,
+                              int64_t*              value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    *value = simd_sum_int32((const int32_t*)t->base->data, t->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t mean_int32_tensor(const int32_tensor_t* t,
+                               double*               value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    int64_t s = simd_sum_int32((const int32_t*)t->base->data, t->base->len);
+    *value = (double)s / (double)t->base->len;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t l1_norm_int32_tensor(const int32_tensor_t* t,
+                                  double*               value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const int32_t* x = (const int32_t*)t->base->data;
+    uint64_t s = 0u;
+    for (size_t i = 0u; i < t->base->len; i++)
+        s += (x[i] < 0) ? (uint64_t)(-(int64_t)x[i]) : (uint64_t)x[i];
+    *value = (double)s;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t l2_norm_int32_tensor(const int32_tensor_t* t,
+                                  double*               value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const int32_t* x = (const int32_t*)t->base->data;
+    double s = 0.0;
+    for (size_t i = 0u; i < t->base->len; i++)
+        s += (double)x[i] * (double)x[i];
+    *value = sqrt(s);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t dot_int32_tensor(const int32_tensor_t* a,
+                              const int32_tensor_t* b,
+                              int64_t*              value) {
+    error_code_t err = _dot_guard(a, b, value);
+    if (err != NO_ERROR) return err;
+
+    const int32_t* x = (const int32_t*)a->base->data;
+    const int32_t* y = (const int32_t*)b->base->data;
+    int64_t s = 0;
+    for (size_t i = 0u; i < a->base->len; i++) {
+        int64_t p = (int64_t)x[i] * y[i];
+        if (__builtin_add_overflow(s, p, &s)) return NUMERIC_OVERFLOW;
+    }
+    *value = s;
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// AXIS REDUCTIONS
+
+int32_tensor_expect_t reduce_int32_tensor_axis(const int32_tensor_t* t,
+                                               uint8_t               axis,
+                                               reduce_op_t           op,
+                                               allocator_vtable_t    alloc_v) {
+    if (t == NULL)
+        return (int32_tensor_expect_t){ .has_value = false,
+                                        .u.error   = NULL_POINTER };
+
+    tensor_expect_t r = reduce_tensor_axis(t->base, axis, op, alloc_v);
+    if (!r.has_value)
+        return (int32_tensor_expect_t){ .has_value = false,
+                                        .u.error   = r.u.error };
+
+    /* Wrap the result on the allocator it was built with */
+    allocator_vtable_t av = r.u.value->alloc_v;
+    void_ptr_expect_t wr = av.allocate(av.ctx, sizeof(int32_tensor_t), true);
+    if (!wr.has_value) {
+        return_tensor(r.u.value);
+        return (int32_tensor_expect_t){ .has_value = false,
+                                        .u.error   = BAD_ALLOC };
+    }
+
+    int32_tensor_t* a = (int32_tensor_t*)wr.u.value;
+    a->base = r.u.value;
+    return (int32_tensor_expect_t){ .has_value = true, .u.value = a };
+}
+// ================================================================================
+// ================================================================================
+// FILE STORAGE
+
+int32_tensor_expect_t map_int32_tensor_file(const char*        path,
+                                            allocator_vtable_t alloc_v) {
+    tensor_expect_t r = map_tensor_file(path, alloc_v);
+    if (!r.has_value)
+        return (int32_tensor_expect_t){ .has_value = false, .u.error = r.u.error };
+    if (r.u.value->dtype != INT32_TYPE) {
+        return_tensor(r.u.value);
+        return (int32_tensor_expect_t){ .has_value = false, .u.error = TYPE_MISMATCH };
+    }
+
+    /* Allocate the wrapper through the mapped tensor's allocator, which
+     * keeps the mapping's bookkeeping alive until the wrapper is returned */
+    allocator_vtable_t av = r.u.value->alloc_v;
+    void_ptr_expect_t wr = av.allocate(av.ctx, sizeof(int32_tensor_t), true);
+    if (!wr.has_value) {
+        return_tensor(r.u.value);
+        return (int32_tensor_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+
+    int32_tensor_t* a = (int32_tensor_t*)wr.u.value;
+    a->base = r.u.value;
+    return (int32_tensor_expect_t){ .has_value = true, .u.value = a };
+}
+// ================================================================================
+// ================================================================================
 // eof
@@ -341,4 +341,321 @@ error_code_t min_ldouble_tensor(const ldouble_tensor_t* t, long double* value) {
 }
 // ================================================================================
 // ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+error_code_t add_ldouble_tensor(ldouble_tensor_t*       out,
+                                const ldouble_tensor_t* a,
+                                const ldouble_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    long double*       z = (long double*)out->base->data;
+    const long double* x = (const long double*)a->base->data;
+    const long double* y = (const long double*)b->base->data;
+    for (size_t i = 0u; i < a->base->len; i++)
+        z[i] = x[i] + y[i];
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t sub_ldouble_tensor(ldouble_tensor_t*       out,
+                                const ldouble_tensor_t* a,
+                                const ldouble_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    long double*       z = (long double*)out->base->data;
+    const long double* x = (const long double*)a->base->data;
+    const long double* y = (const long double*)b->base->data;
+    for (size_t i = 0u; i < a->base->len; i++)
+        z[i] = x[i] - y[i];
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t mul_ldouble_tensor(ldouble_tensor_t*       out,
+                                const ldouble_tensor_t* a,
+                                const ldouble_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    long double*       z = (long double*)out->base->data;
+    const long double* x = (const long double*)a->base->data;
+    const long double* y = (const long double*)b->base->data;
+    for (size_t i = 0u; i < a->base->len; i++)
+        z[i] = x[i] * y[i];
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t div_ldouble_tensor(ldouble_tensor_t*       out,
+                                const ldouble_tensor_t* a,
+                                const ldouble_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    long double*       z = (long double*)out->base->data;
+    const long double* x = (const long double*)a->base->data;
+    const long double* y = (const long double*)b->base->data;
+    for (size_t i = 0u; i < a->base->len; i++)
+        z[i] = x[i] / y[i];
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t muladd_ldouble_tensor(ldouble_tensor_t*       out,
+                                   const ldouble_tensor_t* a,
+                                   long double             mul,
+                                   long double             add) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    long double*       z = (long double*)out->base->data;
+    const long double* x = (const long double*)a->base->data;
+    for (size_t i = 0u; i < a->base->len; i++)
+        z[i] = x[i] * mul + add;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t clamp_ldouble_tensor(ldouble_tensor_t*       out,
+                                  const ldouble_tensor_t* a,
+                                  long double             lo,
+                                  long double             hi) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    if (!(lo <= hi))              return INVALID_ARG;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    long double*       z = (long double*)out->base->data;
+    const long double* x = (const long double*)a->base->data;
+    for (size_t i = 0u; i < a->base->len; i++)
+        z[i] = (x[i] > hi) ? hi : (x[i] < lo) ? lo : x[i];
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t abs_ldouble_tensor(ldouble_tensor_t*       out,
+                                const ldouble_tensor_t* a) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    long double*       z = (long double*)out->base->data;
+    const long double* x = (const long double*)a->base->data;
+    for (size_t i = 0u; i < a->base->len; i++)
+        z[i] = fabsl(x[i]);
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+#define LDOUBLE_REDUCE_BLOCK 64u
+
+/* Pairwise summation over leaves of at most LDOUBLE_REDUCE_BLOCK
+ * elements; y selects a dot product, absolute an L1 sum. */
+static long double _pairwise_ldouble(const long double* x, const long double* y, size_t n,
+                                     bool absolute) {
+    if (n <= LDOUBLE_REDUCE_BLOCK) {
+        long double s = 0.0L;
+        for (size_t i = 0u; i < n; i++)
+            s += (y != NULL) ? x[i] * y[i] : absolute ? fabsl(x[i]) : x[i];
+        return s;
+    }
+    /* Split on a block boundary so every leaf but the last is full */
+    size_t const half = (n / 2u + LDOUBLE_REDUCE_BLOCK - 1u) / LDOUBLE_REDUCE_BLOCK
+                      * LDOUBLE_REDUCE_BLOCK;
+    return _pairwise_ldouble(x, y, half, absolute) +
+           _pairwise_ldouble(x + half, (y != NULL) ? y + half : NULL,
+                             n - half, absolute);
+}
+// -------------------------------------------------------------------------------- 
+
+static error_code_t _reduce_guard(const ldouble_tensor_t* t, const void* out) {
+    if (t == NULL || out == NULL)  return NULL_POINTER;
+    if (t->base == NULL)           return NULL_POINTER;
+    if (t->base->data == NULL)     return EMPTY;
+    if (t->base->len == 0u)        return EMPTY;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+static error_code_t _dot_guard(const ldouble_tensor_t* a, const ldouble_tensor_t* b,
+                               const void* out) {
+    if (a == NULL || b == NULL || out == NULL) return NULL_POINTER;
+    if (a->base == NULL || b->base == NULL)    return NULL_POINTER;
+    if (a->base->len == 0u)                    return EMPTY;
+    if (b->base->len != a->base->len)          return SIZE_MISMATCH;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t max_ldouble_tensor(const ldouble_tensor_t* t,
+                                long double*            value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const long double* x = (const long double*)t->base->data;
+    long double cur = -(long double)INFINITY;
+    for (size_t i = 0u; i < t->base->len; i++) {
+        if (isnan(x[i])) { *value = NAN; return NO_ERROR; }
+        if (x[i] > cur) cur = x[i];
+    }
+    *value = cur;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t argmin_ldouble_tensor(const ldouble_tensor_t* t,
+                                   size_t*                 index) {
+    error_code_t err = _reduce_guard(t, index);
+    if (err != NO_ERROR) return err;
+
+    const long double* x = (const long double*)t->base->data;
+    size_t best = 0u;
+    for (size_t i = 0u; i < t->base->len; i++) {
+        if (isnan(x[i])) { *index = i; return NO_ERROR; }
+        if (x[i] < x[best]) best = i;
+    }
+    *index = best;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t argmax_ldouble_tensor(const ldouble_tensor_t* t,
+                                   size_t*                 index) {
+    error_code_t err = _reduce_guard(t, index);
+    if (err != NO_ERROR) return err;
+
+    const long double* x = (const long double*)t->base->data;
+    size_t best = 0u;
+    for (size_t i = 0u; i < t->base->len; i++) {
+        if (isnan(x[i])) { *index = i; return NO_ERROR; }
+        if (x[i] > x[best]) best = i;
+    }
+    *index = best;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t sum_ldouble_tensor(const ldouble_tensor_t* t,
+                                long double*            value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const long double* x = (const long double*)t->base->data;
+    *value = _pairwise_ldouble(x, NULL, t->base->len, false);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t mean_ldouble_tensor(const ldouble_tensor_t* t,
+                                 long double*            value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const long double* x = (const long double*)t->base->data;
+    *value = _pairwise_ldouble(x, NULL, t->base->len, false) / (long double)t->base->len;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t l1_norm_ldouble_tensor(const ldouble_tensor_t* t,
+                                    long double*            value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const long double* x = (const long double*)t->base->data;
+    *value = _pairwise_ldouble(x, NULL, t->base->len, true);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t l2_norm_ldouble_tensor(const ldouble_tensor_t* t,
+                                    long double*            value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const long double* x = (const long double*)t->base->data;
+    *value = sqrtl(_pairwise_ldouble(x, x, t->base->len, false));
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t dot_ldouble_tensor(const ldouble_tensor_t* a,
+                                const ldouble_tensor_t* b,
+                                long double*            value) {
+    error_code_t err = _dot_guard(a, b, value);
+    if (err != NO_ERROR) return err;
+
+    const long double* x = (const long double*)a->base->data;
+    const long double* y = (const long double*)b->base->data;
+    *value = _pairwise_ldouble(x, y, a->base->len, false);
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// AXIS REDUCTIONS
+
+ldouble_tensor_expect_t reduce_ldouble_tensor_axis(const ldouble_tensor_t* t,
+                                                   uint8_t                 axis,
+                                                   reduce_op_t             op,
+                                                   allocator_vtable_t      alloc_v) {
+    if (t == NULL)
+        return (ldouble_tensor_expect_t){ .has_value = false,
+                                          .u.error   = NULL_POINTER };
+
+    tensor_expect_t r = reduce_tensor_axis(t->base, axis, op, alloc_v);
+    if (!r.has_value)
+        return (ldouble_tensor_expect_t){ .has_value = false,
+                                          .u.error   = r.u.error };
+
+    /* Wrap the result on the allocator it was built with */
+    allocator_vtable_t av = r.u.value->alloc_v;
+    void_ptr_expect_t wr = av.allocate(av.ctx, sizeof(ldouble_tensor_t), true);
+    if (!wr.has_value) {
+        return_tensor(r.u.value);
+        return (ldouble_tensor_expect_t){ .has_value = false,
+                                          .u.error   = BAD_ALLOC };
+    }
+
+    ldouble_tensor_t* a = (ldouble_tensor_t*)wr.u.value;
+    a->base = r.u.value;
+    return (ldouble_tensor_expect_t){ .has_value = true, .u.value = a };
+}
+// ================================================================================
+// ================================================================================
+// FILE STORAGE
+
+ldouble_tensor_expect_t map_ldouble_tensor_file(const char*        path,
+                                                allocator_vtable_t alloc_v) {
+    tensor_expect_t r = map_tensor_file(path, alloc_v);
+    if (!r.has_value)
+        return (ldouble_tensor_expect_t){ .has_value = false, .u.error = r.u.error };
+    if (r.u.value->dtype != LDOUBLE_TYPE) {
+        return_tensor(r.u.value);
+        return (ldouble_tensor_expect_t){ .has_value = false, .u.error = TYPE_MISMATCH };
+    }
+
+    /* Allocate the wrapper through the mapped tensor's allocator, which
+     * keeps the mapping's bookkeeping alive until the wrapper is returned */
+    allocator_vtable_t av = r.u.value->alloc_v;
+    void_ptr_expect_t wr = av.allocate(av.ctx, sizeof(ldouble_tensor_t), true);
+    if (!wr.has_value) {
+        return_tensor(r.u.value);
+        return (ldouble_tensor_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+
+    ldouble_tensor_t* a = (ldouble_tensor_t*)wr.u.value;
+    a->base = r.u.value;
+    return (ldouble_tensor_expect_t){ .has_value = true, .u.value = a };
+}
+// ================================================================================
+// ================================================================================
 // eof
@@ -13,29 +13,10 @@
 // Include modules here
 
 #include "c_matrix.h"
+#include "simd_dispatch.h"
 #include <string.h>
-
-#if defined(__AVX512BW__)
-#  include "simd_avx512_uint8.inl"
-#elif defined(__AVX2__)
-#  include "simd_avx2_uint8.inl"
-#elif defined(__AVX__)
-#  include "simd_avx_uint8.inl"
-#elif defined(__SSE4_1__)
-#  include "simd_sse41_uint8.inl"
-#elif defined(__SSSE3__)
-#  include "simd_sse3_uint8.inl"
-#elif defined(__SSE2__)
-#  include "simd_sse2_uint8.inl"
-#elif defined(__ARM_FEATURE_SVE2)
-#  include "simd_sve2_uint8.inl"
-#elif defined(__ARM_FEATURE_SVE)
-#  include "simd_sve_uint8.inl"
-#elif defined(__ARM_NEON)
-#  include "simd_neon_uint8.inl"
-#else
-#  include "simd_scalar_uint8.inl"
-#endif
+#include <pthread.h>
+#include <unistd.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -95,49 +76,6 @@ static inline bool _matrix_in_bounds(const matrix_t* mat,
     return mat != NULL && row < mat->rows && col < mat->cols;
 }
 
-static bool _value_is_zero_default(const uint8_t* ptr,
-                                   dtype_id_t      dtype,
-                                   size_t          data_size) {
-    size_t i;
-
-    if ((ptr == NULL) || (data_size == 0u)) {
-        return true;
-    }
-
-    for (i = 0u; i < data_size; ++i) {
-        if (ptr[i] != 0u) {
-            break;
-        }
-    }
-
-    if (i == data_size) {
-        return true;
-    }
-
-    switch (dtype) {
-        case FLOAT_TYPE: {
-            float val = 0.0f;
-            memcpy(&val, ptr, sizeof(float));
-            return (val == 0.0f);
-        }
-
-        case DOUBLE_TYPE: {
-            double val = 0.0;
-            memcpy(&val, ptr, sizeof(double));
-            return (val == 0.0);
-        }
-
-        case LDOUBLE_TYPE: {
-            long double val = 0.0L;
-            memcpy(&val, ptr, sizeof(long double));
-            return (val == 0.0L);
-        }
-
-        default:
-            return false;
-    }
-}
-
 // --------------------------------------------------------------------------------
 
 static bool _value_is_zero_cb(const void* value,
@@ -248,6 +186,97 @@ static bool _coo_binary_search(const matrix_t* mat,
 
 // --------------------------------------------------------------------------------
 
+/* True if duplicates of dtype can be summed by _accumulate_value */
+static bool _is_summable_dtype(dtype_id_t dtype) {
+    switch (dtype) {
+        case FLOAT_TYPE:  case DOUBLE_TYPE: case LDOUBLE_TYPE:
+        case CHAR_TYPE:   case UCHAR_TYPE:
+        case INT8_TYPE:   case UINT8_TYPE:  case INT16_TYPE:  case UINT16_TYPE:
+        case INT32_TYPE:  case UINT32_TYPE: case INT64_TYPE:  case UINT64_TYPE:
+        case SIZE_T_TYPE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+/* *acc += *add for a summable dtype; integers wrap as unsigned would */
+static void _accumulate_value(void* acc, const void* add, dtype_id_t dtype) {
+#define ACCUMULATE(T) do {                                    \
+        T a_, b_;                                             \
+        memcpy(&a_, acc, sizeof(T));                          \
+        memcpy(&b_, add, sizeof(T));                          \
+        a_ = (T)(a_ + b_);                                    \
+        memcpy(acc, &a_, sizeof(T));                          \
+    } while (0)
+
+    switch (dtype) {
+        case FLOAT_TYPE:   ACCUMULATE(float);       break;
+        case DOUBLE_TYPE:  ACCUMULATE(double);      break;
+        case LDOUBLE_TYPE: ACCUMULATE(long double); break;
+        case CHAR_TYPE:
+        case UCHAR_TYPE:
+        case INT8_TYPE:
+        case UINT8_TYPE:   ACCUMULATE(uint8_t);     break;
+        case INT16_TYPE:
+        case UINT16_TYPE:  ACCUMULATE(uint16_t);    break;
+        case INT32_TYPE:
+        case UINT32_TYPE:  ACCUMULATE(uint32_t);    break;
+        case INT64_TYPE:
+        case UINT64_TYPE:  ACCUMULATE(uint64_t);    break;
+        case SIZE_T_TYPE:  ACCUMULATE(size_t);      break;
+        default:                                    break;
+    }
+
+#undef ACCUMULATE
+}
+
+// --------------------------------------------------------------------------------
+
+static inline size_t _coo_hash(size_t row, size_t col, size_t mask) {
+    uint64_t h = ((uint64_t)row * 0x9E3779B97F4A7C15ull) ^ (uint64_t)col;
+    h *= 0xC2B2AE3D27D4EB4Full;
+    return (size_t)(h ^ (h >> 32)) & mask;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Assembly hash slot holding (row, col), or the empty slot it would take */
+static size_t _coo_index_probe(const coo_matrix_t* coo, size_t row, size_t col) {
+    size_t h = _coo_hash(row, col, coo->index_mask);
+    while (coo->index[h] != 0u) {
+        size_t const e = coo->index[h] - 1u;
+        if (coo->row_idx[e] == row && coo->col_idx[e] == col) break;
+        h = (h + 1u) & coo->index_mask;
+    }
+    return h;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Entry at (row, col) through the assembly hash, else binary search when
+ * sorted, else a linear scan */
+static bool _coo_search(const matrix_t* mat,
+                        size_t          row,
+                        size_t          col,
+                        size_t*         index_out) {
+    const coo_matrix_t* coo = &mat->rep.coo;
+
+    if (coo->index != NULL) {
+        size_t const slot = coo->index[_coo_index_probe(coo, row, col)];
+        if (slot == 0u) return false;
+        if (index_out) *index_out = slot - 1u;
+        return true;
+    }
+
+    return coo->sorted ? _coo_binary_search(mat, row, col, index_out)
+                       : _coo_linear_search(mat, row, col, index_out);
+}
+
+// --------------------------------------------------------------------------------
+
 static error_code_t _get_dense_matrix(const matrix_t* mat,
                                       size_t          row,
                                       size_t          col,
@@ -268,11 +297,8 @@ static error_code_t _get_coo_matrix(const matrix_t* mat,
 
     const coo_matrix_t* coo = &mat->rep.coo;
     size_t idx = 0u;
-    bool found = coo->sorted
-        ? _coo_binary_search(mat, row, col, &idx)
-        : _coo_linear_search(mat, row, col, &idx);
 
-    if (!found) {
+    if (!_coo_search(mat, row, col, &idx)) {
         memset(out, 0, mat->data_size);
         return NO_ERROR;
     }
@@ -344,6 +370,66 @@ static error_code_t _get_csc_matrix(const matrix_t* mat,
     memset(out, 0, mat->data_size);
     return NO_ERROR;
 }
+// -------------------------------------------------------------------------------- 
+
+static error_code_t _get_bsr_matrix(const matrix_t* mat,
+                                    size_t          row,
+                                    size_t          col,
+                                    void*           out) {
+    if ((out == NULL) || !_matrix_in_bounds(mat, row, col)) {
+        return INVALID_ARG;
+    }
+
+    const bsr_matrix_t* bsr = &mat->rep.bsr;
+    size_t const br = bsr->block_rows;
+    size_t const bc = bsr->block_cols;
+    size_t const bj = col / bc;
+
+    /* Block columns are sorted within each block row */
+    size_t lo = bsr->block_ptr[row / br];
+    size_t hi = bsr->block_ptr[row / br + 1u];
+    while (lo < hi) {
+        size_t const mid = lo + (hi - lo) / 2u;
+        if (bsr->block_col[mid] < bj) lo = mid + 1u;
+        else                          hi = mid;
+    }
+
+    if (lo < bsr->block_ptr[row / br + 1u] && bsr->block_col[lo] == bj) {
+        size_t const k = (lo * br + row % br) * bc + col % bc;
+        memcpy(out, bsr->values + k * mat->data_size, mat->data_size);
+        return NO_ERROR;
+    }
+
+    memset(out, 0, mat->data_size);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+static error_code_t _get_sell_matrix(const matrix_t* mat,
+                                     size_t          row,
+                                     size_t          col,
+                                     void*           out) {
+    if ((out == NULL) || !_matrix_in_bounds(mat, row, col)) {
+        return INVALID_ARG;
+    }
+
+    const sell_matrix_t* sell = &mat->rep.sell;
+    size_t const slot = sell->row_slot[row];
+    size_t const c    = sell->chunk;
+    size_t const base = sell->slice_ptr[slot / c] + slot % c;
+
+    for (size_t j = 0u; j < sell->row_len[slot]; ++j) {
+        if (sell->col_idx[base + j * c] == col) {
+            memcpy(out,
+                   sell->values + (base + j * c) * mat->data_size,
+                   mat->data_size);
+            return NO_ERROR;
+        }
+    }
+
+    memset(out, 0, mat->data_size);
+    return NO_ERROR;
+}
 // ================================================================================ 
 // ================================================================================ 
 
@@ -419,6 +505,89 @@ static error_code_t _reserve_coo_matrix(matrix_t* mat, size_t new_cap) {
 
 // --------------------------------------------------------------------------------
 
+/* Fold value into entry idx as the assembly duplicate policy says; outside
+ * assembly the policy is COO_DUPLICATE_LAST, a plain overwrite */
+static void _coo_combine(matrix_t* mat, size_t idx, const void* value) {
+    uint8_t* dst = mat->rep.coo.values + (idx * mat->data_size);
+
+    switch (mat->rep.coo.duplicates) {
+        case COO_DUPLICATE_FIRST:
+            break;
+        case COO_DUPLICATE_SUM:
+            _accumulate_value(dst, value, mat->dtype);
+            break;
+        default:
+            memcpy(dst, value, mat->data_size);
+            break;
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+/* Rehash every entry into the assembly hash.  Entries repeating an earlier
+ * (row, col) are combined into it and the rest are compacted down, which
+ * keeps a sorted matrix sorted. */
+static void _coo_index_fill(matrix_t* mat) {
+    coo_matrix_t* coo = &mat->rep.coo;
+    size_t const  ds  = mat->data_size;
+    size_t        n   = 0u;
+
+    memset(coo->index, 0, (coo->index_mask + 1u) * sizeof(size_t));
+
+    for (size_t e = 0u; e < coo->nnz; ++e) {
+        size_t const h = _coo_index_probe(coo, coo->row_idx[e], coo->col_idx[e]);
+        if (coo->index[h] != 0u) {
+            _coo_combine(mat, coo->index[h] - 1u, coo->values + (e * ds));
+            continue;
+        }
+        if (n != e) {
+            coo->row_idx[n] = coo->row_idx[e];
+            coo->col_idx[n] = coo->col_idx[e];
+            memcpy(coo->values + (n * ds), coo->values + (e * ds), ds);
+        }
+        coo->index[h] = ++n;
+    }
+
+    coo->nnz = n;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Replace the assembly hash with one of slots entries (a power of two) */
+static error_code_t _coo_index_resize(matrix_t* mat, size_t slots) {
+    coo_matrix_t* coo = &mat->rep.coo;
+
+    if (slots > SIZE_MAX / sizeof(size_t)) return LENGTH_OVERFLOW;
+
+    void_ptr_expect_t r = mat->alloc_v.allocate(
+        mat->alloc_v.ctx, slots * sizeof(size_t), false
+    );
+    if (!r.has_value) return OUT_OF_MEMORY;
+
+    if (coo->index) mat->alloc_v.return_element(mat->alloc_v.ctx, coo->index);
+
+    coo->index      = (size_t*)r.u.value;
+    coo->index_mask = slots - 1u;
+    _coo_index_fill(mat);
+    return NO_ERROR;
+}
+
+// --------------------------------------------------------------------------------
+
+static void _coo_index_release(matrix_t* mat) {
+    coo_matrix_t* coo = &mat->rep.coo;
+
+    if (coo->index != NULL) {
+        mat->alloc_v.return_element(mat->alloc_v.ctx, coo->index);
+        coo->index = NULL;
+    }
+
+    coo->index_mask = 0u;
+    coo->duplicates = COO_DUPLICATE_LAST;
+}
+
+// --------------------------------------------------------------------------------
+
 static error_code_t _push_back_coo_matrix(matrix_t*   mat,
                                           size_t      row,
                                           size_t      col,
@@ -429,14 +598,11 @@ static error_code_t _push_back_coo_matrix(matrix_t*   mat,
 
     coo_matrix_t* coo = &mat->rep.coo;
 
-    /* Search for an existing entry at (row, col) and overwrite if found */
+    /* Search for an existing entry at (row, col) and overwrite (or,
+       while assembling, combine) if found */
     size_t idx = 0u;
-    bool found = coo->sorted
-        ? _coo_binary_search(mat, row, col, &idx)
-        : _coo_linear_search(mat, row, col, &idx);
-
-    if (found) {
-        memcpy(coo->values + (idx * mat->data_size), value, mat->data_size);
+    if (_coo_search(mat, row, col, &idx)) {
+        _coo_combine(mat, idx, value);
         return NO_ERROR;
     }
 
@@ -449,7 +615,15 @@ static error_code_t _push_back_coo_matrix(matrix_t*   mat,
         if (r != NO_ERROR) return r;
     }
 
+    /* Keep the assembly hash at most half full */
+    if (coo->index != NULL && 2u * (coo->nnz + 1u) > coo->index_mask + 1u) {
+        error_code_t r = _coo_index_resize(mat, 2u * (coo->index_mask + 1u));
+        if (r != NO_ERROR) return r;
+    }
+
     idx = coo->nnz;
+    if (coo->index != NULL)
+        coo->index[_coo_index_probe(coo, row, col)] = idx + 1u;
     coo->row_idx[idx] = row;
     coo->col_idx[idx] = col;
     memcpy(coo->values + (idx * mat->data_size), value, mat->data_size);
@@ -561,13 +735,12 @@ static error_code_t _sort_coo_matrix(matrix_t* mat) {
     if (mat->format != COO_MATRIX) return ILLEGAL_STATE;
 
     coo_matrix_t* coo = &mat->rep.coo;
-    if (coo->nnz < 2u) {
-        coo->sorted = true;
-        return NO_ERROR;
-    }
-
-    _coo_quicksort(mat, 0u, coo->nnz - 1u);
+    if (coo->nnz > 1u) _coo_quicksort(mat, 0u, coo->nnz - 1u);
     coo->sorted = true;
+
+    /* Entries moved, or were re-keyed by a row / column swap, so the
+       assembly hash slots are stale */
+    if (coo->index != NULL) _coo_index_fill(mat);
     return NO_ERROR;
 }
 
@@ -627,6 +800,8 @@ static void _return_coo_matrix(matrix_t* mat) {
         coo->values = NULL;
     }
 
+    _coo_index_release(mat);
+
     coo->nnz = 0u;
     coo->cap = 0u;
     coo->growth = false;
@@ -675,14 +850,79 @@ static void _return_csc_matrix(matrix_t* mat) {
     mat->rep.csc.nnz = 0u;
 }
 
+// --------------------------------------------------------------------------------
+
+static void _return_bsr_matrix(matrix_t* mat) {
+    bsr_matrix_t* bsr = &mat->rep.bsr;
+
+    if (bsr->block_ptr != NULL) {
+        mat->alloc_v.return_element(mat->alloc_v.ctx, bsr->block_ptr);
+        bsr->block_ptr = NULL;
+    }
+
+    if (bsr->block_col != NULL) {
+        mat->alloc_v.return_element(mat->alloc_v.ctx, bsr->block_col);
+        bsr->block_col = NULL;
+    }
+
+    if (bsr->values != NULL) {
+        mat->alloc_v.return_element(mat->alloc_v.ctx, bsr->values);
+        bsr->values = NULL;
+    }
+
+    bsr->nnzb = 0u;
+}
+
+// --------------------------------------------------------------------------------
+
+static void _return_sell_matrix(matrix_t* mat) {
+    sell_matrix_t* sell = &mat->rep.sell;
+
+    if (sell->slice_ptr != NULL) {
+        mat->alloc_v.return_element(mat->alloc_v.ctx, sell->slice_ptr);
+        sell->slice_ptr = NULL;
+    }
+
+    if (sell->row_perm != NULL) {
+        mat->alloc_v.return_element(mat->alloc_v.ctx, sell->row_perm);
+        sell->row_perm = NULL;
+    }
+
+    if (sell->row_slot != NULL) {
+        mat->alloc_v.return_element(mat->alloc_v.ctx, sell->row_slot);
+        sell->row_slot = NULL;
+    }
+
+    if (sell->row_len != NULL) {
+        mat->alloc_v.return_element(mat->alloc_v.ctx, sell->row_len);
+        sell->row_len = NULL;
+    }
+
+    if (sell->col_idx != NULL) {
+        mat->alloc_v.return_element(mat->alloc_v.ctx, sell->col_idx);
+        sell->col_idx = NULL;
+    }
+
+    if (sell->values != NULL) {
+        mat->alloc_v.return_element(mat->alloc_v.ctx, sell->values);
+        sell->values = NULL;
+    }
+
+    sell->nnz = 0u;
+}
+
 // ================================================================================
 // Initialization
 // ================================================================================
 
-matrix_expect_t init_dense_matrix(size_t             rows,
-                                  size_t             cols,
-                                  dtype_id_t         dtype,
-                                  allocator_vtable_t alloc_v) {
+/* init_dense_matrix with the data left unwritten unless zeroed, for
+ * callers that fill every element themselves: the pages stay untouched
+ * until then, so the filling threads are the ones that fault them in. */
+static matrix_expect_t _init_dense_matrix(size_t             rows,
+                                          size_t             cols,
+                                          dtype_id_t         dtype,
+                                          allocator_vtable_t alloc_v,
+                                          bool               zeroed) {
     if (alloc_v.allocate == NULL)
         return (matrix_expect_t){ .has_value = false, .u.error = NULL_POINTER };
 
@@ -710,7 +950,7 @@ matrix_expect_t init_dense_matrix(size_t             rows,
     matrix_t* mat = (matrix_t*)mr.u.value;
 
     void_ptr_expect_t dr = alloc_v.allocate(
-        alloc_v.ctx, elems * desc->data_size, true
+        alloc_v.ctx, elems * desc->data_size, zeroed
     );
     if (!dr.has_value) {
         alloc_v.return_element(alloc_v.ctx, mat);
@@ -725,13 +965,22 @@ matrix_expect_t init_dense_matrix(size_t             rows,
     mat->alloc_v   = alloc_v;
     mat->rep.dense.data = (uint8_t*)dr.u.value;
 
-    memset(mat->rep.dense.data, 0, elems * desc->data_size);
+    if (zeroed) memset(mat->rep.dense.data, 0, elems * desc->data_size);
 
     return (matrix_expect_t){ .has_value = true, .u.value = mat };
 }
 
 // --------------------------------------------------------------------------------
 
+matrix_expect_t init_dense_matrix(size_t             rows,
+                                  size_t             cols,
+                                  dtype_id_t         dtype,
+                                  allocator_vtable_t alloc_v) {
+    return _init_dense_matrix(rows, cols, dtype, alloc_v, true);
+}
+
+// --------------------------------------------------------------------------------
+
 matrix_expect_t init_coo_matrix(size_t             rows,
                                 size_t             cols,
                                 size_t             capacity,
@@ -804,6 +1053,10 @@ matrix_expect_t init_coo_matrix(size_t             rows,
     mat->rep.coo.col_idx = (size_t*)cr.u.value;
     mat->rep.coo.values  = (uint8_t*)vr.u.value;
 
+    mat->rep.coo.index      = NULL;
+    mat->rep.coo.index_mask = 0u;
+    mat->rep.coo.duplicates = COO_DUPLICATE_LAST;
+
     return (matrix_expect_t){ .has_value = true, .u.value = mat };
 }
 
@@ -827,6 +1080,12 @@ void return_matrix(matrix_t* mat) {
         case CSC_MATRIX:
             _return_csc_matrix(mat);
             break;
+        case BSR_MATRIX:
+            _return_bsr_matrix(mat);
+            break;
+        case SELL_MATRIX:
+            _return_sell_matrix(mat);
+            break;
         default:
             break;
     }
@@ -880,6 +1139,10 @@ size_t matrix_nnz(const matrix_t* mat) {
             return mat->rep.csr.nnz;
         case CSC_MATRIX:
             return mat->rep.csc.nnz;
+        case BSR_MATRIX:
+            return mat->rep.bsr.nnzb * mat->rep.bsr.block_rows * mat->rep.bsr.block_cols;
+        case SELL_MATRIX:
+            return mat->rep.sell.nnz;
         default:
             return 0u;
     }
@@ -910,6 +1173,12 @@ error_code_t get_matrix(const matrix_t* mat,
         case CSC_MATRIX:
             return _get_csc_matrix(mat, row, col, out);
 
+        case BSR_MATRIX:
+            return _get_bsr_matrix(mat, row, col, out);
+
+        case SELL_MATRIX:
+            return _get_sell_matrix(mat, row, col, out);
+
         default:
             return ILLEGAL_STATE;
     }
@@ -929,6 +1198,8 @@ error_code_t set_matrix(matrix_t*    mat,
             return _push_back_coo_matrix(mat, row, col, value);
         case CSR_MATRIX:
         case CSC_MATRIX:
+        case BSR_MATRIX:
+        case SELL_MATRIX:
             return ILLEGAL_STATE;
         default:
             return ILLEGAL_STATE;
@@ -958,70 +1229,368 @@ error_code_t sort_coo_matrix(matrix_t* mat) {
     return _sort_coo_matrix(mat);
 }
 
-// ================================================================================
-// Internal helpers (local to this file)
-// ================================================================================
+// --------------------------------------------------------------------------------
 
-static matrix_expect_t _copy_dense_matrix(const matrix_t* src,
-                                          allocator_vtable_t alloc_v) {
-    matrix_expect_t r = init_dense_matrix(src->rows, src->cols, src->dtype, alloc_v);
-    if (!r.has_value) return r;
+error_code_t begin_coo_assembly(matrix_t* mat, coo_duplicate_t duplicates) {
+    if (mat == NULL) return NULL_POINTER;
+    if (mat->format != COO_MATRIX) return ILLEGAL_STATE;
 
-    memcpy(r.u.value->rep.dense.data,
-           src->rep.dense.data,
-           src->rows * src->cols * src->data_size);
+    if (duplicates != COO_DUPLICATE_LAST && duplicates != COO_DUPLICATE_FIRST &&
+        duplicates != COO_DUPLICATE_SUM) {
+        return INVALID_ARG;
+    }
+    if (duplicates == COO_DUPLICATE_SUM && !_is_summable_dtype(mat->dtype))
+        return TYPE_MISMATCH;
 
-    return r;
+    coo_matrix_t* coo = &mat->rep.coo;
+    coo->duplicates = duplicates;
+    if (coo->index != NULL) return NO_ERROR;
+
+    /* At most half full, like every later resize */
+    size_t slots = 16u;
+    while (slots < 2u * coo->nnz) slots <<= 1u;
+
+    error_code_t err = _coo_index_resize(mat, slots);
+    if (err != NO_ERROR) coo->duplicates = COO_DUPLICATE_LAST;
+    return err;
 }
 
 // --------------------------------------------------------------------------------
 
-static matrix_expect_t _copy_coo_matrix(const matrix_t* src,
-                                        allocator_vtable_t alloc_v) {
-    const coo_matrix_t* s = &src->rep.coo;
+error_code_t finalize_coo_assembly(matrix_t* mat) {
+    if (mat == NULL) return NULL_POINTER;
+    if (mat->format != COO_MATRIX || mat->rep.coo.index == NULL)
+        return ILLEGAL_STATE;
 
-    matrix_expect_t r = init_coo_matrix(src->rows, src->cols,
-                                        s->cap, src->dtype, s->growth, alloc_v);
-    if (!r.has_value) return r;
+    _coo_index_release(mat);
+    return _sort_coo_matrix(mat);
+}
 
-    matrix_t* d = r.u.value;
-    coo_matrix_t* dc = &d->rep.coo;
+// ================================================================================
+// Thread helpers
+// ================================================================================
 
-    dc->nnz = s->nnz;
-    dc->sorted = s->sorted;
+/* Threads never exceed this, and each must get at least the given amount
+ * of work (multiply-adds) before another one is worth spawning. */
+#define MATRIX_MAX_THREADS   64u
+#define MATRIX_MIN_WORK      32768u
+
+/* Threads to use for work multiply-adds: the request (0 = online
+ * processors), capped so every thread gets at least MATRIX_MIN_WORK. */
+static size_t _matrix_thread_count(size_t requested, size_t work) {
+    if (requested == 0u) {
+        long const online = sysconf(_SC_NPROCESSORS_ONLN);
+        requested = (online > 0) ? (size_t)online : 1u;
+    }
+    size_t const useful = work / MATRIX_MIN_WORK;
+    if (requested > useful)             requested = useful;
+    if (requested > MATRIX_MAX_THREADS) requested = MATRIX_MAX_THREADS;
+    return (requested == 0u) ? 1u : requested;
+}
 
-    memcpy(dc->row_idx, s->row_idx, s->nnz * sizeof(size_t));
-    memcpy(dc->col_idx, s->col_idx, s->nnz * sizeof(size_t));
-    memcpy(dc->values,  s->values,  s->nnz * src->data_size);
+// --------------------------------------------------------------------------------
 
-    return r;
-}
-// -------------------------------------------------------------------------------- 
+/* Run fn on each of the count task records of task_size bytes at tasks, one
+ * thread each, and wait for all of them.  The calling thread runs task 0;
+ * a task whose thread cannot be created runs inline after the others. */
+static void _matrix_parallel(void* tasks, size_t task_size, size_t count,
+                             void* (*fn)(void*)) {
+    pthread_t tid[MATRIX_MAX_THREADS];
+    bool      spawned[MATRIX_MAX_THREADS] = { false };
+    uint8_t*  task = (uint8_t*)tasks;
 
-static matrix_expect_t _copy_csr_matrix(const matrix_t* src,
-                                        allocator_vtable_t alloc_v) {
-    matrix_t* dst = NULL;
-    size_t row_ptr_bytes = 0u;
-    size_t col_idx_bytes = 0u;
-    size_t values_bytes = 0u;
+    for (size_t i = 1u; i < count; i++)
+        spawned[i] = pthread_create(&tid[i], NULL, fn, task + i * task_size) == 0;
 
-    void_ptr_expect_t mr;
-    void_ptr_expect_t row_ptr_r;
-    void_ptr_expect_t col_idx_r;
-    void_ptr_expect_t values_r;
+    fn(task);
 
-    if (src == NULL) {
-        return (matrix_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    for (size_t i = 1u; i < count; i++) {
+        if (spawned[i]) pthread_join(tid[i], NULL);
+        else            fn(task + i * task_size);
     }
+}
 
-    mr = alloc_v.allocate(alloc_v.ctx, sizeof(matrix_t), true);
-    if (!mr.has_value) {
-        return (matrix_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
-    }
+// --------------------------------------------------------------------------------
 
-    dst = (matrix_t*)mr.u.value;
+/* First of n rows owned by part r of parts when the rows are split so each
+ * part holds about the same number of stored entries, ptr being a CSR row
+ * (or CSC column) pointer array of length n + 1. */
+static size_t _nnz_split(const size_t* ptr, size_t n, size_t parts, size_t r) {
+    if (r == 0u)     return 0u;
+    if (r >= parts)  return n;
 
-    dst->rows = src->rows;
+    /* total * r / parts without overflowing the product */
+    size_t const total  = ptr[n];
+    size_t const target = (total / parts) * r + ((total % parts) * r) / parts;
+
+    /* First row whose start reaches the target */
+    size_t lo = 0u, hi = n;
+    while (lo < hi) {
+        size_t const mid = lo + (hi - lo) / 2u;
+        if (ptr[mid] < target) lo = mid + 1u;
+        else                   hi = mid;
+    }
+    return lo;
+}
+
+// --------------------------------------------------------------------------------
+
+/* First of n items owned by part r of parts, sizes differing by at most
+ * one; align rounds every interior boundary down to a multiple. */
+static size_t _even_split(size_t n, size_t parts, size_t r, size_t align) {
+    if (r >= parts) return n;
+    size_t const base = n / parts;
+    size_t const rem  = n % parts;
+    size_t const at   = r * base + (r < rem ? r : rem);
+    return at - at % align;
+}
+
+// ================================================================================
+// Internal helpers (local to this file)
+// ================================================================================
+
+/* Wrap ptr, a zero-based line pointer array for the given format and
+ * shape, into a new matrix with zeroed index and value arrays of ptr[lines]
+ * entries.  ptr is owned by the result, or returned on failure. */
+static matrix_expect_t _alloc_compressed_matrix(matrix_format_t    format,
+                                                size_t             rows,
+                                                size_t             cols,
+                                                dtype_id_t         dtype,
+                                                size_t             data_size,
+                                                size_t*            ptr,
+                                                allocator_vtable_t alloc_v) {
+    size_t const lines = (format == CSR_MATRIX) ? rows : cols;
+    size_t const nnz   = ptr[lines];
+
+    void_ptr_expect_t mr    = alloc_v.allocate(alloc_v.ctx, sizeof(matrix_t), true);
+    void_ptr_expect_t idx_r = alloc_v.allocate(alloc_v.ctx,
+                                               (nnz > 0u) ? nnz * sizeof(size_t) : 1u,
+                                               false);
+    void_ptr_expect_t val_r = alloc_v.allocate(alloc_v.ctx,
+                                               (nnz > 0u) ? nnz * data_size : 1u,
+                                               true);
+
+    if (!mr.has_value || !idx_r.has_value || !val_r.has_value) {
+        if (mr.has_value)    alloc_v.return_element(alloc_v.ctx, mr.u.value);
+        if (idx_r.has_value) alloc_v.return_element(alloc_v.ctx, idx_r.u.value);
+        if (val_r.has_value) alloc_v.return_element(alloc_v.ctx, val_r.u.value);
+        alloc_v.return_element(alloc_v.ctx, ptr);
+        return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
+    }
+
+    matrix_t* dst  = (matrix_t*)mr.u.value;
+    dst->rows      = rows;
+    dst->cols      = cols;
+    dst->dtype     = dtype;
+    dst->data_size = data_size;
+    dst->format    = format;
+    dst->alloc_v   = alloc_v;
+
+    if (format == CSR_MATRIX) {
+        dst->rep.csr.nnz     = nnz;
+        dst->rep.csr.row_ptr = ptr;
+        dst->rep.csr.col_idx = (size_t*)idx_r.u.value;
+        dst->rep.csr.values  = (uint8_t*)val_r.u.value;
+    } else {
+        dst->rep.csc.nnz     = nnz;
+        dst->rep.csc.col_ptr = ptr;
+        dst->rep.csc.row_idx = (size_t*)idx_r.u.value;
+        dst->rep.csc.values  = (uint8_t*)val_r.u.value;
+    }
+    return (matrix_expect_t){ .has_value = true, .u.value = dst };
+}
+
+// --------------------------------------------------------------------------------
+
+/* Turn per-line counts stored at ptr[1..lines] into line offsets */
+static void _counts_to_offsets(size_t* ptr, size_t lines) {
+    ptr[0] = 0u;
+    for (size_t i = 0u; i < lines; i++) ptr[i + 1u] += ptr[i];
+}
+
+// --------------------------------------------------------------------------------
+
+static int _compare_index(const void* a, const void* b) {
+    size_t const x = *(const size_t*)a;
+    size_t const y = *(const size_t*)b;
+    return (x > y) - (x < y);
+}
+
+// --------------------------------------------------------------------------------
+
+/* Wrap block_ptr, the zero-based block row pointers of a BSR matrix with
+ * like's shape and dtype, into a new matrix with zeroed block column and
+ * value arrays.  block_ptr is owned by the result, or returned on failure. */
+static matrix_expect_t _alloc_bsr_matrix(const matrix_t*    like,
+                                         size_t             block_rows,
+                                         size_t             block_cols,
+                                         size_t*            block_ptr,
+                                         allocator_vtable_t alloc_v) {
+    size_t const nbr  = (like->rows + block_rows - 1u) / block_rows;
+    size_t const nnzb = block_ptr[nbr];
+    size_t const bs   = block_rows * block_cols;
+
+    if (like->data_size != 0u && nnzb > SIZE_MAX / bs / like->data_size) {
+        alloc_v.return_element(alloc_v.ctx, block_ptr);
+        return (matrix_expect_t){ .has_value = false, .u.error = LENGTH_OVERFLOW };
+    }
+
+    void_ptr_expect_t mr = alloc_v.allocate(alloc_v.ctx, sizeof(matrix_t), true);
+    if (!mr.has_value) {
+        alloc_v.return_element(alloc_v.ctx, block_ptr);
+        return (matrix_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+
+    matrix_t* dst  = (matrix_t*)mr.u.value;
+    dst->rows      = like->rows;
+    dst->cols      = like->cols;
+    dst->dtype     = like->dtype;
+    dst->data_size = like->data_size;
+    dst->format    = BSR_MATRIX;
+    dst->alloc_v   = alloc_v;
+    dst->rep.bsr   = (bsr_matrix_t){ .block_rows = block_rows,
+                                     .block_cols = block_cols,
+                                     .nnzb       = nnzb,
+                                     .block_ptr  = block_ptr };
+
+    void_ptr_expect_t cr = alloc_v.allocate(alloc_v.ctx,
+                                            (nnzb > 0u) ? nnzb * sizeof(size_t) : 1u,
+                                            true);
+    void_ptr_expect_t vr = alloc_v.allocate(alloc_v.ctx,
+                                            (nnzb > 0u) ? nnzb * bs * like->data_size : 1u,
+                                            true);
+    if (cr.has_value) dst->rep.bsr.block_col = (size_t*)cr.u.value;
+    if (vr.has_value) dst->rep.bsr.values    = (uint8_t*)vr.u.value;
+
+    if (!cr.has_value || !vr.has_value) {
+        return_matrix(dst);
+        return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
+    }
+    return (matrix_expect_t){ .has_value = true, .u.value = dst };
+}
+
+// --------------------------------------------------------------------------------
+
+/* Wrap slice_ptr, the zero-based slice offsets of a SELL matrix with like's
+ * shape and dtype, into a new matrix with unset row arrays and zeroed
+ * column and value arrays.  slice_ptr is owned by the result, or returned
+ * on failure. */
+static matrix_expect_t _alloc_sell_matrix(const matrix_t*    like,
+                                          size_t             chunk,
+                                          size_t             sigma,
+                                          size_t*            slice_ptr,
+                                          allocator_vtable_t alloc_v) {
+    size_t const slices = (like->rows + chunk - 1u) / chunk;
+    size_t const total  = slice_ptr[slices];
+
+    if (like->data_size != 0u && total > SIZE_MAX / like->data_size) {
+        alloc_v.return_element(alloc_v.ctx, slice_ptr);
+        return (matrix_expect_t){ .has_value = false, .u.error = LENGTH_OVERFLOW };
+    }
+
+    void_ptr_expect_t mr = alloc_v.allocate(alloc_v.ctx, sizeof(matrix_t), true);
+    if (!mr.has_value) {
+        alloc_v.return_element(alloc_v.ctx, slice_ptr);
+        return (matrix_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+
+    matrix_t* dst  = (matrix_t*)mr.u.value;
+    dst->rows      = like->rows;
+    dst->cols      = like->cols;
+    dst->dtype     = like->dtype;
+    dst->data_size = like->data_size;
+    dst->format    = SELL_MATRIX;
+    dst->alloc_v   = alloc_v;
+    dst->rep.sell  = (sell_matrix_t){ .chunk     = chunk,
+                                      .sigma     = sigma,
+                                      .slice_ptr = slice_ptr };
+
+    size_t const row_bytes = like->rows * sizeof(size_t);
+    void_ptr_expect_t pr = alloc_v.allocate(alloc_v.ctx, row_bytes, false);
+    void_ptr_expect_t sr = alloc_v.allocate(alloc_v.ctx, row_bytes, false);
+    void_ptr_expect_t lr = alloc_v.allocate(alloc_v.ctx, row_bytes, false);
+    void_ptr_expect_t cr = alloc_v.allocate(alloc_v.ctx,
+                                            (total > 0u) ? total * sizeof(size_t) : 1u,
+                                            true);
+    void_ptr_expect_t vr = alloc_v.allocate(alloc_v.ctx,
+                                            (total > 0u) ? total * like->data_size : 1u,
+                                            true);
+    if (pr.has_value) dst->rep.sell.row_perm = (size_t*)pr.u.value;
+    if (sr.has_value) dst->rep.sell.row_slot = (size_t*)sr.u.value;
+    if (lr.has_value) dst->rep.sell.row_len  = (size_t*)lr.u.value;
+    if (cr.has_value) dst->rep.sell.col_idx  = (size_t*)cr.u.value;
+    if (vr.has_value) dst->rep.sell.values   = (uint8_t*)vr.u.value;
+
+    if (!pr.has_value || !sr.has_value || !lr.has_value ||
+        !cr.has_value || !vr.has_value) {
+        return_matrix(dst);
+        return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
+    }
+    return (matrix_expect_t){ .has_value = true, .u.value = dst };
+}
+
+// --------------------------------------------------------------------------------
+
+static matrix_expect_t _copy_dense_matrix(const matrix_t* src,
+                                          allocator_vtable_t alloc_v) {
+    matrix_expect_t r = init_dense_matrix(src->rows, src->cols, src->dtype, alloc_v);
+    if (!r.has_value) return r;
+
+    memcpy(r.u.value->rep.dense.data,
+           src->rep.dense.data,
+           src->rows * src->cols * src->data_size);
+
+    return r;
+}
+
+// --------------------------------------------------------------------------------
+
+static matrix_expect_t _copy_coo_matrix(const matrix_t* src,
+                                        allocator_vtable_t alloc_v) {
+    const coo_matrix_t* s = &src->rep.coo;
+
+    matrix_expect_t r = init_coo_matrix(src->rows, src->cols,
+                                        s->cap, src->dtype, s->growth, alloc_v);
+    if (!r.has_value) return r;
+
+    matrix_t* d = r.u.value;
+    coo_matrix_t* dc = &d->rep.coo;
+
+    dc->nnz = s->nnz;
+    dc->sorted = s->sorted;
+
+    memcpy(dc->row_idx, s->row_idx, s->nnz * sizeof(size_t));
+    memcpy(dc->col_idx, s->col_idx, s->nnz * sizeof(size_t));
+    memcpy(dc->values,  s->values,  s->nnz * src->data_size);
+
+    return r;
+}
+// -------------------------------------------------------------------------------- 
+
+static matrix_expect_t _copy_csr_matrix(const matrix_t* src,
+                                        allocator_vtable_t alloc_v) {
+    matrix_t* dst = NULL;
+    size_t row_ptr_bytes = 0u;
+    size_t col_idx_bytes = 0u;
+    size_t values_bytes = 0u;
+
+    void_ptr_expect_t mr;
+    void_ptr_expect_t row_ptr_r;
+    void_ptr_expect_t col_idx_r;
+    void_ptr_expect_t values_r;
+
+    if (src == NULL) {
+        return (matrix_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    }
+
+    mr = alloc_v.allocate(alloc_v.ctx, sizeof(matrix_t), true);
+    if (!mr.has_value) {
+        return (matrix_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+
+    dst = (matrix_t*)mr.u.value;
+
+    dst->rows = src->rows;
     dst->cols = src->cols;
     dst->dtype = src->dtype;
     dst->data_size = src->data_size;
@@ -1148,6 +1717,56 @@ static matrix_expect_t _copy_csc_matrix(const matrix_t* src,
 
     return (matrix_expect_t){ .has_value = true, .u.value = dst };
 }
+
+// --------------------------------------------------------------------------------
+
+static matrix_expect_t _copy_bsr_matrix(const matrix_t* src,
+                                        allocator_vtable_t alloc_v) {
+    const bsr_matrix_t* b = &src->rep.bsr;
+    size_t const nbr = (src->rows + b->block_rows - 1u) / b->block_rows;
+
+    void_ptr_expect_t pr = alloc_v.allocate(alloc_v.ctx, (nbr + 1u) * sizeof(size_t), false);
+    if (!pr.has_value)
+        return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
+    memcpy(pr.u.value, b->block_ptr, (nbr + 1u) * sizeof(size_t));
+
+    matrix_expect_t r = _alloc_bsr_matrix(src, b->block_rows, b->block_cols,
+                                          (size_t*)pr.u.value, alloc_v);
+    if (!r.has_value) return r;
+
+    memcpy(r.u.value->rep.bsr.block_col, b->block_col, b->nnzb * sizeof(size_t));
+    memcpy(r.u.value->rep.bsr.values, b->values,
+           b->nnzb * b->block_rows * b->block_cols * src->data_size);
+    return r;
+}
+
+// --------------------------------------------------------------------------------
+
+static matrix_expect_t _copy_sell_matrix(const matrix_t* src,
+                                         allocator_vtable_t alloc_v) {
+    const sell_matrix_t* s = &src->rep.sell;
+    size_t const slices = (src->rows + s->chunk - 1u) / s->chunk;
+    size_t const total  = s->slice_ptr[slices];
+    size_t const rbytes = src->rows * sizeof(size_t);
+
+    void_ptr_expect_t pr = alloc_v.allocate(alloc_v.ctx, (slices + 1u) * sizeof(size_t), false);
+    if (!pr.has_value)
+        return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
+    memcpy(pr.u.value, s->slice_ptr, (slices + 1u) * sizeof(size_t));
+
+    matrix_expect_t r = _alloc_sell_matrix(src, s->chunk, s->sigma,
+                                           (size_t*)pr.u.value, alloc_v);
+    if (!r.has_value) return r;
+
+    sell_matrix_t* d = &r.u.value->rep.sell;
+    d->nnz = s->nnz;
+    memcpy(d->row_perm, s->row_perm, rbytes);
+    memcpy(d->row_slot, s->row_slot, rbytes);
+    memcpy(d->row_len,  s->row_len,  rbytes);
+    memcpy(d->col_idx,  s->col_idx,  total * sizeof(size_t));
+    memcpy(d->values,   s->values,   total * src->data_size);
+    return r;
+}
 // ================================================================================ 
 // ================================================================================ 
 
@@ -1221,95 +1840,96 @@ static matrix_expect_t _coo_to_dense_matrix(const matrix_t* src,
 
 // --------------------------------------------------------------------------------
 
-static matrix_expect_t _dense_to_csr_matrix_ex(const matrix_t* src,
-                                               allocator_vtable_t alloc_v,
-                                               matrix_zero_fn is_zero) {
-    matrix_t* dst = NULL;
-    size_t i = 0u;
-    size_t j = 0u;
-    size_t k = 0u;
-    size_t nnz = 0u;
-    const uint8_t* ptr = NULL;
+/* Dense -> CSR runs in two row-parallel passes over [lo, hi): count the
+ * nonzeros of each row into ptr[i + 1], then, once ptr holds offsets,
+ * copy them out. */
+typedef struct {
+    const matrix_t* src;
+    matrix_zero_fn  is_zero;
+    size_t*         ptr;
+    size_t*         col_idx;
+    uint8_t*        values;
+    size_t          lo;
+    size_t          hi;
+} _dense_to_csr_task_t;
 
-    /* Pass 1: count nonzeros */
-    for (i = 0u; i < src->rows; ++i) {
-        for (j = 0u; j < src->cols; ++j) {
-            ptr = src->rep.dense.data + _dense_offset(src, i, j);
-            if (!_value_is_zero_cb(ptr, src->data_size, is_zero)) {
-                nnz++;
-            }
-        }
-    }
+// --------------------------------------------------------------------------------
 
-    /* Allocate matrix_t header */
-    void_ptr_expect_t mr = alloc_v.allocate(alloc_v.ctx, sizeof(matrix_t), true);
-    if (!mr.has_value) {
-        return (matrix_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
-    }
+static void* _dense_to_csr_count_task(void* arg) {
+    _dense_to_csr_task_t* t   = (_dense_to_csr_task_t*)arg;
+    const matrix_t*       src = t->src;
 
-    dst = (matrix_t*)mr.u.value;
+    for (size_t i = t->lo; i < t->hi; ++i) {
+        const uint8_t* row = src->rep.dense.data + _dense_offset(src, i, 0u);
+        size_t n = 0u;
+        for (size_t j = 0u; j < src->cols; ++j)
+            n += !_value_is_zero_cb(row + j * src->data_size, src->data_size, t->is_zero);
+        t->ptr[i + 1u] = n;
+    }
+    return NULL;
+}
 
-    dst->rows      = src->rows;
-    dst->cols      = src->cols;
-    dst->dtype     = src->dtype;
-    dst->data_size = src->data_size;
-    dst->format    = CSR_MATRIX;
-    dst->alloc_v   = alloc_v;
+// --------------------------------------------------------------------------------
 
-    dst->rep.csr.nnz     = 0u;
-    dst->rep.csr.row_ptr = NULL;
-    dst->rep.csr.col_idx = NULL;
-    dst->rep.csr.values  = NULL;
+static void* _dense_to_csr_fill_task(void* arg) {
+    _dense_to_csr_task_t* t   = (_dense_to_csr_task_t*)arg;
+    const matrix_t*       src = t->src;
+    size_t const          ds  = src->data_size;
 
-    /* Allocate CSR arrays — guard against zero-size allocations */
-    size_t row_ptr_bytes = (src->rows + 1u) * sizeof(size_t);
-    size_t col_idx_bytes = nnz * sizeof(size_t);
-    size_t values_bytes  = nnz * src->data_size;
+    for (size_t i = t->lo; i < t->hi; ++i) {
+        const uint8_t* row = src->rep.dense.data + _dense_offset(src, i, 0u);
+        size_t k = t->ptr[i];
+        for (size_t j = 0u; j < src->cols; ++j) {
+            if (!_value_is_zero_cb(row + j * ds, ds, t->is_zero)) {
+                t->col_idx[k] = j;
+                memcpy(t->values + k * ds, row + j * ds, ds);
+                k++;
+            }
+        }
+    }
+    return NULL;
+}
 
-    void_ptr_expect_t row_ptr_r = alloc_v.allocate(alloc_v.ctx,
-                                                   row_ptr_bytes,
-                                                   true);
-    void_ptr_expect_t col_idx_r = alloc_v.allocate(alloc_v.ctx,
-                                                   (nnz > 0u) ? col_idx_bytes : 1u,
-                                                   true);
-    void_ptr_expect_t values_r  = alloc_v.allocate(alloc_v.ctx,
-                                                   (nnz > 0u) ? values_bytes : 1u,
-                                                   true);
+// --------------------------------------------------------------------------------
 
-    if (!row_ptr_r.has_value || !col_idx_r.has_value || !values_r.has_value) {
-        if (row_ptr_r.has_value) alloc_v.return_element(alloc_v.ctx, row_ptr_r.u.value);
-        if (col_idx_r.has_value) alloc_v.return_element(alloc_v.ctx, col_idx_r.u.value);
-        if (values_r.has_value)  alloc_v.return_element(alloc_v.ctx, values_r.u.value);
-        alloc_v.return_element(alloc_v.ctx, dst);
+static matrix_expect_t _dense_to_csr_matrix_ex(const matrix_t* src,
+                                               allocator_vtable_t alloc_v,
+                                               matrix_zero_fn is_zero) {
+    void_ptr_expect_t pr = alloc_v.allocate(alloc_v.ctx,
+                                            (src->rows + 1u) * sizeof(size_t),
+                                            true);
+    if (!pr.has_value) {
         return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
     }
+    size_t* ptr = (size_t*)pr.u.value;
 
-    size_t*  row_ptr = (size_t*)row_ptr_r.u.value;
-    size_t*  col_idx = (size_t*)col_idx_r.u.value;
-    uint8_t* values  = (uint8_t*)values_r.u.value;
+    _dense_to_csr_task_t tasks[MATRIX_MAX_THREADS];
+    size_t const parts = _matrix_thread_count(0u, src->rows * src->cols);
+    for (size_t r = 0u; r < parts; ++r) {
+        tasks[r] = (_dense_to_csr_task_t){
+            .src = src, .is_zero = is_zero, .ptr = ptr,
+            .lo  = _even_split(src->rows, parts, r, 1u),
+            .hi  = _even_split(src->rows, parts, r + 1u, 1u)
+        };
+    }
 
-    /* Pass 2: scatter nonzeros into CSR arrays */
-    row_ptr[0] = 0u;
-    k = 0u;
+    /* Pass 1: count nonzeros per row, then turn the counts into row_ptr */
+    _matrix_parallel(tasks, sizeof(tasks[0]), parts, _dense_to_csr_count_task);
+    _counts_to_offsets(ptr, src->rows);
 
-    for (i = 0u; i < src->rows; ++i) {
-        for (j = 0u; j < src->cols; ++j) {
-            ptr = src->rep.dense.data + _dense_offset(src, i, j);
-            if (!_value_is_zero_cb(ptr, src->data_size, is_zero)) {
-                col_idx[k] = j;
-                memcpy(values + (k * src->data_size), ptr, src->data_size);
-                k++;
-            }
-        }
-        row_ptr[i + 1u] = k;
-    }
+    matrix_expect_t out = _alloc_compressed_matrix(CSR_MATRIX, src->rows, src->cols,
+                                                   src->dtype, src->data_size,
+                                                   ptr, alloc_v);
+    if (!out.has_value) return out;
 
-    dst->rep.csr.nnz     = nnz;
-    dst->rep.csr.row_ptr = row_ptr;
-    dst->rep.csr.col_idx = col_idx;
-    dst->rep.csr.values  = values;
+    /* Pass 2: scatter nonzeros into CSR arrays */
+    for (size_t r = 0u; r < parts; ++r) {
+        tasks[r].col_idx = out.u.value->rep.csr.col_idx;
+        tasks[r].values  = out.u.value->rep.csr.values;
+    }
+    _matrix_parallel(tasks, sizeof(tasks[0]), parts, _dense_to_csr_fill_task);
 
-    return (matrix_expect_t){ .has_value = true, .u.value = dst };
+    return out;
 }
 
 // --------------------------------------------------------------------------------
@@ -1399,46 +2019,249 @@ static matrix_expect_t _dense_to_csc_matrix_ex(const matrix_t* src,
 
 // --------------------------------------------------------------------------------
 
-static matrix_expect_t _coo_to_csr_matrix(const matrix_t* src,
-                                          allocator_vtable_t alloc_v) {
-    matrix_expect_t tmp;
-    matrix_expect_t out;
+/* One thread's share of a stable counting-sort pass over COO entries.
+ * Positions [lo, hi) of the input order (in, or 0..n when NULL) are
+ * histogrammed by key into hist, which the caller then turns into this
+ * part's write cursors for the scatter. */
+typedef struct {
+    const size_t* key;
+    const size_t* in;
+    size_t*       out;
+    size_t*       hist;
+    size_t        lo;
+    size_t        hi;
+} _coo_sort_task_t;
 
-    tmp = _coo_to_dense_matrix(src, alloc_v);
-    if (!tmp.has_value) return tmp;
+// --------------------------------------------------------------------------------
 
-    out = _dense_to_csr_matrix_ex(tmp.u.value, alloc_v, NULL);
-    return_matrix(tmp.u.value);
-    return out;
+static void* _coo_histogram_task(void* arg) {
+    _coo_sort_task_t* t = (_coo_sort_task_t*)arg;
+    for (size_t p = t->lo; p < t->hi; ++p) {
+        size_t const e = (t->in != NULL) ? t->in[p] : p;
+        t->hist[t->key[e]]++;
+    }
+    return NULL;
 }
 
 // --------------------------------------------------------------------------------
 
-static matrix_expect_t _coo_to_csc_matrix(const matrix_t* src,
-                                          allocator_vtable_t alloc_v) {
-    matrix_expect_t tmp;
-    matrix_expect_t out;
+static void* _coo_scatter_task(void* arg) {
+    _coo_sort_task_t* t = (_coo_sort_task_t*)arg;
+    for (size_t p = t->lo; p < t->hi; ++p) {
+        size_t const e = (t->in != NULL) ? t->in[p] : p;
+        t->out[t->hist[t->key[e]]++] = e;
+    }
+    return NULL;
+}
 
-    tmp = _coo_to_dense_matrix(src, alloc_v);
-    if (!tmp.has_value) return tmp;
+// --------------------------------------------------------------------------------
 
-    out = _dense_to_csc_matrix_ex(tmp.u.value, alloc_v, NULL);
-    return_matrix(tmp.u.value);
-    return out;
+/* Stable counting sort of n entry numbers by key (values below range) into
+ * out.  Each part owns a contiguous slice of the input and range counters
+ * in hist; assigning cursors key-major, part-minor keeps equal keys in
+ * input order.  starts, if not NULL, receives the range + 1 key offsets. */
+static void _coo_counting_pass(_coo_sort_task_t* tasks, size_t parts,
+                               const size_t* key, const size_t* in,
+                               size_t* out, size_t n, size_t range,
+                               size_t* hist, size_t* starts) {
+    memset(hist, 0, parts * range * sizeof(size_t));
+    for (size_t r = 0u; r < parts; ++r) {
+        tasks[r] = (_coo_sort_task_t){
+            .key = key, .in = in, .out = out, .hist = hist + r * range,
+            .lo  = _even_split(n, parts, r, 1u),
+            .hi  = _even_split(n, parts, r + 1u, 1u)
+        };
+    }
+    _matrix_parallel(tasks, sizeof(tasks[0]), parts, _coo_histogram_task);
+
+    size_t run = 0u;
+    for (size_t k = 0u; k < range; ++k) {
+        if (starts != NULL) starts[k] = run;
+        for (size_t r = 0u; r < parts; ++r) {
+            size_t const c = hist[r * range + k];
+            hist[r * range + k] = run;
+            run += c;
+        }
+    }
+    if (starts != NULL) starts[range] = run;
+
+    _matrix_parallel(tasks, sizeof(tasks[0]), parts, _coo_scatter_task);
 }
 
 // --------------------------------------------------------------------------------
 
-static matrix_expect_t _csr_to_dense_matrix(const matrix_t* src,
-                                            allocator_vtable_t alloc_v) {
-    matrix_expect_t r;
-    matrix_t* dst = NULL;
-    size_t i = 0u;
-    size_t k = 0u;
-    size_t j = 0u;
+/* One thread's share of compressing sorted COO entries: major lines
+ * [lo, hi) of order, whose line l spans order[starts[l], starts[l + 1]).
+ * Without out_idx each line's surviving entry count goes to ptr[l + 1];
+ * with it the entries are written at ptr[l]. */
+typedef struct {
+    const matrix_t* src;
+    const size_t*   minor;
+    const size_t*   order;
+    const size_t*   starts;
+    size_t*         ptr;
+    size_t*         out_idx;
+    uint8_t*        out_val;
+    coo_duplicate_t duplicates;
+    matrix_zero_fn  is_zero;
+    size_t          lo;
+    size_t          hi;
+} _coo_compress_task_t;
 
-    r = init_dense_matrix(src->rows, src->cols, src->dtype, alloc_v);
-    if (!r.has_value) return r;
+// --------------------------------------------------------------------------------
+
+static void* _coo_compress_task(void* arg) {
+    _coo_compress_task_t* t  = (_coo_compress_task_t*)arg;
+    size_t const          ds = t->src->data_size;
+    const uint8_t*        vals = t->src->rep.coo.values;
+
+    /* Large enough and aligned for any summable dtype */
+    union { long double ld; uint64_t u; uint8_t b[sizeof(long double)]; } sum;
+
+    for (size_t l = t->lo; l < t->hi; ++l) {
+        size_t k = (t->out_idx != NULL) ? t->ptr[l] : 0u;
+        size_t p = t->starts[l];
+        size_t const end = t->starts[l + 1u];
+
+        while (p < end) {
+            size_t const   j   = t->minor[t->order[p]];
+            size_t         q   = p + 1u;
+            const uint8_t* val = vals + t->order[p] * ds;
+
+            while (q < end && t->minor[t->order[q]] == j) q++;
+
+            /* Entries p..q-1 share (line, j), in insertion order */
+            if (t->duplicates == COO_DUPLICATE_LAST) {
+                val = vals + t->order[q - 1u] * ds;
+            } else if (t->duplicates == COO_DUPLICATE_SUM && q - p > 1u) {
+                memcpy(sum.b, val, ds);
+                for (size_t d = p + 1u; d < q; ++d)
+                    _accumulate_value(sum.b, vals + t->order[d] * ds, t->src->dtype);
+                val = sum.b;
+            }
+
+            if (!_value_is_zero_cb(val, ds, t->is_zero)) {
+                if (t->out_idx != NULL) {
+                    t->out_idx[k] = j;
+                    memcpy(t->out_val + k * ds, val, ds);
+                }
+                k++;
+            }
+            p = q;
+        }
+        if (t->out_idx == NULL) t->ptr[l + 1u] = k;
+    }
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+/* COO -> CSR / CSC without a comparison sort: a stable counting sort by
+ * the minor index, then one by the major index, leaves the entries
+ * ordered by (major, minor) with duplicates in insertion order.  Each
+ * line is then compressed twice, once to count and once to fill, after
+ * resolving duplicates and dropping zeros. */
+static matrix_expect_t _coo_to_compressed_matrix(const matrix_t*    src,
+                                                 matrix_format_t    target,
+                                                 coo_duplicate_t    duplicates,
+                                                 matrix_zero_fn     is_zero,
+                                                 size_t             num_threads,
+                                                 allocator_vtable_t alloc_v) {
+    const coo_matrix_t* coo   = &src->rep.coo;
+    bool const          csr   = target == CSR_MATRIX;
+    size_t const        n     = coo->nnz;
+    size_t const        lines = csr ? src->rows : src->cols;
+    size_t const        width = csr ? src->cols : src->rows;
+    const size_t*       major = csr ? coo->row_idx : coo->col_idx;
+    const size_t*       minor = csr ? coo->col_idx : coo->row_idx;
+
+    /* Each part keeps a counter per key, so only split the entries while
+     * that stays small next to the entries themselves */
+    size_t const range = (lines > width) ? lines : width;
+    size_t parts = _matrix_thread_count(num_threads, n);
+    if (parts > n / range) parts = (n / range > 0u) ? n / range : 1u;
+
+    void_ptr_expect_t pr = alloc_v.allocate(alloc_v.ctx, (lines + 1u) * sizeof(size_t), true);
+    if (!pr.has_value) {
+        return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
+    }
+    size_t* ptr = (size_t*)pr.u.value;
+
+    /* Scratch: two entry orders, the per-part histograms, line starts */
+    size_t const scratch_len = 2u * n + parts * range + lines + 1u;
+    void_ptr_expect_t sr = alloc_v.allocate(alloc_v.ctx, scratch_len * sizeof(size_t), false);
+    if (!sr.has_value) {
+        alloc_v.return_element(alloc_v.ctx, ptr);
+        return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
+    }
+    size_t* by_minor = (size_t*)sr.u.value;
+    size_t* order    = by_minor + n;
+    size_t* hist     = order + n;
+    size_t* starts   = hist + parts * range;
+
+    _coo_sort_task_t sort_tasks[MATRIX_MAX_THREADS];
+    _coo_counting_pass(sort_tasks, parts, minor, NULL, by_minor, n, width, hist, NULL);
+    _coo_counting_pass(sort_tasks, parts, major, by_minor, order, n, lines, hist, starts);
+
+    _coo_compress_task_t tasks[MATRIX_MAX_THREADS];
+    for (size_t r = 0u; r < parts; ++r) {
+        tasks[r] = (_coo_compress_task_t){
+            .src = src, .minor = minor, .order = order, .starts = starts,
+            .ptr = ptr, .duplicates = duplicates, .is_zero = is_zero,
+            .lo  = _nnz_split(starts, lines, parts, r),
+            .hi  = _nnz_split(starts, lines, parts, r + 1u)
+        };
+    }
+    _matrix_parallel(tasks, sizeof(tasks[0]), parts, _coo_compress_task);
+    _counts_to_offsets(ptr, lines);
+
+    matrix_expect_t out = _alloc_compressed_matrix(target, src->rows, src->cols,
+                                                   src->dtype, src->data_size,
+                                                   ptr, alloc_v);
+    if (out.has_value) {
+        for (size_t r = 0u; r < parts; ++r) {
+            tasks[r].out_idx = csr ? out.u.value->rep.csr.col_idx
+                                   : out.u.value->rep.csc.row_idx;
+            tasks[r].out_val = csr ? out.u.value->rep.csr.values
+                                   : out.u.value->rep.csc.values;
+        }
+        _matrix_parallel(tasks, sizeof(tasks[0]), parts, _coo_compress_task);
+    }
+
+    alloc_v.return_element(alloc_v.ctx, sr.u.value);
+    return out;
+}
+
+// --------------------------------------------------------------------------------
+
+static matrix_expect_t _coo_to_csr_matrix(const matrix_t* src,
+                                          allocator_vtable_t alloc_v,
+                                          matrix_zero_fn is_zero) {
+    return _coo_to_compressed_matrix(src, CSR_MATRIX, COO_DUPLICATE_LAST,
+                                     is_zero, 0u, alloc_v);
+}
+
+// --------------------------------------------------------------------------------
+
+static matrix_expect_t _coo_to_csc_matrix(const matrix_t* src,
+                                          allocator_vtable_t alloc_v,
+                                          matrix_zero_fn is_zero) {
+    return _coo_to_compressed_matrix(src, CSC_MATRIX, COO_DUPLICATE_LAST,
+                                     is_zero, 0u, alloc_v);
+}
+
+// --------------------------------------------------------------------------------
+
+static matrix_expect_t _csr_to_dense_matrix(const matrix_t* src,
+                                            allocator_vtable_t alloc_v) {
+    matrix_expect_t r;
+    matrix_t* dst = NULL;
+    size_t i = 0u;
+    size_t k = 0u;
+    size_t j = 0u;
+
+    r = init_dense_matrix(src->rows, src->cols, src->dtype, alloc_v);
+    if (!r.has_value) return r;
 
     dst = r.u.value;
 
@@ -1547,6 +2370,329 @@ static matrix_expect_t _csc_to_csr_matrix(const matrix_t* src,
     return out;
 }
 
+// ================================================================================
+// Blocked and sliced formats
+// ================================================================================
+
+/* Shapes used when convert_matrix() targets BSR or SELL, and the tallest
+ * SELL slice accepted (the SpMV keeps one slice's sums on the stack). */
+#define BSR_DEFAULT_BLOCK    4u
+#define SELL_DEFAULT_CHUNK   8u
+#define SELL_DEFAULT_SIGMA   256u
+#define SELL_MAX_CHUNK       64u
+
+// --------------------------------------------------------------------------------
+
+/* CSR to BSR.  A marker per block column, stamped with the current block
+ * row, counts the distinct blocks each block row touches; the second pass
+ * collects and sorts those block columns, records each one's slot and
+ * copies every entry into its block.  Blocks start zeroed, so positions
+ * without an entry, padding past the matrix edge included, read as zero. */
+static matrix_expect_t _csr_to_bsr_matrix(const matrix_t*    src,
+                                          size_t             br,
+                                          size_t             bc,
+                                          allocator_vtable_t alloc_v) {
+    const size_t* ptr = src->rep.csr.row_ptr;
+    const size_t* col = src->rep.csr.col_idx;
+    size_t const  ds  = src->data_size;
+    size_t const  nbr = (src->rows + br - 1u) / br;
+    size_t const  nbc = (src->cols + bc - 1u) / bc;
+
+    void_ptr_expect_t mr = alloc_v.allocate(alloc_v.ctx, 2u * nbc * sizeof(size_t), true);
+    void_ptr_expect_t pr = alloc_v.allocate(alloc_v.ctx, (nbr + 1u) * sizeof(size_t), true);
+    if (!mr.has_value || !pr.has_value) {
+        if (mr.has_value) alloc_v.return_element(alloc_v.ctx, mr.u.value);
+        if (pr.has_value) alloc_v.return_element(alloc_v.ctx, pr.u.value);
+        return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
+    }
+
+    size_t* mark      = (size_t*)mr.u.value;
+    size_t* slot      = mark + nbc;
+    size_t* block_ptr = (size_t*)pr.u.value;
+
+    for (size_t bi = 0u; bi < nbr; bi++) {
+        size_t const end = (src->rows - bi * br < br) ? src->rows : (bi + 1u) * br;
+        for (size_t i = bi * br; i < end; i++) {
+            for (size_t p = ptr[i]; p < ptr[i + 1u]; p++) {
+                size_t const bj = col[p] / bc;
+                if (mark[bj] != bi + 1u) {
+                    mark[bj] = bi + 1u;
+                    block_ptr[bi + 1u]++;
+                }
+            }
+        }
+    }
+    _counts_to_offsets(block_ptr, nbr);
+
+    matrix_expect_t r = _alloc_bsr_matrix(src, br, bc, block_ptr, alloc_v);
+    if (!r.has_value) {
+        alloc_v.return_element(alloc_v.ctx, mark);
+        return r;
+    }
+    bsr_matrix_t* dst = &r.u.value->rep.bsr;
+
+    memset(mark, 0, nbc * sizeof(size_t));
+    for (size_t bi = 0u; bi < nbr; bi++) {
+        size_t const end = (src->rows - bi * br < br) ? src->rows : (bi + 1u) * br;
+        size_t const b0  = block_ptr[bi];
+        size_t       n   = b0;
+
+        for (size_t i = bi * br; i < end; i++) {
+            for (size_t p = ptr[i]; p < ptr[i + 1u]; p++) {
+                size_t const bj = col[p] / bc;
+                if (mark[bj] != bi + 1u) {
+                    mark[bj] = bi + 1u;
+                    dst->block_col[n++] = bj;
+                }
+            }
+        }
+        qsort(dst->block_col + b0, n - b0, sizeof(size_t), _compare_index);
+        for (size_t k = b0; k < n; k++) slot[dst->block_col[k]] = k;
+
+        for (size_t i = bi * br; i < end; i++) {
+            for (size_t p = ptr[i]; p < ptr[i + 1u]; p++) {
+                size_t const k = slot[col[p] / bc];
+                memcpy(dst->values + ((k * br + i - bi * br) * bc + col[p] % bc) * ds,
+                       src->rep.csr.values + p * ds, ds);
+            }
+        }
+    }
+
+    alloc_v.return_element(alloc_v.ctx, mark);
+    return r;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Row i of a BSR matrix in CSR form: count its entries that are not zero,
+ * copying them to idx and val as well when idx is not NULL.  Blocks are
+ * visited in block column order, so the columns come out sorted. */
+static size_t _bsr_row_entries(const matrix_t* src,
+                               size_t          i,
+                               matrix_zero_fn  is_zero,
+                               size_t*         idx,
+                               uint8_t*        val) {
+    const bsr_matrix_t* b  = &src->rep.bsr;
+    size_t const        br = b->block_rows;
+    size_t const        bc = b->block_cols;
+    size_t const        ds = src->data_size;
+    size_t const        bi = i / br;
+    size_t              n  = 0u;
+
+    for (size_t k = b->block_ptr[bi]; k < b->block_ptr[bi + 1u]; k++) {
+        size_t const   j0 = b->block_col[k] * bc;
+        size_t const   w  = (src->cols - j0 < bc) ? src->cols - j0 : bc;
+        const uint8_t* v  = b->values + (k * br + i % br) * bc * ds;
+
+        for (size_t c = 0u; c < w; c++) {
+            if (_value_is_zero_cb(v + c * ds, ds, is_zero)) continue;
+            if (idx != NULL) {
+                idx[n] = j0 + c;
+                memcpy(val + n * ds, v + c * ds, ds);
+            }
+            n++;
+        }
+    }
+    return n;
+}
+
+// --------------------------------------------------------------------------------
+
+/* BSR to CSR.  Zeros stored inside blocks are dropped, as they would be
+ * converting a dense matrix. */
+static matrix_expect_t _bsr_to_csr_matrix(const matrix_t*    src,
+                                          allocator_vtable_t alloc_v,
+                                          matrix_zero_fn     is_zero) {
+    void_ptr_expect_t pr = alloc_v.allocate(alloc_v.ctx,
+                                            (src->rows + 1u) * sizeof(size_t), true);
+    if (!pr.has_value)
+        return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
+
+    size_t* row_ptr = (size_t*)pr.u.value;
+    for (size_t i = 0u; i < src->rows; i++)
+        row_ptr[i + 1u] = _bsr_row_entries(src, i, is_zero, NULL, NULL);
+    _counts_to_offsets(row_ptr, src->rows);
+
+    matrix_expect_t r = _alloc_compressed_matrix(CSR_MATRIX, src->rows, src->cols,
+                                                 src->dtype, src->data_size,
+                                                 row_ptr, alloc_v);
+    if (!r.has_value) return r;
+
+    csr_matrix_t* dst = &r.u.value->rep.csr;
+    for (size_t i = 0u; i < src->rows; i++)
+        _bsr_row_entries(src, i, is_zero, dst->col_idx + row_ptr[i],
+                         dst->values + row_ptr[i] * src->data_size);
+    return r;
+}
+
+// --------------------------------------------------------------------------------
+
+typedef struct {
+    size_t len;
+    size_t row;
+} _row_length_t;
+
+/* Longer rows first; equal lengths keep matrix order */
+static int _compare_row_length(const void* a, const void* b) {
+    const _row_length_t* x = (const _row_length_t*)a;
+    const _row_length_t* y = (const _row_length_t*)b;
+    if (x->len != y->len) return (x->len < y->len) - (x->len > y->len);
+    return (x->row > y->row) - (x->row < y->row);
+}
+
+// --------------------------------------------------------------------------------
+
+/* CSR to SELL-C-sigma.  Rows are sorted by length inside each window of
+ * sigma rows (windows line up with slices, since sigma is a multiple of
+ * chunk), each slice is sized by its longest row, then every row is laid
+ * out down its slot's lane.  Padding repeats the row's last column with a
+ * zero value, and lanes past the last row use column 0, so the kernels
+ * gather without bounds checks. */
+static matrix_expect_t _csr_to_sell_matrix(const matrix_t*    src,
+                                           size_t             chunk,
+                                           size_t             sigma,
+                                           allocator_vtable_t alloc_v) {
+    const size_t* ptr    = src->rep.csr.row_ptr;
+    const size_t* col    = src->rep.csr.col_idx;
+    size_t const  ds     = src->data_size;
+    size_t const  rows   = src->rows;
+    size_t const  slices = (rows + chunk - 1u) / chunk;
+    size_t const  window = (sigma < rows) ? sigma : rows;
+
+    void_ptr_expect_t pr = alloc_v.allocate(alloc_v.ctx, (slices + 1u) * sizeof(size_t), true);
+    void_ptr_expect_t mr = alloc_v.allocate(alloc_v.ctx, rows * sizeof(size_t), false);
+    void_ptr_expect_t wr = alloc_v.allocate(alloc_v.ctx, window * sizeof(_row_length_t), false);
+    if (!pr.has_value || !mr.has_value || !wr.has_value) {
+        if (pr.has_value) alloc_v.return_element(alloc_v.ctx, pr.u.value);
+        if (mr.has_value) alloc_v.return_element(alloc_v.ctx, mr.u.value);
+        if (wr.has_value) alloc_v.return_element(alloc_v.ctx, wr.u.value);
+        return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
+    }
+
+    size_t*        slice_ptr = (size_t*)pr.u.value;
+    size_t*        perm      = (size_t*)mr.u.value;
+    _row_length_t* order     = (_row_length_t*)wr.u.value;
+
+    for (size_t w0 = 0u; w0 < rows; w0 += window) {
+        size_t const n = (rows - w0 < window) ? rows - w0 : window;
+        for (size_t k = 0u; k < n; k++)
+            order[k] = (_row_length_t){ .len = ptr[w0 + k + 1u] - ptr[w0 + k],
+                                        .row = w0 + k };
+        if (n > 1u) qsort(order, n, sizeof(order[0]), _compare_row_length);
+
+        for (size_t k = 0u; k < n; k++) {
+            size_t const s = (w0 + k) / chunk;
+            perm[w0 + k] = order[k].row;
+            if (order[k].len > slice_ptr[s + 1u]) slice_ptr[s + 1u] = order[k].len;
+        }
+    }
+    alloc_v.return_element(alloc_v.ctx, order);
+
+    /* Slice widths to offsets, each width counting chunk lanes */
+    error_code_t err = NO_ERROR;
+    for (size_t s = 0u; s < slices && err == NO_ERROR; s++) {
+        size_t const width = slice_ptr[s + 1u];
+        if (width > SIZE_MAX / chunk || width * chunk > SIZE_MAX - slice_ptr[s])
+            err = LENGTH_OVERFLOW;
+        else
+            slice_ptr[s + 1u] = slice_ptr[s] + width * chunk;
+    }
+    if (err != NO_ERROR) {
+        alloc_v.return_element(alloc_v.ctx, slice_ptr);
+        alloc_v.return_element(alloc_v.ctx, perm);
+        return (matrix_expect_t){ .has_value = false, .u.error = err };
+    }
+
+    matrix_expect_t r = _alloc_sell_matrix(src, chunk, sigma, slice_ptr, alloc_v);
+    if (!r.has_value) {
+        alloc_v.return_element(alloc_v.ctx, perm);
+        return r;
+    }
+
+    sell_matrix_t* dst = &r.u.value->rep.sell;
+    dst->nnz = src->rep.csr.nnz;
+    memcpy(dst->row_perm, perm, rows * sizeof(size_t));
+    alloc_v.return_element(alloc_v.ctx, perm);
+
+    for (size_t k = 0u; k < rows; k++) {
+        size_t const i     = dst->row_perm[k];
+        size_t const len   = ptr[i + 1u] - ptr[i];
+        size_t const s     = k / chunk;
+        size_t const base  = slice_ptr[s] + k % chunk;
+        size_t const width = (slice_ptr[s + 1u] - slice_ptr[s]) / chunk;
+
+        dst->row_slot[i] = k;
+        dst->row_len[k]  = len;
+        for (size_t j = 0u; j < len; j++) {
+            dst->col_idx[base + j * chunk] = col[ptr[i] + j];
+            memcpy(dst->values + (base + j * chunk) * ds,
+                   src->rep.csr.values + (ptr[i] + j) * ds, ds);
+        }
+        for (size_t j = len; j < width; j++)
+            dst->col_idx[base + j * chunk] = (len > 0u) ? col[ptr[i + 1u] - 1u] : 0u;
+    }
+    return r;
+}
+
+// --------------------------------------------------------------------------------
+
+static matrix_expect_t _sell_to_csr_matrix(const matrix_t*    src,
+                                           allocator_vtable_t alloc_v) {
+    const sell_matrix_t* s  = &src->rep.sell;
+    size_t const         ds = src->data_size;
+
+    void_ptr_expect_t pr = alloc_v.allocate(alloc_v.ctx,
+                                            (src->rows + 1u) * sizeof(size_t), true);
+    if (!pr.has_value)
+        return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
+
+    size_t* row_ptr = (size_t*)pr.u.value;
+    for (size_t i = 0u; i < src->rows; i++)
+        row_ptr[i + 1u] = s->row_len[s->row_slot[i]];
+    _counts_to_offsets(row_ptr, src->rows);
+
+    matrix_expect_t r = _alloc_compressed_matrix(CSR_MATRIX, src->rows, src->cols,
+                                                 src->dtype, ds, row_ptr, alloc_v);
+    if (!r.has_value) return r;
+
+    csr_matrix_t* dst = &r.u.value->rep.csr;
+    for (size_t i = 0u; i < src->rows; i++) {
+        size_t const k    = s->row_slot[i];
+        size_t const base = s->slice_ptr[k / s->chunk] + k % s->chunk;
+        for (size_t j = 0u; j < s->row_len[k]; j++) {
+            size_t const q = base + j * s->chunk;
+            dst->col_idx[row_ptr[i] + j] = s->col_idx[q];
+            memcpy(dst->values + (row_ptr[i] + j) * ds, s->values + q * ds, ds);
+        }
+    }
+    return r;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Build a BSR (shape p, q = block rows, cols) or SELL (p, q = chunk,
+ * sigma) matrix from src in any format, converting to CSR first unless
+ * src already is CSR. */
+static matrix_expect_t _convert_through_csr(const matrix_t*    src,
+                                            matrix_format_t    target,
+                                            size_t             p,
+                                            size_t             q,
+                                            allocator_vtable_t alloc_v,
+                                            matrix_zero_fn     is_zero) {
+    if (src->format == CSR_MATRIX) {
+        return (target == BSR_MATRIX) ? _csr_to_bsr_matrix(src, p, q, alloc_v)
+                                      : _csr_to_sell_matrix(src, p, q, alloc_v);
+    }
+
+    matrix_expect_t tmp = convert_matrix_zero(src, CSR_MATRIX, alloc_v, is_zero);
+    if (!tmp.has_value) return tmp;
+
+    matrix_expect_t out = _convert_through_csr(tmp.u.value, target, p, q,
+                                               alloc_v, is_zero);
+    return_matrix(tmp.u.value);
+    return out;
+}
+
 // ================================================================================
 // Public dispatcher
 // ================================================================================
@@ -1563,6 +2709,16 @@ matrix_expect_t convert_matrix_zero(const matrix_t*    src,
         return copy_matrix(src, alloc_v);
     }
 
+    /* Blocked and sliced formats are built from, and read back through, CSR */
+    if (target == BSR_MATRIX) {
+        return _convert_through_csr(src, BSR_MATRIX, BSR_DEFAULT_BLOCK,
+                                    BSR_DEFAULT_BLOCK, alloc_v, is_zero);
+    }
+    if (target == SELL_MATRIX) {
+        return _convert_through_csr(src, SELL_MATRIX, SELL_DEFAULT_CHUNK,
+                                    SELL_DEFAULT_SIGMA, alloc_v, is_zero);
+    }
+
     switch (src->format) {
         case DENSE_MATRIX:
             if (target == COO_MATRIX) return _dense_to_coo_matrix_ex(src, alloc_v, is_zero);
@@ -1572,8 +2728,8 @@ matrix_expect_t convert_matrix_zero(const matrix_t*    src,
 
         case COO_MATRIX:
             if (target == DENSE_MATRIX) return _coo_to_dense_matrix(src, alloc_v);
-            if (target == CSR_MATRIX)   return _coo_to_csr_matrix(src, alloc_v);
-            if (target == CSC_MATRIX)   return _coo_to_csc_matrix(src, alloc_v);
+            if (target == CSR_MATRIX)   return _coo_to_csr_matrix(src, alloc_v, is_zero);
+            if (target == CSC_MATRIX)   return _coo_to_csc_matrix(src, alloc_v, is_zero);
             break;
 
         case CSR_MATRIX:
@@ -1588,6 +2744,19 @@ matrix_expect_t convert_matrix_zero(const matrix_t*    src,
             if (target == CSR_MATRIX)   return _csc_to_csr_matrix(src, alloc_v);
             break;
 
+        case BSR_MATRIX:
+        case SELL_MATRIX: {
+            matrix_expect_t tmp = (src->format == BSR_MATRIX)
+                                      ? _bsr_to_csr_matrix(src, alloc_v, is_zero)
+                                      : _sell_to_csr_matrix(src, alloc_v);
+            if (!tmp.has_value || target == CSR_MATRIX) return tmp;
+
+            matrix_expect_t out = convert_matrix_zero(tmp.u.value, target,
+                                                      alloc_v, is_zero);
+            return_matrix(tmp.u.value);
+            return out;
+        }
+
         default:
             break;
     }
@@ -1602,6 +2771,96 @@ matrix_expect_t convert_matrix(const matrix_t*   src,
                                allocator_vtable_t alloc_v) {
     return convert_matrix_zero(src, target, alloc_v, NULL);
 }
+
+// --------------------------------------------------------------------------------
+
+matrix_expect_t convert_coo_matrix(const matrix_t*    src,
+                                   matrix_format_t    target,
+                                   coo_duplicate_t    duplicates,
+                                   size_t             num_threads,
+                                   allocator_vtable_t alloc_v) {
+    if (src == NULL) {
+        return (matrix_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    }
+
+    if (src->format != COO_MATRIX ||
+        (target != CSR_MATRIX && target != CSC_MATRIX)) {
+        return (matrix_expect_t){ .has_value = false, .u.error = ILLEGAL_STATE };
+    }
+
+    if (duplicates != COO_DUPLICATE_LAST && duplicates != COO_DUPLICATE_FIRST &&
+        duplicates != COO_DUPLICATE_SUM) {
+        return (matrix_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+    if (duplicates == COO_DUPLICATE_SUM && !_is_summable_dtype(src->dtype)) {
+        return (matrix_expect_t){ .has_value = false, .u.error = TYPE_MISMATCH };
+    }
+
+    return _coo_to_compressed_matrix(src, target, duplicates, NULL,
+                                     num_threads, alloc_v);
+}
+
+// --------------------------------------------------------------------------------
+
+matrix_expect_t finalize_coo_assembly_compressed(matrix_t*          mat,
+                                                 matrix_format_t    target,
+                                                 size_t             num_threads,
+                                                 allocator_vtable_t alloc_v) {
+    if (mat == NULL) {
+        return (matrix_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    }
+
+    if (mat->format != COO_MATRIX || mat->rep.coo.index == NULL ||
+        (target != CSR_MATRIX && target != CSC_MATRIX)) {
+        return (matrix_expect_t){ .has_value = false, .u.error = ILLEGAL_STATE };
+    }
+
+    /* The hash kept the entries unique, so any policy resolves nothing */
+    matrix_expect_t r = _coo_to_compressed_matrix(mat, target, COO_DUPLICATE_LAST,
+                                                  NULL, num_threads, alloc_v);
+    if (r.has_value) _coo_index_release(mat);
+    return r;
+}
+
+// --------------------------------------------------------------------------------
+
+matrix_expect_t convert_to_bsr_matrix(const matrix_t*    src,
+                                      size_t             block_rows,
+                                      size_t             block_cols,
+                                      allocator_vtable_t alloc_v) {
+    if (src == NULL) {
+        return (matrix_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    }
+
+    if (block_rows == 0u || block_cols == 0u) {
+        return (matrix_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+
+    if (block_rows > SIZE_MAX / block_cols) {
+        return (matrix_expect_t){ .has_value = false, .u.error = LENGTH_OVERFLOW };
+    }
+
+    return _convert_through_csr(src, BSR_MATRIX, block_rows, block_cols,
+                                alloc_v, NULL);
+}
+
+// --------------------------------------------------------------------------------
+
+matrix_expect_t convert_to_sell_matrix(const matrix_t*    src,
+                                       size_t             chunk,
+                                       size_t             sigma,
+                                       allocator_vtable_t alloc_v) {
+    if (src == NULL) {
+        return (matrix_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    }
+
+    if (chunk == 0u || chunk > SELL_MAX_CHUNK ||
+        sigma == 0u || (sigma > 1u && sigma % chunk != 0u)) {
+        return (matrix_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+
+    return _convert_through_csr(src, SELL_MATRIX, chunk, sigma, alloc_v, NULL);
+}
 // -------------------------------------------------------------------------------- 
 
 static matrix_expect_t _transpose_csr_matrix(const matrix_t*    src,
@@ -1885,12 +3144,143 @@ static matrix_expect_t _transpose_csc_matrix(const matrix_t*    src,
 }
 // -------------------------------------------------------------------------------- 
 
+/* Dense transposes work on TRANSPOSE_TILE x TRANSPOSE_TILE blocks, so the
+ * source rows and destination rows a block touches stay cache resident */
+#define TRANSPOSE_TILE 64u
+
+/* Out-of-place results of at least TRANSPOSE_STREAM_BYTES are written a
+ * whole TRANSPOSE_LINE at a time with non-temporal stores, in passes over
+ * TRANSPOSE_BLOCK source columns so the destination rows one pass writes
+ * stay within the TLB.  Smaller results are left in the cache for the
+ * caller. */
+#define TRANSPOSE_LINE         64u
+#define TRANSPOSE_BLOCK        1024u
+#define TRANSPOSE_STREAM_BYTES (1u << 20)
+
+// --------------------------------------------------------------------------------
+
+/* dst[j][i] = src[i][j] for a rows x cols block of ds-byte elements; lds
+ * and ldd are row strides in elements.  4- and 8-byte elements go through
+ * the SIMD register transposes, which only move bits. */
+static void _transpose_tile(uint8_t*       dst,
+                            size_t         ldd,
+                            const uint8_t* src,
+                            size_t         lds,
+                            size_t         rows,
+                            size_t         cols,
+                            size_t         ds) {
+    if (ds == sizeof(float)) {
+        simd_transpose_float((float*)dst, ldd, (const float*)src, lds, rows, cols);
+    } else if (ds == sizeof(double)) {
+        simd_transpose_double((double*)dst, ldd, (const double*)src, lds, rows, cols);
+    } else {
+        for (size_t i = 0u; i < rows; ++i)
+            for (size_t j = 0u; j < cols; ++j)
+                memcpy(dst + (j * ldd + i) * ds, src + (i * lds + j) * ds, ds);
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+/* One thread's share of a dense transpose.  Out of place it owns
+ * destination rows [lo, hi), so the pages of a fresh result are first
+ * touched by the thread that fills them, and stream says whether they go
+ * through the streaming band kernels.  In place it owns the tile rows lo,
+ * lo + step, ... (interleaved, since tile row t pairs with the n / TILE - t
+ * tiles right of the diagonal) and swaps each with its mirror through
+ * scratch. */
+typedef struct {
+    const matrix_t* src;
+    uint8_t*        dst;
+    uint8_t*        scratch;
+    size_t          lo;
+    size_t          hi;
+    size_t          step;
+    bool            stream;
+} _transpose_task_t;
+
+// --------------------------------------------------------------------------------
+
+static void* _transpose_dense_task(void* arg) {
+    _transpose_task_t* t  = (_transpose_task_t*)arg;
+    const matrix_t*    s  = t->src;
+    const uint8_t*     a  = s->rep.dense.data;
+    size_t const       m  = s->rows;
+    size_t const       n  = s->cols;
+    size_t const       ds = s->data_size;
+
+    if (!t->stream) {
+        for (size_t jb = t->lo; jb < t->hi; jb += TRANSPOSE_TILE) {
+            size_t const bj = (t->hi - jb < TRANSPOSE_TILE) ? t->hi - jb : TRANSPOSE_TILE;
+            for (size_t ib = 0u; ib < m; ib += TRANSPOSE_TILE) {
+                size_t const bi = (m - ib < TRANSPOSE_TILE) ? m - ib : TRANSPOSE_TILE;
+                _transpose_tile(t->dst + (jb * m + ib) * ds, m,
+                                a + (ib * n + jb) * ds, n, bi, bj, ds);
+            }
+        }
+        return NULL;
+    }
+
+    /* Destination rows are a whole number of lines long, so they all start
+     * at the same offset within a line: the first head source rows finish
+     * that partial line, the bands of one line each after them are
+     * aligned, and the source rows from body on fill the partial last line */
+    size_t const band = TRANSPOSE_LINE / ds;
+    size_t const head = ((TRANSPOSE_LINE - (uintptr_t)t->dst % TRANSPOSE_LINE)
+                         % TRANSPOSE_LINE) / ds;
+    size_t const body = head + (m - head) / band * band;
+
+    for (size_t jb = t->lo; jb < t->hi; jb += TRANSPOSE_BLOCK) {
+        size_t const   bj = (t->hi - jb < TRANSPOSE_BLOCK) ? t->hi - jb : TRANSPOSE_BLOCK;
+        uint8_t*       d  = t->dst + jb * m * ds;
+        const uint8_t* sc = a + jb * ds;
+
+        _transpose_tile(d, m, sc, n, head, bj, ds);
+        for (size_t i = head; i < body; i += band) {
+            if (ds == sizeof(float))
+                simd_transpose_stream_float((float*)(d + i * ds), m,
+                                            (const float*)(sc + i * n * ds), n, bj);
+            else
+                simd_transpose_stream_double((double*)(d + i * ds), m,
+                                             (const double*)(sc + i * n * ds), n, bj);
+        }
+        _transpose_tile(d + body * ds, m, sc + body * n * ds, n, m - body, bj, ds);
+    }
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+static void* _transpose_inplace_task(void* arg) {
+    _transpose_task_t* t   = (_transpose_task_t*)arg;
+    size_t const       n   = t->src->rows;
+    size_t const       ds  = t->src->data_size;
+    uint8_t*           a   = t->dst;
+    uint8_t*           tmp = t->scratch;
+
+    for (size_t ib = t->lo * TRANSPOSE_TILE; ib < n; ib += t->step * TRANSPOSE_TILE) {
+        size_t const bi = (n - ib < TRANSPOSE_TILE) ? n - ib : TRANSPOSE_TILE;
+        for (size_t jb = ib; jb < n; jb += TRANSPOSE_TILE) {
+            size_t const bj = (n - jb < TRANSPOSE_TILE) ? n - jb : TRANSPOSE_TILE;
+            uint8_t* upper = a + (ib * n + jb) * ds;   /* bi x bj */
+            uint8_t* lower = a + (jb * n + ib) * ds;   /* bj x bi */
+
+            /* tmp = upper^T (bj x bi), upper = lower^T, lower = tmp; on
+             * the diagonal upper and lower are the same tile */
+            _transpose_tile(tmp, bi, upper, n, bi, bj, ds);
+            if (jb != ib) _transpose_tile(upper, n, lower, n, bj, bi, ds);
+            for (size_t r = 0u; r < bj; ++r)
+                memcpy(lower + r * n * ds, tmp + r * bi * ds, bi * ds);
+        }
+    }
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
 static matrix_expect_t _transpose_dense_matrix(const matrix_t* src,
                                                allocator_vtable_t alloc_v) {
     matrix_expect_t r;
-    matrix_t* dst = NULL;
-    size_t i = 0u;
-    size_t j = 0u;
 
     if (src == NULL) {
         return (matrix_expect_t){ .has_value = false, .u.error = NULL_POINTER };
@@ -1899,21 +3289,30 @@ static matrix_expect_t _transpose_dense_matrix(const matrix_t* src,
         return (matrix_expect_t){ .has_value = false, .u.error = ILLEGAL_STATE };
     }
 
-    r = init_dense_matrix(src->cols, src->rows, src->dtype, alloc_v);
+    /* Every element is written below, so the data is left unzeroed and
+     * each thread's destination rows are written exactly once */
+    r = _init_dense_matrix(src->cols, src->rows, src->dtype, alloc_v, false);
     if (!r.has_value) return r;
 
-    dst = r.u.value;
+    uint8_t*     dst   = r.u.value->rep.dense.data;
+    size_t const ds    = src->data_size;
+    size_t const bytes = src->rows * src->cols * ds;
 
-    for (i = 0u; i < src->rows; ++i) {
-        for (j = 0u; j < src->cols; ++j) {
-            const uint8_t* src_ptr =
-                src->rep.dense.data + _dense_offset(src, i, j);
-            uint8_t* dst_ptr =
-                dst->rep.dense.data + _dense_offset(dst, j, i);
+    bool const stream = (ds == sizeof(float) || ds == sizeof(double)) &&
+                        bytes >= TRANSPOSE_STREAM_BYTES &&
+                        (src->rows * ds) % TRANSPOSE_LINE == 0u &&
+                        (uintptr_t)dst % ds == 0u;
 
-            memcpy(dst_ptr, src_ptr, src->data_size);
-        }
+    _transpose_task_t tasks[MATRIX_MAX_THREADS];
+    size_t const parts = _matrix_thread_count(0u, src->rows * src->cols);
+    for (size_t p = 0u; p < parts; ++p) {
+        tasks[p] = (_transpose_task_t){
+            .src = src, .dst = dst, .stream = stream,
+            .lo  = _even_split(src->cols, parts, p, TRANSPOSE_TILE),
+            .hi  = _even_split(src->cols, parts, p + 1u, TRANSPOSE_TILE)
+        };
     }
+    _matrix_parallel(tasks, sizeof(tasks[0]), parts, _transpose_dense_task);
 
     return r;
 }
@@ -1969,6 +3368,28 @@ static matrix_expect_t _transpose_coo_matrix(const matrix_t* src,
 
     return r;
 }
+
+// --------------------------------------------------------------------------------
+
+/* BSR and SELL transpose through CSR.  BSR keeps its blocks, mirrored;
+ * SELL keeps chunk and sigma. */
+static matrix_expect_t _transpose_through_csr(const matrix_t*    src,
+                                              allocator_vtable_t alloc_v) {
+    matrix_expect_t tmp = convert_matrix(src, CSR_MATRIX, alloc_v);
+    if (!tmp.has_value) return tmp;
+
+    matrix_expect_t tr = _transpose_csr_matrix(tmp.u.value, alloc_v);
+    return_matrix(tmp.u.value);
+    if (!tr.has_value) return tr;
+
+    matrix_expect_t out = (src->format == BSR_MATRIX)
+        ? _csr_to_bsr_matrix(tr.u.value, src->rep.bsr.block_cols,
+                             src->rep.bsr.block_rows, alloc_v)
+        : _csr_to_sell_matrix(tr.u.value, src->rep.sell.chunk,
+                              src->rep.sell.sigma, alloc_v);
+    return_matrix(tr.u.value);
+    return out;
+}
 // ================================================================================
 // Lifecycle / structural operations
 // ================================================================================
@@ -1986,6 +3407,7 @@ error_code_t clear_matrix(matrix_t* mat) {
         case COO_MATRIX:
             mat->rep.coo.nnz = 0u;
             mat->rep.coo.sorted = true;
+            if (mat->rep.coo.index != NULL) _coo_index_fill(mat);
             return NO_ERROR;
 
         default:
@@ -2014,6 +3436,12 @@ matrix_expect_t copy_matrix(const matrix_t*   src,
         case CSC_MATRIX:
             return _copy_csc_matrix(src, alloc_v);
 
+        case BSR_MATRIX:
+            return _copy_bsr_matrix(src, alloc_v);
+
+        case SELL_MATRIX:
+            return _copy_sell_matrix(src, alloc_v);
+
         default:
             return (matrix_expect_t){ .has_value = false, .u.error = ILLEGAL_STATE };
     }
@@ -2039,11 +3467,47 @@ matrix_expect_t transpose_matrix(const matrix_t* src,
         case CSC_MATRIX:
             return _transpose_csc_matrix(src, alloc_v);
 
+        case BSR_MATRIX:
+        case SELL_MATRIX:
+            return _transpose_through_csr(src, alloc_v);
+
         default:
             return (matrix_expect_t){ .has_value = false, .u.error = ILLEGAL_STATE };
     }
 }
 
+// --------------------------------------------------------------------------------
+
+error_code_t transpose_matrix_inplace(matrix_t* mat) {
+    if (mat == NULL) return NULL_POINTER;
+    if (mat->format != DENSE_MATRIX) return ILLEGAL_STATE;
+    if (mat->rows != mat->cols) return INVALID_ARG;
+
+    size_t const n     = mat->rows;
+    size_t const tiles = (n + TRANSPOSE_TILE - 1u) / TRANSPOSE_TILE;
+    size_t       parts = _matrix_thread_count(0u, n * n / 2u);
+    if (parts > tiles) parts = tiles;
+
+    /* One tile of scratch per thread */
+    size_t const tile_bytes = TRANSPOSE_TILE * TRANSPOSE_TILE * mat->data_size;
+    void_ptr_expect_t sr = mat->alloc_v.allocate(mat->alloc_v.ctx,
+                                                 parts * tile_bytes, false);
+    if (!sr.has_value) return OUT_OF_MEMORY;
+
+    _transpose_task_t tasks[MATRIX_MAX_THREADS];
+    for (size_t p = 0u; p < parts; ++p) {
+        tasks[p] = (_transpose_task_t){
+            .src = mat, .dst = mat->rep.dense.data,
+            .scratch = (uint8_t*)sr.u.value + p * tile_bytes,
+            .lo = p, .step = parts
+        };
+    }
+    _matrix_parallel(tasks, sizeof(tasks[0]), parts, _transpose_inplace_task);
+
+    mat->alloc_v.return_element(mat->alloc_v.ctx, sr.u.value);
+    return NO_ERROR;
+}
+
 // ================================================================================
 // Shape helpers
 // ================================================================================
@@ -2085,7 +3549,9 @@ size_t matrix_storage_bytes(const matrix_t* mat) {
                used because this reports allocated storage, not logical
                occupancy. */
             return (mat->rep.coo.cap * sizeof(size_t) * 2u) +
-                   (mat->rep.coo.cap * mat->data_size);
+                   (mat->rep.coo.cap * mat->data_size) +
+                   (mat->rep.coo.index != NULL
+                        ? (mat->rep.coo.index_mask + 1u) * sizeof(size_t) : 0u);
 
         case CSR_MATRIX:
             /* row_ptr:  (rows + 1) size_t values
@@ -2103,6 +3569,30 @@ size_t matrix_storage_bytes(const matrix_t* mat) {
                    (mat->rep.csc.nnz * sizeof(size_t)) +
                    (mat->rep.csc.nnz * mat->data_size);
 
+        case BSR_MATRIX: {
+            /* block_ptr:  (block rows + 1) size_t values
+               block_col:  nnzb size_t values
+               values:     nnzb whole blocks */
+            const bsr_matrix_t* b = &mat->rep.bsr;
+            size_t const nbr = (mat->rows + b->block_rows - 1u) / b->block_rows;
+            return ((nbr + 1u) * sizeof(size_t)) +
+                   (b->nnzb * sizeof(size_t)) +
+                   (b->nnzb * b->block_rows * b->block_cols * mat->data_size);
+        }
+
+        case SELL_MATRIX: {
+            /* slice_ptr:                  (slices + 1) size_t values
+               row_perm, row_slot, row_len: rows size_t values each
+               col_idx, values:            padded slice entries */
+            const sell_matrix_t* sl = &mat->rep.sell;
+            size_t const slices = (mat->rows + sl->chunk - 1u) / sl->chunk;
+            size_t const total  = sl->slice_ptr[slices];
+            return ((slices + 1u) * sizeof(size_t)) +
+                   (3u * mat->rows * sizeof(size_t)) +
+                   (total * sizeof(size_t)) +
+                   (total * mat->data_size);
+        }
+
         default:
             return 0u;
     }
@@ -2116,6 +3606,8 @@ const char* matrix_format_name(matrix_format_t format) {
         case COO_MATRIX:   return "COO_MATRIX";
         case CSR_MATRIX:   return "CSR_MATRIX";
         case CSC_MATRIX:   return "CSC_MATRIX";
+        case BSR_MATRIX:   return "BSR_MATRIX";
+        case SELL_MATRIX:  return "SELL_MATRIX";
         default:           return "UNKNOWN_MATRIX_FORMAT";
     }
 }
@@ -2333,6 +3825,8 @@ error_code_t swap_matrix_rows(matrix_t* mat,
 
         case CSR_MATRIX:
         case CSC_MATRIX:
+        case BSR_MATRIX:
+        case SELL_MATRIX:
             return OPERATION_UNAVAILABLE;
 
         default:
@@ -2357,6 +3851,8 @@ error_code_t swap_matrix_cols(matrix_t* mat,
 
         case CSR_MATRIX:
         case CSC_MATRIX:
+        case BSR_MATRIX:
+        case SELL_MATRIX:
             return OPERATION_UNAVAILABLE;
 
         default:
@@ -2544,12 +4040,36 @@ bool is_zero_matrix(const matrix_t* mat) {
         case CSC_MATRIX:
             return mat->rep.csc.nnz == 0u;
 
+        case BSR_MATRIX:
+            return mat->rep.bsr.nnzb == 0u;
+
+        case SELL_MATRIX:
+            return mat->rep.sell.nnz == 0u;
+
         default:
             return false;
     }
 }
 // -------------------------------------------------------------------------------- 
 
+/* Storage index of the first element that cmp orders before (find_max
+ * false) or after (find_max true) every other one.  The elements are
+ * opaque to cmp, so this is a plain scalar scan. */
+static size_t _matrix_arg_extreme(const uint8_t* data,
+                                  size_t         count,
+                                  size_t         data_size,
+                                  int          (*cmp)(const void*, const void*),
+                                  bool           find_max) {
+    size_t best = 0u;
+
+    for (size_t i = 1u; i < count; ++i) {
+        int const c = cmp(data + i * data_size, data + best * data_size);
+        if (find_max ? (c > 0) : (c < 0)) best = i;
+    }
+    return best;
+}
+// -------------------------------------------------------------------------------- 
+
 static size_expect_t _dense_matrix_min(const matrix_t* mat,
                                        int (*cmp)(const void*, const void*)) {
     size_t count;
@@ -2567,10 +4087,10 @@ static size_expect_t _dense_matrix_min(const matrix_t* mat,
         return (size_expect_t){ .has_value = false, .u.error = EMPTY };
     }
 
-    size_t idx = simd_min_uint8(mat->rep.dense.data,
-                                count,
-                                mat->data_size,
-                                cmp);
+    size_t idx = _matrix_arg_extreme(mat->rep.dense.data,
+                                     count,
+                                     mat->data_size,
+                                     cmp, false);
     return (size_expect_t){ .has_value = true, .u.value = idx };
 }
 
@@ -2585,10 +4105,10 @@ static size_expect_t _coo_matrix_min(const matrix_t* mat,
         return (size_expect_t){ .has_value = false, .u.error = EMPTY };
     }
 
-    size_t idx = simd_min_uint8(mat->rep.coo.values,
-                                mat->rep.coo.nnz,
-                                mat->data_size,
-                                cmp);
+    size_t idx = _matrix_arg_extreme(mat->rep.coo.values,
+                                     mat->rep.coo.nnz,
+                                     mat->data_size,
+                                     cmp, false);
     return (size_expect_t){ .has_value = true, .u.value = idx };
 }
 
@@ -2603,10 +4123,10 @@ static size_expect_t _csc_matrix_min(const matrix_t* mat,
         return (size_expect_t){ .has_value = false, .u.error = EMPTY };
     }
 
-    size_t idx = simd_min_uint8(mat->rep.csc.values,
-                                mat->rep.csc.nnz,
-                                mat->data_size,
-                                cmp);
+    size_t idx = _matrix_arg_extreme(mat->rep.csc.values,
+                                     mat->rep.csc.nnz,
+                                     mat->data_size,
+                                     cmp, false);
     return (size_expect_t){ .has_value = true, .u.value = idx };
 }
 
@@ -2621,10 +4141,10 @@ static size_expect_t _csr_matrix_min(const matrix_t* mat,
         return (size_expect_t){ .has_value = false, .u.error = EMPTY };
     }
 
-    size_t idx = simd_min_uint8(mat->rep.csr.values,
-                                mat->rep.csr.nnz,
-                                mat->data_size,
-                                cmp);
+    size_t idx = _matrix_arg_extreme(mat->rep.csr.values,
+                                     mat->rep.csr.nnz,
+                                     mat->data_size,
+                                     cmp, false);
     return (size_expect_t){ .has_value = true, .u.value = idx };
 }
 
@@ -2677,10 +4197,10 @@ static size_expect_t _dense_matrix_max(const matrix_t* mat,
         return (size_expect_t){ .has_value = false, .u.error = EMPTY };
     }
 
-    size_t idx = simd_max_uint8(mat->rep.dense.data,
-                                count,
-                                mat->data_size,
-                                cmp);
+    size_t idx = _matrix_arg_extreme(mat->rep.dense.data,
+                                     count,
+                                     mat->data_size,
+                                     cmp, true);
     return (size_expect_t){ .has_value = true, .u.value = idx };
 }
 
@@ -2695,10 +4215,10 @@ static size_expect_t _coo_matrix_max(const matrix_t* mat,
         return (size_expect_t){ .has_value = false, .u.error = EMPTY };
     }
 
-    size_t idx = simd_max_uint8(mat->rep.coo.values,
-                                mat->rep.coo.nnz,
-                                mat->data_size,
-                                cmp);
+    size_t idx = _matrix_arg_extreme(mat->rep.coo.values,
+                                     mat->rep.coo.nnz,
+                                     mat->data_size,
+                                     cmp, true);
     return (size_expect_t){ .has_value = true, .u.value = idx };
 }
 
@@ -2713,10 +4233,10 @@ static size_expect_t _csc_matrix_max(const matrix_t* mat,
         return (size_expect_t){ .has_value = false, .u.error = EMPTY };
     }
 
-    size_t idx = simd_max_uint8(mat->rep.csc.values,
-                                mat->rep.csc.nnz,
-                                mat->data_size,
-                                cmp);
+    size_t idx = _matrix_arg_extreme(mat->rep.csc.values,
+                                     mat->rep.csc.nnz,
+                                     mat->data_size,
+                                     cmp, true);
     return (size_expect_t){ .has_value = true, .u.value = idx };
 }
 
@@ -2731,10 +4251,10 @@ static size_expect_t _csr_matrix_max(const matrix_t* mat,
         return (size_expect_t){ .has_value = false, .u.error = EMPTY };
     }
 
-    size_t idx = simd_max_uint8(mat->rep.csr.values,
-                                mat->rep.csr.nnz,
-                                mat->data_size,
-                                cmp);
+    size_t idx = _matrix_arg_extreme(mat->rep.csr.values,
+                                     mat->rep.csr.nnz,
+                                     mat->data_size,
+                                     cmp, true);
     return (size_expect_t){ .has_value = true, .u.value = idx };
 }
 
@@ -2845,6 +4365,1105 @@ size_expect_t matrix_max(const matrix_t* mat,
 //
 //     return NO_ERROR;
 // }
+// ================================================================================
+// Matrix products
+// ================================================================================
+
+/* GEMM cache blocking: a GEMM_KC-deep panel of B, GEMM_NC_BYTES wide,
+ * stays resident in L2 while every 4-row block of A streams past it. */
+#define GEMM_KC              256u
+#define GEMM_NC_BYTES        (256u * 1024u)
+
+// --------------------------------------------------------------------------------
+
+static inline bool _is_simd_float_dtype(dtype_id_t dtype) {
+    return dtype == FLOAT_TYPE || dtype == DOUBLE_TYPE;
+}
+
+// --------------------------------------------------------------------------------
+
+static inline bool _is_compressed_format(const matrix_t* mat) {
+    return mat->format == CSR_MATRIX || mat->format == CSC_MATRIX;
+}
+
+// --------------------------------------------------------------------------------
+
+/* One thread's share of a product: rows (or columns) [lo, hi) of the
+ * output.  Unused fields are left zero by the caller. */
+typedef struct {
+    const matrix_t* a;
+    const matrix_t* b;
+    const uint8_t*  x;
+    uint8_t*        y;
+    size_t          lo;
+    size_t          hi;
+} _product_task_t;
+
+// --------------------------------------------------------------------------------
+
+/* y[i] = dot(row i of the compressed operand, x) for i in [lo, hi).  Works
+ * for CSR rows (A x) and CSC columns (A^T x) alike. */
+static void* _compressed_dot_task(void* arg) {
+    _product_task_t* t = (_product_task_t*)arg;
+    const matrix_t*  a = t->a;
+
+    const size_t*  ptr;
+    const size_t*  idx;
+    const uint8_t* val;
+    if (a->format == CSR_MATRIX) {
+        ptr = a->rep.csr.row_ptr; idx = a->rep.csr.col_idx; val = a->rep.csr.values;
+    } else {
+        ptr = a->rep.csc.col_ptr; idx = a->rep.csc.row_idx; val = a->rep.csc.values;
+    }
+
+    if (a->dtype == FLOAT_TYPE) {
+        const float* v = (const float*)val;
+        const float* x = (const float*)t->x;
+        float*       y = (float*)t->y;
+        for (size_t i = t->lo; i < t->hi; i++)
+            y[i] = simd_spdot_float(v + ptr[i], idx + ptr[i], x, ptr[i + 1u] - ptr[i]);
+    } else {
+        const double* v = (const double*)val;
+        const double* x = (const double*)t->x;
+        double*       y = (double*)t->y;
+        for (size_t i = t->lo; i < t->hi; i++)
+            y[i] = simd_spdot_double(v + ptr[i], idx + ptr[i], x, ptr[i + 1u] - ptr[i]);
+    }
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+/* y[i] = dot(row i of dense A, x) for i in [lo, hi) */
+static void* _dense_gemv_task(void* arg) {
+    _product_task_t* t = (_product_task_t*)arg;
+    size_t const     n = t->a->cols;
+
+    if (t->a->dtype == FLOAT_TYPE) {
+        const float* a = (const float*)t->a->rep.dense.data;
+        float*       y = (float*)t->y;
+        for (size_t i = t->lo; i < t->hi; i++)
+            y[i] = simd_dot_float(a + i * n, (const float*)t->x, n);
+    } else {
+        const double* a = (const double*)t->a->rep.dense.data;
+        double*       y = (double*)t->y;
+        for (size_t i = t->lo; i < t->hi; i++)
+            y[i] = simd_dot_double(a + i * n, (const double*)t->x, n);
+    }
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+/* y[lo, hi) = sum over rows i of x[i] * A[i][lo, hi): the columns [lo, hi)
+ * of A^T x for dense row-major A, one axpy per row */
+static void* _dense_gemv_t_task(void* arg) {
+    _product_task_t* t  = (_product_task_t*)arg;
+    size_t const     m  = t->a->rows;
+    size_t const     n  = t->a->cols;
+    size_t const     w  = t->hi - t->lo;
+
+    if (t->a->dtype == FLOAT_TYPE) {
+        const float* a = (const float*)t->a->rep.dense.data;
+        const float* x = (const float*)t->x;
+        float*       y = (float*)t->y + t->lo;
+        memset(y, 0, w * sizeof(float));
+        for (size_t i = 0u; i < m; i++)
+            if (x[i] != 0.0f) simd_axpy_float(y, a + i * n + t->lo, x[i], w);
+    } else {
+        const double* a = (const double*)t->a->rep.dense.data;
+        const double* x = (const double*)t->x;
+        double*       y = (double*)t->y + t->lo;
+        memset(y, 0, w * sizeof(double));
+        for (size_t i = 0u; i < m; i++)
+            if (x[i] != 0.0) simd_axpy_double(y, a + i * n + t->lo, x[i], w);
+    }
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+/* y = sum over compressed lines j of x[j] * line j, scattered through the
+ * line's indices: A^T x for CSR or A x for CSC.  Serial, since concurrent
+ * lines write to overlapping entries of y. */
+static void _compressed_scatter(const matrix_t* a, const uint8_t* x,
+                                uint8_t* y, size_t y_len) {
+    const size_t*  ptr;
+    const size_t*  idx;
+    const uint8_t* val;
+    size_t         lines;
+    if (a->format == CSR_MATRIX) {
+        ptr = a->rep.csr.row_ptr; idx = a->rep.csr.col_idx;
+        val = a->rep.csr.values;  lines = a->rows;
+    } else {
+        ptr = a->rep.csc.col_ptr; idx = a->rep.csc.row_idx;
+        val = a->rep.csc.values;  lines = a->cols;
+    }
+
+    memset(y, 0, y_len * a->data_size);
+    if (a->dtype == FLOAT_TYPE) {
+        const float* v  = (const float*)val;
+        const float* xv = (const float*)x;
+        float*       yv = (float*)y;
+        for (size_t j = 0u; j < lines; j++) {
+            float const s = xv[j];
+            for (size_t p = ptr[j]; p < ptr[j + 1u]; p++) yv[idx[p]] += v[p] * s;
+        }
+    } else {
+        const double* v  = (const double*)val;
+        const double* xv = (const double*)x;
+        double*       yv = (double*)y;
+        for (size_t j = 0u; j < lines; j++) {
+            double const s = xv[j];
+            for (size_t p = ptr[j]; p < ptr[j + 1u]; p++) yv[idx[p]] += v[p] * s;
+        }
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* Block rows [lo, hi) of y = A x for BSR A.  Each block row goes through
+ * the SIMD kernel, except a block in the last, partial block column: it
+ * would read past the end of x, so its in-bounds columns are summed by a
+ * scalar loop. */
+#define BSR_SPMV_BLOCK_ROW(T, KERNEL)                                          \
+    do {                                                                       \
+        const T* v    = (const T*)b->values;                                   \
+        const T* x    = (const T*)t->x;                                        \
+        T*       yi   = (T*)t->y + bi * br;                                    \
+        size_t   end  = b->block_ptr[bi + 1u];                                 \
+        bool     part = end > b->block_ptr[bi] && b->block_col[end - 1u] == edge; \
+        memset(yi, 0, rows * sizeof(T));                                       \
+        if (part) end--;                                                       \
+        KERNEL(yi, v + b->block_ptr[bi] * bs, b->block_col + b->block_ptr[bi], \
+               x, end - b->block_ptr[bi], rows, br, bc);                       \
+        if (part) {                                                            \
+            const T* blk = v + end * bs;                                       \
+            const T* xb  = x + edge * bc;                                      \
+            for (size_t r = 0u; r < rows; r++)                                 \
+                for (size_t k = 0u; k < tail; k++)                             \
+                    yi[r] += blk[r * bc + k] * xb[k];                          \
+        }                                                                      \
+    } while (0)
+
+static void* _bsr_spmv_task(void* arg) {
+    _product_task_t*    t    = (_product_task_t*)arg;
+    const bsr_matrix_t* b    = &t->a->rep.bsr;
+    size_t const        br   = b->block_rows;
+    size_t const        bc   = b->block_cols;
+    size_t const        bs   = br * bc;
+    size_t const        tail = t->a->cols % bc;
+    /* Index of the partial block column, or one past the last block
+     * column when the blocks divide cols evenly */
+    size_t const        edge = t->a->cols / bc;
+
+    for (size_t bi = t->lo; bi < t->hi; bi++) {
+        size_t const rows = (t->a->rows - bi * br < br) ? t->a->rows - bi * br : br;
+        if (t->a->dtype == FLOAT_TYPE) BSR_SPMV_BLOCK_ROW(float,  simd_bsr_float);
+        else                           BSR_SPMV_BLOCK_ROW(double, simd_bsr_double);
+    }
+    return NULL;
+}
+
+#undef BSR_SPMV_BLOCK_ROW
+
+// --------------------------------------------------------------------------------
+
+/* Slices [lo, hi) of y = A x for SELL A: the SIMD kernel leaves one sum
+ * per slot in buf, and each sum is stored to its slot's matrix row. */
+#define SELL_SPMV_SLICES(T, KERNEL)                                            \
+    do {                                                                       \
+        T        buf[SELL_MAX_CHUNK];                                          \
+        const T* v = (const T*)s->values;                                      \
+        T*       y = (T*)t->y;                                                 \
+        for (size_t k = t->lo; k < t->hi; k++) {                               \
+            size_t const p0    = s->slice_ptr[k];                              \
+            size_t const first = k * c;                                        \
+            size_t const n     = (t->a->rows - first < c) ? t->a->rows - first : c; \
+            KERNEL(buf, v + p0, s->col_idx + p0, (const T*)t->x, c,            \
+                   (s->slice_ptr[k + 1u] - p0) / c);                           \
+            for (size_t i = 0u; i < n; i++) y[s->row_perm[first + i]] = buf[i]; \
+        }                                                                      \
+    } while (0)
+
+static void* _sell_spmv_task(void* arg) {
+    _product_task_t*     t = (_product_task_t*)arg;
+    const sell_matrix_t* s = &t->a->rep.sell;
+    size_t const         c = s->chunk;
+
+    if (t->a->dtype == FLOAT_TYPE) SELL_SPMV_SLICES(float,  simd_sell_float);
+    else                           SELL_SPMV_SLICES(double, simd_sell_double);
+    return NULL;
+}
+
+#undef SELL_SPMV_SLICES
+
+// --------------------------------------------------------------------------------
+
+/* y = A^T x for BSR or SELL A, scattering each stored entry (padding
+ * included, it only adds zeros) into y.  Serial, like _compressed_scatter. */
+#define BLOCKED_SCATTER(T)                                                     \
+    do {                                                                       \
+        const T* xv = (const T*)x;                                             \
+        T*       yv = (T*)y;                                                   \
+        if (a->format == BSR_MATRIX) {                                         \
+            const bsr_matrix_t* b  = &a->rep.bsr;                              \
+            const T*            v  = (const T*)b->values;                      \
+            size_t const        br = b->block_rows, bc = b->block_cols;        \
+            for (size_t i = 0u; i < a->rows; i++) {                            \
+                size_t const bi = i / br;                                      \
+                for (size_t k = b->block_ptr[bi]; k < b->block_ptr[bi + 1u]; k++) { \
+                    size_t const j0 = b->block_col[k] * bc;                    \
+                    size_t const w  = (a->cols - j0 < bc) ? a->cols - j0 : bc; \
+                    const T*     bv = v + (k * br + i % br) * bc;              \
+                    for (size_t c = 0u; c < w; c++) yv[j0 + c] += bv[c] * xv[i]; \
+                }                                                              \
+            }                                                                  \
+        } else {                                                               \
+            const sell_matrix_t* s = &a->rep.sell;                             \
+            const T*             v = (const T*)s->values;                      \
+            for (size_t k = 0u; k < a->rows; k++) {                            \
+                size_t const base = s->slice_ptr[k / s->chunk] + k % s->chunk; \
+                T const      xs   = xv[s->row_perm[k]];                        \
+                for (size_t j = 0u; j < s->row_len[k]; j++) {                  \
+                    size_t const q = base + j * s->chunk;                      \
+                    yv[s->col_idx[q]] += v[q] * xs;                            \
+                }                                                              \
+            }                                                                  \
+        }                                                                      \
+    } while (0)
+
+static void _blocked_scatter(const matrix_t* a, const uint8_t* x,
+                             uint8_t* y, size_t y_len) {
+    memset(y, 0, y_len * a->data_size);
+    if (a->dtype == FLOAT_TYPE) BLOCKED_SCATTER(float);
+    else                        BLOCKED_SCATTER(double);
+}
+
+#undef BLOCKED_SCATTER
+
+
+// --------------------------------------------------------------------------------
+
+error_code_t matrix_multiply_vector(matrix_t*       y,
+                                    const matrix_t* a,
+                                    const matrix_t* x,
+                                    bool            transpose,
+                                    size_t          num_threads) {
+    if (y == NULL || a == NULL || x == NULL) return NULL_POINTER;
+    if (y == x || y == a)                    return INVALID_ARG;
+    if (x->format != DENSE_MATRIX || y->format != DENSE_MATRIX)
+        return INVALID_ARG;
+    if (a->dtype != x->dtype || a->dtype != y->dtype) return TYPE_MISMATCH;
+    if (!_is_simd_float_dtype(a->dtype))              return TYPE_MISMATCH;
+    if (!matrix_is_vector(x) || !matrix_is_vector(y)) return SIZE_MISMATCH;
+
+    size_t const in_len  = transpose ? a->rows : a->cols;
+    size_t const out_len = transpose ? a->cols : a->rows;
+    if (matrix_vector_length(x) != in_len || matrix_vector_length(y) != out_len)
+        return SIZE_MISMATCH;
+
+    const uint8_t* xd = x->rep.dense.data;
+    uint8_t*       yd = y->rep.dense.data;
+
+    _product_task_t tasks[MATRIX_MAX_THREADS];
+    size_t          parts;
+
+    switch (a->format) {
+        case DENSE_MATRIX: {
+            size_t const work = a->rows * a->cols;
+            parts = _matrix_thread_count(num_threads, work);
+            /* A^T x splits the output columns; keep each slice a whole
+             * number of cache lines so threads never share one */
+            size_t const align = transpose ? 64u / a->data_size : 1u;
+            for (size_t r = 0u; r < parts; r++) {
+                tasks[r] = (_product_task_t){
+                    .a  = a, .x = xd, .y = yd,
+                    .lo = _even_split(out_len, parts, r, align),
+                    .hi = _even_split(out_len, parts, r + 1u, align)
+                };
+            }
+            _matrix_parallel(tasks, sizeof(tasks[0]), parts,
+                             transpose ? _dense_gemv_t_task : _dense_gemv_task);
+            return NO_ERROR;
+        }
+
+        case CSR_MATRIX:
+        case CSC_MATRIX: {
+            /* CSR rows are dot products for A x; CSC columns are dot
+             * products for A^T x.  The other two pairings scatter */
+            bool const gather = (a->format == CSR_MATRIX) != transpose;
+            if (!gather) {
+                _compressed_scatter(a, xd, yd, out_len);
+                return NO_ERROR;
+            }
+            const size_t* ptr = (a->format == CSR_MATRIX) ? a->rep.csr.row_ptr
+                                                          : a->rep.csc.col_ptr;
+            parts = _matrix_thread_count(num_threads, ptr[out_len] + out_len);
+            for (size_t r = 0u; r < parts; r++) {
+                tasks[r] = (_product_task_t){
+                    .a  = a, .x = xd, .y = yd,
+                    .lo = _nnz_split(ptr, out_len, parts, r),
+                    .hi = _nnz_split(ptr, out_len, parts, r + 1u)
+                };
+            }
+            _matrix_parallel(tasks, sizeof(tasks[0]), parts, _compressed_dot_task);
+            return NO_ERROR;
+        }
+
+        case BSR_MATRIX: {
+            if (transpose) {
+                _blocked_scatter(a, xd, yd, out_len);
+                return NO_ERROR;
+            }
+            const bsr_matrix_t* b   = &a->rep.bsr;
+            size_t const        nbr = (a->rows + b->block_rows - 1u) / b->block_rows;
+            size_t const        bs  = b->block_rows * b->block_cols;
+            parts = _matrix_thread_count(num_threads, b->block_ptr[nbr] * bs + a->rows);
+            for (size_t r = 0u; r < parts; r++) {
+                tasks[r] = (_product_task_t){
+                    .a  = a, .x = xd, .y = yd,
+                    .lo = _nnz_split(b->block_ptr, nbr, parts, r),
+                    .hi = _nnz_split(b->block_ptr, nbr, parts, r + 1u)
+                };
+            }
+            _matrix_parallel(tasks, sizeof(tasks[0]), parts, _bsr_spmv_task);
+            return NO_ERROR;
+        }
+
+        case SELL_MATRIX: {
+            if (transpose) {
+                _blocked_scatter(a, xd, yd, out_len);
+                return NO_ERROR;
+            }
+            const sell_matrix_t* s      = &a->rep.sell;
+            size_t const         slices = (a->rows + s->chunk - 1u) / s->chunk;
+            parts = _matrix_thread_count(num_threads, s->slice_ptr[slices] + a->rows);
+            for (size_t r = 0u; r < parts; r++) {
+                tasks[r] = (_product_task_t){
+                    .a  = a, .x = xd, .y = yd,
+                    .lo = _nnz_split(s->slice_ptr, slices, parts, r),
+                    .hi = _nnz_split(s->slice_ptr, slices, parts, r + 1u)
+                };
+            }
+            _matrix_parallel(tasks, sizeof(tasks[0]), parts, _sell_spmv_task);
+            return NO_ERROR;
+        }
+
+        default:
+            return INVALID_ARG;
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+/* Rows [lo, hi) of C = A B for dense A, B and C.  The rows are cleared,
+ * then built up one GEMM_KC x nc panel of B at a time: 4-row blocks go
+ * through the register-blocked kernel and the last 1-3 rows through axpy. */
+static void* _dense_gemm_task(void* arg) {
+    _product_task_t* t = (_product_task_t*)arg;
+    size_t const     k = t->a->cols;
+    size_t const     n = t->b->cols;
+    size_t const     ds = t->a->data_size;
+    size_t const     nc_max = GEMM_NC_BYTES / (GEMM_KC * ds);
+
+    memset(t->y + t->lo * n * ds, 0, (t->hi - t->lo) * n * ds);
+
+    for (size_t jc = 0u; jc < n; jc += nc_max) {
+        size_t const nc = (n - jc < nc_max) ? n - jc : nc_max;
+        for (size_t pc = 0u; pc < k; pc += GEMM_KC) {
+            size_t const kc = (k - pc < GEMM_KC) ? k - pc : GEMM_KC;
+
+            if (t->a->dtype == FLOAT_TYPE) {
+                const float* a = (const float*)t->a->rep.dense.data + pc;
+                const float* b = (const float*)t->b->rep.dense.data + pc * n + jc;
+                float*       c = (float*)t->y + jc;
+                size_t i = t->lo;
+                for (; i + 4u <= t->hi; i += 4u)
+                    simd_gemm4_float(c + i * n, n, a + i * k, k, b, n, kc, nc);
+                for (; i < t->hi; i++)
+                    for (size_t p = 0u; p < kc; p++)
+                        simd_axpy_float(c + i * n, b + p * n, a[i * k + p], nc);
+            } else {
+                const double* a = (const double*)t->a->rep.dense.data + pc;
+                const double* b = (const double*)t->b->rep.dense.data + pc * n + jc;
+                double*       c = (double*)t->y + jc;
+                size_t i = t->lo;
+                for (; i + 4u <= t->hi; i += 4u)
+                    simd_gemm4_double(c + i * n, n, a + i * k, k, b, n, kc, nc);
+                for (; i < t->hi; i++)
+                    for (size_t p = 0u; p < kc; p++)
+                        simd_axpy_double(c + i * n, b + p * n, a[i * k + p], nc);
+            }
+        }
+    }
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Rows [lo, hi) of C = A B for CSR A and dense B, C: each stored A[i][j]
+ * adds A[i][j] times row j of B into row i of C. */
+static void* _csr_dense_task(void* arg) {
+    _product_task_t* t   = (_product_task_t*)arg;
+    const size_t*    ptr = t->a->rep.csr.row_ptr;
+    const size_t*    col = t->a->rep.csr.col_idx;
+    size_t const     n   = t->b->cols;
+    size_t const     ds  = t->a->data_size;
+
+    memset(t->y + t->lo * n * ds, 0, (t->hi - t->lo) * n * ds);
+
+    if (t->a->dtype == FLOAT_TYPE) {
+        const float* v = (const float*)t->a->rep.csr.values;
+        const float* b = (const float*)t->b->rep.dense.data;
+        float*       c = (float*)t->y;
+        for (size_t i = t->lo; i < t->hi; i++)
+            for (size_t p = ptr[i]; p < ptr[i + 1u]; p++)
+                simd_axpy_float(c + i * n, b + col[p] * n, v[p], n);
+    } else {
+        const double* v = (const double*)t->a->rep.csr.values;
+        const double* b = (const double*)t->b->rep.dense.data;
+        double*       c = (double*)t->y;
+        for (size_t i = t->lo; i < t->hi; i++)
+            for (size_t p = ptr[i]; p < ptr[i + 1u]; p++)
+                simd_axpy_double(c + i * n, b + col[p] * n, v[p], n);
+    }
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+error_code_t matrix_multiply_into(matrix_t*       c,
+                                  const matrix_t* a,
+                                  const matrix_t* b,
+                                  size_t          num_threads) {
+    if (c == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    if (c == a || c == b)                    return INVALID_ARG;
+    if (b->format != DENSE_MATRIX || c->format != DENSE_MATRIX)
+        return INVALID_ARG;
+    if (a->dtype != b->dtype || a->dtype != c->dtype) return TYPE_MISMATCH;
+    if (!_is_simd_float_dtype(a->dtype))              return TYPE_MISMATCH;
+    if (a->cols != b->rows || c->rows != a->rows || c->cols != b->cols)
+        return SIZE_MISMATCH;
+
+    /* A single output column is a matrix-vector product */
+    if (b->cols == 1u && a->format != COO_MATRIX)
+        return matrix_multiply_vector(c, a, b, false, num_threads);
+
+    _product_task_t tasks[MATRIX_MAX_THREADS];
+    size_t          parts;
+
+    switch (a->format) {
+        case DENSE_MATRIX: {
+            size_t const work = (a->rows * a->cols > SIZE_MAX / b->cols)
+                                    ? SIZE_MAX : a->rows * a->cols * b->cols;
+            parts = _matrix_thread_count(num_threads, work);
+            for (size_t r = 0u; r < parts; r++) {
+                tasks[r] = (_product_task_t){
+                    .a  = a, .b = b, .y = c->rep.dense.data,
+                    .lo = _even_split(a->rows, parts, r, 4u),
+                    .hi = _even_split(a->rows, parts, r + 1u, 4u)
+                };
+            }
+            _matrix_parallel(tasks, sizeof(tasks[0]), parts, _dense_gemm_task);
+            return NO_ERROR;
+        }
+
+        case CSR_MATRIX: {
+            const size_t* ptr = a->rep.csr.row_ptr;
+            parts = _matrix_thread_count(num_threads, (ptr[a->rows] + a->rows) * b->cols);
+            for (size_t r = 0u; r < parts; r++) {
+                tasks[r] = (_product_task_t){
+                    .a  = a, .b = b, .y = c->rep.dense.data,
+                    .lo = _nnz_split(ptr, a->rows, parts, r),
+                    .hi = _nnz_split(ptr, a->rows, parts, r + 1u)
+                };
+            }
+            _matrix_parallel(tasks, sizeof(tasks[0]), parts, _csr_dense_task);
+            return NO_ERROR;
+        }
+
+        default:
+            return INVALID_ARG;
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+matrix_expect_t matrix_multiply(const matrix_t*    a,
+                                const matrix_t*    b,
+                                size_t             num_threads,
+                                allocator_vtable_t alloc_v) {
+    if (a == NULL || b == NULL)
+        return (matrix_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    if (!matrix_is_multiply_compatible(a, b))
+        return (matrix_expect_t){ .has_value = false,
+                                  .u.error = (a->dtype != b->dtype) ? TYPE_MISMATCH
+                                                                    : SIZE_MISMATCH };
+
+    /* Two compressed operands in the same format stay sparse */
+    if (_is_compressed_format(a) && a->format == b->format)
+        return matrix_sparse_multiply(a, b, num_threads, alloc_v);
+
+    allocator_vtable_t const av = (alloc_v.allocate != NULL) ? alloc_v : a->alloc_v;
+    matrix_expect_t r = init_dense_matrix(a->rows, b->cols, a->dtype, av);
+    if (!r.has_value) return r;
+
+    error_code_t err = matrix_multiply_into(r.u.value, a, b, num_threads);
+    if (err != NO_ERROR) {
+        return_matrix(r.u.value);
+        return (matrix_expect_t){ .has_value = false, .u.error = err };
+    }
+    return r;
+}
+
+// ================================================================================
+// Sparse products and sums
+// ================================================================================
+
+/* Above this minor extent the SpGEMM accumulator switches from a dense
+ * per-thread array to an open-addressing hash sized to each row's work. */
+#define SPGEMM_DENSE_WIDTH   (1u << 18)
+
+// --------------------------------------------------------------------------------
+
+/* A CSR matrix or a CSC one read as the CSR form of its transpose:
+ * lines are rows (CSR) or columns (CSC), width the extent of the other
+ * dimension. */
+typedef struct {
+    size_t         lines;
+    size_t         width;
+    const size_t*  ptr;
+    const size_t*  idx;
+    const uint8_t* values;
+} _compressed_view_t;
+
+// --------------------------------------------------------------------------------
+
+static _compressed_view_t _compressed_view(const matrix_t* mat) {
+    if (mat->format == CSR_MATRIX) {
+        return (_compressed_view_t){ .lines = mat->rows, .width = mat->cols,
+                                     .ptr = mat->rep.csr.row_ptr,
+                                     .idx = mat->rep.csr.col_idx,
+                                     .values = mat->rep.csr.values };
+    }
+    return (_compressed_view_t){ .lines = mat->cols, .width = mat->rows,
+                                 .ptr = mat->rep.csc.col_ptr,
+                                 .idx = mat->rep.csc.row_idx,
+                                 .values = mat->rep.csc.values };
+}
+
+
+// --------------------------------------------------------------------------------
+
+/* Sparse accumulator mapping the minor indices touched by one output line
+ * to a slot.  Dense mode indexes keys and slots by column and marks
+ * membership with a tag bumped on every reset, so nothing is cleared
+ * between lines.  Hash mode probes a power-of-two table that is cleared per line,
+ * sized to that line's work rather than to the matrix width. */
+typedef struct {
+    size_t* keys;
+    size_t* slots;
+    size_t  cap;     /* hash table capacity; 0 selects dense mode */
+    size_t  mask;
+    size_t  tag;
+} _spa_t;
+
+// --------------------------------------------------------------------------------
+
+static size_t _pow2_at_least(size_t n) {
+    size_t p = 16u;
+    while (p < n) p <<= 1u;
+    return p;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Start a new output line touching at most work indices */
+static void _spa_reset(_spa_t* s, size_t work) {
+    s->tag++;
+    if (s->cap == 0u) return;
+    s->mask = _pow2_at_least(2u * work) - 1u;
+    memset(s->keys, 0xFF, (s->mask + 1u) * sizeof(size_t));
+}
+
+// --------------------------------------------------------------------------------
+
+static inline size_t _spa_hash(size_t j, size_t mask) {
+    return (size_t)(((uint64_t)j * 0x9E3779B97F4A7C15ull) >> 17) & mask;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Slot for index j, added if absent; *added reports which */
+static inline size_t* _spa_insert(_spa_t* s, size_t j, bool* added) {
+    if (s->cap == 0u) {
+        *added = s->keys[j] != s->tag;
+        s->keys[j] = s->tag;
+        return &s->slots[j];
+    }
+    size_t h = _spa_hash(j, s->mask);
+    while (s->keys[h] != SIZE_MAX && s->keys[h] != j) h = (h + 1u) & s->mask;
+    *added = s->keys[h] == SIZE_MAX;
+    s->keys[h] = j;
+    return &s->slots[h];
+}
+
+// --------------------------------------------------------------------------------
+
+/* Slot for index j, or NULL if it was never inserted for this line */
+static inline size_t* _spa_find(_spa_t* s, size_t j) {
+    if (s->cap == 0u) return (s->keys[j] == s->tag) ? &s->slots[j] : NULL;
+    size_t h = _spa_hash(j, s->mask);
+    while (s->keys[h] != SIZE_MAX) {
+        if (s->keys[h] == j) return &s->slots[h];
+        h = (h + 1u) & s->mask;
+    }
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Upper bound on the entries of output line i: the sum of the lengths of
+ * the right-hand lines it draws on */
+static inline size_t _spgemm_line_work(const _compressed_view_t* l,
+                                       const _compressed_view_t* r, size_t i) {
+    size_t w = 0u;
+    for (size_t p = l->ptr[i]; p < l->ptr[i + 1u]; p++)
+        w += r->ptr[l->idx[p] + 1u] - r->ptr[l->idx[p]];
+    return w;
+}
+
+// --------------------------------------------------------------------------------
+
+/* One thread's share of an SpGEMM phase over output lines [lo, hi).
+ * l and r are the operands in product order, out the result structure. */
+typedef struct {
+    _compressed_view_t l;
+    _compressed_view_t r;
+    _compressed_view_t out;
+    size_t*            out_ptr;
+    size_t*            out_idx;
+    uint8_t*           out_val;
+    dtype_id_t         dtype;
+    _spa_t             spa;
+    size_t             lo;
+    size_t             hi;
+    error_code_t       err;
+} _spgemm_task_t;
+
+// --------------------------------------------------------------------------------
+
+/* Symbolic pass 1: out_ptr[i + 1] = number of distinct output indices */
+static void* _spgemm_count_task(void* arg) {
+    _spgemm_task_t* t = (_spgemm_task_t*)arg;
+    bool added;
+
+    for (size_t i = t->lo; i < t->hi; i++) {
+        _spa_reset(&t->spa, _spgemm_line_work(&t->l, &t->r, i));
+        size_t n = 0u;
+        for (size_t p = t->l.ptr[i]; p < t->l.ptr[i + 1u]; p++) {
+            size_t const k = t->l.idx[p];
+            for (size_t q = t->r.ptr[k]; q < t->r.ptr[k + 1u]; q++) {
+                (void)_spa_insert(&t->spa, t->r.idx[q], &added);
+                n += added;
+            }
+        }
+        t->out_ptr[i + 1u] = n;
+    }
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Symbolic pass 2: write each line's distinct indices, sorted */
+static void* _spgemm_fill_task(void* arg) {
+    _spgemm_task_t* t = (_spgemm_task_t*)arg;
+    bool added;
+
+    for (size_t i = t->lo; i < t->hi; i++) {
+        _spa_reset(&t->spa, _spgemm_line_work(&t->l, &t->r, i));
+        size_t* out = t->out_idx + t->out_ptr[i];
+        size_t  n   = 0u;
+        for (size_t p = t->l.ptr[i]; p < t->l.ptr[i + 1u]; p++) {
+            size_t const k = t->l.idx[p];
+            for (size_t q = t->r.ptr[k]; q < t->r.ptr[k + 1u]; q++) {
+                (void)_spa_insert(&t->spa, t->r.idx[q], &added);
+                if (added) out[n++] = t->r.idx[q];
+            }
+        }
+        qsort(out, n, sizeof(size_t), _compare_index);
+    }
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Numeric phase: map each index of the existing output line to its
+ * position, then accumulate the products in place.  A product landing
+ * outside the structure sets ILLEGAL_STATE. */
+#define SPGEMM_NUMERIC_LINE(T)                                                 \
+    do {                                                                       \
+        const T* lv  = (const T*)t->l.values;                                  \
+        const T* rv  = (const T*)t->r.values;                                  \
+        T*       out = (T*)t->out_val;                                         \
+        for (size_t p = t->l.ptr[i]; p < t->l.ptr[i + 1u]; p++) {              \
+            size_t const k = t->l.idx[p];                                      \
+            T const      s = lv[p];                                            \
+            for (size_t q = t->r.ptr[k]; q < t->r.ptr[k + 1u]; q++) {          \
+                size_t* slot = _spa_find(&t->spa, t->r.idx[q]);                \
+                if (slot == NULL) { t->err = ILLEGAL_STATE; return NULL; }     \
+                out[*slot] += s * rv[q];                                       \
+            }                                                                  \
+        }                                                                      \
+    } while (0)
+
+static void* _spgemm_numeric_task(void* arg) {
+    _spgemm_task_t* t  = (_spgemm_task_t*)arg;
+    size_t const    ds = (t->dtype == FLOAT_TYPE) ? sizeof(float) : sizeof(double);
+    bool added;
+
+    for (size_t i = t->lo; i < t->hi; i++) {
+        size_t const c0 = t->out.ptr[i];
+        size_t const c1 = t->out.ptr[i + 1u];
+
+        _spa_reset(&t->spa, c1 - c0);
+        for (size_t p = c0; p < c1; p++)
+            *_spa_insert(&t->spa, t->out.idx[p], &added) = p;
+        memset(t->out_val + c0 * ds, 0, (c1 - c0) * ds);
+
+        if (t->dtype == FLOAT_TYPE) SPGEMM_NUMERIC_LINE(float);
+        else                        SPGEMM_NUMERIC_LINE(double);
+    }
+    return NULL;
+}
+
+#undef SPGEMM_NUMERIC_LINE
+
+// --------------------------------------------------------------------------------
+
+/* Validate a sparse product and orient it: for CSC operands C^T = B^T A^T,
+ * so the CSR machinery runs on (B, A) read as their transposes. */
+static error_code_t _spgemm_operands(const matrix_t* a, const matrix_t* b,
+                                     _compressed_view_t* l,
+                                     _compressed_view_t* r) {
+    if (a == NULL || b == NULL)                   return NULL_POINTER;
+    if (!_is_compressed_format(a) || a->format != b->format)
+        return INVALID_ARG;
+    if (a->dtype != b->dtype)                     return TYPE_MISMATCH;
+    if (a->cols != b->rows)                       return SIZE_MISMATCH;
+
+    if (a->format == CSR_MATRIX) {
+        *l = _compressed_view(a);
+        *r = _compressed_view(b);
+    } else {
+        *l = _compressed_view(b);
+        *r = _compressed_view(a);
+    }
+    return NO_ERROR;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Split the output lines of l * r between parts tasks, balanced by the
+ * nonzeros of l, and give each an accumulator carved out of one scratch
+ * allocation.  extra is added to each line's work bound when sizing hash
+ * tables (the numeric phase also inserts the output structure).  Returns
+ * the scratch block, or NULL on allocation failure. */
+static void* _spgemm_plan(_spgemm_task_t* tasks, size_t parts,
+                          const _compressed_view_t* l,
+                          const _compressed_view_t* r,
+                          const size_t* extra_ptr,
+                          allocator_vtable_t alloc_v) {
+    bool const dense = r->width <= SPGEMM_DENSE_WIDTH;
+    size_t     need[MATRIX_MAX_THREADS];
+    size_t     total = 0u;
+
+    for (size_t p = 0u; p < parts; p++) {
+        tasks[p].lo = _nnz_split(l->ptr, l->lines, parts, p);
+        tasks[p].hi = _nnz_split(l->ptr, l->lines, parts, p + 1u);
+
+        if (dense) {
+            need[p] = r->width;
+        } else {
+            size_t w = 0u;
+            for (size_t i = tasks[p].lo; i < tasks[p].hi; i++) {
+                size_t wi = _spgemm_line_work(l, r, i);
+                if (extra_ptr != NULL) wi += extra_ptr[i + 1u] - extra_ptr[i];
+                if (wi > w) w = wi;
+            }
+            need[p] = _pow2_at_least(2u * w);
+        }
+        total += need[p];
+    }
+
+    void_ptr_expect_t sr = alloc_v.allocate(alloc_v.ctx,
+                                            2u * total * sizeof(size_t), false);
+    if (!sr.has_value) return NULL;
+
+    size_t* block = (size_t*)sr.u.value;
+    if (dense) memset(block, 0xFF, 2u * total * sizeof(size_t));
+
+    for (size_t p = 0u; p < parts; p++) {
+        tasks[p].spa = (_spa_t){ .keys  = block,
+                                 .slots = block + need[p],
+                                 .cap   = dense ? 0u : need[p] };
+        block += 2u * need[p];
+    }
+    return sr.u.value;
+}
+
+// --------------------------------------------------------------------------------
+
+matrix_expect_t matrix_spgemm_symbolic(const matrix_t*    a,
+                                       const matrix_t*    b,
+                                       size_t             num_threads,
+                                       allocator_vtable_t alloc_v) {
+    _compressed_view_t l, r;
+    error_code_t err = _spgemm_operands(a, b, &l, &r);
+    if (err != NO_ERROR)
+        return (matrix_expect_t){ .has_value = false, .u.error = err };
+
+    allocator_vtable_t const av = (alloc_v.allocate != NULL) ? alloc_v : a->alloc_v;
+
+    void_ptr_expect_t pr = av.allocate(av.ctx, (l.lines + 1u) * sizeof(size_t), true);
+    if (!pr.has_value)
+        return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
+    size_t* ptr = (size_t*)pr.u.value;
+
+    _spgemm_task_t tasks[MATRIX_MAX_THREADS];
+    size_t const   parts = _matrix_thread_count(num_threads, l.ptr[l.lines] + l.lines);
+    for (size_t p = 0u; p < parts; p++)
+        tasks[p] = (_spgemm_task_t){ .l = l, .r = r, .out_ptr = ptr };
+
+    void* scratch = _spgemm_plan(tasks, parts, &l, &r, NULL, av);
+    if (scratch == NULL) {
+        av.return_element(av.ctx, ptr);
+        return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
+    }
+
+    _matrix_parallel(tasks, sizeof(tasks[0]), parts, _spgemm_count_task);
+    _counts_to_offsets(ptr, l.lines);
+
+    matrix_expect_t out = _alloc_compressed_matrix(a->format, a->rows, b->cols,
+                                                   a->dtype, a->data_size, ptr, av);
+    if (out.has_value) {
+        size_t* idx = (a->format == CSR_MATRIX) ? out.u.value->rep.csr.col_idx
+                                                : out.u.value->rep.csc.row_idx;
+        for (size_t p = 0u; p < parts; p++) tasks[p].out_idx = idx;
+        _matrix_parallel(tasks, sizeof(tasks[0]), parts, _spgemm_fill_task);
+    }
+
+    av.return_element(av.ctx, scratch);
+    return out;
+}
+
+// --------------------------------------------------------------------------------
+
+error_code_t matrix_spgemm_numeric(matrix_t*       c,
+                                   const matrix_t* a,
+                                   const matrix_t* b,
+                                   size_t          num_threads) {
+    if (c == NULL) return NULL_POINTER;
+
+    _compressed_view_t l, r;
+    error_code_t err = _spgemm_operands(a, b, &l, &r);
+    if (err != NO_ERROR) return err;
+
+    if (c == a || c == b || c->format != a->format) return INVALID_ARG;
+    if (c->dtype != a->dtype)                        return TYPE_MISMATCH;
+    if (!_is_simd_float_dtype(a->dtype))             return TYPE_MISMATCH;
+    if (c->rows != a->rows || c->cols != b->cols)    return SIZE_MISMATCH;
+
+    _compressed_view_t const out = _compressed_view(c);
+
+    _spgemm_task_t tasks[MATRIX_MAX_THREADS];
+    size_t const   parts = _matrix_thread_count(num_threads, l.ptr[l.lines] + l.lines);
+    for (size_t p = 0u; p < parts; p++) {
+        tasks[p] = (_spgemm_task_t){ .l = l, .r = r, .out = out,
+                                     .out_val = (uint8_t*)out.values,
+                                     .dtype = a->dtype, .err = NO_ERROR };
+    }
+
+    /* The numeric table holds the output line's indices, which a valid
+     * structure makes a subset of the line's work bound; adding them
+     * keeps probing bounded even for a structure with extra entries. */
+    void* scratch = _spgemm_plan(tasks, parts, &l, &r, out.ptr, c->alloc_v);
+    if (scratch == NULL) return OUT_OF_MEMORY;
+
+    _matrix_parallel(tasks, sizeof(tasks[0]), parts, _spgemm_numeric_task);
+    c->alloc_v.return_element(c->alloc_v.ctx, scratch);
+
+    for (size_t p = 0u; p < parts; p++)
+        if (tasks[p].err != NO_ERROR) return tasks[p].err;
+    return NO_ERROR;
+}
+
+// --------------------------------------------------------------------------------
+
+matrix_expect_t matrix_sparse_multiply(const matrix_t*    a,
+                                       const matrix_t*    b,
+                                       size_t             num_threads,
+                                       allocator_vtable_t alloc_v) {
+    if (a != NULL && b != NULL && !_is_simd_float_dtype(a->dtype))
+        return (matrix_expect_t){ .has_value = false, .u.error = TYPE_MISMATCH };
+
+    matrix_expect_t r = matrix_spgemm_symbolic(a, b, num_threads, alloc_v);
+    if (!r.has_value) return r;
+
+    error_code_t err = matrix_spgemm_numeric(r.u.value, a, b, num_threads);
+    if (err != NO_ERROR) {
+        return_matrix(r.u.value);
+        return (matrix_expect_t){ .has_value = false, .u.error = err };
+    }
+    return r;
+}
+
+// --------------------------------------------------------------------------------
+
+/* One thread's share of a sparse sum over lines [lo, hi) */
+typedef struct {
+    _compressed_view_t a;
+    _compressed_view_t b;
+    size_t*            out_ptr;
+    size_t*            out_idx;
+    uint8_t*           out_val;
+    dtype_id_t         dtype;
+    bool               subtract;
+    size_t             lo;
+    size_t             hi;
+} _sparse_sum_task_t;
+
+// --------------------------------------------------------------------------------
+
+/* Pass 1: out_ptr[i + 1] = size of the union of the two lines' indices */
+static void* _sparse_sum_count_task(void* arg) {
+    _sparse_sum_task_t* t = (_sparse_sum_task_t*)arg;
+
+    for (size_t i = t->lo; i < t->hi; i++) {
+        size_t p = t->a.ptr[i], pe = t->a.ptr[i + 1u];
+        size_t q = t->b.ptr[i], qe = t->b.ptr[i + 1u];
+        size_t n = 0u;
+        while (p < pe && q < qe) {
+            size_t const ja = t->a.idx[p];
+            size_t const jb = t->b.idx[q];
+            p += (ja <= jb);
+            q += (jb <= ja);
+            n++;
+        }
+        t->out_ptr[i + 1u] = n + (pe - p) + (qe - q);
+    }
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Pass 2: merge the sorted lines, combining entries that share an index */
+#define SPARSE_SUM_LINE(T)                                                     \
+    do {                                                                       \
+        const T* av  = (const T*)t->a.values;                                  \
+        const T* bv  = (const T*)t->b.values;                                  \
+        T*       ov  = (T*)t->out_val;                                         \
+        T const  sgn = t->subtract ? (T)-1 : (T)1;                             \
+        while (p < pe || q < qe) {                                             \
+            size_t const ja = (p < pe) ? t->a.idx[p] : SIZE_MAX;               \
+            size_t const jb = (q < qe) ? t->b.idx[q] : SIZE_MAX;               \
+            if (ja < jb)      { ov[o] = av[p++];                 idx[o] = ja; }\
+            else if (jb < ja) { ov[o] = sgn * bv[q++];           idx[o] = jb; }\
+            else              { ov[o] = av[p++] + sgn * bv[q++]; idx[o] = ja; }\
+            o++;                                                               \
+        }                                                                      \
+    } while (0)
+
+static void* _sparse_sum_fill_task(void* arg) {
+    _sparse_sum_task_t* t   = (_sparse_sum_task_t*)arg;
+    size_t*             idx = t->out_idx;
+
+    for (size_t i = t->lo; i < t->hi; i++) {
+        size_t p = t->a.ptr[i], pe = t->a.ptr[i + 1u];
+        size_t q = t->b.ptr[i], qe = t->b.ptr[i + 1u];
+        size_t o = t->out_ptr[i];
+        if (t->dtype == FLOAT_TYPE) SPARSE_SUM_LINE(float);
+        else                        SPARSE_SUM_LINE(double);
+    }
+    return NULL;
+}
+
+#undef SPARSE_SUM_LINE
+
+// --------------------------------------------------------------------------------
+
+static matrix_expect_t _sparse_sum(const matrix_t*    a,
+                                   const matrix_t*    b,
+                                   bool               subtract,
+                                   size_t             num_threads,
+                                   allocator_vtable_t alloc_v) {
+    if (a == NULL || b == NULL)
+        return (matrix_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    if (!_is_compressed_format(a) || a->format != b->format)
+        return (matrix_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    if (a->dtype != b->dtype || !_is_simd_float_dtype(a->dtype))
+        return (matrix_expect_t){ .has_value = false, .u.error = TYPE_MISMATCH };
+    if (a->rows != b->rows || a->cols != b->cols)
+        return (matrix_expect_t){ .has_value = false, .u.error = SIZE_MISMATCH };
+
+    allocator_vtable_t const av = (alloc_v.allocate != NULL) ? alloc_v : a->alloc_v;
+    _compressed_view_t const va = _compressed_view(a);
+    _compressed_view_t const vb = _compressed_view(b);
+
+    void_ptr_expect_t pr = av.allocate(av.ctx, (va.lines + 1u) * sizeof(size_t), true);
+    if (!pr.has_value)
+        return (matrix_expect_t){ .has_value = false, .u.error = OUT_OF_MEMORY };
+    size_t* ptr = (size_t*)pr.u.value;
+
+    _sparse_sum_task_t tasks[MATRIX_MAX_THREADS];
+    size_t const parts = _matrix_thread_count(num_threads,
+                                              va.ptr[va.lines] + vb.ptr[vb.lines] + va.lines);
+    for (size_t p = 0u; p < parts; p++) {
+        tasks[p] = (_sparse_sum_task_t){
+            .a = va, .b = vb, .out_ptr = ptr, .dtype = a->dtype, .subtract = subtract,
+            .lo = _nnz_split(va.ptr, va.lines, parts, p),
+            .hi = _nnz_split(va.ptr, va.lines, parts, p + 1u)
+        };
+    }
+
+    _matrix_parallel(tasks, sizeof(tasks[0]), parts, _sparse_sum_count_task);
+    _counts_to_offsets(ptr, va.lines);
+
+    matrix_expect_t out = _alloc_compressed_matrix(a->format, a->rows, a->cols,
+                                                   a->dtype, a->data_size, ptr, av);
+    if (!out.has_value) return out;
+
+    for (size_t p = 0u; p < parts; p++) {
+        if (a->format == CSR_MATRIX) {
+            tasks[p].out_idx = out.u.value->rep.csr.col_idx;
+            tasks[p].out_val = out.u.value->rep.csr.values;
+        } else {
+            tasks[p].out_idx = out.u.value->rep.csc.row_idx;
+            tasks[p].out_val = out.u.value->rep.csc.values;
+        }
+    }
+    _matrix_parallel(tasks, sizeof(tasks[0]), parts, _sparse_sum_fill_task);
+    return out;
+}
+
+// --------------------------------------------------------------------------------
+
+matrix_expect_t matrix_sparse_add(const matrix_t*    a,
+                                  const matrix_t*    b,
+                                  size_t             num_threads,
+                                  allocator_vtable_t alloc_v) {
+    return _sparse_sum(a, b, false, num_threads, alloc_v);
+}
+
+// --------------------------------------------------------------------------------
+
+matrix_expect_t matrix_sparse_subtract(const matrix_t*    a,
+                                       const matrix_t*    b,
+                                       size_t             num_threads,
+                                       allocator_vtable_t alloc_v) {
+    return _sparse_sum(a, b, true, num_threads, alloc_v);
+}
+
 // ================================================================================
 // ================================================================================
 // eof
@@ -0,0 +1,145 @@
+// ================================================================================
+// ================================================================================
+// - File:    c_simd.c
+// - Purpose: Runtime selection of the SIMD kernel tier used by the library.
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 16, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2026, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "c_simd.h"
+#include "simd_dispatch.h"
+
+#include <stdlib.h>
+#include <string.h>
+// ================================================================================
+// ================================================================================
+
+static const char* const simd_names[] = {
+    "scalar", "sse2", "ssse3", "sse41", "avx", "avx2", "avx512",
+    "neon", "sve", "sve2"
+};
+// --------------------------------------------------------------------------------
+
+const char* simd_isa_name(simd_isa_t isa) {
+    if ((unsigned)isa >= sizeof(simd_names) / sizeof(simd_names[0]))
+        return "unknown";
+    return simd_names[isa];
+}
+// ================================================================================
+// ================================================================================
+#if defined(CSALT_SIMD_DISPATCH)
+
+_Atomic(const simd_kernels_t*) simd_kernel_table = NULL;
+// --------------------------------------------------------------------------------
+
+static const simd_kernels_t* _simd_table_for(simd_isa_t isa) {
+    switch (isa) {
+        case SIMD_SSE2:   return &simd_kernels_sse2;
+        case SIMD_SSSE3:  return &simd_kernels_ssse3;
+        case SIMD_SSE41:  return &simd_kernels_sse41;
+        case SIMD_AVX:    return &simd_kernels_avx;
+        case SIMD_AVX2:   return &simd_kernels_avx2;
+        case SIMD_AVX512: return &simd_kernels_avx512;
+        default:          return NULL;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* __builtin_cpu_supports also confirms the OS saves the wider register
+ * state (XGETBV), so an AVX-capable CPU under an AVX-unaware kernel is
+ * reported as unsupported. */
+static bool _simd_host_supports(simd_isa_t isa) {
+    __builtin_cpu_init();
+    switch (isa) {
+        case SIMD_SSE2:   return __builtin_cpu_supports("sse2");
+        case SIMD_SSSE3:  return __builtin_cpu_supports("ssse3");
+        case SIMD_SSE41:  return __builtin_cpu_supports("sse4.1");
+        case SIMD_AVX:    return __builtin_cpu_supports("avx");
+        case SIMD_AVX2:   return __builtin_cpu_supports("avx2");
+        case SIMD_AVX512: return __builtin_cpu_supports("avx512f")  &&
+                                 __builtin_cpu_supports("avx512bw") &&
+                                 __builtin_cpu_supports("avx512vl") &&
+                                 __builtin_cpu_supports("bmi");
+        default:          return false;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* Upper bound requested through CSALT_SIMD_ISA, or SIMD_AVX512 if unset
+ * or unrecognised. */
+static simd_isa_t _simd_env_cap(void) {
+    const char* env = getenv("CSALT_SIMD_ISA");
+    if (env == NULL) return SIMD_AVX512;
+
+    for (simd_isa_t isa = SIMD_SSE2; isa <= SIMD_AVX512; isa++) {
+        if (strcmp(env, simd_names[isa]) == 0) return isa;
+    }
+    return SIMD_AVX512;
+}
+// --------------------------------------------------------------------------------
+
+const simd_kernels_t* simd_resolve_kernels(void) {
+    simd_isa_t best = SIMD_SSE2;
+    simd_isa_t cap  = _simd_env_cap();
+
+    for (simd_isa_t isa = cap; isa > SIMD_SSE2; isa--) {
+        if (_simd_host_supports(isa)) {
+            best = isa;
+            break;
+        }
+    }
+
+    /* Racing first calls all compute the same table, so whichever store
+     * lands is correct; a table installed by simd_select_isa() wins. */
+    const simd_kernels_t* expected = NULL;
+    const simd_kernels_t* table    = _simd_table_for(best);
+    if (!atomic_compare_exchange_strong_explicit(&simd_kernel_table,
+                                                 &expected, table,
+                                                 memory_order_acq_rel,
+                                                 memory_order_acquire)) {
+        return expected;
+    }
+    return table;
+}
+// --------------------------------------------------------------------------------
+
+bool simd_isa_available(simd_isa_t isa) {
+    return _simd_table_for(isa) != NULL && _simd_host_supports(isa);
+}
+// --------------------------------------------------------------------------------
+
+error_code_t simd_select_isa(simd_isa_t isa) {
+    if (!simd_isa_available(isa)) return UNSUPPORTED;
+    atomic_store_explicit(&simd_kernel_table, _simd_table_for(isa),
+                          memory_order_release);
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+#else
+
+bool simd_isa_available(simd_isa_t isa) {
+    return isa == simd_kernels_native.isa;
+}
+// --------------------------------------------------------------------------------
+
+error_code_t simd_select_isa(simd_isa_t isa) {
+    return simd_isa_available(isa) ? NO_ERROR : UNSUPPORTED;
+}
+
+#endif /* CSALT_SIMD_DISPATCH */
+// ================================================================================
+// ================================================================================
+
+simd_isa_t simd_active_isa(void) {
+    return simd_kernels()->isa;
+}
+// ================================================================================
+// ================================================================================
+// eof
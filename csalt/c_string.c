@@ -16,47 +16,8 @@
 #include <string.h>
 #include "c_string.h"
 
-/* SIMD backend selection for byte/char ops */
-
-#if defined(__AVX512BW__) && defined(__AVX512VL__)
-  #include <immintrin.h>
-  #include "simd_avx512_char.inl"
-
-#elif defined(__AVX2__)
-  #include <immintrin.h>
-  #include "simd_avx2_char.inl"
-
-#elif defined(__AVX__)
-  #include <immintrin.h>
-  #include "simd_avx_char.inl"
-
-#elif defined(__SSE4_1__)
-  #include <immintrin.h>
-  #include "simd_sse41_char.inl"
-
-#elif defined(__SSE3__)
-  #include <immintrin.h>
-  #include "simd_sse3_char.inl"
-
-#elif defined(__SSE2__)
-  #include <immintrin.h>
-  #include "simd_sse2_char.inl"
-
-#elif defined(__ARM_FEATURE_SVE2)
-  #include <arm_sve.h>
-  #include "simd_sve2_char.inl"
-
-#elif defined(__ARM_FEATURE_SVE)
-  #include <arm_sve.h>
-  #include "simd_sve_char.inl"
-
-#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
-  #include <arm_neon.h>
-  #include "simd_neon_char.inl"
-
-#else
-  #include "simd_scalar_char.inl"
-#endif
+/* SIMD kernels for byte/char ops are selected at runtime (c_simd.c) */
+#include "simd_dispatch.h"
 
 // ================================================================================ 
 // ================================================================================ 
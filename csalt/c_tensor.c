@@ -15,27 +15,16 @@
 
 #include "c_tensor.h"
 
-#if defined(__AVX512BW__)
-#  include "simd_avx512_uint8.inl"
-#elif defined(__AVX2__)
-#  include "simd_avx2_uint8.inl"
-#elif defined(__AVX__)
-#  include "simd_avx_uint8.inl"
-#elif defined(__SSE4_1__)
-#  include "simd_sse41_uint8.inl"
-#elif defined(__SSSE3__)
-#  include "simd_sse3_uint8.inl"
-#elif defined(__SSE2__)
-#  include "simd_sse2_uint8.inl"
-#elif defined(__ARM_FEATURE_SVE2)
-#  include "simd_sve2_uint8.inl"
-#elif defined(__ARM_FEATURE_SVE)
-#  include "simd_sve_uint8.inl"
-#elif defined(__ARM_NEON)
-#  include "simd_neon_uint8.inl"
-#else
-#  include "simd_scalar_uint8.inl"
-#endif
+#include "simd_dispatch.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -105,6 +94,25 @@ static error_code_t _ensure_capacity(tensor_t* t) {
     size_t new_alloc = _compute_new_alloc(t->alloc);
     return _grow_array(t, new_alloc);
 }
+
+// ================================================================================
+// Internal bulk capacity helper
+//
+// Ensures room for needed elements in a single reallocation, growing to the
+// larger of the tiered size and needed so that a bulk append never pays for
+// more than one copy of the existing buffer.
+// ================================================================================
+
+static error_code_t _reserve_array(tensor_t* t, size_t needed) {
+    if (needed <= t->alloc) return NO_ERROR;
+
+    if (t->growth == false)              return CAPACITY_OVERFLOW;
+    if (t->alloc_v.reallocate == NULL)   return CAPACITY_OVERFLOW;
+
+    size_t tiered    = _compute_new_alloc(t->alloc);
+    size_t new_alloc = (tiered > needed) ? tiered : needed;
+    return _grow_array(t, new_alloc);
+}
 // ================================================================================ 
 // ================================================================================ 
 // INITIALIZATION AND TEARDOWN
@@ -401,14 +409,8 @@ error_code_t concat_tensor_array(tensor_t*       dst,
 
     size_t needed = dst->len + src->len;
 
-    if (needed > dst->alloc) {
-        if (dst->growth == false)            return CAPACITY_OVERFLOW;
-        if (dst->alloc_v.reallocate == NULL) return CAPACITY_OVERFLOW;
-        size_t tiered    = _compute_new_alloc(dst->alloc);
-        size_t new_alloc = (tiered > needed) ? tiered : needed;
-        error_code_t err = _grow_array(dst, new_alloc);
-        if (err != NO_ERROR) return err;
-    }
+    error_code_t err = _reserve_array(dst, needed);
+    if (err != NO_ERROR) return err;
 
     memcpy(dst->data + dst->len * dst->data_size,
            src->data,
@@ -675,6 +677,435 @@ error_code_t sort_tensor(tensor_t* array,
     _quicksort(array->data, 0u, array->len - 1u, array->data_size, cmp, dir);
     return NO_ERROR;
 }
+// --------------------------------------------------------------------------------
+
+/*
+ * Parallel sort
+ *
+ * A stable merge sort split across a handful of threads.  The element range
+ * is cut into one run per thread; each thread sorts its run with insertion
+ * sorted blocks merged bottom-up through the scratch buffer.  The runs are
+ * then merged pairwise in log2(threads) rounds.  Within a round every
+ * thread owns an equal slice of the output and locates the matching input
+ * positions by binary search (co-ranking), so the work stays balanced no
+ * matter how the keys are distributed.  Each phase uses fresh threads and
+ * joins them before the next, so no barrier is needed; if a thread cannot
+ * be created its share of the phase runs on the calling thread instead.
+ */
+#define PSORT_MAX_THREADS     64u
+#define PSORT_MIN_PER_THREAD  4096u   /* smaller runs are not worth a thread */
+#define PSORT_BLOCK           32u     /* insertion sorted before merging    */
+
+typedef struct {
+    uint8_t*    data;
+    uint8_t*    scratch;
+    size_t      len;
+    size_t      data_size;
+    size_t      threads;
+    int       (*cmp)(const void*, const void*);
+    direction_t dir;
+} _psort_ctx_t;
+
+typedef struct {
+    const _psort_ctx_t* ctx;
+    size_t              id;
+    size_t              width;   /* runs per merge input this round */
+    const uint8_t*      src;
+    uint8_t*            dst;
+} _psort_task_t;
+// --------------------------------------------------------------------------------
+
+/* First element of block r when len elements are split into `parts` blocks
+ * whose sizes differ by at most one. */
+static inline size_t _block_start(size_t len, size_t parts, size_t r) {
+    if (r >= parts) return len;
+    size_t const base = len / parts;
+    size_t const rem  = len % parts;
+    return r * base + (r < rem ? r : rem);
+}
+// --------------------------------------------------------------------------------
+
+/* First element of run r when len elements are split into `threads` runs. */
+static inline size_t _psort_run_start(const _psort_ctx_t* c, size_t r) {
+    return _block_start(c->len, c->threads, r);
+}
+// --------------------------------------------------------------------------------
+
+static inline void _copy_element(uint8_t* dst, const uint8_t* src, size_t data_size) {
+    switch (data_size) {
+        case 1u: *dst = *src;             break;
+        case 2u: memcpy(dst, src, 2u);    break;
+        case 4u: memcpy(dst, src, 4u);    break;
+        case 8u: memcpy(dst, src, 8u);    break;
+        default: memcpy(dst, src, data_size);
+    }
+}
+// --------------------------------------------------------------------------------
+
+/*
+ * Merge a[0..na) and b[0..nb) into out.  Ties take from a, which keeps the
+ * merge stable because a always precedes b in the original order.
+ */
+static void _psort_merge(const _psort_ctx_t* c,
+                         const uint8_t* a, size_t na,
+                         const uint8_t* b, size_t nb,
+                         uint8_t* out) {
+    size_t const ds = c->data_size;
+    size_t i = 0u, j = 0u;
+
+    while (i < na && j < nb) {
+        if (_apply_dir(c->cmp(b + j * ds, a + i * ds), c->dir) < 0) {
+            _copy_element(out, b + j * ds, ds);
+            j++;
+        } else {
+            _copy_element(out, a + i * ds, ds);
+            i++;
+        }
+        out += ds;
+    }
+    if (i < na) memcpy(out, a + i * ds, (na - i) * ds);
+    else if (j < nb) memcpy(out, b + j * ds, (nb - j) * ds);
+}
+// --------------------------------------------------------------------------------
+
+/*
+ * Number of elements taken from a when the first k outputs of the stable
+ * merge of a[0..na) and b[0..nb) have been written.
+ */
+static size_t _psort_co_rank(const _psort_ctx_t* c, size_t k,
+                             const uint8_t* a, size_t na,
+                             const uint8_t* b, size_t nb) {
+    size_t const ds = c->data_size;
+    size_t lo = (k > nb) ? k - nb : 0u;
+    size_t hi = (k < na) ? k : na;
+
+    while (lo < hi) {
+        size_t const i = lo + (hi - lo) / 2u;
+        size_t const j = k - i;
+        /* b[j-1] must precede a[i] strictly, otherwise a[i] belongs earlier */
+        if (j > 0u && _apply_dir(c->cmp(b + (j - 1u) * ds, a + i * ds), c->dir) >= 0)
+            lo = i + 1u;
+        else
+            hi = i;
+    }
+    return lo;
+}
+// --------------------------------------------------------------------------------
+
+/* Phase 1: sort this thread's run in place, using the same range of scratch. */
+static void* _psort_local(void* arg) {
+    const _psort_task_t* task = (const _psort_task_t*)arg;
+    const _psort_ctx_t*  c    = task->ctx;
+    size_t const ds  = c->data_size;
+    size_t const lo  = _psort_run_start(c, task->id);
+    size_t const n   = _psort_run_start(c, task->id + 1u) - lo;
+    uint8_t*     src = c->data    + lo * ds;
+    uint8_t*     dst = c->scratch + lo * ds;
+
+    for (size_t b = 0u; b < n; b += PSORT_BLOCK) {
+        size_t const e = (b + PSORT_BLOCK < n) ? b + PSORT_BLOCK : n;
+        if (e - b > 1u) _insertion_sort(src, b, e - 1u, ds, c->cmp, c->dir);
+    }
+
+    for (size_t w = PSORT_BLOCK; w < n; w *= 2u) {
+        for (size_t s = 0u; s < n; s += 2u * w) {
+            size_t const m = (s + w < n) ? s + w : n;
+            size_t const e = (s + 2u * w < n) ? s + 2u * w : n;
+            _psort_merge(c, src + s * ds, m - s, src + m * ds, e - m, dst + s * ds);
+        }
+        uint8_t* tmp = src; src = dst; dst = tmp;
+    }
+
+    if (src != c->data + lo * ds)
+        memcpy(c->data + lo * ds, src, n * ds);
+    return NULL;
+}
+// --------------------------------------------------------------------------------
+
+/* Phase 2: write this thread's slice of every pairwise merge of the round. */
+static void* _psort_merge_round(void* arg) {
+    const _psort_task_t* task = (const _psort_task_t*)arg;
+    const _psort_ctx_t*  c    = task->ctx;
+    size_t const ds = c->data_size;
+    size_t const lo = _psort_run_start(c, task->id);
+    size_t const hi = _psort_run_start(c, task->id + 1u);
+    size_t const w  = task->width;
+
+    for (size_t r = 0u; r < c->threads; r += 2u * w) {
+        size_t const s = _psort_run_start(c, r);
+        size_t const m = _psort_run_start(c, r + w);
+        size_t const e = _psort_run_start(c, r + 2u * w);
+        if (e <= lo || s >= hi) continue;
+
+        const uint8_t* a  = task->src + s * ds;
+        const uint8_t* b  = task->src + m * ds;
+        size_t const   na = m - s;
+        size_t const   nb = e - m;
+        size_t const   k0 = ((lo > s) ? lo : s) - s;
+        size_t const   k1 = ((hi < e) ? hi : e) - s;
+        size_t const   i0 = _psort_co_rank(c, k0, a, na, b, nb);
+        size_t const   i1 = _psort_co_rank(c, k1, a, na, b, nb);
+
+        _psort_merge(c, a + i0 * ds, i1 - i0,
+                        b + (k0 - i0) * ds, (k1 - i1) - (k0 - i0),
+                        task->dst + (s + k0) * ds);
+    }
+    return NULL;
+}
+// --------------------------------------------------------------------------------
+
+/* Phase 3: copy this thread's slice back when the last round ended in scratch. */
+static void* _psort_copy_back(void* arg) {
+    const _psort_task_t* task = (const _psort_task_t*)arg;
+    const _psort_ctx_t*  c    = task->ctx;
+    size_t const lo = _psort_run_start(c, task->id);
+    size_t const hi = _psort_run_start(c, task->id + 1u);
+    memcpy(c->data + lo * c->data_size, c->scratch + lo * c->data_size,
+           (hi - lo) * c->data_size);
+    return NULL;
+}
+// --------------------------------------------------------------------------------
+
+/* Run fn on each of the count task records of task_size bytes at tasks, one
+ * thread each, and wait for all of them.  The calling thread runs task 0. */
+static void _parallel_phase(void* tasks, size_t task_size, size_t count,
+                            void* (*fn)(void*)) {
+    pthread_t tid[PSORT_MAX_THREADS];
+    bool      spawned[PSORT_MAX_THREADS] = { false };
+    uint8_t*  task = (uint8_t*)tasks;
+
+    for (size_t i = 1u; i < count; i++)
+        spawned[i] = pthread_create(&tid[i], NULL, fn, task + i * task_size) == 0;
+
+    fn(task);
+
+    for (size_t i = 1u; i < count; i++) {
+        if (spawned[i]) pthread_join(tid[i], NULL);
+        else            fn(task + i * task_size);
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* Threads to use for len elements: the request (0 = online processors),
+ * capped so every thread gets at least min_per_thread elements. */
+static size_t _parallel_thread_count(size_t requested, size_t len,
+                                     size_t min_per_thread) {
+    if (requested == 0u) {
+        long const online = sysconf(_SC_NPROCESSORS_ONLN);
+        requested = (online > 0) ? (size_t)online : 1u;
+    }
+    size_t const useful = len / min_per_thread;
+    if (requested > useful)            requested = useful;
+    if (requested > PSORT_MAX_THREADS) requested = PSORT_MAX_THREADS;
+    return (requested == 0u) ? 1u : requested;
+}
+// --------------------------------------------------------------------------------
+
+error_code_t parallel_sort_tensor(tensor_t*          array,
+                                  int              (*cmp)(const void*, const void*),
+                                  direction_t        dir,
+                                  size_t             num_threads,
+                                  allocator_vtable_t scratch) {
+    if (array == NULL || cmp == NULL)                       return NULL_POINTER;
+    if (scratch.allocate == NULL || scratch.return_element == NULL)
+        return NULL_POINTER;
+    if (array->len < 2u)                                    return EMPTY;
+
+    void_ptr_expect_t buf = scratch.allocate(scratch.ctx,
+                                             array->len * array->data_size, false);
+    if (!buf.has_value) return OUT_OF_MEMORY;
+
+    _psort_ctx_t ctx = {
+        .data      = array->data,
+        .scratch   = (uint8_t*)buf.u.value,
+        .len       = array->len,
+        .data_size = array->data_size,
+        .threads   = _parallel_thread_count(num_threads, array->len,
+                                             PSORT_MIN_PER_THREAD),
+        .cmp       = cmp,
+        .dir       = dir
+    };
+
+    _psort_task_t tasks[PSORT_MAX_THREADS];
+    for (size_t i = 0u; i < ctx.threads; i++)
+        tasks[i] = (_psort_task_t){ .ctx = &ctx, .id = i };
+
+    _parallel_phase(tasks, sizeof(tasks[0]), ctx.threads, _psort_local);
+
+    const uint8_t* src = ctx.data;
+    uint8_t*       dst = ctx.scratch;
+    for (size_t w = 1u; w < ctx.threads; w *= 2u) {
+        for (size_t i = 0u; i < ctx.threads; i++) {
+            tasks[i].width = w;
+            tasks[i].src   = src;
+            tasks[i].dst   = dst;
+        }
+        _parallel_phase(tasks, sizeof(tasks[0]), ctx.threads, _psort_merge_round);
+        uint8_t* done = dst;
+        dst = (uint8_t*)src;
+        src = done;
+    }
+    if (src != ctx.data)
+        _parallel_phase(tasks, sizeof(tasks[0]), ctx.threads, _psort_copy_back);
+
+    scratch.return_element(scratch.ctx, buf.u.value);
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+/* LSD radix sort over unsigned keys, one byte per pass.  Every digit
+ * histogram is gathered in a single read of the data, and a pass whose
+ * digit is the same for every key (so the histogram has one bucket equal
+ * to n) is skipped outright, which removes most passes for narrow value
+ * ranges stored in wide types.  Passes ping-pong between data and tmp; a
+ * final copy is needed only when an odd number of passes ran. */
+#define RADIX_SORT_KEYS(NAME, UTYPE)                                           \
+static void NAME(UTYPE* data, UTYPE* tmp, size_t n) {                          \
+    size_t counts[sizeof(UTYPE)][256];                                         \
+    memset(counts, 0, sizeof(counts));                                         \
+    for (size_t i = 0u; i < n; i++) {                                          \
+        UTYPE const k = data[i];                                               \
+        for (size_t b = 0u; b < sizeof(UTYPE); b++)                            \
+            counts[b][(k >> (8u * b)) & 0xFFu]++;                              \
+    }                                                                          \
+    UTYPE* src = data;                                                         \
+    UTYPE* dst = tmp;                                                          \
+    for (size_t b = 0u; b < sizeof(UTYPE); b++) {                              \
+        size_t* c = counts[b];                                                 \
+        if (c[(src[0] >> (8u * b)) & 0xFFu] == n) continue;                    \
+        size_t sum = 0u;                                                       \
+        for (size_t v = 0u; v < 256u; v++) {                                   \
+            size_t const cnt = c[v];                                           \
+            c[v] = sum;                                                        \
+            sum += cnt;                                                        \
+        }                                                                      \
+        for (size_t i = 0u; i < n; i++) {                                      \
+            UTYPE const k = src[i];                                            \
+            dst[c[(k >> (8u * b)) & 0xFFu]++] = k;                             \
+        }                                                                      \
+        UTYPE* swap = src;                                                     \
+        src = dst;                                                             \
+        dst = swap;                                                            \
+    }                                                                          \
+    if (src != data) memcpy(data, src, n * sizeof(UTYPE));                     \
+}
+
+RADIX_SORT_KEYS(_radix_sort_u8,  uint8_t)
+RADIX_SORT_KEYS(_radix_sort_u16, uint16_t)
+RADIX_SORT_KEYS(_radix_sort_u32, uint32_t)
+RADIX_SORT_KEYS(_radix_sort_u64, uint64_t)
+
+#undef RADIX_SORT_KEYS
+// --------------------------------------------------------------------------------
+
+/* Map each element onto an unsigned key whose natural order is the
+ * requested order, or (inverse == true) map the sorted keys back.  Signed
+ * integers flip the sign bit; IEEE floats flip every bit of negatives and
+ * only the sign bit of non-negatives; REVERSE complements the key, which
+ * keeps the sort stable in descending order. */
+#define RADIX_KEY_TRANSFORM(NAME, UTYPE)                                       \
+static void NAME(UTYPE* data, size_t n, bool is_signed, bool is_float,         \
+                 bool reverse, bool inverse) {                                 \
+    UTYPE const sign = (UTYPE)((UTYPE)1u << (8u * sizeof(UTYPE) - 1u));        \
+    UTYPE const flip = reverse ? (UTYPE)~(UTYPE)0u : (UTYPE)0u;                \
+    if (is_float) {                                                            \
+        if (!inverse) {                                                        \
+            for (size_t i = 0u; i < n; i++) {                                  \
+                UTYPE const v = data[i];                                       \
+                UTYPE const k = (v & sign) ? (UTYPE)~v : (UTYPE)(v | sign);    \
+                data[i] = (UTYPE)(k ^ flip);                                   \
+            }                                                                  \
+        } else {                                                               \
+            for (size_t i = 0u; i < n; i++) {                                  \
+                UTYPE const k = (UTYPE)(data[i] ^ flip);                       \
+                data[i] = (k & sign) ? (UTYPE)(k & (UTYPE)~sign) : (UTYPE)~k;  \
+            }                                                                  \
+        }                                                                      \
+        return;                                                                \
+    }                                                                          \
+    UTYPE const mask = (UTYPE)((is_signed ? sign : (UTYPE)0u) ^ flip);         \
+    if (mask == 0u) return;                                                    \
+    for (size_t i = 0u; i < n; i++) data[i] ^= mask;                           \
+}
+
+RADIX_KEY_TRANSFORM(_radix_keys_u8,  uint8_t)
+RADIX_KEY_TRANSFORM(_radix_keys_u16, uint16_t)
+RADIX_KEY_TRANSFORM(_radix_keys_u32, uint32_t)
+RADIX_KEY_TRANSFORM(_radix_keys_u64, uint64_t)
+
+#undef RADIX_KEY_TRANSFORM
+// --------------------------------------------------------------------------------
+
+error_code_t radix_sort_tensor(tensor_t*   array,
+                               direction_t dir,
+                               void*       scratch,
+                               size_t      scratch_bytes) {
+    if (array == NULL) return NULL_POINTER;
+
+    bool is_signed = false;
+    bool is_float  = false;
+    switch (array->dtype) {
+        case INT8_TYPE:  case INT16_TYPE: case INT32_TYPE: case INT64_TYPE:
+            is_signed = true;
+            break;
+        case UINT8_TYPE: case UINT16_TYPE: case UINT32_TYPE: case UINT64_TYPE:
+        case SIZE_T_TYPE:
+            break;
+        case FLOAT_TYPE: case DOUBLE_TYPE:
+            is_float = true;
+            break;
+        default:
+            return TYPE_MISMATCH;
+    }
+    if (array->len < 2u) return EMPTY;
+
+    size_t const n     = array->len;
+    size_t const ds    = array->data_size;
+    size_t const bytes = n * ds;
+
+    /* Caller-supplied scratch must hold the whole array and be aligned for
+     * the key width; otherwise borrow a buffer from the tensor's allocator */
+    void* tmp = scratch;
+    if (tmp != NULL) {
+        if (scratch_bytes < bytes)           return SIZE_MISMATCH;
+        if (((uintptr_t)tmp % ds) != 0u)     return ALIGNMENT_ERROR;
+    } else {
+        if (array->alloc_v.allocate == NULL || array->alloc_v.return_element == NULL)
+            return NULL_POINTER;
+        void_ptr_expect_t buf = array->alloc_v.allocate(array->alloc_v.ctx,
+                                                        bytes, false);
+        if (!buf.has_value) return OUT_OF_MEMORY;
+        tmp = buf.u.value;
+    }
+
+    bool const rev = (dir == REVERSE);
+    switch (ds) {
+        case 1u:
+            _radix_keys_u8((uint8_t*)array->data, n, is_signed, is_float, rev, false);
+            _radix_sort_u8((uint8_t*)array->data, (uint8_t*)tmp, n);
+            _radix_keys_u8((uint8_t*)array->data, n, is_signed, is_float, rev, true);
+            break;
+        case 2u:
+            _radix_keys_u16((uint16_t*)array->data, n, is_signed, is_float, rev, false);
+            _radix_sort_u16((uint16_t*)array->data, (uint16_t*)tmp, n);
+            _radix_keys_u16((uint16_t*)array->data, n, is_signed, is_float, rev, true);
+            break;
+        case 4u:
+            _radix_keys_u32((uint32_t*)array->data, n, is_signed, is_float, rev, false);
+            _radix_sort_u32((uint32_t*)array->data, (uint32_t*)tmp, n);
+            _radix_keys_u32((uint32_t*)array->data, n, is_signed, is_float, rev, true);
+            break;
+        default:
+            _radix_keys_u64((uint64_t*)array->data, n, is_signed, is_float, rev, false);
+            _radix_sort_u64((uint64_t*)array->data, (uint64_t*)tmp, n);
+            _radix_keys_u64((uint64_t*)array->data, n, is_signed, is_float, rev, true);
+            break;
+    }
+
+    if (scratch == NULL)
+        array->alloc_v.return_element(array->alloc_v.ctx, tmp);
+    return NO_ERROR;
+}
 // ================================================================================ 
 // ================================================================================ 
 // ADD AND REMOVE DATA
@@ -853,6 +1284,132 @@ error_code_t pop_at_tensor(tensor_t*   t,
     return NO_ERROR;
 }
 
+// --------------------------------------------------------------------------------
+
+/* Number of elements a bulk insert may take: all of count when the buffer
+ * can hold or grow to len + count, otherwise whatever fits in the free
+ * tail of a fixed-capacity buffer.  Returns 0 with *err set when nothing
+ * can be taken. */
+static size_t _bulk_take_count(tensor_t* t, size_t count, error_code_t* err) {
+    *err = NO_ERROR;
+    if (count > SIZE_MAX - t->len) {
+        *err = LENGTH_OVERFLOW;
+        return 0u;
+    }
+
+    error_code_t e = _reserve_array(t, t->len + count);
+    if (e == NO_ERROR) return count;
+    if (e != CAPACITY_OVERFLOW) {
+        *err = e;
+        return 0u;
+    }
+
+    size_t room = t->alloc - t->len;
+    if (room == 0u) *err = CAPACITY_OVERFLOW;
+    return room;
+}
+
+// --------------------------------------------------------------------------------
+
+size_expect_t push_back_n_tensor(tensor_t*   t,
+                                 const void* data,
+                                 size_t      count,
+                                 dtype_id_t  dtype) {
+    if (t == NULL || data == NULL)
+        return (size_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    if (t->mode != ARRAY_STRUCT)
+        return (size_expect_t){ .has_value = false, .u.error = PRECONDITION_FAIL };
+    if (dtype != t->dtype)
+        return (size_expect_t){ .has_value = false, .u.error = TYPE_MISMATCH };
+    if (count == 0u)
+        return (size_expect_t){ .has_value = true, .u.value = 0u };
+
+    /* data may point into t's own buffer (e.g. doubling an array with
+     * itself); record its offset so it can be rebased after a realloc */
+    const uint8_t* src   = (const uint8_t*)data;
+    const uint8_t* begin = t->data;
+    bool aliased = (begin != NULL) && src >= begin &&
+                   src < begin + t->alloc * t->data_size;
+    size_t offset = aliased ? (size_t)(src - begin) : 0u;
+
+    error_code_t err;
+    size_t taken = _bulk_take_count(t, count, &err);
+    if (err != NO_ERROR)
+        return (size_expect_t){ .has_value = false, .u.error = err };
+
+    if (aliased) src = t->data + offset;
+
+    memmove(t->data + t->len * t->data_size, src, taken * t->data_size);
+    t->len += taken;
+    return (size_expect_t){ .has_value = true, .u.value = taken };
+}
+
+// --------------------------------------------------------------------------------
+
+size_expect_t push_at_n_tensor(tensor_t*   t,
+                               const void* data,
+                               size_t      count,
+                               size_t      index,
+                               dtype_id_t  dtype) {
+    if (t == NULL || data == NULL)
+        return (size_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    if (t->mode != ARRAY_STRUCT)
+        return (size_expect_t){ .has_value = false, .u.error = PRECONDITION_FAIL };
+    if (dtype != t->dtype)
+        return (size_expect_t){ .has_value = false, .u.error = TYPE_MISMATCH };
+    if (index > t->len)
+        return (size_expect_t){ .has_value = false, .u.error = OUT_OF_BOUNDS };
+    if (count == 0u)
+        return (size_expect_t){ .has_value = true, .u.value = 0u };
+
+    /* The source must not overlap the buffer: the tail shift would move it */
+    const uint8_t* src = (const uint8_t*)data;
+    if (t->data != NULL && src < t->data + t->alloc * t->data_size &&
+        src + count * t->data_size > t->data)
+        return (size_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+
+    error_code_t err;
+    size_t taken = _bulk_take_count(t, count, &err);
+    if (err != NO_ERROR)
+        return (size_expect_t){ .has_value = false, .u.error = err };
+
+    /* One shift opens the whole gap, one copy fills it */
+    size_t ds = t->data_size;
+    if (index < t->len) {
+        memmove(t->data + (index + taken) * ds,
+                t->data + index * ds,
+                (t->len - index) * ds);
+    }
+    memcpy(t->data + index * ds, src, taken * ds);
+    t->len += taken;
+    return (size_expect_t){ .has_value = true, .u.value = taken };
+}
+
+// --------------------------------------------------------------------------------
+
+size_expect_t pop_back_n_tensor(tensor_t*  t,
+                                void*      out,
+                                size_t     count,
+                                dtype_id_t dtype) {
+    if (t == NULL)
+        return (size_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    if (t->mode != ARRAY_STRUCT)
+        return (size_expect_t){ .has_value = false, .u.error = PRECONDITION_FAIL };
+    if (dtype != t->dtype)
+        return (size_expect_t){ .has_value = false, .u.error = TYPE_MISMATCH };
+    if (count == 0u)
+        return (size_expect_t){ .has_value = true, .u.value = 0u };
+    if (t->len == 0u)
+        return (size_expect_t){ .has_value = false, .u.error = EMPTY };
+
+    size_t taken = (count < t->len) ? count : t->len;
+    t->len -= taken;
+    if (out != NULL)
+        memcpy(out, t->data + t->len * t->data_size, taken * t->data_size);
+
+    return (size_expect_t){ .has_value = true, .u.value = taken };
+}
+
 // ================================================================================ 
 // ================================================================================ 
 // RETRIEVE DATA
@@ -891,7 +1448,1322 @@ error_code_t get_tensor_nd_index(const tensor_t* t,
     memcpy(out, t->data + offset, t->data_size);
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE OPERATIONS
+
+/* True when [p, p + n) and [q, q + n) share bytes without being identical */
+static bool _partial_overlap(const uint8_t* p, const uint8_t* q, size_t n) {
+    if (p == q) return false;
+    uintptr_t const a = (uintptr_t)p;
+    uintptr_t const b = (uintptr_t)q;
+    return (a < b) ? (b - a < n) : (a - b < n);
+}
+// --------------------------------------------------------------------------------
+
+error_code_t prepare_elementwise_tensor(tensor_t*       out,
+                                        const tensor_t* a,
+                                        const tensor_t* b) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    if (out->dtype != a->dtype)   return TYPE_MISMATCH;
+    if (b != NULL && b->dtype != a->dtype) return TYPE_MISMATCH;
+    if (a->len == 0u)             return EMPTY;
+    if (b != NULL && b->len != a->len)     return SIZE_MISMATCH;
+
+    size_t const n = a->len;
+    if (out->len != n) {
+        if (out->mode != ARRAY_STRUCT) return SIZE_MISMATCH;
+        error_code_t const err = _reserve_array(out, n);
+        if (err == CAPACITY_OVERFLOW) return SIZE_MISMATCH;
+        if (err != NO_ERROR)          return err;
+    }
+
+    size_t const bytes = n * a->data_size;
+    if (_partial_overlap(out->data, a->data, bytes)) return INVALID_ARG;
+    if (b != NULL && _partial_overlap(out->data, b->data, bytes)) return INVALID_ARG;
+
+    out->len = n;
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// TENSOR VIEWS
+
+/* Allocate a view struct with room for ndim shape and stride entries and
+ * copy the scalar fields of src into it. */
+static tensor_view_t* _alloc_tensor_view(const tensor_view_t* src, uint8_t ndim) {
+    size_t header_bytes = sizeof(tensor_view_t) + 2u * ndim * sizeof(size_t);
+
+    void_ptr_expect_t r = src->alloc_v.allocate(src->alloc_v.ctx, header_bytes, true);
+    if (r.has_value == false) return NULL;
+
+    tensor_view_t* v = (tensor_view_t*)r.u.value;
+    v->base      = src->base;
+    v->offset    = src->offset;
+    v->len       = src->len;
+    v->data_size = src->data_size;
+    v->dtype     = src->dtype;
+    v->alloc_v   = src->alloc_v;
+    v->ndim      = ndim;
+    v->shape     = v->meta;
+    v->strides   = v->meta + ndim;
+    return v;
+}
+// --------------------------------------------------------------------------------
+
+tensor_view_expect_t init_tensor_view(const tensor_t*    t,
+                                      allocator_vtable_t alloc_v) {
+    if (t == NULL)
+        return (tensor_view_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    if (t->len == 0u)
+        return (tensor_view_expect_t){ .has_value = false, .u.error = EMPTY };
+
+    const uint8_t ndim = (t->mode == ARRAY_STRUCT) ? 1u : t->ndim;
+    const tensor_view_t proto = {
+        .base      = t,
+        .offset    = 0u,
+        .len       = t->len,
+        .data_size = t->data_size,
+        .dtype     = t->dtype,
+        .alloc_v   = (alloc_v.allocate != NULL) ? alloc_v : t->alloc_v
+    };
+
+    tensor_view_t* v = _alloc_tensor_view(&proto, ndim);
+    if (v == NULL)
+        return (tensor_view_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+
+    if (t->mode == ARRAY_STRUCT) {
+        v->shape[0]   = t->len;
+        v->strides[0] = t->data_size;
+    } else {
+        for (uint8_t i = 0u; i < ndim; i++) {
+            v->shape[i]   = t->shape[i];
+            v->strides[i] = t->strides[i];
+        }
+    }
+    return (tensor_view_expect_t){ .has_value = true, .u.value = v };
+}
+// --------------------------------------------------------------------------------
+
+void return_tensor_view(tensor_view_t* v) {
+    if (v == NULL) return;
+    v->alloc_v.return_element(v->alloc_v.ctx, v);
+}
+// --------------------------------------------------------------------------------
+
+tensor_view_expect_t slice_tensor_view(const tensor_view_t* v,
+                                       uint8_t              axis,
+                                       size_t               start,
+                                       size_t               end,
+                                       size_t               step) {
+    if (v == NULL)
+        return (tensor_view_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    if (axis >= v->ndim || end > v->shape[axis])
+        return (tensor_view_expect_t){ .has_value = false, .u.error = OUT_OF_BOUNDS };
+    if (start >= end || step == 0u)
+        return (tensor_view_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+
+    tensor_view_t* s = _alloc_tensor_view(v, v->ndim);
+    if (s == NULL)
+        return (tensor_view_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+
+    for (uint8_t i = 0u; i < v->ndim; i++) {
+        s->shape[i]   = v->shape[i];
+        s->strides[i] = v->strides[i];
+    }
+
+    size_t const extent = (end - start + step - 1u) / step;
+    s->offset        += start * v->strides[axis];
+    s->strides[axis] *= step;
+    s->len            = (v->len / v->shape[axis]) * extent;
+    s->shape[axis]    = extent;
+
+    return (tensor_view_expect_t){ .has_value = true, .u.value = s };
+}
+// --------------------------------------------------------------------------------
+
+tensor_view_expect_t permute_tensor_view(const tensor_view_t* v,
+                                         const uint8_t*       axes) {
+    if (v == NULL || axes == NULL)
+        return (tensor_view_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+
+    bool seen[UINT8_MAX + 1] = { false };
+    for (uint8_t i = 0u; i < v->ndim; i++) {
+        if (axes[i] >= v->ndim || seen[axes[i]])
+            return (tensor_view_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+        seen[axes[i]] = true;
+    }
+
+    tensor_view_t* p = _alloc_tensor_view(v, v->ndim);
+    if (p == NULL)
+        return (tensor_view_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+
+    for (uint8_t i = 0u; i < v->ndim; i++) {
+        p->shape[i]   = v->shape[axes[i]];
+        p->strides[i] = v->strides[axes[i]];
+    }
+    return (tensor_view_expect_t){ .has_value = true, .u.value = p };
+}
+// --------------------------------------------------------------------------------
+
+tensor_view_expect_t transpose_tensor_view(const tensor_view_t* v) {
+    if (v == NULL)
+        return (tensor_view_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+
+    uint8_t axes[UINT8_MAX];
+    for (uint8_t i = 0u; i < v->ndim; i++)
+        axes[i] = (uint8_t)(v->ndim - 1u - i);
+    return permute_tensor_view(v, axes);
+}
+// --------------------------------------------------------------------------------
+
+tensor_view_expect_t reshape_tensor_view(const tensor_view_t* v,
+                                         uint8_t              ndim,
+                                         const size_t*        shape) {
+    if (v == NULL || shape == NULL)
+        return (tensor_view_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    if (ndim == 0u)
+        return (tensor_view_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+
+    size_t len = 1u;
+    for (uint8_t i = 0u; i < ndim; i++) {
+        if (shape[i] == 0u)
+            return (tensor_view_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+        if (len > v->len / shape[i])
+            return (tensor_view_expect_t){ .has_value = false, .u.error = SIZE_MISMATCH };
+        len *= shape[i];
+    }
+    if (len != v->len)
+        return (tensor_view_expect_t){ .has_value = false, .u.error = SIZE_MISMATCH };
+
+    /* Drop extent-1 axes of the source; they carry no layout information */
+    size_t  old_shape[UINT8_MAX];
+    size_t  old_strides[UINT8_MAX];
+    uint8_t old_ndim = 0u;
+    for (uint8_t i = 0u; i < v->ndim; i++) {
+        if (v->shape[i] == 1u) continue;
+        old_shape[old_ndim]   = v->shape[i];
+        old_strides[old_ndim] = v->strides[i];
+        old_ndim++;
+    }
+
+    /* Match runs of old axes against runs of new axes with equal element
+     * counts.  Each old run must be internally contiguous; the new run then
+     * takes its strides from the innermost old axis of the run. */
+    size_t  new_strides[UINT8_MAX];
+    size_t oi = 0u, oj = 1u, ni = 0u, nj = 1u;
+    while (ni < ndim && oi < old_ndim) {
+        size_t np = shape[ni];
+        size_t op = old_shape[oi];
+        while (np != op) {
+            if (np < op) np *= shape[nj++];
+            else         op *= old_shape[oj++];
+        }
+        for (size_t k = oi; k + 1u < oj; k++) {
+            if (old_strides[k] != old_shape[k + 1u] * old_strides[k + 1u])
+                return (tensor_view_expect_t){ .has_value = false,
+                                               .u.error = ILLEGAL_STATE };
+        }
+        new_strides[nj - 1u] = old_strides[oj - 1u];
+        for (size_t k = nj - 1u; k > ni; k--)
+            new_strides[k - 1u] = new_strides[k] * shape[k];
+        ni = nj++;
+        oi = oj++;
+    }
+
+    /* Trailing extent-1 axes are never stepped, any stride will do */
+    size_t const last = (ni > 0u) ? new_strides[ni - 1u] : v->data_size;
+    for (size_t k = ni; k < ndim; k++)
+        new_strides[k] = last;
+
+    tensor_view_t* r = _alloc_tensor_view(v, ndim);
+    if (r == NULL)
+        return (tensor_view_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+
+    for (uint8_t i = 0u; i < ndim; i++) {
+        r->shape[i]   = shape[i];
+        r->strides[i] = new_strides[i];
+    }
+    return (tensor_view_expect_t){ .has_value = true, .u.value = r };
+}
+// --------------------------------------------------------------------------------
+
+bool is_tensor_view_contiguous(const tensor_view_t* v) {
+    if (v == NULL) return false;
+
+    size_t expected = v->data_size;
+    for (uint8_t i = v->ndim; i > 0u; i--) {
+        if (v->shape[i - 1u] == 1u) continue;
+        if (v->strides[i - 1u] != expected) return false;
+        expected *= v->shape[i - 1u];
+    }
+    return true;
+}
+// --------------------------------------------------------------------------------
 
+error_code_t get_tensor_view_nd_index(const tensor_view_t* v,
+                                      const size_t*        idx,
+                                      void*                out,
+                                      dtype_id_t           dtype) {
+    if (v == NULL || idx == NULL || out == NULL) return NULL_POINTER;
+    if (dtype != v->dtype)                       return TYPE_MISMATCH;
+
+    size_t offset = v->offset;
+    for (uint8_t i = 0u; i < v->ndim; i++) {
+        if (idx[i] >= v->shape[i]) return OUT_OF_BOUNDS;
+        offset += idx[i] * v->strides[i];
+    }
+
+    memcpy(out, v->base->data + offset, v->data_size);
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+tensor_expect_t materialize_tensor_view(const tensor_view_t* v,
+                                        allocator_vtable_t   alloc_v) {
+    if (v == NULL)
+        return (tensor_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+
+    allocator_vtable_t av = (alloc_v.allocate != NULL) ? alloc_v : v->base->alloc_v;
+    tensor_expect_t r = init_tensor(v->ndim, v->shape, v->dtype, av);
+    if (!r.has_value) return r;
+
+    uint8_t*       dst = r.u.value->data;
+    const uint8_t* src = v->base->data + v->offset;
+    size_t const   ds  = v->data_size;
+
+    if (is_tensor_view_contiguous(v)) {
+        memcpy(dst, src, v->len * ds);
+        return r;
+    }
+
+    /* Odometer over the outer axes; the innermost axis is one memcpy when
+     * its elements are adjacent and an element-wise copy otherwise */
+    uint8_t const inner     = (uint8_t)(v->ndim - 1u);
+    size_t const  run       = v->shape[inner];
+    size_t const  in_stride = v->strides[inner];
+    size_t        idx[UINT8_MAX] = { 0u };
+    size_t        offset    = 0u;
+
+    for (size_t done = 0u; done < v->len; done += run) {
+        if (in_stride == ds) {
+            memcpy(dst, src + offset, run * ds);
+            dst += run * ds;
+        } else {
+            for (size_t j = 0u; j < run; j++, dst += ds)
+                memcpy(dst, src + offset + j * in_stride, ds);
+        }
+
+        for (uint8_t k = inner; k > 0u; k--) {
+            if (++idx[k - 1u] < v->shape[k - 1u]) {
+                offset += v->strides[k - 1u];
+                break;
+            }
+            offset -= (idx[k - 1u] - 1u) * v->strides[k - 1u];
+            idx[k - 1u] = 0u;
+        }
+    }
+    return r;
+}
+// ================================================================================
+// ================================================================================
+// AXIS REDUCTIONS
+
+/* Elements per accumulator strip when reducing any axis but the last.  A
+ * strip of the output is folded against the matching strip of every slice
+ * along the axis before moving on, so it stays in L1 while the slices
+ * stream past once. */
+#define AXIS_STRIP 512u
+
+/* Each dtype provides
+ *   _axis_row_<t>    reduce n contiguous elements into *out (last axis)
+ *   _axis_strip_<t>  reduce len elements at stride pitch over n slices into
+ *                    acc[0..len) (every other axis)
+ * and AXIS_DRIVER walks the tensor as outer x n x inner with either one. */
+#define AXIS_DRIVER(SFX, T)                                                     \
+static error_code_t _axis_run_##SFX(reduce_op_t op, const void* src, void* dst, \
+                                    size_t outer, size_t n, size_t inner) {     \
+    const T* x   = (const T*)src;                                               \
+    T*       out = (T*)dst;                                                     \
+    for (size_t o = 0u; o < outer; o++, x += n * inner, out += inner) {         \
+        if (inner == 1u) {                                                      \
+            error_code_t err = _axis_row_##SFX(op, x, n, out);                  \
+            if (err != NO_ERROR) return err;                                    \
+            continue;                                                           \
+        }                                                                       \
+        for (size_t s = 0u; s < inner; s += AXIS_STRIP) {                       \
+            size_t const len = (inner - s < AXIS_STRIP) ? inner - s             \
+                                                        : AXIS_STRIP;           \
+            error_code_t err = _axis_strip_##SFX(op, x + s, n, inner,           \
+                                                 out + s, len);                 \
+            if (err != NO_ERROR) return err;                                    \
+        }                                                                       \
+    }                                                                           \
+    return NO_ERROR;                                                            \
+}
+// --------------------------------------------------------------------------------
+
+/* float and double: pairwise sums along the last axis, SIMD elementwise
+ * folds along the others.  minimum/maximum propagate NaN from either side. */
+#define AXIS_FLOAT_KERNELS(SFX, T)                                              \
+static T _axis_pairwise_##SFX(const T* x, size_t n) {                           \
+    if (n <= AXIS_STRIP) return simd_sum_##SFX(x, n);                           \
+    size_t const half = (n / 2u + AXIS_STRIP - 1u) / AXIS_STRIP * AXIS_STRIP;   \
+    return _axis_pairwise_##SFX(x, half) +                                      \
+           _axis_pairwise_##SFX(x + half, n - half);                            \
+}                                                                               \
+static error_code_t _axis_row_##SFX(reduce_op_t op, const T* x, size_t n,       \
+                                    T* out) {                                   \
+    switch (op) {                                                               \
+        case REDUCE_MIN:                                                        \
+            *out = (T)INFINITY;                                                 \
+            (void)simd_min_##SFX(x, n, out);                                    \
+            break;                                                              \
+        case REDUCE_MAX:                                                        \
+            *out = -(T)INFINITY;                                                \
+            (void)simd_max_##SFX(x, n, out);                                    \
+            break;                                                              \
+        case REDUCE_SUM: *out = _axis_pairwise_##SFX(x, n); break;              \
+        default:         *out = _axis_pairwise_##SFX(x, n) / (T)n; break;       \
+    }                                                                           \
+    return NO_ERROR;                                                            \
+}                                                                               \
+static error_code_t _axis_strip_##SFX(reduce_op_t op, const T* x, size_t n,     \
+                                      size_t pitch, T* acc, size_t len) {       \
+    memcpy(acc, x, len * sizeof(T));                                            \
+    for (size_t j = 1u; j < n; j++) {                                           \
+        const T* s = x + j * pitch;                                             \
+        if (op == REDUCE_MIN)      simd_minimum_##SFX(acc, acc, s, len);        \
+        else if (op == REDUCE_MAX) simd_maximum_##SFX(acc, acc, s, len);        \
+        else                       simd_add_##SFX(acc, acc, s, len);            \
+    }                                                                           \
+    if (op == REDUCE_MEAN) {                                                    \
+        for (size_t i = 0u; i < len; i++) acc[i] /= (T)n;                       \
+    }                                                                           \
+    return NO_ERROR;                                                            \
+}                                                                               \
+AXIS_DRIVER(SFX, T)
+
+AXIS_FLOAT_KERNELS(float, float)
+AXIS_FLOAT_KERNELS(double, double)
+// --------------------------------------------------------------------------------
+
+/* Row sums for the integer dtypes.  _axis_usum wraps in the unsigned type
+ * U; _axis_wsum widens to W for means and fails only on 64-bit overflow.
+ * The 8 to 32-bit kernels already widen, 64-bit rows are summed here. */
+#define AXIS_ROW_SUMS_SIMD(SFX, T, U, W)                                        \
+static U _axis_usum_##SFX(const T* x, size_t n) {                               \
+    return (U)simd_sum_##SFX(x, n);                                             \
+}                                                                               \
+static bool _axis_wsum_##SFX(const T* x, size_t n, W* s) {                      \
+    *s = simd_sum_##SFX(x, n);                                                  \
+    return true;                                                                \
+}
+
+#define AXIS_ROW_SUMS_64(SFX, T, U, W)                                          \
+static U _axis_usum_##SFX(const T* x, size_t n) {                               \
+    U s = 0u;                                                                   \
+    for (size_t i = 0u; i < n; i++) s += (U)x[i];                               \
+    return s;                                                                   \
+}                                                                               \
+static bool _axis_wsum_##SFX(const T* x, size_t n, W* s) {                      \
+    W acc = 0;                                                                  \
+    for (size_t i = 0u; i < n; i++) {                                           \
+        if (__builtin_add_overflow(acc, x[i], &acc)) return false;              \
+    }                                                                           \
+    *s = acc;                                                                   \
+    return true;                                                                \
+}
+
+/* Integer kernels.  Sums wrap through the unsigned add kernel; means
+ * accumulate a strip in W, checked when CHECK is set (64-bit dtypes). */
+#define AXIS_INT_KERNELS(SFX, T, U, USFX, W, LO, HI, CHECK)                     \
+static error_code_t _axis_row_##SFX(reduce_op_t op, const T* x, size_t n,       \
+                                    T* out) {                                   \
+    W s = 0;                                                                    \
+    switch (op) {                                                               \
+        case REDUCE_MIN: *out = HI; (void)simd_min_##SFX(x, n, out); break;     \
+        case REDUCE_MAX: *out = LO; (void)simd_max_##SFX(x, n, out); break;     \
+        case REDUCE_SUM: *out = (T)_axis_usum_##SFX(x, n); break;               \
+        default:                                                                \
+            if (!_axis_wsum_##SFX(x, n, &s)) return NUMERIC_OVERFLOW;           \
+            *out = (T)(s / (W)n);                                               \
+            break;                                                              \
+    }                                                                           \
+    return NO_ERROR;                                                            \
+}                                                                               \
+static error_code_t _axis_strip_##SFX(reduce_op_t op, const T* x, size_t n,     \
+                                      size_t pitch, T* acc, size_t len) {       \
+    if (op != REDUCE_MEAN) {                                                    \
+        memcpy(acc, x, len * sizeof(T));                                        \
+        for (size_t j = 1u; j < n; j++) {                                       \
+            const T* s = x + j * pitch;                                         \
+            if (op == REDUCE_MIN)      simd_minimum_##SFX(acc, acc, s, len);    \
+            else if (op == REDUCE_MAX) simd_maximum_##SFX(acc, acc, s, len);    \
+            else simd_add_##USFX((U*)acc, (const U*)acc, (const U*)s, len);     \
+        }                                                                       \
+        return NO_ERROR;                                                        \
+    }                                                                           \
+    W w[AXIS_STRIP];                                                            \
+    for (size_t i = 0u; i < len; i++) w[i] = x[i];                              \
+    for (size_t j = 1u; j < n; j++) {                                           \
+        const T* s = x + j * pitch;                                             \
+        if (CHECK) {                                                            \
+            for (size_t i = 0u; i < len; i++) {                                 \
+                if (__builtin_add_overflow(w[i], s[i], &w[i]))                  \
+                    return NUMERIC_OVERFLOW;                                    \
+            }                                                                   \
+        } else {                                                                \
+            for (size_t i = 0u; i < len; i++) w[i] += s[i];                     \
+        }                                                                       \
+    }                                                                           \
+    for (size_t i = 0u; i < len; i++) acc[i] = (T)(w[i] / (W)n);                \
+    return NO_ERROR;                                                            \
+}                                                                               \
+AXIS_DRIVER(SFX, T)
+
+AXIS_ROW_SUMS_SIMD(int8,   int8_t,   uint8_t,  int64_t)
+AXIS_ROW_SUMS_SIMD(uint8,  uint8_t,  uint8_t,  uint64_t)
+AXIS_ROW_SUMS_SIMD(int16,  int16_t,  uint16_t, int64_t)
+AXIS_ROW_SUMS_SIMD(uint16, uint16_t, uint16_t, uint64_t)
+AXIS_ROW_SUMS_SIMD(int32,  int32_t,  uint32_t, int64_t)
+AXIS_ROW_SUMS_SIMD(uint32, uint32_t, uint32_t, uint64_t)
+AXIS_ROW_SUMS_64(int64,    int64_t,  uint64_t, int64_t)
+AXIS_ROW_SUMS_64(uint64,   uint64_t, uint64_t, uint64_t)
+
+AXIS_INT_KERNELS(int8,   int8_t,   uint8_t,  uint8,  int64_t,  INT8_MIN,  INT8_MAX,   false)
+AXIS_INT_KERNELS(uint8,  uint8_t,  uint8_t,  uint8,  uint64_t, 0u,        UINT8_MAX,  false)
+AXIS_INT_KERNELS(int16,  int16_t,  uint16_t, uint16, int64_t,  INT16_MIN, INT16_MAX,  false)
+AXIS_INT_KERNELS(uint16, uint16_t, uint16_t, uint16, uint64_t, 0u,        UINT16_MAX, false)
+AXIS_INT_KERNELS(int32,  int32_t,  uint32_t, uint32, int64_t,  INT32_MIN, INT32_MAX,  false)
+AXIS_INT_KERNELS(uint32, uint32_t, uint32_t, uint32, uint64_t, 0u,        UINT32_MAX, false)
+AXIS_INT_KERNELS(int64,  int64_t,  uint64_t, uint64, int64_t,  INT64_MIN, INT64_MAX,  true)
+AXIS_INT_KERNELS(uint64, uint64_t, uint64_t, uint64, uint64_t, 0u,        UINT64_MAX, true)
+// --------------------------------------------------------------------------------
+
+/* long double has no SIMD kernels; plain loops with the same semantics */
+static inline long double _axis_pick_ldouble(reduce_op_t op, long double a,
+                                             long double b) {
+    if (isnan(a)) return a;
+    if (isnan(b)) return b;
+    if (op == REDUCE_MIN) return (b < a) ? b : a;
+    if (op == REDUCE_MAX) return (b > a) ? b : a;
+    return a + b;
+}
+
+static error_code_t _axis_row_ldouble(reduce_op_t op, const long double* x,
+                                      size_t n, long double* out) {
+    long double r = x[0];
+    if (op == REDUCE_MIN || op == REDUCE_MAX) {
+        for (size_t i = 1u; i < n; i++) r = _axis_pick_ldouble(op, r, x[i]);
+    } else {
+        for (size_t i = 1u; i < n; i++) r += x[i];
+        if (op == REDUCE_MEAN) r /= (long double)n;
+    }
+    *out = r;
+    return NO_ERROR;
+}
+
+static error_code_t _axis_strip_ldouble(reduce_op_t op, const long double* x,
+                                        size_t n, size_t pitch,
+                                        long double* acc, size_t len) {
+    memcpy(acc, x, len * sizeof(long double));
+    for (size_t j = 1u; j < n; j++) {
+        const long double* s = x + j * pitch;
+        if (op == REDUCE_MIN || op == REDUCE_MAX) {
+            for (size_t i = 0u; i < len; i++) acc[i] = _axis_pick_ldouble(op, acc[i], s[i]);
+        } else {
+            for (size_t i = 0u; i < len; i++) acc[i] += s[i];
+        }
+    }
+    if (op == REDUCE_MEAN) {
+        for (size_t i = 0u; i < len; i++) acc[i] /= (long double)n;
+    }
+    return NO_ERROR;
+}
+
+AXIS_DRIVER(ldouble, long double)
+// --------------------------------------------------------------------------------
+
+tensor_expect_t reduce_tensor_axis(const tensor_t*    t,
+                                   uint8_t            axis,
+                                   reduce_op_t        op,
+                                   allocator_vtable_t alloc_v) {
+    if (t == NULL)
+        return (tensor_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    if (t->data == NULL || t->len == 0u)
+        return (tensor_expect_t){ .has_value = false, .u.error = EMPTY };
+
+    error_code_t (*run)(reduce_op_t, const void*, void*, size_t, size_t, size_t);
+    switch (t->dtype) {
+        case FLOAT_TYPE:   run = _axis_run_float;   break;
+        case DOUBLE_TYPE:  run = _axis_run_double;  break;
+        case LDOUBLE_TYPE: run = _axis_run_ldouble; break;
+        case INT8_TYPE:    run = _axis_run_int8;    break;
+        case UINT8_TYPE:   run = _axis_run_uint8;   break;
+        case INT16_TYPE:   run = _axis_run_int16;   break;
+        case UINT16_TYPE:  run = _axis_run_uint16;  break;
+        case INT32_TYPE:   run = _axis_run_int32;   break;
+        case UINT32_TYPE:  run = _axis_run_uint32;  break;
+        case INT64_TYPE:   run = _axis_run_int64;   break;
+        case UINT64_TYPE:  run = _axis_run_uint64;  break;
+        default:
+            return (tensor_expect_t){ .has_value = false, .u.error = TYPE_MISMATCH };
+    }
+    if (op != REDUCE_SUM && op != REDUCE_MIN && op != REDUCE_MAX && op != REDUCE_MEAN)
+        return (tensor_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    if (axis >= t->ndim)
+        return (tensor_expect_t){ .has_value = false, .u.error = OUT_OF_BOUNDS };
+
+    /* View the tensor as outer x n x inner around the reduced axis; an
+     * ARRAY_STRUCT tensor is 1-D over its live elements */
+    size_t outer = 1u;
+    size_t inner = 1u;
+    size_t n     = t->len;
+    size_t shape[UINT8_MAX];
+    uint8_t rank = 0u;
+    if (t->mode == TENSOR_STRUCT) {
+        n = t->shape[axis];
+        for (uint8_t k = 0u; k < t->ndim; k++) {
+            if (k < axis) outer *= t->shape[k];
+            if (k > axis) inner *= t->shape[k];
+            if (k != axis) shape[rank++] = t->shape[k];
+        }
+    }
+    if (rank == 0u) shape[rank++] = 1u;
+
+    allocator_vtable_t av = (alloc_v.allocate != NULL) ? alloc_v : t->alloc_v;
+    tensor_expect_t r = init_tensor(rank, shape, t->dtype, av);
+    if (!r.has_value) return r;
+
+    error_code_t err = run(op, t->data, r.u.value->data, outer, n, inner);
+    if (err != NO_ERROR) {
+        return_tensor(r.u.value);
+        return (tensor_expect_t){ .has_value = false, .u.error = err };
+    }
+    return r;
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+#define SCAN_MIN_PER_THREAD 65536u  /* a scan is bandwidth bound; smaller blocks
+                                       finish before a thread starts */
+
+typedef struct {
+    const void* src;
+    void*       dst;
+    void*       offsets;   /* one entry per block: total, then carry-in */
+    size_t      len;
+    size_t      threads;
+    bool        exclusive;
+} _pscan_ctx_t;
+
+typedef struct {
+    const _pscan_ctx_t* ctx;
+    size_t              id;
+} _pscan_task_t;
+// --------------------------------------------------------------------------------
+
+static long double _scan_ldouble(long double*       out,
+                                 const long double* a,
+                                 size_t             len,
+                                 long double        carry,
+                                 bool               exclusive) {
+    for (size_t i = 0u; i < len; i++) {
+        long double const prev = carry;
+        carry += a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// --------------------------------------------------------------------------------
+
+static long double _scan_total_ldouble(const long double* a, size_t len) {
+    long double s = 0.0L;
+    for (size_t i = 0u; i < len; i++) s += a[i];
+    return s;
+}
+// --------------------------------------------------------------------------------
+
+/* There is no 64-bit sum kernel; a wrapping total is a plain loop the
+ * compiler vectorises. */
+static uint64_t _scan_total_uint64(const uint64_t* a, size_t len) {
+    uint64_t s = 0u;
+    for (size_t i = 0u; i < len; i++) s += a[i];
+    return s;
+}
+// --------------------------------------------------------------------------------
+
+/* Two-pass blocked scan over T.  SCAN has the simd_scan_<type> signature and
+ * TOTAL(a, n) returns the wrapped sum of a block. */
+#define PREFIX_SUM_DRIVER(SFX, T, SCAN, TOTAL)                                 \
+static void* _pscan_total_##SFX(void* arg) {                                   \
+    _pscan_task_t const* task = (_pscan_task_t const*)arg;                     \
+    _pscan_ctx_t const*  c    = task->ctx;                                     \
+    size_t const lo = _block_start(c->len, c->threads, task->id);              \
+    size_t const hi = _block_start(c->len, c->threads, task->id + 1u);         \
+    ((T*)c->offsets)[task->id] = (T)TOTAL((const T*)c->src + lo, hi - lo);     \
+    return NULL;                                                               \
+}                                                                              \
+                                                                               \
+static void* _pscan_block_##SFX(void* arg) {                                   \
+    _pscan_task_t const* task = (_pscan_task_t const*)arg;                     \
+    _pscan_ctx_t const*  c    = task->ctx;                                     \
+    size_t const lo = _block_start(c->len, c->threads, task->id);              \
+    size_t const hi = _block_start(c->len, c->threads, task->id + 1u);         \
+    SCAN((T*)c->dst + lo, (const T*)c->src + lo, hi - lo,                      \
+         ((T*)c->offsets)[task->id], c->exclusive);                            \
+    return NULL;                                                               \
+}                                                                              \
+                                                                               \
+static void _pscan_run_##SFX(_pscan_ctx_t* c) {                                \
+    if (c->threads == 1u) {                                                    \
+        SCAN((T*)c->dst, (const T*)c->src, c->len, (T)0, c->exclusive);        \
+        return;                                                                \
+    }                                                                          \
+    T             offsets[PSORT_MAX_THREADS];                                  \
+    _pscan_task_t tasks[PSORT_MAX_THREADS];                                    \
+    c->offsets = offsets;                                                      \
+    for (size_t i = 0u; i < c->threads; i++)                                   \
+        tasks[i] = (_pscan_task_t){ .ctx = c, .id = i };                       \
+                                                                               \
+    _parallel_phase(tasks, sizeof(tasks[0]), c->threads, _pscan_total_##SFX);  \
+    /* block totals -> block carry-ins */                                      \
+    SCAN(offsets, offsets, c->threads, (T)0, true);                            \
+    _parallel_phase(tasks, sizeof(tasks[0]), c->threads, _pscan_block_##SFX);  \
+}
+
+PREFIX_SUM_DRIVER(float,   float,       simd_scan_float,   simd_sum_float)
+PREFIX_SUM_DRIVER(double,  double,      simd_scan_double,  simd_sum_double)
+PREFIX_SUM_DRIVER(ldouble, long double, _scan_ldouble,     _scan_total_ldouble)
+PREFIX_SUM_DRIVER(uint8,   uint8_t,     simd_scan_uint8,   simd_sum_uint8)
+PREFIX_SUM_DRIVER(uint16,  uint16_t,    simd_scan_uint16,  simd_sum_uint16)
+PREFIX_SUM_DRIVER(uint32,  uint32_t,    simd_scan_uint32,  simd_sum_uint32)
+PREFIX_SUM_DRIVER(uint64,  uint64_t,    simd_scan_uint64,  _scan_total_uint64)
+// --------------------------------------------------------------------------------
+
+error_code_t cumulative_sum_tensor(tensor_t*       out,
+                                   const tensor_t* a,
+                                   scan_mode_t     mode,
+                                   size_t          num_threads) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    if (mode != SCAN_INCLUSIVE && mode != SCAN_EXCLUSIVE) return INVALID_ARG;
+
+    /* integer sums wrap, so signed dtypes share the unsigned scans */
+    void (*run)(_pscan_ctx_t*);
+    switch (a->dtype) {
+        case FLOAT_TYPE:   run = _pscan_run_float;   break;
+        case DOUBLE_TYPE:  run = _pscan_run_double;  break;
+        case LDOUBLE_TYPE: run = _pscan_run_ldouble; break;
+        case INT8_TYPE:
+        case UINT8_TYPE:   run = _pscan_run_uint8;   break;
+        case INT16_TYPE:
+        case UINT16_TYPE:  run = _pscan_run_uint16;  break;
+        case INT32_TYPE:
+        case UINT32_TYPE:  run = _pscan_run_uint32;  break;
+        case INT64_TYPE:
+        case UINT64_TYPE:  run = _pscan_run_uint64;  break;
+        default:           return TYPE_MISMATCH;
+    }
+
+    error_code_t err = prepare_elementwise_tensor(out, a, NULL);
+    if (err != NO_ERROR) return err;
+
+    _pscan_ctx_t ctx = {
+        .src       = a->data,
+        .dst       = out->data,
+        .offsets   = NULL,
+        .len       = a->len,
+        .threads   = _parallel_thread_count(num_threads, a->len,
+                                            SCAN_MIN_PER_THREAD),
+        .exclusive = (mode == SCAN_EXCLUSIVE)
+    };
+    run(&ctx);
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// BROADCASTING
+
+/* Elements per splat buffer when one operand is broadcast along the
+ * innermost merged axis.  The repeated scalar is written once per row and
+ * the row is then fed to the vector-vector kernel in strips of this size. */
+#define BCAST_STRIP 512u
+
+typedef void (*_bcast_row_fn)(binary_op_t op, void* z, const void* x, size_t sx,
+                              const void* y, size_t sy, size_t n);
+
+/* Shape of t as broadcasting sees it: an ARRAY_STRUCT tensor is 1-D over
+ * its len live elements */
+static const size_t* _bcast_shape(const tensor_t* t, uint8_t* ndim) {
+    if (t->mode == ARRAY_STRUCT) {
+        *ndim = 1u;
+        return &t->len;
+    }
+    *ndim = t->ndim;
+    return t->shape;
+}
+// --------------------------------------------------------------------------------
+
+/* Element strides of t along each of the rank result axes; an axis that t
+ * lacks or has extent 1 along is read through a zero stride */
+static void _bcast_strides(const tensor_t* t, uint8_t rank, size_t* st) {
+    uint8_t nt;
+    const size_t* ts = _bcast_shape(t, &nt);
+    size_t step = 1u;
+    for (uint8_t k = rank; k-- > 0u;) {
+        uint8_t const back = (uint8_t)(rank - 1u - k);
+        if (back >= nt) {
+            st[k] = 0u;
+            continue;
+        }
+        size_t const e = ts[nt - 1u - back];
+        st[k] = (e == 1u) ? 0u : step;
+        step *= e;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* True when out's buffer shares bytes with t's without being the same
+ * buffer of the same length */
+static bool _bcast_aliases(const tensor_t* out, size_t out_bytes,
+                           const tensor_t* t) {
+    size_t const    bytes = t->len * t->data_size;
+    uintptr_t const o     = (uintptr_t)out->data;
+    uintptr_t const p     = (uintptr_t)t->data;
+    if (o == p) return bytes != out_bytes;
+    return (o < p) ? (p - o < out_bytes) : (o - p < bytes);
+}
+// --------------------------------------------------------------------------------
+
+/* Integer zero test shared by every width; data_size is at most 8 here */
+static bool _bcast_has_zero(const tensor_t* t) {
+    for (size_t i = 0u; i < t->len; i++) {
+        uint64_t v = 0u;
+        memcpy(&v, t->data + i * t->data_size, t->data_size);
+        if (v == 0u) return true;
+    }
+    return false;
+}
+// --------------------------------------------------------------------------------
+
+/* Integer division has no vector instruction on any supported ISA.
+ * Divisors were checked for zero; the most negative value over -1 is
+ * negated in unsigned arithmetic so it wraps instead of trapping. */
+#define BCAST_DIV_SIGNED(SFX, T, U)                                             \
+static void _bcast_div_##SFX(T* z, const T* x, const T* y, size_t n) {          \
+    for (size_t i = 0u; i < n; i++)                                             \
+        z[i] = (y[i] == -1) ? (T)(0u - (U)x[i]) : (T)(x[i] / y[i]);             \
+}
+
+#define BCAST_DIV_UNSIGNED(SFX, T)                                              \
+static void _bcast_div_##SFX(T* z, const T* x, const T* y, size_t n) {          \
+    for (size_t i = 0u; i < n; i++) z[i] = (T)(x[i] / y[i]);                    \
+}
+
+BCAST_DIV_SIGNED(int8,    int8_t,   uint8_t)
+BCAST_DIV_SIGNED(int16,   int16_t,  uint16_t)
+BCAST_DIV_SIGNED(int32,   int32_t,  uint32_t)
+BCAST_DIV_SIGNED(int64,   int64_t,  uint64_t)
+BCAST_DIV_UNSIGNED(uint8,  uint8_t)
+BCAST_DIV_UNSIGNED(uint16, uint16_t)
+BCAST_DIV_UNSIGNED(uint32, uint32_t)
+BCAST_DIV_UNSIGNED(uint64, uint64_t)
+// --------------------------------------------------------------------------------
+
+/* One row of the innermost merged axis.  sx and sy are 1 for an operand
+ * walked contiguously and 0 for a broadcast one.  add, sub and mul wrap
+ * identically for signed and unsigned lanes, so signed dtypes run them
+ * through the unsigned kernels USFX. */
+#define BCAST_SIMD_ROW(SFX, T, USFX, U, DIV)                                    \
+static void _bcast_vec_##SFX(binary_op_t op, T* z, const T* x, const T* y,      \
+                             size_t n) {                                        \
+    switch (op) {                                                               \
+        case BINARY_ADD:                                                        \
+            simd_add_##USFX((U*)z, (const U*)x, (const U*)y, n);                \
+            break;                                                              \
+        case BINARY_SUB:                                                        \
+            simd_sub_##USFX((U*)z, (const U*)x, (const U*)y, n);                \
+            break;                                                              \
+        case BINARY_MUL:                                                        \
+            simd_mul_##USFX((U*)z, (const U*)x, (const U*)y, n);                \
+            break;                                                              \
+        case BINARY_DIV: DIV(z, x, y, n); break;                                \
+        case BINARY_MIN: simd_minimum_##SFX(z, x, y, n); break;                 \
+        default:         simd_maximum_##SFX(z, x, y, n); break;                 \
+    }                                                                           \
+}                                                                               \
+static void _bcast_row_##SFX(binary_op_t op, void* zp, const void* xp,          \
+                             size_t sx, const void* yp, size_t sy, size_t n) {  \
+    T*       z = (T*)zp;                                                        \
+    const T* x = (const T*)xp;                                                  \
+    const T* y = (const T*)yp;                                                  \
+    if (sx == sy) {                                                             \
+        _bcast_vec_##SFX(op, z, x, y, n);                                       \
+        return;                                                                 \
+    }                                                                           \
+    T splat[BCAST_STRIP];                                                       \
+    T const v = (sx == 0u) ? *x : *y;                                           \
+    size_t const m = (n < BCAST_STRIP) ? n : BCAST_STRIP;                       \
+    for (size_t i = 0u; i < m; i++) splat[i] = v;                               \
+    for (size_t s = 0u; s < n; s += BCAST_STRIP) {                              \
+        size_t const len = (n - s < BCAST_STRIP) ? n - s : BCAST_STRIP;         \
+        if (sx == 0u) _bcast_vec_##SFX(op, z + s, splat, y + s, len);           \
+        else          _bcast_vec_##SFX(op, z + s, x + s, splat, len);           \
+    }                                                                           \
+}
+
+BCAST_SIMD_ROW(float,  float,    float,  float,    simd_div_float)
+BCAST_SIMD_ROW(double, double,   double, double,   simd_div_double)
+BCAST_SIMD_ROW(int8,   int8_t,   uint8,  uint8_t,  _bcast_div_int8)
+BCAST_SIMD_ROW(uint8,  uint8_t,  uint8,  uint8_t,  _bcast_div_uint8)
+BCAST_SIMD_ROW(int16,  int16_t,  uint16, uint16_t, _bcast_div_int16)
+BCAST_SIMD_ROW(uint16, uint16_t, uint16, uint16_t, _bcast_div_uint16)
+BCAST_SIMD_ROW(int32,  int32_t,  uint32, uint32_t, _bcast_div_int32)
+BCAST_SIMD_ROW(uint32, uint32_t, uint32, uint32_t, _bcast_div_uint32)
+BCAST_SIMD_ROW(int64,  int64_t,  uint64, uint64_t, _bcast_div_int64)
+BCAST_SIMD_ROW(uint64, uint64_t, uint64, uint64_t, _bcast_div_uint64)
+// --------------------------------------------------------------------------------
+
+/* long double has no SIMD kernels; plain strided loops with the same
+ * semantics, NaN propagating through min and max */
+static inline long double _bcast_pick_ldouble(binary_op_t op, long double p,
+                                              long double q) {
+    if (isnan(p)) return p;
+    if (isnan(q)) return q;
+    if (op == BINARY_MIN) return (q < p) ? q : p;
+    return (q > p) ? q : p;
+}
+
+static void _bcast_row_ldouble(binary_op_t op, void* zp, const void* xp,
+                               size_t sx, const void* yp, size_t sy, size_t n) {
+    long double*       z = (long double*)zp;
+    const long double* x = (const long double*)xp;
+    const long double* y = (const long double*)yp;
+    for (size_t i = 0u; i < n; i++) {
+        long double const p = x[i * sx];
+        long double const q = y[i * sy];
+        switch (op) {
+            case BINARY_ADD: z[i] = p + q; break;
+            case BINARY_SUB: z[i] = p - q; break;
+            case BINARY_MUL: z[i] = p * q; break;
+            case BINARY_DIV: z[i] = p / q; break;
+            default:         z[i] = _bcast_pick_ldouble(op, p, q); break;
+        }
+    }
+}
+// --------------------------------------------------------------------------------
+
+error_code_t broadcast_tensor_shape(const tensor_t* a,
+                                    const tensor_t* b,
+                                    size_t*         shape,
+                                    uint8_t*        ndim) {
+    if (a == NULL || b == NULL || shape == NULL || ndim == NULL)
+        return NULL_POINTER;
+    if (a->len == 0u || b->len == 0u) return EMPTY;
+
+    uint8_t na;
+    uint8_t nb;
+    const size_t* sa = _bcast_shape(a, &na);
+    const size_t* sb = _bcast_shape(b, &nb);
+    uint8_t const rank = (na > nb) ? na : nb;
+
+    /* k counts axes from the right, where the two shapes are aligned */
+    for (uint8_t k = 0u; k < rank; k++) {
+        size_t const da = (k < na) ? sa[na - 1u - k] : 1u;
+        size_t const db = (k < nb) ? sb[nb - 1u - k] : 1u;
+        if (da != db && da != 1u && db != 1u) return SIZE_MISMATCH;
+        shape[rank - 1u - k] = (da > db) ? da : db;
+    }
+    *ndim = rank;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+error_code_t broadcast_tensor(tensor_t*       out,
+                              const tensor_t* a,
+                              const tensor_t* b,
+                              binary_op_t     op) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    if ((unsigned)op > (unsigned)BINARY_MAX)   return INVALID_ARG;
+
+    _bcast_row_fn row;
+    bool integer = true;
+    switch (a->dtype) {
+        case FLOAT_TYPE:   row = _bcast_row_float;   integer = false; break;
+        case DOUBLE_TYPE:  row = _bcast_row_double;  integer = false; break;
+        case LDOUBLE_TYPE: row = _bcast_row_ldouble; integer = false; break;
+        case INT8_TYPE:    row = _bcast_row_int8;    break;
+        case UINT8_TYPE:   row = _bcast_row_uint8;   break;
+        case INT16_TYPE:   row = _bcast_row_int16;   break;
+        case UINT16_TYPE:  row = _bcast_row_uint16;  break;
+        case INT32_TYPE:   row = _bcast_row_int32;   break;
+        case UINT32_TYPE:  row = _bcast_row_uint32;  break;
+        case INT64_TYPE:   row = _bcast_row_int64;   break;
+        case UINT64_TYPE:  row = _bcast_row_uint64;  break;
+        default:           return TYPE_MISMATCH;
+    }
+    if (out->dtype != a->dtype || b->dtype != a->dtype) return TYPE_MISMATCH;
+
+    size_t  shape[UINT8_MAX];
+    uint8_t rank;
+    error_code_t err = broadcast_tensor_shape(a, b, shape, &rank);
+    if (err != NO_ERROR) return err;
+
+    /* out must have the broadcast shape, or be an array that can take it */
+    uint8_t no;
+    const size_t* so = _bcast_shape(out, &no);
+    bool const fits = (no == rank) &&
+                      memcmp(so, shape, rank * sizeof(size_t)) == 0;
+    if (!fits && !(rank == 1u && out->mode == ARRAY_STRUCT &&
+                   out->alloc >= shape[0]))
+        return SIZE_MISMATCH;
+
+    size_t total = 1u;
+    for (uint8_t k = 0u; k < rank; k++) total *= shape[k];
+
+    size_t const bytes = total * a->data_size;
+    if (_bcast_aliases(out, bytes, a) || _bcast_aliases(out, bytes, b))
+        return INVALID_ARG;
+    if (op == BINARY_DIV && integer && _bcast_has_zero(b)) return DIV_BY_ZERO;
+    out->len = total;
+
+    size_t xs[UINT8_MAX];
+    size_t ys[UINT8_MAX];
+    _bcast_strides(a, rank, xs);
+    _bcast_strides(b, rank, ys);
+
+    /* Drop extent-1 axes and merge each axis into the one inside it when
+     * both operands step across the pair as one run.  Merged axes are
+     * stored innermost first. */
+    size_t  ext[UINT8_MAX];
+    size_t  sx[UINT8_MAX];
+    size_t  sy[UINT8_MAX];
+    size_t  idx[UINT8_MAX];
+    uint8_t m = 0u;
+    for (uint8_t k = rank; k-- > 0u;) {
+        if (shape[k] == 1u) continue;
+        if (m > 0u && xs[k] == sx[m - 1u] * ext[m - 1u] &&
+                      ys[k] == sy[m - 1u] * ext[m - 1u]) {
+            ext[m - 1u] *= shape[k];
+            continue;
+        }
+        ext[m] = shape[k];
+        sx[m]  = xs[k];
+        sy[m]  = ys[k];
+        idx[m] = 0u;
+        m++;
+    }
+    if (m == 0u) {
+        ext[0] = 1u;
+        sx[0]  = 0u;
+        sy[0]  = 0u;
+        m      = 1u;
+    }
+
+    /* Walk the outer merged axes as an odometer, one inner row per step */
+    size_t const ds   = a->data_size;
+    size_t const n    = ext[0];
+    size_t const rows = total / n;
+    size_t ox = 0u;
+    size_t oy = 0u;
+    for (size_t r = 0u; r < rows; r++) {
+        row(op, out->data + r * n * ds, a->data + ox * ds, sx[0],
+            b->data + oy * ds, sy[0], n);
+        for (uint8_t k = 1u; k < m; k++) {
+            ox += sx[k];
+            oy += sy[k];
+            if (++idx[k] < ext[k]) break;
+            ox -= sx[k] * ext[k];
+            oy -= sy[k] * ext[k];
+            idx[k] = 0u;
+        }
+    }
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// FILE STORAGE
+
+#define TENSOR_FILE_VERSION    1u
+#define TENSOR_FILE_BYTE_ORDER 0x01020304u
+
+static const char _tensor_file_magic[8] = { 'C', 'S', 'A', 'L', 'T', 'T', 'N', 'S' };
+
+/* Fixed part of the on-disk header; shape[ndim] and strides[ndim] follow
+ * as uint64_t.  Every field sits at its natural alignment, so the struct
+ * has no padding and is written and read as one block. */
+typedef struct {
+    char     magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t dtype;
+    uint8_t  ndim;
+    uint8_t  reserved[3];
+    uint64_t data_size;
+    uint64_t len;
+    uint64_t alignment;
+    uint64_t data_offset;
+} _tensor_file_header_t;
+
+_Static_assert(sizeof(_tensor_file_header_t) == 56u,
+               "tensor file header must not contain padding");
+// --------------------------------------------------------------------------------
+
+error_code_t write_tensor_file(const tensor_t* t,
+                               const char*     path,
+                               size_t          alignment) {
+    if (t == NULL || path == NULL)      return NULL_POINTER;
+    if (t->data == NULL || t->len == 0u) return EMPTY;
+    if (alignment == 0u) alignment = TENSOR_FILE_ALIGNMENT;
+    if ((alignment & (alignment - 1u)) != 0u || alignment > TENSOR_FILE_MAX_ALIGNMENT)
+        return INVALID_ARG;
+
+    /* An array is stored as the 1-D tensor of its live elements */
+    uint8_t const ndim = (t->mode == ARRAY_STRUCT) ? 1u : t->ndim;
+    uint64_t meta[2u * UINT8_MAX];
+    for (uint8_t i = 0u; i < ndim; i++) {
+        meta[i]        = (t->mode == ARRAY_STRUCT) ? t->len : t->shape[i];
+        meta[ndim + i] = (t->mode == ARRAY_STRUCT) ? t->data_size : t->strides[i];
+    }
+
+    size_t const meta_bytes = 2u * ndim * sizeof(uint64_t);
+    size_t const head_bytes = sizeof(_tensor_file_header_t) + meta_bytes;
+    size_t const offset     = (head_bytes + alignment - 1u) & ~(alignment - 1u);
+
+    _tensor_file_header_t h = {
+        .version     = TENSOR_FILE_VERSION,
+        .byte_order  = TENSOR_FILE_BYTE_ORDER,
+        .dtype       = t->dtype,
+        .ndim        = ndim,
+        .data_size   = t->data_size,
+        .len         = t->len,
+        .alignment   = alignment,
+        .data_offset = offset
+    };
+    memcpy(h.magic, _tensor_file_magic, sizeof(h.magic));
+
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) return FILE_OPEN;
+
+    static const uint8_t zeros[TENSOR_FILE_MAX_ALIGNMENT];
+    size_t const pad   = offset - head_bytes;
+    size_t const bytes = t->len * t->data_size;
+    bool ok = fwrite(&h, sizeof(h), 1u, f) == 1u &&
+              fwrite(meta, 1u, meta_bytes, f) == meta_bytes &&
+              (pad == 0u || fwrite(zeros, 1u, pad, f) == pad) &&
+              fwrite(t->data, 1u, bytes, f) == bytes;
+    ok = (fclose(f) == 0) && ok;
+    if (!ok) {
+        (void)remove(path);
+        return FILE_WRITE;
+    }
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+/* Allocator installed on a mapped tensor.  It forwards every request to the
+ * caller's allocator, except that the element buffer is the mapping itself:
+ * returning it unmaps the file and it can never be resized.  live counts the
+ * mapping plus every block handed out, so the record outlives the typed
+ * wrappers and copies that are still returned through this vtable. */
+typedef struct {
+    allocator_vtable_t parent;
+    void*              base;      /* start of the mapping                 */
+    size_t             length;    /* bytes mapped                         */
+    void*              data;      /* element buffer inside the mapping    */
+    _Atomic size_t     live;
+} _tensor_map_t;
+
+static void _tensor_map_release(_tensor_map_t* m) {
+    if (atomic_fetch_sub(&m->live, 1u) == 1u)
+        m->parent.return_element(m->parent.ctx, m);
+}
+
+static void_ptr_expect_t _tensor_map_counted(_tensor_map_t* m, void_ptr_expect_t r) {
+    if (r.has_value) atomic_fetch_add(&m->live, 1u);
+    return r;
+}
+
+static void_ptr_expect_t _tensor_map_alloc(void* ctx, size_t size, bool zeroed) {
+    _tensor_map_t* m = (_tensor_map_t*)ctx;
+    return _tensor_map_counted(m, m->parent.allocate(m->parent.ctx, size, zeroed));
+}
+
+static void_ptr_expect_t _tensor_map_alloc_aligned(void* ctx, size_t size,
+                                                   size_t align, bool zeroed) {
+    _tensor_map_t* m = (_tensor_map_t*)ctx;
+    if (m->parent.allocate_aligned == NULL)
+        return (void_ptr_expect_t){ .has_value = false, .u.error = OPERATION_UNAVAILABLE };
+    return _tensor_map_counted(m, m->parent.allocate_aligned(m->parent.ctx, size,
+                                                             align, zeroed));
+}
+
+static void_ptr_expect_t _tensor_map_realloc(void* ctx, void* old_ptr,
+                                             size_t old_size, size_t new_size,
+                                             bool zeroed) {
+    _tensor_map_t* m = (_tensor_map_t*)ctx;
+    if (old_ptr == m->data)
+        return (void_ptr_expect_t){ .has_value = false, .u.error = ILLEGAL_STATE };
+    if (m->parent.reallocate == NULL)
+        return (void_ptr_expect_t){ .has_value = false, .u.error = OPERATION_UNAVAILABLE };
+    return m->parent.reallocate(m->parent.ctx, old_ptr, old_size, new_size, zeroed);
+}
+
+static void_ptr_expect_t _tensor_map_realloc_aligned(void* ctx, void* old_ptr,
+                                                     size_t old_size, size_t new_size,
+                                                     bool zeroed, size_t align) {
+    _tensor_map_t* m = (_tensor_map_t*)ctx;
+    if (old_ptr == m->data)
+        return (void_ptr_expect_t){ .has_value = false, .u.error = ILLEGAL_STATE };
+    if (m->parent.reallocate_aligned == NULL)
+        return (void_ptr_expect_t){ .has_value = false, .u.error = OPERATION_UNAVAILABLE };
+    return m->parent.reallocate_aligned(m->parent.ctx, old_ptr, old_size, new_size,
+                                        zeroed, align);
+}
+
+static void _tensor_map_return(void* ctx, void* ptr) {
+    _tensor_map_t* m = (_tensor_map_t*)ctx;
+    if (ptr == NULL) return;
+    if (ptr == m->data) {
+        munmap(m->base, m->length);
+        m->data = NULL;
+    } else {
+        m->parent.return_element(m->parent.ctx, ptr);
+    }
+    _tensor_map_release(m);
+}
+// --------------------------------------------------------------------------------
+
+/* Validate the header at the start of a mapping of length bytes, and that
+ * the element data it describes lies inside the mapping */
+static error_code_t _tensor_file_check(const uint8_t* base, size_t length) {
+    _tensor_file_header_t h;
+    if (length < sizeof(h)) return FORMAT_INVALID;
+    memcpy(&h, base, sizeof(h));
+    if (memcmp(h.magic, _tensor_file_magic, sizeof(h.magic)) != 0) return FORMAT_INVALID;
+    if (h.version != TENSOR_FILE_VERSION || h.byte_order != TENSOR_FILE_BYTE_ORDER)
+        return VERSION_MISMATCH;
+    if (h.ndim == 0u) return FORMAT_INVALID;
+
+    const dtype_t* desc = init_dtype_registry() ? lookup_dtype(h.dtype) : NULL;
+    if (desc == NULL || desc->data_size != h.data_size) return TYPE_MISMATCH;
+
+    size_t const head_bytes = sizeof(h) + 2u * h.ndim * sizeof(uint64_t);
+    if (h.alignment == 0u || (h.alignment & (h.alignment - 1u)) != 0u ||
+        h.alignment > TENSOR_FILE_MAX_ALIGNMENT ||
+        h.data_offset % h.alignment != 0u ||
+        h.data_offset < head_bytes || h.data_offset > length)
+        return FORMAT_INVALID;
+
+    /* Shape must multiply to len and strides must be C-order */
+    const uint8_t* meta = base + sizeof(h);
+    uint64_t n = 1u;
+    uint64_t step = h.data_size;
+    for (uint8_t i = h.ndim; i-- > 0u;) {
+        uint64_t dim;
+        uint64_t stride;
+        memcpy(&dim, meta + i * sizeof(uint64_t), sizeof(dim));
+        memcpy(&stride, meta + (h.ndim + i) * sizeof(uint64_t), sizeof(stride));
+        if (dim == 0u || stride != step) return FORMAT_INVALID;
+        if (__builtin_mul_overflow(n, dim, &n) ||
+            __builtin_mul_overflow(step, dim, &step)) return FORMAT_INVALID;
+    }
+    if (n != h.len || h.len > (length - h.data_offset) / h.data_size)
+        return FORMAT_INVALID;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+tensor_expect_t map_tensor_file(const char*        path,
+                                allocator_vtable_t alloc_v) {
+    if (path == NULL || alloc_v.allocate == NULL || alloc_v.return_element == NULL)
+        return (tensor_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return (tensor_expect_t){ .has_value = false, .u.error = FILE_OPEN };
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return (tensor_expect_t){ .has_value = false, .u.error = FILE_READ };
+    }
+    if ((size_t)st.st_size < sizeof(_tensor_file_header_t)) {
+        close(fd);
+        return (tensor_expect_t){ .has_value = false, .u.error = FORMAT_INVALID };
+    }
+    size_t const length = (size_t)st.st_size;
+    /* Private and writable: in-place operations copy the pages they touch,
+     * so the file is never modified and untouched pages stay shared */
+    void* base = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);   /* the mapping holds its own reference to the file */
+    if (base == MAP_FAILED)
+        return (tensor_expect_t){ .has_value = false, .u.error = FILE_READ };
+
+    error_code_t err = _tensor_file_check((const uint8_t*)base, length);
+    if (err != NO_ERROR) {
+        munmap(base, length);
+        return (tensor_expect_t){ .has_value = false, .u.error = err };
+    }
+
+    _tensor_file_header_t h;
+    memcpy(&h, base, sizeof(h));
+
+    void_ptr_expect_t mr = alloc_v.allocate(alloc_v.ctx, sizeof(_tensor_map_t), true);
+    if (!mr.has_value) {
+        munmap(base, length);
+        return (tensor_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+    _tensor_map_t* m = (_tensor_map_t*)mr.u.value;
+    m->parent = alloc_v;
+    m->base   = base;
+    m->length = length;
+    m->data   = (uint8_t*)base + h.data_offset;
+    atomic_init(&m->live, 1u);   /* the mapping itself */
+
+    allocator_vtable_t const mv = {
+        .allocate           = _tensor_map_alloc,
+        .allocate_aligned   = _tensor_map_alloc_aligned,
+        .reallocate         = _tensor_map_realloc,
+        .reallocate_aligned = _tensor_map_realloc_aligned,
+        .return_element     = _tensor_map_return,
+        .deallocate         = NULL,
+        .ctx                = m
+    };
+
+    uint8_t const ndim = h.ndim;
+    void_ptr_expect_t hr = mv.allocate(mv.ctx, sizeof(tensor_t) + 2u * ndim * sizeof(size_t),
+                                       true);
+    if (!hr.has_value) {
+        mv.return_element(mv.ctx, m->data);
+        return (tensor_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+
+    tensor_t* t = (tensor_t*)hr.u.value;
+    t->shape   = t->meta;
+    t->strides = t->meta + ndim;
+    const uint8_t* meta = (const uint8_t*)base + sizeof(h);
+    for (uint8_t i = 0u; i < ndim; i++) {
+        uint64_t v;
+        memcpy(&v, meta + i * sizeof(uint64_t), sizeof(v));
+        t->shape[i] = (size_t)v;
+        memcpy(&v, meta + (ndim + i) * sizeof(uint64_t), sizeof(v));
+        t->strides[i] = (size_t)v;
+    }
+
+    t->data      = m->data;
+    t->len       = (size_t)h.len;
+    t->alloc     = (size_t)h.len;
+    t->data_size = (size_t)h.data_size;
+    t->dtype     = h.dtype;
+    t->mode      = TENSOR_STRUCT;
+    t->growth    = false;
+    t->alloc_v   = mv;
+    t->ndim      = ndim;
+    return (tensor_expect_t){ .has_value = true, .u.value = t };
+}
 // ================================================================================
 // ================================================================================
 // eof
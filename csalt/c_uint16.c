@@ -17,28 +17,10 @@
 #include "c_dtypes.h"
 
 #include <inttypes.h>
+#include <math.h>
+#include <string.h>
 
-#if defined(__AVX512BW__)
-#  include "simd_avx512_uint16.inl"
-#elif defined(__AVX2__)
-#  include "simd_avx2_uint16.inl"
-#elif defined(__AVX__)
-#  include "simd_avx_uint16.inl"
-#elif defined(__SSE4_1__)
-#  include "simd_sse41_uint16.inl"
-#elif defined(__SSSE3__)
-#  include "simd_sse3_uint16.inl"
-#elif defined(__SSE2__)
-#  include "simd_sse2_uint16.inl"
-#elif defined(__ARM_FEATURE_SVE2)
-#  include "simd_sve2_uint16.inl"
-#elif defined(__ARM_FEATURE_SVE)
-#  include "simd_sve_uint16.inl"
-#elif defined(__ARM_NEON)
-#  include "simd_neon_uint16.inl"
-#else
-#  include "simd_scalar_uint16.inl"
-#endif
+#include "simd_dispatch.h"
 // ================================================================================ 
 // ================================================================================ 
 
@@ -307,4 +289,283 @@ error_code_t min_uint16_tensor(const uint16_tensor_t* t, uint16_t* value) {
 }
 // ================================================================================
 // ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+error_code_t add_uint16_tensor(uint16_tensor_t*       out,
+                               const uint16_tensor_t* a,
+                               const uint16_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_add_uint16((uint16_t*)out->base->data, (const uint16_t*)a->base->data,
+                    (const uint16_t*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t sub_uint16_tensor(uint16_tensor_t*       out,
+                               const uint16_tensor_t* a,
+                               const uint16_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_sub_uint16((uint16_t*)out->base->data, (const uint16_t*)a->base->data,
+                    (const uint16_t*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t mul_uint16_tensor(uint16_tensor_t*       out,
+                               const uint16_tensor_t* a,
+                               const uint16_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_mul_uint16((uint16_t*)out->base->data, (const uint16_t*)a->base->data,
+                    (const uint16_t*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t div_uint16_tensor(uint16_tensor_t*       out,
+                               const uint16_tensor_t* a,
+                               const uint16_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    if (b->base == NULL)                       return NULL_POINTER;
+
+    const uint16_t* y = (const uint16_t*)b->base->data;
+    for (size_t i = 0u; i < b->base->len; i++) {
+        if (y[i] == 0) return DIV_BY_ZERO;
+    }
+
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    uint16_t*       z = (uint16_t*)out->base->data;
+    const uint16_t* x = (const uint16_t*)a->base->data;
+    for (size_t i = 0u; i < a->base->len; i++)
+        z[i] = (uint16_t)(x[i] / y[i]);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t muladd_uint16_tensor(uint16_tensor_t*       out,
+                                  const uint16_tensor_t* a,
+                                  uint16_t               mul,
+                                  uint16_t               add) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_muladd_uint16((uint16_t*)out->base->data, (const uint16_t*)a->base->data,
+                       (uint16_t)mul, (uint16_t)add, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t clamp_uint16_tensor(uint16_tensor_t*       out,
+                                 const uint16_tensor_t* a,
+                                 uint16_t               lo,
+                                 uint16_t               hi) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    if (lo > hi)                  return INVALID_ARG;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_clamp_uint16((uint16_t*)out->base->data, (const uint16_t*)a->base->data,
+                      lo, hi, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t abs_uint16_tensor(uint16_tensor_t*       out,
+                               const uint16_tensor_t* a) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    if (out->base->data != a->base->data)
+        memcpy(out->base->data, a->base->data, a->base->len * sizeof(uint16_t));
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t _reduce_guard(const uint16_tensor_t* t, const void* out) {
+    if (t == NULL || out == NULL)  return NULL_POINTER;
+    if (t->base == NULL)           return NULL_POINTER;
+    if (t->base->data == NULL)     return EMPTY;
+    if (t->base->len == 0u)        return EMPTY;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+static error_code_t _dot_guard(const uint16_tensor_t* a, const uint16_tensor_t* b,
+                               const void* out) {
+    if (a == NULL || b == NULL || out == NULL) return NULL_POINTER;
+    if (a->base == NULL || b->base == NULL)    return NULL_POINTER;
+    if (a->base->len == 0u)                    return EMPTY;
+    if (b->base->len != a->base->len)          return SIZE_MISMATCH;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t max_uint16_tensor(const uint16_tensor_t* t,
+                               uint16_t*              value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    *value = 0u;
+    return simd_max_uint16((const uint16_t*)t->base->data, t->base->len, value);
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t argmin_uint16_tensor(const uint16_tensor_t* t,
+                                  size_t*                index) {
+    error_code_t err = _reduce_guard(t, index);
+    if (err != NO_ERROR) return err;
+
+    const uint16_t* x = (const uint16_t*)t->base->data;
+    uint16_t        v = UINT16_MAX;
+    simd_min_uint16(x, t->base->len, &v);
+    *index = simd_lsearch_uint16((const uint16_t*)x, t->base->len, (uint16_t)v);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t argmax_uint16_tensor(const uint16_tensor_t* t,
+                                  size_t*                index) {
+    error_code_t err = _reduce_guard(t, index);
+    if (err != NO_ERROR) return err;
+
+    const uint16_t* x = (const uint16_t*)t->base->data;
+    uint16_t        v = 0u;
+    simd_max_uint16(x, t->base->len, &v);
+    *index = simd_lsearch_uint16((const uint16_t*)x, t->base->len, (uint16_t)v);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t sum_uint16_tensor(const uint16_tensor_t* t,
+                               uint64_t*              value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    *value = simd_sum_uint16((const uint16_t*)t->base->data, t->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t mean_uint16_tensor(const uint16_tensor_t* t,
+                                double*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    uint64_t s = simd_sum_uint16((const uint16_t*)t->base->data, t->base->len);
+    *value = (double)s / (double)t->base->len;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t l1_norm_uint16_tensor(const uint16_tensor_t* t,
+                                   double*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    *value = (double)simd_sum_uint16((const uint16_t*)t->base->data, t->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t l2_norm_uint16_tensor(const uint16_tensor_t* t,
+                                   double*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const uint16_t* x = (const uint16_t*)t->base->data;
+    double s = 0.0;
+    for (size_t i = 0u; i < t->base->len; i++)
+        s += (double)x[i] * (double)x[i];
+    *value = sqrt(s);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t dot_uint16_tensor(const uint16_tensor_t* a,
+                               const uint16_tensor_t* b,
+                               uint64_t*              value) {
+    error_code_t err = _dot_guard(a, b, value);
+    if (err != NO_ERROR) return err;
+
+    const uint16_t* x = (const uint16_t*)a->base->data;
+    const uint16_t* y = (const uint16_t*)b->base->data;
+    uint64_t s = 0;
+    for (size_t i = 0u; i < a->base->len; i++)
+        s += (uint64_t)x[i] * y[i];
+    *value = s;
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// AXIS REDUCTIONS
+
+uint16_tensor_expect_t reduce_uint16_tensor_axis(const uint16_tensor_t* t,
+                                                 uint8_t                axis,
+                                                 reduce_op_t            op,
+                                                 allocator_vtable_t     alloc_v) {
+    if (t == NULL)
+        return (uint16_tensor_expect_t){ .has_value = false,
+                                         .u.error   = NULL_POINTER };
+
+    tensor_expect_t r = reduce_tensor_axis(t->base, axis, op, alloc_v);
+    if (!r.has_value)
+        return (uint16_tensor_expect_t){ .has_value = false,
+                                         .u.error   = r.u.error };
+
+    /* Wrap the result on the allocator it was built with */
+    allocator_vtable_t av = r.u.value->alloc_v;
+    void_ptr_expect_t wr = av.allocate(av.ctx, sizeof(uint16_tensor_t), true);
+    if (!wr.has_value) {
+        return_tensor(r.u.value);
+        return (uint16_tensor_expect_t){ .has_value = false,
+                                         .u.error   = BAD_ALLOC };
+    }
+
+    uint16_tensor_t* a = (uint16_tensor_t*)wr.u.value;
+    a->base = r.u.value;
+    return (uint16_tensor_expect_t){ .has_value = true, .u.value = a };
+}
+// ================================================================================
+// ================================================================================
+// FILE STORAGE
+
+uint16_tensor_expect_t map_uint16_tensor_file(const char*        path,
+                                              allocator_vtable_t alloc_v) {
+    tensor_expect_t r = map_tensor_file(path, alloc_v);
+    if (!r.has_value)
+        return (uint16_tensor_expect_t){ .has_value = false, .u.error = r.u.error };
+    if (r.u.value->dtype != UINT16_TYPE) {
+        return_tensor(r.u.value);
+        return (uint16_tensor_expect_t){ .has_value = false, .u.error = TYPE_MISMATCH };
+    }
+
+    /* Allocate the wrapper through the mapped tensor's allocator, which
+     * keeps the mapping's bookkeeping alive until the wrapper is returned */
+    allocator_vtable_t av = r.u.value->alloc_v;
+    void_ptr_expect_t wr = av.allocate(av.ctx, sizeof(uint16_tensor_t), true);
+    if (!wr.has_value) {
+        return_tensor(r.u.value);
+        return (uint16_tensor_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+
+    uint16_tensor_t* a = (uint16_tensor_t*)wr.u.value;
+    a->base = r.u.value;
+    return (uint16_tensor_expect_t){ .has_value = true, .u.value = a };
+}
+// ================================================================================
+// ================================================================================
 // eof
@@ -16,28 +16,10 @@
 #include "c_dtypes.h"
 
 #include <inttypes.h>
+#include <math.h>
+#include <string.h>
 
-#if defined(__AVX512BW__)
-#  include "simd_avx512_uint32.inl"
-#elif defined(__AVX2__)
-#  include "simd_avx2_uint32.inl"
-#elif defined(__AVX__)
-#  include "simd_avx_uint32.inl"
-#elif defined(__SSE4_1__)
-#  include "simd_sse41_uint32.inl"
-#elif defined(__SSSE3__)
-#  include "simd_sse3_uint32.inl"
-#elif defined(__SSE2__)
-#  include "simd_sse2_uint32.inl"
-#elif defined(__ARM_FEATURE_SVE2)
-#  include "simd_sve2_uint32.inl"
-#elif defined(__ARM_FEATURE_SVE)
-#  include "simd_sve_uint32.inl"
-#elif defined(__ARM_NEON)
-#  include "simd_neon_uint32.inl"
-#else
-#  include "simd_scalar_uint32.inl"
-#endif
+#include "simd_dispatch.h"
 // ================================================================================ 
 // ================================================================================ 
 
@@ -305,6 +287,287 @@ error_code_t min_uint32_tensor(const uint32_tensor_t* t, uint32_t* value) {
     return simd_min_uint32((const uint32_t*)t->base->data, t->base->len, value);
 }
 
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+error_code_t add_uint32_tensor(uint32_tensor_t*       out,
+                               const uint32_tensor_t* a,
+                               const uint32_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_add_uint32((uint32_t*)out->base->data, (const uint32_t*)a->base->data,
+                    (const uint32_t*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t sub_uint32_tensor(uint32_tensor_t*       out,
+                               const uint32_tensor_t* a,
+                               const uint32_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_sub_uint32((uint32_t*)out->base->data, (const uint32_t*)a->base->data,
+                    (const uint32_t*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t mul_uint32_tensor(uint32_tensor_t*       out,
+                               const uint32_tensor_t* a,
+                               const uint32_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_mul_uint32((uint32_t*)out->base->data, (const uint32_t*)a->base->data,
+                    (const uint32_t*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t div_uint32_tensor(uint32_tensor_t*       out,
+                               const uint32_tensor_t* a,
+                               const uint32_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    if (b->base == NULL)                       return NULL_POINTER;
+
+    const uint32_t* y = (const uint32_t*)b->base->data;
+    for (size_t i = 0u; i < b->base->len; i++) {
+        if (y[i] == 0) return DIV_BY_ZERO;
+    }
+
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    uint32_t*       z = (uint32_t*)out->base->data;
+    const uint32_t* x = (const uint32_t*)a->base->data;
+    for (size_t i = 0u; i < a->base->len; i++)
+        z[i] = x[i] / y[i];
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t muladd_uint32_tensor(uint32_tensor_t*       out,
+                                  const uint32_tensor_t* a,
+                                  uint32_t               mul,
+                                  uint32_t               add) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_muladd_uint32((uint32_t*)out->base->data, (const uint32_t*)a->base->data,
+                       (uint32_t)mul, (uint32_t)add, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t clamp_uint32_tensor(uint32_tensor_t*       out,
+                                 const uint32_tensor_t* a,
+                                 uint32_t               lo,
+                                 uint32_t               hi) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    if (lo > hi)                  return INVALID_ARG;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_clamp_uint32((uint32_t*)out->base->data, (const uint32_t*)a->base->data,
+                      lo, hi, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t abs_uint32_tensor(uint32_tensor_t*       out,
+                               const uint32_tensor_t* a) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    if (out->base->data != a->base->data)
+        memcpy(out->base->data, a->base->data, a->base->len * sizeof(uint32_t));
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t _reduce_guard(const uint32_tensor_t* t, const void* out) {
+    if (t == NULL || out == NULL)  return NULL_POINTER;
+    if (t->base == NULL)           return NULL_POINTER;
+    if (t->base->data == NULL)     return EMPTY;
+    if (t->base->len == 0u)        return EMPTY;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+static error_code_t _dot_guard(const uint32_tensor_t* a, const uint32_tensor_t* b,
+                               const void* out) {
+    if (a == NULL || b == NULL || out == NULL) return NULL_POINTER;
+    if (a->base == NULL || b->base == NULL)    return NULL_POINTER;
+    if (a->base->len == 0u)                    return EMPTY;
+    if (b->base->len != a->base->len)          return SIZE_MISMATCH;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t max_uint32_tensor(const uint32_tensor_t* t,
+                               uint32_t*              value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    *value = 0u;
+    return simd_max_uint32((const uint32_t*)t->base->data, t->base->len, value);
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t argmin_uint32_tensor(const uint32_tensor_t* t,
+                                  size_t*                index) {
+    error_code_t err = _reduce_guard(t, index);
+    if (err != NO_ERROR) return err;
+
+    const uint32_t* x = (const uint32_t*)t->base->data;
+    uint32_t        v = UINT32_MAX;
+    simd_min_uint32(x, t->base->len, &v);
+    *index = simd_lsearch_uint32((const uint32_t*)x, t->base->len, (uint32_t)v);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t argmax_uint32_tensor(const uint32_tensor_t* t,
+                                  size_t*                index) {
+    error_code_t err = _reduce_guard(t, index);
+    if (err != NO_ERROR) return err;
+
+    const uint32_t* x = (const uint32_t*)t->base->data;
+    uint32_t        v = 0u;
+    simd_max_uint32(x, t->base->len, &v);
+    *index = simd_lsearch_uint32((const uint32_t*)x, t->base->len, (uint32_t)v);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t sum_uint32_tensor(const uint32_tensor_t* t,
+                               uint64_t*              value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    *value = simd_sum_uint32((const uint32_t*)t->base->data, t->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t mean_uint32_tensor(const uint32_tensor_t* t,
+                                double*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    uint64_t s = simd_sum_uint32((const uint32_t*)t->base->data, t->base->len);
+    *value = (double)s / (double)t->base->len;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t l1_norm_uint32_tensor(const uint32_tensor_t* t,
+                                   double*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    *value = (double)simd_sum_uint32((const uint32_t*)t->base->data, t->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t l2_norm_uint32_tensor(const uint32_tensor_t* t,
+                                   double*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const uint32_t* x = (const uint32_t*)t->base->data;
+    double s = 0.0;
+    for (size_t i = 0u; i < t->base->len; i++)
+        s += (double)x[i] * (double)x[i];
+    *value = sqrt(s);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t dot_uint32_tensor(const uint32_tensor_t* a,
+                               const uint32_tensor_t* b,
+                               uint64_t*              value) {
+    error_code_t err = _dot_guard(a, b, value);
+    if (err != NO_ERROR) return err;
+
+    const uint32_t* x = (const uint32_t*)a->base->data;
+    const uint32_t* y = (const uint32_t*)b->base->data;
+    uint64_t s = 0;
+    for (size_t i = 0u; i < a->base->len; i++) {
+        uint64_t p = (uint64_t)x[i] * y[i];
+        if (__builtin_add_overflow(s, p, &s)) return NUMERIC_OVERFLOW;
+    }
+    *value = s;
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// AXIS REDUCTIONS
+
+uint32_tensor_expect_t reduce_uint32_tensor_axis(const uint32_tensor_t* t,
+                                                 uint8_t                axis,
+                                                 reduce_op_t            op,
+                                                 allocator_vtable_t     alloc_v) {
+    if (t == NULL)
+        return (uint32_tensor_expect_t){ .has_value = false,
+                                         .u.error   = NULL_POINTER };
+
+    tensor_expect_t r = reduce_tensor_axis(t->base, axis, op, alloc_v);
+    if (!r.has_value)
+        return (uint32_tensor_expect_t){ .has_value = false,
+                                         .u.error   = r.u.error };
+
+    /* Wrap the result on the allocator it was built with */
+    allocator_vtable_t av = r.u.value->alloc_v;
+    void_ptr_expect_t wr = av.allocate(av.ctx, sizeof(uint32_tensor_t), true);
+    if (!wr.has_value) {
+        return_tensor(r.u.value);
+        return (uint32_tensor_expect_t){ .has_value = false,
+                                         .u.error   = BAD_ALLOC };
+    }
+
+    uint32_tensor_t* a = (uint32_tensor_t*)wr.u.value;
+    a->base = r.u.value;
+    return (uint32_tensor_expect_t){ .has_value = true, .u.value = a };
+}
+// ================================================================================
+// ================================================================================
+// FILE STORAGE
+
+uint32_tensor_expect_t map_uint32_tensor_file(const char*        path,
+                                              allocator_vtable_t alloc_v) {
+    tensor_expect_t r = map_tensor_file(path, alloc_v);
+    if (!r.has_value)
+        return (uint32_tensor_expect_t){ .has_value = false, .u.error = r.u.error };
+    if (r.u.value->dtype != UINT32_TYPE) {
+        return_tensor(r.u.value);
+        return (uint32_tensor_expect_t){ .has_value = false, .u.error = TYPE_MISMATCH };
+    }
+
+    /* Allocate the wrapper through the mapped tensor's allocator, which
+     * keeps the mapping's bookkeeping alive until the wrapper is returned */
+    allocator_vtable_t av = r.u.value->alloc_v;
+    void_ptr_expect_t wr = av.allocate(av.ctx, sizeof(uint32_tensor_t), true);
+    if (!wr.has_value) {
+        return_tensor(r.u.value);
+        return (uint32_tensor_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+
+    uint32_tensor_t* a = (uint32_tensor_t*)wr.u.value;
+    a->base = r.u.value;
+    return (uint32_tensor_expect_t){ .has_value = true, .u.value = a };
+}
 // ================================================================================
 // ================================================================================
 // eof
@@ -16,28 +16,10 @@
 #include "c_dtypes.h"
 
 #include <inttypes.h>
+#include <math.h>
+#include <string.h>
 
-#if defined(__AVX512BW__)
-#  include "simd_avx512_uint64.inl"
-#elif defined(__AVX2__)
-#  include "simd_avx2_uint64.inl"
-#elif defined(__AVX__)
-#  include "simd_avx_uint64.inl"
-#elif defined(__SSE4_1__)
-#  include "simd_sse41_uint64.inl"
-#elif defined(__SSSE3__)
-#  include "simd_sse3_uint64.inl"
-#elif defined(__SSE2__)
-#  include "simd_sse2_uint64.inl"
-#elif defined(__ARM_FEATURE_SVE2)
-#  include "simd_sve2_uint64.inl"
-#elif defined(__ARM_FEATURE_SVE)
-#  include "simd_sve_uint64.inl"
-#elif defined(__ARM_NEON)
-#  include "simd_neon_uint64.inl"
-#else
-#  include "simd_scalar_uint64.inl"
-#endif
+#include "simd_dispatch.h"
 // ================================================================================ 
 // ================================================================================ 
 
@@ -306,4 +288,298 @@ error_code_t min_uint64_tensor(const uint64_tensor_t* t, uint64_t* value) {
 }
 // ================================================================================
 // ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+error_code_t add_uint64_tensor(uint64_tensor_t*       out,
+                               const uint64_tensor_t* a,
+                               const uint64_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_add_uint64((uint64_t*)out->base->data, (const uint64_t*)a->base->data,
+                    (const uint64_t*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t sub_uint64_tensor(uint64_tensor_t*       out,
+                               const uint64_tensor_t* a,
+                               const uint64_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_sub_uint64((uint64_t*)out->base->data, (const uint64_t*)a->base->data,
+                    (const uint64_t*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t mul_uint64_tensor(uint64_tensor_t*       out,
+                               const uint64_tensor_t* a,
+                               const uint64_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    simd_mul_uint64((uint64_t*)out->base->data, (const uint64_t*)a->base->data,
+                    (const uint64_t*)b->base->data, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t div_uint64_tensor(uint64_tensor_t*       out,
+                               const uint64_tensor_t* a,
+                               const uint64_tensor_t* b) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    if (b->base == NULL)                       return NULL_POINTER;
+
+    const uint64_t* y = (const uint64_t*)b->base->data;
+    for (size_t i = 0u; i < b->base->len; i++) {
+        if (y[i] == 0) return DIV_BY_ZERO;
+    }
+
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, b->base);
+    if (err != NO_ERROR) return err;
+
+    uint64_t*       z = (uint64_t*)out->base->data;
+    const uint64_t* x = (const uint64_t*)a->base->data;
+    for (size_t i = 0u; i < a->base->len; i++)
+        z[i] = x[i] / y[i];
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t muladd_uint64_tensor(uint64_tensor_t*       out,
+                                  const uint64_tensor_t* a,
+                                  uint64_t               mul,
+                                  uint64_t               add) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_muladd_uint64((uint64_t*)out->base->data, (const uint64_t*)a->base->data,
+                       (uint64_t)mul, (uint64_t)add, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t clamp_uint64_tensor(uint64_tensor_t*       out,
+                                 const uint64_tensor_t* a,
+                                 uint64_t               lo,
+                                 uint64_t               hi) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    if (lo > hi)                  return INVALID_ARG;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    simd_clamp_uint64((uint64_t*)out->base->data, (const uint64_t*)a->base->data,
+                      lo, hi, a->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t abs_uint64_tensor(uint64_tensor_t*       out,
+                               const uint64_tensor_t* a) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    error_code_t err = prepare_elementwise_tensor(out->base, a->base, NULL);
+    if (err != NO_ERROR) return err;
+
+    if (out->base->data != a->base->data)
+        memcpy(out->base->data, a->base->data, a->base->len * sizeof(uint64_t));
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t _reduce_guard(const uint64_tensor_t* t, const void* out) {
+    if (t == NULL || out == NULL)  return NULL_POINTER;
+    if (t->base == NULL)           return NULL_POINTER;
+    if (t->base->data == NULL)     return EMPTY;
+    if (t->base->len == 0u)        return EMPTY;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+static error_code_t _dot_guard(const uint64_tensor_t* a, const uint64_tensor_t* b,
+                               const void* out) {
+    if (a == NULL || b == NULL || out == NULL) return NULL_POINTER;
+    if (a->base == NULL || b->base == NULL)    return NULL_POINTER;
+    if (a->base->len == 0u)                    return EMPTY;
+    if (b->base->len != a->base->len)          return SIZE_MISMATCH;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t max_uint64_tensor(const uint64_tensor_t* t,
+                               uint64_t*              value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    *value = 0u;
+    return simd_max_uint64((const uint64_t*)t->base->data, t->base->len, value);
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t argmin_uint64_tensor(const uint64_tensor_t* t,
+                                  size_t*                index) {
+    error_code_t err = _reduce_guard(t, index);
+    if (err != NO_ERROR) return err;
+
+    const uint64_t* x = (const uint64_t*)t->base->data;
+    uint64_t        v = UINT64_MAX;
+    simd_min_uint64(x, t->base->len, &v);
+    *index = simd_lsearch_uint64((const uint64_t*)x, t->base->len, (uint64_t)v);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t argmax_uint64_tensor(const uint64_tensor_t* t,
+                                  size_t*                index) {
+    error_code_t err = _reduce_guard(t, index);
+    if (err != NO_ERROR) return err;
+
+    const uint64_t* x = (const uint64_t*)t->base->data;
+    uint64_t        v = 0u;
+    simd_max_uint64(x, t->base->len, &v);
+    *index = simd_lsearch_uint64((const uint64_t*)x, t->base->len, (uint64_t)v);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t sum_uint64_tensor(const uint64_tensor_t* t,
+                               uint64_t*              value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const uint64_t* x = (const uint64_t*)t->base->data;
+    uint64_t s = 0;
+    for (size_t i = 0u; i < t->base->len; i++) {
+        if (__builtin_add_overflow(s, x[i], &s)) return NUMERIC_OVERFLOW;
+    }
+    *value = s;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t mean_uint64_tensor(const uint64_tensor_t* t,
+                                double*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const uint64_t* x = (const uint64_t*)t->base->data;
+    long double s = 0.0L;
+    for (size_t i = 0u; i < t->base->len; i++)
+        s += (long double)x[i];
+    *value = (double)(s / (long double)t->base->len);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t l1_norm_uint64_tensor(const uint64_tensor_t* t,
+                                   double*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const uint64_t* x = (const uint64_t*)t->base->data;
+    long double s = 0.0L;
+    for (size_t i = 0u; i < t->base->len; i++)
+        s += (long double)x[i];
+    *value = (double)s;
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t l2_norm_uint64_tensor(const uint64_tensor_t* t,
+                                   double*                value) {
+    error_code_t err = _reduce_guard(t, value);
+    if (err != NO_ERROR) return err;
+
+    const uint64_t* x = (const uint64_t*)t->base->data;
+    long double s = 0.0L;
+    for (size_t i = 0u; i < t->base->len; i++)
+        s += (long double)x[i] * (long double)x[i];
+    *value = (double)sqrtl(s);
+    return NO_ERROR;
+}
+// -------------------------------------------------------------------------------- 
+
+error_code_t dot_uint64_tensor(const uint64_tensor_t* a,
+                               const uint64_tensor_t* b,
+                               uint64_t*              value) {
+    error_code_t err = _dot_guard(a, b, value);
+    if (err != NO_ERROR) return err;
+
+    const uint64_t* x = (const uint64_t*)a->base->data;
+    const uint64_t* y = (const uint64_t*)b->base->data;
+    uint64_t s = 0;
+    for (size_t i = 0u; i < a->base->len; i++) {
+        uint64_t p;
+        if (__builtin_mul_overflow(x[i], y[i], &p)) return NUMERIC_OVERFLOW;
+        if (__builtin_add_overflow(s, p, &s)) return NUMERIC_OVERFLOW;
+    }
+    *value = s;
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// AXIS REDUCTIONS
+
+uint64_tensor_expect_t reduce_uint64_tensor_axis(const uint64_tensor_t* t,
+                                                 uint8_t                axis,
+                                                 reduce_op_t            op,
+                                                 allocator_vtable_t     alloc_v) {
+    if (t == NULL)
+        return (uint64_tensor_expect_t){ .has_value = false,
+                                         .u.error   = NULL_POINTER };
+
+    tensor_expect_t r = reduce_tensor_axis(t->base, axis, op, alloc_v);
+    if (!r.has_value)
+        return (uint64_tensor_expect_t){ .has_value = false,
+                                         .u.error   = r.u.error };
+
+    /* Wrap the result on the allocator it was built with */
+    allocator_vtable_t av = r.u.value->alloc_v;
+    void_ptr_expect_t wr = av.allocate(av.ctx, sizeof(uint64_tensor_t), true);
+    if (!wr.has_value) {
+        return_tensor(r.u.value);
+        return (uint64_tensor_expect_t){ .has_value = false,
+                                         .u.error   = BAD_ALLOC };
+    }
+
+    uint64_tensor_t* a = (uint64_tensor_t*)wr.u.value;
+    a->base = r.u.value;
+    return (uint64_tensor_expect_t){ .has_value = true, .u.value = a };
+}
+// ================================================================================
+// ================================================================================
+// FILE STORAGE
+
+uint64_tensor_expect_t map_uint64_tensor_file(const char*        path,
+                                              allocator_vtable_t alloc_v) {
+    tensor_expect_t r = map_tensor_file(path, alloc_v);
+    if (!r.has_value)
+        return (uint64_tensor_expect_t){ .has_value = false, .u.error = r.u.error };
+    if (r.u.value->dtype != UINT64_TYPE) {
+        return_tensor(r.u.value);
+        return (uint64_tensor_expect_t){ .has_value = false, .u.error = TYPE_MISMATCH };
+    }
+
+    /* Allocate the wrapper through the mapped tensor's allocator, which
+     * keeps the mapping's bookkeeping alive until the wrapper is returned */
+    allocator_vtable_t av = r.u.value->alloc_v;
+    void_ptr_expect_t wr = av.allocate(av.ctx, sizeof(uint64_tensor_t), true);
+    if (!wr.has_value) {
+        return_tensor(r.u.value);
+        return (uint64_tensor_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+    }
+
+    uint64_tensor_t* a = (uint64_tensor_t*)wr.u.value;
+    a->base = r.u.value;
+    return (uint64_tensor_expect_t){ .has_value = true, .u.value = a };
+}
+// ================================================================================
+// ================================================================================
 // eof
@@ -52,6 +52,7 @@
 #include <string.h>  // memset
 #include <stddef.h> // max_aling_t
 #include <stdalign.h> // alignof 
+#include <stdio.h>   // FILE
 
 #include "c_error.h"
 // ================================================================================ 
@@ -214,6 +215,51 @@ typedef struct {
 } arena_expect_t;
 // -------------------------------------------------------------------------------- 
 
+/**
+ * @brief Page size policy for OS-backed allocator memory.
+ *
+ * Used both to request a backing (see ::mem_backing_t) and to report the
+ * policy the kernel actually granted.
+ */
+typedef enum {
+    PAGES_DEFAULT = 0,  /**< Base pages from malloc() or a plain mmap()       */
+    PAGES_THP     = 1,  /**< Transparent huge pages via madvise(MADV_HUGEPAGE) */
+    PAGES_HUGETLB = 2   /**< Reserved huge pages via mmap(MAP_HUGETLB)         */
+} page_policy_t;
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Memory backing for dynamic arenas and buddy pools.
+ *
+ * Passed to init_dynamic_arena_with_backing() and
+ * init_buddy_allocator_with_backing() to describe the request, and returned
+ * by arena_backing() and buddy_backing() to describe what is in effect.
+ *
+ * Huge-page and NUMA requests are best effort.  PAGES_HUGETLB falls back to
+ * PAGES_THP when the reserved huge-page pool is empty, PAGES_THP falls back
+ * to PAGES_DEFAULT when transparent huge pages are disabled, and a NUMA bind
+ * the kernel refuses leaves the memory unbound.  Set @c strict to turn any
+ * such fallback into an ::UNSUPPORTED error instead.
+ *
+ * NUMA placement uses mbind(MPOL_BIND) on Linux and is applied before the
+ * pages are first touched; other platforms always fall back.
+ */
+typedef struct {
+    page_policy_t pages;      /**< Page size policy                          */
+    int           numa_node;  /**< NUMA node to bind to, or -1 for no binding */
+    bool          strict;     /**< Fail instead of falling back               */
+} mem_backing_t;
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Return a short lowercase name for a page policy.
+ *
+ * @param pages  Policy to name.
+ * @return "default", "thp" or "hugetlb"; "unknown" for other values.
+ */
+const char* page_policy_name(page_policy_t pages);
+// -------------------------------------------------------------------------------- 
+
 #if ARENA_ENABLE_DYNAMIC
 /**
  * @brief Initialize a dynamically growing arena allocator.
@@ -328,6 +374,52 @@ typedef struct {
  * @endcode
  */
 arena_expect_t init_dynamic_arena(size_t bytes, bool resize, size_t min_chunk_in, size_t base_align_in);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Initialize a dynamic arena on huge pages and/or a specific NUMA node.
+ *
+ * Behaves like init_dynamic_arena(), except that the initial region and every
+ * growth chunk are mapped directly from the operating system with the
+ * requested @p backing instead of coming from @c malloc().  Each mapping is
+ * rounded up to the page size in use (the huge page size for PAGES_THP and
+ * PAGES_HUGETLB) and the rounding is handed to the arena as usable capacity.
+ *
+ * Passing @c {PAGES_DEFAULT, -1, false} is identical to init_dynamic_arena().
+ *
+ * The policy actually applied is available from arena_backing() and is
+ * printed by arena_stats().  When growth chunks are granted different
+ * policies, the weakest one is reported, and the NUMA node is reported only
+ * if every chunk is bound to it.
+ *
+ * @param bytes          See init_dynamic_arena().
+ * @param resize         See init_dynamic_arena().
+ * @param min_chunk_in   See init_dynamic_arena().
+ * @param base_align_in  See init_dynamic_arena().
+ * @param backing        Requested page policy and NUMA node.
+ *
+ * @return An ::arena_expect_t.  In addition to the errors of
+ *         init_dynamic_arena():
+ * @retval INVALID_ARG  If @p backing names an unknown policy or a node
+ *                      outside [-1, 1024).
+ * @retval UNSUPPORTED  If @p backing.strict is set and the kernel did not
+ *                      grant the exact request.  Growth under a strict
+ *                      backing fails with the same code.
+ *
+ * @code{.c}
+ * mem_backing_t want = { PAGES_HUGETLB, 0, false };
+ * arena_expect_t r = init_dynamic_arena_with_backing(64u << 20, true, 0u, 0u, want);
+ * if (r.has_value) {
+ *     mem_backing_t got = arena_backing(r.u.value);
+ *     printf("%s pages\n", page_policy_name(got.pages));   // may be "thp"
+ *     free_arena(r.u.value);
+ * }
+ * @endcode
+ */
+arena_expect_t init_dynamic_arena_with_backing(size_t bytes, bool resize,
+                                               size_t min_chunk_in,
+                                               size_t base_align_in,
+                                               mem_backing_t backing);
 #endif
 // -------------------------------------------------------------------------------- 
 
@@ -884,6 +976,9 @@ void free_arena(arena_t* arena);
  *   only when the arena is reset with ::reset_arena() or destroyed via
  *   ::free_arena().
  *
+ * - Safe to call from many threads at once only after
+ *   ::toggle_arena_concurrent() has put the arena in concurrent mode.
+ *
  * @pre
  *     - `arena` must be initialized.
  *     - `arena->alignment` must be a non-zero power-of-two.
@@ -1881,6 +1976,47 @@ size_t arena_min_chunk_size(const arena_t* arena);
  */
 void toggle_arena_resize(arena_t* arena, bool toggle);
 #endif
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Switch an arena between single-threaded and lock-free
+ *        multi-producer bump allocation.
+ *
+ * In concurrent mode any number of threads may call @c alloc_arena(),
+ * @c alloc_arena_aligned() and @c realloc_arena() on the same arena (and
+ * through @c arena_allocator()) without a lock.  The current chunk's bump
+ * offset is advanced with an atomic fetch-add, and when a dynamic arena with
+ * growth enabled runs out of space, the new chunk is installed with a
+ * compare-and-swap on the arena's tail.  Threads that lose that race release
+ * their chunk and retry on the winner's.
+ *
+ * Each concurrent allocation reserves its size rounded up to the arena
+ * alignment, plus the extra padding an alignment stricter than the arena's
+ * could need.  @c arena_size() therefore reports somewhat more than in
+ * single-threaded mode.  Those reservations must start on the arena
+ * alignment, so switching the mode on (and @c restore_arena() while it is
+ * on) first pads the cursor up to it, charged like any other padding.
+ *
+ * @param arena   Arena to modify.  NULL or uninitialized arenas are ignored.
+ * @param toggle  @c true to enable concurrent mode, @c false to return to
+ *                plain bumping from wherever the producers left off.
+ *
+ * @warning The mode switch itself, and @c reset_arena(), @c save_arena(),
+ *          @c restore_arena(), @c toggle_arena_resize(), @c arena_stats() and
+ *          @c free_arena(), are not concurrent operations.  Call them only
+ *          while no thread is allocating, for example after joining the
+ *          producers.
+ *
+ * @par Example
+ * @code{.c}
+ * arena_t *a = init_darena(1u << 20, true).u.value;
+ * toggle_arena_concurrent(a, true);
+ * // ... worker threads call alloc_arena(a, n, false) ...
+ * // join workers
+ * reset_arena(a, true);
+ * @endcode
+ */
+void toggle_arena_concurrent(arena_t* arena, bool toggle);
 // ================================================================================ 
 // ================================================================================ 
 // LOG FUNCTIONS 
@@ -1894,6 +2030,7 @@ void toggle_arena_resize(arena_t* arena, bool toggle);
  * @code
  * Arena Statistics:
  *   Type: STATIC
+ *   Backing: default pages, NUMA node none
  *   Used: 1024 bytes
  *   Capacity: 4096 bytes
  *   Total (with overhead): 8192 bytes
@@ -1918,6 +2055,8 @@ void toggle_arena_resize(arena_t* arena, bool toggle);
  *
  * @note The report includes:
  *       - Type: "STATIC" or "DYNAMIC" (derived from @c arena->mem_type).
+ *       - Backing: the page policy and NUMA node in effect (see
+ *         arena_backing()).
  *       - Used: @c arena->len (bytes consumed, including per-allocation padding).
  *       - Capacity: @c arena->alloc (sum of usable data bytes across chunks).
  *       - Total (with overhead): @c arena->tot_alloc (implementation accounting of
@@ -2020,6 +2159,30 @@ bool arena_stats(const arena_t* arena, char* buffer, size_t buffer_size);
  * @sa init_arena_with_arena(), toggle_arena_resize(), free_arena()
  */
 bool arena_owns_memory(const arena_t* arena);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Return the memory backing in effect for an arena.
+ *
+ * Arenas from init_dynamic_arena() and init_static_arena() report
+ * @c {PAGES_DEFAULT, -1}.  Sub-arenas report the backing of the parent arena
+ * or buddy pool they were carved from.  The @c strict field echoes the
+ * original request.
+ *
+ * @param arena  Arena to query; NULL yields @c {PAGES_DEFAULT, -1, false}.
+ * @return The page policy and NUMA node actually applied.
+ */
+mem_backing_t arena_backing(const arena_t* arena);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Report whether an arena is in lock-free multi-producer mode.
+ *
+ * @param arena  Arena to query.
+ * @return @c true if toggle_arena_concurrent(arena, true) is in effect;
+ *         @c false otherwise or if @p arena is NULL.
+ */
+bool arena_is_concurrent(const arena_t* arena);
 // ================================================================================ 
 // ================================================================================ 
 
@@ -4241,10 +4404,17 @@ void free_freelist(freelist_t* fl);
  *   - alignment padding between the free block and the user region
  *   - full-block consumption when the remaining fragment is too small to
  *     form another free block
+ *   - rounding of every block to a 16-byte granule
  *
  * These internal details are fully managed by the allocator and are invisible
  * to the caller.
  *
+ * Free blocks are kept in segregated size-class bins (a two-level,
+ * TLSF-style index: power-of-two classes split into eight linear
+ * sub-classes) with bitmaps of the non-empty bins, so finding a block
+ * takes constant time regardless of how many free blocks exist.  The
+ * search is a good fit rather than a first fit in address order.
+ *
  * Memory returned by this function must be released back to the freelist using
  * ::return_freelist_element(). The allocator performs block coalescing where
  * possible to reduce external fragmentation.
@@ -4643,7 +4813,9 @@ void_ptr_expect_t realloc_freelist_aligned(freelist_t* fl,
  * ::alloc_freelist_aligned and reinserts it into the freelist as a
  * free block. If adjacent free blocks exist immediately before or after
  * the returned region, they are automatically coalesced, reducing
- * external fragmentation.
+ * external fragmentation.  Neighbours are found through boundary tags
+ * rather than a list walk, so the cost does not depend on the number of
+ * free blocks.
  *
  * The function verifies:
  *
@@ -5002,10 +5174,9 @@ bool freelist_owns_arena(const freelist_t* fl);
  *  - determining whether a requested freelist size is valid
  *  - performing compile-time or runtime capacity checks
  *
- * The value returned is constant for the lifetime of the program and is
- * typically:
- *
- *     sizeof(free_block_t)
+ * The value returned is constant for the lifetime of the program: the
+ * smallest free block, which must hold the block's size tag, its two bin
+ * links and a trailing size word (32 bytes on 64-bit targets).
  *
  * @return
  *     The minimum number of usable bytes (`size_t`) required to initialize a
@@ -5046,7 +5217,10 @@ size_t min_freelist_alloc();
  *   - total bytes carved from the parent arena (including freelist header)
  *   - utilization percentage of the freelist region
  *   - alignment requirements
- *   - enumeration of free blocks (address and size)
+ *   - enumeration of free blocks (address and size, in address order)
+ *   - the largest free block and an external fragmentation figure,
+ *     ``100 * (1 - largest_free / total_free)``: 0% when all free memory
+ *     is one block, approaching 100% as it splinters into small pieces
  *
  * The string is written into the caller-provided buffer using the internal
  * `_buf_appendf()` utility. Output is always null-terminated as long as the
@@ -5937,8 +6111,13 @@ typedef struct {
  *     or internal accounting).
  *
  * @retval BAD_ALLOC
- *     Allocation of the control structure, free-list array, or OS-level backing
- *     pool fails.
+ *     Allocation of the control structure, free-list array, free bitmaps, or
+ *     OS-level backing pool fails.
+ *
+ * @note
+ *     Besides the pool, the allocator keeps one free bit per potential block
+ *     at every level (about pool_size / min_block_size * 2 bits in total) so
+ *     that coalescing never scans a free list.
  *
  * @note
  *     The resulting allocator is *not* resizable; its pool size is fixed for
@@ -5995,6 +6174,38 @@ typedef struct {
 buddy_expect_t init_buddy_allocator(size_t pool_size, size_t min_block_size, size_t base_align);
 // -------------------------------------------------------------------------------- 
 
+/**
+ * @brief Initialize a buddy allocator whose pool sits on huge pages and/or a
+ *        specific NUMA node.
+ *
+ * Identical to ::init_buddy_allocator() except for how the pool is mapped.
+ * With PAGES_HUGETLB the mapping is rounded up to the huge page size; with
+ * PAGES_THP it is additionally aligned to the huge page size so the kernel
+ * can back it with transparent huge pages.  A NUMA bind is applied before
+ * the pool is first touched.  Fallbacks follow ::mem_backing_t, and the
+ * result is available from ::buddy_backing() and ::buddy_stats().
+ *
+ * @param pool_size       See ::init_buddy_allocator().
+ * @param min_block_size  See ::init_buddy_allocator().
+ * @param base_align      See ::init_buddy_allocator().
+ * @param backing         Requested page policy and NUMA node.
+ *
+ * @return A ::buddy_expect_t.  In addition to the errors of
+ *         ::init_buddy_allocator(), INVALID_ARG for a malformed @p backing
+ *         and UNSUPPORTED when @p backing.strict is set and the request could
+ *         not be met exactly.
+ *
+ * @code{.c}
+ * mem_backing_t want = { PAGES_THP, 1, false };
+ * buddy_expect_t be = init_buddy_allocator_with_backing(1u << 26, 64, 0, want);
+ * @endcode
+ */
+buddy_expect_t init_buddy_allocator_with_backing(size_t pool_size,
+                                                 size_t min_block_size,
+                                                 size_t base_align,
+                                                 mem_backing_t backing);
+// -------------------------------------------------------------------------------- 
+
 /**
  * @brief Destroy a buddy allocator and release all associated resources.
  *
@@ -6427,7 +6638,9 @@ void_ptr_expect_t alloc_buddy_aligned(buddy_t *b,
  *   4. The allocator’s accounting value ``len`` is decreased by the block size.
  *   5. If the buddy block (same order, XOR offset) is free, the two blocks are
  *      coalesced into a larger block, repeating until no further buddy merge
- *      is possible.
+ *      is possible.  Whether a buddy is free is read from a per-level bitmap
+ *      and free lists are doubly linked, so each merge step is O(1) however
+ *      many free blocks the pool holds.
  *   6. The resulting block is inserted into the appropriate free list.
  *
  * @param b
@@ -6446,8 +6659,10 @@ void_ptr_expect_t alloc_buddy_aligned(buddy_t *b,
  *     After this operation, @p ptr and any derived pointers become invalid.
  *
  * @warning
- *     Passing a pointer that was not allocated by this allocator, or one that
- *     was already freed, results in undefined behavior.
+ *     Passing a pointer that was not allocated by this allocator results in
+ *     undefined behavior.  Returning a block that is still on a free list
+ *     (a double free of an uncoalesced block) is detected and returns
+ *     `false`.
  *
  * @code{.c}
  * buddy_t *b = init_buddy_allocator(4096, 64, 32);
@@ -7098,6 +7313,8 @@ size_t buddy_largest_block(const buddy_t *b);
  *
  *   - Total pool size in bytes.
  *   - Minimum and maximum block sizes (in bytes).
+ *   - The page policy and NUMA node the pool is backed by (see
+ *     ::buddy_backing()).
  *   - Bytes currently “used” (sum of allocated block sizes).
  *   - Remaining bytes (pool size minus used).
  *   - Total memory including allocator overhead (`total_alloc`).
@@ -7171,6 +7388,15 @@ size_t buddy_largest_block(const buddy_t *b);
 bool buddy_stats(const buddy_t *buddy, char *buffer, size_t buffer_size);
 // -------------------------------------------------------------------------------- 
 
+/**
+ * @brief Return the memory backing in effect for a buddy pool.
+ *
+ * @param buddy  Allocator to query; NULL yields @c {PAGES_DEFAULT, -1, false}.
+ * @return The page policy and NUMA node the pool was actually mapped with.
+ */
+mem_backing_t buddy_backing(const buddy_t *buddy);
+// -------------------------------------------------------------------------------- 
+
 /**
  * @brief Return the default alignment used by the buddy allocator.
  *
@@ -7488,6 +7714,12 @@ typedef struct {
  * - An empty free list.
  * - Zero bytes in use (``slab->len == 0``).
  *
+ * Every slab page is a single buddy block of the same order, so the slab
+ * also allocates a page map from @p buddy with one pointer per block of
+ * that order in the pool (``pool_size / block_size`` entries).  The map
+ * lets ::return_slab() and ::is_slab_ptr() find the owning page in
+ * constant time, and is included in ::total_slab_alloc().
+ *
  * Allocation from the slab is performed using ::alloc_slab() and related
  * functions, which return a ::void_ptr_expect_t describing either a valid
  * object pointer or an error code.
@@ -7517,10 +7749,12 @@ typedef struct {
  *
  *          - ::INVALID_ARG        — invalid arguments (NULL buddy, zero size)
  *          - ::ALIGNMENT_ERROR    — alignment normalization failure
- *          - ::BAD_ALLOC          — underlying buddy allocation failure
+ *          - ::BAD_ALLOC          — underlying buddy allocation failure,
+ *            or a page would not fit in the buddy pool
  *
  * @note
- *        The slab allocator does not free memory itself. Destroying the
+ *        Empty pages beyond one cached page are handed back to @p buddy by
+ *        ::return_slab(); the slab_t and page map are not. Destroying the
  *        backing buddy allocator invalidates all slab pages and allocations.
  *
  * @par Example
@@ -7698,11 +7932,16 @@ void_ptr_expect_t alloc_slab(slab_t *slab, bool zeroed);
  * same slab allocator instance.
  *
  * Returning an object:
- *  - Pushes the slot back onto the slab’s global free list.
+ *  - Pushes the slot back onto the free list of the page that owns it.
  *  - Decrements the internal usage counter (``slab->len``) by the object size.
- *
- * This function performs strict pointer validation to ensure that @p ptr
- * refers to a valid slot inside a slab page managed by @p slab. This includes:
+ *  - If the page is now empty and another empty page is already cached,
+ *    returns the page to the backing buddy allocator.  One empty page is
+ *    kept so alternating alloc/free at a page boundary does not thrash.
+ *
+ * The owning page is found in constant time through the slab's page map,
+ * independent of the number of pages.  This function performs strict
+ * pointer validation to ensure that @p ptr refers to a valid slot inside a
+ * slab page managed by @p slab. This includes:
  *  - Checking that the page exists and belongs to this slab.
  *  - Checking that @p ptr lies inside the slot region of the page.
  *  - Verifying that @p ptr is aligned on a slot boundary.
@@ -7914,9 +8153,8 @@ size_t slab_total_blocks(const slab_t *slab);
  * @brief Query the number of free (unallocated) slots in a slab allocator.
  *
  * Returns the number of currently available allocation slots in @p slab.
- * This is computed by walking the slab’s global free list and counting the
- * number of entries. Each entry corresponds to one free slot within some slab
- * page.
+ * This is computed in constant time from the page count and the number of
+ * live objects. Each free slot sits on the free list of its slab page.
  *
  * @par Relationship to Other Queries
  * - ::slab_total_blocks() returns the total slot capacity.
@@ -8022,7 +8260,7 @@ bool is_slab_ptr(const slab_t *slab, const void *ptr);
  * @p slab so that:
  *
  *  - All pages remain allocated.
- *  - All slots in every page are placed back onto the global free list.
+ *  - All slots in every page are placed back onto that page's free list.
  *  - No objects are considered "in use" (``slab->len == 0``).
  *
  * This is a bulk "clear" operation: it does not release any memory to the
@@ -8039,11 +8277,11 @@ bool is_slab_ptr(const slab_t *slab, const void *ptr);
  *  - The slots region is recomputed as the range
  *    ``[page_base + page_hdr_bytes, page_base + slab_bytes)``.
  *  - This region is carved into chunks of ``slot_size`` bytes.
- *  - Each chunk is pushed onto the slab’s global free list.
+ *  - Each chunk is pushed onto the page's free list.
  *
  * After completion:
  *  - ``slab->len == 0``
- *  - ``slab->free_list`` references all slots across all pages.
+ *  - Every page is empty and available for allocation.
  *
  * @par Error Handling
  * - If @p slab is NULL, returns false.
@@ -8140,7 +8378,10 @@ bool save_slab(const slab_t *slab,
  * - The snapshot is **not portable** across processes, architectures, or
  *   allocator instances; it contains raw pointers.
  * - The snapshot assumes that:
- *   - The same pages are still allocated at the same addresses.
+ *   - The same pages are still allocated at the same addresses.  Because
+ *     ::return_slab() hands empty pages back to the buddy allocator, a
+ *     page freed after the snapshot makes the restore fail (returns false)
+ *     rather than write into memory the slab no longer owns.
  *   - The slab geometry (object size, alignment, page size, etc.) has not
  *     changed between save and restore.
  * - This function is suitable for in-process checkpoint/rollback
@@ -8148,12 +8389,11 @@ bool save_slab(const slab_t *slab,
  *
  * @par Restore Procedure (High-Level)
  *  1. Copy a temporary snapshot header (``slab_t``) from @p buffer.
- *  2. Use the header’s page list (``snap_header.pages``) to count the number
- *     of pages that must be restored.
+ *  2. Use the header’s page count to size the snapshot.
  *  3. Verify that @p buffer contains enough data for the header and all pages.
  *  4. Verify that the current @p slab has the same geometry as the snapshot
  *     (object size, slot size, alignment, slab bytes, header bytes, objects
- *     per slab).
+ *     per slab) and still owns every page in the snapshot's page list.
  *  5. For each page in the snapshot’s page list, copy the saved page contents
  *     into the live page at the same address.
  *  6. Finally, overwrite the live ::slab_t with the snapshot header.
@@ -8608,6 +8848,686 @@ static inline allocator_vtable_t slab_allocator(slab_t *slab) {
     };
     return v;
 }
+// ================================================================================ 
+// ================================================================================ 
+// THREAD CACHE ALLOCATOR 
+
+typedef struct tcache_t tcache_t;
+// -------------------------------------------------------------------------------- 
+
+typedef struct {
+    bool has_value;
+    union {
+        tcache_t* value;
+        error_code_t error;
+    } u;
+} tcache_expect_t;
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Initialize a thread-safe caching front-end over a buddy and/or slab
+ *        allocator.
+ *
+ * ::buddy_t and ::slab_t are not thread-safe.  A ::tcache_t makes them
+ * usable from many threads at once without a lock on every call: each
+ * thread keeps small private stacks ("magazines") of free blocks, one for
+ * slab slots and one for each of the smallest buddy block orders.  The
+ * common allocate / return path only touches the calling thread's
+ * magazines.  When a magazine runs empty it is refilled with up to
+ * @p batch blocks in a single locked visit to the backend, and when it
+ * reaches 2 * @p batch blocks the coldest @p batch are drained back the
+ * same way.
+ *
+ * Routing rules:
+ *
+ * - Requests of at most the slab object size are served from @p slab.
+ * - Other requests are served from @p buddy.  Block orders within the
+ *   cached range go through the magazines; larger blocks and
+ *   over-aligned requests go to the buddy allocator directly under the
+ *   shared lock.
+ *
+ * Either backend may be NULL, but not both.  When both are supplied the
+ * slab must be built on a different ::buddy_t than @p buddy, so a returned
+ * pointer can be attributed to its backend by address range alone.
+ *
+ * The cache does not own the backends.  Once a backend is attached it must
+ * only be reached through the cache until ::free_tcache() is called.
+ * Blocks held in magazines count as allocated from the backend's point of
+ * view; they are handed back when the owning thread exits, when it calls
+ * ::flush_tcache(), or when the cache is destroyed.
+ *
+ * @param buddy  Backing buddy allocator, or NULL for a slab-only cache.
+ * @param slab   Backing slab allocator, or NULL for a buddy-only cache.
+ * @param batch  Blocks moved per refill or drain; 0 selects a default of 32.
+ *
+ * @return ::tcache_expect_t holding the new cache, or INVALID_ARG if both
+ *         backends are NULL or the slab is built on @p buddy, BAD_ALLOC if
+ *         the control structure cannot be allocated, or LOCK_FAILED if the
+ *         mutex or thread key cannot be created.
+ *
+ * @code{.c}
+ * buddy_expect_t bx = init_buddy_allocator(1u << 24, 64u, 0u);
+ * buddy_expect_t sx = init_buddy_allocator(1u << 20, 64u, 0u);
+ * slab_expect_t  sl = init_slab_allocator(sx.u.value, 48u, 0u, 0u);
+ *
+ * tcache_expect_t tx = init_tcache(bx.u.value, sl.u.value, 0u);
+ * allocator_vtable_t alloc = tcache_allocator(tx.u.value);
+ *
+ * // ... share `alloc` between worker threads ...
+ *
+ * free_tcache(tx.u.value);
+ * free_buddy(sx.u.value);
+ * free_buddy(bx.u.value);
+ * @endcode
+ */
+tcache_expect_t init_tcache(buddy_t* buddy, slab_t* slab, size_t batch);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Destroy a thread cache and return every cached block to its backend.
+ *
+ * Magazines belonging to all threads, live or exited, are drained.  The
+ * backends themselves are left intact.  No other thread may use the cache
+ * while or after this function runs.
+ *
+ * @param tc  Cache to destroy.  NULL is a no-op.
+ */
+void free_tcache(tcache_t* tc);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Allocate a block through the calling thread's magazines.
+ *
+ * @param tc      Thread cache.
+ * @param size    Number of user bytes requested (> 0).
+ * @param zeroed  If true, the usable region of the block is zeroed.
+ *
+ * @return ::void_ptr_expect_t holding the pointer, or INVALID_ARG for a NULL
+ *         cache, a zero size or an oversize request on a slab-only cache, or
+ *         the backend's error (typically BAD_ALLOC) when it is exhausted.
+ *
+ * @code{.c}
+ * void_ptr_expect_t r = alloc_tcache(tc, 200u, false);
+ * if (r.has_value) {
+ *     use(r.u.value);
+ *     return_tcache_element(tc, r.u.value);
+ * }
+ * @endcode
+ */
+void_ptr_expect_t alloc_tcache(tcache_t* tc, size_t size, bool zeroed);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Allocate an aligned block through a thread cache.
+ *
+ * Requests whose alignment is already guaranteed by the cached path use the
+ * magazines.  Stricter alignments are served by ::alloc_buddy_aligned()
+ * under the shared lock.
+ *
+ * @param tc      Thread cache.
+ * @param size    Number of user bytes requested (> 0).
+ * @param align   Requested alignment; 0 means alignof(max_align_t) and a
+ *                non power of two is rounded up.
+ * @param zeroed  If true, the usable region of the block is zeroed.
+ *
+ * @return ::void_ptr_expect_t holding the pointer, or ALIGNMENT_ERROR if a
+ *         slab-only cache cannot meet @p align, otherwise as ::alloc_tcache().
+ */
+void_ptr_expect_t alloc_tcache_aligned(tcache_t* tc, size_t size,
+                                       size_t align, bool zeroed);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Resize a block obtained from a thread cache.
+ *
+ * Follows realloc() conventions: a NULL @p old_ptr allocates, a zero
+ * @p new_size returns the block and yields NULL, and a block that already
+ * holds @p new_size bytes is returned unchanged.  Otherwise a new block is
+ * allocated, min(@p old_size, old capacity) bytes are copied and the old
+ * block is returned.  On failure @p old_ptr remains valid.
+ *
+ * @param tc        Thread cache.
+ * @param old_ptr   Block to resize, or NULL.
+ * @param old_size  Logical size of the existing block.
+ * @param new_size  Requested size in bytes.
+ * @param zeroed    If true, bytes past @p old_size are zeroed.
+ *
+ * @return ::void_ptr_expect_t holding the (possibly moved) pointer.
+ */
+void_ptr_expect_t realloc_tcache(tcache_t* tc, void* old_ptr, size_t old_size,
+                                 size_t new_size, bool zeroed);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Resize a block obtained from a thread cache, honouring an alignment.
+ *
+ * As ::realloc_tcache(), except the result also satisfies @p align.
+ *
+ * @param tc        Thread cache.
+ * @param old_ptr   Block to resize, or NULL.
+ * @param old_size  Logical size of the existing block.
+ * @param new_size  Requested size in bytes.
+ * @param align     Requested alignment (see ::alloc_tcache_aligned()).
+ * @param zeroed    If true, bytes past @p old_size are zeroed.
+ *
+ * @return ::void_ptr_expect_t holding the (possibly moved) pointer.
+ */
+void_ptr_expect_t realloc_tcache_aligned(tcache_t* tc, void* old_ptr,
+                                         size_t old_size, size_t new_size,
+                                         size_t align, bool zeroed);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Return a block to the calling thread's magazines.
+ *
+ * A block may be returned by a different thread than the one that
+ * allocated it; it simply joins the returning thread's magazine.  Buddy
+ * blocks are validated with ::is_buddy_ptr() and slab slots with
+ * ::is_slab_ptr() before they are cached, so a foreign pointer is never
+ * handed out again.
+ *
+ * @param tc   Thread cache.
+ * @param ptr  Block to return.  NULL is a successful no-op.
+ *
+ * @return true on success, false if @p tc is NULL or @p ptr is neither a
+ *         buddy block nor a slab slot of this cache.
+ */
+bool return_tcache_element(tcache_t* tc, void* ptr);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Drain every magazine of the calling thread back to the backends.
+ *
+ * Useful before a long idle period, or before inspecting backend usage
+ * with ::buddy_alloc() / ::slab_in_use_blocks().  Threads that exit are
+ * flushed automatically.
+ *
+ * @param tc  Thread cache.
+ * @return true on success, false if @p tc is NULL.
+ */
+bool flush_tcache(tcache_t* tc);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Return the number of blocks moved per refill or drain.
+ *
+ * @param tc  Thread cache.
+ * @return The batch size, or 0 if @p tc is NULL.
+ */
+size_t tcache_batch(const tcache_t* tc);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Write a human-readable summary of a thread cache into a buffer.
+ *
+ * Reports the batch size, the cached buddy orders and slab object size, the
+ * number of registered threads and how many refills and drains have
+ * reached the shared backend.  A low refill count relative to the number
+ * of allocations means the magazines are absorbing the traffic.
+ *
+ * @param tc           Thread cache, may be NULL.
+ * @param buffer       Destination buffer.
+ * @param buffer_size  Size of @p buffer in bytes.
+ *
+ * @return true on success, false if @p buffer is NULL, @p buffer_size is 0
+ *         or the text did not fit.
+ */
+bool tcache_stats(const tcache_t* tc, char* buffer, size_t buffer_size);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Allocate memory from a thread cache via allocator vtable.
+ *
+ * Vtable adapter for ::alloc_tcache().
+ *
+ * @param ctx     Allocator context, expected to be a valid ::tcache_t.
+ * @param size    Number of user bytes requested.
+ * @param zeroed  If true, the returned region is zero-initialized.
+ *
+ * @return A ::void_ptr_expect_t containing the pointer or an error code.
+ */
+static inline void_ptr_expect_t tcache_v_alloc(void* ctx, size_t size, bool zeroed) {
+    tcache_t* tc = (tcache_t*)ctx;
+    if (!tc) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+    return alloc_tcache(tc, size, zeroed);
+}
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Allocate aligned memory from a thread cache via allocator vtable.
+ *
+ * Vtable adapter for ::alloc_tcache_aligned().
+ *
+ * @param ctx     Allocator context (must be a valid ::tcache_t).
+ * @param size    Number of user bytes requested.
+ * @param align   Requested alignment.
+ * @param zeroed  If true, the returned region is zero-initialized.
+ *
+ * @return A ::void_ptr_expect_t containing the pointer or an error code.
+ */
+static inline void_ptr_expect_t tcache_v_alloc_aligned(void* ctx,
+                                                       size_t size,
+                                                       size_t align,
+                                                       bool   zeroed) {
+    tcache_t* tc = (tcache_t*)ctx;
+    if (!tc) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+    return alloc_tcache_aligned(tc, size, align, zeroed);
+}
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Reallocate memory from a thread cache via allocator vtable.
+ *
+ * Vtable adapter for ::realloc_tcache().
+ *
+ * @param ctx       Allocator context (must be a valid ::tcache_t).
+ * @param old_ptr   Pointer previously allocated from this allocator, or NULL.
+ * @param old_size  Logical size of the existing allocation.
+ * @param new_size  Requested new size in bytes.
+ * @param zeroed    If true, any newly added bytes are zero-initialized.
+ *
+ * @return A ::void_ptr_expect_t containing the resized pointer or an error code.
+ */
+static inline void_ptr_expect_t tcache_v_realloc(void* ctx,
+                                                 void*  old_ptr,
+                                                 size_t old_size,
+                                                 size_t new_size,
+                                                 bool   zeroed) {
+    tcache_t* tc = (tcache_t*)ctx;
+    if (!tc) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+    return realloc_tcache(tc, old_ptr, old_size, new_size, zeroed);
+}
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Reallocate aligned memory from a thread cache via allocator vtable.
+ *
+ * Vtable adapter for ::realloc_tcache_aligned().
+ *
+ * @param ctx       Allocator context (must be a valid ::tcache_t).
+ * @param old_ptr   Pointer previously allocated from this allocator, or NULL.
+ * @param old_size  Logical size of the existing allocation.
+ * @param new_size  Requested new size in bytes.
+ * @param zeroed    If true, newly added bytes are zero-initialized.
+ * @param align     Required alignment for the resulting pointer.
+ *
+ * @return A ::void_ptr_expect_t containing the resized pointer or an error code.
+ */
+static inline void_ptr_expect_t tcache_v_realloc_aligned(void* ctx,
+                                                         void*  old_ptr,
+                                                         size_t old_size,
+                                                         size_t new_size,
+                                                         bool   zeroed,
+                                                         size_t align) {
+    tcache_t* tc = (tcache_t*)ctx;
+    if (!tc) {
+        return (void_ptr_expect_t){ .has_value = false, .u.error = INVALID_ARG };
+    }
+    return realloc_tcache_aligned(tc, old_ptr, old_size, new_size, align, zeroed);
+}
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Return a block to a thread cache via allocator vtable.
+ *
+ * Vtable adapter for ::return_tcache_element().  Invalid inputs are a no-op.
+ *
+ * @param ctx  Allocator context (must be a valid ::tcache_t).
+ * @param ptr  Pointer previously returned by this allocator.
+ */
+static inline void tcache_v_return(void* ctx, void* ptr) {
+    tcache_t* tc = (tcache_t*)ctx;
+    if (!tc || !ptr) {
+        return;
+    }
+    (void)return_tcache_element(tc, ptr);
+}
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Destroy a thread cache via allocator vtable.
+ *
+ * Vtable adapter for ::free_tcache().  The backing buddy and slab
+ * allocators are not destroyed.
+ *
+ * @param ctx  Allocator context (must be a valid ::tcache_t).
+ */
+static inline void tcache_v_free(void* ctx) {
+    tcache_t* tc = (tcache_t*)ctx;
+    if (!tc) {
+        return;
+    }
+    free_tcache(tc);
+}
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Create an allocator vtable backed by a thread cache.
+ *
+ * The returned vtable may be shared freely between threads, which makes it
+ * a drop-in replacement for ::buddy_allocator() or ::slab_allocator() in
+ * multithreaded code that uses tensors, strings or dictionaries.
+ *
+ * @param tc  Pointer to an initialized ::tcache_t.
+ *
+ * @return An ::allocator_vtable_t configured to operate on @p tc.
+ */
+static inline allocator_vtable_t tcache_allocator(tcache_t* tc) {
+    allocator_vtable_t v = {
+        .allocate           = tcache_v_alloc,
+        .allocate_aligned   = tcache_v_alloc_aligned,
+        .reallocate         = tcache_v_realloc,
+        .reallocate_aligned = tcache_v_realloc_aligned,
+        .return_element     = tcache_v_return,
+        .deallocate         = tcache_v_free,
+        .ctx                = tc
+    };
+    return v;
+}
+// ================================================================================ 
+// ================================================================================ 
+// TRACING ALLOCATOR 
+
+typedef struct tracer_t tracer_t;
+// -------------------------------------------------------------------------------- 
+
+typedef struct {
+    bool has_value;
+    union {
+        tracer_t* value;
+        error_code_t error;
+    } u;
+} tracer_expect_t;
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Number of power-of-two request size classes kept by a ::tracer_t.
+ *
+ * Class 0 counts requests of at most 1 byte and class k counts requests of
+ * 2^(k-1) + 1 to 2^k bytes.  Anything larger than 2^62 bytes lands in the
+ * last class.
+ */
+#define TRACER_SIZE_CLASSES 64u
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Kind of vtable call recorded in a ::trace_sample_t.
+ */
+typedef enum {
+    TRACE_ALLOC   = 0,  /**< allocate or allocate_aligned          */
+    TRACE_REALLOC = 1,  /**< reallocate or reallocate_aligned      */
+    TRACE_FREE    = 2   /**< return_element                        */
+} trace_op_t;
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief One sampled vtable call.
+ *
+ * All fields are fixed width so an array of samples can be written to disk
+ * as-is; see ::tracer_write_binary().  Threads are sampled independently,
+ * one call in sample_every of each, and seq is the tracer-wide event count
+ * when the sample was taken, so it is exact only for a single thread.
+ */
+typedef struct {
+    uint64_t seq;      /**< Event number, counting every traced call      */
+    uint64_t time_ns;  /**< CLOCK_MONOTONIC time of the call              */
+    uint64_t size;     /**< Requested bytes; new size for a realloc       */
+    uint64_t ptr;      /**< Resulting pointer, or the pointer freed       */
+    uint64_t site;     /**< Return address of the vtable call, or 0       */
+    uint32_t op;       /**< A ::trace_op_t value                          */
+    uint32_t ok;       /**< 1 if the call succeeded, 0 if it failed       */
+} trace_sample_t;
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Counters accumulated by a ::tracer_t.
+ *
+ * Byte counts are the sizes requested by the caller; the small header the
+ * tracer adds in front of every block is not included.
+ *
+ * peak_live_bytes is exact while a single thread uses the tracer.  With
+ * several threads the counters live in per-thread shards, and the peak is
+ * the highest total seen at a sampled call or a ::tracer_summary(), so
+ * enable sampling when the multi-threaded peak matters.
+ */
+typedef struct {
+    size_t events;            /**< Every traced call, failed or not           */
+    size_t allocs;            /**< Successful allocate / allocate_aligned     */
+    size_t reallocs;          /**< Successful reallocate calls                */
+    size_t frees;             /**< return_element calls with a non-NULL block */
+    size_t failures;          /**< Calls the inner allocator rejected         */
+    size_t bytes_allocated;   /**< Bytes requested by allocs and reallocs     */
+    size_t bytes_freed;       /**< Bytes released by frees and reallocs       */
+    size_t live_bytes;        /**< Bytes currently held by the caller         */
+    size_t peak_live_bytes;   /**< High-water mark of live_bytes, see below   */
+    size_t samples;           /**< Samples taken, including overwritten ones  */
+    size_t size_classes[TRACER_SIZE_CLASSES]; /**< Allocation request sizes   */
+} tracer_summary_t;
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Wrap an allocator so every call through it is counted and profiled.
+ *
+ * The tracer forwards each vtable call to @p inner and records call counts,
+ * a histogram of request sizes, the live-byte high-water mark and,
+ * optionally, one sampled call in every @p sample_every.  A sample holds the
+ * call's return address, so tools such as addr2line can attribute memory
+ * to the code that requested it.
+ *
+ * The common path costs a handful of relaxed atomic updates on counters
+ * kept per thread, each shard on its own cache line, so a tracer can be
+ * left in place in production builds and shared between threads as long
+ * as @p inner is itself thread-safe.  ::tracer_summary() adds the shards
+ * up.  Only sampled calls read the clock, take the tracer's lock and look
+ * at the other threads' shards.
+ *
+ * To know the size of a block when it is returned, the tracer stores a
+ * 16-byte header in front of it (more for over-aligned requests).  Blocks
+ * obtained through the tracer must therefore only be resized or returned
+ * through the tracer, never passed to @p inner directly.
+ *
+ * The header makes every request larger than the caller's and needs @p inner
+ * to honor the requested alignment, so fixed-block allocators such as
+ * ::pool_allocator() and ::slab_allocator() must be wrapped with
+ * ::init_tracer_with_size_table() instead.  A block that @p inner returns
+ * misaligned is handed back to it and the call fails with ALIGNMENT_ERROR.
+ *
+ * The tracer does not own @p inner; destroying the tracer leaves it intact.
+ *
+ * @param inner            Allocator to forward to.  Every function pointer
+ *                         must be set.
+ * @param sample_every     Record one call in this many; 0 disables sampling
+ *                         and 1 records every call.
+ * @param sample_capacity  Samples retained in the ring buffer before the
+ *                         oldest are overwritten; 0 selects 1024.  Ignored
+ *                         when sampling is disabled.
+ *
+ * @return ::tracer_expect_t holding the new tracer, or INVALID_ARG if a
+ *         function pointer of @p inner is NULL, BAD_ALLOC if the tracer
+ *         cannot be allocated, or LOCK_FAILED if its mutex cannot be created.
+ *
+ * @code{.c}
+ * tracer_expect_t tx = init_tracer(heap_allocator(), 64u, 0u);
+ * allocator_vtable_t alloc = tracer_allocator(tx.u.value);
+ *
+ * float_tensor_expect_t f = init_float_array(1000u, true, alloc);
+ * // ...
+ * return_float_tensor(f.u.value);
+ *
+ * tracer_summary_t s;
+ * tracer_summary(tx.u.value, &s);
+ * printf("peak %zu bytes over %zu allocations\n", s.peak_live_bytes, s.allocs);
+ * free_tracer(tx.u.value);
+ * @endcode
+ */
+tracer_expect_t init_tracer(allocator_vtable_t inner,
+                            size_t sample_every,
+                            size_t sample_capacity);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Wrap a fixed-block allocator in a tracer that keeps no headers.
+ *
+ * Behaves as ::init_tracer(), except that block sizes are kept in a side
+ * table keyed by pointer instead of a header in front of each block.  Every
+ * call is forwarded to @p inner with the caller's exact size and alignment,
+ * so a pool or slab whose blocks hold N bytes still serves N-byte requests,
+ * and the alignment of the result is whatever @p inner provides.
+ *
+ * The table is split into lock-striped shards, so every call takes one
+ * short, usually uncontended lock; prefer ::init_tracer() for allocators
+ * that accept arbitrary sizes.  Returning a pointer the tracer did not hand
+ * out forwards it to @p inner unchanged and counts it as a failure.
+ *
+ * @param inner            Allocator to forward to.  Every function pointer
+ *                         must be set.
+ * @param sample_every     As for ::init_tracer().
+ * @param sample_capacity  As for ::init_tracer().
+ *
+ * @return ::tracer_expect_t holding the new tracer, or the errors listed for
+ *         ::init_tracer().
+ *
+ * @code{.c}
+ * pool_expect_t px = init_dynamic_pool(64u, 16u, 256u, 16384u, 16384u, true, false);
+ * tracer_expect_t tx = init_tracer_with_size_table(pool_allocator(px.u.value),
+ *                                                  0u, 0u);
+ * allocator_vtable_t alloc = tracer_allocator(tx.u.value);
+ * void_ptr_expect_t b = alloc.allocate(alloc.ctx, 64u, false);  // one full block
+ * @endcode
+ */
+tracer_expect_t init_tracer_with_size_table(allocator_vtable_t inner,
+                                            size_t sample_every,
+                                            size_t sample_capacity);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Destroy a tracer.
+ *
+ * The wrapped allocator and any blocks still allocated from it are left
+ * untouched.
+ *
+ * @param tr  Tracer to destroy.  NULL is a no-op.
+ */
+void free_tracer(tracer_t* tr);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Create an allocator vtable that records every call into a tracer.
+ *
+ * The adapters behind the returned vtable are defined out of line so that
+ * the return address stored in a sample is the caller's.  Calling
+ * `deallocate` destroys the tracer only, as ::free_tracer() does.
+ *
+ * A NULL block passed to `return_element` is ignored and is not counted.
+ * `reallocate` follows realloc() conventions: a NULL block allocates and a
+ * new size of 0 returns the block and yields NULL.
+ *
+ * @param tr  Pointer to an initialized ::tracer_t.
+ *
+ * @return An ::allocator_vtable_t configured to operate on @p tr.
+ */
+allocator_vtable_t tracer_allocator(tracer_t* tr);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Copy the tracer's counters into @p out.
+ *
+ * Each counter is the sum of the per-thread shards, read individually, so
+ * a summary taken while other threads are allocating is approximate but
+ * never torn within a single shard.  Taking a summary also folds the
+ * current live total into peak_live_bytes.
+ *
+ * @param tr   Tracer to read.
+ * @param out  Destination summary.
+ *
+ * @return true on success, false if either argument is NULL.
+ */
+bool tracer_summary(const tracer_t* tr, tracer_summary_t* out);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Copy the retained samples, oldest first.
+ *
+ * @param tr   Tracer to read.
+ * @param out  Destination array, may be NULL when @p cap is 0.
+ * @param cap  Capacity of @p out in samples.
+ *
+ * @return The number of samples written to @p out, at most @p cap, or the
+ *         number retained if @p out is NULL.  Returns 0 if @p tr is NULL.
+ */
+size_t tracer_samples(const tracer_t* tr, trace_sample_t* out, size_t cap);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Clear all counters and samples.
+ *
+ * Blocks that are still live remain accounted for: live_bytes is kept and
+ * peak_live_bytes restarts from it, so later frees never drive the count
+ * negative.
+ *
+ * @param tr  Tracer to reset.
+ * @return true on success, false if @p tr is NULL.
+ */
+bool reset_tracer(tracer_t* tr);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Write the retained samples as CSV.
+ *
+ * The first line is the header `seq,time_ns,op,size,ptr,site,ok`.  The op
+ * column holds `alloc`, `realloc` or `free`, and ptr and site are written
+ * in hexadecimal.
+ *
+ * @param tr      Tracer to dump.
+ * @param stream  Open output stream.
+ *
+ * @return NO_ERROR on success, NULL_POINTER if an argument is NULL, or
+ *         FILE_WRITE if the stream reports an error.
+ */
+error_code_t tracer_write_csv(const tracer_t* tr, FILE* stream);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Write the counters and retained samples in a compact binary form.
+ *
+ * The layout, in host byte order, is:
+ *
+ * - 8 bytes: the magic string `CSALTTRC`
+ * - uint32_t format version (1) and uint32_t `sizeof(trace_sample_t)`
+ * - uint64_t sample_every, then the ::tracer_summary_t fields as uint64_t
+ *   in declaration order (10 counters, then ::TRACER_SIZE_CLASSES classes)
+ * - uint64_t sample count, then that many ::trace_sample_t records
+ *
+ * @param tr      Tracer to dump.
+ * @param stream  Open output stream, opened in binary mode.
+ *
+ * @return NO_ERROR on success, NULL_POINTER if an argument is NULL,
+ *         BAD_ALLOC if the sample snapshot cannot be allocated, or
+ *         FILE_WRITE if the stream reports an error.
+ */
+error_code_t tracer_write_binary(const tracer_t* tr, FILE* stream);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Write a human-readable summary of a tracer into a buffer.
+ *
+ * Reports the call counts, byte totals, live and peak bytes, the sampling
+ * rate and every non-empty size class.
+ *
+ * @param tr           Tracer, may be NULL.
+ * @param buffer       Destination buffer.
+ * @param buffer_size  Size of @p buffer in bytes.
+ *
+ * @return true on success, false if @p buffer is NULL, @p buffer_size is 0
+ *         or the text did not fit.
+ */
+bool tracer_stats(const tracer_t* tr, char* buffer, size_t buffer_size);
 #endif /* ARENA_ENABLE_DYNAMIC */
 // ================================================================================ 
 // ================================================================================ 
@@ -609,6 +609,70 @@ static inline error_code_t sort_float_tensor(float_tensor_t* t,
 }
 // -------------------------------------------------------------------------------- 
 
+/**
+ * @brief Sort a float tensor in place using several threads.
+ *
+ * Stable multi-threaded merge sort over the same elements as
+ * sort_float_tensor.  See parallel_sort_tensor for the algorithm, the
+ * thread count limits and the scratch buffer, which holds
+ * len * sizeof(element) bytes for the duration of the call.
+ *
+ * @param t            Pointer to the target tensor. Must not be NULL.
+ * @param dir          FORWARD for ascending order, REVERSE for descending order.
+ * @param num_threads  Maximum number of threads; 0 uses every online core.
+ * @param scratch      Allocator for the temporary buffer.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if t is NULL or scratch is incomplete
+ *         - EMPTY         if t->base->len < 2
+ *         - OUT_OF_MEMORY if the scratch buffer cannot be allocated
+ *
+ * @code
+ * error_code_t err = parallel_sort_float_tensor(arr, FORWARD, 0u, heap_allocator());
+ * @endcode
+ */
+static inline error_code_t parallel_sort_float_tensor(float_tensor_t* t,
+                                                      direction_t dir,
+                                                      size_t num_threads,
+                                                      allocator_vtable_t scratch) {
+    if (t == NULL) return NULL_POINTER;
+    return parallel_sort_tensor(t->base, float_cmp, dir, num_threads, scratch);
+}
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Sort a float tensor in place with an LSD radix sort.
+ *
+ * Comparator-free, stable sort over the same elements as
+ * sort_float_tensor.  See radix_sort_tensor for the key mapping and the
+ * scratch buffer, which must hold len * sizeof(float) bytes.
+ *
+ * @param t              Pointer to the target tensor. Must not be NULL.
+ * @param dir            FORWARD for ascending order, REVERSE for descending order.
+ * @param scratch        Caller-owned buffer, or NULL to borrow one from the
+ *                       tensor's allocator.
+ * @param scratch_bytes  Size of scratch in bytes.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER    if t is NULL
+ *         - EMPTY           if t->base->len < 2
+ *         - SIZE_MISMATCH   if scratch is too small
+ *         - ALIGNMENT_ERROR if scratch is misaligned for float
+ *         - OUT_OF_MEMORY   if scratch is NULL and no buffer can be allocated
+ *
+ * @code
+ * error_code_t err = radix_sort_float_tensor(arr, FORWARD, NULL, 0u);
+ * @endcode
+ */
+static inline error_code_t radix_sort_float_tensor(float_tensor_t* t,
+                                                   direction_t dir,
+                                                   void* scratch,
+                                                   size_t scratch_bytes) {
+    if (t == NULL) return NULL_POINTER;
+    return radix_sort_tensor(t->base, dir, scratch, scratch_bytes);
+}
+// -------------------------------------------------------------------------------- 
+
 /**
  * @brief Search a float tensor for the first element within tolerance
  *        of a target value.
@@ -1134,6 +1198,77 @@ static inline error_code_t pop_at_float_array(float_tensor_t* t,
     if (t == NULL) return NULL_POINTER;
     return pop_at_tensor(t->base, out, index, FLOAT_TYPE);
 }
+
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Append count values from a buffer to a dynamic 1-D array.
+ *
+ * Grows the buffer at most once and copies the run in one shot. When
+ * the array cannot grow only the values that fit are taken. Returns the
+ * number of values appended, or NULL_POINTER, CAPACITY_OVERFLOW,
+ * LENGTH_OVERFLOW or OUT_OF_MEMORY on failure.
+ *
+ * @code{.c}
+ * // arr = [1, 2]
+ * float vals[3] = { 3, 4, 5 };
+ * size_expect_t r = push_back_n_float_array(arr, vals, 3u);
+ * // r.u.value == 3, arr = [1, 2, 3, 4, 5]
+ * @endcode
+ */
+static inline size_expect_t push_back_n_float_array(float_tensor_t* t,
+                                                    const float* data,
+                                                    size_t count) {
+    if (t == NULL)
+        return (size_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    return push_back_n_tensor(t->base, data, count, FLOAT_TYPE);
+}
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Insert count values from a buffer at index in a dynamic 1-D array.
+ *
+ * Shifts the tail once and copies the run into the gap. data must not
+ * overlap the array. Returns the number of values inserted, or
+ * NULL_POINTER, OUT_OF_BOUNDS if index > len, INVALID_ARG on overlap,
+ * CAPACITY_OVERFLOW or OUT_OF_MEMORY on failure.
+ *
+ * @code{.c}
+ * // arr = [1, 5]
+ * float vals[3] = { 2, 3, 4 };
+ * push_at_n_float_array(arr, vals, 3u, 1u);   // arr = [1, 2, 3, 4, 5]
+ * @endcode
+ */
+static inline size_expect_t push_at_n_float_array(float_tensor_t* t,
+                                                  const float* data,
+                                                  size_t count,
+                                                  size_t index) {
+    if (t == NULL)
+        return (size_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    return push_at_n_tensor(t->base, data, count, index, FLOAT_TYPE);
+}
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Remove up to count values from the back of a dynamic 1-D array.
+ *
+ * Copies the removed values into out (if non-NULL) in their original
+ * order. Returns the number removed, or NULL_POINTER, or EMPTY if the
+ * array has no elements.
+ *
+ * @code{.c}
+ * // arr = [1, 2, 3, 4, 5]
+ * float tail[2];
+ * pop_back_n_float_array(arr, tail, 2u);   // tail = [4, 5], arr = [1, 2, 3]
+ * @endcode
+ */
+static inline size_expect_t pop_back_n_float_array(float_tensor_t* t,
+                                                   float* out,
+                                                   size_t count) {
+    if (t == NULL)
+        return (size_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    return pop_back_n_tensor(t->base, out, count, FLOAT_TYPE);
+}
 // ================================================================================ 
 // ================================================================================ 
 // RETRIEVE DATA
@@ -1182,6 +1317,405 @@ static inline error_code_t get_float_tensor_nd_index(const float_tensor_t* t,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+/**
+ * @brief Elementwise sum, out[i] = a[i] + b[i].
+ *
+ * Runs on the active SIMD tier (see c_simd.h) with unaligned loads and a
+ * scalar tail, so any length and alignment is accepted.  out may be a or b
+ * to update in place; otherwise its buffer must not overlap either operand.
+ * An ARRAY_STRUCT out is resized to a's length, growing first if it is
+ * dynamic (see prepare_elementwise_tensor).
+ *
+ * @param out  Destination tensor. Must not be NULL.
+ * @param a    Left operand. Must not be NULL.
+ * @param b    Right operand with the same length as a. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if out, a or b is NULL
+ *         - EMPTY         if a holds no elements
+ *         - SIZE_MISMATCH if the lengths of a, b and out are incompatible
+ *         - INVALID_ARG   if out partially overlaps a or b
+ *
+ * @code{.c}
+ * // acc += x, in place
+ * error_code_t err = add_float_tensor(acc, acc, x);
+ * @endcode
+ */
+error_code_t add_float_tensor(float_tensor_t*       out,
+                              const float_tensor_t* a,
+                              const float_tensor_t* b);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Elementwise difference, out[i] = a[i] - b[i].
+ *
+ * Same operand, aliasing and error rules as add_float_tensor.
+ */
+error_code_t sub_float_tensor(float_tensor_t*       out,
+                              const float_tensor_t* a,
+                              const float_tensor_t* b);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Elementwise product, out[i] = a[i] * b[i].
+ *
+ * Same operand, aliasing and error rules as add_float_tensor.
+ */
+error_code_t mul_float_tensor(float_tensor_t*       out,
+                              const float_tensor_t* a,
+                              const float_tensor_t* b);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Elementwise quotient, out[i] = a[i] / b[i].
+ *
+ * Same operand, aliasing and error rules as add_float_tensor.  Division by
+ * zero follows IEEE 754 (+-inf or NaN) and is not reported as an error.
+ */
+error_code_t div_float_tensor(float_tensor_t*       out,
+                              const float_tensor_t* a,
+                              const float_tensor_t* b);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Scale and shift every element, out[i] = a[i] * mul + add.
+ *
+ * The multiply and add are separate operations on every tier, so results
+ * do not depend on which tier is active.  out may be a.
+ *
+ * @param out  Destination tensor. Must not be NULL.
+ * @param a    Source tensor. Must not be NULL.
+ * @param mul  Factor applied to each element.
+ * @param add  Offset added after scaling.
+ *
+ * @return NO_ERROR on success, or an error from add_float_tensor's list.
+ *
+ * @code{.c}
+ * // Normalise to zero mean and unit scale
+ * error_code_t err = muladd_float_tensor(x, x, 1 / sigma, -mean / sigma);
+ * @endcode
+ */
+error_code_t muladd_float_tensor(float_tensor_t*       out,
+                                 const float_tensor_t* a,
+                                 float                 mul,
+                                 float                 add);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Limit every element to [lo, hi].
+ *
+ * out[i] = min(max(a[i], lo), hi).  out may be a. NaN elements are passed
+ * through unchanged.
+ *
+ * @param out  Destination tensor. Must not be NULL.
+ * @param a    Source tensor. Must not be NULL.
+ * @param lo   Lower bound.
+ * @param hi   Upper bound. Must be >= lo.
+ *
+ * @return NO_ERROR on success, INVALID_ARG if lo > hi or either bound is
+ *         NaN, or an error from add_float_tensor's list.
+ */
+error_code_t clamp_float_tensor(float_tensor_t*       out,
+                                const float_tensor_t* a,
+                                float                 lo,
+                                float                 hi);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Absolute value, out[i] = |a[i]|.
+ *
+ * Clears the sign bit, so -0.0 becomes +0.0 and NaN keeps its payload.
+ * out may be a.
+ *
+ * @return NO_ERROR on success, or an error from add_float_tensor's list.
+ */
+error_code_t abs_float_tensor(float_tensor_t*       out,
+                              const float_tensor_t* a);
+// ================================================================================ 
+// ================================================================================ 
+// REDUCTIONS
+
+/**
+ * @brief Find the maximum value in the tensor.
+ *
+ * The mirror of min_float_tensor: any NaN makes the result NaN, +INFINITY is
+ * an ordinary (largest) value and either signed zero may be returned.
+ *
+ * @param t      Source tensor. Must not be NULL.
+ * @param value  Receives the maximum. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if t, t->base or value is NULL
+ *         - EMPTY         if the tensor holds no elements
+ */
+error_code_t max_float_tensor(const float_tensor_t* t,
+                              float*                value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Flat index of the first occurrence of the minimum value.
+ *
+ * The extremum is found with the SIMD min/max kernel, then a second
+ * scan stops at its first occurrence. NaN counts as the extremum, as it does for
+ * min_float_tensor, so a NaN result yields the index of the first NaN.
+ *
+ * @param t      Source tensor. Must not be NULL.
+ * @param index  Receives the index into t's flat buffer. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if t, t->base or index is NULL
+ *         - EMPTY         if the tensor holds no elements
+ */
+error_code_t argmin_float_tensor(const float_tensor_t* t,
+                                 size_t*               index);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Flat index of the first occurrence of the maximum value.
+ *
+ * Same rules as argmin_float_tensor.
+ */
+error_code_t argmax_float_tensor(const float_tensor_t* t,
+                                 size_t*               index);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Sum every element of the tensor.
+ *
+ * Elements are summed pairwise: blocks of FLOAT_REDUCE_BLOCK elements go to
+ * the active SIMD kernel and block sums are combined as a balanced tree, so
+ * rounding error grows with log(n) rather than n.  The result may differ
+ * in the last bits between SIMD tiers, which group lanes differently.
+ *
+ * NaN and infinities propagate as in IEEE 754 addition.
+ *
+ * Works on both TENSOR_STRUCT and ARRAY_STRUCT modes and covers exactly
+ * t->base->len elements.
+ *
+ * @param t      Source tensor. Must not be NULL.
+ * @param value  Receives the sum. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if t, t->base or value is NULL
+ *         - EMPTY         if the tensor holds no elements
+ *
+ * @code{.c}
+ * float total;
+ * if (sum_float_tensor(prices, &total) == NO_ERROR) ...
+ * @endcode
+ */
+error_code_t sum_float_tensor(const float_tensor_t* t,
+                              float*                value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Arithmetic mean of every element, sum_float_tensor divided by the element count.
+ *
+ * @return NO_ERROR on success, NULL_POINTER or EMPTY as for sum_float_tensor.
+ */
+error_code_t mean_float_tensor(const float_tensor_t* t,
+                               float*                value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief L1 norm, the sum of |t[i]|.
+ *
+ * Summed pairwise like sum_float_tensor.
+ *
+ * @return NO_ERROR on success, NULL_POINTER or EMPTY as for sum_float_tensor.
+ */
+error_code_t l1_norm_float_tensor(const float_tensor_t* t,
+                                  float*                value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Euclidean (L2) norm, sqrt(sum of t[i]^2).
+ *
+ * Computed as sqrt(dot(t, t)) with no rescaling, so it overflows to
+ * +INFINITY once the squares exceed the range of the type.
+ *
+ * @return NO_ERROR on success, NULL_POINTER or EMPTY as for sum_float_tensor.
+ */
+error_code_t l2_norm_float_tensor(const float_tensor_t* t,
+                                  float*                value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Dot product, the sum of a[i] * b[i].
+ *
+ * Each block of products is formed and summed by the active SIMD kernel;
+ * block results are combined pairwise as in sum_float_tensor.
+ *
+ * @param a      First operand. Must not be NULL.
+ * @param b      Second operand with the same length as a. Must not be NULL.
+ * @param value  Receives the result. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if a, b, their bases or value is NULL
+ *         - EMPTY         if a holds no elements
+ *         - SIZE_MISMATCH if a and b differ in length
+ */
+error_code_t dot_float_tensor(const float_tensor_t* a,
+                              const float_tensor_t* b,
+                              float*                value);
+// ================================================================================ 
+// ================================================================================ 
+// AXIS REDUCTIONS
+
+/**
+ * @brief Reduce along one axis into a new float_tensor_t.
+ *
+ * Thin wrapper over reduce_tensor_axis.  The result drops the reduced axis
+ * from the shape of t; a 1-D input, or an array, yields shape {1}.
+ * Along the last axis each row is reduced by the SIMD kernels, with
+ * pairwise sums; any other axis is folded one cache-sized strip at a
+ * time with SIMD elementwise kernels.  min and max propagate NaN.
+ *
+ * @param t        Tensor to reduce. Must not be NULL.
+ * @param axis     Axis to reduce, 0 <= axis < ndim.
+ * @param op       REDUCE_SUM, REDUCE_MIN, REDUCE_MAX or REDUCE_MEAN.
+ * @param alloc_v  Allocator for the result. If alloc_v.allocate is NULL
+ *                 the allocator of t is used.
+ *
+ * @return float_tensor_expect_t holding the result, or an error:
+ *         NULL_POINTER if t is NULL, BAD_ALLOC if the wrapper cannot be
+ *         allocated, or any error reported by reduce_tensor_axis.
+ *
+ * @code
+ * // Row means of a 3 x 4 matrix: shape {3, 4} -> {3}
+ * float_tensor_expect_t r = reduce_float_tensor_axis(m, 1u, REDUCE_MEAN,
+ *                                                    (allocator_vtable_t){ 0 });
+ * @endcode
+ */
+float_tensor_expect_t reduce_float_tensor_axis(const float_tensor_t* t,
+                                               uint8_t               axis,
+                                               reduce_op_t           op,
+                                               allocator_vtable_t    alloc_v);
+// ================================================================================ 
+// ================================================================================ 
+// PREFIX SUMS
+
+/**
+ * @brief Inclusive or exclusive prefix sums of a, written to out.
+ *
+ * Thin wrapper over cumulative_sum_tensor, which scans blocks of the flat
+ * element sequence on up to num_threads threads.  Floating sums are
+ * reassociated by the SIMD and block structure and may differ from a serial
+ * scan in the last bits.  out may be a for an in-place scan.
+ *
+ * @param out          Destination tensor. Must not be NULL.
+ * @param a            Source tensor. Must not be NULL.
+ * @param mode         SCAN_INCLUSIVE or SCAN_EXCLUSIVE.
+ * @param num_threads  Maximum number of threads; 0 uses every online core.
+ *
+ * @return NO_ERROR on success, NULL_POINTER if out or a is NULL, or any
+ *         error reported by cumulative_sum_tensor.
+ *
+ * @code
+ * // Running total, in place, on every core
+ * error_code_t err = cumulative_sum_float_tensor(x, x, SCAN_INCLUSIVE, 0u);
+ * @endcode
+ */
+static inline error_code_t cumulative_sum_float_tensor(float_tensor_t*       out,
+                                                       const float_tensor_t* a,
+                                                       scan_mode_t           mode,
+                                                       size_t                num_threads) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    return cumulative_sum_tensor(out->base, a->base, mode, num_threads);
+}
+// ================================================================================ 
+// ================================================================================ 
+// BROADCASTING
+
+/**
+ * @brief Apply a binary operation to two tensors of broadcast-compatible
+ *        shapes.
+ *
+ * Thin wrapper over broadcast_tensor.  Axes of extent 1 in a or b are read
+ * through a zero stride instead of being expanded, and each inner row runs
+ * a contiguous kernel.  out must have the broadcast shape (see
+ * broadcast_tensor_shape) and may be a or b when that operand already has
+ * it.
+ *
+ * IEEE arithmetic throughout; min and max propagate NaN.
+ *
+ * @param out  Destination tensor. Must not be NULL.
+ * @param a    Left operand. Must not be NULL.
+ * @param b    Right operand. Must not be NULL.
+ * @param op   BINARY_ADD, BINARY_SUB, BINARY_MUL, BINARY_DIV, BINARY_MIN
+ *             or BINARY_MAX.
+ *
+ * @return NO_ERROR on success, NULL_POINTER if out, a or b is NULL, or any
+ *         error reported by broadcast_tensor.
+ *
+ * @code
+ * // Outer product of an {N, 1} column and a {1, M} row
+ * error_code_t err = broadcast_float_tensor(outer, col, row, BINARY_MUL);
+ * @endcode
+ */
+static inline error_code_t broadcast_float_tensor(float_tensor_t*       out,
+                                                  const float_tensor_t* a,
+                                                  const float_tensor_t* b,
+                                                  binary_op_t           op) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    return broadcast_tensor(out->base, a->base, b->base, op);
+}
+// ================================================================================ 
+// ================================================================================ 
+// FILE STORAGE
+
+/**
+ * @brief Write a tensor to a file that map_float_tensor_file can load
+ *        in place.
+ *
+ * Thin wrapper over write_tensor_file; the element buffer is streamed
+ * straight from the tensor after a small header.
+ *
+ * @param t          Tensor to write. Must not be NULL.
+ * @param path       Destination file name. Must not be NULL.
+ * @param alignment  Data alignment within the file; 0 selects
+ *                   TENSOR_FILE_ALIGNMENT.
+ *
+ * @return NO_ERROR on success, NULL_POINTER if t is NULL, or any error
+ *         reported by write_tensor_file.
+ */
+static inline error_code_t write_float_tensor_file(const float_tensor_t* t,
+                                                   const char*           path,
+                                                   size_t                alignment) {
+    if (t == NULL) return NULL_POINTER;
+    return write_tensor_file(t->base, path, alignment);
+}
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Map a tensor file into memory without copying its data.
+ *
+ * Thin wrapper over map_tensor_file.  The returned tensor points into a
+ * copy-on-write mapping, so writes never reach the file; return_float_tensor
+ * unmaps it.
+ *
+ * @param path     File written by write_float_tensor_file. Must not be NULL.
+ * @param alloc_v  Allocator for the tensor header and wrapper.
+ *
+ * @return float_tensor_expect_t with has_value true on success.  On failure,
+ *         has_value is false and u.error is TYPE_MISMATCH if the file holds
+ *         another dtype, BAD_ALLOC if the wrapper cannot be allocated, or
+ *         any error reported by map_tensor_file.
+ *
+ * @code
+ * float_tensor_expect_t r = map_float_tensor_file("samples.tns", heap_allocator());
+ * if (r.has_value) {
+ *     // ...
+ *     return_float_tensor(r.u.value);
+ * }
+ * @endcode
+ */
+float_tensor_expect_t map_float_tensor_file(const char*        path,
+                                            allocator_vtable_t alloc_v);
+// ================================================================================ 
+// ================================================================================ 
 #ifdef __cplusplus
 }
 #endif /* cplusplus */
@@ -610,6 +610,70 @@ static inline error_code_t sort_int32_tensor(int32_tensor_t* t,
 }
 // -------------------------------------------------------------------------------- 
 
+/**
+ * @brief Sort a int32 tensor in place using several threads.
+ *
+ * Stable multi-threaded merge sort over the same elements as
+ * sort_int32_tensor.  See parallel_sort_tensor for the algorithm, the
+ * thread count limits and the scratch buffer, which holds
+ * len * sizeof(element) bytes for the duration of the call.
+ *
+ * @param t            Pointer to the target tensor. Must not be NULL.
+ * @param dir          FORWARD for ascending order, REVERSE for descending order.
+ * @param num_threads  Maximum number of threads; 0 uses every online core.
+ * @param scratch      Allocator for the temporary buffer.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if t is NULL or scratch is incomplete
+ *         - EMPTY         if t->base->len < 2
+ *         - OUT_OF_MEMORY if the scratch buffer cannot be allocated
+ *
+ * @code
+ * error_code_t err = parallel_sort_int32_tensor(arr, FORWARD, 0u, heap_allocator());
+ * @endcode
+ */
+static inline error_code_t parallel_sort_int32_tensor(int32_tensor_t* t,
+                                                      direction_t dir,
+                                                      size_t num_threads,
+                                                      allocator_vtable_t scratch) {
+    if (t == NULL) return NULL_POINTER;
+    return parallel_sort_tensor(t->base, int32_cmp, dir, num_threads, scratch);
+}
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Sort a int32 tensor in place with an LSD radix sort.
+ *
+ * Comparator-free, stable sort over the same elements as
+ * sort_int32_tensor.  See radix_sort_tensor for the key mapping and the
+ * scratch buffer, which must hold len * sizeof(int32_t) bytes.
+ *
+ * @param t              Pointer to the target tensor. Must not be NULL.
+ * @param dir            FORWARD for ascending order, REVERSE for descending order.
+ * @param scratch        Caller-owned buffer, or NULL to borrow one from the
+ *                       tensor's allocator.
+ * @param scratch_bytes  Size of scratch in bytes.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER    if t is NULL
+ *         - EMPTY           if t->base->len < 2
+ *         - SIZE_MISMATCH   if scratch is too small
+ *         - ALIGNMENT_ERROR if scratch is misaligned for int32_t
+ *         - OUT_OF_MEMORY   if scratch is NULL and no buffer can be allocated
+ *
+ * @code
+ * error_code_t err = radix_sort_int32_tensor(arr, FORWARD, NULL, 0u);
+ * @endcode
+ */
+static inline error_code_t radix_sort_int32_tensor(int32_tensor_t* t,
+                                                   direction_t dir,
+                                                   void* scratch,
+                                                   size_t scratch_bytes) {
+    if (t == NULL) return NULL_POINTER;
+    return radix_sort_tensor(t->base, dir, scratch, scratch_bytes);
+}
+// -------------------------------------------------------------------------------- 
+
 /**
  * @brief Search a int32_t tensor for the first occurrence of a value.
  *
@@ -1072,6 +1136,77 @@ static inline error_code_t pop_at_int32_array(int32_tensor_t* t,
     if (t == NULL) return NULL_POINTER;
     return pop_at_tensor(t->base, out, index, INT32_TYPE);
 }
+
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Append count values from a buffer to a dynamic 1-D array.
+ *
+ * Grows the buffer at most once and copies the run in one shot. When
+ * the array cannot grow only the values that fit are taken. Returns the
+ * number of values appended, or NULL_POINTER, CAPACITY_OVERFLOW,
+ * LENGTH_OVERFLOW or OUT_OF_MEMORY on failure.
+ *
+ * @code{.c}
+ * // arr = [1, 2]
+ * int32_t vals[3] = { 3, 4, 5 };
+ * size_expect_t r = push_back_n_int32_array(arr, vals, 3u);
+ * // r.u.value == 3, arr = [1, 2, 3, 4, 5]
+ * @endcode
+ */
+static inline size_expect_t push_back_n_int32_array(int32_tensor_t* t,
+                                                    const int32_t* data,
+                                                    size_t count) {
+    if (t == NULL)
+        return (size_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    return push_back_n_tensor(t->base, data, count, INT32_TYPE);
+}
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Insert count values from a buffer at index in a dynamic 1-D array.
+ *
+ * Shifts the tail once and copies the run into the gap. data must not
+ * overlap the array. Returns the number of values inserted, or
+ * NULL_POINTER, OUT_OF_BOUNDS if index > len, INVALID_ARG on overlap,
+ * CAPACITY_OVERFLOW or OUT_OF_MEMORY on failure.
+ *
+ * @code{.c}
+ * // arr = [1, 5]
+ * int32_t vals[3] = { 2, 3, 4 };
+ * push_at_n_int32_array(arr, vals, 3u, 1u);   // arr = [1, 2, 3, 4, 5]
+ * @endcode
+ */
+static inline size_expect_t push_at_n_int32_array(int32_tensor_t* t,
+                                                  const int32_t* data,
+                                                  size_t count,
+                                                  size_t index) {
+    if (t == NULL)
+        return (size_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    return push_at_n_tensor(t->base, data, count, index, INT32_TYPE);
+}
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Remove up to count values from the back of a dynamic 1-D array.
+ *
+ * Copies the removed values into out (if non-NULL) in their original
+ * order. Returns the number removed, or NULL_POINTER, or EMPTY if the
+ * array has no elements.
+ *
+ * @code{.c}
+ * // arr = [1, 2, 3, 4, 5]
+ * int32_t tail[2];
+ * pop_back_n_int32_array(arr, tail, 2u);   // tail = [4, 5], arr = [1, 2, 3]
+ * @endcode
+ */
+static inline size_expect_t pop_back_n_int32_array(int32_tensor_t* t,
+                                                   int32_t* out,
+                                                   size_t count) {
+    if (t == NULL)
+        return (size_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    return pop_back_n_tensor(t->base, out, count, INT32_TYPE);
+}
 // ================================================================================ 
 // ================================================================================ 
 // RETRIEVE DATA
@@ -1120,6 +1255,400 @@ static inline error_code_t get_int32_tensor_nd_index(const int32_tensor_t* t,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+/**
+ * @brief Elementwise sum, out[i] = a[i] + b[i].
+ *
+ * Runs on the active SIMD tier (see c_simd.h) with unaligned loads and a
+ * scalar tail, so any length and alignment is accepted.  out may be a or b
+ * to update in place; otherwise its buffer must not overlap either operand.
+ * An ARRAY_STRUCT out is resized to a's length, growing first if it is
+ * dynamic (see prepare_elementwise_tensor).
+ *
+ * Integer overflow wraps modulo 2^32.
+ *
+ * @param out  Destination tensor. Must not be NULL.
+ * @param a    Left operand. Must not be NULL.
+ * @param b    Right operand with the same length as a. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if out, a or b is NULL
+ *         - EMPTY         if a holds no elements
+ *         - SIZE_MISMATCH if the lengths of a, b and out are incompatible
+ *         - INVALID_ARG   if out partially overlaps a or b
+ *
+ * @code{.c}
+ * // acc += x, in place
+ * error_code_t err = add_int32_tensor(acc, acc, x);
+ * @endcode
+ */
+error_code_t add_int32_tensor(int32_tensor_t*       out,
+                              const int32_tensor_t* a,
+                              const int32_tensor_t* b);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Elementwise difference, out[i] = a[i] - b[i].
+ *
+ * Same operand, aliasing and error rules as add_int32_tensor.
+ */
+error_code_t sub_int32_tensor(int32_tensor_t*       out,
+                              const int32_tensor_t* a,
+                              const int32_tensor_t* b);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Elementwise product, out[i] = a[i] * b[i].
+ *
+ * Same operand, aliasing and error rules as add_int32_tensor. Products
+ * keep the low 32 bits.
+ */
+error_code_t mul_int32_tensor(int32_tensor_t*       out,
+                              const int32_tensor_t* a,
+                              const int32_tensor_t* b);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Elementwise quotient, out[i] = a[i] / b[i].
+ *
+ * No supported ISA has a vector integer divide, so this is a scalar loop.
+ * Every divisor is checked before anything is written.
+ * The quotient truncates toward zero and INT32_MIN / -1 wraps to
+ * INT32_MIN.
+ *
+ * @return NO_ERROR on success, DIV_BY_ZERO if any b[i] == 0 (out is left
+ *         untouched), or an error from add_int32_tensor's list.
+ */
+error_code_t div_int32_tensor(int32_tensor_t*       out,
+                              const int32_tensor_t* a,
+                              const int32_tensor_t* b);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Scale and shift every element, out[i] = a[i] * mul + add.
+ *
+ * Arithmetic wraps modulo 2^32.  out may be a.
+ *
+ * @param out  Destination tensor. Must not be NULL.
+ * @param a    Source tensor. Must not be NULL.
+ * @param mul  Factor applied to each element.
+ * @param add  Offset added after scaling.
+ *
+ * @return NO_ERROR on success, or an error from add_int32_tensor's list.
+ */
+error_code_t muladd_int32_tensor(int32_tensor_t*       out,
+                                 const int32_tensor_t* a,
+                                 int32_t               mul,
+                                 int32_t               add);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Limit every element to [lo, hi].
+ *
+ * out[i] = min(max(a[i], lo), hi).  out may be a.
+ *
+ * @param out  Destination tensor. Must not be NULL.
+ * @param a    Source tensor. Must not be NULL.
+ * @param lo   Lower bound.
+ * @param hi   Upper bound. Must be >= lo.
+ *
+ * @return NO_ERROR on success, INVALID_ARG if lo > hi, or an error from add_int32_tensor's list.
+ */
+error_code_t clamp_int32_tensor(int32_tensor_t*       out,
+                                const int32_tensor_t* a,
+                                int32_t               lo,
+                                int32_t               hi);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Absolute value, out[i] = |a[i]|.
+ *
+ * INT32_MIN has no positive counterpart and is returned unchanged, as
+ * two's complement negation produces.  out may be a.
+ *
+ * @return NO_ERROR on success, or an error from add_int32_tensor's list.
+ */
+error_code_t abs_int32_tensor(int32_tensor_t*       out,
+                              const int32_tensor_t* a);
+// ================================================================================ 
+// ================================================================================ 
+// REDUCTIONS
+
+/**
+ * @brief Find the maximum value in the tensor; the mirror of min_int32_tensor.
+ *
+ * @param t      Source tensor. Must not be NULL.
+ * @param value  Receives the maximum. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if t, t->base or value is NULL
+ *         - EMPTY         if the tensor holds no elements
+ */
+error_code_t max_int32_tensor(const int32_tensor_t* t,
+                              int32_t*              value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Flat index of the first occurrence of the minimum value.
+ *
+ * The extremum is found with the SIMD min/max kernel, then a second
+ * scan stops at its first occurrence.
+ *
+ * @param t      Source tensor. Must not be NULL.
+ * @param index  Receives the index into t's flat buffer. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if t, t->base or index is NULL
+ *         - EMPTY         if the tensor holds no elements
+ */
+error_code_t argmin_int32_tensor(const int32_tensor_t* t,
+                                 size_t*               index);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Flat index of the first occurrence of the maximum value.
+ *
+ * Same rules as argmin_int32_tensor.
+ */
+error_code_t argmax_int32_tensor(const int32_tensor_t* t,
+                                 size_t*               index);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Sum every element of the tensor.
+ *
+ * The sum is accumulated in int64_t by the active SIMD kernel and is
+ * exact for any tensor shorter than 2^31 elements.
+ *
+ * Works on both TENSOR_STRUCT and ARRAY_STRUCT modes and covers exactly
+ * t->base->len elements.
+ *
+ * @param t      Source tensor. Must not be NULL.
+ * @param value  Receives the sum. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if t, t->base or value is NULL
+ *         - EMPTY         if the tensor holds no elements
+ *
+ * @code{.c}
+ * int64_t total;
+ * if (sum_int32_tensor(prices, &total) == NO_ERROR) ...
+ * @endcode
+ */
+error_code_t sum_int32_tensor(const int32_tensor_t* t,
+                              int64_t*              value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Arithmetic mean of every element, sum_int32_tensor divided by the element count.
+ *
+ * @return NO_ERROR on success, NULL_POINTER or EMPTY as for sum_int32_tensor.
+ */
+error_code_t mean_int32_tensor(const int32_tensor_t* t,
+                               double*               value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief L1 norm, the sum of |t[i]|.
+ *
+ * Accumulated exactly in 64-bit integers and converted once.
+ *
+ * @return NO_ERROR on success, NULL_POINTER or EMPTY as for sum_int32_tensor.
+ */
+error_code_t l1_norm_int32_tensor(const int32_tensor_t* t,
+                                  double*               value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Euclidean (L2) norm, sqrt(sum of t[i]^2).
+ *
+ * Squares are accumulated in double.
+ *
+ * @return NO_ERROR on success, NULL_POINTER or EMPTY as for sum_int32_tensor.
+ */
+error_code_t l2_norm_int32_tensor(const int32_tensor_t* t,
+                                  double*               value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Dot product, the sum of a[i] * b[i].
+ *
+ * Products are widened to int64_t and accumulation is checked, so an
+ * out-of-range result is reported instead of wrapping.
+ *
+ * @param a      First operand. Must not be NULL.
+ * @param b      Second operand with the same length as a. Must not be NULL.
+ * @param value  Receives the result. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if a, b, their bases or value is NULL
+ *         - EMPTY         if a holds no elements
+ *         - SIZE_MISMATCH if a and b differ in length
+ *         - NUMERIC_OVERFLOW if a product or the total does not fit
+ */
+error_code_t dot_int32_tensor(const int32_tensor_t* a,
+                              const int32_tensor_t* b,
+                              int64_t*              value);
+// ================================================================================ 
+// ================================================================================ 
+// AXIS REDUCTIONS
+
+/**
+ * @brief Reduce along one axis into a new int32_tensor_t.
+ *
+ * Thin wrapper over reduce_tensor_axis.  The result drops the reduced axis
+ * from the shape of t; a 1-D input, or an array, yields shape {1}.
+ * Along the last axis each row is reduced by the SIMD kernels; any other
+ * axis is folded one cache-sized strip at a time with SIMD elementwise
+ * kernels.  Sums wrap like add_int32_tensor.  Means are accumulated in
+ * 64 bits and truncated toward zero.
+ *
+ * @param t        Tensor to reduce. Must not be NULL.
+ * @param axis     Axis to reduce, 0 <= axis < ndim.
+ * @param op       REDUCE_SUM, REDUCE_MIN, REDUCE_MAX or REDUCE_MEAN.
+ * @param alloc_v  Allocator for the result. If alloc_v.allocate is NULL
+ *                 the allocator of t is used.
+ *
+ * @return int32_tensor_expect_t holding the result, or an error:
+ *         NULL_POINTER if t is NULL, BAD_ALLOC if the wrapper cannot be
+ *         allocated, or any error reported by reduce_tensor_axis.
+ *
+ * @code
+ * // Row means of a 3 x 4 matrix: shape {3, 4} -> {3}
+ * int32_tensor_expect_t r = reduce_int32_tensor_axis(m, 1u, REDUCE_MEAN,
+ *                                                    (allocator_vtable_t){ 0 });
+ * @endcode
+ */
+int32_tensor_expect_t reduce_int32_tensor_axis(const int32_tensor_t* t,
+                                               uint8_t               axis,
+                                               reduce_op_t           op,
+                                               allocator_vtable_t    alloc_v);
+// ================================================================================ 
+// ================================================================================ 
+// PREFIX SUMS
+
+/**
+ * @brief Inclusive or exclusive prefix sums of a, written to out.
+ *
+ * Thin wrapper over cumulative_sum_tensor, which scans blocks of the flat
+ * element sequence on up to num_threads threads.  Sums wrap modulo 2^32.
+ * out may be a for an in-place scan.
+ *
+ * @param out          Destination tensor. Must not be NULL.
+ * @param a            Source tensor. Must not be NULL.
+ * @param mode         SCAN_INCLUSIVE or SCAN_EXCLUSIVE.
+ * @param num_threads  Maximum number of threads; 0 uses every online core.
+ *
+ * @return NO_ERROR on success, NULL_POINTER if out or a is NULL, or any
+ *         error reported by cumulative_sum_tensor.
+ *
+ * @code
+ * // Exclusive scan of per-row counts gives CSR row offsets
+ * error_code_t err = cumulative_sum_int32_tensor(row_ptr, counts,
+ *                                                SCAN_EXCLUSIVE, 0u);
+ * @endcode
+ */
+static inline error_code_t cumulative_sum_int32_tensor(int32_tensor_t*       out,
+                                                       const int32_tensor_t* a,
+                                                       scan_mode_t           mode,
+                                                       size_t                num_threads) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    return cumulative_sum_tensor(out->base, a->base, mode, num_threads);
+}
+// ================================================================================ 
+// ================================================================================ 
+// BROADCASTING
+
+/**
+ * @brief Apply a binary operation to two tensors of broadcast-compatible
+ *        shapes.
+ *
+ * Thin wrapper over broadcast_tensor.  Axes of extent 1 in a or b are read
+ * through a zero stride instead of being expanded, and each inner row runs
+ * a contiguous kernel.  out must have the broadcast shape (see
+ * broadcast_tensor_shape) and may be a or b when that operand already has
+ * it.
+ *
+ * Add, sub and mul wrap modulo 2^32; division truncates toward zero,
+ * INT32_MIN / -1 wraps to INT32_MIN, and a zero anywhere in b
+ * reports DIV_BY_ZERO without writing out.
+ *
+ * @param out  Destination tensor. Must not be NULL.
+ * @param a    Left operand. Must not be NULL.
+ * @param b    Right operand. Must not be NULL.
+ * @param op   BINARY_ADD, BINARY_SUB, BINARY_MUL, BINARY_DIV, BINARY_MIN
+ *             or BINARY_MAX.
+ *
+ * @return NO_ERROR on success, NULL_POINTER if out, a or b is NULL, or any
+ *         error reported by broadcast_tensor.
+ *
+ * @code
+ * // Subtract a per-column offset {1, M} from every row of an {N, M} image
+ * error_code_t err = broadcast_int32_tensor(img, img, offsets, BINARY_SUB);
+ * @endcode
+ */
+static inline error_code_t broadcast_int32_tensor(int32_tensor_t*       out,
+                                                  const int32_tensor_t* a,
+                                                  const int32_tensor_t* b,
+                                                  binary_op_t           op) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    return broadcast_tensor(out->base, a->base, b->base, op);
+}
+// ================================================================================ 
+// ================================================================================ 
+// FILE STORAGE
+
+/**
+ * @brief Write a tensor to a file that map_int32_tensor_file can load
+ *        in place.
+ *
+ * Thin wrapper over write_tensor_file; the element buffer is streamed
+ * straight from the tensor after a small header.
+ *
+ * @param t          Tensor to write. Must not be NULL.
+ * @param path       Destination file name. Must not be NULL.
+ * @param alignment  Data alignment within the file; 0 selects
+ *                   TENSOR_FILE_ALIGNMENT.
+ *
+ * @return NO_ERROR on success, NULL_POINTER if t is NULL, or any error
+ *         reported by write_tensor_file.
+ */
+static inline error_code_t write_int32_tensor_file(const int32_tensor_t* t,
+                                                   const char*           path,
+                                                   size_t                alignment) {
+    if (t == NULL) return NULL_POINTER;
+    return write_tensor_file(t->base, path, alignment);
+}
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Map a tensor file into memory without copying its data.
+ *
+ * Thin wrapper over map_tensor_file.  The returned tensor points into a
+ * copy-on-write mapping, so writes never reach the file; return_int32_tensor
+ * unmaps it.
+ *
+ * @param path     File written by write_int32_tensor_file. Must not be NULL.
+ * @param alloc_v  Allocator for the tensor header and wrapper.
+ *
+ * @return int32_tensor_expect_t with has_value true on success.  On failure,
+ *         has_value is false and u.error is TYPE_MISMATCH if the file holds
+ *         another dtype, BAD_ALLOC if the wrapper cannot be allocated, or
+ *         any error reported by map_tensor_file.
+ *
+ * @code
+ * int32_tensor_expect_t r = map_int32_tensor_file("samples.tns", heap_allocator());
+ * if (r.has_value) {
+ *     // ...
+ *     return_int32_tensor(r.u.value);
+ * }
+ * @endcode
+ */
+int32_tensor_expect_t map_int32_tensor_file(const char*        path,
+                                            allocator_vtable_t alloc_v);
+// ================================================================================ 
+// ================================================================================ 
 #ifdef __cplusplus
 }
 #endif /* cplusplus */
@@ -609,6 +609,37 @@ static inline error_code_t sort_ldouble_tensor(ldouble_tensor_t* t,
 }
 // -------------------------------------------------------------------------------- 
 
+/**
+ * @brief Sort a ldouble tensor in place using several threads.
+ *
+ * Stable multi-threaded merge sort over the same elements as
+ * sort_ldouble_tensor.  See parallel_sort_tensor for the algorithm, the
+ * thread count limits and the scratch buffer, which holds
+ * len * sizeof(element) bytes for the duration of the call.
+ *
+ * @param t            Pointer to the target tensor. Must not be NULL.
+ * @param dir          FORWARD for ascending order, REVERSE for descending order.
+ * @param num_threads  Maximum number of threads; 0 uses every online core.
+ * @param scratch      Allocator for the temporary buffer.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if t is NULL or scratch is incomplete
+ *         - EMPTY         if t->base->len < 2
+ *         - OUT_OF_MEMORY if the scratch buffer cannot be allocated
+ *
+ * @code
+ * error_code_t err = parallel_sort_ldouble_tensor(arr, FORWARD, 0u, heap_allocator());
+ * @endcode
+ */
+static inline error_code_t parallel_sort_ldouble_tensor(ldouble_tensor_t* t,
+                                                        direction_t dir,
+                                                        size_t num_threads,
+                                                        allocator_vtable_t scratch) {
+    if (t == NULL) return NULL_POINTER;
+    return parallel_sort_tensor(t->base, ldouble_cmp, dir, num_threads, scratch);
+}
+// -------------------------------------------------------------------------------- 
+
 /**
  * @brief Search a long double tensor for the first element within
  *        tolerance of a target value.
@@ -1146,6 +1177,77 @@ static inline error_code_t pop_at_ldouble_array(ldouble_tensor_t* t,
     if (t == NULL) return NULL_POINTER;
     return pop_at_tensor(t->base, out, index, LDOUBLE_TYPE);
 }
+
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Append count values from a buffer to a dynamic 1-D array.
+ *
+ * Grows the buffer at most once and copies the run in one shot. When
+ * the array cannot grow only the values that fit are taken. Returns the
+ * number of values appended, or NULL_POINTER, CAPACITY_OVERFLOW,
+ * LENGTH_OVERFLOW or OUT_OF_MEMORY on failure.
+ *
+ * @code{.c}
+ * // arr = [1, 2]
+ * long double vals[3] = { 3, 4, 5 };
+ * size_expect_t r = push_back_n_ldouble_array(arr, vals, 3u);
+ * // r.u.value == 3, arr = [1, 2, 3, 4, 5]
+ * @endcode
+ */
+static inline size_expect_t push_back_n_ldouble_array(ldouble_tensor_t* t,
+                                                      const long double* data,
+                                                      size_t count) {
+    if (t == NULL)
+        return (size_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    return push_back_n_tensor(t->base, data, count, LDOUBLE_TYPE);
+}
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Insert count values from a buffer at index in a dynamic 1-D array.
+ *
+ * Shifts the tail once and copies the run into the gap. data must not
+ * overlap the array. Returns the number of values inserted, or
+ * NULL_POINTER, OUT_OF_BOUNDS if index > len, INVALID_ARG on overlap,
+ * CAPACITY_OVERFLOW or OUT_OF_MEMORY on failure.
+ *
+ * @code{.c}
+ * // arr = [1, 5]
+ * long double vals[3] = { 2, 3, 4 };
+ * push_at_n_ldouble_array(arr, vals, 3u, 1u);   // arr = [1, 2, 3, 4, 5]
+ * @endcode
+ */
+static inline size_expect_t push_at_n_ldouble_array(ldouble_tensor_t* t,
+                                                    const long double* data,
+                                                    size_t count,
+                                                    size_t index) {
+    if (t == NULL)
+        return (size_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    return push_at_n_tensor(t->base, data, count, index, LDOUBLE_TYPE);
+}
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Remove up to count values from the back of a dynamic 1-D array.
+ *
+ * Copies the removed values into out (if non-NULL) in their original
+ * order. Returns the number removed, or NULL_POINTER, or EMPTY if the
+ * array has no elements.
+ *
+ * @code{.c}
+ * // arr = [1, 2, 3, 4, 5]
+ * long double tail[2];
+ * pop_back_n_ldouble_array(arr, tail, 2u);   // tail = [4, 5], arr = [1, 2, 3]
+ * @endcode
+ */
+static inline size_expect_t pop_back_n_ldouble_array(ldouble_tensor_t* t,
+                                                     long double* out,
+                                                     size_t count) {
+    if (t == NULL)
+        return (size_expect_t){ .has_value = false, .u.error = NULL_POINTER };
+    return pop_back_n_tensor(t->base, out, count, LDOUBLE_TYPE);
+}
 // ================================================================================ 
 // ================================================================================ 
 // RETRIEVE DATA
@@ -1194,6 +1296,400 @@ static inline error_code_t get_ldouble_tensor_nd_index(const ldouble_tensor_t* t
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+/**
+ * @brief Elementwise sum, out[i] = a[i] + b[i].
+ *
+ * long double has no SIMD representation, so this is a plain loop.  out
+ * may be a or b to update in place; otherwise its buffer must not overlap
+ * either operand.  An ARRAY_STRUCT out is resized to a's length, growing
+ * first if it is dynamic (see prepare_elementwise_tensor).
+ *
+ * @param out  Destination tensor. Must not be NULL.
+ * @param a    Left operand. Must not be NULL.
+ * @param b    Right operand with the same length as a. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if out, a or b is NULL
+ *         - EMPTY         if a holds no elements
+ *         - SIZE_MISMATCH if the lengths of a, b and out are incompatible
+ *         - INVALID_ARG   if out partially overlaps a or b
+ *
+ * @code{.c}
+ * // acc += x, in place
+ * error_code_t err = add_ldouble_tensor(acc, acc, x);
+ * @endcode
+ */
+error_code_t add_ldouble_tensor(ldouble_tensor_t*       out,
+                                const ldouble_tensor_t* a,
+                                const ldouble_tensor_t* b);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Elementwise difference, out[i] = a[i] - b[i].
+ *
+ * Same operand, aliasing and error rules as add_ldouble_tensor.
+ */
+error_code_t sub_ldouble_tensor(ldouble_tensor_t*       out,
+                                const ldouble_tensor_t* a,
+                                const ldouble_tensor_t* b);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Elementwise product, out[i] = a[i] * b[i].
+ *
+ * Same operand, aliasing and error rules as add_ldouble_tensor.
+ */
+error_code_t mul_ldouble_tensor(ldouble_tensor_t*       out,
+                                const ldouble_tensor_t* a,
+                                const ldouble_tensor_t* b);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Elementwise quotient, out[i] = a[i] / b[i].
+ *
+ * Same operand, aliasing and error rules as add_ldouble_tensor.  Division by
+ * zero follows IEEE 754 (+-inf or NaN) and is not reported as an error.
+ */
+error_code_t div_ldouble_tensor(ldouble_tensor_t*       out,
+                                const ldouble_tensor_t* a,
+                                const ldouble_tensor_t* b);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Scale and shift every element, out[i] = a[i] * mul + add.
+ *
+ * The multiply and add are separate operations on every tier, so results
+ * do not depend on which tier is active.  out may be a.
+ *
+ * @param out  Destination tensor. Must not be NULL.
+ * @param a    Source tensor. Must not be NULL.
+ * @param mul  Factor applied to each element.
+ * @param add  Offset added after scaling.
+ *
+ * @return NO_ERROR on success, or an error from add_ldouble_tensor's list.
+ *
+ * @code{.c}
+ * // Normalise to zero mean and unit scale
+ * error_code_t err = muladd_ldouble_tensor(x, x, 1 / sigma, -mean / sigma);
+ * @endcode
+ */
+error_code_t muladd_ldouble_tensor(ldouble_tensor_t*       out,
+                                   const ldouble_tensor_t* a,
+                                   long double             mul,
+                                   long double             add);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Limit every element to [lo, hi].
+ *
+ * out[i] = min(max(a[i], lo), hi).  out may be a. NaN elements are passed
+ * through unchanged.
+ *
+ * @param out  Destination tensor. Must not be NULL.
+ * @param a    Source tensor. Must not be NULL.
+ * @param lo   Lower bound.
+ * @param hi   Upper bound. Must be >= lo.
+ *
+ * @return NO_ERROR on success, INVALID_ARG if lo > hi or either bound is
+ *         NaN, or an error from add_ldouble_tensor's list.
+ */
+error_code_t clamp_ldouble_tensor(ldouble_tensor_t*       out,
+                                  const ldouble_tensor_t* a,
+                                  long double             lo,
+                                  long double             hi);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Absolute value, out[i] = |a[i]|.
+ *
+ * Clears the sign bit, so -0.0 becomes +0.0 and NaN keeps its payload.
+ * out may be a.
+ *
+ * @return NO_ERROR on success, or an error from add_ldouble_tensor's list.
+ */
+error_code_t abs_ldouble_tensor(ldouble_tensor_t*       out,
+                                const ldouble_tensor_t* a);
+// ================================================================================ 
+// ================================================================================ 
+// REDUCTIONS
+
+/**
+ * @brief Find the maximum value in the tensor.
+ *
+ * The mirror of min_ldouble_tensor: any NaN makes the result NaN, +INFINITY is
+ * an ordinary (largest) value and either signed zero may be returned.
+ *
+ * @param t      Source tensor. Must not be NULL.
+ * @param value  Receives the maximum. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if t, t->base or value is NULL
+ *         - EMPTY         if the tensor holds no elements
+ */
+error_code_t max_ldouble_tensor(const ldouble_tensor_t* t,
+                                long double*            value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Flat index of the first occurrence of the minimum value.
+ *
+ * A single scalar pass. NaN counts as the extremum, as it does for
+ * min_ldouble_tensor, so a NaN result yields the index of the first NaN.
+ *
+ * @param t      Source tensor. Must not be NULL.
+ * @param index  Receives the index into t's flat buffer. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if t, t->base or index is NULL
+ *         - EMPTY         if the tensor holds no elements
+ */
+error_code_t argmin_ldouble_tensor(const ldouble_tensor_t* t,
+                                   size_t*                 index);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Flat index of the first occurrence of the maximum value.
+ *
+ * Same rules as argmin_ldouble_tensor.
+ */
+error_code_t argmax_ldouble_tensor(const ldouble_tensor_t* t,
+                                   size_t*                 index);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Sum every element of the tensor.
+ *
+ * Elements are summed pairwise in blocks of LDOUBLE_REDUCE_BLOCK, so
+ * rounding error grows with log(n) rather than n.
+ *
+ * NaN and infinities propagate as in IEEE 754 addition.
+ *
+ * Works on both TENSOR_STRUCT and ARRAY_STRUCT modes and covers exactly
+ * t->base->len elements.
+ *
+ * @param t      Source tensor. Must not be NULL.
+ * @param value  Receives the sum. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if t, t->base or value is NULL
+ *         - EMPTY         if the tensor holds no elements
+ *
+ * @code{.c}
+ * long double total;
+ * if (sum_ldouble_tensor(prices, &total) == NO_ERROR) ...
+ * @endcode
+ */
+error_code_t sum_ldouble_tensor(const ldouble_tensor_t* t,
+                                long double*            value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Arithmetic mean of every element, sum_ldouble_tensor divided by the element count.
+ *
+ * @return NO_ERROR on success, NULL_POINTER or EMPTY as for sum_ldouble_tensor.
+ */
+error_code_t mean_ldouble_tensor(const ldouble_tensor_t* t,
+                                 long double*            value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief L1 norm, the sum of |t[i]|.
+ *
+ * Summed pairwise like sum_ldouble_tensor.
+ *
+ * @return NO_ERROR on success, NULL_POINTER or EMPTY as for sum_ldouble_tensor.
+ */
+error_code_t l1_norm_ldouble_tensor(const ldouble_tensor_t* t,
+                                    long double*            value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Euclidean (L2) norm, sqrt(sum of t[i]^2).
+ *
+ * Computed as sqrt(dot(t, t)) with no rescaling, so it overflows to
+ * +INFINITY once the squares exceed the range of the type.
+ *
+ * @return NO_ERROR on success, NULL_POINTER or EMPTY as for sum_ldouble_tensor.
+ */
+error_code_t l2_norm_ldouble_tensor(const ldouble_tensor_t* t,
+                                    long double*            value);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Dot product, the sum of a[i] * b[i].
+ *
+ * Products are summed pairwise as in sum_ldouble_tensor.
+ *
+ * @param a      First operand. Must not be NULL.
+ * @param b      Second operand with the same length as a. Must not be NULL.
+ * @param value  Receives the result. Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if a, b, their bases or value is NULL
+ *         - EMPTY         if a holds no elements
+ *         - SIZE_MISMATCH if a and b differ in length
+ */
+error_code_t dot_ldouble_tensor(const ldouble_tensor_t* a,
+                                const ldouble_tensor_t* b,
+                                long double*            value);
+// ================================================================================ 
+// ================================================================================ 
+// AXIS REDUCTIONS
+
+/**
+ * @brief Reduce along one axis into a new ldouble_tensor_t.
+ *
+ * Thin wrapper over reduce_tensor_axis.  The result drops the reduced axis
+ * from the shape of t; a 1-D input, or an array, yields shape {1}.
+ * There are no SIMD kernels for long double, so both the last-axis and
+ * the strip-folding paths are plain loops.  min and max propagate NaN.
+ *
+ * @param t        Tensor to reduce. Must not be NULL.
+ * @param axis     Axis to reduce, 0 <= axis < ndim.
+ * @param op       REDUCE_SUM, REDUCE_MIN, REDUCE_MAX or REDUCE_MEAN.
+ * @param alloc_v  Allocator for the result. If alloc_v.allocate is NULL
+ *                 the allocator of t is used.
+ *
+ * @return ldouble_tensor_expect_t holding the result, or an error:
+ *         NULL_POINTER if t is NULL, BAD_ALLOC if the wrapper cannot be
+ *         allocated, or any error reported by reduce_tensor_axis.
+ *
+ * @code
+ * // Row means of a 3 x 4 matrix: shape {3, 4} -> {3}
+ * ldouble_tensor_expect_t r = reduce_ldouble_tensor_axis(m, 1u, REDUCE_MEAN,
+ *                                                        (allocator_vtable_t){ 0 });
+ * @endcode
+ */
+ldouble_tensor_expect_t reduce_ldouble_tensor_axis(const ldouble_tensor_t* t,
+                                                   uint8_t                 axis,
+                                                   reduce_op_t             op,
+                                                   allocator_vtable_t      alloc_v);
+// ================================================================================ 
+// ================================================================================ 
+// PREFIX SUMS
+
+/**
+ * @brief Inclusive or exclusive prefix sums of a, written to out.
+ *
+ * Thin wrapper over cumulative_sum_tensor, which scans blocks of the flat
+ * element sequence on up to num_threads threads.  long double has no SIMD
+ * representation, so each block is a plain loop.  out may be a for an
+ * in-place scan.
+ *
+ * @param out          Destination tensor. Must not be NULL.
+ * @param a            Source tensor. Must not be NULL.
+ * @param mode         SCAN_INCLUSIVE or SCAN_EXCLUSIVE.
+ * @param num_threads  Maximum number of threads; 0 uses every online core.
+ *
+ * @return NO_ERROR on success, NULL_POINTER if out or a is NULL, or any
+ *         error reported by cumulative_sum_tensor.
+ *
+ * @code
+ * // Running total, in place, on every core
+ * error_code_t err = cumulative_sum_ldouble_tensor(x, x, SCAN_INCLUSIVE, 0u);
+ * @endcode
+ */
+static inline error_code_t cumulative_sum_ldouble_tensor(ldouble_tensor_t*       out,
+                                                         const ldouble_tensor_t* a,
+                                                         scan_mode_t             mode,
+                                                         size_t                  num_threads) {
+    if (out == NULL || a == NULL) return NULL_POINTER;
+    return cumulative_sum_tensor(out->base, a->base, mode, num_threads);
+}
+// ================================================================================ 
+// ================================================================================ 
+// BROADCASTING
+
+/**
+ * @brief Apply a binary operation to two tensors of broadcast-compatible
+ *        shapes.
+ *
+ * Thin wrapper over broadcast_tensor.  Axes of extent 1 in a or b are read
+ * through a zero stride instead of being expanded, and each inner row runs
+ * a contiguous kernel.  out must have the broadcast shape (see
+ * broadcast_tensor_shape) and may be a or b when that operand already has
+ * it.
+ *
+ * long double has no SIMD representation, so every row is a plain
+ * loop.  min and max propagate NaN.
+ *
+ * @param out  Destination tensor. Must not be NULL.
+ * @param a    Left operand. Must not be NULL.
+ * @param b    Right operand. Must not be NULL.
+ * @param op   BINARY_ADD, BINARY_SUB, BINARY_MUL, BINARY_DIV, BINARY_MIN
+ *             or BINARY_MAX.
+ *
+ * @return NO_ERROR on success, NULL_POINTER if out, a or b is NULL, or any
+ *         error reported by broadcast_tensor.
+ *
+ * @code
+ * // Scale each row of an {N, M} matrix by its own {N, 1} factor
+ * error_code_t err = broadcast_ldouble_tensor(m, m, factors, BINARY_MUL);
+ * @endcode
+ */
+static inline error_code_t broadcast_ldouble_tensor(ldouble_tensor_t*       out,
+                                                    const ldouble_tensor_t* a,
+                                                    const ldouble_tensor_t* b,
+                                                    binary_op_t             op) {
+    if (out == NULL || a == NULL || b == NULL) return NULL_POINTER;
+    return broadcast_tensor(out->base, a->base, b->base, op);
+}
+// ================================================================================ 
+// ================================================================================ 
+// FILE STORAGE
+
+/**
+ * @brief Write a tensor to a file that map_ldouble_tensor_file can load
+ *        in place.
+ *
+ * Thin wrapper over write_tensor_file; the element buffer is streamed
+ * straight from the tensor after a small header.
+ *
+ * @param t          Tensor to write. Must not be NULL.
+ * @param path       Destination file name. Must not be NULL.
+ * @param alignment  Data alignment within the file; 0 selects
+ *                   TENSOR_FILE_ALIGNMENT.
+ *
+ * @return NO_ERROR on success, NULL_POINTER if t is NULL, or any error
+ *         reported by write_tensor_file.
+ */
+static inline error_code_t write_ldouble_tensor_file(const ldouble_tensor_t* t,
+                                                     const char*             path,
+                                                     size_t                  alignment) {
+    if (t == NULL) return NULL_POINTER;
+    return write_tensor_file(t->base, path, alignment);
+}
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Map a tensor file into memory without copying its data.
+ *
+ * Thin wrapper over map_tensor_file.  The returned tensor points into a
+ * copy-on-write mapping, so writes never reach the file; return_ldouble_tensor
+ * unmaps it.
+ *
+ * @param path     File written by write_ldouble_tensor_file. Must not be NULL.
+ * @param alloc_v  Allocator for the tensor header and wrapper.
+ *
+ * @return ldouble_tensor_expect_t with has_value true on success.  On failure,
+ *         has_value is false and u.error is TYPE_MISMATCH if the file holds
+ *         another dtype, BAD_ALLOC if the wrapper cannot be allocated, or
+ *         any error reported by map_tensor_file.
+ *
+ * @code
+ * ldouble_tensor_expect_t r = map_ldouble_tensor_file("samples.tns", heap_allocator());
+ * if (r.has_value) {
+ *     // ...
+ *     return_ldouble_tensor(r.u.value);
+ * }
+ * @endcode
+ */
+ldouble_tensor_expect_t map_ldouble_tensor_file(const char*        path,
+                                                allocator_vtable_t alloc_v);
+// ================================================================================ 
+// ================================================================================ 
 #ifdef __cplusplus
 }
 #endif /* cplusplus */
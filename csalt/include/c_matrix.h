@@ -37,7 +37,9 @@ typedef enum {
     DENSE_MATRIX = 0,   /**< Row-major contiguous buffer.                   */
     COO_MATRIX   = 1,   /**< Coordinate list (row, col, value) triplets.    */
     CSR_MATRIX   = 2,   /**< Compressed Sparse Row.                         */
-    CSC_MATRIX   = 3    /**< Compressed Sparse Column.                      */
+    CSC_MATRIX   = 3,   /**< Compressed Sparse Column.                      */
+    BSR_MATRIX   = 4,   /**< Block Compressed Sparse Row.                   */
+    SELL_MATRIX  = 5    /**< Sliced ELLPACK (SELL-C-sigma).                 */
 } matrix_format_t;
  
 // ================================================================================
@@ -58,21 +60,39 @@ typedef struct {
  
 // --------------------------------------------------------------------------------
  
+/**
+ * @brief How convert_coo_matrix() and COO assembly resolve entries sharing
+ *        (row, col).
+ */
+typedef enum {
+    COO_DUPLICATE_LAST  = 0,   /**< Keep the last entry pushed (convert_matrix). */
+    COO_DUPLICATE_FIRST = 1,   /**< Keep the first entry pushed, drop the rest.  */
+    COO_DUPLICATE_SUM   = 2    /**< Sum the entries (arithmetic dtypes only).    */
+} coo_duplicate_t;
+ 
+// -------------------------------------------------------------------------------- 
+ 
 /**
  * @brief COO storage: three parallel arrays (row_idx, col_idx, values).
  *
  * Entries are stored in insertion order unless @c sorted is true, in which
  * case they are in row-major (row, col) order and binary search is used
- * for lookups.
+ * for lookups.  Between begin_coo_assembly() and finalize_coo_assembly()
+ * the entries are also indexed by an open-addressing hash on (row, col),
+ * which every lookup uses instead.
  */
 typedef struct {
-    size_t   nnz;       /**< Number of active entries.                  */
-    size_t   cap;       /**< Allocated entry capacity.                  */
-    bool     growth;    /**< Allow dynamic growth when capacity full.   */
-    bool     sorted;    /**< True if entries sorted by (row, col).      */
-    size_t*  row_idx;   /**< Row indices, length = cap.                 */
-    size_t*  col_idx;   /**< Column indices, length = cap.              */
-    uint8_t* values;    /**< Value buffer, size = cap * data_size.      */
+    size_t          nnz;        /**< Number of active entries.                  */
+    size_t          cap;        /**< Allocated entry capacity.                  */
+    bool            growth;     /**< Allow dynamic growth when capacity full.   */
+    bool            sorted;     /**< True if entries sorted by (row, col).      */
+    size_t*         row_idx;    /**< Row indices, length = cap.                 */
+    size_t*         col_idx;    /**< Column indices, length = cap.              */
+    uint8_t*        values;     /**< Value buffer, size = cap * data_size.      */
+    size_t*         index;      /**< Assembly hash slots holding entry + 1, 0
+                                     when empty; NULL when not assembling.      */
+    size_t          index_mask; /**< Hash slot count - 1 while assembling.      */
+    coo_duplicate_t duplicates; /**< How assembly combines a repeated (row, col). */
 } coo_matrix_t;
  
 // --------------------------------------------------------------------------------
@@ -105,6 +125,53 @@ typedef struct {
     uint8_t* values;    /**< Value buffer, size = nnz * data_size.      */
 } csc_matrix_t;
  
+// --------------------------------------------------------------------------------
+ 
+/**
+ * @brief BSR storage: CSR over dense block_rows x block_cols blocks.
+ *
+ * Block row @c I holds blocks block_ptr[I] .. block_ptr[I+1]-1, sorted by
+ * block column.  Block @c k covers rows I * block_rows onward and columns
+ * block_col[k] * block_cols onward; its values are stored row-major at
+ * values + k * block_rows * block_cols * data_size.  Positions past the
+ * last row or column of the matrix are zero padding.
+ */
+typedef struct {
+    size_t   block_rows; /**< Rows per block.                            */
+    size_t   block_cols; /**< Columns per block.                         */
+    size_t   nnzb;       /**< Number of stored blocks.                   */
+    size_t*  block_ptr;  /**< Block row pointers, length = ceil(rows /
+                              block_rows) + 1.                            */
+    size_t*  block_col;  /**< Block column index per block, length = nnzb. */
+    uint8_t* values;     /**< Block values, nnzb * block_rows * block_cols
+                              elements.                                   */
+} bsr_matrix_t;
+ 
+// --------------------------------------------------------------------------------
+ 
+/**
+ * @brief SELL-C-sigma storage: ELLPACK slices of @c chunk rows.
+ *
+ * Rows are sorted by decreasing length within each window of @c sigma
+ * rows, then cut into slices of @c chunk consecutive slots.  Every row of
+ * a slice is padded to the slice's longest row and the slice is stored
+ * column by column: entry @c j of slot @c s * chunk + i lives at
+ * slice_ptr[s] + j * chunk + i.  Padding has value zero and repeats a
+ * column index of its row, so it is always safe to gather.
+ */
+typedef struct {
+    size_t   nnz;        /**< Number of stored entries, excluding padding. */
+    size_t   chunk;      /**< Rows per slice (C).                        */
+    size_t   sigma;      /**< Rows per sorting window (sigma).           */
+    size_t*  slice_ptr;  /**< Slice offsets, length = ceil(rows / chunk)
+                              + 1.                                        */
+    size_t*  row_perm;   /**< Matrix row held by each slot, length = rows. */
+    size_t*  row_slot;   /**< Slot holding each matrix row, length = rows. */
+    size_t*  row_len;    /**< Entries in each slot's row, length = rows.  */
+    size_t*  col_idx;    /**< Column indices, length = slice_ptr[last].  */
+    uint8_t* values;     /**< Values, slice_ptr[last] elements.          */
+} sell_matrix_t;
+ 
 // ================================================================================
 // Generic matrix type
 // ================================================================================
@@ -132,6 +199,8 @@ typedef struct {
         coo_matrix_t   coo;        /**< COO representation.                     */
         csr_matrix_t   csr;        /**< CSR representation.                     */
         csc_matrix_t   csc;        /**< CSC representation.                     */
+        bsr_matrix_t   bsr;        /**< Block CSR representation.               */
+        sell_matrix_t  sell;       /**< SELL-C-sigma representation.            */
     } rep;
 } matrix_t;
  
@@ -182,6 +251,7 @@ typedef bool (*matrix_equal_fn)(const void* a,
  * should be treated as zero.
  */
 typedef bool (*matrix_zero_fn)(const void* value);
+
  
 // ================================================================================
 // Initialization and teardown
@@ -441,7 +511,8 @@ matrix_format_t matrix_format(const matrix_t* mat);
 /**
  * @brief Return the entry count.
  *
- * Dense: rows × cols.  COO/CSR/CSC: stored nonzero count.
+ * Dense: rows × cols.  COO/CSR/CSC/SELL: stored nonzero count, without
+ * SELL padding.  BSR: stored blocks × block_rows × block_cols.
  *
  * @param mat  Matrix to inspect.
  * @return Entry count, or 0 if @p mat is NULL.
@@ -521,7 +592,8 @@ error_code_t get_matrix(const matrix_t* mat,
  * @brief Write element at (row, col) from @p value.
  *
  * Dense: direct overwrite.  COO: inserts or overwrites the entry at
- * (row, col).  CSR/CSC: not supported (return ILLEGAL_STATE).
+ * (row, col), or combines with it as begin_coo_assembly() chose while
+ * assembling.  CSR/CSC/BSR/SELL: not supported (return ILLEGAL_STATE).
  *
  * Wrapper: take @c T value by value, pass @c &value.
  *
@@ -533,7 +605,7 @@ error_code_t get_matrix(const matrix_t* mat,
  * @return NO_ERROR on success, or:
  *         - NULL_POINTER      — mat or value is NULL
  *         - INVALID_ARG       — (row, col) out of bounds
- *         - ILLEGAL_STATE     — format is CSR or CSC
+ *         - ILLEGAL_STATE     — format is CSR, CSC, BSR or SELL
  *         - CAPACITY_OVERFLOW — COO is full and growth is false
  *         - LENGTH_OVERFLOW   — COO growth would overflow size_t
  *         - OUT_OF_MEMORY     — COO growth allocation failed
@@ -616,7 +688,8 @@ error_code_t reserve_coo_matrix(matrix_t* mat, size_t capacity);
  *
  * If an entry at (row, col) already exists, its value is overwritten
  * without increasing nnz.  Otherwise a new entry is appended and the
- * matrix is marked unsorted.
+ * matrix is marked unsorted.  Finding the existing entry is a linear scan
+ * of an unsorted matrix; use begin_coo_assembly() for O(1) inserts.
  *
  * Wrapper: take @c T value by value, pass @c &value.
  *
@@ -700,6 +773,95 @@ error_code_t push_back_coo_matrix(matrix_t*    mat,
  */
 error_code_t sort_coo_matrix(matrix_t* mat);
  
+// -------------------------------------------------------------------------------- 
+ 
+/**
+ * @brief Index a COO matrix by (row, col) for incremental assembly.
+ *
+ * Builds an open-addressing hash over the stored entries.  Until
+ * finalize_coo_assembly() or finalize_coo_assembly_compressed(), each
+ * set_matrix() / push_back_coo_matrix() finds an existing entry in
+ * expected O(1) and combines the new value with it according to
+ * @p duplicates, instead of scanning all nnz entries; get_matrix() uses
+ * the hash as well.  Entries already sharing (row, col) are merged the
+ * same way, keeping the first one's position.  Calling this on a
+ * matrix that is already assembling only changes @p duplicates.
+ *
+ * The hash costs one size_t per slot, at most four slots per entry.
+ * sort_coo_matrix() and the row / column swaps rebuild it; entries
+ * written through @c rep.coo directly are not indexed.  copy_matrix()
+ * returns a plain COO matrix.
+ *
+ * @param mat         COO matrix to assemble into.  Must not be NULL.
+ * @param duplicates  How a repeated (row, col) is combined.
+ *
+ * @return NO_ERROR on success, or:
+ *         - NULL_POINTER  — mat is NULL
+ *         - ILLEGAL_STATE — mat is not COO format
+ *         - INVALID_ARG   — duplicates is not a coo_duplicate_t value
+ *         - TYPE_MISMATCH — COO_DUPLICATE_SUM on a non-arithmetic dtype
+ *         - OUT_OF_MEMORY — the hash could not be allocated
+ *
+ * @code{.c}
+ * allocator_vtable_t alloc = heap_allocator();
+ *
+ * matrix_t* k = init_coo_matrix(n, n, 1024, DOUBLE_TYPE, true, alloc).u.value;
+ * begin_coo_assembly(k, COO_DUPLICATE_SUM);
+ *
+ * for (size_t e = 0; e < elements; e++) {
+ *     // ... each element adds its local stiffness into k ...
+ *     set_matrix(k, row, col, &contribution);
+ * }
+ *
+ * matrix_expect_t r = finalize_coo_assembly_compressed(k, CSR_MATRIX, 0, alloc);
+ * return_matrix(k);
+ * @endcode
+ */
+error_code_t begin_coo_assembly(matrix_t* mat, coo_duplicate_t duplicates);
+ 
+// -------------------------------------------------------------------------------- 
+ 
+/**
+ * @brief End COO assembly, leaving the entries sorted in place.
+ *
+ * Releases the hash built by begin_coo_assembly() and sorts the entries,
+ * which are unique by construction, into row-major (row, col) order.
+ *
+ * @param mat  Assembling COO matrix.  Must not be NULL.
+ *
+ * @return NO_ERROR on success, or:
+ *         - NULL_POINTER  — mat is NULL
+ *         - ILLEGAL_STATE — mat is not COO format or is not assembling
+ */
+error_code_t finalize_coo_assembly(matrix_t* mat);
+ 
+// -------------------------------------------------------------------------------- 
+ 
+/**
+ * @brief End COO assembly and emit the entries as CSR or CSC.
+ *
+ * Compresses the assembled entries with the counting sorts of
+ * convert_coo_matrix(); since they are unique no duplicate resolution is
+ * needed.  Entries whose value is zero are not stored.  On success the
+ * hash is released and @p mat stays a valid, unsorted COO matrix owned
+ * by the caller; on failure @p mat is still assembling.
+ *
+ * @param mat          Assembling COO matrix.  Must not be NULL.
+ * @param target       CSR_MATRIX or CSC_MATRIX.
+ * @param num_threads  Worker threads, 0 for the number of online processors.
+ * @param alloc_v      Allocator for the destination matrix.
+ *
+ * @return matrix_expect_t with has_value true on success, or u.error:
+ *         - NULL_POINTER  — mat is NULL
+ *         - ILLEGAL_STATE — mat is not an assembling COO matrix, or
+ *                           target is not CSR / CSC
+ *         - OUT_OF_MEMORY — allocation failed
+ */
+matrix_expect_t finalize_coo_assembly_compressed(matrix_t*          mat,
+                                                 matrix_format_t    target,
+                                                 size_t             num_threads,
+                                                 allocator_vtable_t alloc_v);
+ 
 // ================================================================================
 // Lifecycle / structural operations
 // ================================================================================
@@ -707,7 +869,8 @@ error_code_t sort_coo_matrix(matrix_t* mat);
 /**
  * @brief Clear a matrix while preserving its allocated storage.
  *
- * Dense: all bytes memset to zero.  COO: nnz reset to 0, sorted to true.
+ * Dense: all bytes memset to zero.  COO: nnz reset to 0, sorted to true;
+ * an assembling matrix stays assembling.
  * CSR/CSC: not supported.
  *
  * Wrapper: delegate directly.
@@ -799,7 +962,9 @@ matrix_expect_t copy_matrix(const matrix_t*   src,
  * @brief Convert to a different storage format.
  *
  * All format pairs are supported.  If @p target equals the source format,
- * this behaves like copy_matrix.
+ * this behaves like copy_matrix.  BSR and SELL conversions go through CSR;
+ * a BSR target uses 4 x 4 blocks and a SELL target chunk 8 and sigma 256
+ * (see convert_to_bsr_matrix() and convert_to_sell_matrix() to choose).
  *
  * Wrapper: intercept specialized fast paths if desired, otherwise delegate.
  *
@@ -926,15 +1091,146 @@ matrix_expect_t convert_matrix_zero(const matrix_t*    src,
                                     matrix_format_t    target,
                                     allocator_vtable_t alloc_v,
                                     matrix_zero_fn     is_zero);
+
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Convert a COO matrix to CSR or CSC with explicit duplicate handling.
+ *
+ * The entries are ordered with two stable counting sorts, by minor then by
+ * major index, so no comparison sort is involved and the cost is linear in
+ * nnz + rows + cols.  Histograms, scatters and the final compression run
+ * in parallel; the entries are split between threads only while each
+ * thread's per-index counters stay small next to the entries themselves.
+ * Entries whose resolved value is zero are not stored.  convert_matrix()
+ * takes this path for COO sources with COO_DUPLICATE_LAST.
+ *
+ * @param src          COO matrix to convert.  Must not be NULL.
+ * @param target       CSR_MATRIX or CSC_MATRIX.
+ * @param duplicates   How entries sharing (row, col) are combined.
+ * @param num_threads  Worker threads, 0 for the number of online processors.
+ * @param alloc_v      Allocator for the destination matrix.
+ *
+ * @return matrix_expect_t with has_value true on success, or u.error:
+ *         - NULL_POINTER  — src is NULL
+ *         - ILLEGAL_STATE — src is not COO, or target is not CSR / CSC
+ *         - INVALID_ARG   — duplicates is not a coo_duplicate_t value
+ *         - TYPE_MISMATCH — COO_DUPLICATE_SUM on a non-arithmetic dtype
+ *         - OUT_OF_MEMORY — allocation failed
+ *
+ * @code{.c}
+ * allocator_vtable_t alloc = heap_allocator();
+ *
+ * matrix_t* coo = init_coo_matrix(4, 4, 1024, DOUBLE_TYPE, true, alloc).u.value;
+ *
+ * // ... ingest fills coo->rep.coo directly, possibly with repeats ...
+ *
+ * matrix_expect_t r = convert_coo_matrix(coo, CSR_MATRIX, COO_DUPLICATE_SUM,
+ *                                        0, alloc);
+ * if (r.has_value) {
+ *     // ... use r.u.value ...
+ *     return_matrix(r.u.value);
+ * }
+ * return_matrix(coo);
+ * @endcode
+ */
+matrix_expect_t convert_coo_matrix(const matrix_t*    src,
+                                   matrix_format_t    target,
+                                   coo_duplicate_t    duplicates,
+                                   size_t             num_threads,
+                                   allocator_vtable_t alloc_v);
+
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Convert any matrix to Block CSR with the given block shape.
+ *
+ * Non-CSR sources are converted to CSR first.  Every block holding at
+ * least one stored entry is kept whole, so zeros inside a block are
+ * stored explicitly; matrix_nnz() of the result counts block slots.
+ * Block shapes that match the natural blocks of the matrix (the degrees
+ * of freedom per node of a finite-element mesh, say) keep that fill low
+ * and store one column index per block instead of one per entry.
+ * Dimensions need not be multiples of the block shape.
+ *
+ * @param src         Matrix to convert.  Must not be NULL.
+ * @param block_rows  Rows per block, nonzero.
+ * @param block_cols  Columns per block, nonzero.
+ * @param alloc_v     Allocator for the destination matrix.
+ *
+ * @return matrix_expect_t with has_value true on success, or u.error:
+ *         - NULL_POINTER    — src is NULL
+ *         - INVALID_ARG     — a block dimension is zero
+ *         - LENGTH_OVERFLOW — block storage would overflow size_t
+ *         - OUT_OF_MEMORY   — allocation failed
+ *         (errors converting src to CSR are propagated)
+ *
+ * @code{.c}
+ * matrix_expect_t r = convert_to_bsr_matrix(stiffness, 3, 3, heap_allocator());
+ * if (r.has_value) {
+ *     matrix_multiply_vector(f, r.u.value, u, false, 0);
+ *     return_matrix(r.u.value);
+ * }
+ * @endcode
+ */
+matrix_expect_t convert_to_bsr_matrix(const matrix_t*    src,
+                                      size_t             block_rows,
+                                      size_t             block_cols,
+                                      allocator_vtable_t alloc_v);
+
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Convert any matrix to SELL-C-sigma.
+ *
+ * Non-CSR sources are converted to CSR first.  Rows are sorted by length
+ * within windows of @p sigma rows so that slices of @p chunk rows need
+ * little padding, then each slice is stored column by column so that one
+ * SIMD register covers the same position in @p chunk consecutive rows.
+ * A @p chunk equal to, or a multiple of, the SIMD width in elements (8
+ * suits AVX floats and AVX-512 doubles) keeps every lane busy; @p sigma
+ * of 1 disables sorting.
+ *
+ * @param src      Matrix to convert.  Must not be NULL.
+ * @param chunk    Rows per slice, 1 to 64.
+ * @param sigma    Rows per sorting window: 1, or a multiple of @p chunk.
+ * @param alloc_v  Allocator for the destination matrix.
+ *
+ * @return matrix_expect_t with has_value true on success, or u.error:
+ *         - NULL_POINTER    — src is NULL
+ *         - INVALID_ARG     — chunk or sigma out of range
+ *         - LENGTH_OVERFLOW — padded storage would overflow size_t
+ *         - OUT_OF_MEMORY   — allocation failed
+ *         (errors converting src to CSR are propagated)
+ *
+ * @code{.c}
+ * matrix_expect_t r = convert_to_sell_matrix(csr, 8, 256, heap_allocator());
+ * if (r.has_value) {
+ *     matrix_multiply_vector(y, r.u.value, x, false, 0);
+ *     return_matrix(r.u.value);
+ * }
+ * @endcode
+ */
+matrix_expect_t convert_to_sell_matrix(const matrix_t*    src,
+                                       size_t             chunk,
+                                       size_t             sigma,
+                                       allocator_vtable_t alloc_v);
  
 // -------------------------------------------------------------------------------- 
  
 /**
  * @brief Transpose a matrix.
  *
- * Dense→Dense, COO→COO, CSR→CSR, and CSC→CSC are supported.
+ * Dense→Dense, COO→COO, CSR→CSR, and CSC→CSC are supported.  BSR and
+ * SELL matrices are transposed through CSR; a BSR result has the block
+ * shape mirrored and a SELL result keeps chunk and sigma.
  *
- * Wrapper: intercept specialized fast paths if desired, otherwise delegate.
+ * Dense matrices are split between threads by destination row band, so
+ * each thread is the first to touch its part of the result, and transposed
+ * in 64 x 64 tiles; 4- and 8-byte elements are moved through SIMD register
+ * transposes within each tile.  Results of 1 MiB or more whose source rows
+ * are a whole number of 64-byte lines are instead written one full line at
+ * a time with non-temporal stores.
  *
  * @param src      Matrix to transpose.  Must not be NULL.
  * @param alloc_v  Allocator for the destination matrix.
@@ -978,6 +1274,38 @@ matrix_expect_t convert_matrix_zero(const matrix_t*    src,
  */
 matrix_expect_t transpose_matrix(const matrix_t*   src,
                                  allocator_vtable_t alloc_v);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Transpose a square dense matrix in place.
+ *
+ * Tiles above the diagonal are swapped with their mirror tiles below it
+ * through one tile of scratch per thread, taken from the matrix's own
+ * allocator, using the same SIMD tile kernels as transpose_matrix().
+ *
+ * @param mat  Square dense matrix.  Must not be NULL.
+ *
+ * @return NO_ERROR on success, or:
+ *         - NULL_POINTER  — mat is NULL
+ *         - ILLEGAL_STATE — mat is not dense
+ *         - INVALID_ARG   — mat is not square
+ *         - OUT_OF_MEMORY — scratch allocation failed
+ *
+ * @code{.c}
+ * matrix_t* mat = init_dense_matrix(3, 3, FLOAT_TYPE, heap_allocator()).u.value;
+ *
+ * float v = 2.5f;
+ * set_matrix(mat, 0, 2, &v);
+ *
+ * transpose_matrix_inplace(mat);
+ *
+ * float out = 0.0f;
+ * get_matrix(mat, 2, 0, &out);   // out == 2.5f
+ *
+ * return_matrix(mat);
+ * @endcode
+ */
+error_code_t transpose_matrix_inplace(matrix_t* mat);
  
 // ================================================================================
 // Shape and compatibility queries — delegate directly, trivial cost
@@ -1904,6 +2232,262 @@ size_expect_t matrix_max(const matrix_t* mat,
 //                         void* accum,
 //                         void (*add)(void* accum, const void* element),
 //                         dtype_id_t dtype);
+// ================================================================================
+// Matrix products
+// ================================================================================
+
+/**
+ * @brief Multiply a matrix by a dense vector: y = A x, or y = A^T x.
+ *
+ * @p x and @p y are dense row or column vectors owned by the caller; @p y is
+ * overwritten.  The kernel depends on the format of @p a:
+ *
+ * - DENSE: one SIMD dot product per row of A (A x), or one SIMD axpy per
+ *   row of A into column slices of y (A^T x).
+ * - CSR: one gathered sparse dot product per row (A x), with rows split
+ *   between threads so each holds about the same number of nonzeros.
+ *   A^T x scatters and runs on one thread.
+ * - CSC: the mirror image; A^T x is the gathered, parallel case.
+ * - BSR: one SIMD block-row kernel per block row (A x), dotting each row
+ *   of each block with a contiguous slice of x, so only one column index
+ *   is read per block.  Block rows are split between threads by block
+ *   count.  A^T x scatters and runs on one thread.
+ * - SELL: one SIMD kernel per slice (A x), with each register lane working
+ *   on its own row and x gathered through the column indices.  Slices are
+ *   split between threads by stored entries.  A^T x scatters and runs on
+ *   one thread.
+ *
+ * Only FLOAT_TYPE and DOUBLE_TYPE are supported.  COO matrices should be
+ * converted to CSR first.
+ *
+ * @param y            Output vector, length a->rows (a->cols when transposed).
+ * @param a            Matrix operand.
+ * @param x            Input vector, length a->cols (a->rows when transposed).
+ * @param transpose    Multiply by A^T instead of A.
+ * @param num_threads  Worker threads, 0 for the number of online processors.
+ *                     Small products run on the calling thread only.
+ *
+ * @return NO_ERROR on success, or:
+ *         - NULL_POINTER  — any argument is NULL
+ *         - INVALID_ARG   — x or y is not dense, y aliases a or x, or a is COO
+ *         - TYPE_MISMATCH — dtypes differ or are not float / double
+ *         - SIZE_MISMATCH — x or y is not a vector of the required length
+ *
+ * @code{.c}
+ * allocator_vtable_t alloc = heap_allocator();
+ *
+ * matrix_t* a = init_dense_matrix(3, 2, DOUBLE_TYPE, alloc).u.value;
+ * matrix_t* x = init_col_vector(2, DOUBLE_TYPE, alloc).u.value;
+ * matrix_t* y = init_col_vector(3, DOUBLE_TYPE, alloc).u.value;
+ *
+ * // ... fill a and x ...
+ *
+ * error_code_t err = matrix_multiply_vector(y, a, x, false, 0);
+ *
+ * return_matrix(y);
+ * return_matrix(x);
+ * return_matrix(a);
+ * @endcode
+ */
+error_code_t matrix_multiply_vector(matrix_t*       y,
+                                    const matrix_t* a,
+                                    const matrix_t* x,
+                                    bool            transpose,
+                                    size_t          num_threads);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Compute C = A B into a caller-provided dense matrix.
+ *
+ * @p b and @p c must be dense; @p c is overwritten.  A dense @p a runs a
+ * cache-blocked GEMM: B is processed in panels sized to stay resident in L2
+ * while a SIMD microkernel updates four rows of C at a time.  A CSR @p a
+ * adds a scaled row of B into C for every stored entry.  Either way the rows
+ * of C are divided between threads (by nonzero count for CSR).  When B has a
+ * single column the product is delegated to matrix_multiply_vector().
+ *
+ * Only FLOAT_TYPE and DOUBLE_TYPE are supported.
+ *
+ * @param c            Output matrix, a->rows x b->cols.
+ * @param a            Left operand, dense or CSR.
+ * @param b            Right operand, dense.
+ * @param num_threads  Worker threads, 0 for the number of online processors.
+ *
+ * @return NO_ERROR on success, or:
+ *         - NULL_POINTER  — any argument is NULL
+ *         - INVALID_ARG   — b or c is not dense, c aliases an operand, or a
+ *                           is COO / CSC / BSR / SELL and b has more
+ *                           than one column
+ *         - TYPE_MISMATCH — dtypes differ or are not float / double
+ *         - SIZE_MISMATCH — shapes are not conformant
+ */
+error_code_t matrix_multiply_into(matrix_t*       c,
+                                  const matrix_t* a,
+                                  const matrix_t* b,
+                                  size_t          num_threads);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Compute C = A B into a newly allocated dense matrix.
+ *
+ * Allocates C with @p alloc_v (or a's allocator when alloc_v.allocate is
+ * NULL) and fills it with matrix_multiply_into().
+ *
+ * @param a            Left operand, dense, CSR or CSC.
+ * @param b            Right operand, dense (or in the same sparse format as a).
+ * @param num_threads  Worker threads, 0 for the number of online processors.
+ * @param alloc_v      Allocator for the result.
+ *
+ * When @p a and @p b are both CSR or both CSC the product stays sparse and
+ * is computed by matrix_sparse_multiply() instead.
+ *
+ * @return matrix_expect_t holding the product, or the error reported by
+ *         matrix_multiply_into(), matrix_sparse_multiply() or the allocation.
+ *
+ * @code{.c}
+ * matrix_expect_t r = matrix_multiply(a, b, 0, heap_allocator());
+ * if (r.has_value) {
+ *     // ... use r.u.value ...
+ *     return_matrix(r.u.value);
+ * }
+ * @endcode
+ */
+matrix_expect_t matrix_multiply(const matrix_t*    a,
+                                const matrix_t*    b,
+                                size_t             num_threads,
+                                allocator_vtable_t alloc_v);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Compute the sparsity structure of C = A B for sparse A and B.
+ *
+ * Both operands must be CSR, or both CSC; the result has the same format,
+ * shape a->rows x b->cols, sorted indices within every row (column) and
+ * zeroed values.  Pass it to matrix_spgemm_numeric() to fill in the values,
+ * as many times as needed while the operands keep their structure.
+ *
+ * Each output row is built Gustavson-style from the rows of B selected by
+ * the row of A, collecting distinct column indices in a per-thread
+ * accumulator: a dense array when B has at most 2^18 columns, otherwise
+ * an open-addressing hash table sized to the row's work.  Rows are split
+ * between threads by the nonzeros of A.
+ *
+ * @param a            Left operand, CSR or CSC.
+ * @param b            Right operand, same format as a.
+ * @param num_threads  Worker threads, 0 for the number of online processors.
+ * @param alloc_v      Allocator for the result (a's allocator when
+ *                     alloc_v.allocate is NULL).
+ *
+ * @return matrix_expect_t holding the structure, or:
+ *         - NULL_POINTER  — a or b is NULL
+ *         - INVALID_ARG   — a is not CSR / CSC, or b has another format
+ *         - TYPE_MISMATCH — dtypes differ
+ *         - SIZE_MISMATCH — a->cols != b->rows
+ *         - OUT_OF_MEMORY — allocation failed
+ */
+matrix_expect_t matrix_spgemm_symbolic(const matrix_t*    a,
+                                       const matrix_t*    b,
+                                       size_t             num_threads,
+                                       allocator_vtable_t alloc_v);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Fill the values of C = A B into an existing sparse structure.
+ *
+ * @p c is usually the result of matrix_spgemm_symbolic() for operands with
+ * the same structure as @p a and @p b.  Its values are overwritten and its
+ * structure is left untouched; entries of the structure the product does
+ * not reach are set to zero.
+ *
+ * Only FLOAT_TYPE and DOUBLE_TYPE are supported.
+ *
+ * @param c            Output structure, same format as a, a->rows x b->cols.
+ * @param a            Left operand, CSR or CSC.
+ * @param b            Right operand, same format as a.
+ * @param num_threads  Worker threads, 0 for the number of online processors.
+ *
+ * @return NO_ERROR on success, or:
+ *         - NULL_POINTER  — any argument is NULL
+ *         - INVALID_ARG   — formats differ or are not CSR / CSC, or c
+ *                           aliases an operand
+ *         - TYPE_MISMATCH — dtypes differ or are not float / double
+ *         - SIZE_MISMATCH — shapes are not conformant
+ *         - ILLEGAL_STATE — the product has an entry outside c's structure;
+ *                           c's values are then unspecified
+ *         - OUT_OF_MEMORY — scratch allocation failed
+ *
+ * @code{.c}
+ * matrix_expect_t s = matrix_spgemm_symbolic(a, b, 0, heap_allocator());
+ * if (s.has_value) {
+ *     for (int step = 0; step < steps; step++) {
+ *         // ... update the values of a and b, keeping their structure ...
+ *         matrix_spgemm_numeric(s.u.value, a, b, 0);
+ *     }
+ *     return_matrix(s.u.value);
+ * }
+ * @endcode
+ */
+error_code_t matrix_spgemm_numeric(matrix_t*       c,
+                                   const matrix_t* a,
+                                   const matrix_t* b,
+                                   size_t          num_threads);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Compute C = A B for sparse A and B, keeping C sparse.
+ *
+ * Runs matrix_spgemm_symbolic() followed by matrix_spgemm_numeric().
+ * Products that cancel remain in the structure as explicit zeros.
+ *
+ * @return matrix_expect_t holding the product in a's format, or the error
+ *         reported by either phase (TYPE_MISMATCH for dtypes other than
+ *         float / double).
+ */
+matrix_expect_t matrix_sparse_multiply(const matrix_t*    a,
+                                       const matrix_t*    b,
+                                       size_t             num_threads,
+                                       allocator_vtable_t alloc_v);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Compute A + B for two CSR or two CSC matrices.
+ *
+ * Each row (column) of the result is a sorted merge of the corresponding
+ * rows of A and B, so the structure is the union of theirs and the input
+ * indices must be sorted, as every CSR / CSC matrix built by this module
+ * is.  Rows are split between threads by the nonzeros of A.
+ *
+ * Only FLOAT_TYPE and DOUBLE_TYPE are supported.
+ *
+ * @param a            Left operand, CSR or CSC.
+ * @param b            Right operand, same format and shape as a.
+ * @param num_threads  Worker threads, 0 for the number of online processors.
+ * @param alloc_v      Allocator for the result (a's allocator when
+ *                     alloc_v.allocate is NULL).
+ *
+ * @return matrix_expect_t holding the sum in a's format, or:
+ *         - NULL_POINTER  — a or b is NULL
+ *         - INVALID_ARG   — formats differ or are not CSR / CSC
+ *         - TYPE_MISMATCH — dtypes differ or are not float / double
+ *         - SIZE_MISMATCH — shapes differ
+ *         - OUT_OF_MEMORY — allocation failed
+ */
+matrix_expect_t matrix_sparse_add(const matrix_t*    a,
+                                  const matrix_t*    b,
+                                  size_t             num_threads,
+                                  allocator_vtable_t alloc_v);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Compute A - B for two CSR or two CSC matrices.
+ *
+ * Identical to matrix_sparse_add() with B negated.  Entries that cancel
+ * remain in the structure as explicit zeros.
+ */
+matrix_expect_t matrix_sparse_subtract(const matrix_t*    a,
+                                       const matrix_t*    b,
+                                       size_t             num_threads,
+                                       allocator_vtable_t alloc_v);
 // ================================================================================ 
 // ================================================================================ 
 #ifdef __cplusplus
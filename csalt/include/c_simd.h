@@ -0,0 +1,120 @@
+// ================================================================================
+// ================================================================================
+// - File:    c_simd.h
+// - Purpose: Query and select the SIMD instruction set used by the library
+//            kernels (search, equality, min, string scanning).
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 16, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2026, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+#ifndef c_simd_H
+#define c_simd_H
+
+#include <stdbool.h>
+
+#include "c_error.h"
+// ================================================================================
+// ================================================================================
+#ifdef __cplusplus
+extern "C" {
+#endif
+// ================================================================================
+// ================================================================================
+
+/**
+ * @brief SIMD instruction set tiers known to the library.
+ *
+ * The x86-64 tiers are ordered from least to most capable, so a larger
+ * value always implies every smaller x86-64 tier is also usable.  SIMD_SSSE3
+ * corresponds to the simd_sse3_*.inl kernels.
+ */
+typedef enum {
+    SIMD_SCALAR = 0,   /**< Portable C loops, no vector instructions   */
+    SIMD_SSE2   = 1,   /**< x86-64 baseline                             */
+    SIMD_SSSE3  = 2,   /**< SSE3 + SSSE3                                */
+    SIMD_SSE41  = 3,   /**< SSE4.1                                      */
+    SIMD_AVX    = 4,   /**< AVX (256-bit float, 128-bit integer)        */
+    SIMD_AVX2   = 5,   /**< AVX2                                        */
+    SIMD_AVX512 = 6,   /**< AVX-512 F + BW + VL                         */
+    SIMD_NEON   = 7,   /**< AArch64 Advanced SIMD                       */
+    SIMD_SVE    = 8,   /**< AArch64 SVE                                 */
+    SIMD_SVE2   = 9    /**< AArch64 SVE2                                */
+} simd_isa_t;
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Return the instruction set the library kernels currently run on.
+ *
+ * On x86-64 GCC/Clang builds configured with CSALT_SIMD_DISPATCH (the
+ * default) every tier is compiled into the library and the best tier the
+ * host CPU and operating system support is selected the first time any
+ * kernel runs, so a single binary can be shipped to a mixed fleet.  The
+ * CSALT_SIMD_ISA environment variable ("sse2", "ssse3", "sse41", "avx",
+ * "avx2" or "avx512") caps that automatic choice; a request above what the
+ * host supports is ignored.
+ *
+ * Other builds compile exactly one tier for the target and this function
+ * reports it.
+ *
+ * @return The active tier.
+ *
+ * @code{.c}
+ * printf("csalt kernels: %s\n", simd_isa_name(simd_active_isa()));
+ * @endcode
+ */
+simd_isa_t simd_active_isa(void);
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Return a short lowercase name for a tier ("avx2", "neon", ...).
+ *
+ * @param isa  Tier to name.
+ * @return A static string; "unknown" for values outside simd_isa_t.
+ */
+const char* simd_isa_name(simd_isa_t isa);
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Report whether a tier can be selected on this host.
+ *
+ * A tier is available when it was compiled into the library and the
+ * running CPU and operating system support it.
+ *
+ * @param isa  Tier to test.
+ * @return true if simd_select_isa(isa) would succeed.
+ */
+bool simd_isa_available(simd_isa_t isa);
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Force the library kernels onto a specific tier.
+ *
+ * Intended for benchmarking and for validating the lower tiers on a modern
+ * machine.  The switch is published atomically, so kernels already running
+ * on another thread finish on the previous tier and later calls use the new
+ * one.
+ *
+ * @param isa  Tier to activate.
+ * @return NO_ERROR on success, or UNSUPPORTED if the tier is not available
+ *         (see simd_isa_available()).
+ *
+ * @code{.c}
+ * if (simd_select_isa(SIMD_SSE2) == NO_ERROR) {
+ *     run_regression_suite();
+ * }
+ * @endcode
+ */
+error_code_t simd_select_isa(simd_isa_t isa);
+// ================================================================================
+// ================================================================================
+#ifdef __cplusplus
+}
+#endif /* cplusplus */
+#endif /* c_simd_H */
+// ================================================================================
+// ================================================================================
+// eof
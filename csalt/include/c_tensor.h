@@ -73,6 +73,62 @@ typedef struct {
         error_code_t error;
     } u;
 } tensor_expect_t;
+// -------------------------------------------------------------------------------- 
+
+/* Non-owning, read-only window onto the elements of a tensor_t.  The view
+ * addresses element idx as
+ *     base->data + offset + sum(idx[i] * strides[i])
+ * so slicing, permuting and reshaping only rewrite offset, shape and
+ * strides.  The element buffer belongs to base and is never copied or
+ * freed through the view; only the view struct itself is allocated. */
+typedef struct {
+    const tensor_t*    base;        /* tensor that owns the element buffer     */
+    size_t             offset;      /* byte offset of element [0, ..., 0]      */
+    size_t             len;         /* number of addressed elements            */
+    size_t             data_size;   /* bytes per element, copied from base     */
+    dtype_id_t         dtype;       /* runtime type identity, copied from base */
+    allocator_vtable_t alloc_v;     /* allocator for the view struct only      */
+    uint8_t            ndim;        /* number of dimensions (max 255)          */
+    size_t*            shape;       /* points to meta[0]                       */
+    size_t*            strides;     /* byte strides, points to meta[ndim]      */
+    size_t             meta[];      /* FAM: shape[0..ndim-1], strides[0..ndim-1] */
+} tensor_view_t;
+// -------------------------------------------------------------------------------- 
+
+typedef struct {
+    bool has_value;
+    union {
+        tensor_view_t* value;
+        error_code_t   error;
+    } u;
+} tensor_view_expect_t;
+// -------------------------------------------------------------------------------- 
+
+/* Operation applied by reduce_tensor_axis */
+typedef enum {
+    REDUCE_SUM  = 0,     /* sum, wrapping for integer dtypes               */
+    REDUCE_MIN  = 1,     /* minimum; NaN propagates for floating dtypes    */
+    REDUCE_MAX  = 2,     /* maximum; NaN propagates for floating dtypes    */
+    REDUCE_MEAN = 3      /* arithmetic mean; integers truncate toward zero */
+} reduce_op_t;
+// -------------------------------------------------------------------------------- 
+
+/* Form of prefix sum computed by cumulative_sum_tensor */
+typedef enum {
+    SCAN_INCLUSIVE = 0,  /* out[i] = a[0] + ... + a[i]                  */
+    SCAN_EXCLUSIVE = 1   /* out[i] = a[0] + ... + a[i - 1]; out[0] = 0  */
+} scan_mode_t;
+// -------------------------------------------------------------------------------- 
+
+/* Elementwise operation applied by broadcast_tensor */
+typedef enum {
+    BINARY_ADD = 0,      /* a + b, wrapping for integer dtypes             */
+    BINARY_SUB = 1,      /* a - b, wrapping for integer dtypes             */
+    BINARY_MUL = 2,      /* a * b, wrapping for integer dtypes             */
+    BINARY_DIV = 3,      /* a / b; integers truncate toward zero           */
+    BINARY_MIN = 4,      /* min(a, b); NaN propagates for floating dtypes  */
+    BINARY_MAX = 5       /* max(a, b); NaN propagates for floating dtypes  */
+} binary_op_t;
 // ================================================================================ 
 // ================================================================================ 
 // INITIALIZATION AND TEARDOWN
@@ -863,6 +919,111 @@ error_code_t pop_at_tensor(tensor_t*   t,
                            void*       out,
                            size_t      index,
                            dtype_id_t  dtype);
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Append a contiguous run of elements to a dynamic 1-D tensor.
+ *
+ * Grows the buffer at most once, to the larger of the tiered growth size
+ * and len + count, then copies the whole run with a single memmove. When
+ * the tensor cannot grow (growth == false or no reallocate hook) only the
+ * elements that fit in the free tail are taken; the return value reports
+ * how many that was.
+ *
+ * data may point into the tensor's own buffer, so an array can be
+ * extended with a copy of itself; the source is rebased after growth.
+ *
+ * @param t      Pointer to the target tensor. Must not be NULL.
+ *               Must have mode == ARRAY_STRUCT.
+ * @param data   Pointer to count contiguous elements of t->data_size bytes.
+ *               Must not be NULL.
+ * @param count  Number of elements to append. Zero is a no-op.
+ * @param dtype  Type identifier. Must match t->dtype.
+ *
+ * @return size_expect_t holding the number of elements appended, or an
+ *         error of:
+ *         - NULL_POINTER      if t or data is NULL
+ *         - PRECONDITION_FAIL if t->mode != ARRAY_STRUCT
+ *         - TYPE_MISMATCH     if dtype != t->dtype
+ *         - LENGTH_OVERFLOW   if len + count overflows size_t
+ *         - CAPACITY_OVERFLOW if the tensor is full and cannot grow
+ *         - OUT_OF_MEMORY     if the reallocation fails
+ *
+ * @code{.c}
+ * float vals[4] = { 1.f, 2.f, 3.f, 4.f };
+ * size_expect_t r = push_back_n_tensor(t, vals, 4, FLOAT_TYPE);
+ * // r.u.value == 4, t->len increased by 4
+ * @endcode
+ */
+size_expect_t push_back_n_tensor(tensor_t*   t,
+                                 const void* data,
+                                 size_t      count,
+                                 dtype_id_t  dtype);
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Insert a contiguous run of elements at an index in a dynamic
+ *        1-D tensor.
+ *
+ * Grows the buffer at most once, shifts the tail [index, len) toward the
+ * back with one memmove, and copies the run into the gap with one memcpy.
+ * When the tensor cannot grow, only the elements that fit are inserted.
+ * Valid index range is [0, len]; index == len appends.
+ *
+ * @param t      Pointer to the target tensor. Must not be NULL.
+ *               Must have mode == ARRAY_STRUCT.
+ * @param data   Pointer to count contiguous elements. Must not be NULL and
+ *               must not overlap the tensor's buffer.
+ * @param count  Number of elements to insert. Zero is a no-op.
+ * @param index  Position of the first inserted element. Must be <= t->len.
+ * @param dtype  Type identifier. Must match t->dtype.
+ *
+ * @return size_expect_t holding the number of elements inserted, or an
+ *         error of:
+ *         - NULL_POINTER      if t or data is NULL
+ *         - PRECONDITION_FAIL if t->mode != ARRAY_STRUCT
+ *         - TYPE_MISMATCH     if dtype != t->dtype
+ *         - OUT_OF_BOUNDS     if index > t->len
+ *         - INVALID_ARG       if data overlaps the tensor's buffer
+ *         - LENGTH_OVERFLOW   if len + count overflows size_t
+ *         - CAPACITY_OVERFLOW if the tensor is full and cannot grow
+ *         - OUT_OF_MEMORY     if the reallocation fails
+ */
+size_expect_t push_at_n_tensor(tensor_t*   t,
+                               const void* data,
+                               size_t      count,
+                               size_t      index,
+                               dtype_id_t  dtype);
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Remove up to count elements from the back of a dynamic 1-D tensor.
+ *
+ * Removes min(count, len) elements. When out is non-NULL the removed
+ * elements are copied into it in their original order with one memcpy,
+ * so out[0] is the element that was at index len - taken.
+ *
+ * @param t      Pointer to the target tensor. Must not be NULL.
+ *               Must have mode == ARRAY_STRUCT.
+ * @param out    Caller-provided buffer of at least count * t->data_size
+ *               bytes, or NULL to discard the removed elements.
+ * @param count  Maximum number of elements to remove. Zero is a no-op.
+ * @param dtype  Type identifier. Must match t->dtype.
+ *
+ * @return size_expect_t holding the number of elements removed, or an
+ *         error of:
+ *         - NULL_POINTER      if t is NULL
+ *         - PRECONDITION_FAIL if t->mode != ARRAY_STRUCT
+ *         - TYPE_MISMATCH     if dtype != t->dtype
+ *         - EMPTY             if t->len == 0 and count > 0
+ */
+size_expect_t pop_back_n_tensor(tensor_t*  t,
+                                void*      out,
+                                size_t     count,
+                                dtype_id_t dtype);
 // ================================================================================ 
 // ================================================================================ 
 // RETRIEVE DATA
@@ -994,6 +1155,679 @@ error_code_t get_tensor_nd_index(const tensor_t* t,
 error_code_t sort_tensor(tensor_t* array,
                          int    (*cmp)(const void*, const void*),
                          direction_t dir);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Sort the populated elements of a tensor in place using several
+ *        threads.
+ *
+ * Intended for arrays of millions of elements, where sort_tensor is bound
+ * to a single core.  The elements are split into one run per thread, each
+ * run is merge sorted concurrently, and the runs are then merged pairwise
+ * in log2(threads) rounds with every thread writing an equal share of each
+ * round's output.  The result is a stable sort: elements that compare
+ * equal keep their original relative order, including under REVERSE.
+ * Runtime is O(n log n) for every input distribution, including heavy
+ * duplication.
+ *
+ * The sort covers the same flat element sequence as sort_tensor, follows
+ * the same comparator convention and honours dir the same way.  The
+ * comparator is called concurrently from several threads, so it must not
+ * modify shared state.
+ *
+ * A buffer of len * data_size bytes is taken from scratch for the duration
+ * of the call and returned before it completes.  The thread count is
+ * capped at 64 and so that each thread handles at least 4096 elements;
+ * small inputs therefore run on the calling thread alone.  If a worker
+ * thread cannot be created, its share of the work runs on the calling
+ * thread and the result is unaffected.
+ *
+ * @param t            Pointer to the tensor to sort. Must not be NULL.
+ * @param cmp          Comparator following the qsort(3) convention. Must
+ *                     not be NULL.
+ * @param dir          FORWARD for ascending order, REVERSE for descending.
+ * @param num_threads  Maximum number of threads, including the caller; 0
+ *                     uses the number of online processors.
+ * @param scratch      Allocator for the temporary buffer. May differ from
+ *                     the tensor's own allocator.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if t, cmp, or scratch.allocate / return_element
+ *                         is NULL
+ *         - EMPTY         if t->len < 2 (tensor is left untouched)
+ *         - OUT_OF_MEMORY if the scratch buffer cannot be allocated
+ *                         (tensor is left untouched)
+ *
+ * @code
+ * // Sort 100 million int64 values across all cores, drawing the scratch
+ * // buffer from the heap
+ * error_code_t err = parallel_sort_tensor(t, cmp_int64, FORWARD, 0u,
+ *                                         heap_allocator());
+ * @endcode
+ */
+error_code_t parallel_sort_tensor(tensor_t*          t,
+                                  int              (*cmp)(const void*, const void*),
+                                  direction_t        dir,
+                                  size_t             num_threads,
+                                  allocator_vtable_t scratch);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Sort the populated elements of a fixed-width numeric tensor in
+ *        place with an LSD radix sort.
+ *
+ * No comparator is called.  Each element is mapped onto an unsigned key
+ * whose byte order matches its numeric order (signed integers flip the
+ * sign bit; float and double flip every bit of negative values and only
+ * the sign bit of the rest), the keys are distributed one byte per pass,
+ * and the mapping is undone.  All byte histograms are built in a single
+ * read of the data and any pass whose byte is identical across every
+ * element is skipped, so small value ranges in wide types cost only a
+ * pass or two.  Runtime is O(n * data_size) regardless of input order.
+ *
+ * The sort is stable, including under REVERSE.  For floating point data,
+ * -0.0 orders before +0.0 and NaNs collect at the ends according to their
+ * sign bit (positive NaNs after +inf in FORWARD order).
+ *
+ * Supported dtypes are INT8, UINT8, INT16, UINT16, INT32, UINT32, INT64,
+ * UINT64, SIZE_T, FLOAT and DOUBLE.  Use sort_tensor for anything else.
+ *
+ * @param t              Pointer to the tensor to sort. Must not be NULL.
+ * @param dir            FORWARD for ascending order, REVERSE for descending.
+ * @param scratch        Buffer of at least len * data_size bytes, aligned
+ *                       to data_size, reused across calls by the caller.
+ *                       If NULL, a buffer is borrowed from the tensor's own
+ *                       allocator for the duration of the call.
+ * @param scratch_bytes  Size of scratch in bytes. Ignored when scratch is
+ *                       NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER    if t is NULL
+ *         - TYPE_MISMATCH   if t->dtype is not one of the supported types
+ *         - EMPTY           if t->len < 2 (tensor is left untouched)
+ *         - SIZE_MISMATCH   if scratch_bytes < len * data_size
+ *         - ALIGNMENT_ERROR if scratch is not aligned to data_size
+ *         - OUT_OF_MEMORY   if scratch is NULL and the tensor's allocator
+ *                           cannot supply a buffer
+ *
+ * @code
+ * // Sort many int32 arrays of up to 1M elements with one reused buffer
+ * static int32_t scratch[1u << 20];
+ * error_code_t err = radix_sort_tensor(t, FORWARD, scratch, sizeof(scratch));
+ *
+ * // Descending order, borrowing scratch from the tensor's allocator
+ * err = radix_sort_tensor(t, REVERSE, NULL, 0u);
+ * @endcode
+ */
+error_code_t radix_sort_tensor(tensor_t*   t,
+                               direction_t dir,
+                               void*       scratch,
+                               size_t      scratch_bytes);
+// ================================================================================ 
+// ================================================================================ 
+// ELEMENTWISE OPERATIONS
+
+/**
+ * @brief Validate the operands of an elementwise operation and size the
+ *        destination.
+ *
+ * Shared by the typed arithmetic functions (add_float_tensor,
+ * clamp_int32_tensor, ...), which call it before handing the flat buffers
+ * to a SIMD kernel.  Operands are matched on their flat element count,
+ * i.e. len; shape is not consulted.
+ *
+ * The destination must either already hold a->len elements, or be an
+ * ARRAY_STRUCT tensor, in which case its len is set to a->len and its
+ * previous contents are to be overwritten.  A dynamic array without the
+ * capacity is grown first, the same way a bulk append grows it; a fixed
+ * array must already have the capacity.  out may be the same tensor as a
+ * or b, which makes the operation in place, but its buffer must not
+ * otherwise overlap either input.
+ *
+ * @param out  Destination tensor. Must not be NULL.
+ * @param a    First operand. Must not be NULL.
+ * @param b    Second operand, or NULL for unary operations.
+ *
+ * @return NO_ERROR if the kernel may run over a->len elements, or one of:
+ *         - NULL_POINTER  if out or a is NULL
+ *         - TYPE_MISMATCH if the dtypes of out, a and b differ
+ *         - EMPTY         if a->len == 0
+ *         - SIZE_MISMATCH if b->len != a->len, or out can neither hold
+ *                         a->len elements nor be resized to them
+ *         - OUT_OF_MEMORY if growing a dynamic out fails
+ *         - INVALID_ARG   if out partially overlaps a or b
+ */
+error_code_t prepare_elementwise_tensor(tensor_t*       out,
+                                        const tensor_t* a,
+                                        const tensor_t* b);
+// ================================================================================ 
+// ================================================================================ 
+// TENSOR VIEWS
+
+/**
+ * @brief Create a view covering every live element of a tensor.
+ *
+ * The view shares t's data buffer — no element is copied.  A TENSOR_STRUCT
+ * tensor yields a view with the same shape and strides; an ARRAY_STRUCT
+ * tensor yields a 1-D view of its len populated elements.  The view reads
+ * t->data at access time, so it survives a reallocation of a growing
+ * array, but it must not outlive t and must not address elements that
+ * have since been popped.
+ *
+ * Release the view with return_tensor_view; the tensor itself is
+ * unaffected.
+ *
+ * @param t        Tensor to view. Must not be NULL.
+ * @param alloc_v  Allocator for the view struct. If alloc_v.allocate is
+ *                 NULL the allocator is inherited from t.
+ *
+ * @return tensor_view_expect_t with has_value true on success.  On failure,
+ *         has_value is false and u.error is one of:
+ *         - NULL_POINTER if t is NULL
+ *         - EMPTY        if t has no live elements
+ *         - BAD_ALLOC    if the view struct cannot be allocated
+ *
+ * @code
+ * tensor_view_expect_t r = init_tensor_view(t, (allocator_vtable_t){ 0 });
+ * if (r.has_value) {
+ *     tensor_view_t* v = r.u.value;
+ *     // ... slice, permute, read ...
+ *     return_tensor_view(v);
+ * }
+ * @endcode
+ */
+tensor_view_expect_t init_tensor_view(const tensor_t*    t,
+                                      allocator_vtable_t alloc_v);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Release a view struct.  The viewed tensor is not touched.
+ *
+ * @param v  View to release. NULL is a no-op.
+ */
+void return_tensor_view(tensor_view_t* v);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Create a view restricted to [start, end) with the given step along
+ *        one axis.
+ *
+ * The result has the same ndim as v.  Along axis it holds
+ * ceil((end - start) / step) elements, starting at start; all other axes
+ * are unchanged.  Slicing is O(ndim) and copies no elements.  The new view
+ * uses v's allocator and is independent of v, which may be released first.
+ *
+ * @param v      Source view. Must not be NULL.
+ * @param axis   Axis to slice. Must be < v->ndim.
+ * @param start  First index kept (inclusive).
+ * @param end    One past the last index considered. Must be <= shape[axis].
+ * @param step   Distance between kept indices. Must be > 0.
+ *
+ * @return tensor_view_expect_t with has_value true on success, otherwise
+ *         u.error is one of:
+ *         - NULL_POINTER  if v is NULL
+ *         - OUT_OF_BOUNDS if axis >= v->ndim or end > v->shape[axis]
+ *         - INVALID_ARG   if start >= end or step == 0
+ *         - BAD_ALLOC     if the view struct cannot be allocated
+ *
+ * @code
+ * // Every second column of rows 1..3 of a 4 x 6 matrix view m
+ * tensor_view_expect_t rows = slice_tensor_view(m, 0u, 1u, 4u, 1u);
+ * tensor_view_expect_t cols = slice_tensor_view(rows.u.value, 1u, 0u, 6u, 2u);
+ * // cols.u.value has shape [3, 3]
+ * @endcode
+ */
+tensor_view_expect_t slice_tensor_view(const tensor_view_t* v,
+                                       uint8_t              axis,
+                                       size_t               start,
+                                       size_t               end,
+                                       size_t               step);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Create a view with the axes of v reordered.
+ *
+ * Axis i of the result is axis axes[i] of v.  Only shape and strides are
+ * permuted; no element moves.  The new view uses v's allocator.
+ *
+ * @param v     Source view. Must not be NULL.
+ * @param axes  Permutation of 0 .. v->ndim - 1. Must not be NULL.
+ *
+ * @return tensor_view_expect_t with has_value true on success, otherwise
+ *         u.error is one of:
+ *         - NULL_POINTER if v or axes is NULL
+ *         - INVALID_ARG  if axes is not a permutation of the axes of v
+ *         - BAD_ALLOC    if the view struct cannot be allocated
+ *
+ * @code
+ * // NCHW -> NHWC without copying
+ * const uint8_t nhwc[] = { 0u, 2u, 3u, 1u };
+ * tensor_view_expect_t r = permute_tensor_view(v, nhwc);
+ * @endcode
+ */
+tensor_view_expect_t permute_tensor_view(const tensor_view_t* v,
+                                         const uint8_t*       axes);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Create a view with the order of all axes reversed.
+ *
+ * Equivalent to permute_tensor_view with axes ndim - 1, ..., 0; for a
+ * 2-D view this is the matrix transpose.
+ *
+ * @param v  Source view. Must not be NULL.
+ *
+ * @return tensor_view_expect_t with has_value true on success, otherwise
+ *         u.error is NULL_POINTER or BAD_ALLOC.
+ */
+tensor_view_expect_t transpose_tensor_view(const tensor_view_t* v);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Create a view of the same elements with a different shape.
+ *
+ * Elements are taken in row-major order of v.  Any contiguous view can
+ * be reshaped freely.  A strided view can be reshaped only when every
+ * group of axes being merged or split is itself laid out contiguously
+ * relative to one another (for example, a column slice can be split along
+ * its rows but a transposed matrix cannot be flattened).  When that is
+ * not possible ILLEGAL_STATE is returned and the caller should
+ * materialize_tensor_view first.
+ *
+ * @param v      Source view. Must not be NULL.
+ * @param ndim   Number of dimensions of the result. Must be > 0.
+ * @param shape  ndim dimension sizes, each > 0, whose product equals
+ *               v->len. Must not be NULL.
+ *
+ * @return tensor_view_expect_t with has_value true on success, otherwise
+ *         u.error is one of:
+ *         - NULL_POINTER  if v or shape is NULL
+ *         - INVALID_ARG   if ndim == 0 or any shape[i] == 0
+ *         - SIZE_MISMATCH if the product of shape differs from v->len
+ *         - ILLEGAL_STATE if the strides of v cannot express the new shape
+ *         - BAD_ALLOC     if the view struct cannot be allocated
+ *
+ * @code
+ * const size_t shape[] = { 2u, 3u, 4u };
+ * tensor_view_expect_t r = reshape_tensor_view(flat24, 3u, shape);
+ * @endcode
+ */
+tensor_view_expect_t reshape_tensor_view(const tensor_view_t* v,
+                                         uint8_t              ndim,
+                                         const size_t*        shape);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Report whether a view addresses one dense row-major block.
+ *
+ * Axes of extent 1 are ignored.  A contiguous view can be read with a
+ * single memcpy from base->data + offset.
+ *
+ * @param v  View to inspect.
+ *
+ * @return true if v is contiguous, false if not or if v is NULL.
+ */
+bool is_tensor_view_contiguous(const tensor_view_t* v);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Copy one element out of a view by N-dimensional index.
+ *
+ * The view counterpart of get_tensor_nd_index: the index is resolved
+ * through the view's own offset and strides into the base tensor's
+ * buffer.
+ *
+ * @param v      Source view. Must not be NULL.
+ * @param idx    Array of v->ndim indices, idx[i] < v->shape[i]. Must not
+ *               be NULL.
+ * @param out    Buffer of at least v->data_size bytes. Must not be NULL.
+ * @param dtype  Type identifier. Must match v->dtype.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if v, idx or out is NULL
+ *         - TYPE_MISMATCH if dtype != v->dtype
+ *         - OUT_OF_BOUNDS if any idx[i] >= v->shape[i]
+ */
+error_code_t get_tensor_view_nd_index(const tensor_view_t* v,
+                                      const size_t*        idx,
+                                      void*                out,
+                                      dtype_id_t           dtype);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Copy the elements of a view into a new, owning TENSOR_STRUCT
+ *        tensor.
+ *
+ * The result has the view's shape with fresh C-order strides and holds
+ * the elements in row-major order of the view.  Contiguous views are
+ * copied with a single memcpy, otherwise the innermost axis is copied as
+ * one run when its elements are adjacent.  This is the only view
+ * operation that touches element data.
+ *
+ * @param v        Source view. Must not be NULL.
+ * @param alloc_v  Allocator for the new tensor. If alloc_v.allocate is
+ *                 NULL the allocator of the viewed tensor is used.
+ *
+ * @return tensor_expect_t with has_value true on success; on failure
+ *         u.error is NULL_POINTER if v is NULL or any error reported by
+ *         init_tensor.
+ *
+ * @code
+ * tensor_view_expect_t t = transpose_tensor_view(m);
+ * tensor_expect_t     mt = materialize_tensor_view(t.u.value,
+ *                                                 (allocator_vtable_t){ 0 });
+ * @endcode
+ */
+tensor_expect_t materialize_tensor_view(const tensor_view_t* v,
+                                        allocator_vtable_t   alloc_v);
+// ================================================================================ 
+// ================================================================================ 
+// AXIS REDUCTIONS
+
+/**
+ * @brief Reduce a tensor along one axis into a new tensor.
+ *
+ * The result has t's dtype and t's shape with the reduced axis removed.
+ * Reducing a 1-D tensor (or an ARRAY_STRUCT tensor, which is treated as
+ * 1-D over its len live elements) yields a tensor of shape {1}.
+ *
+ * Reducing the last axis runs the SIMD reduction kernels over each
+ * contiguous row.  Any other axis is folded one strip of the output at a
+ * time: the strip is combined with the matching strip of every slice
+ * along the axis before moving on, so the accumulator stays in cache and
+ * every inner loop is a contiguous SIMD elementwise kernel.
+ *
+ * Integer sums wrap like add_int32_tensor and friends.  Integer means are
+ * accumulated in 64 bits and truncated toward zero; a 64-bit dtype whose
+ * sum overflows reports NUMERIC_OVERFLOW.  Floating min and max propagate
+ * NaN; last-axis floating sums are pairwise, other axes accumulate in
+ * order.
+ *
+ * Supported dtypes are INT8, UINT8, INT16, UINT16, INT32, UINT32, INT64,
+ * UINT64, FLOAT, DOUBLE and LDOUBLE.
+ *
+ * @param t        Tensor to reduce. Must not be NULL.
+ * @param axis     Axis to reduce, 0 <= axis < t->ndim.
+ * @param op       REDUCE_SUM, REDUCE_MIN, REDUCE_MAX or REDUCE_MEAN.
+ * @param alloc_v  Allocator for the result. If alloc_v.allocate is NULL
+ *                 the allocator of t is used.
+ *
+ * @return tensor_expect_t with has_value true on success.  On failure,
+ *         has_value is false and u.error is one of:
+ *         - NULL_POINTER     if t is NULL
+ *         - EMPTY            if t has no live elements
+ *         - TYPE_MISMATCH    if t->dtype is not supported
+ *         - INVALID_ARG      if op is not a reduce_op_t value
+ *         - OUT_OF_BOUNDS    if axis >= t->ndim
+ *         - NUMERIC_OVERFLOW if a 64-bit integer mean overflows
+ *         - any error reported by init_tensor
+ *
+ * @code
+ * // Column sums of a 3 x 4 matrix: shape {3, 4} -> {4}
+ * tensor_expect_t r = reduce_tensor_axis(m, 0u, REDUCE_SUM,
+ *                                        (allocator_vtable_t){ 0 });
+ * if (r.has_value) {
+ *     // ...
+ *     return_tensor(r.u.value);
+ * }
+ * @endcode
+ */
+tensor_expect_t reduce_tensor_axis(const tensor_t*    t,
+                                   uint8_t            axis,
+                                   reduce_op_t        op,
+                                   allocator_vtable_t alloc_v);
+// ================================================================================ 
+// ================================================================================ 
+// PREFIX SUMS
+
+/**
+ * @brief Running sums of the elements of a, written to out.
+ *
+ * Scans the flat element sequence (len elements in row-major order, as
+ * sort_tensor sees it).  SCAN_INCLUSIVE gives out[i] = a[0] + ... + a[i];
+ * SCAN_EXCLUSIVE gives out[i] = a[0] + ... + a[i - 1] with out[0] = 0, the
+ * form used to turn per-row counts into CSR row offsets.  out follows the
+ * operand and aliasing rules of prepare_elementwise_tensor, so out may be
+ * a for an in-place scan.
+ *
+ * Each thread's block is scanned with the SIMD kernel of the active tier,
+ * which forms the prefix sums of a vector in registers with log2(lanes)
+ * shifted adds and carries the running total between vectors.  With more
+ * than one thread the scan takes two passes: every thread first sums its
+ * block, the block totals are scanned on the calling thread to give each
+ * block its starting offset, and every thread then scans its block from
+ * that offset.  Input is read twice and output written once.
+ *
+ * Integer sums wrap modulo 2^bits of the dtype, signed types included.
+ * Floating sums are reassociated by the vector and block structure, so
+ * they may differ from a serial left-to-right scan in the last bits.
+ * LDOUBLE is scanned with a plain loop.
+ *
+ * The thread count is capped at 64 and so that each thread handles at
+ * least 65536 elements.  If a worker thread cannot be created, its block
+ * runs on the calling thread and the result is unaffected.
+ *
+ * Supported dtypes are INT8, UINT8, INT16, UINT16, INT32, UINT32, INT64,
+ * UINT64, FLOAT, DOUBLE and LDOUBLE.
+ *
+ * @param out          Destination tensor. Must not be NULL.
+ * @param a            Source tensor. Must not be NULL.
+ * @param mode         SCAN_INCLUSIVE or SCAN_EXCLUSIVE.
+ * @param num_threads  Maximum number of threads, including the caller; 0
+ *                     uses the number of online processors.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if out or a is NULL
+ *         - INVALID_ARG   if mode is not a scan_mode_t value, or out
+ *                         partially overlaps a
+ *         - TYPE_MISMATCH if the dtype is not supported or out and a differ
+ *         - EMPTY         if a holds no elements
+ *         - SIZE_MISMATCH if out can neither hold a->len elements nor be
+ *                         resized to them
+ *
+ * @code
+ * // CSR row offsets from 100 million per-row counts, on every core
+ * error_code_t err = cumulative_sum_tensor(row_ptr, counts, SCAN_EXCLUSIVE, 0u);
+ * @endcode
+ */
+error_code_t cumulative_sum_tensor(tensor_t*       out,
+                                   const tensor_t* a,
+                                   scan_mode_t     mode,
+                                   size_t          num_threads);
+// ================================================================================ 
+// ================================================================================ 
+// BROADCASTING
+
+/**
+ * @brief Compute the shape two tensors broadcast to.
+ *
+ * Shapes are aligned on their last axis, NumPy style.  Each pair of
+ * aligned dimensions must be equal or one of them must be 1, and the
+ * result takes the larger; the shorter shape is padded on the left with
+ * 1s.  An ARRAY_STRUCT tensor has the 1-D shape {len}.
+ *
+ * @param a      First operand. Must not be NULL.
+ * @param b      Second operand. Must not be NULL.
+ * @param shape  Receives the broadcast shape; must have room for
+ *               max(a->ndim, b->ndim) entries. Must not be NULL.
+ * @param ndim   Receives the number of dimensions written to shape.
+ *               Must not be NULL.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if any argument is NULL
+ *         - EMPTY         if a or b holds no elements
+ *         - SIZE_MISMATCH if an aligned pair of dimensions differ and
+ *                         neither is 1
+ *
+ * @code
+ * // {4, 1} against {3} broadcasts to {4, 3}
+ * size_t  shape[2];
+ * uint8_t ndim;
+ * error_code_t err = broadcast_tensor_shape(col, row, shape, &ndim);
+ * @endcode
+ */
+error_code_t broadcast_tensor_shape(const tensor_t* a,
+                                    const tensor_t* b,
+                                    size_t*         shape,
+                                    uint8_t*        ndim);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Apply a binary operation to two tensors of broadcast-compatible
+ *        shapes.
+ *
+ * out[i] = a[i'] op b[i''], where i' and i'' are i with every axis along
+ * which that operand has extent 1 pinned to 0.  A broadcast axis is read
+ * through a zero stride, so neither operand is expanded in memory: a
+ * {N, 1} column against a {1, M} row reads N + M elements and writes N * M.
+ *
+ * Axes of extent 1 are dropped and neighbouring axes that both operands
+ * traverse contiguously are merged, so the work reduces to a loop over
+ * rows of the innermost merged axis.  Each row runs a SIMD elementwise
+ * kernel of the active tier: directly when both operands are contiguous
+ * along it, or against a splat of the repeated scalar, built once per row
+ * in a small stack buffer, when one of them is broadcast.  Equal shapes
+ * collapse to one flat kernel call.
+ *
+ * out must have exactly the broadcast shape (see broadcast_tensor_shape),
+ * except that when the result is 1-D an ARRAY_STRUCT out with enough
+ * capacity is resized to it.  out may be a or b when that operand already
+ * has the full shape, but must not otherwise overlap either input.
+ *
+ * Integer add, sub and mul wrap, integer division truncates toward zero,
+ * and the most negative value divided by -1 wraps to itself.  LDOUBLE runs
+ * plain loops with the same semantics.
+ *
+ * Supported dtypes are INT8, UINT8, INT16, UINT16, INT32, UINT32, INT64,
+ * UINT64, FLOAT, DOUBLE and LDOUBLE.
+ *
+ * @param out  Destination tensor. Must not be NULL.
+ * @param a    Left operand. Must not be NULL.
+ * @param b    Right operand. Must not be NULL.
+ * @param op   One of the binary_op_t values.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER  if out, a or b is NULL
+ *         - INVALID_ARG   if op is not a binary_op_t value, or out
+ *                         partially overlaps a or b
+ *         - TYPE_MISMATCH if the dtype is not supported or out, a and b
+ *                         differ
+ *         - EMPTY         if a or b holds no elements
+ *         - SIZE_MISMATCH if a and b do not broadcast, or out does not
+ *                         have the broadcast shape
+ *         - DIV_BY_ZERO   if op is BINARY_DIV, the dtype is an integer and
+ *                         b holds a zero; out is not written
+ *
+ * @code
+ * // Outer sum of a {N, 1} column and a {1, M} row into an {N, M} matrix
+ * error_code_t err = broadcast_tensor(mat, col, row, BINARY_ADD);
+ * @endcode
+ */
+error_code_t broadcast_tensor(tensor_t*       out,
+                              const tensor_t* a,
+                              const tensor_t* b,
+                              binary_op_t     op);
+// ================================================================================ 
+// ================================================================================ 
+// FILE STORAGE
+
+/* Data alignment used by write_tensor_file when none is requested, and the
+ * largest it accepts; the mapping itself always starts on a page boundary */
+#define TENSOR_FILE_ALIGNMENT     64u
+#define TENSOR_FILE_MAX_ALIGNMENT 4096u
+
+/**
+ * @brief Write a tensor to a file that map_tensor_file can load in place.
+ *
+ * The file holds a fixed header, the shape and byte strides, zero padding
+ * up to the next multiple of alignment, and then the live elements exactly
+ * as they sit in t->data.  The element buffer is written with a single
+ * fwrite straight from the tensor, so no staging copy is made.  An
+ * ARRAY_STRUCT tensor is stored as the 1-D tensor of its len live
+ * elements.  An existing file at path is replaced; on failure any partial
+ * file is removed.
+ *
+ * Layout, in host byte order:
+ *   - 8 bytes:  magic "CSALTTNS"
+ *   - uint32:   format version (1)
+ *   - uint32:   byte-order mark 0x01020304
+ *   - uint32:   dtype_id_t
+ *   - uint8:    ndim, then 3 zero bytes
+ *   - uint64:   data_size, len, alignment, data_offset
+ *   - uint64:   shape[0..ndim-1], then strides[0..ndim-1] in bytes
+ *   - zero padding to data_offset, a multiple of alignment
+ *   - len * data_size bytes of element data
+ *
+ * @param t          Tensor to write. Must not be NULL.
+ * @param path       Destination file name. Must not be NULL.
+ * @param alignment  Alignment of the element data within the file, a power
+ *                   of two no larger than TENSOR_FILE_MAX_ALIGNMENT; 0
+ *                   selects TENSOR_FILE_ALIGNMENT.
+ *
+ * @return NO_ERROR on success, or one of:
+ *         - NULL_POINTER if t or path is NULL
+ *         - EMPTY        if t holds no elements
+ *         - INVALID_ARG  if alignment is not a power of two or is larger
+ *                        than TENSOR_FILE_MAX_ALIGNMENT
+ *         - FILE_OPEN    if path cannot be created
+ *         - FILE_WRITE   if any write or the final close fails
+ *
+ * @code
+ * error_code_t err = write_tensor_file(weights, "weights.tns", 0u);
+ * @endcode
+ */
+error_code_t write_tensor_file(const tensor_t* t,
+                               const char*     path,
+                               size_t          alignment);
+// -------------------------------------------------------------------------------- 
+
+/**
+ * @brief Load a file written by write_tensor_file by mapping it into memory.
+ *
+ * The file is mapped copy-on-write and the returned tensor's data points
+ * straight into the mapping, so loading costs one mmap and a header check
+ * however large the tensor is; pages are read from disk as they are first
+ * touched.  The tensor is a TENSOR_STRUCT with the stored dtype and shape.
+ *
+ * In-place operations such as sort_tensor or an elementwise op with out
+ * == t work on the mapped tensor; each page they write is copied privately,
+ * so the file itself is never modified.  Functions that would resize the
+ * tensor fail.  alloc_v is wrapped so that the mapping lives until the tensor and
+ * every block later allocated through its alloc_v (for example by
+ * copy_tensor with a NULL allocator) have been returned; return_tensor
+ * unmaps the file once that happens.  The file may be closed, renamed or
+ * unlinked while it is mapped, but must not be truncated.
+ *
+ * @param path     File to load. Must not be NULL.
+ * @param alloc_v  Allocator for the tensor header and bookkeeping.
+ *                 alloc_v.allocate and alloc_v.return_element must not be
+ *                 NULL.
+ *
+ * @return tensor_expect_t with has_value true on success.  On failure,
+ *         has_value is false and u.error is one of:
+ *         - NULL_POINTER     if path, alloc_v.allocate or
+ *                            alloc_v.return_element is NULL
+ *         - FILE_OPEN        if path cannot be opened
+ *         - FILE_READ        if the file cannot be inspected or mapped
+ *         - FORMAT_INVALID   if the file is not a tensor file, is
+ *                            truncated, or its header is inconsistent
+ *         - VERSION_MISMATCH if the file was written by a different format
+ *                            version or with the other byte order
+ *         - TYPE_MISMATCH    if the stored dtype is not registered or its
+ *                            size differs from the registered one
+ *         - BAD_ALLOC        if the header or bookkeeping cannot be
+ *                            allocated
+ *
+ * @code
+ * tensor_expect_t r = map_tensor_file("weights.tns", heap_allocator());
+ * if (r.has_value) {
+ *     // ... read r.u.value ...
+ *     return_tensor(r.u.value);   // unmaps the file
+ * }
+ * @endcode
+ */
+tensor_expect_t map_tensor_file(const char*        path,
+                                allocator_vtable_t alloc_v);
 // ================================================================================ 
 // ================================================================================ 
 #ifdef __cplusplus
@@ -5,8 +5,8 @@
 #ifndef CSALT_SIMD_AVX2_CHAR_INL
 #define CSALT_SIMD_AVX2_CHAR_INL
 
-#if !defined(__AVX512F__) || !defined(__AVX512BW__)
-  #error "simd_avx512_char.inl requires __AVX512F__ and __AVX512BW__"
+#if !defined(__AVX2__)
+  #error "simd_avx2_char.inl requires __AVX2__"
 #endif
 
 #include <stddef.h>
@@ -313,7 +313,7 @@ static inline __m256i _ascii_range_mask(__m256i x, __m256i lo, __m256i hi)
     return _mm256_and_si256(ge_lo, le_hi);
 }
 
-void simd_ascii_upper_u8(uint8_t* p, size_t n)
+static inline void simd_ascii_upper_u8(uint8_t* p, size_t n)
 {
     if ((p == NULL) || (n == 0u)) return;
 
@@ -336,7 +336,7 @@ void simd_ascii_upper_u8(uint8_t* p, size_t n)
     }
 }
 
-void simd_ascii_lower_u8(uint8_t* p, size_t n)
+static inline void simd_ascii_lower_u8(uint8_t* p, size_t n)
 {
     if ((p == NULL) || (n == 0u)) return;
 
@@ -78,6 +78,123 @@ static inline error_code_t simd_min_int16(const int16_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int16(int16_t*       out,
+                             const int16_t* a,
+                             int16_t        lo,
+                             int16_t        hi,
+                             size_t         len) {
+    __m256i const vlo = _mm256_set1_epi16((short)lo);
+    __m256i const vhi = _mm256_set1_epi16((short)hi);
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        x = _mm256_max_epi16(vlo, _mm256_min_epi16(x, vhi));
+        _mm256_storeu_si256((__m256i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int16(int16_t*       out,
+                           const int16_t* a,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_abs_epi16(x));
+    }
+    for (; i < len; i++)
+        out[i] = (int16_t)(a[i] < 0 ? -a[i] : a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int16(const int16_t* data,
+                                   size_t         len,
+                                   int16_t*       out) {
+    int16_t cur = *out;   /* caller seeds with INT16_MIN */
+    size_t  i   = 0u;
+
+    __m256i vmax = _mm256_set1_epi16((short)cur);
+    for (; i + 16u <= len; i += 16u) {
+        vmax = _mm256_max_epi16(vmax, _mm256_loadu_si256((const __m256i*)(data + i)));
+    }
+
+    int16_t lanes[16];
+    _mm256_storeu_si256((__m256i*)lanes, vmax);
+    for (size_t k = 0u; k < 16u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int16(const int16_t* data,
+                              size_t         len) {
+    __m256i const zero = _mm256_setzero_si256();
+    __m256i const ones = _mm256_set1_epi16(1);
+    __m256i acc        = zero;
+    size_t  i          = 0u;
+
+    /* madd against ones sums 16-bit pairs into 32-bit lanes, which are
+     * then sign-extended into the 64-bit accumulator */
+    for (; i + 16u <= len; i += 16u) {
+        __m256i x = _mm256_madd_epi16(_mm256_loadu_si256((const __m256i*)(data + i)), ones);
+        __m256i s = _mm256_srai_epi32(x, 31);
+        acc = _mm256_add_epi64(acc, _mm256_unpacklo_epi32(x, s));
+        acc = _mm256_add_epi64(acc, _mm256_unpackhi_epi32(x, s));
+    }
+
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+    int64_t sum = 0;
+    for (size_t k = 0u; k < 4u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int16(int16_t*       out,
+                               const int16_t* a,
+                               const int16_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_min_epi16(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int16(int16_t*       out,
+                               const int16_t* a,
+                               const int16_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_max_epi16(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_AVX2_MIN_INT16_INL */
 // ================================================================================
@@ -79,6 +79,121 @@ static inline error_code_t simd_min_int32(const int32_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int32(int32_t*       out,
+                             const int32_t* a,
+                             int32_t        lo,
+                             int32_t        hi,
+                             size_t         len) {
+    __m256i const vlo = _mm256_set1_epi32((int)lo);
+    __m256i const vhi = _mm256_set1_epi32((int)hi);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        x = _mm256_max_epi32(vlo, _mm256_min_epi32(x, vhi));
+        _mm256_storeu_si256((__m256i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int32(int32_t*       out,
+                           const int32_t* a,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_abs_epi32(x));
+    }
+    for (; i < len; i++)
+        out[i] = (int32_t)(a[i] < 0 ? 0u - (uint32_t)a[i] : (uint32_t)a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int32(const int32_t* data,
+                                   size_t         len,
+                                   int32_t*       out) {
+    int32_t cur = *out;   /* caller seeds with INT32_MIN */
+    size_t  i   = 0u;
+
+    __m256i vmax = _mm256_set1_epi32((int)cur);
+    for (; i + 8u <= len; i += 8u) {
+        vmax = _mm256_max_epi32(vmax, _mm256_loadu_si256((const __m256i*)(data + i)));
+    }
+
+    int32_t lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, vmax);
+    for (size_t k = 0u; k < 8u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int32(const int32_t* data,
+                              size_t         len) {
+    __m256i const zero = _mm256_setzero_si256();
+    __m256i acc        = zero;
+    size_t  i          = 0u;
+
+    /* Widen each 32-bit lane to 64 bits before accumulating */
+    for (; i + 8u <= len; i += 8u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(data + i));
+        __m256i s = _mm256_srai_epi32(x, 31);
+        acc = _mm256_add_epi64(acc, _mm256_unpacklo_epi32(x, s));
+        acc = _mm256_add_epi64(acc, _mm256_unpackhi_epi32(x, s));
+    }
+
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+    int64_t sum = 0;
+    for (size_t k = 0u; k < 4u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int32(int32_t*       out,
+                               const int32_t* a,
+                               const int32_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_min_epi32(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int32(int32_t*       out,
+                               const int32_t* a,
+                               const int32_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_max_epi32(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_AVX2_MIN_INT32_INL */
 // ================================================================================
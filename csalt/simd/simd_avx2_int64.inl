@@ -75,6 +75,109 @@ static inline error_code_t simd_min_int64(const int64_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int64(int64_t*       out,
+                             const int64_t* a,
+                             int64_t        lo,
+                             int64_t        hi,
+                             size_t         len) {
+    __m256i const vlo = _mm256_set1_epi64x((long long)lo);
+    __m256i const vhi = _mm256_set1_epi64x((long long)hi);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i m = _mm256_cmpgt_epi64(x, vhi);
+        x = _mm256_blendv_epi8(x, vhi, m);
+        m = _mm256_cmpgt_epi64(vlo, x);
+        x = _mm256_blendv_epi8(x, vlo, m);
+        _mm256_storeu_si256((__m256i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int64(int64_t*       out,
+                           const int64_t* a,
+                           size_t         len) {
+    /* |x| = (x ^ m) - m with m the sign mask of each lane */
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i m = _mm256_cmpgt_epi64(_mm256_setzero_si256(), x);
+        x = _mm256_sub_epi64(_mm256_xor_si256(x, m), m);
+        _mm256_storeu_si256((__m256i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (int64_t)(a[i] < 0 ? 0u - (uint64_t)a[i] : (uint64_t)a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int64(const int64_t* data,
+                                   size_t         len,
+                                   int64_t*       out) {
+    int64_t cur = *out;   /* caller seeds with INT64_MIN */
+    size_t  i   = 0u;
+
+    __m256i vmax = _mm256_set1_epi64x((long long)cur);
+    for (; i + 4u <= len; i += 4u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(data + i));
+        __m256i m = _mm256_cmpgt_epi64(x, vmax);
+        vmax = _mm256_blendv_epi8(vmax, x, m);
+    }
+
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, vmax);
+    for (size_t k = 0u; k < 4u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int64(int64_t*       out,
+                               const int64_t* a,
+                               const int64_t* b,
+                               size_t         len) {
+    /* m marks lanes with x > y */
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        __m256i m = _mm256_cmpgt_epi64(x, y);
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_blendv_epi8(x, y, m));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int64(int64_t*       out,
+                               const int64_t* a,
+                               const int64_t* b,
+                               size_t         len) {
+    /* m marks lanes with x > y */
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        __m256i m = _mm256_cmpgt_epi64(x, y);
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_blendv_epi8(y, x, m));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_AVX2_MIN_INT64_INL */
 // ================================================================================
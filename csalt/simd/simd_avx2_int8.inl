@@ -87,6 +87,121 @@ static inline error_code_t simd_min_int8(const int8_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int8(int8_t*       out,
+                            const int8_t* a,
+                            int8_t        lo,
+                            int8_t        hi,
+                            size_t        len) {
+    __m256i const vlo = _mm256_set1_epi8((char)lo);
+    __m256i const vhi = _mm256_set1_epi8((char)hi);
+    size_t i = 0u;
+    for (; i + 32u <= len; i += 32u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        x = _mm256_max_epi8(vlo, _mm256_min_epi8(x, vhi));
+        _mm256_storeu_si256((__m256i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int8(int8_t*       out,
+                          const int8_t* a,
+                          size_t        len) {
+    size_t i = 0u;
+    for (; i + 32u <= len; i += 32u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_abs_epi8(x));
+    }
+    for (; i < len; i++)
+        out[i] = (int8_t)(a[i] < 0 ? -a[i] : a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int8(const int8_t* data,
+                                  size_t        len,
+                                  int8_t*       out) {
+    int8_t cur = *out;   /* caller seeds with INT8_MIN */
+    size_t i   = 0u;
+
+    __m256i vmax = _mm256_set1_epi8((char)cur);
+    for (; i + 32u <= len; i += 32u) {
+        vmax = _mm256_max_epi8(vmax, _mm256_loadu_si256((const __m256i*)(data + i)));
+    }
+
+    int8_t lanes[32];
+    _mm256_storeu_si256((__m256i*)lanes, vmax);
+    for (size_t k = 0u; k < 32u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int8(const int8_t* data,
+                             size_t        len) {
+    __m256i const zero = _mm256_setzero_si256();
+    __m256i const bias = _mm256_set1_epi8((char)0x80);
+    __m256i acc        = zero;
+    size_t  i          = 0u;
+
+    /* Bias each byte into 0..255 so SAD can sum it, then take 128 back
+     * off for every biased byte */
+    for (; i + 32u <= len; i += 32u) {
+        __m256i x = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(data + i)), bias);
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(x, zero));
+    }
+
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+    int64_t sum = 0 - 128 * (int64_t)i;
+    for (size_t k = 0u; k < 4u; k++) sum += (int64_t)lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return (int64_t)sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int8(int8_t*       out,
+                              const int8_t* a,
+                              const int8_t* b,
+                              size_t        len) {
+    size_t i = 0u;
+    for (; i + 32u <= len; i += 32u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_min_epi8(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int8(int8_t*       out,
+                              const int8_t* a,
+                              const int8_t* b,
+                              size_t        len) {
+    size_t i = 0u;
+    for (; i + 32u <= len; i += 32u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_max_epi8(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_AVX2_MIN_INT8_INL */
 // ================================================================================
@@ -32,6 +32,7 @@
 #include <immintrin.h>   /* AVX2 */
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -139,5 +140,214 @@ static inline error_code_t simd_min_uint16(const uint16_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_add_epi16(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint16_t)(a[i] + b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_sub_epi16(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint16_t)(a[i] - b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_mullo_epi16(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint16_t)((uint32_t)a[i] * b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint16(uint16_t*       out,
+                               const uint16_t* a,
+                               uint16_t        mul,
+                               uint16_t        add,
+                               size_t          len) {
+    __m256i const vmul = _mm256_set1_epi16((short)mul);
+    __m256i const vadd = _mm256_set1_epi16((short)add);
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        x = _mm256_mullo_epi16(x, vmul);
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_add_epi16(x, vadd));
+    }
+    for (; i < len; i++)
+        out[i] = (uint16_t)((uint32_t)a[i] * mul + add);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint16(uint16_t*       out,
+                              const uint16_t* a,
+                              uint16_t        lo,
+                              uint16_t        hi,
+                              size_t          len) {
+    __m256i const vlo = _mm256_set1_epi16((short)lo);
+    __m256i const vhi = _mm256_set1_epi16((short)hi);
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        x = _mm256_max_epu16(vlo, _mm256_min_epu16(x, vhi));
+        _mm256_storeu_si256((__m256i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint16(const uint16_t* data,
+                                    size_t          len,
+                                    uint16_t*       out) {
+    uint16_t cur = *out;   /* caller seeds with 0 */
+    size_t   i   = 0u;
+
+    __m256i vmax = _mm256_set1_epi16((short)cur);
+    for (; i + 16u <= len; i += 16u) {
+        vmax = _mm256_max_epu16(vmax, _mm256_loadu_si256((const __m256i*)(data + i)));
+    }
+
+    uint16_t lanes[16];
+    _mm256_storeu_si256((__m256i*)lanes, vmax);
+    for (size_t k = 0u; k < 16u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint16(const uint16_t* data,
+                                size_t          len) {
+    __m256i const zero = _mm256_setzero_si256();
+    __m256i const bias = _mm256_set1_epi16((short)0x8000);
+    __m256i const ones = _mm256_set1_epi16(1);
+    __m256i acc        = zero;
+    size_t  i          = 0u;
+
+    /* Bias into signed range so madd can sum 16-bit pairs into 32-bit
+     * lanes; 32768 per element is added back at the end */
+    for (; i + 16u <= len; i += 16u) {
+        __m256i x = _mm256_madd_epi16(_mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(data + i)), bias), ones);
+        __m256i s = _mm256_srai_epi32(x, 31);
+        acc = _mm256_add_epi64(acc, _mm256_unpacklo_epi32(x, s));
+        acc = _mm256_add_epi64(acc, _mm256_unpackhi_epi32(x, s));
+    }
+
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+    int64_t sum = 0 + 32768 * (int64_t)i;
+    for (size_t k = 0u; k < 4u; k++) sum += (int64_t)lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return (uint64_t)sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint16(uint16_t*       out,
+                                const uint16_t* a,
+                                const uint16_t* b,
+                                size_t          len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_min_epu16(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint16(uint16_t*       out,
+                                const uint16_t* a,
+                                const uint16_t* b,
+                                size_t          len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_max_epu16(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 16 lanes of x */
+static inline __m256i _avx2_scan_epi16(__m256i x) {
+    x = _mm256_add_epi16(x, _mm256_slli_si256(x, 2));
+    x = _mm256_add_epi16(x, _mm256_slli_si256(x, 4));
+    x = _mm256_add_epi16(x, _mm256_slli_si256(x, 8));
+    /* carry the lower half's total into the upper half */
+    __m256i t = _mm256_shufflehi_epi16(x, 0xFF);
+    t = _mm256_unpackhi_epi64(t, t);
+    return _mm256_add_epi16(x, _mm256_permute2x128_si256(t, t, 0x08));
+}
+// --------------------------------------------------------------------------------
+
+static uint16_t simd_scan_uint16(uint16_t*       out,
+                                 const uint16_t* a,
+                                 size_t          len,
+                                 uint16_t        carry,
+                                 bool            exclusive) {
+    /* cv holds the running total in every lane; the exclusive sums are
+     * r - x, which is exact under wrapping arithmetic */
+    __m256i cv = _mm256_set1_epi16((short)carry);
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m256i const x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i const p = _avx2_scan_epi16(x);
+        __m256i const r = _mm256_add_epi16(p, cv);
+        __m256i const y = exclusive ? _mm256_sub_epi16(r, x) : r;
+        _mm256_storeu_si256((__m256i*)(out + i), y);
+        __m256i h = _mm256_shufflehi_epi16(r, 0xFF);
+        h = _mm256_unpackhi_epi64(h, h);
+        cv = _mm256_permute2x128_si256(h, h, 0x11);
+    }
+    carry = (uint16_t)_mm_cvtsi128_si32(_mm256_castsi256_si128(cv));
+    for (; i < len; i++) {
+        uint16_t const prev = carry;
+        carry = (uint16_t)(carry + a[i]);
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX2_UINT16_INL */
 
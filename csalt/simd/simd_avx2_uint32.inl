@@ -32,6 +32,7 @@
 #include <immintrin.h>   /* AVX2 */
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -147,5 +148,207 @@ static inline error_code_t simd_min_uint32(const uint32_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_add_epi32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_sub_epi32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_mullo_epi32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint32(uint32_t*       out,
+                               const uint32_t* a,
+                               uint32_t        mul,
+                               uint32_t        add,
+                               size_t          len) {
+    __m256i const vmul = _mm256_set1_epi32((int)mul);
+    __m256i const vadd = _mm256_set1_epi32((int)add);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        x = _mm256_mullo_epi32(x, vmul);
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_add_epi32(x, vadd));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint32(uint32_t*       out,
+                              const uint32_t* a,
+                              uint32_t        lo,
+                              uint32_t        hi,
+                              size_t          len) {
+    __m256i const vlo = _mm256_set1_epi32((int)lo);
+    __m256i const vhi = _mm256_set1_epi32((int)hi);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        x = _mm256_max_epu32(vlo, _mm256_min_epu32(x, vhi));
+        _mm256_storeu_si256((__m256i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint32(const uint32_t* data,
+                                    size_t          len,
+                                    uint32_t*       out) {
+    uint32_t cur = *out;   /* caller seeds with 0 */
+    size_t   i   = 0u;
+
+    __m256i vmax = _mm256_set1_epi32((int)cur);
+    for (; i + 8u <= len; i += 8u) {
+        vmax = _mm256_max_epu32(vmax, _mm256_loadu_si256((const __m256i*)(data + i)));
+    }
+
+    uint32_t lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, vmax);
+    for (size_t k = 0u; k < 8u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint32(const uint32_t* data,
+                                size_t          len) {
+    __m256i const zero = _mm256_setzero_si256();
+    __m256i acc        = zero;
+    size_t  i          = 0u;
+
+    /* Zero-extend each 32-bit lane to 64 bits before accumulating */
+    for (; i + 8u <= len; i += 8u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(data + i));
+        acc = _mm256_add_epi64(acc, _mm256_unpacklo_epi32(x, zero));
+        acc = _mm256_add_epi64(acc, _mm256_unpackhi_epi32(x, zero));
+    }
+
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+    uint64_t sum = 0;
+    for (size_t k = 0u; k < 4u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint32(uint32_t*       out,
+                                const uint32_t* a,
+                                const uint32_t* b,
+                                size_t          len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_min_epu32(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint32(uint32_t*       out,
+                                const uint32_t* a,
+                                const uint32_t* b,
+                                size_t          len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_max_epu32(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 8 lanes of x */
+static inline __m256i _avx2_scan_epi32(__m256i x) {
+    x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+    x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+    /* carry the lower half's total into the upper half */
+    __m256i const t = _mm256_shuffle_epi32(x, 0xFF);
+    return _mm256_add_epi32(x, _mm256_permute2x128_si256(t, t, 0x08));
+}
+// --------------------------------------------------------------------------------
+
+static uint32_t simd_scan_uint32(uint32_t*       out,
+                                 const uint32_t* a,
+                                 size_t          len,
+                                 uint32_t        carry,
+                                 bool            exclusive) {
+    /* cv holds the running total in every lane; the exclusive sums are
+     * r - x, which is exact under wrapping arithmetic */
+    __m256i const last = _mm256_set1_epi32(7);
+    __m256i cv = _mm256_set1_epi32((int)carry);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256i const x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i const p = _avx2_scan_epi32(x);
+        __m256i const r = _mm256_add_epi32(p, cv);
+        __m256i const y = exclusive ? _mm256_sub_epi32(r, x) : r;
+        _mm256_storeu_si256((__m256i*)(out + i), y);
+        cv = _mm256_permutevar8x32_epi32(r, last);
+    }
+    carry = (uint32_t)_mm_cvtsi128_si32(_mm256_castsi256_si128(cv));
+    for (; i < len; i++) {
+        uint32_t const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX2_UINT32_INL */
 
@@ -32,6 +32,7 @@
 #include <immintrin.h>   /* AVX2 */
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -145,5 +146,209 @@ static inline error_code_t simd_min_uint64(const uint64_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+/* Low 64 bits of a 64 x 64 product built from 32-bit multiplies, since
+ * x86 has no 64-bit mullo below AVX512DQ: lo*lo + ((hi*lo + lo*hi) << 32). */
+static inline __m256i _avx2_mullo_epi64(__m256i a, __m256i b) {
+    __m256i lo  = _mm256_mul_epu32(a, b);
+    __m256i mid = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                                   _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+    return _mm256_add_epi64(lo, _mm256_slli_epi64(mid, 32));
+}
+// --------------------------------------------------------------------------------
+
+static void simd_add_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_add_epi64(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_sub_epi64(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _avx2_mullo_epi64(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint64(uint64_t*       out,
+                               const uint64_t* a,
+                               uint64_t        mul,
+                               uint64_t        add,
+                               size_t          len) {
+    __m256i const vmul = _mm256_set1_epi64x((long long)mul);
+    __m256i const vadd = _mm256_set1_epi64x((long long)add);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        x = _avx2_mullo_epi64(x, vmul);
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_add_epi64(x, vadd));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint64(uint64_t*       out,
+                              const uint64_t* a,
+                              uint64_t        lo,
+                              uint64_t        hi,
+                              size_t          len) {
+    /* Unsigned order via signed compares on sign-biased lanes */
+    __m256i const bias = _mm256_set1_epi64x((long long)0x8000000000000000ull);
+    __m256i const vlo  = _mm256_xor_si256(_mm256_set1_epi64x((long long)lo), bias);
+    __m256i const vhi  = _mm256_xor_si256(_mm256_set1_epi64x((long long)hi), bias);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        x = _mm256_xor_si256(x, bias);
+        __m256i m = _mm256_cmpgt_epi64(x, vhi);
+        x = _mm256_blendv_epi8(x, vhi, m);
+        m = _mm256_cmpgt_epi64(vlo, x);
+        x = _mm256_blendv_epi8(x, vlo, m);
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_xor_si256(x, bias));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint64(const uint64_t* data,
+                                    size_t          len,
+                                    uint64_t*       out) {
+    uint64_t cur = *out;   /* caller seeds with 0 */
+    size_t   i   = 0u;
+
+    __m256i const bias = _mm256_set1_epi64x((long long)0x8000000000000000ull);
+    __m256i vmax       = _mm256_xor_si256(_mm256_set1_epi64x((long long)cur), bias);
+    /* Unsigned order via signed compares on sign-biased lanes */
+    for (; i + 4u <= len; i += 4u) {
+        __m256i x = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(data + i)), bias);
+        __m256i m = _mm256_cmpgt_epi64(x, vmax);
+        vmax = _mm256_blendv_epi8(vmax, x, m);
+    }
+    vmax = _mm256_xor_si256(vmax, bias);
+
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, vmax);
+    for (size_t k = 0u; k < 4u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint64(uint64_t*       out,
+                                const uint64_t* a,
+                                const uint64_t* b,
+                                size_t          len) {
+    /* m marks lanes with x > y; unsigned order via sign-biased lanes */
+    __m256i const bias = _mm256_set1_epi64x((long long)0x8000000000000000ull);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        __m256i m = _mm256_cmpgt_epi64(_mm256_xor_si256(x, bias), _mm256_xor_si256(y, bias));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_blendv_epi8(x, y, m));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint64(uint64_t*       out,
+                                const uint64_t* a,
+                                const uint64_t* b,
+                                size_t          len) {
+    /* m marks lanes with x > y; unsigned order via sign-biased lanes */
+    __m256i const bias = _mm256_set1_epi64x((long long)0x8000000000000000ull);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        __m256i m = _mm256_cmpgt_epi64(_mm256_xor_si256(x, bias), _mm256_xor_si256(y, bias));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_blendv_epi8(y, x, m));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 4 lanes of x */
+static inline __m256i _avx2_scan_epi64(__m256i x) {
+    x = _mm256_add_epi64(x, _mm256_slli_si256(x, 8));
+    /* carry the lower half's total into the upper half */
+    __m256i const t = _mm256_shuffle_epi32(x, 0xEE);
+    return _mm256_add_epi64(x, _mm256_permute2x128_si256(t, t, 0x08));
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_scan_uint64(uint64_t*       out,
+                                 const uint64_t* a,
+                                 size_t          len,
+                                 uint64_t        carry,
+                                 bool            exclusive) {
+    /* cv holds the running total in every lane; the exclusive sums are
+     * r - x, which is exact under wrapping arithmetic */
+    __m256i cv = _mm256_set1_epi64x((long long)carry);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256i const x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i const p = _avx2_scan_epi64(x);
+        __m256i const r = _mm256_add_epi64(p, cv);
+        __m256i const y = exclusive ? _mm256_sub_epi64(r, x) : r;
+        _mm256_storeu_si256((__m256i*)(out + i), y);
+        cv = _mm256_permute4x64_epi64(r, 0xFF);
+    }
+    _mm_storel_epi64((__m128i*)&carry, _mm256_castsi256_si128(cv));
+    for (; i < len; i++) {
+        uint64_t const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX2_UINT64_INL */
 
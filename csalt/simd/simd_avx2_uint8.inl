@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include <string.h>
 #include <immintrin.h>   /* AVX2 */
 // ================================================================================ 
@@ -213,5 +214,218 @@ static inline error_code_t simd_min_uint8(const uint8_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+/* No 8-bit multiply on x86: multiply the even and odd bytes as 16-bit
+ * lanes and keep the low byte of each product. */
+static inline __m256i _avx2_mullo_epi8(__m256i a, __m256i b) {
+    __m256i even = _mm256_mullo_epi16(a, b);
+    __m256i odd  = _mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8));
+    return _mm256_or_si256(_mm256_slli_epi16(odd, 8),
+                           _mm256_and_si256(even, _mm256_set1_epi16(0x00FF)));
+}
+// --------------------------------------------------------------------------------
+
+static void simd_add_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 32u <= len; i += 32u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_add_epi8(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint8_t)(a[i] + b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 32u <= len; i += 32u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_sub_epi8(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint8_t)(a[i] - b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 32u <= len; i += 32u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _avx2_mullo_epi8(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint8_t)(a[i] * b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint8(uint8_t*       out,
+                              const uint8_t* a,
+                              uint8_t        mul,
+                              uint8_t        add,
+                              size_t         len) {
+    __m256i const vmul = _mm256_set1_epi8((char)mul);
+    __m256i const vadd = _mm256_set1_epi8((char)add);
+    size_t i = 0u;
+    for (; i + 32u <= len; i += 32u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        x = _avx2_mullo_epi8(x, vmul);
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_add_epi8(x, vadd));
+    }
+    for (; i < len; i++)
+        out[i] = (uint8_t)(a[i] * mul + add);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint8(uint8_t*       out,
+                             const uint8_t* a,
+                             uint8_t        lo,
+                             uint8_t        hi,
+                             size_t         len) {
+    __m256i const vlo = _mm256_set1_epi8((char)lo);
+    __m256i const vhi = _mm256_set1_epi8((char)hi);
+    size_t i = 0u;
+    for (; i + 32u <= len; i += 32u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        x = _mm256_max_epu8(vlo, _mm256_min_epu8(x, vhi));
+        _mm256_storeu_si256((__m256i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint8(const uint8_t* data,
+                                   size_t         len,
+                                   uint8_t*       out) {
+    uint8_t cur = *out;   /* caller seeds with 0 */
+    size_t  i   = 0u;
+
+    __m256i vmax = _mm256_set1_epi8((char)cur);
+    for (; i + 32u <= len; i += 32u) {
+        vmax = _mm256_max_epu8(vmax, _mm256_loadu_si256((const __m256i*)(data + i)));
+    }
+
+    uint8_t lanes[32];
+    _mm256_storeu_si256((__m256i*)lanes, vmax);
+    for (size_t k = 0u; k < 32u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint8(const uint8_t* data,
+                               size_t         len) {
+    __m256i const zero = _mm256_setzero_si256();
+    __m256i acc        = zero;
+    size_t  i          = 0u;
+
+    /* SAD against zero sums each group of eight bytes into a 64-bit lane */
+    for (; i + 32u <= len; i += 32u) {
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(_mm256_loadu_si256((const __m256i*)(data + i)), zero));
+    }
+
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+    uint64_t sum = 0;
+    for (size_t k = 0u; k < 4u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               const uint8_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 32u <= len; i += 32u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_min_epu8(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               const uint8_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 32u <= len; i += 32u) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_max_epu8(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 32 lanes of x */
+static inline __m256i _avx2_scan_epi8(__m256i x) {
+    x = _mm256_add_epi8(x, _mm256_slli_si256(x, 1));
+    x = _mm256_add_epi8(x, _mm256_slli_si256(x, 2));
+    x = _mm256_add_epi8(x, _mm256_slli_si256(x, 4));
+    x = _mm256_add_epi8(x, _mm256_slli_si256(x, 8));
+    /* carry the lower half's total into the upper half */
+    __m256i const t = _mm256_shuffle_epi8(x, _mm256_set1_epi8(15));
+    return _mm256_add_epi8(x, _mm256_permute2x128_si256(t, t, 0x08));
+}
+// --------------------------------------------------------------------------------
+
+static uint8_t simd_scan_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               size_t         len,
+                               uint8_t        carry,
+                               bool           exclusive) {
+    /* cv holds the running total in every lane; the exclusive sums are
+     * r - x, which is exact under wrapping arithmetic */
+    __m256i const last = _mm256_set1_epi8(15);
+    __m256i cv = _mm256_set1_epi8((char)carry);
+    size_t i = 0u;
+    for (; i + 32u <= len; i += 32u) {
+        __m256i const x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i const p = _avx2_scan_epi8(x);
+        __m256i const r = _mm256_add_epi8(p, cv);
+        __m256i const y = exclusive ? _mm256_sub_epi8(r, x) : r;
+        _mm256_storeu_si256((__m256i*)(out + i), y);
+        __m256i const h = _mm256_shuffle_epi8(r, last);
+        cv = _mm256_permute2x128_si256(h, h, 0x11);
+    }
+    carry = (uint8_t)_mm_cvtsi128_si32(_mm256_castsi256_si128(cv));
+    for (; i < len; i++) {
+        uint8_t const prev = carry;
+        carry = (uint8_t)(carry + a[i]);
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX2_UINT8_INL */
 
@@ -285,7 +285,7 @@ static inline __mmask64 ascii_range_mask_512(__m512i x, __m512i lo, __m512i hi)
     return (ge_lo & le_hi);
 }
 
-void simd_ascii_upper_u8(uint8_t* p, size_t n)
+static inline void simd_ascii_upper_u8(uint8_t* p, size_t n)
 {
     if ((p == NULL) || (n == 0u)) return;
 
@@ -312,7 +312,7 @@ void simd_ascii_upper_u8(uint8_t* p, size_t n)
     }
 }
 
-void simd_ascii_lower_u8(uint8_t* p, size_t n)
+static inline void simd_ascii_lower_u8(uint8_t* p, size_t n)
 {
     if ((p == NULL) || (n == 0u)) return;
 
@@ -263,5 +263,544 @@ static inline error_code_t simd_min_double(const double* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512d x = _mm512_maskz_loadu_pd(k, a + i);
+        __m512d y = _mm512_maskz_loadu_pd(k, b + i);
+        _mm512_mask_storeu_pd(out + i, k, _mm512_add_pd(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512d x = _mm512_maskz_loadu_pd(k, a + i);
+        __m512d y = _mm512_maskz_loadu_pd(k, b + i);
+        _mm512_mask_storeu_pd(out + i, k, _mm512_sub_pd(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512d x = _mm512_maskz_loadu_pd(k, a + i);
+        __m512d y = _mm512_maskz_loadu_pd(k, b + i);
+        _mm512_mask_storeu_pd(out + i, k, _mm512_mul_pd(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_div_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512d x = _mm512_maskz_loadu_pd(k, a + i);
+        __m512d y = _mm512_maskz_loadu_pd(k, b + i);
+        _mm512_mask_storeu_pd(out + i, k, _mm512_div_pd(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_double(double*       out,
+                               const double* a,
+                               double        mul,
+                               double        add,
+                               size_t        len) {
+    __m512d const vmul = _mm512_set1_pd(mul);
+    __m512d const vadd = _mm512_set1_pd(add);
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512d x = _mm512_maskz_loadu_pd(k, a + i);
+        _mm512_mask_storeu_pd(out + i, k, _mm512_add_pd(_mm512_mul_pd(x, vmul), vadd));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_double(double*       out,
+                              const double* a,
+                              double        lo,
+                              double        hi,
+                              size_t        len) {
+    /* min/max return their second operand when either is NaN, so NaN
+     * inputs pass through unchanged */
+    __m512d const vlo = _mm512_set1_pd(lo);
+    __m512d const vhi = _mm512_set1_pd(hi);
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512d x = _mm512_maskz_loadu_pd(k, a + i);
+        _mm512_mask_storeu_pd(out + i, k, _mm512_max_pd(vlo, _mm512_min_pd(vhi, x)));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_double(double*       out,
+                            const double* a,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512d x = _mm512_maskz_loadu_pd(k, a + i);
+        _mm512_mask_storeu_pd(out + i, k, _mm512_abs_pd(x));
+    }
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_double(const double* data,
+                                    size_t        len,
+                                    double*       out) {
+    double cur = *out;   /* caller seeds with -INFINITY */
+    __m512d  vmax = _mm512_set1_pd(cur);
+    __mmask8 nan  = 0u;
+
+    /* Inactive lanes load the running maximum, so they never win */
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512d x = _mm512_mask_loadu_pd(vmax, k, data + i);
+        nan |= _mm512_cmp_pd_mask(x, x, _CMP_UNORD_Q);
+        vmax = _mm512_max_pd(vmax, x);
+    }
+    if (nan) { *out = NAN; return NO_ERROR; }
+
+    *out = _mm512_reduce_max_pd(vmax);
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static double simd_sum_double(const double* data,
+                              size_t        len) {
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = _mm512_setzero_pd();
+    size_t  i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 16u <= len; i += 16u) {
+        acc0 = _mm512_add_pd(acc0, _mm512_loadu_pd(data + i));
+        acc1 = _mm512_add_pd(acc1, _mm512_loadu_pd(data + i + 8u));
+    }
+    acc0 = _mm512_add_pd(acc0, acc1);
+    for (; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        acc0 = _mm512_add_pd(acc0, _mm512_maskz_loadu_pd(k, data + i));
+    }
+    return _mm512_reduce_add_pd(acc0);
+}
+// --------------------------------------------------------------------------------
+
+static double simd_asum_double(const double* data,
+                               size_t        len) {
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = _mm512_setzero_pd();
+    size_t  i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 16u <= len; i += 16u) {
+        acc0 = _mm512_add_pd(acc0, _mm512_abs_pd(_mm512_loadu_pd(data + i)));
+        acc1 = _mm512_add_pd(acc1, _mm512_abs_pd(_mm512_loadu_pd(data + i + 8u)));
+    }
+    acc0 = _mm512_add_pd(acc0, acc1);
+    for (; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        acc0 = _mm512_add_pd(acc0, _mm512_abs_pd(_mm512_maskz_loadu_pd(k, data + i)));
+    }
+    return _mm512_reduce_add_pd(acc0);
+}
+// --------------------------------------------------------------------------------
+
+static double simd_dot_double(const double* a,
+                              const double* b,
+                              size_t        len) {
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = _mm512_setzero_pd();
+    size_t  i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 16u <= len; i += 16u) {
+        acc0 = _mm512_add_pd(acc0, _mm512_mul_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+        acc1 = _mm512_add_pd(acc1, _mm512_mul_pd(_mm512_loadu_pd(a + i + 8u), _mm512_loadu_pd(b + i + 8u)));
+    }
+    acc0 = _mm512_add_pd(acc0, acc1);
+    for (; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        acc0 = _mm512_add_pd(acc0, _mm512_mul_pd(_mm512_maskz_loadu_pd(k, a + i), _mm512_maskz_loadu_pd(k, b + i)));
+    }
+    return _mm512_reduce_add_pd(acc0);
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_double(double*       out,
+                                const double* a,
+                                const double* b,
+                                size_t        len) {
+    /* min(y, x) returns x when either lane is NaN; NaN lanes of y are
+     * patched back in so NaN propagates from both operands */
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512d x = _mm512_maskz_loadu_pd(k, a + i);
+        __m512d y = _mm512_maskz_loadu_pd(k, b + i);
+        __m512d r = _mm512_min_pd(y, x);
+        __mmask8 const u = _mm512_cmp_pd_mask(y, y, _CMP_UNORD_Q);
+        _mm512_mask_storeu_pd(out + i, k, _mm512_mask_mov_pd(r, u, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_double(double*       out,
+                                const double* a,
+                                const double* b,
+                                size_t        len) {
+    /* max(y, x) returns x when either lane is NaN; NaN lanes of y are
+     * patched back in so NaN propagates from both operands */
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512d x = _mm512_maskz_loadu_pd(k, a + i);
+        __m512d y = _mm512_maskz_loadu_pd(k, b + i);
+        __m512d r = _mm512_max_pd(y, x);
+        __mmask8 const u = _mm512_cmp_pd_mask(y, y, _CMP_UNORD_Q);
+        _mm512_mask_storeu_pd(out + i, k, _mm512_mask_mov_pd(r, u, y));
+    }
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 8 lanes of x */
+static inline __m512d _avx512_scan_pd(__m512d x) {
+    __m512i const z = _mm512_setzero_si512();
+    __m512i v = _mm512_castpd_si512(x);
+    x = _mm512_add_pd(x, _mm512_castsi512_pd(_mm512_alignr_epi64(v, z, 7)));
+    v = _mm512_castpd_si512(x);
+    x = _mm512_add_pd(x, _mm512_castsi512_pd(_mm512_alignr_epi64(v, z, 6)));
+    v = _mm512_castpd_si512(x);
+    x = _mm512_add_pd(x, _mm512_castsi512_pd(_mm512_alignr_epi64(v, z, 4)));
+    return x;
+}
+// --------------------------------------------------------------------------------
+
+/* x moved up one lane, with zero in lane 0 */
+static inline __m512d _avx512_shl1_pd(__m512d x) {
+    __m512i const v = _mm512_castpd_si512(x);
+    return _mm512_castsi512_pd(_mm512_alignr_epi64(v, _mm512_setzero_si512(), 7));
+}
+// --------------------------------------------------------------------------------
+
+static double simd_scan_double(double*       out,
+                               const double* a,
+                               size_t        len,
+                               double        carry,
+                               bool          exclusive) {
+    /* cv holds the running total in every lane */
+    __m512i const last = _mm512_set1_epi64(7);
+    __m512d cv = _mm512_set1_pd(carry);
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512d const x = _mm512_maskz_loadu_pd(k, a + i);
+        __m512d const p = _avx512_scan_pd(x);
+        __m512d const r = _mm512_add_pd(p, cv);
+        __m512d const y = exclusive ? _mm512_add_pd(_avx512_shl1_pd(p), cv) : r;
+        _mm512_mask_storeu_pd(out + i, k, y);
+        cv = _mm512_permutexvar_pd(last, r);
+    }
+    /* masked-off lanes load as zero, so after the last vector every lane
+     * of cv holds the total */
+    return _mm512_cvtsd_f64(cv);
+}
+// ================================================================================
+// ================================================================================
+// MATRIX KERNELS
+
+/* y[i] += alpha * x[i] */
+static void simd_axpy_double(double*       y,
+                             const double* x,
+                             double        alpha,
+                             size_t        len) {
+    __m512d const av = _mm512_set1_pd(alpha);
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        _mm512_storeu_pd(y + i,      _mm512_fmadd_pd(av, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+        _mm512_storeu_pd(y + i + 8u, _mm512_fmadd_pd(av, _mm512_loadu_pd(x + i + 8u), _mm512_loadu_pd(y + i + 8u)));
+    }
+    for (; i + 8u <= len; i += 8u)
+        _mm512_storeu_pd(y + i, _mm512_fmadd_pd(av, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+    for (; i < len; i++)
+        y[i] += alpha * x[i];
+}
+// --------------------------------------------------------------------------------
+
+/* C[0..4)[0..n) += A[0..4)[0..k) * B[0..k)[0..n), all row-major with leading
+ * dimensions ldc, lda and ldb.  Each 16-column strip keeps its
+ * 4 x 16 block of C in eight registers for the whole k loop */
+static void simd_gemm4_double(double*       c,
+                              size_t        ldc,
+                              const double* a,
+                              size_t        lda,
+                              const double* b,
+                              size_t        ldb,
+                              size_t        k,
+                              size_t        n) {
+    size_t j = 0u;
+    for (; j + 16u <= n; j += 16u) {
+        __m512d c00 = _mm512_loadu_pd(c + j), c01 = _mm512_loadu_pd(c + j + 8u);
+        __m512d c10 = _mm512_loadu_pd(c + ldc + j), c11 = _mm512_loadu_pd(c + ldc + j + 8u);
+        __m512d c20 = _mm512_loadu_pd(c + 2u * ldc + j), c21 = _mm512_loadu_pd(c + 2u * ldc + j + 8u);
+        __m512d c30 = _mm512_loadu_pd(c + 3u * ldc + j), c31 = _mm512_loadu_pd(c + 3u * ldc + j + 8u);
+        const double* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            __m512d const b0 = _mm512_loadu_pd(bp);
+            __m512d const b1 = _mm512_loadu_pd(bp + 8u);
+            __m512d av = _mm512_set1_pd(a[p]);
+            c00 = _mm512_fmadd_pd(av, b0, c00);
+            c01 = _mm512_fmadd_pd(av, b1, c01);
+            av  = _mm512_set1_pd(a[lda + p]);
+            c10 = _mm512_fmadd_pd(av, b0, c10);
+            c11 = _mm512_fmadd_pd(av, b1, c11);
+            av  = _mm512_set1_pd(a[2u * lda + p]);
+            c20 = _mm512_fmadd_pd(av, b0, c20);
+            c21 = _mm512_fmadd_pd(av, b1, c21);
+            av  = _mm512_set1_pd(a[3u * lda + p]);
+            c30 = _mm512_fmadd_pd(av, b0, c30);
+            c31 = _mm512_fmadd_pd(av, b1, c31);
+        }
+        _mm512_storeu_pd(c + j, c00); _mm512_storeu_pd(c + j + 8u, c01);
+        _mm512_storeu_pd(c + ldc + j, c10); _mm512_storeu_pd(c + ldc + j + 8u, c11);
+        _mm512_storeu_pd(c + 2u * ldc + j, c20); _mm512_storeu_pd(c + 2u * ldc + j + 8u, c21);
+        _mm512_storeu_pd(c + 3u * ldc + j, c30); _mm512_storeu_pd(c + 3u * ldc + j + 8u, c31);
+    }
+    for (; j + 8u <= n; j += 8u) {
+        __m512d c0 = _mm512_loadu_pd(c + j), c1 = _mm512_loadu_pd(c + ldc + j);
+        __m512d c2 = _mm512_loadu_pd(c + 2u * ldc + j), c3 = _mm512_loadu_pd(c + 3u * ldc + j);
+        const double* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            __m512d const bv = _mm512_loadu_pd(bp);
+            c0 = _mm512_fmadd_pd(_mm512_set1_pd(a[p]), bv, c0);
+            c1 = _mm512_fmadd_pd(_mm512_set1_pd(a[lda + p]), bv, c1);
+            c2 = _mm512_fmadd_pd(_mm512_set1_pd(a[2u * lda + p]), bv, c2);
+            c3 = _mm512_fmadd_pd(_mm512_set1_pd(a[3u * lda + p]), bv, c3);
+        }
+        _mm512_storeu_pd(c + j, c0); _mm512_storeu_pd(c + ldc + j, c1);
+        _mm512_storeu_pd(c + 2u * ldc + j, c2); _mm512_storeu_pd(c + 3u * ldc + j, c3);
+    }
+    for (; j < n; j++) {
+        double s0 = c[j], s1 = c[ldc + j], s2 = c[2u * ldc + j], s3 = c[3u * ldc + j];
+        const double* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            s0 += a[p]            * *bp;
+            s1 += a[lda + p]      * *bp;
+            s2 += a[2u * lda + p] * *bp;
+            s3 += a[3u * lda + p] * *bp;
+        }
+        c[j] = s0; c[ldc + j] = s1; c[2u * ldc + j] = s2; c[3u * ldc + j] = s3;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* sum of val[i] * x[idx[i]]: the sparse row (or column) dot product.
+ * The 64-bit indices feed the hardware gather directly */
+static double simd_spdot_double(const double* val,
+                                const size_t* idx,
+                                const double* x,
+                                size_t        len) {
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = _mm512_setzero_pd();
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m512i const i0 = _mm512_loadu_si512((const void*)(idx + i));
+        __m512i const i1 = _mm512_loadu_si512((const void*)(idx + i + 8u));
+        acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(val + i),
+                               _mm512_i64gather_pd(i0, x, 8), acc0);
+        acc1 = _mm512_fmadd_pd(_mm512_loadu_pd(val + i + 8u),
+                               _mm512_i64gather_pd(i1, x, 8), acc1);
+    }
+    acc0 = _mm512_add_pd(acc0, acc1);
+    for (; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu : (__mmask8)((1u << rem) - 1u);
+        __m512i const iv = _mm512_maskz_loadu_epi64(k, idx + i);
+        __m512d const g = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), k, iv, x, 8);
+        acc0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(k, val + i), g, acc0);
+    }
+    return _mm512_reduce_add_pd(acc0);
+}
+// --------------------------------------------------------------------------------
+
+/* dst[j * ldd + i] = src[i * lds + j] for i < rows, j < cols: one cache
+ * tile of a matrix transpose.  4 x 4 blocks are transposed in 256-bit
+ * registers; 8-wide blocks would need an 8-row tile edge for little gain. */
+static void simd_transpose_double(double*       dst,
+                                  size_t        ldd,
+                                  const double* src,
+                                  size_t        lds,
+                                  size_t        rows,
+                                  size_t        cols) {
+    size_t i = 0u;
+    for (; i + 4u <= rows; i += 4u) {
+        size_t j = 0u;
+        for (; j + 4u <= cols; j += 4u) {
+            const double* s = src + i * lds + j;
+            double*       d = dst + j * ldd + i;
+            __m256d const r0 = _mm256_loadu_pd(s);
+            __m256d const r1 = _mm256_loadu_pd(s + lds);
+            __m256d const r2 = _mm256_loadu_pd(s + 2u * lds);
+            __m256d const r3 = _mm256_loadu_pd(s + 3u * lds);
+            __m256d const t0 = _mm256_unpacklo_pd(r0, r1);
+            __m256d const t1 = _mm256_unpackhi_pd(r0, r1);
+            __m256d const t2 = _mm256_unpacklo_pd(r2, r3);
+            __m256d const t3 = _mm256_unpackhi_pd(r2, r3);
+            _mm256_storeu_pd(d,            _mm256_permute2f128_pd(t0, t2, 0x20));
+            _mm256_storeu_pd(d + ldd,      _mm256_permute2f128_pd(t1, t3, 0x20));
+            _mm256_storeu_pd(d + 2u * ldd, _mm256_permute2f128_pd(t0, t2, 0x31));
+            _mm256_storeu_pd(d + 3u * ldd, _mm256_permute2f128_pd(t1, t3, 0x31));
+        }
+        for (; j < cols; j++)
+            for (size_t q = 0u; q < 4u; q++)
+                dst[j * ldd + i + q] = src[(i + q) * lds + j];
+    }
+    for (; i < rows; i++)
+        for (size_t j = 0u; j < cols; j++)
+            dst[j * ldd + i] = src[i * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* The same transpose for one band of 8 source rows: dst[j * ldd + q] =
+ * src[q * lds + j] for q < 8, j < cols.  Two 4 x 4 blocks stacked in the
+ * band fill a whole 64-byte destination line, which goes out with
+ * non-temporal stores so the destination is never read into the cache.
+ * dst must be 64-byte aligned and ldd a multiple of 8; the band ends with
+ * a fence. */
+static void simd_transpose_stream_double(double*       dst,
+                                         size_t        ldd,
+                                         const double* src,
+                                         size_t        lds,
+                                         size_t        cols) {
+    size_t j = 0u;
+    for (; j + 4u <= cols; j += 4u) {
+        __m256d r[8];
+        for (size_t h = 0u; h < 8u; h += 4u) {
+            const double* s = src + h * lds + j;
+            __m256d const r0 = _mm256_loadu_pd(s);
+            __m256d const r1 = _mm256_loadu_pd(s + lds);
+            __m256d const r2 = _mm256_loadu_pd(s + 2u * lds);
+            __m256d const r3 = _mm256_loadu_pd(s + 3u * lds);
+            __m256d const t0 = _mm256_unpacklo_pd(r0, r1);
+            __m256d const t1 = _mm256_unpackhi_pd(r0, r1);
+            __m256d const t2 = _mm256_unpacklo_pd(r2, r3);
+            __m256d const t3 = _mm256_unpackhi_pd(r2, r3);
+            r[h]      = _mm256_permute2f128_pd(t0, t2, 0x20);
+            r[h + 1u] = _mm256_permute2f128_pd(t1, t3, 0x20);
+            r[h + 2u] = _mm256_permute2f128_pd(t0, t2, 0x31);
+            r[h + 3u] = _mm256_permute2f128_pd(t1, t3, 0x31);
+        }
+        double* d = dst + j * ldd;
+        for (size_t k = 0u; k < 4u; k++) {
+            _mm256_stream_pd(d + k * ldd,      r[k]);
+            _mm256_stream_pd(d + k * ldd + 4u, r[k + 4u]);
+        }
+    }
+    _mm_sfence();
+    for (; j < cols; j++)
+        for (size_t q = 0u; q < 8u; q++)
+            dst[j * ldd + q] = src[q * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* y[r] += sum over blocks b < nb of row r of block b dotted with
+ * x + col[b] * bc, for r < rows: one block row of a BSR SpMV.  Blocks are
+ * br x bc, row-major and packed back to back.  Block rows are dotted 8
+ * lanes at a time under a load mask, so narrow blocks need no scalar tail. */
+static void simd_bsr_double(double*       y,
+                            const double* val,
+                            const size_t* col,
+                            const double* x,
+                            size_t        nb,
+                            size_t        rows,
+                            size_t        br,
+                            size_t        bc) {
+    for (size_t r = 0u; r < rows; r++) {
+        __m512d acc = _mm512_setzero_pd();
+        for (size_t b = 0u; b < nb; b++) {
+            const double* a  = val + (b * br + r) * bc;
+            const double* xb = x + col[b] * bc;
+            for (size_t k = 0u; k < bc; k += 8u) {
+                size_t const rem = bc - k;
+                __mmask8 const m = (rem >= 8u) ? (__mmask8)0xFFu : (__mmask8)((1u << rem) - 1u);
+                acc = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m, a + k), _mm512_maskz_loadu_pd(m, xb + k), acc);
+            }
+        }
+        y[r] += _mm512_reduce_add_pd(acc);
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* y[i] = sum over j < width of val[j * chunk + i] * x[idx[j * chunk + i]]
+ * for i < chunk: one slice of a SELL-C-sigma SpMV.  The slice is stored
+ * column by column, so consecutive lanes hold consecutive rows.  8 rows
+ * per register under a lane mask, so any chunk height needs no scalar
+ * tail. */
+static void simd_sell_double(double*       y,
+                             const double* val,
+                             const size_t* idx,
+                             const double* x,
+                             size_t        chunk,
+                             size_t        width) {
+    for (size_t i = 0u; i < chunk; i += 8u) {
+        size_t const rem = chunk - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu : (__mmask8)((1u << rem) - 1u);
+        __m512d acc = _mm512_setzero_pd();
+        for (size_t j = 0u; j < width; j++) {
+            __m512i const iv = _mm512_maskz_loadu_epi64(k, idx + j * chunk + i);
+            __m512d const g = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), k, iv, x, 8);
+            acc = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(k, val + j * chunk + i), g, acc);
+        }
+        _mm512_mask_storeu_pd(y + i, k, acc);
+    }
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX512_DOUBLE_INL */
 
@@ -260,5 +260,557 @@ static inline error_code_t simd_min_float(const float* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512 x = _mm512_maskz_loadu_ps(k, a + i);
+        __m512 y = _mm512_maskz_loadu_ps(k, b + i);
+        _mm512_mask_storeu_ps(out + i, k, _mm512_add_ps(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512 x = _mm512_maskz_loadu_ps(k, a + i);
+        __m512 y = _mm512_maskz_loadu_ps(k, b + i);
+        _mm512_mask_storeu_ps(out + i, k, _mm512_sub_ps(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512 x = _mm512_maskz_loadu_ps(k, a + i);
+        __m512 y = _mm512_maskz_loadu_ps(k, b + i);
+        _mm512_mask_storeu_ps(out + i, k, _mm512_mul_ps(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_div_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512 x = _mm512_maskz_loadu_ps(k, a + i);
+        __m512 y = _mm512_maskz_loadu_ps(k, b + i);
+        _mm512_mask_storeu_ps(out + i, k, _mm512_div_ps(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_float(float*       out,
+                              const float* a,
+                              float        mul,
+                              float        add,
+                              size_t       len) {
+    __m512 const vmul = _mm512_set1_ps(mul);
+    __m512 const vadd = _mm512_set1_ps(add);
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512 x = _mm512_maskz_loadu_ps(k, a + i);
+        _mm512_mask_storeu_ps(out + i, k, _mm512_add_ps(_mm512_mul_ps(x, vmul), vadd));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_float(float*       out,
+                             const float* a,
+                             float        lo,
+                             float        hi,
+                             size_t       len) {
+    /* min/max return their second operand when either is NaN, so NaN
+     * inputs pass through unchanged */
+    __m512 const vlo = _mm512_set1_ps(lo);
+    __m512 const vhi = _mm512_set1_ps(hi);
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512 x = _mm512_maskz_loadu_ps(k, a + i);
+        _mm512_mask_storeu_ps(out + i, k, _mm512_max_ps(vlo, _mm512_min_ps(vhi, x)));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_float(float*       out,
+                           const float* a,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512 x = _mm512_maskz_loadu_ps(k, a + i);
+        _mm512_mask_storeu_ps(out + i, k, _mm512_abs_ps(x));
+    }
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_float(const float* data,
+                                   size_t       len,
+                                   float*       out) {
+    float cur = *out;   /* caller seeds with -INFINITY */
+    __m512    vmax = _mm512_set1_ps(cur);
+    __mmask16 nan  = 0u;
+
+    /* Inactive lanes load the running maximum, so they never win */
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512 x = _mm512_mask_loadu_ps(vmax, k, data + i);
+        nan |= _mm512_cmp_ps_mask(x, x, _CMP_UNORD_Q);
+        vmax = _mm512_max_ps(vmax, x);
+    }
+    if (nan) { *out = NAN; return NO_ERROR; }
+
+    *out = _mm512_reduce_max_ps(vmax);
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static float simd_sum_float(const float* data,
+                            size_t       len) {
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    size_t i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 32u <= len; i += 32u) {
+        acc0 = _mm512_add_ps(acc0, _mm512_loadu_ps(data + i));
+        acc1 = _mm512_add_ps(acc1, _mm512_loadu_ps(data + i + 16u));
+    }
+    acc0 = _mm512_add_ps(acc0, acc1);
+    for (; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        acc0 = _mm512_add_ps(acc0, _mm512_maskz_loadu_ps(k, data + i));
+    }
+    return _mm512_reduce_add_ps(acc0);
+}
+// --------------------------------------------------------------------------------
+
+static float simd_asum_float(const float* data,
+                             size_t       len) {
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    size_t i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 32u <= len; i += 32u) {
+        acc0 = _mm512_add_ps(acc0, _mm512_abs_ps(_mm512_loadu_ps(data + i)));
+        acc1 = _mm512_add_ps(acc1, _mm512_abs_ps(_mm512_loadu_ps(data + i + 16u)));
+    }
+    acc0 = _mm512_add_ps(acc0, acc1);
+    for (; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        acc0 = _mm512_add_ps(acc0, _mm512_abs_ps(_mm512_maskz_loadu_ps(k, data + i)));
+    }
+    return _mm512_reduce_add_ps(acc0);
+}
+// --------------------------------------------------------------------------------
+
+static float simd_dot_float(const float* a,
+                            const float* b,
+                            size_t       len) {
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    size_t i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 32u <= len; i += 32u) {
+        acc0 = _mm512_add_ps(acc0, _mm512_mul_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+        acc1 = _mm512_add_ps(acc1, _mm512_mul_ps(_mm512_loadu_ps(a + i + 16u), _mm512_loadu_ps(b + i + 16u)));
+    }
+    acc0 = _mm512_add_ps(acc0, acc1);
+    for (; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        acc0 = _mm512_add_ps(acc0, _mm512_mul_ps(_mm512_maskz_loadu_ps(k, a + i), _mm512_maskz_loadu_ps(k, b + i)));
+    }
+    return _mm512_reduce_add_ps(acc0);
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_float(float*       out,
+                               const float* a,
+                               const float* b,
+                               size_t       len) {
+    /* min(y, x) returns x when either lane is NaN; NaN lanes of y are
+     * patched back in so NaN propagates from both operands */
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512 x = _mm512_maskz_loadu_ps(k, a + i);
+        __m512 y = _mm512_maskz_loadu_ps(k, b + i);
+        __m512 r = _mm512_min_ps(y, x);
+        __mmask16 const u = _mm512_cmp_ps_mask(y, y, _CMP_UNORD_Q);
+        _mm512_mask_storeu_ps(out + i, k, _mm512_mask_mov_ps(r, u, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_float(float*       out,
+                               const float* a,
+                               const float* b,
+                               size_t       len) {
+    /* max(y, x) returns x when either lane is NaN; NaN lanes of y are
+     * patched back in so NaN propagates from both operands */
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512 x = _mm512_maskz_loadu_ps(k, a + i);
+        __m512 y = _mm512_maskz_loadu_ps(k, b + i);
+        __m512 r = _mm512_max_ps(y, x);
+        __mmask16 const u = _mm512_cmp_ps_mask(y, y, _CMP_UNORD_Q);
+        _mm512_mask_storeu_ps(out + i, k, _mm512_mask_mov_ps(r, u, y));
+    }
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 16 lanes of x */
+static inline __m512 _avx512_scan_ps(__m512 x) {
+    __m512i const z = _mm512_setzero_si512();
+    __m512i v = _mm512_castps_si512(x);
+    x = _mm512_add_ps(x, _mm512_castsi512_ps(_mm512_alignr_epi32(v, z, 15)));
+    v = _mm512_castps_si512(x);
+    x = _mm512_add_ps(x, _mm512_castsi512_ps(_mm512_alignr_epi32(v, z, 14)));
+    v = _mm512_castps_si512(x);
+    x = _mm512_add_ps(x, _mm512_castsi512_ps(_mm512_alignr_epi32(v, z, 12)));
+    v = _mm512_castps_si512(x);
+    x = _mm512_add_ps(x, _mm512_castsi512_ps(_mm512_alignr_epi32(v, z, 8)));
+    return x;
+}
+// --------------------------------------------------------------------------------
+
+/* x moved up one lane, with zero in lane 0 */
+static inline __m512 _avx512_shl1_ps(__m512 x) {
+    __m512i const v = _mm512_castps_si512(x);
+    return _mm512_castsi512_ps(_mm512_alignr_epi32(v, _mm512_setzero_si512(), 15));
+}
+// --------------------------------------------------------------------------------
+
+static float simd_scan_float(float*       out,
+                             const float* a,
+                             size_t       len,
+                             float        carry,
+                             bool         exclusive) {
+    /* cv holds the running total in every lane */
+    __m512i const last = _mm512_set1_epi32(15);
+    __m512 cv = _mm512_set1_ps(carry);
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512 const x = _mm512_maskz_loadu_ps(k, a + i);
+        __m512 const p = _avx512_scan_ps(x);
+        __m512 const r = _mm512_add_ps(p, cv);
+        __m512 const y = exclusive ? _mm512_add_ps(_avx512_shl1_ps(p), cv) : r;
+        _mm512_mask_storeu_ps(out + i, k, y);
+        cv = _mm512_permutexvar_ps(last, r);
+    }
+    /* masked-off lanes load as zero, so after the last vector every lane
+     * of cv holds the total */
+    return _mm512_cvtss_f32(cv);
+}
+// ================================================================================
+// ================================================================================
+// MATRIX KERNELS
+
+/* y[i] += alpha * x[i] */
+static void simd_axpy_float(float*       y,
+                            const float* x,
+                            float        alpha,
+                            size_t       len) {
+    __m512 const av = _mm512_set1_ps(alpha);
+    size_t i = 0u;
+    for (; i + 32u <= len; i += 32u) {
+        _mm512_storeu_ps(y + i,      _mm512_fmadd_ps(av, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+        _mm512_storeu_ps(y + i + 16u, _mm512_fmadd_ps(av, _mm512_loadu_ps(x + i + 16u), _mm512_loadu_ps(y + i + 16u)));
+    }
+    for (; i + 16u <= len; i += 16u)
+        _mm512_storeu_ps(y + i, _mm512_fmadd_ps(av, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+    for (; i < len; i++)
+        y[i] += alpha * x[i];
+}
+// --------------------------------------------------------------------------------
+
+/* C[0..4)[0..n) += A[0..4)[0..k) * B[0..k)[0..n), all row-major with leading
+ * dimensions ldc, lda and ldb.  Each 32-column strip keeps its
+ * 4 x 32 block of C in eight registers for the whole k loop */
+static void simd_gemm4_float(float*       c,
+                             size_t       ldc,
+                             const float* a,
+                             size_t       lda,
+                             const float* b,
+                             size_t       ldb,
+                             size_t       k,
+                             size_t       n) {
+    size_t j = 0u;
+    for (; j + 32u <= n; j += 32u) {
+        __m512 c00 = _mm512_loadu_ps(c + j), c01 = _mm512_loadu_ps(c + j + 16u);
+        __m512 c10 = _mm512_loadu_ps(c + ldc + j), c11 = _mm512_loadu_ps(c + ldc + j + 16u);
+        __m512 c20 = _mm512_loadu_ps(c + 2u * ldc + j), c21 = _mm512_loadu_ps(c + 2u * ldc + j + 16u);
+        __m512 c30 = _mm512_loadu_ps(c + 3u * ldc + j), c31 = _mm512_loadu_ps(c + 3u * ldc + j + 16u);
+        const float* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            __m512 const b0 = _mm512_loadu_ps(bp);
+            __m512 const b1 = _mm512_loadu_ps(bp + 16u);
+            __m512 av = _mm512_set1_ps(a[p]);
+            c00 = _mm512_fmadd_ps(av, b0, c00);
+            c01 = _mm512_fmadd_ps(av, b1, c01);
+            av  = _mm512_set1_ps(a[lda + p]);
+            c10 = _mm512_fmadd_ps(av, b0, c10);
+            c11 = _mm512_fmadd_ps(av, b1, c11);
+            av  = _mm512_set1_ps(a[2u * lda + p]);
+            c20 = _mm512_fmadd_ps(av, b0, c20);
+            c21 = _mm512_fmadd_ps(av, b1, c21);
+            av  = _mm512_set1_ps(a[3u * lda + p]);
+            c30 = _mm512_fmadd_ps(av, b0, c30);
+            c31 = _mm512_fmadd_ps(av, b1, c31);
+        }
+        _mm512_storeu_ps(c + j, c00); _mm512_storeu_ps(c + j + 16u, c01);
+        _mm512_storeu_ps(c + ldc + j, c10); _mm512_storeu_ps(c + ldc + j + 16u, c11);
+        _mm512_storeu_ps(c + 2u * ldc + j, c20); _mm512_storeu_ps(c + 2u * ldc + j + 16u, c21);
+        _mm512_storeu_ps(c + 3u * ldc + j, c30); _mm512_storeu_ps(c + 3u * ldc + j + 16u, c31);
+    }
+    for (; j + 16u <= n; j += 16u) {
+        __m512 c0 = _mm512_loadu_ps(c + j), c1 = _mm512_loadu_ps(c + ldc + j);
+        __m512 c2 = _mm512_loadu_ps(c + 2u * ldc + j), c3 = _mm512_loadu_ps(c + 3u * ldc + j);
+        const float* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            __m512 const bv = _mm512_loadu_ps(bp);
+            c0 = _mm512_fmadd_ps(_mm512_set1_ps(a[p]), bv, c0);
+            c1 = _mm512_fmadd_ps(_mm512_set1_ps(a[lda + p]), bv, c1);
+            c2 = _mm512_fmadd_ps(_mm512_set1_ps(a[2u * lda + p]), bv, c2);
+            c3 = _mm512_fmadd_ps(_mm512_set1_ps(a[3u * lda + p]), bv, c3);
+        }
+        _mm512_storeu_ps(c + j, c0); _mm512_storeu_ps(c + ldc + j, c1);
+        _mm512_storeu_ps(c + 2u * ldc + j, c2); _mm512_storeu_ps(c + 3u * ldc + j, c3);
+    }
+    for (; j < n; j++) {
+        float s0 = c[j], s1 = c[ldc + j], s2 = c[2u * ldc + j], s3 = c[3u * ldc + j];
+        const float* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            s0 += a[p]            * *bp;
+            s1 += a[lda + p]      * *bp;
+            s2 += a[2u * lda + p] * *bp;
+            s3 += a[3u * lda + p] * *bp;
+        }
+        c[j] = s0; c[ldc + j] = s1; c[2u * ldc + j] = s2; c[3u * ldc + j] = s3;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* sum of val[i] * x[idx[i]]: the sparse row (or column) dot product.
+ * The 64-bit indices feed the hardware gather directly */
+static float simd_spdot_float(const float*  val,
+                              const size_t* idx,
+                              const float*  x,
+                              size_t        len) {
+    /* Eight 64-bit indices gather eight floats, so accumulate in 256-bit
+     * halves rather than widening every gather */
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m512i const i0 = _mm512_loadu_si512((const void*)(idx + i));
+        __m512i const i1 = _mm512_loadu_si512((const void*)(idx + i + 8u));
+        acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(val + i),
+                                                 _mm512_i64gather_ps(i0, x, 4)));
+        acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(val + i + 8u),
+                                                 _mm512_i64gather_ps(i1, x, 4)));
+    }
+    acc0 = _mm256_add_ps(acc0, acc1);
+    for (; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu : (__mmask8)((1u << rem) - 1u);
+        __m512i const iv = _mm512_maskz_loadu_epi64(k, idx + i);
+        __m256 const g = _mm512_mask_i64gather_ps(_mm256_setzero_ps(), k, iv, x, 4);
+        acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_maskz_loadu_ps(k, val + i), g));
+    }
+
+    float lanes[8];
+    _mm256_storeu_ps(lanes, acc0);
+    float sum = 0.0f;
+    for (size_t w = 0u; w < 8u; w++) sum += lanes[w];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+/* Loads the 8 x 8 block at s (stride lds) and leaves its transpose in
+ * r[0..7], one destination row per register: unpack, shuffle, then a
+ * 128-bit lane permute. */
+static inline void _avx512_transpose8_ps(__m256 r[8], const float* s, size_t lds) {
+    __m256 t[8];
+    for (size_t k = 0u; k < 8u; k++) r[k] = _mm256_loadu_ps(s + k * lds);
+    for (size_t k = 0u; k < 8u; k += 2u) {
+        t[k]      = _mm256_unpacklo_ps(r[k], r[k + 1u]);
+        t[k + 1u] = _mm256_unpackhi_ps(r[k], r[k + 1u]);
+    }
+    for (size_t k = 0u; k < 8u; k += 4u) {
+        r[k]      = _mm256_shuffle_ps(t[k],      t[k + 2u], _MM_SHUFFLE(1, 0, 1, 0));
+        r[k + 1u] = _mm256_shuffle_ps(t[k],      t[k + 2u], _MM_SHUFFLE(3, 2, 3, 2));
+        r[k + 2u] = _mm256_shuffle_ps(t[k + 1u], t[k + 3u], _MM_SHUFFLE(1, 0, 1, 0));
+        r[k + 3u] = _mm256_shuffle_ps(t[k + 1u], t[k + 3u], _MM_SHUFFLE(3, 2, 3, 2));
+    }
+    for (size_t k = 0u; k < 4u; k++) {
+        t[k]      = _mm256_permute2f128_ps(r[k], r[k + 4u], 0x20);
+        t[k + 4u] = _mm256_permute2f128_ps(r[k], r[k + 4u], 0x31);
+    }
+    for (size_t k = 0u; k < 8u; k++) r[k] = t[k];
+}
+// --------------------------------------------------------------------------------
+
+/* dst[j * ldd + i] = src[i * lds + j] for i < rows, j < cols: one cache
+ * tile of a matrix transpose.  8 x 8 blocks are transposed in 256-bit
+ * registers; 16-wide blocks would need a 16-row tile edge for little gain. */
+static void simd_transpose_float(float*       dst,
+                                 size_t       ldd,
+                                 const float* src,
+                                 size_t       lds,
+                                 size_t       rows,
+                                 size_t       cols) {
+    size_t i = 0u;
+    for (; i + 8u <= rows; i += 8u) {
+        size_t j = 0u;
+        for (; j + 8u <= cols; j += 8u) {
+            const float* s = src + i * lds + j;
+            float*       d = dst + j * ldd + i;
+            __m256 r[8];
+            _avx512_transpose8_ps(r, s, lds);
+            for (size_t k = 0u; k < 8u; k++) _mm256_storeu_ps(d + k * ldd, r[k]);
+        }
+        for (; j < cols; j++)
+            for (size_t q = 0u; q < 8u; q++)
+                dst[j * ldd + i + q] = src[(i + q) * lds + j];
+    }
+    for (; i < rows; i++)
+        for (size_t j = 0u; j < cols; j++)
+            dst[j * ldd + i] = src[i * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* The same transpose for one band of 16 source rows: dst[j * ldd + q] =
+ * src[q * lds + j] for q < 16, j < cols.  Two 8 x 8 blocks stacked in the
+ * band fill a whole 64-byte destination line, which goes out with
+ * non-temporal stores so the destination is never read into the cache.
+ * dst must be 64-byte aligned and ldd a multiple of 16; the band ends with
+ * a fence. */
+static void simd_transpose_stream_float(float*       dst,
+                                        size_t       ldd,
+                                        const float* src,
+                                        size_t       lds,
+                                        size_t       cols) {
+    size_t j = 0u;
+    for (; j + 8u <= cols; j += 8u) {
+        __m256 a[8], b[8];
+        _avx512_transpose8_ps(a, src + j, lds);
+        _avx512_transpose8_ps(b, src + 8u * lds + j, lds);
+        float* d = dst + j * ldd;
+        for (size_t k = 0u; k < 8u; k++) {
+            _mm256_stream_ps(d + k * ldd,      a[k]);
+            _mm256_stream_ps(d + k * ldd + 8u, b[k]);
+        }
+    }
+    _mm_sfence();
+    for (; j < cols; j++)
+        for (size_t q = 0u; q < 16u; q++)
+            dst[j * ldd + q] = src[q * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* y[r] += sum over blocks b < nb of row r of block b dotted with
+ * x + col[b] * bc, for r < rows: one block row of a BSR SpMV.  Blocks are
+ * br x bc, row-major and packed back to back.  Block rows are dotted 16
+ * lanes at a time under a load mask, so narrow blocks need no scalar tail. */
+static void simd_bsr_float(float*        y,
+                           const float*  val,
+                           const size_t* col,
+                           const float*  x,
+                           size_t        nb,
+                           size_t        rows,
+                           size_t        br,
+                           size_t        bc) {
+    for (size_t r = 0u; r < rows; r++) {
+        __m512 acc = _mm512_setzero_ps();
+        for (size_t b = 0u; b < nb; b++) {
+            const float* a  = val + (b * br + r) * bc;
+            const float* xb = x + col[b] * bc;
+            for (size_t k = 0u; k < bc; k += 16u) {
+                size_t const rem = bc - k;
+                __mmask16 const m = (rem >= 16u) ? (__mmask16)0xFFFFu : (__mmask16)((1u << rem) - 1u);
+                acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, a + k), _mm512_maskz_loadu_ps(m, xb + k), acc);
+            }
+        }
+        y[r] += _mm512_reduce_add_ps(acc);
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* y[i] = sum over j < width of val[j * chunk + i] * x[idx[j * chunk + i]]
+ * for i < chunk: one slice of a SELL-C-sigma SpMV.  The slice is stored
+ * column by column, so consecutive lanes hold consecutive rows.  8 rows
+ * per register under a lane mask, so any chunk height needs no scalar
+ * tail. */
+static void simd_sell_float(float*        y,
+                            const float*  val,
+                            const size_t* idx,
+                            const float*  x,
+                            size_t        chunk,
+                            size_t        width) {
+    /* Eight 64-bit indices gather eight floats, so lanes go eight at a
+     * time in 256-bit registers */
+    for (size_t i = 0u; i < chunk; i += 8u) {
+        size_t const rem = chunk - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu : (__mmask8)((1u << rem) - 1u);
+        __m256 acc = _mm256_setzero_ps();
+        for (size_t j = 0u; j < width; j++) {
+            __m512i const iv = _mm512_maskz_loadu_epi64(k, idx + j * chunk + i);
+            __m256 const g = _mm512_mask_i64gather_ps(_mm256_setzero_ps(), k, iv, x, 4);
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_maskz_loadu_ps(k, val + j * chunk + i), g));
+        }
+        _mm256_mask_storeu_ps(y + i, k, acc);
+    }
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX512_FLOAT_INL */
 
@@ -101,6 +101,121 @@ static inline error_code_t simd_min_int16(const int16_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int16(int16_t*       out,
+                             const int16_t* a,
+                             int16_t        lo,
+                             int16_t        hi,
+                             size_t         len) {
+    __m512i const vlo = _mm512_set1_epi16((short)lo);
+    __m512i const vhi = _mm512_set1_epi16((short)hi);
+    for (size_t i = 0u; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi16(k, a + i);
+        x = _mm512_max_epi16(vlo, _mm512_min_epi16(x, vhi));
+        _mm512_mask_storeu_epi16(out + i, k, x);
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int16(int16_t*       out,
+                           const int16_t* a,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi16(k, a + i);
+        _mm512_mask_storeu_epi16(out + i, k, _mm512_abs_epi16(x));
+    }
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int16(const int16_t* data,
+                                   size_t         len,
+                                   int16_t*       out) {
+    int16_t cur = *out;   /* caller seeds with INT16_MIN */
+    __m512i vmax = _mm512_set1_epi16((short)cur);
+
+    /* Inactive lanes load the running maximum, so they never win */
+    for (size_t i = 0u; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_mask_loadu_epi16(vmax, k, data + i);
+        vmax = _mm512_max_epi16(vmax, x);
+    }
+
+    int16_t lanes[32];
+    _mm512_storeu_si512(lanes, vmax);
+    for (size_t k = 0u; k < 32u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int16(const int16_t* data,
+                              size_t         len) {
+    __m512i const zero = _mm512_setzero_si512();
+    __m512i const ones = _mm512_set1_epi16(1);
+    __m512i acc        = zero;
+    size_t  i          = 0u;
+
+    /* madd against ones sums 16-bit pairs into 32-bit lanes, which are
+     * then sign-extended into the 64-bit accumulator */
+    for (; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_madd_epi16(_mm512_maskz_loadu_epi16(k, data + i), ones);
+        __m512i s = _mm512_srai_epi32(x, 31);
+        acc = _mm512_add_epi64(acc, _mm512_unpacklo_epi32(x, s));
+        acc = _mm512_add_epi64(acc, _mm512_unpackhi_epi32(x, s));
+    }
+    return (int64_t)_mm512_reduce_add_epi64(acc);
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int16(int16_t*       out,
+                               const int16_t* a,
+                               const int16_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi16(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi16(k, b + i);
+        _mm512_mask_storeu_epi16(out + i, k, _mm512_min_epi16(y, x));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int16(int16_t*       out,
+                               const int16_t* a,
+                               const int16_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi16(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi16(k, b + i);
+        _mm512_mask_storeu_epi16(out + i, k, _mm512_max_epi16(y, x));
+    }
+}
 
 #endif /* SIMD_AVX512_MIN_INT16_INL */
 // ================================================================================
@@ -104,6 +104,119 @@ static inline error_code_t simd_min_int32(const int32_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int32(int32_t*       out,
+                             const int32_t* a,
+                             int32_t        lo,
+                             int32_t        hi,
+                             size_t         len) {
+    __m512i const vlo = _mm512_set1_epi32((int)lo);
+    __m512i const vhi = _mm512_set1_epi32((int)hi);
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi32(k, a + i);
+        x = _mm512_max_epi32(vlo, _mm512_min_epi32(x, vhi));
+        _mm512_mask_storeu_epi32(out + i, k, x);
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int32(int32_t*       out,
+                           const int32_t* a,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi32(k, a + i);
+        _mm512_mask_storeu_epi32(out + i, k, _mm512_abs_epi32(x));
+    }
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int32(const int32_t* data,
+                                   size_t         len,
+                                   int32_t*       out) {
+    int32_t cur = *out;   /* caller seeds with INT32_MIN */
+    __m512i vmax = _mm512_set1_epi32((int)cur);
+
+    /* Inactive lanes load the running maximum, so they never win */
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_mask_loadu_epi32(vmax, k, data + i);
+        vmax = _mm512_max_epi32(vmax, x);
+    }
+
+    int32_t lanes[16];
+    _mm512_storeu_si512(lanes, vmax);
+    for (size_t k = 0u; k < 16u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int32(const int32_t* data,
+                              size_t         len) {
+    __m512i const zero = _mm512_setzero_si512();
+    __m512i acc        = zero;
+    size_t  i          = 0u;
+
+    /* Widen each 32-bit lane to 64 bits before accumulating */
+    for (; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi32(k, data + i);
+        __m512i s = _mm512_srai_epi32(x, 31);
+        acc = _mm512_add_epi64(acc, _mm512_unpacklo_epi32(x, s));
+        acc = _mm512_add_epi64(acc, _mm512_unpackhi_epi32(x, s));
+    }
+    return (int64_t)_mm512_reduce_add_epi64(acc);
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int32(int32_t*       out,
+                               const int32_t* a,
+                               const int32_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi32(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi32(k, b + i);
+        _mm512_mask_storeu_epi32(out + i, k, _mm512_min_epi32(y, x));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int32(int32_t*       out,
+                               const int32_t* a,
+                               const int32_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi32(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi32(k, b + i);
+        _mm512_mask_storeu_epi32(out + i, k, _mm512_max_epi32(y, x));
+    }
+}
 
 #endif /* SIMD_AVX512_MIN_INT32_INL */
 // ================================================================================
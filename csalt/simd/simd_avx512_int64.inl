@@ -70,6 +70,99 @@ static inline error_code_t simd_min_int64(const int64_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int64(int64_t*       out,
+                             const int64_t* a,
+                             int64_t        lo,
+                             int64_t        hi,
+                             size_t         len) {
+    __m512i const vlo = _mm512_set1_epi64((long long)lo);
+    __m512i const vhi = _mm512_set1_epi64((long long)hi);
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi64(k, a + i);
+        x = _mm512_max_epi64(vlo, _mm512_min_epi64(x, vhi));
+        _mm512_mask_storeu_epi64(out + i, k, x);
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int64(int64_t*       out,
+                           const int64_t* a,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi64(k, a + i);
+        _mm512_mask_storeu_epi64(out + i, k, _mm512_abs_epi64(x));
+    }
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int64(const int64_t* data,
+                                   size_t         len,
+                                   int64_t*       out) {
+    int64_t cur = *out;   /* caller seeds with INT64_MIN */
+    __m512i vmax = _mm512_set1_epi64((long long)cur);
+
+    /* Inactive lanes load the running maximum, so they never win */
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512i x = _mm512_mask_loadu_epi64(vmax, k, data + i);
+        vmax = _mm512_max_epi64(vmax, x);
+    }
+
+    int64_t lanes[8];
+    _mm512_storeu_si512(lanes, vmax);
+    for (size_t k = 0u; k < 8u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    *out = cur;
+    return NO_ERROR;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int64(int64_t*       out,
+                               const int64_t* a,
+                               const int64_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi64(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi64(k, b + i);
+        _mm512_mask_storeu_epi64(out + i, k, _mm512_min_epi64(y, x));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int64(int64_t*       out,
+                               const int64_t* a,
+                               const int64_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi64(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi64(k, b + i);
+        _mm512_mask_storeu_epi64(out + i, k, _mm512_max_epi64(y, x));
+    }
+}
 
 #endif /* SIMD_AVX512_MIN_INT64_INL */
 // ================================================================================
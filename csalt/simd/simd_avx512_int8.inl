@@ -117,6 +117,121 @@ static inline error_code_t simd_min_int8(const int8_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int8(int8_t*       out,
+                            const int8_t* a,
+                            int8_t        lo,
+                            int8_t        hi,
+                            size_t        len) {
+    __m512i const vlo = _mm512_set1_epi8((char)lo);
+    __m512i const vhi = _mm512_set1_epi8((char)hi);
+    for (size_t i = 0u; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi8(k, a + i);
+        x = _mm512_max_epi8(vlo, _mm512_min_epi8(x, vhi));
+        _mm512_mask_storeu_epi8(out + i, k, x);
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int8(int8_t*       out,
+                          const int8_t* a,
+                          size_t        len) {
+    for (size_t i = 0u; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi8(k, a + i);
+        _mm512_mask_storeu_epi8(out + i, k, _mm512_abs_epi8(x));
+    }
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int8(const int8_t* data,
+                                  size_t        len,
+                                  int8_t*       out) {
+    int8_t cur = *out;   /* caller seeds with INT8_MIN */
+    __m512i vmax = _mm512_set1_epi8((char)cur);
+
+    /* Inactive lanes load the running maximum, so they never win */
+    for (size_t i = 0u; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i x = _mm512_mask_loadu_epi8(vmax, k, data + i);
+        vmax = _mm512_max_epi8(vmax, x);
+    }
+
+    int8_t lanes[64];
+    _mm512_storeu_si512(lanes, vmax);
+    for (size_t k = 0u; k < 64u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int8(const int8_t* data,
+                             size_t        len) {
+    __m512i const zero = _mm512_setzero_si512();
+    __m512i const bias = _mm512_set1_epi8((char)0x80);
+    __m512i acc        = zero;
+    size_t  i          = 0u;
+
+    /* Bias each byte into 0..255 so SAD can sum it, then take 128 back
+     * off for every biased byte */
+    for (; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i x = _mm512_xor_si512(_mm512_maskz_loadu_epi8(k, data + i), bias);
+        acc = _mm512_add_epi64(acc, _mm512_sad_epu8(x, zero));
+    }
+    /* i now counts the zero-filled inactive lanes too, which were biased
+     * like the rest */
+    return (int64_t)(_mm512_reduce_add_epi64(acc) - 128 * (int64_t)i);
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int8(int8_t*       out,
+                              const int8_t* a,
+                              const int8_t* b,
+                              size_t        len) {
+    for (size_t i = 0u; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi8(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi8(k, b + i);
+        _mm512_mask_storeu_epi8(out + i, k, _mm512_min_epi8(y, x));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int8(int8_t*       out,
+                              const int8_t* a,
+                              const int8_t* b,
+                              size_t        len) {
+    for (size_t i = 0u; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi8(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi8(k, b + i);
+        _mm512_mask_storeu_epi8(out + i, k, _mm512_max_epi8(y, x));
+    }
+}
 
 #endif /* SIMD_AVX512_MIN_INT8_INL */
 // ================================================================================
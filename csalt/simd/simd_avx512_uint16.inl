@@ -32,6 +32,7 @@
 #include <immintrin.h>   /* AVX-512 */
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -168,5 +169,213 @@ static inline error_code_t simd_min_uint16(const uint16_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi16(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi16(k, b + i);
+        _mm512_mask_storeu_epi16(out + i, k, _mm512_add_epi16(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi16(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi16(k, b + i);
+        _mm512_mask_storeu_epi16(out + i, k, _mm512_sub_epi16(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi16(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi16(k, b + i);
+        _mm512_mask_storeu_epi16(out + i, k, _mm512_mullo_epi16(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint16(uint16_t*       out,
+                               const uint16_t* a,
+                               uint16_t        mul,
+                               uint16_t        add,
+                               size_t          len) {
+    __m512i const vmul = _mm512_set1_epi16((short)mul);
+    __m512i const vadd = _mm512_set1_epi16((short)add);
+    for (size_t i = 0u; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi16(k, a + i);
+        x = _mm512_mullo_epi16(x, vmul);
+        _mm512_mask_storeu_epi16(out + i, k, _mm512_add_epi16(x, vadd));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint16(uint16_t*       out,
+                              const uint16_t* a,
+                              uint16_t        lo,
+                              uint16_t        hi,
+                              size_t          len) {
+    __m512i const vlo = _mm512_set1_epi16((short)lo);
+    __m512i const vhi = _mm512_set1_epi16((short)hi);
+    for (size_t i = 0u; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi16(k, a + i);
+        x = _mm512_max_epu16(vlo, _mm512_min_epu16(x, vhi));
+        _mm512_mask_storeu_epi16(out + i, k, x);
+    }
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint16(const uint16_t* data,
+                                    size_t          len,
+                                    uint16_t*       out) {
+    uint16_t cur = *out;   /* caller seeds with 0 */
+    __m512i vmax = _mm512_set1_epi16((short)cur);
+
+    /* Inactive lanes load the running maximum, so they never win */
+    for (size_t i = 0u; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_mask_loadu_epi16(vmax, k, data + i);
+        vmax = _mm512_max_epu16(vmax, x);
+    }
+
+    uint16_t lanes[32];
+    _mm512_storeu_si512(lanes, vmax);
+    for (size_t k = 0u; k < 32u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint16(const uint16_t* data,
+                                size_t          len) {
+    __m512i const zero = _mm512_setzero_si512();
+    __m512i const bias = _mm512_set1_epi16((short)0x8000);
+    __m512i const ones = _mm512_set1_epi16(1);
+    __m512i acc        = zero;
+    size_t  i          = 0u;
+
+    /* Bias into signed range so madd can sum 16-bit pairs into 32-bit
+     * lanes; 32768 per element is added back at the end */
+    for (; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_madd_epi16(_mm512_xor_si512(_mm512_maskz_loadu_epi16(k, data + i), bias), ones);
+        __m512i s = _mm512_srai_epi32(x, 31);
+        acc = _mm512_add_epi64(acc, _mm512_unpacklo_epi32(x, s));
+        acc = _mm512_add_epi64(acc, _mm512_unpackhi_epi32(x, s));
+    }
+    /* i now counts the zero-filled inactive lanes too, which were biased
+     * like the rest */
+    return (uint64_t)(_mm512_reduce_add_epi64(acc) + 32768 * (int64_t)i);
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint16(uint16_t*       out,
+                                const uint16_t* a,
+                                const uint16_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi16(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi16(k, b + i);
+        _mm512_mask_storeu_epi16(out + i, k, _mm512_min_epu16(y, x));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint16(uint16_t*       out,
+                                const uint16_t* a,
+                                const uint16_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi16(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi16(k, b + i);
+        _mm512_mask_storeu_epi16(out + i, k, _mm512_max_epu16(y, x));
+    }
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 32 lanes of x */
+static inline __m512i _avx512_scan_epi16(__m512i x) {
+    __m512i const z = _mm512_setzero_si512();
+    /* byte shifts within each 128-bit lane take their carry-in from the
+     * lane below, moved up by alignr_epi64 */
+    x = _mm512_add_epi16(x, _mm512_alignr_epi8(x, _mm512_alignr_epi64(x, z, 6), 14));
+    x = _mm512_add_epi16(x, _mm512_alignr_epi8(x, _mm512_alignr_epi64(x, z, 6), 12));
+    x = _mm512_add_epi16(x, _mm512_alignr_epi8(x, _mm512_alignr_epi64(x, z, 6), 8));
+    x = _mm512_add_epi16(x, _mm512_alignr_epi64(x, z, 6));
+    x = _mm512_add_epi16(x, _mm512_alignr_epi64(x, z, 4));
+    return x;
+}
+// --------------------------------------------------------------------------------
+
+static uint16_t simd_scan_uint16(uint16_t*       out,
+                                 const uint16_t* a,
+                                 size_t          len,
+                                 uint16_t        carry,
+                                 bool            exclusive) {
+    /* cv holds the running total in every lane; the exclusive sums are
+     * r - x, which is exact under wrapping arithmetic */
+    __m512i const last = _mm512_set1_epi16(31);
+    __m512i cv = _mm512_set1_epi16((short)carry);
+    for (size_t i = 0u; i < len; i += 32u) {
+        size_t const rem = len - i;
+        __mmask32 const k = (rem >= 32u) ? (__mmask32)0xFFFFFFFFu
+                                         : (__mmask32)((1ull << rem) - 1u);
+        __m512i const x = _mm512_maskz_loadu_epi16(k, a + i);
+        __m512i const p = _avx512_scan_epi16(x);
+        __m512i const r = _mm512_add_epi16(p, cv);
+        __m512i const y = exclusive ? _mm512_sub_epi16(r, x) : r;
+        _mm512_mask_storeu_epi16(out + i, k, y);
+        cv = _mm512_permutexvar_epi16(last, r);
+    }
+    /* masked-off lanes load as zero, so after the last vector every lane
+     * of cv holds the total */
+    return (uint16_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(cv));
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX512_UINT16_INL */
 
@@ -32,6 +32,7 @@
 #include <immintrin.h>   /* AVX-512 */
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -181,5 +182,204 @@ static inline error_code_t simd_min_uint32(const uint32_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi32(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi32(k, b + i);
+        _mm512_mask_storeu_epi32(out + i, k, _mm512_add_epi32(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi32(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi32(k, b + i);
+        _mm512_mask_storeu_epi32(out + i, k, _mm512_sub_epi32(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi32(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi32(k, b + i);
+        _mm512_mask_storeu_epi32(out + i, k, _mm512_mullo_epi32(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint32(uint32_t*       out,
+                               const uint32_t* a,
+                               uint32_t        mul,
+                               uint32_t        add,
+                               size_t          len) {
+    __m512i const vmul = _mm512_set1_epi32((int)mul);
+    __m512i const vadd = _mm512_set1_epi32((int)add);
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi32(k, a + i);
+        x = _mm512_mullo_epi32(x, vmul);
+        _mm512_mask_storeu_epi32(out + i, k, _mm512_add_epi32(x, vadd));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint32(uint32_t*       out,
+                              const uint32_t* a,
+                              uint32_t        lo,
+                              uint32_t        hi,
+                              size_t          len) {
+    __m512i const vlo = _mm512_set1_epi32((int)lo);
+    __m512i const vhi = _mm512_set1_epi32((int)hi);
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi32(k, a + i);
+        x = _mm512_max_epu32(vlo, _mm512_min_epu32(x, vhi));
+        _mm512_mask_storeu_epi32(out + i, k, x);
+    }
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint32(const uint32_t* data,
+                                    size_t          len,
+                                    uint32_t*       out) {
+    uint32_t cur = *out;   /* caller seeds with 0 */
+    __m512i vmax = _mm512_set1_epi32((int)cur);
+
+    /* Inactive lanes load the running maximum, so they never win */
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_mask_loadu_epi32(vmax, k, data + i);
+        vmax = _mm512_max_epu32(vmax, x);
+    }
+
+    uint32_t lanes[16];
+    _mm512_storeu_si512(lanes, vmax);
+    for (size_t k = 0u; k < 16u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint32(const uint32_t* data,
+                                size_t          len) {
+    __m512i const zero = _mm512_setzero_si512();
+    __m512i acc        = zero;
+    size_t  i          = 0u;
+
+    /* Zero-extend each 32-bit lane to 64 bits before accumulating */
+    for (; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi32(k, data + i);
+        acc = _mm512_add_epi64(acc, _mm512_unpacklo_epi32(x, zero));
+        acc = _mm512_add_epi64(acc, _mm512_unpackhi_epi32(x, zero));
+    }
+    return (uint64_t)_mm512_reduce_add_epi64(acc);
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint32(uint32_t*       out,
+                                const uint32_t* a,
+                                const uint32_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi32(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi32(k, b + i);
+        _mm512_mask_storeu_epi32(out + i, k, _mm512_min_epu32(y, x));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint32(uint32_t*       out,
+                                const uint32_t* a,
+                                const uint32_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi32(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi32(k, b + i);
+        _mm512_mask_storeu_epi32(out + i, k, _mm512_max_epu32(y, x));
+    }
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 16 lanes of x */
+static inline __m512i _avx512_scan_epi32(__m512i x) {
+    __m512i const z = _mm512_setzero_si512();
+    x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, z, 15));
+    x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, z, 14));
+    x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, z, 12));
+    x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, z, 8));
+    return x;
+}
+// --------------------------------------------------------------------------------
+
+static uint32_t simd_scan_uint32(uint32_t*       out,
+                                 const uint32_t* a,
+                                 size_t          len,
+                                 uint32_t        carry,
+                                 bool            exclusive) {
+    /* cv holds the running total in every lane; the exclusive sums are
+     * r - x, which is exact under wrapping arithmetic */
+    __m512i const last = _mm512_set1_epi32(15);
+    __m512i cv = _mm512_set1_epi32((int)carry);
+    for (size_t i = 0u; i < len; i += 16u) {
+        size_t const rem = len - i;
+        __mmask16 const k = (rem >= 16u) ? (__mmask16)0xFFFFu
+                                         : (__mmask16)((1u << rem) - 1u);
+        __m512i const x = _mm512_maskz_loadu_epi32(k, a + i);
+        __m512i const p = _avx512_scan_epi32(x);
+        __m512i const r = _mm512_add_epi32(p, cv);
+        __m512i const y = exclusive ? _mm512_sub_epi32(r, x) : r;
+        _mm512_mask_storeu_epi32(out + i, k, y);
+        cv = _mm512_permutexvar_epi32(last, r);
+    }
+    /* masked-off lanes load as zero, so after the last vector every lane
+     * of cv holds the total */
+    return (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(cv));
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX512_UINT32_INL */
 
@@ -32,6 +32,7 @@
 #include <immintrin.h>   /* AVX-512 */
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -153,5 +154,195 @@ static inline error_code_t simd_min_uint64(const uint64_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+/* Low 64 bits of a 64 x 64 product built from 32-bit multiplies, since
+ * this tier does not assume AVX512DQ: lo*lo + ((hi*lo + lo*hi) << 32). */
+static inline __m512i _avx512_mullo_epi64(__m512i a, __m512i b) {
+    __m512i lo  = _mm512_mul_epu32(a, b);
+    __m512i mid = _mm512_add_epi64(_mm512_mul_epu32(_mm512_srli_epi64(a, 32), b),
+                                   _mm512_mul_epu32(a, _mm512_srli_epi64(b, 32)));
+    return _mm512_add_epi64(lo, _mm512_slli_epi64(mid, 32));
+}
+// --------------------------------------------------------------------------------
+
+static void simd_add_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi64(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi64(k, b + i);
+        _mm512_mask_storeu_epi64(out + i, k, _mm512_add_epi64(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi64(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi64(k, b + i);
+        _mm512_mask_storeu_epi64(out + i, k, _mm512_sub_epi64(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi64(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi64(k, b + i);
+        _mm512_mask_storeu_epi64(out + i, k, _avx512_mullo_epi64(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint64(uint64_t*       out,
+                               const uint64_t* a,
+                               uint64_t        mul,
+                               uint64_t        add,
+                               size_t          len) {
+    __m512i const vmul = _mm512_set1_epi64((long long)mul);
+    __m512i const vadd = _mm512_set1_epi64((long long)add);
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi64(k, a + i);
+        x = _avx512_mullo_epi64(x, vmul);
+        _mm512_mask_storeu_epi64(out + i, k, _mm512_add_epi64(x, vadd));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint64(uint64_t*       out,
+                              const uint64_t* a,
+                              uint64_t        lo,
+                              uint64_t        hi,
+                              size_t          len) {
+    __m512i const vlo = _mm512_set1_epi64((long long)lo);
+    __m512i const vhi = _mm512_set1_epi64((long long)hi);
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi64(k, a + i);
+        x = _mm512_max_epu64(vlo, _mm512_min_epu64(x, vhi));
+        _mm512_mask_storeu_epi64(out + i, k, x);
+    }
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint64(const uint64_t* data,
+                                    size_t          len,
+                                    uint64_t*       out) {
+    uint64_t cur = *out;   /* caller seeds with 0 */
+    __m512i vmax = _mm512_set1_epi64((long long)cur);
+
+    /* Inactive lanes load the running maximum, so they never win */
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512i x = _mm512_mask_loadu_epi64(vmax, k, data + i);
+        vmax = _mm512_max_epu64(vmax, x);
+    }
+
+    uint64_t lanes[8];
+    _mm512_storeu_si512(lanes, vmax);
+    for (size_t k = 0u; k < 8u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    *out = cur;
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint64(uint64_t*       out,
+                                const uint64_t* a,
+                                const uint64_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi64(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi64(k, b + i);
+        _mm512_mask_storeu_epi64(out + i, k, _mm512_min_epu64(y, x));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint64(uint64_t*       out,
+                                const uint64_t* a,
+                                const uint64_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi64(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi64(k, b + i);
+        _mm512_mask_storeu_epi64(out + i, k, _mm512_max_epu64(y, x));
+    }
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 8 lanes of x */
+static inline __m512i _avx512_scan_epi64(__m512i x) {
+    __m512i const z = _mm512_setzero_si512();
+    x = _mm512_add_epi64(x, _mm512_alignr_epi64(x, z, 7));
+    x = _mm512_add_epi64(x, _mm512_alignr_epi64(x, z, 6));
+    x = _mm512_add_epi64(x, _mm512_alignr_epi64(x, z, 4));
+    return x;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_scan_uint64(uint64_t*       out,
+                                 const uint64_t* a,
+                                 size_t          len,
+                                 uint64_t        carry,
+                                 bool            exclusive) {
+    /* cv holds the running total in every lane; the exclusive sums are
+     * r - x, which is exact under wrapping arithmetic */
+    __m512i const last = _mm512_set1_epi64(7);
+    __m512i cv = _mm512_set1_epi64((long long)carry);
+    for (size_t i = 0u; i < len; i += 8u) {
+        size_t const rem = len - i;
+        __mmask8 const k = (rem >= 8u) ? (__mmask8)0xFFu
+                                       : (__mmask8)((1u << rem) - 1u);
+        __m512i const x = _mm512_maskz_loadu_epi64(k, a + i);
+        __m512i const p = _avx512_scan_epi64(x);
+        __m512i const r = _mm512_add_epi64(p, cv);
+        __m512i const y = exclusive ? _mm512_sub_epi64(r, x) : r;
+        _mm512_mask_storeu_epi64(out + i, k, y);
+        cv = _mm512_permutexvar_epi64(last, r);
+    }
+    /* masked-off lanes load as zero, so after the last vector every lane
+     * of cv holds the total */
+    _mm_storel_epi64((__m128i*)&carry, _mm512_castsi512_si128(cv));
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX512_UINT64_INL */
 
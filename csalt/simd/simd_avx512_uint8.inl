@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include <string.h>
 #include <immintrin.h>   /* AVX-512 */
 
@@ -278,5 +279,217 @@ static inline error_code_t simd_min_uint8(const uint8_t* data,
 
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+/* No 8-bit multiply on x86: multiply the even and odd bytes as 16-bit
+ * lanes and keep the low byte of each product. */
+static inline __m512i _avx512_mullo_epi8(__m512i a, __m512i b) {
+    __m512i even = _mm512_mullo_epi16(a, b);
+    __m512i odd  = _mm512_mullo_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8));
+    return _mm512_or_si512(_mm512_slli_epi16(odd, 8),
+                           _mm512_and_si512(even, _mm512_set1_epi16(0x00FF)));
+}
+// --------------------------------------------------------------------------------
+
+static void simd_add_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi8(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi8(k, b + i);
+        _mm512_mask_storeu_epi8(out + i, k, _mm512_add_epi8(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi8(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi8(k, b + i);
+        _mm512_mask_storeu_epi8(out + i, k, _mm512_sub_epi8(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi8(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi8(k, b + i);
+        _mm512_mask_storeu_epi8(out + i, k, _avx512_mullo_epi8(x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint8(uint8_t*       out,
+                              const uint8_t* a,
+                              uint8_t        mul,
+                              uint8_t        add,
+                              size_t         len) {
+    __m512i const vmul = _mm512_set1_epi8((char)mul);
+    __m512i const vadd = _mm512_set1_epi8((char)add);
+    for (size_t i = 0u; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi8(k, a + i);
+        x = _avx512_mullo_epi8(x, vmul);
+        _mm512_mask_storeu_epi8(out + i, k, _mm512_add_epi8(x, vadd));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint8(uint8_t*       out,
+                             const uint8_t* a,
+                             uint8_t        lo,
+                             uint8_t        hi,
+                             size_t         len) {
+    __m512i const vlo = _mm512_set1_epi8((char)lo);
+    __m512i const vhi = _mm512_set1_epi8((char)hi);
+    for (size_t i = 0u; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi8(k, a + i);
+        x = _mm512_max_epu8(vlo, _mm512_min_epu8(x, vhi));
+        _mm512_mask_storeu_epi8(out + i, k, x);
+    }
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint8(const uint8_t* data,
+                                   size_t         len,
+                                   uint8_t*       out) {
+    uint8_t cur = *out;   /* caller seeds with 0 */
+    __m512i vmax = _mm512_set1_epi8((char)cur);
+
+    /* Inactive lanes load the running maximum, so they never win */
+    for (size_t i = 0u; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i x = _mm512_mask_loadu_epi8(vmax, k, data + i);
+        vmax = _mm512_max_epu8(vmax, x);
+    }
+
+    uint8_t lanes[64];
+    _mm512_storeu_si512(lanes, vmax);
+    for (size_t k = 0u; k < 64u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint8(const uint8_t* data,
+                               size_t         len) {
+    __m512i const zero = _mm512_setzero_si512();
+    __m512i acc        = zero;
+    size_t  i          = 0u;
+
+    /* SAD against zero sums each group of eight bytes into a 64-bit lane */
+    for (; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        acc = _mm512_add_epi64(acc, _mm512_sad_epu8(_mm512_maskz_loadu_epi8(k, data + i), zero));
+    }
+    return (uint64_t)_mm512_reduce_add_epi64(acc);
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               const uint8_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi8(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi8(k, b + i);
+        _mm512_mask_storeu_epi8(out + i, k, _mm512_min_epu8(y, x));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               const uint8_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i x = _mm512_maskz_loadu_epi8(k, a + i);
+        __m512i y = _mm512_maskz_loadu_epi8(k, b + i);
+        _mm512_mask_storeu_epi8(out + i, k, _mm512_max_epu8(y, x));
+    }
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 64 lanes of x */
+static inline __m512i _avx512_scan_epi8(__m512i x) {
+    __m512i const z = _mm512_setzero_si512();
+    /* byte shifts within each 128-bit lane take their carry-in from the
+     * lane below, moved up by alignr_epi64 */
+    x = _mm512_add_epi8(x, _mm512_alignr_epi8(x, _mm512_alignr_epi64(x, z, 6), 15));
+    x = _mm512_add_epi8(x, _mm512_alignr_epi8(x, _mm512_alignr_epi64(x, z, 6), 14));
+    x = _mm512_add_epi8(x, _mm512_alignr_epi8(x, _mm512_alignr_epi64(x, z, 6), 12));
+    x = _mm512_add_epi8(x, _mm512_alignr_epi8(x, _mm512_alignr_epi64(x, z, 6), 8));
+    x = _mm512_add_epi8(x, _mm512_alignr_epi64(x, z, 6));
+    x = _mm512_add_epi8(x, _mm512_alignr_epi64(x, z, 4));
+    return x;
+}
+// --------------------------------------------------------------------------------
+
+static uint8_t simd_scan_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               size_t         len,
+                               uint8_t        carry,
+                               bool           exclusive) {
+    /* cv holds the running total in every lane; the exclusive sums are
+     * r - x, which is exact under wrapping arithmetic */
+    __m512i const last = _mm512_set1_epi8(15);
+    __m512i cv = _mm512_set1_epi8((char)carry);
+    for (size_t i = 0u; i < len; i += 64u) {
+        size_t const rem = len - i;
+        __mmask64 const k = (rem >= 64u) ? (__mmask64)0xFFFFFFFFFFFFFFFFull
+                                         : (__mmask64)((1ull << rem) - 1u);
+        __m512i const x = _mm512_maskz_loadu_epi8(k, a + i);
+        __m512i const p = _avx512_scan_epi8(x);
+        __m512i const r = _mm512_add_epi8(p, cv);
+        __m512i const y = exclusive ? _mm512_sub_epi8(r, x) : r;
+        _mm512_mask_storeu_epi8(out + i, k, y);
+        __m512i const h = _mm512_shuffle_epi8(r, last);
+        cv = _mm512_shuffle_i32x4(h, h, 0xFF);
+    }
+    /* masked-off lanes load as zero, so after the last vector every lane
+     * of cv holds the total */
+    return (uint8_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(cv));
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX512_UINT8_INL */
 
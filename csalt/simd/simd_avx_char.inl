@@ -211,7 +211,7 @@ static inline size_t simd_find_substr_u8(const uint8_t* hay,
 }
 // -------------------------------------------------------------------------------- 
 
-static inline size_t simd_token_count_u8(const char* s, size_t n,
+static inline size_t simd_token_count_u8(const uint8_t* s, size_t n,
                                          const char* delim, size_t dlen) {
     if ((s == NULL) || (delim == NULL)) return SIZE_MAX;
     if (n == 0u) return 0u;
@@ -260,38 +260,43 @@ static inline size_t simd_token_count_u8(const char* s, size_t n,
 }
 // -------------------------------------------------------------------------------- 
 
-static inline __m256i blendv_epi8_256(__m256i a, __m256i b, __m256i mask)
+/* Plain AVX has no 256-bit integer arithmetic (that arrives with AVX2), so
+ * the case-mapping loops work on two 128-bit halves per 32-byte block. */
+static inline __m128i blendv_epi8_128(__m128i a, __m128i b, __m128i mask)
 {
-    return _mm256_or_si256(_mm256_andnot_si256(mask, a),
-                           _mm256_and_si256(mask, b));
+    return _mm_or_si128(_mm_andnot_si128(mask, a),
+                        _mm_and_si128(mask, b));
 }
 
 /* Mask for ASCII range [lo, hi] (safe for ASCII because bytes are < 0x80). */
-static inline __m256i ascii_range_mask_256(__m256i x, __m256i lo, __m256i hi)
+static inline __m128i ascii_range_mask_128(__m128i x, __m128i lo, __m128i hi)
 {
-    const __m256i one = _mm256_set1_epi8(1);
+    const __m128i one = _mm_set1_epi8(1);
 
     /* x > lo-1  &&  hi+1 > x  (signed compares OK for ASCII ranges) */
-    __m256i ge_lo = _mm256_cmpgt_epi8(x, _mm256_sub_epi8(lo, one));
-    __m256i le_hi = _mm256_cmpgt_epi8(_mm256_add_epi8(hi, one), x);
-    return _mm256_and_si256(ge_lo, le_hi);
+    __m128i ge_lo = _mm_cmpgt_epi8(x, _mm_sub_epi8(lo, one));
+    __m128i le_hi = _mm_cmpgt_epi8(_mm_add_epi8(hi, one), x);
+    return _mm_and_si128(ge_lo, le_hi);
 }
 
-void simd_ascii_upper_u8(uint8_t* p, size_t n)
+static inline void simd_ascii_upper_u8(uint8_t* p, size_t n)
 {
     if ((p == NULL) || (n == 0u)) return;
 
     size_t i = 0u;
-    const __m256i lo  = _mm256_set1_epi8('a');
-    const __m256i hi  = _mm256_set1_epi8('z');
-    const __m256i sub = _mm256_set1_epi8(0x20);
+    const __m128i lo  = _mm_set1_epi8('a');
+    const __m128i hi  = _mm_set1_epi8('z');
+    const __m128i sub = _mm_set1_epi8(0x20);
 
     for (; i + 32u <= n; i += 32u) {
-        __m256i v    = _mm256_loadu_si256((const __m256i*)(const void*)(p + i));
-        __m256i mask = ascii_range_mask_256(v, lo, hi);
-        __m256i up   = _mm256_sub_epi8(v, sub);
-        __m256i out  = blendv_epi8_256(v, up, mask);
-        _mm256_storeu_si256((__m256i*)(void*)(p + i), out);
+        __m128i v0 = _mm_loadu_si128((const __m128i*)(const void*)(p + i));
+        __m128i v1 = _mm_loadu_si128((const __m128i*)(const void*)(p + i + 16u));
+        __m128i o0 = blendv_epi8_128(v0, _mm_sub_epi8(v0, sub),
+                                     ascii_range_mask_128(v0, lo, hi));
+        __m128i o1 = blendv_epi8_128(v1, _mm_sub_epi8(v1, sub),
+                                     ascii_range_mask_128(v1, lo, hi));
+        _mm_storeu_si128((__m128i*)(void*)(p + i), o0);
+        _mm_storeu_si128((__m128i*)(void*)(p + i + 16u), o1);
     }
 
     for (; i < n; ++i) {
@@ -300,21 +305,24 @@ void simd_ascii_upper_u8(uint8_t* p, size_t n)
     }
 }
 
-void simd_ascii_lower_u8(uint8_t* p, size_t n)
+static inline void simd_ascii_lower_u8(uint8_t* p, size_t n)
 {
     if ((p == NULL) || (n == 0u)) return;
 
     size_t i = 0u;
-    const __m256i lo  = _mm256_set1_epi8('A');
-    const __m256i hi  = _mm256_set1_epi8('Z');
-    const __m256i add = _mm256_set1_epi8(0x20);
+    const __m128i lo  = _mm_set1_epi8('A');
+    const __m128i hi  = _mm_set1_epi8('Z');
+    const __m128i add = _mm_set1_epi8(0x20);
 
     for (; i + 32u <= n; i += 32u) {
-        __m256i v    = _mm256_loadu_si256((const __m256i*)(const void*)(p + i));
-        __m256i mask = ascii_range_mask_256(v, lo, hi);
-        __m256i low  = _mm256_add_epi8(v, add);
-        __m256i out  = blendv_epi8_256(v, low, mask);
-        _mm256_storeu_si256((__m256i*)(void*)(p + i), out);
+        __m128i v0 = _mm_loadu_si128((const __m128i*)(const void*)(p + i));
+        __m128i v1 = _mm_loadu_si128((const __m128i*)(const void*)(p + i + 16u));
+        __m128i o0 = blendv_epi8_128(v0, _mm_add_epi8(v0, add),
+                                     ascii_range_mask_128(v0, lo, hi));
+        __m128i o1 = blendv_epi8_128(v1, _mm_add_epi8(v1, add),
+                                     ascii_range_mask_128(v1, lo, hi));
+        _mm_storeu_si128((__m128i*)(void*)(p + i), o0);
+        _mm_storeu_si128((__m128i*)(void*)(p + i + 16u), o1);
     }
 
     for (; i < n; ++i) {
@@ -235,5 +235,577 @@ static inline error_code_t simd_min_double(const double* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256d x = _mm256_loadu_pd(a + i);
+        __m256d y = _mm256_loadu_pd(b + i);
+        _mm256_storeu_pd(out + i, _mm256_add_pd(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256d x = _mm256_loadu_pd(a + i);
+        __m256d y = _mm256_loadu_pd(b + i);
+        _mm256_storeu_pd(out + i, _mm256_sub_pd(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256d x = _mm256_loadu_pd(a + i);
+        __m256d y = _mm256_loadu_pd(b + i);
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_div_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256d x = _mm256_loadu_pd(a + i);
+        __m256d y = _mm256_loadu_pd(b + i);
+        _mm256_storeu_pd(out + i, _mm256_div_pd(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] / b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_double(double*       out,
+                               const double* a,
+                               double        mul,
+                               double        add,
+                               size_t        len) {
+    __m256d const vmul = _mm256_set1_pd(mul);
+    __m256d const vadd = _mm256_set1_pd(add);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256d x = _mm256_loadu_pd(a + i);
+        _mm256_storeu_pd(out + i, _mm256_add_pd(_mm256_mul_pd(x, vmul), vadd));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_double(double*       out,
+                              const double* a,
+                              double        lo,
+                              double        hi,
+                              size_t        len) {
+    /* min/max return their second operand when either is NaN, so NaN
+     * inputs pass through unchanged */
+    __m256d const vlo = _mm256_set1_pd(lo);
+    __m256d const vhi = _mm256_set1_pd(hi);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256d x = _mm256_loadu_pd(a + i);
+        _mm256_storeu_pd(out + i, _mm256_max_pd(vlo, _mm256_min_pd(vhi, x)));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_double(double*       out,
+                            const double* a,
+                            size_t        len) {
+    __m256d const mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256d x = _mm256_loadu_pd(a + i);
+        _mm256_storeu_pd(out + i, _mm256_and_pd(x, mask));
+    }
+    for (; i < len; i++)
+        out[i] = fabs(a[i]);
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_double(const double* data,
+                                    size_t        len,
+                                    double*       out) {
+    double cur = *out;   /* caller seeds with -INFINITY */
+    size_t i   = 0u;
+
+    __m256d vmax = _mm256_set1_pd(cur);
+    __m256d nan  = _mm256_setzero_pd();
+
+    /* _mm256_max_pd drops a NaN operand, so NaN lanes are tracked apart */
+    for (; i + 4u <= len; i += 4u) {
+        __m256d x = _mm256_loadu_pd(data + i);
+        nan  = _mm256_or_pd(nan, _mm256_cmp_pd(x, x, _CMP_UNORD_Q));
+        vmax = _mm256_max_pd(vmax, x);
+    }
+    if (_mm256_movemask_pd(nan)) { *out = NAN; return NO_ERROR; }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, vmax);
+    for (size_t k = 0u; k < 4u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++) {
+        if (isnan(data[i])) { *out = NAN; return NO_ERROR; }
+        if (data[i] > cur) cur = data[i];
+    }
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static double simd_sum_double(const double* data,
+                              size_t        len) {
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    size_t  i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 8u <= len; i += 8u) {
+        acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(data + i));
+        acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(data + i + 4u));
+    }
+    acc0 = _mm256_add_pd(acc0, acc1);
+    if (i + 4u <= len) {
+        acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(data + i));
+        i   += 4u;
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc0);
+    double sum = 0.0;
+    for (size_t k = 0u; k < 4u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static double simd_asum_double(const double* data,
+                               size_t        len) {
+    __m256d const mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    size_t  i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 8u <= len; i += 8u) {
+        acc0 = _mm256_add_pd(acc0, _mm256_and_pd(_mm256_loadu_pd(data + i), mask));
+        acc1 = _mm256_add_pd(acc1, _mm256_and_pd(_mm256_loadu_pd(data + i + 4u), mask));
+    }
+    acc0 = _mm256_add_pd(acc0, acc1);
+    if (i + 4u <= len) {
+        acc0 = _mm256_add_pd(acc0, _mm256_and_pd(_mm256_loadu_pd(data + i), mask));
+        i   += 4u;
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc0);
+    double sum = 0.0;
+    for (size_t k = 0u; k < 4u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += fabs(data[i]);
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static double simd_dot_double(const double* a,
+                              const double* b,
+                              size_t        len) {
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    size_t  i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 8u <= len; i += 8u) {
+        acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+        acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(_mm256_loadu_pd(a + i + 4u), _mm256_loadu_pd(b + i + 4u)));
+    }
+    acc0 = _mm256_add_pd(acc0, acc1);
+    if (i + 4u <= len) {
+        acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+        i   += 4u;
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc0);
+    double sum = 0.0;
+    for (size_t k = 0u; k < 4u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_double(double*       out,
+                                const double* a,
+                                const double* b,
+                                size_t        len) {
+    /* min(y, x) returns x when either lane is NaN; NaN lanes of y are
+     * patched back in so NaN propagates from both operands */
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256d x = _mm256_loadu_pd(a + i);
+        __m256d y = _mm256_loadu_pd(b + i);
+        __m256d r = _mm256_min_pd(y, x);
+        __m256d u = _mm256_cmp_pd(y, y, _CMP_UNORD_Q);
+        _mm256_storeu_pd(out + i, _mm256_blendv_pd(r, y, u));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_double(double*       out,
+                                const double* a,
+                                const double* b,
+                                size_t        len) {
+    /* max(y, x) returns x when either lane is NaN; NaN lanes of y are
+     * patched back in so NaN propagates from both operands */
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256d x = _mm256_loadu_pd(a + i);
+        __m256d y = _mm256_loadu_pd(b + i);
+        __m256d r = _mm256_max_pd(y, x);
+        __m256d u = _mm256_cmp_pd(y, y, _CMP_UNORD_Q);
+        _mm256_storeu_pd(out + i, _mm256_blendv_pd(r, y, u));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 4 lanes of x */
+static inline __m256d _avx_scan_pd(__m256d x) {
+    __m256d const z = _mm256_setzero_pd();
+    x = _mm256_add_pd(x, _mm256_blend_pd(_mm256_permute_pd(x, 0x0), z, 0x5));
+    /* carry the lower half's total into the upper half */
+    __m256d const t = _mm256_permute_pd(x, 0xF);
+    return _mm256_add_pd(x, _mm256_permute2f128_pd(t, t, 0x08));
+}
+// --------------------------------------------------------------------------------
+
+/* x moved up one lane, with zero in lane 0 */
+static inline __m256d _avx_shl1_pd(__m256d x) {
+    __m256d const t = _mm256_permute2f128_pd(x, x, 0x08);
+    return _mm256_shuffle_pd(t, x, 0x5);
+}
+// --------------------------------------------------------------------------------
+
+static double simd_scan_double(double*       out,
+                               const double* a,
+                               size_t        len,
+                               double        carry,
+                               bool          exclusive) {
+    /* cv holds the running total in every lane */
+    __m256d cv = _mm256_set1_pd(carry);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m256d const x = _mm256_loadu_pd(a + i);
+        __m256d const p = _avx_scan_pd(x);
+        __m256d const r = _mm256_add_pd(p, cv);
+        __m256d const y = exclusive ? _mm256_add_pd(_avx_shl1_pd(p), cv) : r;
+        _mm256_storeu_pd(out + i, y);
+        __m256d const h = _mm256_permute_pd(r, 0xF);
+        cv = _mm256_permute2f128_pd(h, h, 0x11);
+    }
+    carry = _mm256_cvtsd_f64(cv);
+    for (; i < len; i++) {
+        double const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
+// MATRIX KERNELS
+
+/* y[i] += alpha * x[i] */
+static void simd_axpy_double(double*       y,
+                             const double* x,
+                             double        alpha,
+                             size_t        len) {
+    __m256d const av = _mm256_set1_pd(alpha);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        _mm256_storeu_pd(y + i,      _mm256_add_pd(_mm256_loadu_pd(y + i), _mm256_mul_pd(av, _mm256_loadu_pd(x + i))));
+        _mm256_storeu_pd(y + i + 4u, _mm256_add_pd(_mm256_loadu_pd(y + i + 4u), _mm256_mul_pd(av, _mm256_loadu_pd(x + i + 4u))));
+    }
+    for (; i + 4u <= len; i += 4u)
+        _mm256_storeu_pd(y + i, _mm256_add_pd(_mm256_loadu_pd(y + i), _mm256_mul_pd(av, _mm256_loadu_pd(x + i))));
+    for (; i < len; i++)
+        y[i] += alpha * x[i];
+}
+// --------------------------------------------------------------------------------
+
+/* C[0..4)[0..n) += A[0..4)[0..k) * B[0..k)[0..n), all row-major with leading
+ * dimensions ldc, lda and ldb.  Each 8-column strip keeps its
+ * 4 x 8 block of C in eight registers for the whole k loop */
+static void simd_gemm4_double(double*       c,
+                              size_t        ldc,
+                              const double* a,
+                              size_t        lda,
+                              const double* b,
+                              size_t        ldb,
+                              size_t        k,
+                              size_t        n) {
+    size_t j = 0u;
+    for (; j + 8u <= n; j += 8u) {
+        __m256d c00 = _mm256_loadu_pd(c + j), c01 = _mm256_loadu_pd(c + j + 4u);
+        __m256d c10 = _mm256_loadu_pd(c + ldc + j), c11 = _mm256_loadu_pd(c + ldc + j + 4u);
+        __m256d c20 = _mm256_loadu_pd(c + 2u * ldc + j), c21 = _mm256_loadu_pd(c + 2u * ldc + j + 4u);
+        __m256d c30 = _mm256_loadu_pd(c + 3u * ldc + j), c31 = _mm256_loadu_pd(c + 3u * ldc + j + 4u);
+        const double* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            __m256d const b0 = _mm256_loadu_pd(bp);
+            __m256d const b1 = _mm256_loadu_pd(bp + 4u);
+            __m256d av = _mm256_set1_pd(a[p]);
+            c00 = _mm256_add_pd(c00, _mm256_mul_pd(av, b0));
+            c01 = _mm256_add_pd(c01, _mm256_mul_pd(av, b1));
+            av  = _mm256_set1_pd(a[lda + p]);
+            c10 = _mm256_add_pd(c10, _mm256_mul_pd(av, b0));
+            c11 = _mm256_add_pd(c11, _mm256_mul_pd(av, b1));
+            av  = _mm256_set1_pd(a[2u * lda + p]);
+            c20 = _mm256_add_pd(c20, _mm256_mul_pd(av, b0));
+            c21 = _mm256_add_pd(c21, _mm256_mul_pd(av, b1));
+            av  = _mm256_set1_pd(a[3u * lda + p]);
+            c30 = _mm256_add_pd(c30, _mm256_mul_pd(av, b0));
+            c31 = _mm256_add_pd(c31, _mm256_mul_pd(av, b1));
+        }
+        _mm256_storeu_pd(c + j, c00); _mm256_storeu_pd(c + j + 4u, c01);
+        _mm256_storeu_pd(c + ldc + j, c10); _mm256_storeu_pd(c + ldc + j + 4u, c11);
+        _mm256_storeu_pd(c + 2u * ldc + j, c20); _mm256_storeu_pd(c + 2u * ldc + j + 4u, c21);
+        _mm256_storeu_pd(c + 3u * ldc + j, c30); _mm256_storeu_pd(c + 3u * ldc + j + 4u, c31);
+    }
+    for (; j + 4u <= n; j += 4u) {
+        __m256d c0 = _mm256_loadu_pd(c + j), c1 = _mm256_loadu_pd(c + ldc + j);
+        __m256d c2 = _mm256_loadu_pd(c + 2u * ldc + j), c3 = _mm256_loadu_pd(c + 3u * ldc + j);
+        const double* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            __m256d const bv = _mm256_loadu_pd(bp);
+            c0 = _mm256_add_pd(c0, _mm256_mul_pd(_mm256_set1_pd(a[p]), bv));
+            c1 = _mm256_add_pd(c1, _mm256_mul_pd(_mm256_set1_pd(a[lda + p]), bv));
+            c2 = _mm256_add_pd(c2, _mm256_mul_pd(_mm256_set1_pd(a[2u * lda + p]), bv));
+            c3 = _mm256_add_pd(c3, _mm256_mul_pd(_mm256_set1_pd(a[3u * lda + p]), bv));
+        }
+        _mm256_storeu_pd(c + j, c0); _mm256_storeu_pd(c + ldc + j, c1);
+        _mm256_storeu_pd(c + 2u * ldc + j, c2); _mm256_storeu_pd(c + 3u * ldc + j, c3);
+    }
+    for (; j < n; j++) {
+        double s0 = c[j], s1 = c[ldc + j], s2 = c[2u * ldc + j], s3 = c[3u * ldc + j];
+        const double* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            s0 += a[p]            * *bp;
+            s1 += a[lda + p]      * *bp;
+            s2 += a[2u * lda + p] * *bp;
+            s3 += a[3u * lda + p] * *bp;
+        }
+        c[j] = s0; c[ldc + j] = s1; c[2u * ldc + j] = s2; c[3u * ldc + j] = s3;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* sum of val[i] * x[idx[i]]: the sparse row (or column) dot product.
+ * This tier has no gather instruction, so the x operands are assembled
+ * lane by lane */
+static double simd_spdot_double(const double* val,
+                                const size_t* idx,
+                                const double* x,
+                                size_t        len) {
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(val + i),      _mm256_set_pd(x[idx[i + 3u]], x[idx[i + 2u]], x[idx[i + 1u]], x[idx[i]])));
+        acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(_mm256_loadu_pd(val + i + 4u), _mm256_set_pd(x[idx[i + 7u]], x[idx[i + 6u]], x[idx[i + 5u]], x[idx[i + 4u]])));
+    }
+    acc0 = _mm256_add_pd(acc0, acc1);
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc0);
+    double sum = 0.0;
+    for (size_t w = 0u; w < 4u; w++) sum += lanes[w];
+    for (; i < len; i++)
+        sum += val[i] * x[idx[i]];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+/* dst[j * ldd + i] = src[i * lds + j] for i < rows, j < cols: one cache
+ * tile of a matrix transpose.  4 x 4 blocks are transposed in registers:
+ * unpack, then a 128-bit lane permute. */
+static void simd_transpose_double(double*       dst,
+                                  size_t        ldd,
+                                  const double* src,
+                                  size_t        lds,
+                                  size_t        rows,
+                                  size_t        cols) {
+    size_t i = 0u;
+    for (; i + 4u <= rows; i += 4u) {
+        size_t j = 0u;
+        for (; j + 4u <= cols; j += 4u) {
+            const double* s = src + i * lds + j;
+            double*       d = dst + j * ldd + i;
+            __m256d const r0 = _mm256_loadu_pd(s);
+            __m256d const r1 = _mm256_loadu_pd(s + lds);
+            __m256d const r2 = _mm256_loadu_pd(s + 2u * lds);
+            __m256d const r3 = _mm256_loadu_pd(s + 3u * lds);
+            __m256d const t0 = _mm256_unpacklo_pd(r0, r1);
+            __m256d const t1 = _mm256_unpackhi_pd(r0, r1);
+            __m256d const t2 = _mm256_unpacklo_pd(r2, r3);
+            __m256d const t3 = _mm256_unpackhi_pd(r2, r3);
+            _mm256_storeu_pd(d,            _mm256_permute2f128_pd(t0, t2, 0x20));
+            _mm256_storeu_pd(d + ldd,      _mm256_permute2f128_pd(t1, t3, 0x20));
+            _mm256_storeu_pd(d + 2u * ldd, _mm256_permute2f128_pd(t0, t2, 0x31));
+            _mm256_storeu_pd(d + 3u * ldd, _mm256_permute2f128_pd(t1, t3, 0x31));
+        }
+        for (; j < cols; j++)
+            for (size_t q = 0u; q < 4u; q++)
+                dst[j * ldd + i + q] = src[(i + q) * lds + j];
+    }
+    for (; i < rows; i++)
+        for (size_t j = 0u; j < cols; j++)
+            dst[j * ldd + i] = src[i * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* The same transpose for one band of 8 source rows: dst[j * ldd + q] =
+ * src[q * lds + j] for q < 8, j < cols.  Two 4 x 4 blocks stacked in the
+ * band fill a whole 64-byte destination line, which goes out with
+ * non-temporal stores so the destination is never read into the cache.
+ * dst must be 64-byte aligned and ldd a multiple of 8; the band ends with
+ * a fence. */
+static void simd_transpose_stream_double(double*       dst,
+                                         size_t        ldd,
+                                         const double* src,
+                                         size_t        lds,
+                                         size_t        cols) {
+    size_t j = 0u;
+    for (; j + 4u <= cols; j += 4u) {
+        __m256d r[8];
+        for (size_t h = 0u; h < 8u; h += 4u) {
+            const double* s = src + h * lds + j;
+            __m256d const r0 = _mm256_loadu_pd(s);
+            __m256d const r1 = _mm256_loadu_pd(s + lds);
+            __m256d const r2 = _mm256_loadu_pd(s + 2u * lds);
+            __m256d const r3 = _mm256_loadu_pd(s + 3u * lds);
+            __m256d const t0 = _mm256_unpacklo_pd(r0, r1);
+            __m256d const t1 = _mm256_unpackhi_pd(r0, r1);
+            __m256d const t2 = _mm256_unpacklo_pd(r2, r3);
+            __m256d const t3 = _mm256_unpackhi_pd(r2, r3);
+            r[h]      = _mm256_permute2f128_pd(t0, t2, 0x20);
+            r[h + 1u] = _mm256_permute2f128_pd(t1, t3, 0x20);
+            r[h + 2u] = _mm256_permute2f128_pd(t0, t2, 0x31);
+            r[h + 3u] = _mm256_permute2f128_pd(t1, t3, 0x31);
+        }
+        double* d = dst + j * ldd;
+        for (size_t k = 0u; k < 4u; k++) {
+            _mm256_stream_pd(d + k * ldd,      r[k]);
+            _mm256_stream_pd(d + k * ldd + 4u, r[k + 4u]);
+        }
+    }
+    _mm_sfence();
+    for (; j < cols; j++)
+        for (size_t q = 0u; q < 8u; q++)
+            dst[j * ldd + q] = src[q * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* y[r] += sum over blocks b < nb of row r of block b dotted with
+ * x + col[b] * bc, for r < rows: one block row of a BSR SpMV.  Blocks are
+ * br x bc, row-major and packed back to back.  Block rows are dotted 4
+ * lanes at a time, then 2 (so 4-wide blocks stay vectorized), with one
+ * horizontal sum per output row. */
+static void simd_bsr_double(double*       y,
+                            const double* val,
+                            const size_t* col,
+                            const double* x,
+                            size_t        nb,
+                            size_t        rows,
+                            size_t        br,
+                            size_t        bc) {
+    for (size_t r = 0u; r < rows; r++) {
+        __m256d acc0 = _mm256_setzero_pd();
+        __m128d acc1 = _mm_setzero_pd();
+        double s = 0.0;
+        for (size_t b = 0u; b < nb; b++) {
+            const double* a  = val + (b * br + r) * bc;
+            const double* xb = x + col[b] * bc;
+            size_t k = 0u;
+            for (; k + 4u <= bc; k += 4u)
+                acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(a + k), _mm256_loadu_pd(xb + k)));
+            for (; k + 2u <= bc; k += 2u)
+                acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(a + k), _mm_loadu_pd(xb + k)));
+            for (; k < bc; k++) s += a[k] * xb[k];
+        }
+        double lanes[4];
+        _mm256_storeu_pd(lanes, acc0);
+        for (size_t w = 0u; w < 4u; w++) s += lanes[w];
+        _mm_storeu_pd(lanes, acc1);
+        for (size_t w = 0u; w < 2u; w++) s += lanes[w];
+        y[r] += s;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* y[i] = sum over j < width of val[j * chunk + i] * x[idx[j * chunk + i]]
+ * for i < chunk: one slice of a SELL-C-sigma SpMV.  The slice is stored
+ * column by column, so consecutive lanes hold consecutive rows.  4 rows
+ * per register; x is gathered with scalar loads, since AVX has no gather. */
+static void simd_sell_double(double*       y,
+                             const double* val,
+                             const size_t* idx,
+                             const double* x,
+                             size_t        chunk,
+                             size_t        width) {
+    size_t i = 0u;
+    for (; i + 4u <= chunk; i += 4u) {
+        __m256d acc = _mm256_setzero_pd();
+        for (size_t j = 0u; j < width; j++) {
+            const double* v = val + j * chunk + i;
+            const size_t* c = idx + j * chunk + i;
+            acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(v), _mm256_set_pd(x[c[3]], x[c[2]], x[c[1]], x[c[0]])));
+        }
+        _mm256_storeu_pd(y + i, acc);
+    }
+    for (; i < chunk; i++) {
+        double s = 0.0;
+        for (size_t j = 0u; j < width; j++)
+            s += val[j * chunk + i] * x[idx[j * chunk + i]];
+        y[i] = s;
+    }
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX_DOUBLE_INL */
 
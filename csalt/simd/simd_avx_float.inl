@@ -231,5 +231,581 @@ static inline error_code_t simd_min_float(const float* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256 x = _mm256_loadu_ps(a + i);
+        __m256 y = _mm256_loadu_ps(b + i);
+        _mm256_storeu_ps(out + i, _mm256_add_ps(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256 x = _mm256_loadu_ps(a + i);
+        __m256 y = _mm256_loadu_ps(b + i);
+        _mm256_storeu_ps(out + i, _mm256_sub_ps(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256 x = _mm256_loadu_ps(a + i);
+        __m256 y = _mm256_loadu_ps(b + i);
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_div_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256 x = _mm256_loadu_ps(a + i);
+        __m256 y = _mm256_loadu_ps(b + i);
+        _mm256_storeu_ps(out + i, _mm256_div_ps(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] / b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_float(float*       out,
+                              const float* a,
+                              float        mul,
+                              float        add,
+                              size_t       len) {
+    __m256 const vmul = _mm256_set1_ps(mul);
+    __m256 const vadd = _mm256_set1_ps(add);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256 x = _mm256_loadu_ps(a + i);
+        _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_mul_ps(x, vmul), vadd));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_float(float*       out,
+                             const float* a,
+                             float        lo,
+                             float        hi,
+                             size_t       len) {
+    /* min/max return their second operand when either is NaN, so NaN
+     * inputs pass through unchanged */
+    __m256 const vlo = _mm256_set1_ps(lo);
+    __m256 const vhi = _mm256_set1_ps(hi);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256 x = _mm256_loadu_ps(a + i);
+        _mm256_storeu_ps(out + i, _mm256_max_ps(vlo, _mm256_min_ps(vhi, x)));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_float(float*       out,
+                           const float* a,
+                           size_t       len) {
+    __m256 const mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256 x = _mm256_loadu_ps(a + i);
+        _mm256_storeu_ps(out + i, _mm256_and_ps(x, mask));
+    }
+    for (; i < len; i++)
+        out[i] = fabsf(a[i]);
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_float(const float* data,
+                                   size_t       len,
+                                   float*       out) {
+    float  cur = *out;   /* caller seeds with -INFINITY */
+    size_t i   = 0u;
+
+    __m256 vmax = _mm256_set1_ps(cur);
+    __m256 nan  = _mm256_setzero_ps();
+
+    /* _mm256_max_ps drops a NaN operand, so NaN lanes are tracked apart */
+    for (; i + 8u <= len; i += 8u) {
+        __m256 x = _mm256_loadu_ps(data + i);
+        nan  = _mm256_or_ps(nan, _mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+        vmax = _mm256_max_ps(vmax, x);
+    }
+    if (_mm256_movemask_ps(nan)) { *out = NAN; return NO_ERROR; }
+
+    float lanes[8];
+    _mm256_storeu_ps(lanes, vmax);
+    for (size_t k = 0u; k < 8u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++) {
+        if (isnan(data[i])) { *out = NAN; return NO_ERROR; }
+        if (data[i] > cur) cur = data[i];
+    }
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static float simd_sum_float(const float* data,
+                            size_t       len) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    size_t i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 16u <= len; i += 16u) {
+        acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(data + i));
+        acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(data + i + 8u));
+    }
+    acc0 = _mm256_add_ps(acc0, acc1);
+    if (i + 8u <= len) {
+        acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(data + i));
+        i   += 8u;
+    }
+
+    float lanes[8];
+    _mm256_storeu_ps(lanes, acc0);
+    float sum = 0.0f;
+    for (size_t k = 0u; k < 8u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static float simd_asum_float(const float* data,
+                             size_t       len) {
+    __m256 const mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    size_t i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 16u <= len; i += 16u) {
+        acc0 = _mm256_add_ps(acc0, _mm256_and_ps(_mm256_loadu_ps(data + i), mask));
+        acc1 = _mm256_add_ps(acc1, _mm256_and_ps(_mm256_loadu_ps(data + i + 8u), mask));
+    }
+    acc0 = _mm256_add_ps(acc0, acc1);
+    if (i + 8u <= len) {
+        acc0 = _mm256_add_ps(acc0, _mm256_and_ps(_mm256_loadu_ps(data + i), mask));
+        i   += 8u;
+    }
+
+    float lanes[8];
+    _mm256_storeu_ps(lanes, acc0);
+    float sum = 0.0f;
+    for (size_t k = 0u; k < 8u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += fabsf(data[i]);
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static float simd_dot_float(const float* a,
+                            const float* b,
+                            size_t       len) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    size_t i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 16u <= len; i += 16u) {
+        acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+        acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(a + i + 8u), _mm256_loadu_ps(b + i + 8u)));
+    }
+    acc0 = _mm256_add_ps(acc0, acc1);
+    if (i + 8u <= len) {
+        acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+        i   += 8u;
+    }
+
+    float lanes[8];
+    _mm256_storeu_ps(lanes, acc0);
+    float sum = 0.0f;
+    for (size_t k = 0u; k < 8u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_float(float*       out,
+                               const float* a,
+                               const float* b,
+                               size_t       len) {
+    /* min(y, x) returns x when either lane is NaN; NaN lanes of y are
+     * patched back in so NaN propagates from both operands */
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256 x = _mm256_loadu_ps(a + i);
+        __m256 y = _mm256_loadu_ps(b + i);
+        __m256 r = _mm256_min_ps(y, x);
+        __m256 u = _mm256_cmp_ps(y, y, _CMP_UNORD_Q);
+        _mm256_storeu_ps(out + i, _mm256_blendv_ps(r, y, u));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_float(float*       out,
+                               const float* a,
+                               const float* b,
+                               size_t       len) {
+    /* max(y, x) returns x when either lane is NaN; NaN lanes of y are
+     * patched back in so NaN propagates from both operands */
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256 x = _mm256_loadu_ps(a + i);
+        __m256 y = _mm256_loadu_ps(b + i);
+        __m256 r = _mm256_max_ps(y, x);
+        __m256 u = _mm256_cmp_ps(y, y, _CMP_UNORD_Q);
+        _mm256_storeu_ps(out + i, _mm256_blendv_ps(r, y, u));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 8 lanes of x */
+static inline __m256 _avx_scan_ps(__m256 x) {
+    __m256 const z = _mm256_setzero_ps();
+    x = _mm256_add_ps(x, _mm256_blend_ps(_mm256_permute_ps(x, 0x93), z, 0x11));
+    x = _mm256_add_ps(x, _mm256_blend_ps(_mm256_permute_ps(x, 0x4E), z, 0x33));
+    /* carry the lower half's total into the upper half */
+    __m256 const t = _mm256_permute_ps(x, 0xFF);
+    return _mm256_add_ps(x, _mm256_permute2f128_ps(t, t, 0x08));
+}
+// --------------------------------------------------------------------------------
+
+/* x moved up one lane, with zero in lane 0 */
+static inline __m256 _avx_shl1_ps(__m256 x) {
+    __m256 const t = _mm256_permute2f128_ps(x, x, 0x08);
+    return _mm256_blend_ps(_mm256_permute_ps(x, 0x93),
+                           _mm256_permute_ps(t, 0x93), 0x11);
+}
+// --------------------------------------------------------------------------------
+
+static float simd_scan_float(float*       out,
+                             const float* a,
+                             size_t       len,
+                             float        carry,
+                             bool         exclusive) {
+    /* cv holds the running total in every lane */
+    __m256 cv = _mm256_set1_ps(carry);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m256 const x = _mm256_loadu_ps(a + i);
+        __m256 const p = _avx_scan_ps(x);
+        __m256 const r = _mm256_add_ps(p, cv);
+        __m256 const y = exclusive ? _mm256_add_ps(_avx_shl1_ps(p), cv) : r;
+        _mm256_storeu_ps(out + i, y);
+        __m256 const h = _mm256_permute_ps(r, 0xFF);
+        cv = _mm256_permute2f128_ps(h, h, 0x11);
+    }
+    carry = _mm256_cvtss_f32(cv);
+    for (; i < len; i++) {
+        float const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
+// MATRIX KERNELS
+
+/* y[i] += alpha * x[i] */
+static void simd_axpy_float(float*       y,
+                            const float* x,
+                            float        alpha,
+                            size_t       len) {
+    __m256 const av = _mm256_set1_ps(alpha);
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        _mm256_storeu_ps(y + i,      _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(av, _mm256_loadu_ps(x + i))));
+        _mm256_storeu_ps(y + i + 8u, _mm256_add_ps(_mm256_loadu_ps(y + i + 8u), _mm256_mul_ps(av, _mm256_loadu_ps(x + i + 8u))));
+    }
+    for (; i + 8u <= len; i += 8u)
+        _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(av, _mm256_loadu_ps(x + i))));
+    for (; i < len; i++)
+        y[i] += alpha * x[i];
+}
+// --------------------------------------------------------------------------------
+
+/* C[0..4)[0..n) += A[0..4)[0..k) * B[0..k)[0..n), all row-major with leading
+ * dimensions ldc, lda and ldb.  Each 16-column strip keeps its
+ * 4 x 16 block of C in eight registers for the whole k loop */
+static void simd_gemm4_float(float*       c,
+                             size_t       ldc,
+                             const float* a,
+                             size_t       lda,
+                             const float* b,
+                             size_t       ldb,
+                             size_t       k,
+                             size_t       n) {
+    size_t j = 0u;
+    for (; j + 16u <= n; j += 16u) {
+        __m256 c00 = _mm256_loadu_ps(c + j), c01 = _mm256_loadu_ps(c + j + 8u);
+        __m256 c10 = _mm256_loadu_ps(c + ldc + j), c11 = _mm256_loadu_ps(c + ldc + j + 8u);
+        __m256 c20 = _mm256_loadu_ps(c + 2u * ldc + j), c21 = _mm256_loadu_ps(c + 2u * ldc + j + 8u);
+        __m256 c30 = _mm256_loadu_ps(c + 3u * ldc + j), c31 = _mm256_loadu_ps(c + 3u * ldc + j + 8u);
+        const float* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            __m256 const b0 = _mm256_loadu_ps(bp);
+            __m256 const b1 = _mm256_loadu_ps(bp + 8u);
+            __m256 av = _mm256_set1_ps(a[p]);
+            c00 = _mm256_add_ps(c00, _mm256_mul_ps(av, b0));
+            c01 = _mm256_add_ps(c01, _mm256_mul_ps(av, b1));
+            av  = _mm256_set1_ps(a[lda + p]);
+            c10 = _mm256_add_ps(c10, _mm256_mul_ps(av, b0));
+            c11 = _mm256_add_ps(c11, _mm256_mul_ps(av, b1));
+            av  = _mm256_set1_ps(a[2u * lda + p]);
+            c20 = _mm256_add_ps(c20, _mm256_mul_ps(av, b0));
+            c21 = _mm256_add_ps(c21, _mm256_mul_ps(av, b1));
+            av  = _mm256_set1_ps(a[3u * lda + p]);
+            c30 = _mm256_add_ps(c30, _mm256_mul_ps(av, b0));
+            c31 = _mm256_add_ps(c31, _mm256_mul_ps(av, b1));
+        }
+        _mm256_storeu_ps(c + j, c00); _mm256_storeu_ps(c + j + 8u, c01);
+        _mm256_storeu_ps(c + ldc + j, c10); _mm256_storeu_ps(c + ldc + j + 8u, c11);
+        _mm256_storeu_ps(c + 2u * ldc + j, c20); _mm256_storeu_ps(c + 2u * ldc + j + 8u, c21);
+        _mm256_storeu_ps(c + 3u * ldc + j, c30); _mm256_storeu_ps(c + 3u * ldc + j + 8u, c31);
+    }
+    for (; j + 8u <= n; j += 8u) {
+        __m256 c0 = _mm256_loadu_ps(c + j), c1 = _mm256_loadu_ps(c + ldc + j);
+        __m256 c2 = _mm256_loadu_ps(c + 2u * ldc + j), c3 = _mm256_loadu_ps(c + 3u * ldc + j);
+        const float* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            __m256 const bv = _mm256_loadu_ps(bp);
+            c0 = _mm256_add_ps(c0, _mm256_mul_ps(_mm256_set1_ps(a[p]), bv));
+            c1 = _mm256_add_ps(c1, _mm256_mul_ps(_mm256_set1_ps(a[lda + p]), bv));
+            c2 = _mm256_add_ps(c2, _mm256_mul_ps(_mm256_set1_ps(a[2u * lda + p]), bv));
+            c3 = _mm256_add_ps(c3, _mm256_mul_ps(_mm256_set1_ps(a[3u * lda + p]), bv));
+        }
+        _mm256_storeu_ps(c + j, c0); _mm256_storeu_ps(c + ldc + j, c1);
+        _mm256_storeu_ps(c + 2u * ldc + j, c2); _mm256_storeu_ps(c + 3u * ldc + j, c3);
+    }
+    for (; j < n; j++) {
+        float s0 = c[j], s1 = c[ldc + j], s2 = c[2u * ldc + j], s3 = c[3u * ldc + j];
+        const float* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            s0 += a[p]            * *bp;
+            s1 += a[lda + p]      * *bp;
+            s2 += a[2u * lda + p] * *bp;
+            s3 += a[3u * lda + p] * *bp;
+        }
+        c[j] = s0; c[ldc + j] = s1; c[2u * ldc + j] = s2; c[3u * ldc + j] = s3;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* sum of val[i] * x[idx[i]]: the sparse row (or column) dot product.
+ * This tier has no gather instruction, so the x operands are assembled
+ * lane by lane */
+static float simd_spdot_float(const float*  val,
+                              const size_t* idx,
+                              const float*  x,
+                              size_t        len) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(val + i),      _mm256_set_ps(x[idx[i + 7u]], x[idx[i + 6u]], x[idx[i + 5u]], x[idx[i + 4u]], x[idx[i + 3u]], x[idx[i + 2u]], x[idx[i + 1u]], x[idx[i]])));
+        acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(val + i + 8u), _mm256_set_ps(x[idx[i + 15u]], x[idx[i + 14u]], x[idx[i + 13u]], x[idx[i + 12u]], x[idx[i + 11u]], x[idx[i + 10u]], x[idx[i + 9u]], x[idx[i + 8u]])));
+    }
+    acc0 = _mm256_add_ps(acc0, acc1);
+
+    float lanes[8];
+    _mm256_storeu_ps(lanes, acc0);
+    float sum = 0.0f;
+    for (size_t w = 0u; w < 8u; w++) sum += lanes[w];
+    for (; i < len; i++)
+        sum += val[i] * x[idx[i]];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+/* Loads the 8 x 8 block at s (stride lds) and leaves its transpose in
+ * r[0..7], one destination row per register: unpack, shuffle, then a
+ * 128-bit lane permute. */
+static inline void _avx_transpose8_ps(__m256 r[8], const float* s, size_t lds) {
+    __m256 t[8];
+    for (size_t k = 0u; k < 8u; k++) r[k] = _mm256_loadu_ps(s + k * lds);
+    for (size_t k = 0u; k < 8u; k += 2u) {
+        t[k]      = _mm256_unpacklo_ps(r[k], r[k + 1u]);
+        t[k + 1u] = _mm256_unpackhi_ps(r[k], r[k + 1u]);
+    }
+    for (size_t k = 0u; k < 8u; k += 4u) {
+        r[k]      = _mm256_shuffle_ps(t[k],      t[k + 2u], _MM_SHUFFLE(1, 0, 1, 0));
+        r[k + 1u] = _mm256_shuffle_ps(t[k],      t[k + 2u], _MM_SHUFFLE(3, 2, 3, 2));
+        r[k + 2u] = _mm256_shuffle_ps(t[k + 1u], t[k + 3u], _MM_SHUFFLE(1, 0, 1, 0));
+        r[k + 3u] = _mm256_shuffle_ps(t[k + 1u], t[k + 3u], _MM_SHUFFLE(3, 2, 3, 2));
+    }
+    for (size_t k = 0u; k < 4u; k++) {
+        t[k]      = _mm256_permute2f128_ps(r[k], r[k + 4u], 0x20);
+        t[k + 4u] = _mm256_permute2f128_ps(r[k], r[k + 4u], 0x31);
+    }
+    for (size_t k = 0u; k < 8u; k++) r[k] = t[k];
+}
+// --------------------------------------------------------------------------------
+
+/* dst[j * ldd + i] = src[i * lds + j] for i < rows, j < cols: one cache
+ * tile of a matrix transpose.  8 x 8 blocks are transposed in registers. */
+static void simd_transpose_float(float*       dst,
+                                 size_t       ldd,
+                                 const float* src,
+                                 size_t       lds,
+                                 size_t       rows,
+                                 size_t       cols) {
+    size_t i = 0u;
+    for (; i + 8u <= rows; i += 8u) {
+        size_t j = 0u;
+        for (; j + 8u <= cols; j += 8u) {
+            const float* s = src + i * lds + j;
+            float*       d = dst + j * ldd + i;
+            __m256 r[8];
+            _avx_transpose8_ps(r, s, lds);
+            for (size_t k = 0u; k < 8u; k++) _mm256_storeu_ps(d + k * ldd, r[k]);
+        }
+        for (; j < cols; j++)
+            for (size_t q = 0u; q < 8u; q++)
+                dst[j * ldd + i + q] = src[(i + q) * lds + j];
+    }
+    for (; i < rows; i++)
+        for (size_t j = 0u; j < cols; j++)
+            dst[j * ldd + i] = src[i * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* The same transpose for one band of 16 source rows: dst[j * ldd + q] =
+ * src[q * lds + j] for q < 16, j < cols.  Two 8 x 8 blocks stacked in the
+ * band fill a whole 64-byte destination line, which goes out with
+ * non-temporal stores so the destination is never read into the cache.
+ * dst must be 64-byte aligned and ldd a multiple of 16; the band ends with
+ * a fence. */
+static void simd_transpose_stream_float(float*       dst,
+                                        size_t       ldd,
+                                        const float* src,
+                                        size_t       lds,
+                                        size_t       cols) {
+    size_t j = 0u;
+    for (; j + 8u <= cols; j += 8u) {
+        __m256 a[8], b[8];
+        _avx_transpose8_ps(a, src + j, lds);
+        _avx_transpose8_ps(b, src + 8u * lds + j, lds);
+        float* d = dst + j * ldd;
+        for (size_t k = 0u; k < 8u; k++) {
+            _mm256_stream_ps(d + k * ldd,      a[k]);
+            _mm256_stream_ps(d + k * ldd + 8u, b[k]);
+        }
+    }
+    _mm_sfence();
+    for (; j < cols; j++)
+        for (size_t q = 0u; q < 16u; q++)
+            dst[j * ldd + q] = src[q * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* y[r] += sum over blocks b < nb of row r of block b dotted with
+ * x + col[b] * bc, for r < rows: one block row of a BSR SpMV.  Blocks are
+ * br x bc, row-major and packed back to back.  Block rows are dotted 8
+ * lanes at a time, then 4 (so 4-wide blocks stay vectorized), with one
+ * horizontal sum per output row. */
+static void simd_bsr_float(float*        y,
+                           const float*  val,
+                           const size_t* col,
+                           const float*  x,
+                           size_t        nb,
+                           size_t        rows,
+                           size_t        br,
+                           size_t        bc) {
+    for (size_t r = 0u; r < rows; r++) {
+        __m256 acc0 = _mm256_setzero_ps();
+        __m128 acc1 = _mm_setzero_ps();
+        float s = 0.0f;
+        for (size_t b = 0u; b < nb; b++) {
+            const float* a  = val + (b * br + r) * bc;
+            const float* xb = x + col[b] * bc;
+            size_t k = 0u;
+            for (; k + 8u <= bc; k += 8u)
+                acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(a + k), _mm256_loadu_ps(xb + k)));
+            for (; k + 4u <= bc; k += 4u)
+                acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + k), _mm_loadu_ps(xb + k)));
+            for (; k < bc; k++) s += a[k] * xb[k];
+        }
+        float lanes[8];
+        _mm256_storeu_ps(lanes, acc0);
+        for (size_t w = 0u; w < 8u; w++) s += lanes[w];
+        _mm_storeu_ps(lanes, acc1);
+        for (size_t w = 0u; w < 4u; w++) s += lanes[w];
+        y[r] += s;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* y[i] = sum over j < width of val[j * chunk + i] * x[idx[j * chunk + i]]
+ * for i < chunk: one slice of a SELL-C-sigma SpMV.  The slice is stored
+ * column by column, so consecutive lanes hold consecutive rows.  8 rows
+ * per register; x is gathered with scalar loads, since AVX has no gather. */
+static void simd_sell_float(float*        y,
+                            const float*  val,
+                            const size_t* idx,
+                            const float*  x,
+                            size_t        chunk,
+                            size_t        width) {
+    size_t i = 0u;
+    for (; i + 8u <= chunk; i += 8u) {
+        __m256 acc = _mm256_setzero_ps();
+        for (size_t j = 0u; j < width; j++) {
+            const float*  v = val + j * chunk + i;
+            const size_t* c = idx + j * chunk + i;
+            __m256 const g = _mm256_set_ps(x[c[7]], x[c[6]], x[c[5]], x[c[4]], x[c[3]], x[c[2]], x[c[1]], x[c[0]]);
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(v), g));
+        }
+        _mm256_storeu_ps(y + i, acc);
+    }
+    for (; i < chunk; i++) {
+        float s = 0.0f;
+        for (size_t j = 0u; j < width; j++)
+            s += val[j * chunk + i] * x[idx[j * chunk + i]];
+        y[i] = s;
+    }
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX_FLOAT_INL */
 
@@ -55,6 +55,123 @@ static inline error_code_t simd_min_int16(const int16_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int16(int16_t*       out,
+                             const int16_t* a,
+                             int16_t        lo,
+                             int16_t        hi,
+                             size_t         len) {
+    __m128i const vlo = _mm_set1_epi16((short)lo);
+    __m128i const vhi = _mm_set1_epi16((short)hi);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        x = _mm_max_epi16(vlo, _mm_min_epi16(x, vhi));
+        _mm_storeu_si128((__m128i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int16(int16_t*       out,
+                           const int16_t* a,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_abs_epi16(x));
+    }
+    for (; i < len; i++)
+        out[i] = (int16_t)(a[i] < 0 ? -a[i] : a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int16(const int16_t* data,
+                                   size_t         len,
+                                   int16_t*       out) {
+    int16_t cur = *out;   /* caller seeds with INT16_MIN */
+    size_t  i   = 0u;
+
+    __m128i vmax = _mm_set1_epi16((short)cur);
+    for (; i + 8u <= len; i += 8u) {
+        vmax = _mm_max_epi16(vmax, _mm_loadu_si128((const __m128i*)(data + i)));
+    }
+
+    int16_t lanes[8];
+    _mm_storeu_si128((__m128i*)lanes, vmax);
+    for (size_t k = 0u; k < 8u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int16(const int16_t* data,
+                              size_t         len) {
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const ones = _mm_set1_epi16(1);
+    __m128i acc        = zero;
+    size_t  i          = 0u;
+
+    /* madd against ones sums 16-bit pairs into 32-bit lanes, which are
+     * then sign-extended into the 64-bit accumulator */
+    for (; i + 8u <= len; i += 8u) {
+        __m128i x = _mm_madd_epi16(_mm_loadu_si128((const __m128i*)(data + i)), ones);
+        __m128i s = _mm_srai_epi32(x, 31);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(x, s));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(x, s));
+    }
+
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    int64_t sum = 0;
+    for (size_t k = 0u; k < 2u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int16(int16_t*       out,
+                               const int16_t* a,
+                               const int16_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_min_epi16(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int16(int16_t*       out,
+                               const int16_t* a,
+                               const int16_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_max_epi16(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_AVX_MIN_INT16_INL */
 // ================================================================================
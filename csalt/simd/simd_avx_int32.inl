@@ -1,9 +1,11 @@
 // ================================================================================
 // ================================================================================
-// - File:    simd_avx2_min_int32.inl
-// - Purpose: AVX2 fast path for finding the minimum int32_t in a contiguous
-//            buffer.  Processes 8 elements per iteration using
-//            _mm256_min_epi32.  Folds to 128 bits for horizontal reduction.
+// - File:    simd_avx_min_int32.inl
+// - Purpose: AVX fast path for finding the minimum int32_t in a contiguous
+//            buffer.  Plain AVX has no 256-bit integer min (that arrives
+//            with AVX2), so two independent 128-bit _mm_min_epi32
+//            accumulators process 8 elements per iteration and are folded
+//            together for the horizontal reduction.
 //
 // Source Metadata
 // - Author:  Jonathan A. Webb
@@ -13,13 +15,13 @@
 // ================================================================================
 // ================================================================================
 
-#ifndef SIMD_AVX2_MIN_INT32_INL
-#define SIMD_AVX2_MIN_INT32_INL
+#ifndef SIMD_AVX_MIN_INT32_INL
+#define SIMD_AVX_MIN_INT32_INL
 
 #include "c_error.h"
 #include <stdint.h>
 #include <stddef.h>
-#include <immintrin.h>   /* AVX2 */
+#include <immintrin.h>   /* AVX (SSE4.1 integer ops) */
 
 static inline error_code_t simd_min_int32(const int32_t* data,
                                           size_t         len,
@@ -28,17 +30,18 @@ static inline error_code_t simd_min_int32(const int32_t* data,
     size_t  i       = 0u;
 
     if (len >= 8u) {
-        __m256i vmin = _mm256_set1_epi32(INT32_MAX);
+        __m128i vmin0 = _mm_set1_epi32(INT32_MAX);
+        __m128i vmin1 = _mm_set1_epi32(INT32_MAX);
 
         for (; i + 8u <= len; i += 8u) {
-            __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
-            vmin = _mm256_min_epi32(vmin, v);
+            __m128i v0 = _mm_loadu_si128((const __m128i*)(data + i));
+            __m128i v1 = _mm_loadu_si128((const __m128i*)(data + i + 4u));
+            vmin0 = _mm_min_epi32(vmin0, v0);
+            vmin1 = _mm_min_epi32(vmin1, v1);
         }
 
-        /* Fold 256 → 128 */
-        __m128i lo  = _mm256_castsi256_si128(vmin);
-        __m128i hi  = _mm256_extracti128_si256(vmin, 1);
-        __m128i v16 = _mm_min_epi32(lo, hi);
+        /* Fold the two accumulators */
+        __m128i v16 = _mm_min_epi32(vmin0, vmin1);
 
         /* Horizontal reduction: 4 → 2 → 1 */
         __m128i shifted = _mm_srli_si128(v16, 8);
@@ -79,8 +82,123 @@ static inline error_code_t simd_min_int32(const int32_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int32(int32_t*       out,
+                             const int32_t* a,
+                             int32_t        lo,
+                             int32_t        hi,
+                             size_t         len) {
+    __m128i const vlo = _mm_set1_epi32((int)lo);
+    __m128i const vhi = _mm_set1_epi32((int)hi);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        x = _mm_max_epi32(vlo, _mm_min_epi32(x, vhi));
+        _mm_storeu_si128((__m128i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int32(int32_t*       out,
+                           const int32_t* a,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_abs_epi32(x));
+    }
+    for (; i < len; i++)
+        out[i] = (int32_t)(a[i] < 0 ? 0u - (uint32_t)a[i] : (uint32_t)a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int32(const int32_t* data,
+                                   size_t         len,
+                                   int32_t*       out) {
+    int32_t cur = *out;   /* caller seeds with INT32_MIN */
+    size_t  i   = 0u;
+
+    __m128i vmax = _mm_set1_epi32((int)cur);
+    for (; i + 4u <= len; i += 4u) {
+        vmax = _mm_max_epi32(vmax, _mm_loadu_si128((const __m128i*)(data + i)));
+    }
+
+    int32_t lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, vmax);
+    for (size_t k = 0u; k < 4u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int32(const int32_t* data,
+                              size_t         len) {
+    __m128i const zero = _mm_setzero_si128();
+    __m128i acc        = zero;
+    size_t  i          = 0u;
+
+    /* Widen each 32-bit lane to 64 bits before accumulating */
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i s = _mm_srai_epi32(x, 31);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(x, s));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(x, s));
+    }
+
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    int64_t sum = 0;
+    for (size_t k = 0u; k < 2u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int32(int32_t*       out,
+                               const int32_t* a,
+                               const int32_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_min_epi32(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int32(int32_t*       out,
+                               const int32_t* a,
+                               const int32_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_max_epi32(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
-#endif /* SIMD_AVX2_MIN_INT32_INL */
+#endif /* SIMD_AVX_MIN_INT32_INL */
 // ================================================================================
 // ================================================================================
 // eof
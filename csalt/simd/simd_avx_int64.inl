@@ -39,6 +39,109 @@ static inline error_code_t simd_min_int64(const int64_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int64(int64_t*       out,
+                             const int64_t* a,
+                             int64_t        lo,
+                             int64_t        hi,
+                             size_t         len) {
+    __m128i const vlo = _mm_set1_epi64x((long long)lo);
+    __m128i const vhi = _mm_set1_epi64x((long long)hi);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i m = _mm_cmpgt_epi64(x, vhi);
+        x = _mm_blendv_epi8(x, vhi, m);
+        m = _mm_cmpgt_epi64(vlo, x);
+        x = _mm_blendv_epi8(x, vlo, m);
+        _mm_storeu_si128((__m128i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int64(int64_t*       out,
+                           const int64_t* a,
+                           size_t         len) {
+    /* |x| = (x ^ m) - m with m the sign mask of each lane */
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i m = _mm_shuffle_epi32(_mm_srai_epi32(x, 31), _MM_SHUFFLE(3, 3, 1, 1));
+        x = _mm_sub_epi64(_mm_xor_si128(x, m), m);
+        _mm_storeu_si128((__m128i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (int64_t)(a[i] < 0 ? 0u - (uint64_t)a[i] : (uint64_t)a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int64(const int64_t* data,
+                                   size_t         len,
+                                   int64_t*       out) {
+    int64_t cur = *out;   /* caller seeds with INT64_MIN */
+    size_t  i   = 0u;
+
+    __m128i vmax = _mm_set1_epi64x((long long)cur);
+    for (; i + 2u <= len; i += 2u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i m = _mm_cmpgt_epi64(x, vmax);
+        vmax = _mm_blendv_epi8(vmax, x, m);
+    }
+
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, vmax);
+    for (size_t k = 0u; k < 2u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int64(int64_t*       out,
+                               const int64_t* a,
+                               const int64_t* b,
+                               size_t         len) {
+    /* m marks lanes with x > y */
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i m = _mm_cmpgt_epi64(x, y);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_blendv_epi8(x, y, m));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int64(int64_t*       out,
+                               const int64_t* a,
+                               const int64_t* b,
+                               size_t         len) {
+    /* m marks lanes with x > y */
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i m = _mm_cmpgt_epi64(x, y);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_blendv_epi8(y, x, m));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_AVX_MIN_INT64_INL */
 // ================================================================================
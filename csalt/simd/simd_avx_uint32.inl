@@ -32,6 +32,7 @@
 #include <immintrin.h>   /* AVX */
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -130,5 +131,204 @@ static inline error_code_t simd_min_uint32(const uint32_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_add_epi32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_sub_epi32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_mullo_epi32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint32(uint32_t*       out,
+                               const uint32_t* a,
+                               uint32_t        mul,
+                               uint32_t        add,
+                               size_t          len) {
+    __m128i const vmul = _mm_set1_epi32((int)mul);
+    __m128i const vadd = _mm_set1_epi32((int)add);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        x = _mm_mullo_epi32(x, vmul);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_add_epi32(x, vadd));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint32(uint32_t*       out,
+                              const uint32_t* a,
+                              uint32_t        lo,
+                              uint32_t        hi,
+                              size_t          len) {
+    __m128i const vlo = _mm_set1_epi32((int)lo);
+    __m128i const vhi = _mm_set1_epi32((int)hi);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        x = _mm_max_epu32(vlo, _mm_min_epu32(x, vhi));
+        _mm_storeu_si128((__m128i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint32(const uint32_t* data,
+                                    size_t          len,
+                                    uint32_t*       out) {
+    uint32_t cur = *out;   /* caller seeds with 0 */
+    size_t   i   = 0u;
+
+    __m128i vmax = _mm_set1_epi32((int)cur);
+    for (; i + 4u <= len; i += 4u) {
+        vmax = _mm_max_epu32(vmax, _mm_loadu_si128((const __m128i*)(data + i)));
+    }
+
+    uint32_t lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, vmax);
+    for (size_t k = 0u; k < 4u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint32(const uint32_t* data,
+                                size_t          len) {
+    __m128i const zero = _mm_setzero_si128();
+    __m128i acc        = zero;
+    size_t  i          = 0u;
+
+    /* Zero-extend each 32-bit lane to 64 bits before accumulating */
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(data + i));
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(x, zero));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(x, zero));
+    }
+
+    uint64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    uint64_t sum = 0;
+    for (size_t k = 0u; k < 2u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint32(uint32_t*       out,
+                                const uint32_t* a,
+                                const uint32_t* b,
+                                size_t          len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_min_epu32(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint32(uint32_t*       out,
+                                const uint32_t* a,
+                                const uint32_t* b,
+                                size_t          len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_max_epu32(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 4 lanes of x */
+static inline __m128i _avx_scan_epi32(__m128i x) {
+    x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+    x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+    return x;
+}
+// --------------------------------------------------------------------------------
+
+static uint32_t simd_scan_uint32(uint32_t*       out,
+                                 const uint32_t* a,
+                                 size_t          len,
+                                 uint32_t        carry,
+                                 bool            exclusive) {
+    /* cv holds the running total in every lane; the exclusive sums are
+     * r - x, which is exact under wrapping arithmetic */
+    __m128i cv = _mm_set1_epi32((int)carry);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i const x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i const p = _avx_scan_epi32(x);
+        __m128i const r = _mm_add_epi32(p, cv);
+        __m128i const y = exclusive ? _mm_sub_epi32(r, x) : r;
+        _mm_storeu_si128((__m128i*)(out + i), y);
+        cv = _mm_shuffle_epi32(r, 0xFF);
+    }
+    carry = (uint32_t)_mm_cvtsi128_si32(cv);
+    for (; i < len; i++) {
+        uint32_t const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX_UINT32_INL */
 
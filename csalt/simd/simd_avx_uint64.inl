@@ -33,6 +33,7 @@
 #include <smmintrin.h>   /* SSE4.1 _mm_cmpeq_epi64 */
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -112,5 +113,207 @@ static inline error_code_t simd_min_uint64(const uint64_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+/* Low 64 bits of a 64 x 64 product built from 32-bit multiplies, since
+ * x86 has no 64-bit mullo below AVX512DQ: lo*lo + ((hi*lo + lo*hi) << 32). */
+static inline __m128i _avx_mullo_epi64(__m128i a, __m128i b) {
+    __m128i lo  = _mm_mul_epu32(a, b);
+    __m128i mid = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b),
+                                _mm_mul_epu32(a, _mm_srli_epi64(b, 32)));
+    return _mm_add_epi64(lo, _mm_slli_epi64(mid, 32));
+}
+// --------------------------------------------------------------------------------
+
+static void simd_add_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_add_epi64(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_sub_epi64(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _avx_mullo_epi64(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint64(uint64_t*       out,
+                               const uint64_t* a,
+                               uint64_t        mul,
+                               uint64_t        add,
+                               size_t          len) {
+    __m128i const vmul = _mm_set1_epi64x((long long)mul);
+    __m128i const vadd = _mm_set1_epi64x((long long)add);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        x = _avx_mullo_epi64(x, vmul);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_add_epi64(x, vadd));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint64(uint64_t*       out,
+                              const uint64_t* a,
+                              uint64_t        lo,
+                              uint64_t        hi,
+                              size_t          len) {
+    /* Unsigned order via signed compares on sign-biased lanes */
+    __m128i const bias = _mm_set1_epi64x((long long)0x8000000000000000ull);
+    __m128i const vlo  = _mm_xor_si128(_mm_set1_epi64x((long long)lo), bias);
+    __m128i const vhi  = _mm_xor_si128(_mm_set1_epi64x((long long)hi), bias);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        x = _mm_xor_si128(x, bias);
+        __m128i m = _mm_cmpgt_epi64(x, vhi);
+        x = _mm_blendv_epi8(x, vhi, m);
+        m = _mm_cmpgt_epi64(vlo, x);
+        x = _mm_blendv_epi8(x, vlo, m);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_xor_si128(x, bias));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint64(const uint64_t* data,
+                                    size_t          len,
+                                    uint64_t*       out) {
+    uint64_t cur = *out;   /* caller seeds with 0 */
+    size_t   i   = 0u;
+
+    __m128i const bias = _mm_set1_epi64x((long long)0x8000000000000000ull);
+    __m128i vmax       = _mm_xor_si128(_mm_set1_epi64x((long long)cur), bias);
+    /* Unsigned order via signed compares on sign-biased lanes */
+    for (; i + 2u <= len; i += 2u) {
+        __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(data + i)), bias);
+        __m128i m = _mm_cmpgt_epi64(x, vmax);
+        vmax = _mm_blendv_epi8(vmax, x, m);
+    }
+    vmax = _mm_xor_si128(vmax, bias);
+
+    uint64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, vmax);
+    for (size_t k = 0u; k < 2u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint64(uint64_t*       out,
+                                const uint64_t* a,
+                                const uint64_t* b,
+                                size_t          len) {
+    /* m marks lanes with x > y; unsigned order via sign-biased lanes */
+    __m128i const bias = _mm_set1_epi64x((long long)0x8000000000000000ull);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i m = _mm_cmpgt_epi64(_mm_xor_si128(x, bias), _mm_xor_si128(y, bias));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_blendv_epi8(x, y, m));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint64(uint64_t*       out,
+                                const uint64_t* a,
+                                const uint64_t* b,
+                                size_t          len) {
+    /* m marks lanes with x > y; unsigned order via sign-biased lanes */
+    __m128i const bias = _mm_set1_epi64x((long long)0x8000000000000000ull);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i m = _mm_cmpgt_epi64(_mm_xor_si128(x, bias), _mm_xor_si128(y, bias));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_blendv_epi8(y, x, m));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 2 lanes of x */
+static inline __m128i _avx_scan_epi64(__m128i x) {
+    x = _mm_add_epi64(x, _mm_slli_si128(x, 8));
+    return x;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_scan_uint64(uint64_t*       out,
+                                 const uint64_t* a,
+                                 size_t          len,
+                                 uint64_t        carry,
+                                 bool            exclusive) {
+    /* cv holds the running total in every lane; the exclusive sums are
+     * r - x, which is exact under wrapping arithmetic */
+    __m128i cv = _mm_set1_epi64x((long long)carry);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128i const x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i const p = _avx_scan_epi64(x);
+        __m128i const r = _mm_add_epi64(p, cv);
+        __m128i const y = exclusive ? _mm_sub_epi64(r, x) : r;
+        _mm_storeu_si128((__m128i*)(out + i), y);
+        cv = _mm_shuffle_epi32(r, 0xEE);
+    }
+    _mm_storel_epi64((__m128i*)&carry, cv);
+    for (; i < len; i++) {
+        uint64_t const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX_UINT64_INL */
 
@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include <string.h>
 #include <immintrin.h>   /* AVX */
 // ================================================================================ 
@@ -46,10 +47,6 @@ static inline __m256i _avx_reverse_elems(__m256i v, size_t data_size) {
             return v;
     }
  
-    /* Broadcast 128-bit mask to both lanes of a 256-bit mask register */
-    __m256i mask256 = _mm256_broadcastsi128_si256(mask128);
- 
-    /* Apply pshufb per 128-bit lane via the 256-bit cast */
     /* AVX does not have _mm256_shuffle_epi8 — use the float register to
      * perform the lane operations via 128-bit extracts and inserts.     */
     __m128i lo_lane = _mm256_extractf128_si256(v, 0);
@@ -62,7 +59,6 @@ static inline __m256i _avx_reverse_elems(__m256i v, size_t data_size) {
     __m256i result = _mm256_castsi128_si256(hi_lane);
     result = _mm256_insertf128_si256(result, lo_lane, 1);
  
-    (void)mask256;   /* suppress unused warning — used conceptually above */
     return result;
 }
  
@@ -185,5 +181,215 @@ static inline error_code_t simd_min_uint8(const uint8_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+/* No 8-bit multiply on x86: multiply the even and odd bytes as 16-bit
+ * lanes and keep the low byte of each product. */
+static inline __m128i _avx_mullo_epi8(__m128i a, __m128i b) {
+    __m128i even = _mm_mullo_epi16(a, b);
+    __m128i odd  = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+    return _mm_or_si128(_mm_slli_epi16(odd, 8),
+                        _mm_and_si128(even, _mm_set1_epi16(0x00FF)));
+}
+// --------------------------------------------------------------------------------
+
+static void simd_add_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_add_epi8(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint8_t)(a[i] + b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_sub_epi8(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint8_t)(a[i] - b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _avx_mullo_epi8(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint8_t)(a[i] * b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint8(uint8_t*       out,
+                              const uint8_t* a,
+                              uint8_t        mul,
+                              uint8_t        add,
+                              size_t         len) {
+    __m128i const vmul = _mm_set1_epi8((char)mul);
+    __m128i const vadd = _mm_set1_epi8((char)add);
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        x = _avx_mullo_epi8(x, vmul);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_add_epi8(x, vadd));
+    }
+    for (; i < len; i++)
+        out[i] = (uint8_t)(a[i] * mul + add);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint8(uint8_t*       out,
+                             const uint8_t* a,
+                             uint8_t        lo,
+                             uint8_t        hi,
+                             size_t         len) {
+    __m128i const vlo = _mm_set1_epi8((char)lo);
+    __m128i const vhi = _mm_set1_epi8((char)hi);
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        x = _mm_max_epu8(vlo, _mm_min_epu8(x, vhi));
+        _mm_storeu_si128((__m128i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint8(const uint8_t* data,
+                                   size_t         len,
+                                   uint8_t*       out) {
+    uint8_t cur = *out;   /* caller seeds with 0 */
+    size_t  i   = 0u;
+
+    __m128i vmax = _mm_set1_epi8((char)cur);
+    for (; i + 16u <= len; i += 16u) {
+        vmax = _mm_max_epu8(vmax, _mm_loadu_si128((const __m128i*)(data + i)));
+    }
+
+    uint8_t lanes[16];
+    _mm_storeu_si128((__m128i*)lanes, vmax);
+    for (size_t k = 0u; k < 16u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint8(const uint8_t* data,
+                               size_t         len) {
+    __m128i const zero = _mm_setzero_si128();
+    __m128i acc        = zero;
+    size_t  i          = 0u;
+
+    /* SAD against zero sums each group of eight bytes into a 64-bit lane */
+    for (; i + 16u <= len; i += 16u) {
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(_mm_loadu_si128((const __m128i*)(data + i)), zero));
+    }
+
+    uint64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    uint64_t sum = 0;
+    for (size_t k = 0u; k < 2u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               const uint8_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_min_epu8(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               const uint8_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_max_epu8(y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 16 lanes of x */
+static inline __m128i _avx_scan_epi8(__m128i x) {
+    x = _mm_add_epi8(x, _mm_slli_si128(x, 1));
+    x = _mm_add_epi8(x, _mm_slli_si128(x, 2));
+    x = _mm_add_epi8(x, _mm_slli_si128(x, 4));
+    x = _mm_add_epi8(x, _mm_slli_si128(x, 8));
+    return x;
+}
+// --------------------------------------------------------------------------------
+
+static uint8_t simd_scan_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               size_t         len,
+                               uint8_t        carry,
+                               bool           exclusive) {
+    /* cv holds the running total in every lane; the exclusive sums are
+     * r - x, which is exact under wrapping arithmetic */
+    __m128i const last = _mm_set1_epi8(15);
+    __m128i cv = _mm_set1_epi8((char)carry);
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m128i const x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i const p = _avx_scan_epi8(x);
+        __m128i const r = _mm_add_epi8(p, cv);
+        __m128i const y = exclusive ? _mm_sub_epi8(r, x) : r;
+        _mm_storeu_si128((__m128i*)(out + i), y);
+        cv = _mm_shuffle_epi8(r, last);
+    }
+    carry = (uint8_t)_mm_cvtsi128_si32(cv);
+    for (; i < len; i++) {
+        uint8_t const prev = carry;
+        carry = (uint8_t)(carry + a[i]);
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_AVX_UINT8_INL */
 
@@ -0,0 +1,936 @@
+// ================================================================================
+// ================================================================================
+// - File:    simd_dispatch.h
+// - Purpose: Private kernel table shared by every SIMD tier.  Each tier of
+//            simd_kernels.c fills one simd_kernels_t with the static
+//            functions from its simd_<isa>_<type>.inl files; the library
+//            translation units call the kernels through the inline shims
+//            at the bottom of this file, which keep the historical
+//            simd_<op>_<type> names so call sites did not change.
+//
+//            With CSALT_SIMD_DISPATCH defined (x86-64 GCC/Clang builds)
+//            every tier is compiled into the library and the best one the
+//            host supports is chosen on first use.  Otherwise a single
+//            table, simd_kernels_native, is built for the compile target.
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 16, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2026, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+#ifndef CSALT_SIMD_DISPATCH_H
+#define CSALT_SIMD_DISPATCH_H
+
+#include "c_error.h"
+#include "c_simd.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#if defined(CSALT_SIMD_DISPATCH)
+#  include <stdatomic.h>
+#endif
+
+#ifndef ITER_DIR_H
+#define ITER_DIR_H
+    typedef enum {
+        FORWARD = 0,
+        REVERSE = 1
+    }direction_t;
+#endif /* ITER_DIR_H*/
+// ================================================================================
+// ================================================================================
+
+/**
+ * @brief Function table for one SIMD tier.
+ *
+ * Signatures match the static kernels in simd_<isa>_<type>.inl exactly.
+ * Signed 16/32/64-bit tensors reuse the unsigned lsearch kernels because
+ * equality search is sign-agnostic.
+ */
+typedef struct {
+    simd_isa_t isa;
+
+    /* float */
+    size_t       (*lsearch_float)(const float*, size_t, float, float);
+    bool         (*floats_equal)(const float*, const float*, size_t, float);
+    error_code_t (*min_float)(const float*, size_t, float*);
+
+    /* double */
+    size_t       (*lsearch_double)(const double*, size_t, double, double);
+    bool         (*doubles_equal)(const double*, const double*, size_t, double);
+    error_code_t (*min_double)(const double*, size_t, double*);
+
+    /* 8-bit */
+    error_code_t (*min_int8)(const int8_t*, size_t, int8_t*);
+    error_code_t (*min_uint8)(const uint8_t*, size_t, uint8_t*);
+    void         (*reverse_uint8)(uint8_t*, size_t, size_t);
+
+    /* 16-bit */
+    size_t       (*lsearch_uint16)(const uint16_t*, size_t, uint16_t);
+    error_code_t (*min_int16)(const int16_t*, size_t, int16_t*);
+    error_code_t (*min_uint16)(const uint16_t*, size_t, uint16_t*);
+
+    /* 32-bit */
+    size_t       (*lsearch_uint32)(const uint32_t*, size_t, uint32_t);
+    error_code_t (*min_int32)(const int32_t*, size_t, int32_t*);
+    error_code_t (*min_uint32)(const uint32_t*, size_t, uint32_t*);
+
+    /* 64-bit */
+    size_t       (*lsearch_uint64)(const uint64_t*, size_t, uint64_t);
+    error_code_t (*min_int64)(const int64_t*, size_t, int64_t*);
+    error_code_t (*min_uint64)(const uint64_t*, size_t, uint64_t*);
+
+    /* byte strings */
+    size_t (*first_diff_u8)(const uint8_t*, const uint8_t*, size_t);
+    size_t (*find_substr_u8)(const uint8_t*, size_t, const uint8_t*, size_t,
+                             direction_t);
+    size_t (*token_count_u8)(const uint8_t*, size_t, const char*, size_t);
+    void   (*ascii_upper_u8)(uint8_t*, size_t);
+    void   (*ascii_lower_u8)(uint8_t*, size_t);
+
+    /* elementwise arithmetic: out may alias a or b.  Wrapping add, sub, mul
+     * and muladd are sign-agnostic, so signed tensors use the uint kernels */
+    void (*add_float)(float*, const float*, const float*, size_t);
+    void (*sub_float)(float*, const float*, const float*, size_t);
+    void (*mul_float)(float*, const float*, const float*, size_t);
+    void (*div_float)(float*, const float*, const float*, size_t);
+    void (*muladd_float)(float*, const float*, float, float, size_t);
+    void (*clamp_float)(float*, const float*, float, float, size_t);
+    void (*abs_float)(float*, const float*, size_t);
+
+    void (*add_double)(double*, const double*, const double*, size_t);
+    void (*sub_double)(double*, const double*, const double*, size_t);
+    void (*mul_double)(double*, const double*, const double*, size_t);
+    void (*div_double)(double*, const double*, const double*, size_t);
+    void (*muladd_double)(double*, const double*, double, double, size_t);
+    void (*clamp_double)(double*, const double*, double, double, size_t);
+    void (*abs_double)(double*, const double*, size_t);
+
+    void (*add_uint8)(uint8_t*, const uint8_t*, const uint8_t*, size_t);
+    void (*sub_uint8)(uint8_t*, const uint8_t*, const uint8_t*, size_t);
+    void (*mul_uint8)(uint8_t*, const uint8_t*, const uint8_t*, size_t);
+    void (*muladd_uint8)(uint8_t*, const uint8_t*, uint8_t, uint8_t, size_t);
+    void (*clamp_uint8)(uint8_t*, const uint8_t*, uint8_t, uint8_t, size_t);
+    void (*clamp_int8)(int8_t*, const int8_t*, int8_t, int8_t, size_t);
+    void (*abs_int8)(int8_t*, const int8_t*, size_t);
+
+    void (*add_uint16)(uint16_t*, const uint16_t*, const uint16_t*, size_t);
+    void (*sub_uint16)(uint16_t*, const uint16_t*, const uint16_t*, size_t);
+    void (*mul_uint16)(uint16_t*, const uint16_t*, const uint16_t*, size_t);
+    void (*muladd_uint16)(uint16_t*, const uint16_t*, uint16_t, uint16_t, size_t);
+    void (*clamp_uint16)(uint16_t*, const uint16_t*, uint16_t, uint16_t, size_t);
+    void (*clamp_int16)(int16_t*, const int16_t*, int16_t, int16_t, size_t);
+    void (*abs_int16)(int16_t*, const int16_t*, size_t);
+
+    void (*add_uint32)(uint32_t*, const uint32_t*, const uint32_t*, size_t);
+    void (*sub_uint32)(uint32_t*, const uint32_t*, const uint32_t*, size_t);
+    void (*mul_uint32)(uint32_t*, const uint32_t*, const uint32_t*, size_t);
+    void (*muladd_uint32)(uint32_t*, const uint32_t*, uint32_t, uint32_t, size_t);
+    void (*clamp_uint32)(uint32_t*, const uint32_t*, uint32_t, uint32_t, size_t);
+    void (*clamp_int32)(int32_t*, const int32_t*, int32_t, int32_t, size_t);
+    void (*abs_int32)(int32_t*, const int32_t*, size_t);
+
+    void (*add_uint64)(uint64_t*, const uint64_t*, const uint64_t*, size_t);
+    void (*sub_uint64)(uint64_t*, const uint64_t*, const uint64_t*, size_t);
+    void (*mul_uint64)(uint64_t*, const uint64_t*, const uint64_t*, size_t);
+    void (*muladd_uint64)(uint64_t*, const uint64_t*, uint64_t, uint64_t, size_t);
+    void (*clamp_uint64)(uint64_t*, const uint64_t*, uint64_t, uint64_t, size_t);
+    void (*clamp_int64)(int64_t*, const int64_t*, int64_t, int64_t, size_t);
+    void (*abs_int64)(int64_t*, const int64_t*, size_t);
+
+    /* reductions: max is seeded through *out like min.  Integer sums widen
+     * to 64 bits; float sum, asum and dot cover one block and the callers
+     * combine blocks pairwise */
+    error_code_t (*max_float)(const float*, size_t, float*);
+    float        (*sum_float)(const float*, size_t);
+    float        (*asum_float)(const float*, size_t);
+    float        (*dot_float)(const float*, const float*, size_t);
+
+    error_code_t (*max_double)(const double*, size_t, double*);
+    double       (*sum_double)(const double*, size_t);
+    double       (*asum_double)(const double*, size_t);
+    double       (*dot_double)(const double*, const double*, size_t);
+
+    error_code_t (*max_uint8)(const uint8_t*, size_t, uint8_t*);
+    uint64_t     (*sum_uint8)(const uint8_t*, size_t);
+    error_code_t (*max_int8)(const int8_t*, size_t, int8_t*);
+    int64_t      (*sum_int8)(const int8_t*, size_t);
+
+    error_code_t (*max_uint16)(const uint16_t*, size_t, uint16_t*);
+    uint64_t     (*sum_uint16)(const uint16_t*, size_t);
+    error_code_t (*max_int16)(const int16_t*, size_t, int16_t*);
+    int64_t      (*sum_int16)(const int16_t*, size_t);
+
+    error_code_t (*max_uint32)(const uint32_t*, size_t, uint32_t*);
+    uint64_t     (*sum_uint32)(const uint32_t*, size_t);
+    error_code_t (*max_int32)(const int32_t*, size_t, int32_t*);
+    int64_t      (*sum_int32)(const int32_t*, size_t);
+
+    error_code_t (*max_uint64)(const uint64_t*, size_t, uint64_t*);
+    error_code_t (*max_int64)(const int64_t*, size_t, int64_t*);
+
+    /* elementwise minimum and maximum: out may alias a or b.  Float lanes
+     * propagate NaN from either operand */
+    void (*minimum_float)(float*, const float*, const float*, size_t);
+    void (*maximum_float)(float*, const float*, const float*, size_t);
+
+    void (*minimum_double)(double*, const double*, const double*, size_t);
+    void (*maximum_double)(double*, const double*, const double*, size_t);
+
+    void (*minimum_uint8)(uint8_t*, const uint8_t*, const uint8_t*, size_t);
+    void (*maximum_uint8)(uint8_t*, const uint8_t*, const uint8_t*, size_t);
+    void (*minimum_int8)(int8_t*, const int8_t*, const int8_t*, size_t);
+    void (*maximum_int8)(int8_t*, const int8_t*, const int8_t*, size_t);
+
+    void (*minimum_uint16)(uint16_t*, const uint16_t*, const uint16_t*, size_t);
+    void (*maximum_uint16)(uint16_t*, const uint16_t*, const uint16_t*, size_t);
+    void (*minimum_int16)(int16_t*, const int16_t*, const int16_t*, size_t);
+    void (*maximum_int16)(int16_t*, const int16_t*, const int16_t*, size_t);
+
+    void (*minimum_uint32)(uint32_t*, const uint32_t*, const uint32_t*, size_t);
+    void (*maximum_uint32)(uint32_t*, const uint32_t*, const uint32_t*, size_t);
+    void (*minimum_int32)(int32_t*, const int32_t*, const int32_t*, size_t);
+    void (*maximum_int32)(int32_t*, const int32_t*, const int32_t*, size_t);
+
+    void (*minimum_uint64)(uint64_t*, const uint64_t*, const uint64_t*, size_t);
+    void (*maximum_uint64)(uint64_t*, const uint64_t*, const uint64_t*, size_t);
+    void (*minimum_int64)(int64_t*, const int64_t*, const int64_t*, size_t);
+    void (*maximum_int64)(int64_t*, const int64_t*, const int64_t*, size_t);
+
+    /* prefix sums: returns carry plus the sum of a[0..len).  out may alias
+     * a.  Signed integers scan through the unsigned kernels */
+    float    (*scan_float)(float*, const float*, size_t, float, bool);
+    double   (*scan_double)(double*, const double*, size_t, double, bool);
+    uint8_t  (*scan_uint8)(uint8_t*, const uint8_t*, size_t, uint8_t, bool);
+    uint16_t (*scan_uint16)(uint16_t*, const uint16_t*, size_t, uint16_t, bool);
+    uint32_t (*scan_uint32)(uint32_t*, const uint32_t*, size_t, uint32_t, bool);
+    uint64_t (*scan_uint64)(uint64_t*, const uint64_t*, size_t, uint64_t, bool);
+
+    /* matrix kernels: axpy is y += alpha * x; gemm4 accumulates a 4-row
+     * block of row-major C += A * B given ldc, lda, ldb, k and n; spdot is
+     * the gathered dot product of a sparse row with a dense vector;
+     * transpose writes one rows x cols tile of src (stride lds) transposed
+     * into dst (stride ldd); transpose_stream transposes one band of 64
+     * bytes' worth of source rows into 64-byte aligned destination lines
+     * given cols; bsr accumulates one block row of a block-CSR product given
+     * nb, rows, br and bc; sell computes one slice of a SELL-C-sigma
+     * product given chunk and width */
+    void   (*axpy_float)(float*, const float*, float, size_t);
+    void   (*gemm4_float)(float*, size_t, const float*, size_t,
+                          const float*, size_t, size_t, size_t);
+    float  (*spdot_float)(const float*, const size_t*, const float*, size_t);
+    void   (*axpy_double)(double*, const double*, double, size_t);
+    void   (*gemm4_double)(double*, size_t, const double*, size_t,
+                           const double*, size_t, size_t, size_t);
+    double (*spdot_double)(const double*, const size_t*, const double*, size_t);
+    void   (*transpose_float)(float*, size_t, const float*, size_t, size_t, size_t);
+    void   (*transpose_double)(double*, size_t, const double*, size_t, size_t, size_t);
+    void   (*transpose_stream_float)(float*, size_t, const float*, size_t, size_t);
+    void   (*transpose_stream_double)(double*, size_t, const double*, size_t, size_t);
+    void   (*bsr_float)(float*, const float*, const size_t*, const float*,
+                        size_t, size_t, size_t, size_t);
+    void   (*sell_float)(float*, const float*, const size_t*, const float*,
+                         size_t, size_t);
+    void   (*bsr_double)(double*, const double*, const size_t*, const double*,
+                         size_t, size_t, size_t, size_t);
+    void   (*sell_double)(double*, const double*, const size_t*, const double*,
+                          size_t, size_t);
+} simd_kernels_t;
+// ================================================================================
+// ================================================================================
+
+#if defined(CSALT_SIMD_DISPATCH)
+
+extern const simd_kernels_t simd_kernels_sse2;
+extern const simd_kernels_t simd_kernels_ssse3;
+extern const simd_kernels_t simd_kernels_sse41;
+extern const simd_kernels_t simd_kernels_avx;
+extern const simd_kernels_t simd_kernels_avx2;
+extern const simd_kernels_t simd_kernels_avx512;
+
+/* Active table; NULL until the first kernel call or simd_select_isa(). */
+extern _Atomic(const simd_kernels_t*) simd_kernel_table;
+
+/* Probe the host, publish the best table and return it (c_simd.c). */
+const simd_kernels_t* simd_resolve_kernels(void);
+
+static inline const simd_kernels_t* simd_kernels(void) {
+    const simd_kernels_t* k = atomic_load_explicit(&simd_kernel_table,
+                                                   memory_order_acquire);
+    return (k != NULL) ? k : simd_resolve_kernels();
+}
+
+#else
+
+extern const simd_kernels_t simd_kernels_native;
+
+static inline const simd_kernels_t* simd_kernels(void) {
+    return &simd_kernels_native;
+}
+
+#endif /* CSALT_SIMD_DISPATCH */
+// ================================================================================
+// ================================================================================
+// CALL-SITE SHIMS
+//
+// simd_kernels.c defines SIMD_KERNEL_TABLE and includes the real static
+// kernels under these same names, so the shims are only emitted for the
+// library translation units that call through the table.
+
+#if !defined(SIMD_KERNEL_TABLE)
+
+static inline size_t simd_lsearch_float(const float* data, size_t len,
+                                        float value, float tolerance) {
+    return simd_kernels()->lsearch_float(data, len, value, tolerance);
+}
+
+static inline bool simd_floats_equal(const float* a, const float* b,
+                                     size_t len, float tolerance) {
+    return simd_kernels()->floats_equal(a, b, len, tolerance);
+}
+
+static inline error_code_t simd_min_float(const float* data, size_t len,
+                                          float* out) {
+    return simd_kernels()->min_float(data, len, out);
+}
+// --------------------------------------------------------------------------------
+
+static inline size_t simd_lsearch_double(const double* data, size_t len,
+                                         double value, double tolerance) {
+    return simd_kernels()->lsearch_double(data, len, value, tolerance);
+}
+
+static inline bool simd_doubles_equal(const double* a, const double* b,
+                                      size_t len, double tolerance) {
+    return simd_kernels()->doubles_equal(a, b, len, tolerance);
+}
+
+static inline error_code_t simd_min_double(const double* data, size_t len,
+                                           double* out) {
+    return simd_kernels()->min_double(data, len, out);
+}
+// --------------------------------------------------------------------------------
+
+static inline error_code_t simd_min_int8(const int8_t* data, size_t len,
+                                         int8_t* out) {
+    return simd_kernels()->min_int8(data, len, out);
+}
+
+static inline error_code_t simd_min_uint8(const uint8_t* data, size_t len,
+                                          uint8_t* out) {
+    return simd_kernels()->min_uint8(data, len, out);
+}
+
+static inline void simd_reverse_uint8(uint8_t* data, size_t len,
+                                      size_t data_size) {
+    simd_kernels()->reverse_uint8(data, len, data_size);
+}
+// --------------------------------------------------------------------------------
+
+static inline size_t simd_lsearch_uint16(const uint16_t* data, size_t len,
+                                         uint16_t value) {
+    return simd_kernels()->lsearch_uint16(data, len, value);
+}
+
+static inline error_code_t simd_min_int16(const int16_t* data, size_t len,
+                                          int16_t* out) {
+    return simd_kernels()->min_int16(data, len, out);
+}
+
+static inline error_code_t simd_min_uint16(const uint16_t* data, size_t len,
+                                           uint16_t* out) {
+    return simd_kernels()->min_uint16(data, len, out);
+}
+// --------------------------------------------------------------------------------
+
+static inline size_t simd_lsearch_uint32(const uint32_t* data, size_t len,
+                                         uint32_t value) {
+    return simd_kernels()->lsearch_uint32(data, len, value);
+}
+
+static inline error_code_t simd_min_int32(const int32_t* data, size_t len,
+                                          int32_t* out) {
+    return simd_kernels()->min_int32(data, len, out);
+}
+
+static inline error_code_t simd_min_uint32(const uint32_t* data, size_t len,
+                                           uint32_t* out) {
+    return simd_kernels()->min_uint32(data, len, out);
+}
+// --------------------------------------------------------------------------------
+
+static inline size_t simd_lsearch_uint64(const uint64_t* data, size_t len,
+                                         uint64_t value) {
+    return simd_kernels()->lsearch_uint64(data, len, value);
+}
+
+static inline error_code_t simd_min_int64(const int64_t* data, size_t len,
+                                          int64_t* out) {
+    return simd_kernels()->min_int64(data, len, out);
+}
+
+static inline error_code_t simd_min_uint64(const uint64_t* data, size_t len,
+                                           uint64_t* out) {
+    return simd_kernels()->min_uint64(data, len, out);
+}
+// --------------------------------------------------------------------------------
+
+static inline size_t simd_first_diff_u8(const uint8_t* a, const uint8_t* b,
+                                        size_t n) {
+    return simd_kernels()->first_diff_u8(a, b, n);
+}
+
+static inline size_t simd_find_substr_u8(const uint8_t* hay, size_t hay_len,
+                                         const uint8_t* needle,
+                                         size_t needle_len,
+                                         direction_t dir) {
+    return simd_kernels()->find_substr_u8(hay, hay_len, needle, needle_len,
+                                          dir);
+}
+
+static inline size_t simd_token_count_u8(const uint8_t* s, size_t n,
+                                         const char* delim, size_t dlen) {
+    return simd_kernels()->token_count_u8(s, n, delim, dlen);
+}
+
+static inline void simd_ascii_upper_u8(uint8_t* p, size_t n) {
+    simd_kernels()->ascii_upper_u8(p, n);
+}
+
+static inline void simd_ascii_lower_u8(uint8_t* p, size_t n) {
+    simd_kernels()->ascii_lower_u8(p, n);
+}
+
+// --------------------------------------------------------------------------------
+
+static inline void simd_add_float(float* out, const float* a, const float* b,
+                                  size_t len) {
+    simd_kernels()->add_float(out, a, b, len);
+}
+
+static inline void simd_sub_float(float* out, const float* a, const float* b,
+                                  size_t len) {
+    simd_kernels()->sub_float(out, a, b, len);
+}
+
+static inline void simd_mul_float(float* out, const float* a, const float* b,
+                                  size_t len) {
+    simd_kernels()->mul_float(out, a, b, len);
+}
+
+static inline void simd_div_float(float* out, const float* a, const float* b,
+                                  size_t len) {
+    simd_kernels()->div_float(out, a, b, len);
+}
+
+static inline void simd_muladd_float(float* out, const float* a, float mul,
+                                     float add, size_t len) {
+    simd_kernels()->muladd_float(out, a, mul, add, len);
+}
+
+static inline void simd_clamp_float(float* out, const float* a, float lo,
+                                    float hi, size_t len) {
+    simd_kernels()->clamp_float(out, a, lo, hi, len);
+}
+
+static inline void simd_abs_float(float* out, const float* a, size_t len) {
+    simd_kernels()->abs_float(out, a, len);
+}
+// --------------------------------------------------------------------------------
+
+static inline void simd_add_double(double* out, const double* a,
+                                   const double* b, size_t len) {
+    simd_kernels()->add_double(out, a, b, len);
+}
+
+static inline void simd_sub_double(double* out, const double* a,
+                                   const double* b, size_t len) {
+    simd_kernels()->sub_double(out, a, b, len);
+}
+
+static inline void simd_mul_double(double* out, const double* a,
+                                   const double* b, size_t len) {
+    simd_kernels()->mul_double(out, a, b, len);
+}
+
+static inline void simd_div_double(double* out, const double* a,
+                                   const double* b, size_t len) {
+    simd_kernels()->div_double(out, a, b, len);
+}
+
+static inline void simd_muladd_double(double* out, const double* a, double mul,
+                                      double add, size_t len) {
+    simd_kernels()->muladd_double(out, a, mul, add, len);
+}
+
+static inline void simd_clamp_double(double* out, const double* a, double lo,
+                                     double hi, size_t len) {
+    simd_kernels()->clamp_double(out, a, lo, hi, len);
+}
+
+static inline void simd_abs_double(double* out, const double* a, size_t len) {
+    simd_kernels()->abs_double(out, a, len);
+}
+// --------------------------------------------------------------------------------
+
+static inline void simd_add_uint8(uint8_t* out, const uint8_t* a,
+                                  const uint8_t* b, size_t len) {
+    simd_kernels()->add_uint8(out, a, b, len);
+}
+
+static inline void simd_sub_uint8(uint8_t* out, const uint8_t* a,
+                                  const uint8_t* b, size_t len) {
+    simd_kernels()->sub_uint8(out, a, b, len);
+}
+
+static inline void simd_mul_uint8(uint8_t* out, const uint8_t* a,
+                                  const uint8_t* b, size_t len) {
+    simd_kernels()->mul_uint8(out, a, b, len);
+}
+
+static inline void simd_muladd_uint8(uint8_t* out, const uint8_t* a,
+                                     uint8_t mul, uint8_t add, size_t len) {
+    simd_kernels()->muladd_uint8(out, a, mul, add, len);
+}
+
+static inline void simd_clamp_uint8(uint8_t* out, const uint8_t* a, uint8_t lo,
+                                    uint8_t hi, size_t len) {
+    simd_kernels()->clamp_uint8(out, a, lo, hi, len);
+}
+// --------------------------------------------------------------------------------
+
+static inline void simd_clamp_int8(int8_t* out, const int8_t* a, int8_t lo,
+                                   int8_t hi, size_t len) {
+    simd_kernels()->clamp_int8(out, a, lo, hi, len);
+}
+
+static inline void simd_abs_int8(int8_t* out, const int8_t* a, size_t len) {
+    simd_kernels()->abs_int8(out, a, len);
+}
+// --------------------------------------------------------------------------------
+
+static inline void simd_add_uint16(uint16_t* out, const uint16_t* a,
+                                   const uint16_t* b, size_t len) {
+    simd_kernels()->add_uint16(out, a, b, len);
+}
+
+static inline void simd_sub_uint16(uint16_t* out, const uint16_t* a,
+                                   const uint16_t* b, size_t len) {
+    simd_kernels()->sub_uint16(out, a, b, len);
+}
+
+static inline void simd_mul_uint16(uint16_t* out, const uint16_t* a,
+                                   const uint16_t* b, size_t len) {
+    simd_kernels()->mul_uint16(out, a, b, len);
+}
+
+static inline void simd_muladd_uint16(uint16_t* out, const uint16_t* a,
+                                      uint16_t mul, uint16_t add, size_t len) {
+    simd_kernels()->muladd_uint16(out, a, mul, add, len);
+}
+
+static inline void simd_clamp_uint16(uint16_t* out, const uint16_t* a,
+                                     uint16_t lo, uint16_t hi, size_t len) {
+    simd_kernels()->clamp_uint16(out, a, lo, hi, len);
+}
+// --------------------------------------------------------------------------------
+
+static inline void simd_clamp_int16(int16_t* out, const int16_t* a, int16_t lo,
+                                    int16_t hi, size_t len) {
+    simd_kernels()->clamp_int16(out, a, lo, hi, len);
+}
+
+static inline void simd_abs_int16(int16_t* out, const int16_t* a, size_t len) {
+    simd_kernels()->abs_int16(out, a, len);
+}
+// --------------------------------------------------------------------------------
+
+static inline void simd_add_uint32(uint32_t* out, const uint32_t* a,
+                                   const uint32_t* b, size_t len) {
+    simd_kernels()->add_uint32(out, a, b, len);
+}
+
+static inline void simd_sub_uint32(uint32_t* out, const uint32_t* a,
+                                   const uint32_t* b, size_t len) {
+    simd_kernels()->sub_uint32(out, a, b, len);
+}
+
+static inline void simd_mul_uint32(uint32_t* out, const uint32_t* a,
+                                   const uint32_t* b, size_t len) {
+    simd_kernels()->mul_uint32(out, a, b, len);
+}
+
+static inline void simd_muladd_uint32(uint32_t* out, const uint32_t* a,
+                                      uint32_t mul, uint32_t add, size_t len) {
+    simd_kernels()->muladd_uint32(out, a, mul, add, len);
+}
+
+static inline void simd_clamp_uint32(uint32_t* out, const uint32_t* a,
+                                     uint32_t lo, uint32_t hi, size_t len) {
+    simd_kernels()->clamp_uint32(out, a, lo, hi, len);
+}
+// --------------------------------------------------------------------------------
+
+static inline void simd_clamp_int32(int32_t* out, const int32_t* a, int32_t lo,
+                                    int32_t hi, size_t len) {
+    simd_kernels()->clamp_int32(out, a, lo, hi, len);
+}
+
+static inline void simd_abs_int32(int32_t* out, const int32_t* a, size_t len) {
+    simd_kernels()->abs_int32(out, a, len);
+}
+// --------------------------------------------------------------------------------
+
+static inline void simd_add_uint64(uint64_t* out, const uint64_t* a,
+                                   const uint64_t* b, size_t len) {
+    simd_kernels()->add_uint64(out, a, b, len);
+}
+
+static inline void simd_sub_uint64(uint64_t* out, const uint64_t* a,
+                                   const uint64_t* b, size_t len) {
+    simd_kernels()->sub_uint64(out, a, b, len);
+}
+
+static inline void simd_mul_uint64(uint64_t* out, const uint64_t* a,
+                                   const uint64_t* b, size_t len) {
+    simd_kernels()->mul_uint64(out, a, b, len);
+}
+
+static inline void simd_muladd_uint64(uint64_t* out, const uint64_t* a,
+                                      uint64_t mul, uint64_t add, size_t len) {
+    simd_kernels()->muladd_uint64(out, a, mul, add, len);
+}
+
+static inline void simd_clamp_uint64(uint64_t* out, const uint64_t* a,
+                                     uint64_t lo, uint64_t hi, size_t len) {
+    simd_kernels()->clamp_uint64(out, a, lo, hi, len);
+}
+// --------------------------------------------------------------------------------
+
+static inline void simd_clamp_int64(int64_t* out, const int64_t* a, int64_t lo,
+                                    int64_t hi, size_t len) {
+    simd_kernels()->clamp_int64(out, a, lo, hi, len);
+}
+
+static inline void simd_abs_int64(int64_t* out, const int64_t* a, size_t len) {
+    simd_kernels()->abs_int64(out, a, len);
+}
+// --------------------------------------------------------------------------------
+
+static inline error_code_t simd_max_float(const float* data, size_t len,
+                                          float* out) {
+    return simd_kernels()->max_float(data, len, out);
+}
+
+static inline float simd_sum_float(const float* data, size_t len) {
+    return simd_kernels()->sum_float(data, len);
+}
+
+static inline float simd_asum_float(const float* data, size_t len) {
+    return simd_kernels()->asum_float(data, len);
+}
+
+static inline float simd_dot_float(const float* a, const float* b, size_t len) {
+    return simd_kernels()->dot_float(a, b, len);
+}
+
+static inline error_code_t simd_max_double(const double* data, size_t len,
+                                           double* out) {
+    return simd_kernels()->max_double(data, len, out);
+}
+
+static inline double simd_sum_double(const double* data, size_t len) {
+    return simd_kernels()->sum_double(data, len);
+}
+
+static inline double simd_asum_double(const double* data, size_t len) {
+    return simd_kernels()->asum_double(data, len);
+}
+
+static inline double simd_dot_double(const double* a, const double* b,
+                                     size_t len) {
+    return simd_kernels()->dot_double(a, b, len);
+}
+
+static inline error_code_t simd_max_uint8(const uint8_t* data, size_t len,
+                                          uint8_t* out) {
+    return simd_kernels()->max_uint8(data, len, out);
+}
+
+static inline uint64_t simd_sum_uint8(const uint8_t* data, size_t len) {
+    return simd_kernels()->sum_uint8(data, len);
+}
+
+static inline error_code_t simd_max_int8(const int8_t* data, size_t len,
+                                         int8_t* out) {
+    return simd_kernels()->max_int8(data, len, out);
+}
+
+static inline int64_t simd_sum_int8(const int8_t* data, size_t len) {
+    return simd_kernels()->sum_int8(data, len);
+}
+
+static inline error_code_t simd_max_uint16(const uint16_t* data, size_t len,
+                                           uint16_t* out) {
+    return simd_kernels()->max_uint16(data, len, out);
+}
+
+static inline uint64_t simd_sum_uint16(const uint16_t* data, size_t len) {
+    return simd_kernels()->sum_uint16(data, len);
+}
+
+static inline error_code_t simd_max_int16(const int16_t* data, size_t len,
+                                          int16_t* out) {
+    return simd_kernels()->max_int16(data, len, out);
+}
+
+static inline int64_t simd_sum_int16(const int16_t* data, size_t len) {
+    return simd_kernels()->sum_int16(data, len);
+}
+
+static inline error_code_t simd_max_uint32(const uint32_t* data, size_t len,
+                                           uint32_t* out) {
+    return simd_kernels()->max_uint32(data, len, out);
+}
+
+static inline uint64_t simd_sum_uint32(const uint32_t* data, size_t len) {
+    return simd_kernels()->sum_uint32(data, len);
+}
+
+static inline error_code_t simd_max_int32(const int32_t* data, size_t len,
+                                          int32_t* out) {
+    return simd_kernels()->max_int32(data, len, out);
+}
+
+static inline int64_t simd_sum_int32(const int32_t* data, size_t len) {
+    return simd_kernels()->sum_int32(data, len);
+}
+
+static inline error_code_t simd_max_uint64(const uint64_t* data, size_t len,
+                                           uint64_t* out) {
+    return simd_kernels()->max_uint64(data, len, out);
+}
+
+static inline error_code_t simd_max_int64(const int64_t* data, size_t len,
+                                          int64_t* out) {
+    return simd_kernels()->max_int64(data, len, out);
+}
+// --------------------------------------------------------------------------------
+
+static inline void simd_minimum_float(float* out, const float* a,
+                                      const float* b, size_t len) {
+    simd_kernels()->minimum_float(out, a, b, len);
+}
+
+static inline void simd_maximum_float(float* out, const float* a,
+                                      const float* b, size_t len) {
+    simd_kernels()->maximum_float(out, a, b, len);
+}
+
+static inline void simd_minimum_double(double* out, const double* a,
+                                       const double* b, size_t len) {
+    simd_kernels()->minimum_double(out, a, b, len);
+}
+
+static inline void simd_maximum_double(double* out, const double* a,
+                                       const double* b, size_t len) {
+    simd_kernels()->maximum_double(out, a, b, len);
+}
+
+static inline void simd_minimum_uint8(uint8_t* out, const uint8_t* a,
+                                      const uint8_t* b, size_t len) {
+    simd_kernels()->minimum_uint8(out, a, b, len);
+}
+
+static inline void simd_maximum_uint8(uint8_t* out, const uint8_t* a,
+                                      const uint8_t* b, size_t len) {
+    simd_kernels()->maximum_uint8(out, a, b, len);
+}
+
+static inline void simd_minimum_int8(int8_t* out, const int8_t* a,
+                                     const int8_t* b, size_t len) {
+    simd_kernels()->minimum_int8(out, a, b, len);
+}
+
+static inline void simd_maximum_int8(int8_t* out, const int8_t* a,
+                                     const int8_t* b, size_t len) {
+    simd_kernels()->maximum_int8(out, a, b, len);
+}
+
+static inline void simd_minimum_uint16(uint16_t* out, const uint16_t* a,
+                                       const uint16_t* b, size_t len) {
+    simd_kernels()->minimum_uint16(out, a, b, len);
+}
+
+static inline void simd_maximum_uint16(uint16_t* out, const uint16_t* a,
+                                       const uint16_t* b, size_t len) {
+    simd_kernels()->maximum_uint16(out, a, b, len);
+}
+
+static inline void simd_minimum_int16(int16_t* out, const int16_t* a,
+                                      const int16_t* b, size_t len) {
+    simd_kernels()->minimum_int16(out, a, b, len);
+}
+
+static inline void simd_maximum_int16(int16_t* out, const int16_t* a,
+                                      const int16_t* b, size_t len) {
+    simd_kernels()->maximum_int16(out, a, b, len);
+}
+
+static inline void simd_minimum_uint32(uint32_t* out, const uint32_t* a,
+                                       const uint32_t* b, size_t len) {
+    simd_kernels()->minimum_uint32(out, a, b, len);
+}
+
+static inline void simd_maximum_uint32(uint32_t* out, const uint32_t* a,
+                                       const uint32_t* b, size_t len) {
+    simd_kernels()->maximum_uint32(out, a, b, len);
+}
+
+static inline void simd_minimum_int32(int32_t* out, const int32_t* a,
+                                      const int32_t* b, size_t len) {
+    simd_kernels()->minimum_int32(out, a, b, len);
+}
+
+static inline void simd_maximum_int32(int32_t* out, const int32_t* a,
+                                      const int32_t* b, size_t len) {
+    simd_kernels()->maximum_int32(out, a, b, len);
+}
+
+static inline void simd_minimum_uint64(uint64_t* out, const uint64_t* a,
+                                       const uint64_t* b, size_t len) {
+    simd_kernels()->minimum_uint64(out, a, b, len);
+}
+
+static inline void simd_maximum_uint64(uint64_t* out, const uint64_t* a,
+                                       const uint64_t* b, size_t len) {
+    simd_kernels()->maximum_uint64(out, a, b, len);
+}
+
+static inline void simd_minimum_int64(int64_t* out, const int64_t* a,
+                                      const int64_t* b, size_t len) {
+    simd_kernels()->minimum_int64(out, a, b, len);
+}
+
+static inline void simd_maximum_int64(int64_t* out, const int64_t* a,
+                                      const int64_t* b, size_t len) {
+    simd_kernels()->maximum_int64(out, a, b, len);
+}
+
+static inline float simd_scan_float(float* out, const float* a, size_t len,
+                                    float carry, bool exclusive) {
+    return simd_kernels()->scan_float(out, a, len, carry, exclusive);
+}
+
+static inline double simd_scan_double(double* out, const double* a, size_t len,
+                                      double carry, bool exclusive) {
+    return simd_kernels()->scan_double(out, a, len, carry, exclusive);
+}
+
+static inline uint8_t simd_scan_uint8(uint8_t* out, const uint8_t* a, size_t len,
+                                      uint8_t carry, bool exclusive) {
+    return simd_kernels()->scan_uint8(out, a, len, carry, exclusive);
+}
+
+static inline uint16_t simd_scan_uint16(uint16_t* out, const uint16_t* a, size_t len,
+                                        uint16_t carry, bool exclusive) {
+    return simd_kernels()->scan_uint16(out, a, len, carry, exclusive);
+}
+
+static inline uint32_t simd_scan_uint32(uint32_t* out, const uint32_t* a, size_t len,
+                                        uint32_t carry, bool exclusive) {
+    return simd_kernels()->scan_uint32(out, a, len, carry, exclusive);
+}
+
+static inline uint64_t simd_scan_uint64(uint64_t* out, const uint64_t* a, size_t len,
+                                        uint64_t carry, bool exclusive) {
+    return simd_kernels()->scan_uint64(out, a, len, carry, exclusive);
+}
+
+static inline void simd_axpy_float(float* y, const float* x, float alpha,
+                                   size_t len) {
+    simd_kernels()->axpy_float(y, x, alpha, len);
+}
+
+static inline void simd_gemm4_float(float* c, size_t ldc, const float* a,
+                                    size_t lda, const float* b, size_t ldb,
+                                    size_t k, size_t n) {
+    simd_kernels()->gemm4_float(c, ldc, a, lda, b, ldb, k, n);
+}
+
+static inline float simd_spdot_float(const float* val, const size_t* idx,
+                                     const float* x, size_t len) {
+    return simd_kernels()->spdot_float(val, idx, x, len);
+}
+
+static inline void simd_axpy_double(double* y, const double* x, double alpha,
+                                    size_t len) {
+    simd_kernels()->axpy_double(y, x, alpha, len);
+}
+
+static inline void simd_gemm4_double(double* c, size_t ldc, const double* a,
+                                     size_t lda, const double* b, size_t ldb,
+                                     size_t k, size_t n) {
+    simd_kernels()->gemm4_double(c, ldc, a, lda, b, ldb, k, n);
+}
+
+static inline double simd_spdot_double(const double* val, const size_t* idx,
+                                       const double* x, size_t len) {
+    return simd_kernels()->spdot_double(val, idx, x, len);
+}
+
+static inline void simd_transpose_float(float* dst, size_t ldd, const float* src,
+                                        size_t lds, size_t rows, size_t cols) {
+    simd_kernels()->transpose_float(dst, ldd, src, lds, rows, cols);
+}
+
+static inline void simd_transpose_double(double* dst, size_t ldd, const double* src,
+                                         size_t lds, size_t rows, size_t cols) {
+    simd_kernels()->transpose_double(dst, ldd, src, lds, rows, cols);
+}
+
+static inline void simd_transpose_stream_float(float* dst, size_t ldd,
+                                               const float* src, size_t lds,
+                                               size_t cols) {
+    simd_kernels()->transpose_stream_float(dst, ldd, src, lds, cols);
+}
+
+static inline void simd_transpose_stream_double(double* dst, size_t ldd,
+                                                const double* src, size_t lds,
+                                                size_t cols) {
+    simd_kernels()->transpose_stream_double(dst, ldd, src, lds, cols);
+}
+
+static inline void simd_bsr_float(float* y, const float* val, const size_t* col,
+                                  const float* x, size_t nb, size_t rows,
+                                  size_t br, size_t bc) {
+    simd_kernels()->bsr_float(y, val, col, x, nb, rows, br, bc);
+}
+
+static inline void simd_sell_float(float* y, const float* val, const size_t* idx,
+                                   const float* x, size_t chunk, size_t width) {
+    simd_kernels()->sell_float(y, val, idx, x, chunk, width);
+}
+
+static inline void simd_bsr_double(double* y, const double* val, const size_t* col,
+                                   const double* x, size_t nb, size_t rows,
+                                   size_t br, size_t bc) {
+    simd_kernels()->bsr_double(y, val, col, x, nb, rows, br, bc);
+}
+
+static inline void simd_sell_double(double* y, const double* val, const size_t* idx,
+                                    const double* x, size_t chunk, size_t width) {
+    simd_kernels()->sell_double(y, val, idx, x, chunk, width);
+}
+
+#endif /* !SIMD_KERNEL_TABLE */
+// ================================================================================
+// ================================================================================
+#endif /* CSALT_SIMD_DISPATCH_H */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,341 @@
+// ================================================================================
+// ================================================================================
+// - File:    simd_kernels.c
+// - Purpose: Builds one simd_kernels_t from the simd_<isa>_<type>.inl files
+//            selected by the compiler flags of this translation unit.
+//
+//            Dispatch builds compile this file once per x86-64 tier
+//            (sse2, ssse3, sse41, avx, avx2, avx512) with that tier's -m
+//            flags and -DSIMD_KERNEL_TABLE=simd_kernels_<tier>.  Every
+//            kernel in a tier therefore lives in its own object and only
+//            runs after c_simd.c has confirmed host support.  Non-dispatch
+//            builds compile it once as simd_kernels_native.
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 16, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2026, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef SIMD_KERNEL_TABLE
+#  define SIMD_KERNEL_TABLE simd_kernels_native
+#endif
+
+#include "simd_dispatch.h"
+#include "c_error.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+#  define SIMD_KERNEL_ISA SIMD_AVX512
+#  include <immintrin.h>
+#  include "simd_avx512_float.inl"
+#  include "simd_avx512_double.inl"
+#  include "simd_avx512_int8.inl"
+#  include "simd_avx512_uint8.inl"
+#  include "simd_avx512_int16.inl"
+#  include "simd_avx512_uint16.inl"
+#  include "simd_avx512_int32.inl"
+#  include "simd_avx512_uint32.inl"
+#  include "simd_avx512_int64.inl"
+#  include "simd_avx512_uint64.inl"
+#  include "simd_avx512_char.inl"
+#elif defined(__AVX2__)
+#  define SIMD_KERNEL_ISA SIMD_AVX2
+#  include <immintrin.h>
+#  include "simd_avx2_float.inl"
+#  include "simd_avx2_double.inl"
+#  include "simd_avx2_int8.inl"
+#  include "simd_avx2_uint8.inl"
+#  include "simd_avx2_int16.inl"
+#  include "simd_avx2_uint16.inl"
+#  include "simd_avx2_int32.inl"
+#  include "simd_avx2_uint32.inl"
+#  include "simd_avx2_int64.inl"
+#  include "simd_avx2_uint64.inl"
+#  include "simd_avx2_char.inl"
+#elif defined(__AVX__)
+#  define SIMD_KERNEL_ISA SIMD_AVX
+#  include <immintrin.h>
+#  include "simd_avx_float.inl"
+#  include "simd_avx_double.inl"
+#  include "simd_avx_int8.inl"
+#  include "simd_avx_uint8.inl"
+#  include "simd_avx_int16.inl"
+#  include "simd_avx_uint16.inl"
+#  include "simd_avx_int32.inl"
+#  include "simd_avx_uint32.inl"
+#  include "simd_avx_int64.inl"
+#  include "simd_avx_uint64.inl"
+#  include "simd_avx_char.inl"
+#elif defined(__SSE4_1__)
+#  define SIMD_KERNEL_ISA SIMD_SSE41
+#  include <immintrin.h>
+#  include "simd_sse41_float.inl"
+#  include "simd_sse41_double.inl"
+#  include "simd_sse41_int8.inl"
+#  include "simd_sse41_uint8.inl"
+#  include "simd_sse41_int16.inl"
+#  include "simd_sse41_uint16.inl"
+#  include "simd_sse41_int32.inl"
+#  include "simd_sse41_uint32.inl"
+#  include "simd_sse41_int64.inl"
+#  include "simd_sse41_uint64.inl"
+#  include "simd_sse41_char.inl"
+#elif defined(__SSSE3__)
+#  define SIMD_KERNEL_ISA SIMD_SSSE3
+#  include <immintrin.h>
+#  include "simd_sse3_float.inl"
+#  include "simd_sse3_double.inl"
+#  include "simd_sse3_int8.inl"
+#  include "simd_sse3_uint8.inl"
+#  include "simd_sse3_int16.inl"
+#  include "simd_sse3_uint16.inl"
+#  include "simd_sse3_int32.inl"
+#  include "simd_sse3_uint32.inl"
+#  include "simd_sse3_int64.inl"
+#  include "simd_sse3_uint64.inl"
+#  include "simd_sse3_char.inl"
+#elif defined(__SSE2__)
+#  define SIMD_KERNEL_ISA SIMD_SSE2
+#  include <immintrin.h>
+#  include "simd_sse2_float.inl"
+#  include "simd_sse2_double.inl"
+#  include "simd_sse2_int8.inl"
+#  include "simd_sse2_uint8.inl"
+#  include "simd_sse2_int16.inl"
+#  include "simd_sse2_uint16.inl"
+#  include "simd_sse2_int32.inl"
+#  include "simd_sse2_uint32.inl"
+#  include "simd_sse2_int64.inl"
+#  include "simd_sse2_uint64.inl"
+#  include "simd_sse2_char.inl"
+#elif defined(__ARM_FEATURE_SVE2)
+#  define SIMD_KERNEL_ISA SIMD_SVE2
+#  include <arm_sve.h>
+#  include "simd_sve2_float.inl"
+#  include "simd_sve2_double.inl"
+#  include "simd_sve2_int8.inl"
+#  include "simd_sve2_uint8.inl"
+#  include "simd_sve2_int16.inl"
+#  include "simd_sve2_uint16.inl"
+#  include "simd_sve2_int32.inl"
+#  include "simd_sve2_uint32.inl"
+#  include "simd_sve2_int64.inl"
+#  include "simd_sve2_uint64.inl"
+#  include "simd_sve2_char.inl"
+#elif defined(__ARM_FEATURE_SVE)
+#  define SIMD_KERNEL_ISA SIMD_SVE
+#  include <arm_sve.h>
+#  include "simd_sve_float.inl"
+#  include "simd_sve_double.inl"
+#  include "simd_sve_int8.inl"
+#  include "simd_sve_uint8.inl"
+#  include "simd_sve_int16.inl"
+#  include "simd_sve_uint16.inl"
+#  include "simd_sve_int32.inl"
+#  include "simd_sve_uint32.inl"
+#  include "simd_sve_int64.inl"
+#  include "simd_sve_uint64.inl"
+#  include "simd_sve_char.inl"
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#  define SIMD_KERNEL_ISA SIMD_NEON
+#  include <arm_neon.h>
+#  include "simd_neon_float.inl"
+#  include "simd_neon_double.inl"
+#  include "simd_neon_int8.inl"
+#  include "simd_neon_uint8.inl"
+#  include "simd_neon_int16.inl"
+#  include "simd_neon_uint16.inl"
+#  include "simd_neon_int32.inl"
+#  include "simd_neon_uint32.inl"
+#  include "simd_neon_int64.inl"
+#  include "simd_neon_uint64.inl"
+#  include "simd_neon_char.inl"
+#else
+#  define SIMD_KERNEL_ISA SIMD_SCALAR
+#  include "simd_scalar_float.inl"
+#  include "simd_scalar_double.inl"
+#  include "simd_scalar_int8.inl"
+#  include "simd_scalar_uint8.inl"
+#  include "simd_scalar_int16.inl"
+#  include "simd_scalar_uint16.inl"
+#  include "simd_scalar_int32.inl"
+#  include "simd_scalar_uint32.inl"
+#  include "simd_scalar_int64.inl"
+#  include "simd_scalar_uint64.inl"
+#  include "simd_scalar_char.inl"
+#endif
+// ================================================================================
+// ================================================================================
+
+const simd_kernels_t SIMD_KERNEL_TABLE = {
+    .isa            = SIMD_KERNEL_ISA,
+
+    .lsearch_float  = simd_lsearch_float,
+    .floats_equal   = simd_floats_equal,
+    .min_float      = simd_min_float,
+
+    .lsearch_double = simd_lsearch_double,
+    .doubles_equal  = simd_doubles_equal,
+    .min_double     = simd_min_double,
+
+    .min_int8       = simd_min_int8,
+    .min_uint8      = simd_min_uint8,
+    .reverse_uint8  = simd_reverse_uint8,
+
+    .lsearch_uint16 = simd_lsearch_uint16,
+    .min_int16      = simd_min_int16,
+    .min_uint16     = simd_min_uint16,
+
+    .lsearch_uint32 = simd_lsearch_uint32,
+    .min_int32      = simd_min_int32,
+    .min_uint32     = simd_min_uint32,
+
+    .lsearch_uint64 = simd_lsearch_uint64,
+    .min_int64      = simd_min_int64,
+    .min_uint64     = simd_min_uint64,
+
+    .first_diff_u8  = simd_first_diff_u8,
+    .find_substr_u8 = simd_find_substr_u8,
+    .token_count_u8 = simd_token_count_u8,
+    .ascii_upper_u8 = simd_ascii_upper_u8,
+    .ascii_lower_u8 = simd_ascii_lower_u8,
+
+    .add_float     = simd_add_float,
+    .sub_float     = simd_sub_float,
+    .mul_float     = simd_mul_float,
+    .div_float     = simd_div_float,
+    .muladd_float  = simd_muladd_float,
+    .clamp_float   = simd_clamp_float,
+    .abs_float     = simd_abs_float,
+
+    .add_double    = simd_add_double,
+    .sub_double    = simd_sub_double,
+    .mul_double    = simd_mul_double,
+    .div_double    = simd_div_double,
+    .muladd_double = simd_muladd_double,
+    .clamp_double  = simd_clamp_double,
+    .abs_double    = simd_abs_double,
+
+    .add_uint8     = simd_add_uint8,
+    .sub_uint8     = simd_sub_uint8,
+    .mul_uint8     = simd_mul_uint8,
+    .muladd_uint8  = simd_muladd_uint8,
+    .clamp_uint8   = simd_clamp_uint8,
+    .clamp_int8    = simd_clamp_int8,
+    .abs_int8      = simd_abs_int8,
+
+    .add_uint16    = simd_add_uint16,
+    .sub_uint16    = simd_sub_uint16,
+    .mul_uint16    = simd_mul_uint16,
+    .muladd_uint16 = simd_muladd_uint16,
+    .clamp_uint16  = simd_clamp_uint16,
+    .clamp_int16   = simd_clamp_int16,
+    .abs_int16     = simd_abs_int16,
+
+    .add_uint32    = simd_add_uint32,
+    .sub_uint32    = simd_sub_uint32,
+    .mul_uint32    = simd_mul_uint32,
+    .muladd_uint32 = simd_muladd_uint32,
+    .clamp_uint32  = simd_clamp_uint32,
+    .clamp_int32   = simd_clamp_int32,
+    .abs_int32     = simd_abs_int32,
+
+    .add_uint64    = simd_add_uint64,
+    .sub_uint64    = simd_sub_uint64,
+    .mul_uint64    = simd_mul_uint64,
+    .muladd_uint64 = simd_muladd_uint64,
+    .clamp_uint64  = simd_clamp_uint64,
+    .clamp_int64   = simd_clamp_int64,
+    .abs_int64     = simd_abs_int64,
+
+    .max_float  = simd_max_float,
+    .sum_float  = simd_sum_float,
+    .asum_float = simd_asum_float,
+    .dot_float  = simd_dot_float,
+
+    .max_double  = simd_max_double,
+    .sum_double  = simd_sum_double,
+    .asum_double = simd_asum_double,
+    .dot_double  = simd_dot_double,
+
+    .max_uint8 = simd_max_uint8,
+    .sum_uint8 = simd_sum_uint8,
+    .max_int8  = simd_max_int8,
+    .sum_int8  = simd_sum_int8,
+
+    .max_uint16 = simd_max_uint16,
+    .sum_uint16 = simd_sum_uint16,
+    .max_int16  = simd_max_int16,
+    .sum_int16  = simd_sum_int16,
+
+    .max_uint32 = simd_max_uint32,
+    .sum_uint32 = simd_sum_uint32,
+    .max_int32  = simd_max_int32,
+    .sum_int32  = simd_sum_int32,
+
+    .max_uint64 = simd_max_uint64,
+    .max_int64  = simd_max_int64,
+
+    .minimum_float = simd_minimum_float,
+    .maximum_float = simd_maximum_float,
+
+    .minimum_double = simd_minimum_double,
+    .maximum_double = simd_maximum_double,
+
+    .minimum_uint8 = simd_minimum_uint8,
+    .maximum_uint8 = simd_maximum_uint8,
+    .minimum_int8  = simd_minimum_int8,
+    .maximum_int8  = simd_maximum_int8,
+
+    .minimum_uint16 = simd_minimum_uint16,
+    .maximum_uint16 = simd_maximum_uint16,
+    .minimum_int16  = simd_minimum_int16,
+    .maximum_int16  = simd_maximum_int16,
+
+    .minimum_uint32 = simd_minimum_uint32,
+    .maximum_uint32 = simd_maximum_uint32,
+    .minimum_int32  = simd_minimum_int32,
+    .maximum_int32  = simd_maximum_int32,
+
+    .minimum_uint64 = simd_minimum_uint64,
+    .maximum_uint64 = simd_maximum_uint64,
+    .minimum_int64  = simd_minimum_int64,
+    .maximum_int64  = simd_maximum_int64,
+
+    .scan_float  = simd_scan_float,
+    .scan_double = simd_scan_double,
+    .scan_uint8  = simd_scan_uint8,
+    .scan_uint16 = simd_scan_uint16,
+    .scan_uint32 = simd_scan_uint32,
+    .scan_uint64 = simd_scan_uint64,
+
+    .axpy_float   = simd_axpy_float,
+    .gemm4_float  = simd_gemm4_float,
+    .spdot_float  = simd_spdot_float,
+    .axpy_double  = simd_axpy_double,
+    .gemm4_double = simd_gemm4_double,
+    .spdot_double = simd_spdot_double,
+
+    .transpose_float         = simd_transpose_float,
+    .transpose_double        = simd_transpose_double,
+    .transpose_stream_float  = simd_transpose_stream_float,
+    .transpose_stream_double = simd_transpose_stream_double,
+
+    .bsr_float   = simd_bsr_float,
+    .sell_float  = simd_sell_float,
+    .bsr_double  = simd_bsr_double,
+    .sell_double = simd_sell_double,
+};
+// ================================================================================
+// ================================================================================
+// eof
@@ -131,5 +131,505 @@ static inline error_code_t simd_min_double(const double* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        float64x2_t x = vld1q_f64(a + i);
+        float64x2_t y = vld1q_f64(b + i);
+        vst1q_f64(out + i, vaddq_f64(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        float64x2_t x = vld1q_f64(a + i);
+        float64x2_t y = vld1q_f64(b + i);
+        vst1q_f64(out + i, vsubq_f64(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        float64x2_t x = vld1q_f64(a + i);
+        float64x2_t y = vld1q_f64(b + i);
+        vst1q_f64(out + i, vmulq_f64(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_div_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        float64x2_t x = vld1q_f64(a + i);
+        float64x2_t y = vld1q_f64(b + i);
+        vst1q_f64(out + i, vdivq_f64(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] / b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_double(double*       out,
+                               const double* a,
+                               double        mul,
+                               double        add,
+                               size_t        len) {
+    float64x2_t const vmul = vdupq_n_f64(mul);
+    float64x2_t const vadd = vdupq_n_f64(add);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        float64x2_t x = vld1q_f64(a + i);
+        vst1q_f64(out + i, vaddq_f64(vmulq_f64(x, vmul), vadd));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_double(double*       out,
+                              const double* a,
+                              double        lo,
+                              double        hi,
+                              size_t        len) {
+    /* vminq/vmaxq propagate NaN, matching the scalar path */
+    float64x2_t const vlo = vdupq_n_f64(lo);
+    float64x2_t const vhi = vdupq_n_f64(hi);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        float64x2_t x = vld1q_f64(a + i);
+        vst1q_f64(out + i, vmaxq_f64(vlo, vminq_f64(vhi, x)));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_double(double*       out,
+                            const double* a,
+                            size_t        len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        float64x2_t x = vld1q_f64(a + i);
+        vst1q_f64(out + i, vabsq_f64(x));
+    }
+    for (; i < len; i++)
+        out[i] = fabs(a[i]);
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_double(const double* data,
+                                    size_t        len,
+                                    double*       out) {
+    double cur = *out;   /* caller seeds with -INFINITY */
+    size_t i   = 0u;
+
+    float64x2_t vmax = vdupq_n_f64(cur);
+    /* vmaxq returns NaN when either operand is NaN */
+    for (; i + 2u <= len; i += 2u)
+        vmax = vmaxq_f64(vmax, vld1q_f64(data + i));
+
+    double lanes[2];
+    vst1q_f64(lanes, vmax);
+    for (size_t k = 0u; k < 2u; k++) {
+        if (isnan(lanes[k])) { *out = NAN; return NO_ERROR; }
+        if (lanes[k] > cur) cur = lanes[k];
+    }
+    for (; i < len; i++) {
+        if (isnan(data[i])) { *out = NAN; return NO_ERROR; }
+        if (data[i] > cur) cur = data[i];
+    }
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static double simd_sum_double(const double* data,
+                              size_t        len) {
+    float64x2_t acc0 = vdupq_n_f64(0.0);
+    float64x2_t acc1 = vdupq_n_f64(0.0);
+    size_t      i    = 0u;
+
+    for (; i + 4u <= len; i += 4u) {
+        acc0 = vaddq_f64(acc0, vld1q_f64(data + i));
+        acc1 = vaddq_f64(acc1, vld1q_f64(data + i + 2u));
+    }
+    acc0 = vaddq_f64(acc0, acc1);
+    if (i + 2u <= len) {
+        acc0 = vaddq_f64(acc0, vld1q_f64(data + i));
+        i   += 2u;
+    }
+
+    double lanes[2];
+    vst1q_f64(lanes, acc0);
+    double sum = 0.0;
+    for (size_t k = 0u; k < 2u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static double simd_asum_double(const double* data,
+                               size_t        len) {
+    float64x2_t acc0 = vdupq_n_f64(0.0);
+    float64x2_t acc1 = vdupq_n_f64(0.0);
+    size_t      i    = 0u;
+
+    for (; i + 4u <= len; i += 4u) {
+        acc0 = vaddq_f64(acc0, vabsq_f64(vld1q_f64(data + i)));
+        acc1 = vaddq_f64(acc1, vabsq_f64(vld1q_f64(data + i + 2u)));
+    }
+    acc0 = vaddq_f64(acc0, acc1);
+    if (i + 2u <= len) {
+        acc0 = vaddq_f64(acc0, vabsq_f64(vld1q_f64(data + i)));
+        i   += 2u;
+    }
+
+    double lanes[2];
+    vst1q_f64(lanes, acc0);
+    double sum = 0.0;
+    for (size_t k = 0u; k < 2u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += fabs(data[i]);
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static double simd_dot_double(const double* a,
+                              const double* b,
+                              size_t        len) {
+    float64x2_t acc0 = vdupq_n_f64(0.0);
+    float64x2_t acc1 = vdupq_n_f64(0.0);
+    size_t      i    = 0u;
+
+    for (; i + 4u <= len; i += 4u) {
+        acc0 = vaddq_f64(acc0, vmulq_f64(vld1q_f64(a + i), vld1q_f64(b + i)));
+        acc1 = vaddq_f64(acc1, vmulq_f64(vld1q_f64(a + i + 2u), vld1q_f64(b + i + 2u)));
+    }
+    acc0 = vaddq_f64(acc0, acc1);
+    if (i + 2u <= len) {
+        acc0 = vaddq_f64(acc0, vmulq_f64(vld1q_f64(a + i), vld1q_f64(b + i)));
+        i   += 2u;
+    }
+
+    double lanes[2];
+    vst1q_f64(lanes, acc0);
+    double sum = 0.0;
+    for (size_t k = 0u; k < 2u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_double(double*       out,
+                                const double* a,
+                                const double* b,
+                                size_t        len) {
+    /* vminq propagates NaN from either operand */
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        float64x2_t x = vld1q_f64(a + i);
+        float64x2_t y = vld1q_f64(b + i);
+        vst1q_f64(out + i, vminq_f64(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_double(double*       out,
+                                const double* a,
+                                const double* b,
+                                size_t        len) {
+    /* vmaxq propagates NaN from either operand */
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        float64x2_t x = vld1q_f64(a + i);
+        float64x2_t y = vld1q_f64(b + i);
+        vst1q_f64(out + i, vmaxq_f64(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static double simd_scan_double(double*       out,
+                               const double* a,
+                               size_t        len,
+                               double        carry,
+                               bool          exclusive) {
+    /* Log-step scan in registers: after the shifted adds lane k of p holds
+     * x[0] + ... + x[k].  cv carries the running total in every lane */
+    float64x2_t const z = vdupq_n_f64(0);
+    float64x2_t cv = vdupq_n_f64(carry);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        float64x2_t x = vld1q_f64(a + i);
+        float64x2_t p = vaddq_f64(x, vextq_f64(z, x, 1));
+        float64x2_t const r = vaddq_f64(p, cv);
+        float64x2_t const y = exclusive ? vaddq_f64(vextq_f64(z, p, 1), cv) : r;
+        vst1q_f64(out + i, y);
+        cv = vdupq_laneq_f64(r, 1);
+    }
+    carry = vgetq_lane_f64(cv, 0);
+    for (; i < len; i++) {
+        double const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
+// MATRIX KERNELS
+
+/* y[i] += alpha * x[i] */
+static void simd_axpy_double(double*       y,
+                             const double* x,
+                             double        alpha,
+                             size_t        len) {
+    float64x2_t const av = vdupq_n_f64(alpha);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        vst1q_f64(y + i,      vaddq_f64(vld1q_f64(y + i), vmulq_f64(av, vld1q_f64(x + i))));
+        vst1q_f64(y + i + 2u, vaddq_f64(vld1q_f64(y + i + 2u), vmulq_f64(av, vld1q_f64(x + i + 2u))));
+    }
+    for (; i + 2u <= len; i += 2u)
+        vst1q_f64(y + i, vaddq_f64(vld1q_f64(y + i), vmulq_f64(av, vld1q_f64(x + i))));
+    for (; i < len; i++)
+        y[i] += alpha * x[i];
+}
+// --------------------------------------------------------------------------------
+
+/* C[0..4)[0..n) += A[0..4)[0..k) * B[0..k)[0..n), all row-major with leading
+ * dimensions ldc, lda and ldb.  Each 4-column strip keeps its
+ * 4 x 4 block of C in eight registers for the whole k loop */
+static void simd_gemm4_double(double*       c,
+                              size_t        ldc,
+                              const double* a,
+                              size_t        lda,
+                              const double* b,
+                              size_t        ldb,
+                              size_t        k,
+                              size_t        n) {
+    size_t j = 0u;
+    for (; j + 4u <= n; j += 4u) {
+        float64x2_t c00 = vld1q_f64(c + j), c01 = vld1q_f64(c + j + 2u);
+        float64x2_t c10 = vld1q_f64(c + ldc + j), c11 = vld1q_f64(c + ldc + j + 2u);
+        float64x2_t c20 = vld1q_f64(c + 2u * ldc + j), c21 = vld1q_f64(c + 2u * ldc + j + 2u);
+        float64x2_t c30 = vld1q_f64(c + 3u * ldc + j), c31 = vld1q_f64(c + 3u * ldc + j + 2u);
+        const double* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            float64x2_t const b0 = vld1q_f64(bp);
+            float64x2_t const b1 = vld1q_f64(bp + 2u);
+            float64x2_t av = vdupq_n_f64(a[p]);
+            c00 = vaddq_f64(c00, vmulq_f64(av, b0));
+            c01 = vaddq_f64(c01, vmulq_f64(av, b1));
+            av  = vdupq_n_f64(a[lda + p]);
+            c10 = vaddq_f64(c10, vmulq_f64(av, b0));
+            c11 = vaddq_f64(c11, vmulq_f64(av, b1));
+            av  = vdupq_n_f64(a[2u * lda + p]);
+            c20 = vaddq_f64(c20, vmulq_f64(av, b0));
+            c21 = vaddq_f64(c21, vmulq_f64(av, b1));
+            av  = vdupq_n_f64(a[3u * lda + p]);
+            c30 = vaddq_f64(c30, vmulq_f64(av, b0));
+            c31 = vaddq_f64(c31, vmulq_f64(av, b1));
+        }
+        vst1q_f64(c + j, c00); vst1q_f64(c + j + 2u, c01);
+        vst1q_f64(c + ldc + j, c10); vst1q_f64(c + ldc + j + 2u, c11);
+        vst1q_f64(c + 2u * ldc + j, c20); vst1q_f64(c + 2u * ldc + j + 2u, c21);
+        vst1q_f64(c + 3u * ldc + j, c30); vst1q_f64(c + 3u * ldc + j + 2u, c31);
+    }
+    for (; j + 2u <= n; j += 2u) {
+        float64x2_t c0 = vld1q_f64(c + j), c1 = vld1q_f64(c + ldc + j);
+        float64x2_t c2 = vld1q_f64(c + 2u * ldc + j), c3 = vld1q_f64(c + 3u * ldc + j);
+        const double* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            float64x2_t const bv = vld1q_f64(bp);
+            c0 = vaddq_f64(c0, vmulq_f64(vdupq_n_f64(a[p]), bv));
+            c1 = vaddq_f64(c1, vmulq_f64(vdupq_n_f64(a[lda + p]), bv));
+            c2 = vaddq_f64(c2, vmulq_f64(vdupq_n_f64(a[2u * lda + p]), bv));
+            c3 = vaddq_f64(c3, vmulq_f64(vdupq_n_f64(a[3u * lda + p]), bv));
+        }
+        vst1q_f64(c + j, c0); vst1q_f64(c + ldc + j, c1);
+        vst1q_f64(c + 2u * ldc + j, c2); vst1q_f64(c + 3u * ldc + j, c3);
+    }
+    for (; j < n; j++) {
+        double s0 = c[j], s1 = c[ldc + j], s2 = c[2u * ldc + j], s3 = c[3u * ldc + j];
+        const double* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            s0 += a[p]            * *bp;
+            s1 += a[lda + p]      * *bp;
+            s2 += a[2u * lda + p] * *bp;
+            s3 += a[3u * lda + p] * *bp;
+        }
+        c[j] = s0; c[ldc + j] = s1; c[2u * ldc + j] = s2; c[3u * ldc + j] = s3;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* sum of val[i] * x[idx[i]]: the sparse row (or column) dot product.
+ * This tier has no gather instruction, so the x operands are assembled
+ * lane by lane */
+static double simd_spdot_double(const double* val,
+                                const size_t* idx,
+                                const double* x,
+                                size_t        len) {
+    float64x2_t acc0 = vdupq_n_f64(0.0);
+    float64x2_t acc1 = vdupq_n_f64(0.0);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        double g[4];
+        for (size_t w = 0u; w < 4u; w++) g[w] = x[idx[i + w]];
+        acc0 = vaddq_f64(acc0, vmulq_f64(vld1q_f64(val + i),      vld1q_f64(g)));
+        acc1 = vaddq_f64(acc1, vmulq_f64(vld1q_f64(val + i + 2u), vld1q_f64(g + 2u)));
+    }
+    acc0 = vaddq_f64(acc0, acc1);
+
+    double lanes[2];
+    vst1q_f64(lanes, acc0);
+    double sum = 0.0;
+    for (size_t w = 0u; w < 2u; w++) sum += lanes[w];
+    for (; i < len; i++)
+        sum += val[i] * x[idx[i]];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+/* dst[j * ldd + i] = src[i * lds + j] for i < rows, j < cols: one cache
+ * tile of a matrix transpose.  2 x 2 blocks are transposed in registers with
+ * vtrn1q / vtrn2q. */
+static void simd_transpose_double(double*       dst,
+                                  size_t        ldd,
+                                  const double* src,
+                                  size_t        lds,
+                                  size_t        rows,
+                                  size_t        cols) {
+    size_t i = 0u;
+    for (; i + 2u <= rows; i += 2u) {
+        size_t j = 0u;
+        for (; j + 2u <= cols; j += 2u) {
+            const double* s = src + i * lds + j;
+            double*       d = dst + j * ldd + i;
+            float64x2_t const r0 = vld1q_f64(s);
+            float64x2_t const r1 = vld1q_f64(s + lds);
+            vst1q_f64(d,       vtrn1q_f64(r0, r1));
+            vst1q_f64(d + ldd, vtrn2q_f64(r0, r1));
+        }
+        for (; j < cols; j++)
+            for (size_t q = 0u; q < 2u; q++)
+                dst[j * ldd + i + q] = src[(i + q) * lds + j];
+    }
+    for (; i < rows; i++)
+        for (size_t j = 0u; j < cols; j++)
+            dst[j * ldd + i] = src[i * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* The same transpose for one band of 8 source rows, so each destination
+ * row receives one full 64-byte line at a time.  Advanced SIMD has no streaming
+ * store worth using here, so this is the plain tile transpose over the band. */
+static void simd_transpose_stream_double(double*       dst,
+                                         size_t        ldd,
+                                         const double* src,
+                                         size_t        lds,
+                                         size_t        cols) {
+    simd_transpose_double(dst, ldd, src, lds, 8u, cols);
+}
+// --------------------------------------------------------------------------------
+
+/* y[r] += sum over blocks b < nb of row r of block b dotted with
+ * x + col[b] * bc, for r < rows: one block row of a BSR SpMV.  Blocks are
+ * br x bc, row-major and packed back to back.  Block rows are dotted 2
+ * lanes at a time with one horizontal sum per output row. */
+static void simd_bsr_double(double*       y,
+                            const double* val,
+                            const size_t* col,
+                            const double* x,
+                            size_t        nb,
+                            size_t        rows,
+                            size_t        br,
+                            size_t        bc) {
+    for (size_t r = 0u; r < rows; r++) {
+        float64x2_t acc0 = vdupq_n_f64(0.0);
+        double s = 0.0;
+        for (size_t b = 0u; b < nb; b++) {
+            const double* a  = val + (b * br + r) * bc;
+            const double* xb = x + col[b] * bc;
+            size_t k = 0u;
+            for (; k + 2u <= bc; k += 2u)
+                acc0 = vaddq_f64(acc0, vmulq_f64(vld1q_f64(a + k), vld1q_f64(xb + k)));
+            for (; k < bc; k++) s += a[k] * xb[k];
+        }
+        double lanes[2];
+        vst1q_f64(lanes, acc0);
+        for (size_t w = 0u; w < 2u; w++) s += lanes[w];
+        y[r] += s;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* y[i] = sum over j < width of val[j * chunk + i] * x[idx[j * chunk + i]]
+ * for i < chunk: one slice of a SELL-C-sigma SpMV.  The slice is stored
+ * column by column, so consecutive lanes hold consecutive rows.  2 rows
+ * per register; x is gathered with scalar loads, since NEON has no gather. */
+static void simd_sell_double(double*       y,
+                             const double* val,
+                             const size_t* idx,
+                             const double* x,
+                             size_t        chunk,
+                             size_t        width) {
+    size_t i = 0u;
+    for (; i + 2u <= chunk; i += 2u) {
+        float64x2_t acc = vdupq_n_f64(0.0);
+        for (size_t j = 0u; j < width; j++) {
+            const double* v = val + j * chunk + i;
+            const size_t* c = idx + j * chunk + i;
+            double g[2];
+            for (size_t w = 0u; w < 2u; w++) g[w] = x[c[w]];
+            acc = vaddq_f64(acc, vmulq_f64(vld1q_f64(v), vld1q_f64(g)));
+        }
+        vst1q_f64(y + i, acc);
+    }
+    for (; i < chunk; i++) {
+        double s = 0.0;
+        for (size_t j = 0u; j < width; j++)
+            s += val[j * chunk + i] * x[idx[j * chunk + i]];
+        y[i] = s;
+    }
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_NEON_DOUBLE_INL */
 
@@ -169,5 +169,508 @@ static inline error_code_t simd_min_float(const float* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        float32x4_t x = vld1q_f32(a + i);
+        float32x4_t y = vld1q_f32(b + i);
+        vst1q_f32(out + i, vaddq_f32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        float32x4_t x = vld1q_f32(a + i);
+        float32x4_t y = vld1q_f32(b + i);
+        vst1q_f32(out + i, vsubq_f32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        float32x4_t x = vld1q_f32(a + i);
+        float32x4_t y = vld1q_f32(b + i);
+        vst1q_f32(out + i, vmulq_f32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_div_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        float32x4_t x = vld1q_f32(a + i);
+        float32x4_t y = vld1q_f32(b + i);
+        vst1q_f32(out + i, vdivq_f32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] / b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_float(float*       out,
+                              const float* a,
+                              float        mul,
+                              float        add,
+                              size_t       len) {
+    float32x4_t const vmul = vdupq_n_f32(mul);
+    float32x4_t const vadd = vdupq_n_f32(add);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        float32x4_t x = vld1q_f32(a + i);
+        vst1q_f32(out + i, vaddq_f32(vmulq_f32(x, vmul), vadd));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_float(float*       out,
+                             const float* a,
+                             float        lo,
+                             float        hi,
+                             size_t       len) {
+    /* vminq/vmaxq propagate NaN, matching the scalar path */
+    float32x4_t const vlo = vdupq_n_f32(lo);
+    float32x4_t const vhi = vdupq_n_f32(hi);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        float32x4_t x = vld1q_f32(a + i);
+        vst1q_f32(out + i, vmaxq_f32(vlo, vminq_f32(vhi, x)));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_float(float*       out,
+                           const float* a,
+                           size_t       len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        float32x4_t x = vld1q_f32(a + i);
+        vst1q_f32(out + i, vabsq_f32(x));
+    }
+    for (; i < len; i++)
+        out[i] = fabsf(a[i]);
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_float(const float* data,
+                                   size_t       len,
+                                   float*       out) {
+    float  cur = *out;   /* caller seeds with -INFINITY */
+    size_t i   = 0u;
+
+    float32x4_t vmax = vdupq_n_f32(cur);
+    /* vmaxq returns NaN when either operand is NaN */
+    for (; i + 4u <= len; i += 4u)
+        vmax = vmaxq_f32(vmax, vld1q_f32(data + i));
+
+    float lanes[4];
+    vst1q_f32(lanes, vmax);
+    for (size_t k = 0u; k < 4u; k++) {
+        if (isnan(lanes[k])) { *out = NAN; return NO_ERROR; }
+        if (lanes[k] > cur) cur = lanes[k];
+    }
+    for (; i < len; i++) {
+        if (isnan(data[i])) { *out = NAN; return NO_ERROR; }
+        if (data[i] > cur) cur = data[i];
+    }
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static float simd_sum_float(const float* data,
+                            size_t       len) {
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+    size_t      i    = 0u;
+
+    for (; i + 8u <= len; i += 8u) {
+        acc0 = vaddq_f32(acc0, vld1q_f32(data + i));
+        acc1 = vaddq_f32(acc1, vld1q_f32(data + i + 4u));
+    }
+    acc0 = vaddq_f32(acc0, acc1);
+    if (i + 4u <= len) {
+        acc0 = vaddq_f32(acc0, vld1q_f32(data + i));
+        i   += 4u;
+    }
+
+    float lanes[4];
+    vst1q_f32(lanes, acc0);
+    float sum = 0.0f;
+    for (size_t k = 0u; k < 4u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static float simd_asum_float(const float* data,
+                             size_t       len) {
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+    size_t      i    = 0u;
+
+    for (; i + 8u <= len; i += 8u) {
+        acc0 = vaddq_f32(acc0, vabsq_f32(vld1q_f32(data + i)));
+        acc1 = vaddq_f32(acc1, vabsq_f32(vld1q_f32(data + i + 4u)));
+    }
+    acc0 = vaddq_f32(acc0, acc1);
+    if (i + 4u <= len) {
+        acc0 = vaddq_f32(acc0, vabsq_f32(vld1q_f32(data + i)));
+        i   += 4u;
+    }
+
+    float lanes[4];
+    vst1q_f32(lanes, acc0);
+    float sum = 0.0f;
+    for (size_t k = 0u; k < 4u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += fabsf(data[i]);
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static float simd_dot_float(const float* a,
+                            const float* b,
+                            size_t       len) {
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+    size_t      i    = 0u;
+
+    for (; i + 8u <= len; i += 8u) {
+        acc0 = vaddq_f32(acc0, vmulq_f32(vld1q_f32(a + i), vld1q_f32(b + i)));
+        acc1 = vaddq_f32(acc1, vmulq_f32(vld1q_f32(a + i + 4u), vld1q_f32(b + i + 4u)));
+    }
+    acc0 = vaddq_f32(acc0, acc1);
+    if (i + 4u <= len) {
+        acc0 = vaddq_f32(acc0, vmulq_f32(vld1q_f32(a + i), vld1q_f32(b + i)));
+        i   += 4u;
+    }
+
+    float lanes[4];
+    vst1q_f32(lanes, acc0);
+    float sum = 0.0f;
+    for (size_t k = 0u; k < 4u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_float(float*       out,
+                               const float* a,
+                               const float* b,
+                               size_t       len) {
+    /* vminq propagates NaN from either operand */
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        float32x4_t x = vld1q_f32(a + i);
+        float32x4_t y = vld1q_f32(b + i);
+        vst1q_f32(out + i, vminq_f32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_float(float*       out,
+                               const float* a,
+                               const float* b,
+                               size_t       len) {
+    /* vmaxq propagates NaN from either operand */
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        float32x4_t x = vld1q_f32(a + i);
+        float32x4_t y = vld1q_f32(b + i);
+        vst1q_f32(out + i, vmaxq_f32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static float simd_scan_float(float*       out,
+                             const float* a,
+                             size_t       len,
+                             float        carry,
+                             bool         exclusive) {
+    /* Log-step scan in registers: after the shifted adds lane k of p holds
+     * x[0] + ... + x[k].  cv carries the running total in every lane */
+    float32x4_t const z = vdupq_n_f32(0);
+    float32x4_t cv = vdupq_n_f32(carry);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        float32x4_t x = vld1q_f32(a + i);
+        float32x4_t p = vaddq_f32(x, vextq_f32(z, x, 3));
+        p = vaddq_f32(p, vextq_f32(z, p, 2));
+        float32x4_t const r = vaddq_f32(p, cv);
+        float32x4_t const y = exclusive ? vaddq_f32(vextq_f32(z, p, 3), cv) : r;
+        vst1q_f32(out + i, y);
+        cv = vdupq_laneq_f32(r, 3);
+    }
+    carry = vgetq_lane_f32(cv, 0);
+    for (; i < len; i++) {
+        float const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
+// MATRIX KERNELS
+
+/* y[i] += alpha * x[i] */
+static void simd_axpy_float(float*       y,
+                            const float* x,
+                            float        alpha,
+                            size_t       len) {
+    float32x4_t const av = vdupq_n_f32(alpha);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        vst1q_f32(y + i,      vaddq_f32(vld1q_f32(y + i), vmulq_f32(av, vld1q_f32(x + i))));
+        vst1q_f32(y + i + 4u, vaddq_f32(vld1q_f32(y + i + 4u), vmulq_f32(av, vld1q_f32(x + i + 4u))));
+    }
+    for (; i + 4u <= len; i += 4u)
+        vst1q_f32(y + i, vaddq_f32(vld1q_f32(y + i), vmulq_f32(av, vld1q_f32(x + i))));
+    for (; i < len; i++)
+        y[i] += alpha * x[i];
+}
+// --------------------------------------------------------------------------------
+
+/* C[0..4)[0..n) += A[0..4)[0..k) * B[0..k)[0..n), all row-major with leading
+ * dimensions ldc, lda and ldb.  Each 8-column strip keeps its
+ * 4 x 8 block of C in eight registers for the whole k loop */
+static void simd_gemm4_float(float*       c,
+                             size_t       ldc,
+                             const float* a,
+                             size_t       lda,
+                             const float* b,
+                             size_t       ldb,
+                             size_t       k,
+                             size_t       n) {
+    size_t j = 0u;
+    for (; j + 8u <= n; j += 8u) {
+        float32x4_t c00 = vld1q_f32(c + j), c01 = vld1q_f32(c + j + 4u);
+        float32x4_t c10 = vld1q_f32(c + ldc + j), c11 = vld1q_f32(c + ldc + j + 4u);
+        float32x4_t c20 = vld1q_f32(c + 2u * ldc + j), c21 = vld1q_f32(c + 2u * ldc + j + 4u);
+        float32x4_t c30 = vld1q_f32(c + 3u * ldc + j), c31 = vld1q_f32(c + 3u * ldc + j + 4u);
+        const float* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            float32x4_t const b0 = vld1q_f32(bp);
+            float32x4_t const b1 = vld1q_f32(bp + 4u);
+            float32x4_t av = vdupq_n_f32(a[p]);
+            c00 = vaddq_f32(c00, vmulq_f32(av, b0));
+            c01 = vaddq_f32(c01, vmulq_f32(av, b1));
+            av  = vdupq_n_f32(a[lda + p]);
+            c10 = vaddq_f32(c10, vmulq_f32(av, b0));
+            c11 = vaddq_f32(c11, vmulq_f32(av, b1));
+            av  = vdupq_n_f32(a[2u * lda + p]);
+            c20 = vaddq_f32(c20, vmulq_f32(av, b0));
+            c21 = vaddq_f32(c21, vmulq_f32(av, b1));
+            av  = vdupq_n_f32(a[3u * lda + p]);
+            c30 = vaddq_f32(c30, vmulq_f32(av, b0));
+            c31 = vaddq_f32(c31, vmulq_f32(av, b1));
+        }
+        vst1q_f32(c + j, c00); vst1q_f32(c + j + 4u, c01);
+        vst1q_f32(c + ldc + j, c10); vst1q_f32(c + ldc + j + 4u, c11);
+        vst1q_f32(c + 2u * ldc + j, c20); vst1q_f32(c + 2u * ldc + j + 4u, c21);
+        vst1q_f32(c + 3u * ldc + j, c30); vst1q_f32(c + 3u * ldc + j + 4u, c31);
+    }
+    for (; j + 4u <= n; j += 4u) {
+        float32x4_t c0 = vld1q_f32(c + j), c1 = vld1q_f32(c + ldc + j);
+        float32x4_t c2 = vld1q_f32(c + 2u * ldc + j), c3 = vld1q_f32(c + 3u * ldc + j);
+        const float* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            float32x4_t const bv = vld1q_f32(bp);
+            c0 = vaddq_f32(c0, vmulq_f32(vdupq_n_f32(a[p]), bv));
+            c1 = vaddq_f32(c1, vmulq_f32(vdupq_n_f32(a[lda + p]), bv));
+            c2 = vaddq_f32(c2, vmulq_f32(vdupq_n_f32(a[2u * lda + p]), bv));
+            c3 = vaddq_f32(c3, vmulq_f32(vdupq_n_f32(a[3u * lda + p]), bv));
+        }
+        vst1q_f32(c + j, c0); vst1q_f32(c + ldc + j, c1);
+        vst1q_f32(c + 2u * ldc + j, c2); vst1q_f32(c + 3u * ldc + j, c3);
+    }
+    for (; j < n; j++) {
+        float s0 = c[j], s1 = c[ldc + j], s2 = c[2u * ldc + j], s3 = c[3u * ldc + j];
+        const float* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            s0 += a[p]            * *bp;
+            s1 += a[lda + p]      * *bp;
+            s2 += a[2u * lda + p] * *bp;
+            s3 += a[3u * lda + p] * *bp;
+        }
+        c[j] = s0; c[ldc + j] = s1; c[2u * ldc + j] = s2; c[3u * ldc + j] = s3;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* sum of val[i] * x[idx[i]]: the sparse row (or column) dot product.
+ * This tier has no gather instruction, so the x operands are assembled
+ * lane by lane */
+static float simd_spdot_float(const float*  val,
+                              const size_t* idx,
+                              const float*  x,
+                              size_t        len) {
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        float g[8];
+        for (size_t w = 0u; w < 8u; w++) g[w] = x[idx[i + w]];
+        acc0 = vaddq_f32(acc0, vmulq_f32(vld1q_f32(val + i),      vld1q_f32(g)));
+        acc1 = vaddq_f32(acc1, vmulq_f32(vld1q_f32(val + i + 4u), vld1q_f32(g + 4u)));
+    }
+    acc0 = vaddq_f32(acc0, acc1);
+
+    float lanes[4];
+    vst1q_f32(lanes, acc0);
+    float sum = 0.0f;
+    for (size_t w = 0u; w < 4u; w++) sum += lanes[w];
+    for (; i < len; i++)
+        sum += val[i] * x[idx[i]];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+/* dst[j * ldd + i] = src[i * lds + j] for i < rows, j < cols: one cache
+ * tile of a matrix transpose.  4 x 4 blocks are transposed in registers with
+ * vtrnq and half-register recombination. */
+static void simd_transpose_float(float*       dst,
+                                 size_t       ldd,
+                                 const float* src,
+                                 size_t       lds,
+                                 size_t       rows,
+                                 size_t       cols) {
+    size_t i = 0u;
+    for (; i + 4u <= rows; i += 4u) {
+        size_t j = 0u;
+        for (; j + 4u <= cols; j += 4u) {
+            const float* s = src + i * lds + j;
+            float*       d = dst + j * ldd + i;
+            float32x4x2_t const t01 = vtrnq_f32(vld1q_f32(s),            vld1q_f32(s + lds));
+            float32x4x2_t const t23 = vtrnq_f32(vld1q_f32(s + 2u * lds), vld1q_f32(s + 3u * lds));
+            vst1q_f32(d,            vcombine_f32(vget_low_f32(t01.val[0]),  vget_low_f32(t23.val[0])));
+            vst1q_f32(d + ldd,      vcombine_f32(vget_low_f32(t01.val[1]),  vget_low_f32(t23.val[1])));
+            vst1q_f32(d + 2u * ldd, vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0])));
+            vst1q_f32(d + 3u * ldd, vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1])));
+        }
+        for (; j < cols; j++)
+            for (size_t q = 0u; q < 4u; q++)
+                dst[j * ldd + i + q] = src[(i + q) * lds + j];
+    }
+    for (; i < rows; i++)
+        for (size_t j = 0u; j < cols; j++)
+            dst[j * ldd + i] = src[i * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* The same transpose for one band of 16 source rows, so each destination
+ * row receives one full 64-byte line at a time.  Advanced SIMD has no streaming
+ * store worth using here, so this is the plain tile transpose over the band. */
+static void simd_transpose_stream_float(float*       dst,
+                                        size_t       ldd,
+                                        const float* src,
+                                        size_t       lds,
+                                        size_t       cols) {
+    simd_transpose_float(dst, ldd, src, lds, 16u, cols);
+}
+// --------------------------------------------------------------------------------
+
+/* y[r] += sum over blocks b < nb of row r of block b dotted with
+ * x + col[b] * bc, for r < rows: one block row of a BSR SpMV.  Blocks are
+ * br x bc, row-major and packed back to back.  Block rows are dotted 4
+ * lanes at a time with one horizontal sum per output row. */
+static void simd_bsr_float(float*        y,
+                           const float*  val,
+                           const size_t* col,
+                           const float*  x,
+                           size_t        nb,
+                           size_t        rows,
+                           size_t        br,
+                           size_t        bc) {
+    for (size_t r = 0u; r < rows; r++) {
+        float32x4_t acc0 = vdupq_n_f32(0.0f);
+        float s = 0.0f;
+        for (size_t b = 0u; b < nb; b++) {
+            const float* a  = val + (b * br + r) * bc;
+            const float* xb = x + col[b] * bc;
+            size_t k = 0u;
+            for (; k + 4u <= bc; k += 4u)
+                acc0 = vaddq_f32(acc0, vmulq_f32(vld1q_f32(a + k), vld1q_f32(xb + k)));
+            for (; k < bc; k++) s += a[k] * xb[k];
+        }
+        float lanes[4];
+        vst1q_f32(lanes, acc0);
+        for (size_t w = 0u; w < 4u; w++) s += lanes[w];
+        y[r] += s;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* y[i] = sum over j < width of val[j * chunk + i] * x[idx[j * chunk + i]]
+ * for i < chunk: one slice of a SELL-C-sigma SpMV.  The slice is stored
+ * column by column, so consecutive lanes hold consecutive rows.  4 rows
+ * per register; x is gathered with scalar loads, since NEON has no gather. */
+static void simd_sell_float(float*        y,
+                            const float*  val,
+                            const size_t* idx,
+                            const float*  x,
+                            size_t        chunk,
+                            size_t        width) {
+    size_t i = 0u;
+    for (; i + 4u <= chunk; i += 4u) {
+        float32x4_t acc = vdupq_n_f32(0.0f);
+        for (size_t j = 0u; j < width; j++) {
+            const float*  v = val + j * chunk + i;
+            const size_t* c = idx + j * chunk + i;
+            float g[4];
+            for (size_t w = 0u; w < 4u; w++) g[w] = x[c[w]];
+            acc = vaddq_f32(acc, vmulq_f32(vld1q_f32(v), vld1q_f32(g)));
+        }
+        vst1q_f32(y + i, acc);
+    }
+    for (; i < chunk; i++) {
+        float s = 0.0f;
+        for (size_t j = 0u; j < width; j++)
+            s += val[j * chunk + i] * x[idx[j * chunk + i]];
+        y[i] = s;
+    }
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_NEON_FLOAT_INL */
 
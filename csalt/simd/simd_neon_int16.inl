@@ -52,6 +52,111 @@ static inline error_code_t simd_min_int16(const int16_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int16(int16_t*       out,
+                             const int16_t* a,
+                             int16_t        lo,
+                             int16_t        hi,
+                             size_t         len) {
+    int16x8_t const vlo = vdupq_n_s16(lo);
+    int16x8_t const vhi = vdupq_n_s16(hi);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        int16x8_t x = vld1q_s16(a + i);
+        vst1q_s16(out + i, vmaxq_s16(vlo, vminq_s16(x, vhi)));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int16(int16_t*       out,
+                           const int16_t* a,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        int16x8_t x = vld1q_s16(a + i);
+        vst1q_s16(out + i, vabsq_s16(x));
+    }
+    for (; i < len; i++)
+        out[i] = (int16_t)(a[i] < 0 ? -a[i] : a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int16(const int16_t* data,
+                                   size_t         len,
+                                   int16_t*       out) {
+    int16_t cur = *out;   /* caller seeds with INT16_MIN */
+    size_t  i   = 0u;
+
+    int16x8_t vmax = vdupq_n_s16(cur);
+    for (; i + 8u <= len; i += 8u)
+        vmax = vmaxq_s16(vmax, vld1q_s16(data + i));
+
+    int16_t lanes[8];
+    vst1q_s16(lanes, vmax);
+    for (size_t k = 0u; k < 8u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int16(const int16_t* data,
+                              size_t         len) {
+    int64x2_t acc = vdupq_n_s64(0);
+    size_t    i   = 0u;
+
+    /* Pairwise widening adds carry every lane up to 64 bits */
+    for (; i + 8u <= len; i += 8u)
+        acc = vpadalq_s32(acc, vpaddlq_s16(vld1q_s16(data + i)));
+
+    int64_t sum = vgetq_lane_s64(acc, 0) + vgetq_lane_s64(acc, 1);
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int16(int16_t*       out,
+                               const int16_t* a,
+                               const int16_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        int16x8_t x = vld1q_s16(a + i);
+        int16x8_t y = vld1q_s16(b + i);
+        vst1q_s16(out + i, vminq_s16(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int16(int16_t*       out,
+                               const int16_t* a,
+                               const int16_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        int16x8_t x = vld1q_s16(a + i);
+        int16x8_t y = vld1q_s16(b + i);
+        vst1q_s16(out + i, vmaxq_s16(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_NEON_MIN_INT16_INL */
 // ================================================================================
@@ -52,6 +52,111 @@ static inline error_code_t simd_min_int32(const int32_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int32(int32_t*       out,
+                             const int32_t* a,
+                             int32_t        lo,
+                             int32_t        hi,
+                             size_t         len) {
+    int32x4_t const vlo = vdupq_n_s32(lo);
+    int32x4_t const vhi = vdupq_n_s32(hi);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        int32x4_t x = vld1q_s32(a + i);
+        vst1q_s32(out + i, vmaxq_s32(vlo, vminq_s32(x, vhi)));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int32(int32_t*       out,
+                           const int32_t* a,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        int32x4_t x = vld1q_s32(a + i);
+        vst1q_s32(out + i, vabsq_s32(x));
+    }
+    for (; i < len; i++)
+        out[i] = (int32_t)(a[i] < 0 ? 0u - (uint32_t)a[i] : (uint32_t)a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int32(const int32_t* data,
+                                   size_t         len,
+                                   int32_t*       out) {
+    int32_t cur = *out;   /* caller seeds with INT32_MIN */
+    size_t  i   = 0u;
+
+    int32x4_t vmax = vdupq_n_s32(cur);
+    for (; i + 4u <= len; i += 4u)
+        vmax = vmaxq_s32(vmax, vld1q_s32(data + i));
+
+    int32_t lanes[4];
+    vst1q_s32(lanes, vmax);
+    for (size_t k = 0u; k < 4u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int32(const int32_t* data,
+                              size_t         len) {
+    int64x2_t acc = vdupq_n_s64(0);
+    size_t    i   = 0u;
+
+    /* Pairwise widening adds carry every lane up to 64 bits */
+    for (; i + 4u <= len; i += 4u)
+        acc = vpadalq_s32(acc, vld1q_s32(data + i));
+
+    int64_t sum = vgetq_lane_s64(acc, 0) + vgetq_lane_s64(acc, 1);
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int32(int32_t*       out,
+                               const int32_t* a,
+                               const int32_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        int32x4_t x = vld1q_s32(a + i);
+        int32x4_t y = vld1q_s32(b + i);
+        vst1q_s32(out + i, vminq_s32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int32(int32_t*       out,
+                               const int32_t* a,
+                               const int32_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        int32x4_t x = vld1q_s32(a + i);
+        int32x4_t y = vld1q_s32(b + i);
+        vst1q_s32(out + i, vmaxq_s32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_NEON_MIN_INT32_INL */
 // ================================================================================
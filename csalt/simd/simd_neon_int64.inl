@@ -39,6 +39,103 @@ static inline error_code_t simd_min_int64(const int64_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int64(int64_t*       out,
+                             const int64_t* a,
+                             int64_t        lo,
+                             int64_t        hi,
+                             size_t         len) {
+    /* No 64-bit vminq/vmaxq; compare and bit-select instead */
+    int64x2_t const vlo = vdupq_n_s64(lo);
+    int64x2_t const vhi = vdupq_n_s64(hi);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        int64x2_t x = vld1q_s64(a + i);
+        x = vbslq_s64(vcgtq_s64(x, vhi), vhi, x);
+        x = vbslq_s64(vcgtq_s64(vlo, x), vlo, x);
+        vst1q_s64(out + i, x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int64(int64_t*       out,
+                           const int64_t* a,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        int64x2_t x = vld1q_s64(a + i);
+        vst1q_s64(out + i, vabsq_s64(x));
+    }
+    for (; i < len; i++)
+        out[i] = (int64_t)(a[i] < 0 ? 0u - (uint64_t)a[i] : (uint64_t)a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int64(const int64_t* data,
+                                   size_t         len,
+                                   int64_t*       out) {
+    int64_t cur = *out;   /* caller seeds with INT64_MIN */
+    size_t  i   = 0u;
+
+    int64x2_t vmax = vdupq_n_s64(cur);
+    /* No 64-bit vmaxq; compare and bit-select instead */
+    for (; i + 2u <= len; i += 2u) {
+        int64x2_t x = vld1q_s64(data + i);
+        vmax = vbslq_s64(vcgtq_s64(x, vmax), x, vmax);
+    }
+
+    int64_t lanes[2];
+    vst1q_s64(lanes, vmax);
+    for (size_t k = 0u; k < 2u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int64(int64_t*       out,
+                               const int64_t* a,
+                               const int64_t* b,
+                               size_t         len) {
+    /* No 64-bit vminq/vmaxq; compare and bit-select instead */
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        int64x2_t x = vld1q_s64(a + i);
+        int64x2_t y = vld1q_s64(b + i);
+        vst1q_s64(out + i, vbslq_s64(vcgtq_s64(x, y), y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int64(int64_t*       out,
+                               const int64_t* a,
+                               const int64_t* b,
+                               size_t         len) {
+    /* No 64-bit vminq/vmaxq; compare and bit-select instead */
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        int64x2_t x = vld1q_s64(a + i);
+        int64x2_t y = vld1q_s64(b + i);
+        vst1q_s64(out + i, vbslq_s64(vcltq_s64(x, y), y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_NEON_MIN_INT64_INL */
 // ================================================================================
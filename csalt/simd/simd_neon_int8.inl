@@ -53,6 +53,111 @@ static inline error_code_t simd_min_int8(const int8_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int8(int8_t*       out,
+                            const int8_t* a,
+                            int8_t        lo,
+                            int8_t        hi,
+                            size_t        len) {
+    int8x16_t const vlo = vdupq_n_s8(lo);
+    int8x16_t const vhi = vdupq_n_s8(hi);
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        int8x16_t x = vld1q_s8(a + i);
+        vst1q_s8(out + i, vmaxq_s8(vlo, vminq_s8(x, vhi)));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int8(int8_t*       out,
+                          const int8_t* a,
+                          size_t        len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        int8x16_t x = vld1q_s8(a + i);
+        vst1q_s8(out + i, vabsq_s8(x));
+    }
+    for (; i < len; i++)
+        out[i] = (int8_t)(a[i] < 0 ? -a[i] : a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int8(const int8_t* data,
+                                  size_t        len,
+                                  int8_t*       out) {
+    int8_t cur = *out;   /* caller seeds with INT8_MIN */
+    size_t i   = 0u;
+
+    int8x16_t vmax = vdupq_n_s8(cur);
+    for (; i + 16u <= len; i += 16u)
+        vmax = vmaxq_s8(vmax, vld1q_s8(data + i));
+
+    int8_t lanes[16];
+    vst1q_s8(lanes, vmax);
+    for (size_t k = 0u; k < 16u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int8(const int8_t* data,
+                             size_t        len) {
+    int64x2_t acc = vdupq_n_s64(0);
+    size_t    i   = 0u;
+
+    /* Pairwise widening adds carry every lane up to 64 bits */
+    for (; i + 16u <= len; i += 16u)
+        acc = vpadalq_s32(acc, vpaddlq_s16(vpaddlq_s8(vld1q_s8(data + i))));
+
+    int64_t sum = vgetq_lane_s64(acc, 0) + vgetq_lane_s64(acc, 1);
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int8(int8_t*       out,
+                              const int8_t* a,
+                              const int8_t* b,
+                              size_t        len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        int8x16_t x = vld1q_s8(a + i);
+        int8x16_t y = vld1q_s8(b + i);
+        vst1q_s8(out + i, vminq_s8(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int8(int8_t*       out,
+                              const int8_t* a,
+                              const int8_t* b,
+                              size_t        len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        int8x16_t x = vld1q_s8(a + i);
+        int8x16_t y = vld1q_s8(b + i);
+        vst1q_s8(out + i, vmaxq_s8(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_NEON_MIN_INT8_INL */
 // ================================================================================
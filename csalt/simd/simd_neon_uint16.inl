@@ -32,6 +32,7 @@
 #include <arm_neon.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -126,5 +127,189 @@ static inline error_code_t simd_min_uint16(const uint16_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        uint16x8_t x = vld1q_u16(a + i);
+        uint16x8_t y = vld1q_u16(b + i);
+        vst1q_u16(out + i, vaddq_u16(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint16_t)(a[i] + b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        uint16x8_t x = vld1q_u16(a + i);
+        uint16x8_t y = vld1q_u16(b + i);
+        vst1q_u16(out + i, vsubq_u16(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint16_t)(a[i] - b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        uint16x8_t x = vld1q_u16(a + i);
+        uint16x8_t y = vld1q_u16(b + i);
+        vst1q_u16(out + i, vmulq_u16(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint16_t)((uint32_t)a[i] * b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint16(uint16_t*       out,
+                               const uint16_t* a,
+                               uint16_t        mul,
+                               uint16_t        add,
+                               size_t          len) {
+    uint16x8_t const vmul = vdupq_n_u16(mul);
+    uint16x8_t const vadd = vdupq_n_u16(add);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        uint16x8_t x = vld1q_u16(a + i);
+        vst1q_u16(out + i, vmlaq_u16(vadd, x, vmul));
+    }
+    for (; i < len; i++)
+        out[i] = (uint16_t)((uint32_t)a[i] * mul + add);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint16(uint16_t*       out,
+                              const uint16_t* a,
+                              uint16_t        lo,
+                              uint16_t        hi,
+                              size_t          len) {
+    uint16x8_t const vlo = vdupq_n_u16(lo);
+    uint16x8_t const vhi = vdupq_n_u16(hi);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        uint16x8_t x = vld1q_u16(a + i);
+        vst1q_u16(out + i, vmaxq_u16(vlo, vminq_u16(x, vhi)));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint16(const uint16_t* data,
+                                    size_t          len,
+                                    uint16_t*       out) {
+    uint16_t cur = *out;   /* caller seeds with 0 */
+    size_t   i   = 0u;
+
+    uint16x8_t vmax = vdupq_n_u16(cur);
+    for (; i + 8u <= len; i += 8u)
+        vmax = vmaxq_u16(vmax, vld1q_u16(data + i));
+
+    uint16_t lanes[8];
+    vst1q_u16(lanes, vmax);
+    for (size_t k = 0u; k < 8u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint16(const uint16_t* data,
+                                size_t          len) {
+    uint64x2_t acc = vdupq_n_u64(0);
+    size_t     i   = 0u;
+
+    /* Pairwise widening adds carry every lane up to 64 bits */
+    for (; i + 8u <= len; i += 8u)
+        acc = vpadalq_u32(acc, vpaddlq_u16(vld1q_u16(data + i)));
+
+    uint64_t sum = vgetq_lane_u64(acc, 0) + vgetq_lane_u64(acc, 1);
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint16(uint16_t*       out,
+                                const uint16_t* a,
+                                const uint16_t* b,
+                                size_t          len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        uint16x8_t x = vld1q_u16(a + i);
+        uint16x8_t y = vld1q_u16(b + i);
+        vst1q_u16(out + i, vminq_u16(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint16(uint16_t*       out,
+                                const uint16_t* a,
+                                const uint16_t* b,
+                                size_t          len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        uint16x8_t x = vld1q_u16(a + i);
+        uint16x8_t y = vld1q_u16(b + i);
+        vst1q_u16(out + i, vmaxq_u16(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static uint16_t simd_scan_uint16(uint16_t*       out,
+                                 const uint16_t* a,
+                                 size_t          len,
+                                 uint16_t        carry,
+                                 bool            exclusive) {
+    /* Log-step scan in registers: after the shifted adds lane k of p holds
+     * x[0] + ... + x[k].  cv carries the running total in every lane */
+    uint16x8_t const z = vdupq_n_u16(0);
+    uint16x8_t cv = vdupq_n_u16(carry);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        uint16x8_t x = vld1q_u16(a + i);
+        uint16x8_t p = vaddq_u16(x, vextq_u16(z, x, 7));
+        p = vaddq_u16(p, vextq_u16(z, p, 6));
+        p = vaddq_u16(p, vextq_u16(z, p, 4));
+        uint16x8_t const r = vaddq_u16(p, cv);
+        uint16x8_t const y = exclusive ? vaddq_u16(vextq_u16(z, p, 7), cv) : r;
+        vst1q_u16(out + i, y);
+        cv = vdupq_laneq_u16(r, 7);
+    }
+    carry = vgetq_lane_u16(cv, 0);
+    for (; i < len; i++) {
+        uint16_t const prev = carry;
+        carry = (uint16_t)(carry + a[i]);
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_NEON_UINT16_INL */
 
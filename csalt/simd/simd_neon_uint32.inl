@@ -32,6 +32,7 @@
 #include <arm_neon.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -128,5 +129,188 @@ static inline error_code_t simd_min_uint32(const uint32_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        uint32x4_t x = vld1q_u32(a + i);
+        uint32x4_t y = vld1q_u32(b + i);
+        vst1q_u32(out + i, vaddq_u32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        uint32x4_t x = vld1q_u32(a + i);
+        uint32x4_t y = vld1q_u32(b + i);
+        vst1q_u32(out + i, vsubq_u32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        uint32x4_t x = vld1q_u32(a + i);
+        uint32x4_t y = vld1q_u32(b + i);
+        vst1q_u32(out + i, vmulq_u32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint32(uint32_t*       out,
+                               const uint32_t* a,
+                               uint32_t        mul,
+                               uint32_t        add,
+                               size_t          len) {
+    uint32x4_t const vmul = vdupq_n_u32(mul);
+    uint32x4_t const vadd = vdupq_n_u32(add);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        uint32x4_t x = vld1q_u32(a + i);
+        vst1q_u32(out + i, vmlaq_u32(vadd, x, vmul));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint32(uint32_t*       out,
+                              const uint32_t* a,
+                              uint32_t        lo,
+                              uint32_t        hi,
+                              size_t          len) {
+    uint32x4_t const vlo = vdupq_n_u32(lo);
+    uint32x4_t const vhi = vdupq_n_u32(hi);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        uint32x4_t x = vld1q_u32(a + i);
+        vst1q_u32(out + i, vmaxq_u32(vlo, vminq_u32(x, vhi)));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint32(const uint32_t* data,
+                                    size_t          len,
+                                    uint32_t*       out) {
+    uint32_t cur = *out;   /* caller seeds with 0 */
+    size_t   i   = 0u;
+
+    uint32x4_t vmax = vdupq_n_u32(cur);
+    for (; i + 4u <= len; i += 4u)
+        vmax = vmaxq_u32(vmax, vld1q_u32(data + i));
+
+    uint32_t lanes[4];
+    vst1q_u32(lanes, vmax);
+    for (size_t k = 0u; k < 4u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint32(const uint32_t* data,
+                                size_t          len) {
+    uint64x2_t acc = vdupq_n_u64(0);
+    size_t     i   = 0u;
+
+    /* Pairwise widening adds carry every lane up to 64 bits */
+    for (; i + 4u <= len; i += 4u)
+        acc = vpadalq_u32(acc, vld1q_u32(data + i));
+
+    uint64_t sum = vgetq_lane_u64(acc, 0) + vgetq_lane_u64(acc, 1);
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint32(uint32_t*       out,
+                                const uint32_t* a,
+                                const uint32_t* b,
+                                size_t          len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        uint32x4_t x = vld1q_u32(a + i);
+        uint32x4_t y = vld1q_u32(b + i);
+        vst1q_u32(out + i, vminq_u32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint32(uint32_t*       out,
+                                const uint32_t* a,
+                                const uint32_t* b,
+                                size_t          len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        uint32x4_t x = vld1q_u32(a + i);
+        uint32x4_t y = vld1q_u32(b + i);
+        vst1q_u32(out + i, vmaxq_u32(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static uint32_t simd_scan_uint32(uint32_t*       out,
+                                 const uint32_t* a,
+                                 size_t          len,
+                                 uint32_t        carry,
+                                 bool            exclusive) {
+    /* Log-step scan in registers: after the shifted adds lane k of p holds
+     * x[0] + ... + x[k].  cv carries the running total in every lane */
+    uint32x4_t const z = vdupq_n_u32(0);
+    uint32x4_t cv = vdupq_n_u32(carry);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        uint32x4_t x = vld1q_u32(a + i);
+        uint32x4_t p = vaddq_u32(x, vextq_u32(z, x, 3));
+        p = vaddq_u32(p, vextq_u32(z, p, 2));
+        uint32x4_t const r = vaddq_u32(p, cv);
+        uint32x4_t const y = exclusive ? vaddq_u32(vextq_u32(z, p, 3), cv) : r;
+        vst1q_u32(out + i, y);
+        cv = vdupq_laneq_u32(r, 3);
+    }
+    carry = vgetq_lane_u32(cv, 0);
+    for (; i < len; i++) {
+        uint32_t const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_NEON_UINT32_INL */
 
@@ -32,6 +32,7 @@
 #include <arm_neon.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -108,5 +109,168 @@ static inline error_code_t simd_min_uint64(const uint64_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        uint64x2_t x = vld1q_u64(a + i);
+        uint64x2_t y = vld1q_u64(b + i);
+        vst1q_u64(out + i, vaddq_u64(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        uint64x2_t x = vld1q_u64(a + i);
+        uint64x2_t y = vld1q_u64(b + i);
+        vst1q_u64(out + i, vsubq_u64(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    /* NEON has no 64-bit integer multiply */
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint64(uint64_t*       out,
+                               const uint64_t* a,
+                               uint64_t        mul,
+                               uint64_t        add,
+                               size_t          len) {
+    /* NEON has no 64-bit integer multiply */
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint64(uint64_t*       out,
+                              const uint64_t* a,
+                              uint64_t        lo,
+                              uint64_t        hi,
+                              size_t          len) {
+    /* No 64-bit vminq/vmaxq; compare and bit-select instead */
+    uint64x2_t const vlo = vdupq_n_u64(lo);
+    uint64x2_t const vhi = vdupq_n_u64(hi);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        uint64x2_t x = vld1q_u64(a + i);
+        x = vbslq_u64(vcgtq_u64(x, vhi), vhi, x);
+        x = vbslq_u64(vcgtq_u64(vlo, x), vlo, x);
+        vst1q_u64(out + i, x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint64(const uint64_t* data,
+                                    size_t          len,
+                                    uint64_t*       out) {
+    uint64_t cur = *out;   /* caller seeds with 0 */
+    size_t   i   = 0u;
+
+    uint64x2_t vmax = vdupq_n_u64(cur);
+    /* No 64-bit vmaxq; compare and bit-select instead */
+    for (; i + 2u <= len; i += 2u) {
+        uint64x2_t x = vld1q_u64(data + i);
+        vmax = vbslq_u64(vcgtq_u64(x, vmax), x, vmax);
+    }
+
+    uint64_t lanes[2];
+    vst1q_u64(lanes, vmax);
+    for (size_t k = 0u; k < 2u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint64(uint64_t*       out,
+                                const uint64_t* a,
+                                const uint64_t* b,
+                                size_t          len) {
+    /* No 64-bit vminq/vmaxq; compare and bit-select instead */
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        uint64x2_t x = vld1q_u64(a + i);
+        uint64x2_t y = vld1q_u64(b + i);
+        vst1q_u64(out + i, vbslq_u64(vcgtq_u64(x, y), y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint64(uint64_t*       out,
+                                const uint64_t* a,
+                                const uint64_t* b,
+                                size_t          len) {
+    /* No 64-bit vminq/vmaxq; compare and bit-select instead */
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        uint64x2_t x = vld1q_u64(a + i);
+        uint64x2_t y = vld1q_u64(b + i);
+        vst1q_u64(out + i, vbslq_u64(vcltq_u64(x, y), y, x));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static uint64_t simd_scan_uint64(uint64_t*       out,
+                                 const uint64_t* a,
+                                 size_t          len,
+                                 uint64_t        carry,
+                                 bool            exclusive) {
+    /* Log-step scan in registers: after the shifted adds lane k of p holds
+     * x[0] + ... + x[k].  cv carries the running total in every lane */
+    uint64x2_t const z = vdupq_n_u64(0);
+    uint64x2_t cv = vdupq_n_u64(carry);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        uint64x2_t x = vld1q_u64(a + i);
+        uint64x2_t p = vaddq_u64(x, vextq_u64(z, x, 1));
+        uint64x2_t const r = vaddq_u64(p, cv);
+        uint64x2_t const y = exclusive ? vaddq_u64(vextq_u64(z, p, 1), cv) : r;
+        vst1q_u64(out + i, y);
+        cv = vdupq_laneq_u64(r, 1);
+    }
+    carry = vgetq_lane_u64(cv, 0);
+    for (; i < len; i++) {
+        uint64_t const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_NEON_UINT64_INL */
 
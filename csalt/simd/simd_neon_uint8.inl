@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include <string.h>
 #include <arm_sve.h>
 // ================================================================================ 
@@ -168,5 +169,190 @@ static inline error_code_t simd_min_uint8(const uint8_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        uint8x16_t x = vld1q_u8(a + i);
+        uint8x16_t y = vld1q_u8(b + i);
+        vst1q_u8(out + i, vaddq_u8(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint8_t)(a[i] + b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        uint8x16_t x = vld1q_u8(a + i);
+        uint8x16_t y = vld1q_u8(b + i);
+        vst1q_u8(out + i, vsubq_u8(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint8_t)(a[i] - b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        uint8x16_t x = vld1q_u8(a + i);
+        uint8x16_t y = vld1q_u8(b + i);
+        vst1q_u8(out + i, vmulq_u8(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint8_t)(a[i] * b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint8(uint8_t*       out,
+                              const uint8_t* a,
+                              uint8_t        mul,
+                              uint8_t        add,
+                              size_t         len) {
+    uint8x16_t const vmul = vdupq_n_u8(mul);
+    uint8x16_t const vadd = vdupq_n_u8(add);
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        uint8x16_t x = vld1q_u8(a + i);
+        vst1q_u8(out + i, vmlaq_u8(vadd, x, vmul));
+    }
+    for (; i < len; i++)
+        out[i] = (uint8_t)(a[i] * mul + add);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint8(uint8_t*       out,
+                             const uint8_t* a,
+                             uint8_t        lo,
+                             uint8_t        hi,
+                             size_t         len) {
+    uint8x16_t const vlo = vdupq_n_u8(lo);
+    uint8x16_t const vhi = vdupq_n_u8(hi);
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        uint8x16_t x = vld1q_u8(a + i);
+        vst1q_u8(out + i, vmaxq_u8(vlo, vminq_u8(x, vhi)));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint8(const uint8_t* data,
+                                   size_t         len,
+                                   uint8_t*       out) {
+    uint8_t cur = *out;   /* caller seeds with 0 */
+    size_t  i   = 0u;
+
+    uint8x16_t vmax = vdupq_n_u8(cur);
+    for (; i + 16u <= len; i += 16u)
+        vmax = vmaxq_u8(vmax, vld1q_u8(data + i));
+
+    uint8_t lanes[16];
+    vst1q_u8(lanes, vmax);
+    for (size_t k = 0u; k < 16u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint8(const uint8_t* data,
+                               size_t         len) {
+    uint64x2_t acc = vdupq_n_u64(0);
+    size_t     i   = 0u;
+
+    /* Pairwise widening adds carry every lane up to 64 bits */
+    for (; i + 16u <= len; i += 16u)
+        acc = vpadalq_u32(acc, vpaddlq_u16(vpaddlq_u8(vld1q_u8(data + i))));
+
+    uint64_t sum = vgetq_lane_u64(acc, 0) + vgetq_lane_u64(acc, 1);
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               const uint8_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        uint8x16_t x = vld1q_u8(a + i);
+        uint8x16_t y = vld1q_u8(b + i);
+        vst1q_u8(out + i, vminq_u8(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               const uint8_t* b,
+                               size_t         len) {
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        uint8x16_t x = vld1q_u8(a + i);
+        uint8x16_t y = vld1q_u8(b + i);
+        vst1q_u8(out + i, vmaxq_u8(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static uint8_t simd_scan_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               size_t         len,
+                               uint8_t        carry,
+                               bool           exclusive) {
+    /* Log-step scan in registers: after the shifted adds lane k of p holds
+     * x[0] + ... + x[k].  cv carries the running total in every lane */
+    uint8x16_t const z = vdupq_n_u8(0);
+    uint8x16_t cv = vdupq_n_u8(carry);
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        uint8x16_t x = vld1q_u8(a + i);
+        uint8x16_t p = vaddq_u8(x, vextq_u8(z, x, 15));
+        p = vaddq_u8(p, vextq_u8(z, p, 14));
+        p = vaddq_u8(p, vextq_u8(z, p, 12));
+        p = vaddq_u8(p, vextq_u8(z, p, 8));
+        uint8x16_t const r = vaddq_u8(p, cv);
+        uint8x16_t const y = exclusive ? vaddq_u8(vextq_u8(z, p, 15), cv) : r;
+        vst1q_u8(out + i, y);
+        cv = vdupq_laneq_u8(r, 15);
+    }
+    carry = vgetq_lane_u8(cv, 0);
+    for (; i < len; i++) {
+        uint8_t const prev = carry;
+        carry = (uint8_t)(carry + a[i]);
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_NEON_UINT8_INL */
 
@@ -20,9 +20,9 @@
  *   - If a or b is NULL and n > 0, returns 0 (defensive).
  *     Prefer guarding against NULL at the caller for stricter semantics.
  */
-static inline size_t csalt_first_diff_u8(const uint8_t* a,
-                                        const uint8_t* b,
-                                        size_t n) {
+static inline size_t simd_first_diff_u8(const uint8_t* a,
+                                       const uint8_t* b,
+                                       size_t n) {
     if ((n == 0u)) {
         return 0u;
     }
@@ -107,8 +107,8 @@ static inline size_t simd_find_substr_u8(const uint8_t* hay,
 }
 // -------------------------------------------------------------------------------- 
 
-size_t simd_token_count_u8(const uint8_t* s, size_t n,
-                           const char* delim, size_t dlen) {
+static inline size_t simd_token_count_u8(const uint8_t* s, size_t n,
+                                         const char* delim, size_t dlen) {
     if ((s == NULL) || (delim == NULL)) return SIZE_MAX;
     if (n == 0u) return 0u;
     if (dlen == 0u) return 1u;
@@ -134,7 +134,7 @@ size_t simd_token_count_u8(const uint8_t* s, size_t n,
 }
 // -------------------------------------------------------------------------------- 
 
-void simd_ascii_upper_u8(uint8_t* p, size_t n) {
+static inline void simd_ascii_upper_u8(uint8_t* p, size_t n) {
     if ((p == NULL) || (n == 0u)) return;
 
     for (size_t i = 0; i < n; ++i) {
@@ -146,7 +146,7 @@ void simd_ascii_upper_u8(uint8_t* p, size_t n) {
 }
 // -------------------------------------------------------------------------------- 
 
-void simd_ascii_lower_u8(uint8_t* p, size_t n) {
+static inline void simd_ascii_lower_u8(uint8_t* p, size_t n) {
     if ((p == NULL) || (n == 0u)) return;
 
     for (size_t i = 0; i < n; ++i) {
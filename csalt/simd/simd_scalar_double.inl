@@ -88,5 +88,274 @@ static inline error_code_t simd_min_double(const double* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_div_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] / b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_double(double*       out,
+                               const double* a,
+                               double        mul,
+                               double        add,
+                               size_t        len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_double(double*       out,
+                              const double* a,
+                              double        lo,
+                              double        hi,
+                              size_t        len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_double(double*       out,
+                            const double* a,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = fabs(a[i]);
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_double(const double* data,
+                                    size_t        len,
+                                    double*       out) {
+    double cur = *out;   /* caller seeds with -INFINITY */
+    size_t i   = 0u;
+
+    for (; i < len; i++) {
+        if (isnan(data[i])) { *out = NAN; return NO_ERROR; }
+        if (data[i] > cur) cur = data[i];
+    }
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static double simd_sum_double(const double* data,
+                              size_t        len) {
+    double sum = 0.0;
+    for (size_t i = 0u; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static double simd_asum_double(const double* data,
+                               size_t        len) {
+    double sum = 0.0;
+    for (size_t i = 0u; i < len; i++)
+        sum += fabs(data[i]);
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static double simd_dot_double(const double* a,
+                              const double* b,
+                              size_t        len) {
+    double sum = 0.0;
+    for (size_t i = 0u; i < len; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_double(double*       out,
+                                const double* a,
+                                const double* b,
+                                size_t        len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] < a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_double(double*       out,
+                                const double* a,
+                                const double* b,
+                                size_t        len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] > a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static double simd_scan_double(double*       out,
+                               const double* a,
+                               size_t        len,
+                               double        carry,
+                               bool          exclusive) {
+    size_t i = 0u;
+    for (; i < len; i++) {
+        double const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
+// MATRIX KERNELS
+
+/* y[i] += alpha * x[i] */
+static void simd_axpy_double(double*       y,
+                             const double* x,
+                             double        alpha,
+                             size_t        len) {
+    for (size_t i = 0u; i < len; i++)
+        y[i] += alpha * x[i];
+}
+// --------------------------------------------------------------------------------
+
+/* C[0..4)[0..n) += A[0..4)[0..k) * B[0..k)[0..n), all row-major with leading
+ * dimensions ldc, lda and ldb */
+static void simd_gemm4_double(double*       c,
+                              size_t        ldc,
+                              const double* a,
+                              size_t        lda,
+                              const double* b,
+                              size_t        ldb,
+                              size_t        k,
+                              size_t        n) {
+    size_t j = 0u;
+    for (; j < n; j++) {
+        double s0 = c[j], s1 = c[ldc + j], s2 = c[2u * ldc + j], s3 = c[3u * ldc + j];
+        const double* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            s0 += a[p]            * *bp;
+            s1 += a[lda + p]      * *bp;
+            s2 += a[2u * lda + p] * *bp;
+            s3 += a[3u * lda + p] * *bp;
+        }
+        c[j] = s0; c[ldc + j] = s1; c[2u * ldc + j] = s2; c[3u * ldc + j] = s3;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* sum of val[i] * x[idx[i]]: the sparse row (or column) dot product */
+static double simd_spdot_double(const double* val,
+                                const size_t* idx,
+                                const double* x,
+                                size_t        len) {
+    double s0 = 0.0, s1 = 0.0;
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        s0 += val[i]      * x[idx[i]];
+        s1 += val[i + 1u] * x[idx[i + 1u]];
+    }
+    if (i < len) s0 += val[i] * x[idx[i]];
+    return s0 + s1;
+}
+// --------------------------------------------------------------------------------
+
+/* dst[j * ldd + i] = src[i * lds + j] for i < rows, j < cols: one cache
+ * tile of a matrix transpose.  Plain loops; the caller's tiling provides the cache locality. */
+static void simd_transpose_double(double*       dst,
+                                  size_t        ldd,
+                                  const double* src,
+                                  size_t        lds,
+                                  size_t        rows,
+                                  size_t        cols) {
+    for (size_t i = 0u; i < rows; i++)
+        for (size_t j = 0u; j < cols; j++)
+            dst[j * ldd + i] = src[i * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* The same transpose for one band of 8 source rows, so each destination
+ * row receives one full 64-byte line at a time.  There are no portable non-temporal stores, so this is the plain tile
+ * transpose over the band. */
+static void simd_transpose_stream_double(double*       dst,
+                                         size_t        ldd,
+                                         const double* src,
+                                         size_t        lds,
+                                         size_t        cols) {
+    simd_transpose_double(dst, ldd, src, lds, 8u, cols);
+}
+// --------------------------------------------------------------------------------
+
+/* y[r] += sum over blocks b < nb of row r of block b dotted with
+ * x + col[b] * bc, for r < rows: one block row of a BSR SpMV.  Blocks are
+ * br x bc, row-major and packed back to back.  Plain loops. */
+static void simd_bsr_double(double*       y,
+                            const double* val,
+                            const size_t* col,
+                            const double* x,
+                            size_t        nb,
+                            size_t        rows,
+                            size_t        br,
+                            size_t        bc) {
+    for (size_t r = 0u; r < rows; r++) {
+        double s = 0.0;
+        for (size_t b = 0u; b < nb; b++) {
+            const double* a  = val + (b * br + r) * bc;
+            const double* xb = x + col[b] * bc;
+            for (size_t k = 0u; k < bc; k++) s += a[k] * xb[k];
+        }
+        y[r] += s;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* y[i] = sum over j < width of val[j * chunk + i] * x[idx[j * chunk + i]]
+ * for i < chunk: one slice of a SELL-C-sigma SpMV.  The slice is stored
+ * column by column, so consecutive lanes hold consecutive rows.  Plain
+ * loops. */
+static void simd_sell_double(double*       y,
+                             const double* val,
+                             const size_t* idx,
+                             const double* x,
+                             size_t        chunk,
+                             size_t        width) {
+    for (size_t i = 0u; i < chunk; i++) {
+        double s = 0.0;
+        for (size_t j = 0u; j < width; j++)
+            s += val[j * chunk + i] * x[idx[j * chunk + i]];
+        y[i] = s;
+    }
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SCALAR_DOUBLE_INL */
 
@@ -64,7 +64,300 @@ static bool simd_floats_equal(const float* a,
     }
     return true;
 }
+// --------------------------------------------------------------------------------
+
+static inline error_code_t simd_min_float(const float* data,
+                                          size_t       len,
+                                          float*       out) {
+    float cur_min = *out;                /* caller seeds with INFINITY */
+ 
+    for (size_t i = 0u; i < len; i++) {
+        if (isnan(data[i])) {
+            *out = NAN;
+            return NO_ERROR;
+        }
+        if (data[i] < cur_min) {
+            cur_min = data[i];
+            if (isinf(cur_min) && cur_min < 0.0f) {
+                *out = -INFINITY;
+                return NO_ERROR;
+            }
+        }
+    }
+ 
+    *out = cur_min;
+    return NO_ERROR;
+}
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_div_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] / b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_float(float*       out,
+                              const float* a,
+                              float        mul,
+                              float        add,
+                              size_t       len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_float(float*       out,
+                             const float* a,
+                             float        lo,
+                             float        hi,
+                             size_t       len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_float(float*       out,
+                           const float* a,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = fabsf(a[i]);
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_float(const float* data,
+                                   size_t       len,
+                                   float*       out) {
+    float  cur = *out;   /* caller seeds with -INFINITY */
+    size_t i   = 0u;
+
+    for (; i < len; i++) {
+        if (isnan(data[i])) { *out = NAN; return NO_ERROR; }
+        if (data[i] > cur) cur = data[i];
+    }
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static float simd_sum_float(const float* data,
+                            size_t       len) {
+    float sum = 0.0f;
+    for (size_t i = 0u; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static float simd_asum_float(const float* data,
+                             size_t       len) {
+    float sum = 0.0f;
+    for (size_t i = 0u; i < len; i++)
+        sum += fabsf(data[i]);
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static float simd_dot_float(const float* a,
+                            const float* b,
+                            size_t       len) {
+    float sum = 0.0f;
+    for (size_t i = 0u; i < len; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_float(float*       out,
+                               const float* a,
+                               const float* b,
+                               size_t       len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] < a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_float(float*       out,
+                               const float* a,
+                               const float* b,
+                               size_t       len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] > a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static float simd_scan_float(float*       out,
+                             const float* a,
+                             size_t       len,
+                             float        carry,
+                             bool         exclusive) {
+    size_t i = 0u;
+    for (; i < len; i++) {
+        float const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
+// MATRIX KERNELS
+
+/* y[i] += alpha * x[i] */
+static void simd_axpy_float(float*       y,
+                            const float* x,
+                            float        alpha,
+                            size_t       len) {
+    for (size_t i = 0u; i < len; i++)
+        y[i] += alpha * x[i];
+}
+// --------------------------------------------------------------------------------
+
+/* C[0..4)[0..n) += A[0..4)[0..k) * B[0..k)[0..n), all row-major with leading
+ * dimensions ldc, lda and ldb */
+static void simd_gemm4_float(float*       c,
+                             size_t       ldc,
+                             const float* a,
+                             size_t       lda,
+                             const float* b,
+                             size_t       ldb,
+                             size_t       k,
+                             size_t       n) {
+    size_t j = 0u;
+    for (; j < n; j++) {
+        float s0 = c[j], s1 = c[ldc + j], s2 = c[2u * ldc + j], s3 = c[3u * ldc + j];
+        const float* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            s0 += a[p]            * *bp;
+            s1 += a[lda + p]      * *bp;
+            s2 += a[2u * lda + p] * *bp;
+            s3 += a[3u * lda + p] * *bp;
+        }
+        c[j] = s0; c[ldc + j] = s1; c[2u * ldc + j] = s2; c[3u * ldc + j] = s3;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* sum of val[i] * x[idx[i]]: the sparse row (or column) dot product */
+static float simd_spdot_float(const float*  val,
+                              const size_t* idx,
+                              const float*  x,
+                              size_t        len) {
+    float s0 = 0.0f, s1 = 0.0f;
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        s0 += val[i]      * x[idx[i]];
+        s1 += val[i + 1u] * x[idx[i + 1u]];
+    }
+    if (i < len) s0 += val[i] * x[idx[i]];
+    return s0 + s1;
+}
+// --------------------------------------------------------------------------------
+
+/* dst[j * ldd + i] = src[i * lds + j] for i < rows, j < cols: one cache
+ * tile of a matrix transpose.  Plain loops; the caller's tiling provides the cache locality. */
+static void simd_transpose_float(float*       dst,
+                                 size_t       ldd,
+                                 const float* src,
+                                 size_t       lds,
+                                 size_t       rows,
+                                 size_t       cols) {
+    for (size_t i = 0u; i < rows; i++)
+        for (size_t j = 0u; j < cols; j++)
+            dst[j * ldd + i] = src[i * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* The same transpose for one band of 16 source rows, so each destination
+ * row receives one full 64-byte line at a time.  There are no portable non-temporal stores, so this is the plain tile
+ * transpose over the band. */
+static void simd_transpose_stream_float(float*       dst,
+                                        size_t       ldd,
+                                        const float* src,
+                                        size_t       lds,
+                                        size_t       cols) {
+    simd_transpose_float(dst, ldd, src, lds, 16u, cols);
+}
+// --------------------------------------------------------------------------------
+
+/* y[r] += sum over blocks b < nb of row r of block b dotted with
+ * x + col[b] * bc, for r < rows: one block row of a BSR SpMV.  Blocks are
+ * br x bc, row-major and packed back to back.  Plain loops. */
+static void simd_bsr_float(float*        y,
+                           const float*  val,
+                           const size_t* col,
+                           const float*  x,
+                           size_t        nb,
+                           size_t        rows,
+                           size_t        br,
+                           size_t        bc) {
+    for (size_t r = 0u; r < rows; r++) {
+        float s = 0.0f;
+        for (size_t b = 0u; b < nb; b++) {
+            const float* a  = val + (b * br + r) * bc;
+            const float* xb = x + col[b] * bc;
+            for (size_t k = 0u; k < bc; k++) s += a[k] * xb[k];
+        }
+        y[r] += s;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* y[i] = sum over j < width of val[j * chunk + i] * x[idx[j * chunk + i]]
+ * for i < chunk: one slice of a SELL-C-sigma SpMV.  The slice is stored
+ * column by column, so consecutive lanes hold consecutive rows.  Plain
+ * loops. */
+static void simd_sell_float(float*        y,
+                            const float*  val,
+                            const size_t* idx,
+                            const float*  x,
+                            size_t        chunk,
+                            size_t        width) {
+    for (size_t i = 0u; i < chunk; i++) {
+        float s = 0.0f;
+        for (size_t j = 0u; j < width; j++)
+            s += val[j * chunk + i] * x[idx[j * chunk + i]];
+        y[i] = s;
+    }
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SCALAR_FLOAT_INL */
 
@@ -38,6 +38,72 @@ static inline error_code_t simd_min_int16(const int16_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int16(int16_t*       out,
+                             const int16_t* a,
+                             int16_t        lo,
+                             int16_t        hi,
+                             size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int16(int16_t*       out,
+                           const int16_t* a,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (int16_t)(a[i] < 0 ? -a[i] : a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int16(const int16_t* data,
+                                   size_t         len,
+                                   int16_t*       out) {
+    int16_t cur = *out;   /* caller seeds with INT16_MIN */
+    size_t  i   = 0u;
+
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int16(const int16_t* data,
+                              size_t         len) {
+    int64_t sum = 0;
+    for (size_t i = 0u; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int16(int16_t*       out,
+                               const int16_t* a,
+                               const int16_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int16(int16_t*       out,
+                               const int16_t* a,
+                               const int16_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_SCALAR_MIN_INT16_INL */
 // ================================================================================
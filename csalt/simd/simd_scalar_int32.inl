@@ -38,6 +38,72 @@ static inline error_code_t simd_min_int32(const int32_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int32(int32_t*       out,
+                             const int32_t* a,
+                             int32_t        lo,
+                             int32_t        hi,
+                             size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int32(int32_t*       out,
+                           const int32_t* a,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (int32_t)(a[i] < 0 ? 0u - (uint32_t)a[i] : (uint32_t)a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int32(const int32_t* data,
+                                   size_t         len,
+                                   int32_t*       out) {
+    int32_t cur = *out;   /* caller seeds with INT32_MIN */
+    size_t  i   = 0u;
+
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int32(const int32_t* data,
+                              size_t         len) {
+    int64_t sum = 0;
+    for (size_t i = 0u; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int32(int32_t*       out,
+                               const int32_t* a,
+                               const int32_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int32(int32_t*       out,
+                               const int32_t* a,
+                               const int32_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_SCALAR_MIN_INT32_INL */
 // ================================================================================
@@ -38,6 +38,63 @@ static inline error_code_t simd_min_int64(const int64_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int64(int64_t*       out,
+                             const int64_t* a,
+                             int64_t        lo,
+                             int64_t        hi,
+                             size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int64(int64_t*       out,
+                           const int64_t* a,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (int64_t)(a[i] < 0 ? 0u - (uint64_t)a[i] : (uint64_t)a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int64(const int64_t* data,
+                                   size_t         len,
+                                   int64_t*       out) {
+    int64_t cur = *out;   /* caller seeds with INT64_MIN */
+    size_t  i   = 0u;
+
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int64(int64_t*       out,
+                               const int64_t* a,
+                               const int64_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int64(int64_t*       out,
+                               const int64_t* a,
+                               const int64_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_SCALAR_MIN_INT64_INL */
 // ================================================================================
@@ -37,6 +37,72 @@ static inline error_code_t simd_min_int8(const int8_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int8(int8_t*       out,
+                            const int8_t* a,
+                            int8_t        lo,
+                            int8_t        hi,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int8(int8_t*       out,
+                          const int8_t* a,
+                          size_t        len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (int8_t)(a[i] < 0 ? -a[i] : a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int8(const int8_t* data,
+                                  size_t        len,
+                                  int8_t*       out) {
+    int8_t cur = *out;   /* caller seeds with INT8_MIN */
+    size_t i   = 0u;
+
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int8(const int8_t* data,
+                             size_t        len) {
+    int64_t sum = 0;
+    for (size_t i = 0u; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int8(int8_t*       out,
+                              const int8_t* a,
+                              const int8_t* b,
+                              size_t        len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int8(int8_t*       out,
+                              const int8_t* a,
+                              const int8_t* b,
+                              size_t        len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_SCALAR_MIN_INT8_INL */
 // ================================================================================
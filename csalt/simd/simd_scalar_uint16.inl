@@ -27,6 +27,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -62,5 +63,115 @@ static inline error_code_t simd_min_uint16(const uint16_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (uint16_t)(a[i] + b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (uint16_t)(a[i] - b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (uint16_t)((uint32_t)a[i] * b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint16(uint16_t*       out,
+                               const uint16_t* a,
+                               uint16_t        mul,
+                               uint16_t        add,
+                               size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (uint16_t)((uint32_t)a[i] * mul + add);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint16(uint16_t*       out,
+                              const uint16_t* a,
+                              uint16_t        lo,
+                              uint16_t        hi,
+                              size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint16(const uint16_t* data,
+                                    size_t          len,
+                                    uint16_t*       out) {
+    uint16_t cur = *out;   /* caller seeds with 0 */
+    size_t   i   = 0u;
+
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint16(const uint16_t* data,
+                                size_t          len) {
+    uint64_t sum = 0;
+    for (size_t i = 0u; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint16(uint16_t*       out,
+                                const uint16_t* a,
+                                const uint16_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint16(uint16_t*       out,
+                                const uint16_t* a,
+                                const uint16_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static uint16_t simd_scan_uint16(uint16_t*       out,
+                                 const uint16_t* a,
+                                 size_t          len,
+                                 uint16_t        carry,
+                                 bool            exclusive) {
+    size_t i = 0u;
+    for (; i < len; i++) {
+        uint16_t const prev = carry;
+        carry = (uint16_t)(carry + a[i]);
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SCALAR_UINT16_INL */
 
@@ -27,6 +27,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -62,5 +63,115 @@ static inline error_code_t simd_min_uint32(const uint32_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint32(uint32_t*       out,
+                               const uint32_t* a,
+                               uint32_t        mul,
+                               uint32_t        add,
+                               size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint32(uint32_t*       out,
+                              const uint32_t* a,
+                              uint32_t        lo,
+                              uint32_t        hi,
+                              size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint32(const uint32_t* data,
+                                    size_t          len,
+                                    uint32_t*       out) {
+    uint32_t cur = *out;   /* caller seeds with 0 */
+    size_t   i   = 0u;
+
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint32(const uint32_t* data,
+                                size_t          len) {
+    uint64_t sum = 0;
+    for (size_t i = 0u; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint32(uint32_t*       out,
+                                const uint32_t* a,
+                                const uint32_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint32(uint32_t*       out,
+                                const uint32_t* a,
+                                const uint32_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static uint32_t simd_scan_uint32(uint32_t*       out,
+                                 const uint32_t* a,
+                                 size_t          len,
+                                 uint32_t        carry,
+                                 bool            exclusive) {
+    size_t i = 0u;
+    for (; i < len; i++) {
+        uint32_t const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SCALAR_UINT32_INL */
 
@@ -27,6 +27,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -62,5 +63,106 @@ static inline error_code_t simd_min_uint64(const uint64_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint64(uint64_t*       out,
+                               const uint64_t* a,
+                               uint64_t        mul,
+                               uint64_t        add,
+                               size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint64(uint64_t*       out,
+                              const uint64_t* a,
+                              uint64_t        lo,
+                              uint64_t        hi,
+                              size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint64(const uint64_t* data,
+                                    size_t          len,
+                                    uint64_t*       out) {
+    uint64_t cur = *out;   /* caller seeds with 0 */
+    size_t   i   = 0u;
+
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint64(uint64_t*       out,
+                                const uint64_t* a,
+                                const uint64_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint64(uint64_t*       out,
+                                const uint64_t* a,
+                                const uint64_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static uint64_t simd_scan_uint64(uint64_t*       out,
+                                 const uint64_t* a,
+                                 size_t          len,
+                                 uint64_t        carry,
+                                 bool            exclusive) {
+    size_t i = 0u;
+    for (; i < len; i++) {
+        uint64_t const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SCALAR_UINT64_INL */
 
@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include <string.h>
 // ================================================================================ 
 // ================================================================================ 
@@ -64,5 +65,115 @@ static inline error_code_t simd_min_uint8(const uint8_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (uint8_t)(a[i] + b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (uint8_t)(a[i] - b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (uint8_t)(a[i] * b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint8(uint8_t*       out,
+                              const uint8_t* a,
+                              uint8_t        mul,
+                              uint8_t        add,
+                              size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (uint8_t)(a[i] * mul + add);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint8(uint8_t*       out,
+                             const uint8_t* a,
+                             uint8_t        lo,
+                             uint8_t        hi,
+                             size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint8(const uint8_t* data,
+                                   size_t         len,
+                                   uint8_t*       out) {
+    uint8_t cur = *out;   /* caller seeds with 0 */
+    size_t  i   = 0u;
+
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint8(const uint8_t* data,
+                               size_t         len) {
+    uint64_t sum = 0;
+    for (size_t i = 0u; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               const uint8_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               const uint8_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static uint8_t simd_scan_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               size_t         len,
+                               uint8_t        carry,
+                               bool           exclusive) {
+    size_t i = 0u;
+    for (; i < len; i++) {
+        uint8_t const prev = carry;
+        carry = (uint8_t)(carry + a[i]);
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SCALAR_UINT8_INL */
 
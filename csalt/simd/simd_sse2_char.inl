@@ -195,8 +195,8 @@ static inline size_t simd_find_substr_u8(const uint8_t* hay,
 }
 // -------------------------------------------------------------------------------- 
 
-size_t simd_token_count_u8(const uint8_t* s, size_t n,
-                           const char* delim, size_t dlen) {
+static inline size_t simd_token_count_u8(const uint8_t* s, size_t n,
+                                         const char* delim, size_t dlen) {
     if ((s == NULL) || (delim == NULL)) return SIZE_MAX;
     if (n == 0u) return 0u;
     if (dlen == 0u) return 1u;
@@ -262,7 +262,7 @@ static inline __m128i ascii_range_mask_sse2(__m128i x, __m128i lo, __m128i hi)
     return _mm_and_si128(ge_lo, le_hi);
 }
 
-void simd_ascii_upper_u8(uint8_t* p, size_t n)
+static inline void simd_ascii_upper_u8(uint8_t* p, size_t n)
 {
     if ((p == NULL) || (n == 0u)) return;
 
@@ -288,7 +288,7 @@ void simd_ascii_upper_u8(uint8_t* p, size_t n)
     }
 }
 
-void simd_ascii_lower_u8(uint8_t* p, size_t n)
+static inline void simd_ascii_lower_u8(uint8_t* p, size_t n)
 {
     if ((p == NULL) || (n == 0u)) return;
 
@@ -80,6 +80,7 @@ static size_t simd_lsearch_double(const double* data,
         if (diff <= tolerance) return i;
     }
     return SIZE_MAX;
+}
 // -------------------------------------------------------------------------------- 
 
 static bool simd_doubles_equal(const double* a,
@@ -164,5 +165,544 @@ static inline error_code_t simd_min_double(const double* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128d x = _mm_loadu_pd(a + i);
+        __m128d y = _mm_loadu_pd(b + i);
+        _mm_storeu_pd(out + i, _mm_add_pd(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128d x = _mm_loadu_pd(a + i);
+        __m128d y = _mm_loadu_pd(b + i);
+        _mm_storeu_pd(out + i, _mm_sub_pd(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128d x = _mm_loadu_pd(a + i);
+        __m128d y = _mm_loadu_pd(b + i);
+        _mm_storeu_pd(out + i, _mm_mul_pd(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_div_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128d x = _mm_loadu_pd(a + i);
+        __m128d y = _mm_loadu_pd(b + i);
+        _mm_storeu_pd(out + i, _mm_div_pd(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] / b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_double(double*       out,
+                               const double* a,
+                               double        mul,
+                               double        add,
+                               size_t        len) {
+    __m128d const vmul = _mm_set1_pd(mul);
+    __m128d const vadd = _mm_set1_pd(add);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128d x = _mm_loadu_pd(a + i);
+        _mm_storeu_pd(out + i, _mm_add_pd(_mm_mul_pd(x, vmul), vadd));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_double(double*       out,
+                              const double* a,
+                              double        lo,
+                              double        hi,
+                              size_t        len) {
+    /* min/max return their second operand when either is NaN, so NaN
+     * inputs pass through unchanged */
+    __m128d const vlo = _mm_set1_pd(lo);
+    __m128d const vhi = _mm_set1_pd(hi);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128d x = _mm_loadu_pd(a + i);
+        _mm_storeu_pd(out + i, _mm_max_pd(vlo, _mm_min_pd(vhi, x)));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_double(double*       out,
+                            const double* a,
+                            size_t        len) {
+    __m128d const mask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128d x = _mm_loadu_pd(a + i);
+        _mm_storeu_pd(out + i, _mm_and_pd(x, mask));
+    }
+    for (; i < len; i++)
+        out[i] = fabs(a[i]);
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_double(const double* data,
+                                    size_t        len,
+                                    double*       out) {
+    double cur = *out;   /* caller seeds with -INFINITY */
+    size_t i   = 0u;
+
+    __m128d vmax = _mm_set1_pd(cur);
+    __m128d nan  = _mm_setzero_pd();
+
+    /* _mm_max_pd drops a NaN operand, so NaN lanes are tracked apart */
+    for (; i + 2u <= len; i += 2u) {
+        __m128d x = _mm_loadu_pd(data + i);
+        nan  = _mm_or_pd(nan, _mm_cmpunord_pd(x, x));
+        vmax = _mm_max_pd(vmax, x);
+    }
+    if (_mm_movemask_pd(nan)) { *out = NAN; return NO_ERROR; }
+
+    double lanes[2];
+    _mm_storeu_pd(lanes, vmax);
+    for (size_t k = 0u; k < 2u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++) {
+        if (isnan(data[i])) { *out = NAN; return NO_ERROR; }
+        if (data[i] > cur) cur = data[i];
+    }
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static double simd_sum_double(const double* data,
+                              size_t        len) {
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+    size_t  i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 4u <= len; i += 4u) {
+        acc0 = _mm_add_pd(acc0, _mm_loadu_pd(data + i));
+        acc1 = _mm_add_pd(acc1, _mm_loadu_pd(data + i + 2u));
+    }
+    acc0 = _mm_add_pd(acc0, acc1);
+    if (i + 2u <= len) {
+        acc0 = _mm_add_pd(acc0, _mm_loadu_pd(data + i));
+        i   += 2u;
+    }
+
+    double lanes[2];
+    _mm_storeu_pd(lanes, acc0);
+    double sum = 0.0;
+    for (size_t k = 0u; k < 2u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static double simd_asum_double(const double* data,
+                               size_t        len) {
+    __m128d const mask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+    size_t  i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 4u <= len; i += 4u) {
+        acc0 = _mm_add_pd(acc0, _mm_and_pd(_mm_loadu_pd(data + i), mask));
+        acc1 = _mm_add_pd(acc1, _mm_and_pd(_mm_loadu_pd(data + i + 2u), mask));
+    }
+    acc0 = _mm_add_pd(acc0, acc1);
+    if (i + 2u <= len) {
+        acc0 = _mm_add_pd(acc0, _mm_and_pd(_mm_loadu_pd(data + i), mask));
+        i   += 2u;
+    }
+
+    double lanes[2];
+    _mm_storeu_pd(lanes, acc0);
+    double sum = 0.0;
+    for (size_t k = 0u; k < 2u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += fabs(data[i]);
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static double simd_dot_double(const double* a,
+                              const double* b,
+                              size_t        len) {
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+    size_t  i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 4u <= len; i += 4u) {
+        acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+        acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(a + i + 2u), _mm_loadu_pd(b + i + 2u)));
+    }
+    acc0 = _mm_add_pd(acc0, acc1);
+    if (i + 2u <= len) {
+        acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+        i   += 2u;
+    }
+
+    double lanes[2];
+    _mm_storeu_pd(lanes, acc0);
+    double sum = 0.0;
+    for (size_t k = 0u; k < 2u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_double(double*       out,
+                                const double* a,
+                                const double* b,
+                                size_t        len) {
+    /* min(y, x) returns x when either lane is NaN; NaN lanes of y are
+     * patched back in so NaN propagates from both operands */
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128d x = _mm_loadu_pd(a + i);
+        __m128d y = _mm_loadu_pd(b + i);
+        __m128d r = _mm_min_pd(y, x);
+        __m128d u = _mm_cmpunord_pd(y, y);
+        _mm_storeu_pd(out + i, _mm_or_pd(_mm_and_pd(u, y), _mm_andnot_pd(u, r)));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_double(double*       out,
+                                const double* a,
+                                const double* b,
+                                size_t        len) {
+    /* max(y, x) returns x when either lane is NaN; NaN lanes of y are
+     * patched back in so NaN propagates from both operands */
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128d x = _mm_loadu_pd(a + i);
+        __m128d y = _mm_loadu_pd(b + i);
+        __m128d r = _mm_max_pd(y, x);
+        __m128d u = _mm_cmpunord_pd(y, y);
+        _mm_storeu_pd(out + i, _mm_or_pd(_mm_and_pd(u, y), _mm_andnot_pd(u, r)));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 2 lanes of x */
+static inline __m128d _sse2_scan_pd(__m128d x) {
+    x = _mm_add_pd(x, _mm_castsi128_pd(_mm_slli_si128(_mm_castpd_si128(x), 8)));
+    return x;
+}
+// --------------------------------------------------------------------------------
+
+/* x moved up one lane, with zero in lane 0 */
+static inline __m128d _sse2_shl1_pd(__m128d x) {
+    return _mm_castsi128_pd(_mm_slli_si128(_mm_castpd_si128(x), 8));
+}
+// --------------------------------------------------------------------------------
+
+static double simd_scan_double(double*       out,
+                               const double* a,
+                               size_t        len,
+                               double        carry,
+                               bool          exclusive) {
+    /* cv holds the running total in every lane */
+    __m128d cv = _mm_set1_pd(carry);
+    size_t i = 0u;
+    for (; i + 2u <= len; i += 2u) {
+        __m128d const x = _mm_loadu_pd(a + i);
+        __m128d const p = _sse2_scan_pd(x);
+        __m128d const r = _mm_add_pd(p, cv);
+        __m128d const y = exclusive ? _mm_add_pd(_sse2_shl1_pd(p), cv) : r;
+        _mm_storeu_pd(out + i, y);
+        cv = _mm_unpackhi_pd(r, r);
+    }
+    carry = _mm_cvtsd_f64(cv);
+    for (; i < len; i++) {
+        double const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
+// MATRIX KERNELS
+
+/* y[i] += alpha * x[i] */
+static void simd_axpy_double(double*       y,
+                             const double* x,
+                             double        alpha,
+                             size_t        len) {
+    __m128d const av = _mm_set1_pd(alpha);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        _mm_storeu_pd(y + i,      _mm_add_pd(_mm_loadu_pd(y + i), _mm_mul_pd(av, _mm_loadu_pd(x + i))));
+        _mm_storeu_pd(y + i + 2u, _mm_add_pd(_mm_loadu_pd(y + i + 2u), _mm_mul_pd(av, _mm_loadu_pd(x + i + 2u))));
+    }
+    for (; i + 2u <= len; i += 2u)
+        _mm_storeu_pd(y + i, _mm_add_pd(_mm_loadu_pd(y + i), _mm_mul_pd(av, _mm_loadu_pd(x + i))));
+    for (; i < len; i++)
+        y[i] += alpha * x[i];
+}
+// --------------------------------------------------------------------------------
+
+/* C[0..4)[0..n) += A[0..4)[0..k) * B[0..k)[0..n), all row-major with leading
+ * dimensions ldc, lda and ldb.  Each 4-column strip keeps its
+ * 4 x 4 block of C in eight registers for the whole k loop */
+static void simd_gemm4_double(double*       c,
+                              size_t        ldc,
+                              const double* a,
+                              size_t        lda,
+                              const double* b,
+                              size_t        ldb,
+                              size_t        k,
+                              size_t        n) {
+    size_t j = 0u;
+    for (; j + 4u <= n; j += 4u) {
+        __m128d c00 = _mm_loadu_pd(c + j), c01 = _mm_loadu_pd(c + j + 2u);
+        __m128d c10 = _mm_loadu_pd(c + ldc + j), c11 = _mm_loadu_pd(c + ldc + j + 2u);
+        __m128d c20 = _mm_loadu_pd(c + 2u * ldc + j), c21 = _mm_loadu_pd(c + 2u * ldc + j + 2u);
+        __m128d c30 = _mm_loadu_pd(c + 3u * ldc + j), c31 = _mm_loadu_pd(c + 3u * ldc + j + 2u);
+        const double* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            __m128d const b0 = _mm_loadu_pd(bp);
+            __m128d const b1 = _mm_loadu_pd(bp + 2u);
+            __m128d av = _mm_set1_pd(a[p]);
+            c00 = _mm_add_pd(c00, _mm_mul_pd(av, b0));
+            c01 = _mm_add_pd(c01, _mm_mul_pd(av, b1));
+            av  = _mm_set1_pd(a[lda + p]);
+            c10 = _mm_add_pd(c10, _mm_mul_pd(av, b0));
+            c11 = _mm_add_pd(c11, _mm_mul_pd(av, b1));
+            av  = _mm_set1_pd(a[2u * lda + p]);
+            c20 = _mm_add_pd(c20, _mm_mul_pd(av, b0));
+            c21 = _mm_add_pd(c21, _mm_mul_pd(av, b1));
+            av  = _mm_set1_pd(a[3u * lda + p]);
+            c30 = _mm_add_pd(c30, _mm_mul_pd(av, b0));
+            c31 = _mm_add_pd(c31, _mm_mul_pd(av, b1));
+        }
+        _mm_storeu_pd(c + j, c00); _mm_storeu_pd(c + j + 2u, c01);
+        _mm_storeu_pd(c + ldc + j, c10); _mm_storeu_pd(c + ldc + j + 2u, c11);
+        _mm_storeu_pd(c + 2u * ldc + j, c20); _mm_storeu_pd(c + 2u * ldc + j + 2u, c21);
+        _mm_storeu_pd(c + 3u * ldc + j, c30); _mm_storeu_pd(c + 3u * ldc + j + 2u, c31);
+    }
+    for (; j + 2u <= n; j += 2u) {
+        __m128d c0 = _mm_loadu_pd(c + j), c1 = _mm_loadu_pd(c + ldc + j);
+        __m128d c2 = _mm_loadu_pd(c + 2u * ldc + j), c3 = _mm_loadu_pd(c + 3u * ldc + j);
+        const double* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            __m128d const bv = _mm_loadu_pd(bp);
+            c0 = _mm_add_pd(c0, _mm_mul_pd(_mm_set1_pd(a[p]), bv));
+            c1 = _mm_add_pd(c1, _mm_mul_pd(_mm_set1_pd(a[lda + p]), bv));
+            c2 = _mm_add_pd(c2, _mm_mul_pd(_mm_set1_pd(a[2u * lda + p]), bv));
+            c3 = _mm_add_pd(c3, _mm_mul_pd(_mm_set1_pd(a[3u * lda + p]), bv));
+        }
+        _mm_storeu_pd(c + j, c0); _mm_storeu_pd(c + ldc + j, c1);
+        _mm_storeu_pd(c + 2u * ldc + j, c2); _mm_storeu_pd(c + 3u * ldc + j, c3);
+    }
+    for (; j < n; j++) {
+        double s0 = c[j], s1 = c[ldc + j], s2 = c[2u * ldc + j], s3 = c[3u * ldc + j];
+        const double* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            s0 += a[p]            * *bp;
+            s1 += a[lda + p]      * *bp;
+            s2 += a[2u * lda + p] * *bp;
+            s3 += a[3u * lda + p] * *bp;
+        }
+        c[j] = s0; c[ldc + j] = s1; c[2u * ldc + j] = s2; c[3u * ldc + j] = s3;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* sum of val[i] * x[idx[i]]: the sparse row (or column) dot product.
+ * This tier has no gather instruction, so the x operands are assembled
+ * lane by lane */
+static double simd_spdot_double(const double* val,
+                                const size_t* idx,
+                                const double* x,
+                                size_t        len) {
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(val + i),      _mm_set_pd(x[idx[i + 1u]], x[idx[i]])));
+        acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(val + i + 2u), _mm_set_pd(x[idx[i + 3u]], x[idx[i + 2u]])));
+    }
+    acc0 = _mm_add_pd(acc0, acc1);
+
+    double lanes[2];
+    _mm_storeu_pd(lanes, acc0);
+    double sum = 0.0;
+    for (size_t w = 0u; w < 2u; w++) sum += lanes[w];
+    for (; i < len; i++)
+        sum += val[i] * x[idx[i]];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+/* dst[j * ldd + i] = src[i * lds + j] for i < rows, j < cols: one cache
+ * tile of a matrix transpose.  2 x 2 blocks are transposed in registers with
+ * unpacklo / unpackhi. */
+static void simd_transpose_double(double*       dst,
+                                  size_t        ldd,
+                                  const double* src,
+                                  size_t        lds,
+                                  size_t        rows,
+                                  size_t        cols) {
+    size_t i = 0u;
+    for (; i + 2u <= rows; i += 2u) {
+        size_t j = 0u;
+        for (; j + 2u <= cols; j += 2u) {
+            const double* s = src + i * lds + j;
+            double*       d = dst + j * ldd + i;
+            __m128d const r0 = _mm_loadu_pd(s);
+            __m128d const r1 = _mm_loadu_pd(s + lds);
+            _mm_storeu_pd(d,       _mm_unpacklo_pd(r0, r1));
+            _mm_storeu_pd(d + ldd, _mm_unpackhi_pd(r0, r1));
+        }
+        for (; j < cols; j++)
+            for (size_t q = 0u; q < 2u; q++)
+                dst[j * ldd + i + q] = src[(i + q) * lds + j];
+    }
+    for (; i < rows; i++)
+        for (size_t j = 0u; j < cols; j++)
+            dst[j * ldd + i] = src[i * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* The same transpose for one band of 8 source rows: dst[j * ldd + q] =
+ * src[q * lds + j] for q < 8, j < cols.  Four 2 x 2 blocks stacked in the
+ * band fill a whole 64-byte destination line, which goes out with
+ * non-temporal stores so the destination is never read into the cache.
+ * dst must be 64-byte aligned and ldd a multiple of 8; the band ends with
+ * a fence. */
+static void simd_transpose_stream_double(double*       dst,
+                                         size_t        ldd,
+                                         const double* src,
+                                         size_t        lds,
+                                         size_t        cols) {
+    size_t j = 0u;
+    for (; j + 2u <= cols; j += 2u) {
+        double* d = dst + j * ldd;
+        for (size_t h = 0u; h < 8u; h += 2u) {
+            __m128d const r0 = _mm_loadu_pd(src + h * lds + j);
+            __m128d const r1 = _mm_loadu_pd(src + (h + 1u) * lds + j);
+            _mm_stream_pd(d + h,       _mm_unpacklo_pd(r0, r1));
+            _mm_stream_pd(d + ldd + h, _mm_unpackhi_pd(r0, r1));
+        }
+    }
+    _mm_sfence();
+    for (; j < cols; j++)
+        for (size_t q = 0u; q < 8u; q++)
+            dst[j * ldd + q] = src[q * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* y[r] += sum over blocks b < nb of row r of block b dotted with
+ * x + col[b] * bc, for r < rows: one block row of a BSR SpMV.  Blocks are
+ * br x bc, row-major and packed back to back.  Block rows are dotted 2
+ * lanes at a time with one horizontal sum per output row. */
+static void simd_bsr_double(double*       y,
+                            const double* val,
+                            const size_t* col,
+                            const double* x,
+                            size_t        nb,
+                            size_t        rows,
+                            size_t        br,
+                            size_t        bc) {
+    for (size_t r = 0u; r < rows; r++) {
+        __m128d acc0 = _mm_setzero_pd();
+        double s = 0.0;
+        for (size_t b = 0u; b < nb; b++) {
+            const double* a  = val + (b * br + r) * bc;
+            const double* xb = x + col[b] * bc;
+            size_t k = 0u;
+            for (; k + 2u <= bc; k += 2u)
+                acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(a + k), _mm_loadu_pd(xb + k)));
+            for (; k < bc; k++) s += a[k] * xb[k];
+        }
+        double lanes[2];
+        _mm_storeu_pd(lanes, acc0);
+        for (size_t w = 0u; w < 2u; w++) s += lanes[w];
+        y[r] += s;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* y[i] = sum over j < width of val[j * chunk + i] * x[idx[j * chunk + i]]
+ * for i < chunk: one slice of a SELL-C-sigma SpMV.  The slice is stored
+ * column by column, so consecutive lanes hold consecutive rows.  2 rows
+ * per register; x is gathered with scalar loads, since SSE has no gather. */
+static void simd_sell_double(double*       y,
+                             const double* val,
+                             const size_t* idx,
+                             const double* x,
+                             size_t        chunk,
+                             size_t        width) {
+    size_t i = 0u;
+    for (; i + 2u <= chunk; i += 2u) {
+        __m128d acc = _mm_setzero_pd();
+        for (size_t j = 0u; j < width; j++) {
+            const double* v = val + j * chunk + i;
+            const size_t* c = idx + j * chunk + i;
+            acc = _mm_add_pd(acc, _mm_mul_pd(_mm_loadu_pd(v), _mm_set_pd(x[c[1]], x[c[0]])));
+        }
+        _mm_storeu_pd(y + i, acc);
+    }
+    for (; i < chunk; i++) {
+        double s = 0.0;
+        for (size_t j = 0u; j < width; j++)
+            s += val[j * chunk + i] * x[idx[j * chunk + i]];
+        y[i] = s;
+    }
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SSE2_DOUBLE_INL */
 
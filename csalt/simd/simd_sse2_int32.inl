@@ -69,6 +69,133 @@ static inline error_code_t simd_min_int32(const int32_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int32(int32_t*       out,
+                             const int32_t* a,
+                             int32_t        lo,
+                             int32_t        hi,
+                             size_t         len) {
+    __m128i const vlo = _mm_set1_epi32((int)lo);
+    __m128i const vhi = _mm_set1_epi32((int)hi);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i m = _mm_cmpgt_epi32(x, vhi);
+        x = _mm_or_si128(_mm_and_si128(m, vhi), _mm_andnot_si128(m, x));
+        m = _mm_cmpgt_epi32(vlo, x);
+        x = _mm_or_si128(_mm_and_si128(m, vlo), _mm_andnot_si128(m, x));
+        _mm_storeu_si128((__m128i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int32(int32_t*       out,
+                           const int32_t* a,
+                           size_t         len) {
+    /* |x| = (x ^ m) - m with m the sign mask of each lane */
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i m = _mm_srai_epi32(x, 31);
+        x = _mm_sub_epi32(_mm_xor_si128(x, m), m);
+        _mm_storeu_si128((__m128i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (int32_t)(a[i] < 0 ? 0u - (uint32_t)a[i] : (uint32_t)a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int32(const int32_t* data,
+                                   size_t         len,
+                                   int32_t*       out) {
+    int32_t cur = *out;   /* caller seeds with INT32_MIN */
+    size_t  i   = 0u;
+
+    __m128i vmax = _mm_set1_epi32((int)cur);
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i m = _mm_cmpgt_epi32(x, vmax);
+        vmax = _mm_or_si128(_mm_and_si128(m, x), _mm_andnot_si128(m, vmax));
+    }
+
+    int32_t lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, vmax);
+    for (size_t k = 0u; k < 4u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int32(const int32_t* data,
+                              size_t         len) {
+    __m128i const zero = _mm_setzero_si128();
+    __m128i acc        = zero;
+    size_t  i          = 0u;
+
+    /* Widen each 32-bit lane to 64 bits before accumulating */
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i s = _mm_srai_epi32(x, 31);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(x, s));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(x, s));
+    }
+
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    int64_t sum = 0;
+    for (size_t k = 0u; k < 2u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int32(int32_t*       out,
+                               const int32_t* a,
+                               const int32_t* b,
+                               size_t         len) {
+    /* m marks lanes with x > y */
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i m = _mm_cmpgt_epi32(x, y);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_or_si128(_mm_and_si128(m, y), _mm_andnot_si128(m, x)));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int32(int32_t*       out,
+                               const int32_t* a,
+                               const int32_t* b,
+                               size_t         len) {
+    /* m marks lanes with x > y */
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i m = _mm_cmpgt_epi32(x, y);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_or_si128(_mm_and_si128(m, x), _mm_andnot_si128(m, y)));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_SSE2_MIN_INT32_INL */
 // ================================================================================
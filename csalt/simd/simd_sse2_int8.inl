@@ -70,6 +70,133 @@ static inline error_code_t simd_min_int8(const int8_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int8(int8_t*       out,
+                            const int8_t* a,
+                            int8_t        lo,
+                            int8_t        hi,
+                            size_t        len) {
+    __m128i const vlo = _mm_set1_epi8((char)lo);
+    __m128i const vhi = _mm_set1_epi8((char)hi);
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i m = _mm_cmpgt_epi8(x, vhi);
+        x = _mm_or_si128(_mm_and_si128(m, vhi), _mm_andnot_si128(m, x));
+        m = _mm_cmpgt_epi8(vlo, x);
+        x = _mm_or_si128(_mm_and_si128(m, vlo), _mm_andnot_si128(m, x));
+        _mm_storeu_si128((__m128i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int8(int8_t*       out,
+                          const int8_t* a,
+                          size_t        len) {
+    /* |x| = (x ^ m) - m with m the sign mask of each lane */
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i m = _mm_cmpgt_epi8(_mm_setzero_si128(), x);
+        x = _mm_sub_epi8(_mm_xor_si128(x, m), m);
+        _mm_storeu_si128((__m128i*)(out + i), x);
+    }
+    for (; i < len; i++)
+        out[i] = (int8_t)(a[i] < 0 ? -a[i] : a[i]);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int8(const int8_t* data,
+                                  size_t        len,
+                                  int8_t*       out) {
+    int8_t cur = *out;   /* caller seeds with INT8_MIN */
+    size_t i   = 0u;
+
+    __m128i vmax = _mm_set1_epi8((char)cur);
+    for (; i + 16u <= len; i += 16u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i m = _mm_cmpgt_epi8(x, vmax);
+        vmax = _mm_or_si128(_mm_and_si128(m, x), _mm_andnot_si128(m, vmax));
+    }
+
+    int8_t lanes[16];
+    _mm_storeu_si128((__m128i*)lanes, vmax);
+    for (size_t k = 0u; k < 16u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int8(const int8_t* data,
+                             size_t        len) {
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const bias = _mm_set1_epi8((char)0x80);
+    __m128i acc        = zero;
+    size_t  i          = 0u;
+
+    /* Bias each byte into 0..255 so SAD can sum it, then take 128 back
+     * off for every biased byte */
+    for (; i + 16u <= len; i += 16u) {
+        __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(data + i)), bias);
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(x, zero));
+    }
+
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    int64_t sum = 0 - 128 * (int64_t)i;
+    for (size_t k = 0u; k < 2u; k++) sum += (int64_t)lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return (int64_t)sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int8(int8_t*       out,
+                              const int8_t* a,
+                              const int8_t* b,
+                              size_t        len) {
+    /* m marks lanes with x > y */
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i m = _mm_cmpgt_epi8(x, y);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_or_si128(_mm_and_si128(m, y), _mm_andnot_si128(m, x)));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int8(int8_t*       out,
+                              const int8_t* a,
+                              const int8_t* b,
+                              size_t        len) {
+    /* m marks lanes with x > y */
+    size_t i = 0u;
+    for (; i + 16u <= len; i += 16u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i m = _mm_cmpgt_epi8(x, y);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_or_si128(_mm_and_si128(m, x), _mm_andnot_si128(m, y)));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
 
 #endif /* SIMD_SSE2_MIN_INT8_INL */
 // ================================================================================
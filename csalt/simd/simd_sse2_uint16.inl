@@ -31,6 +31,7 @@
 #include <emmintrin.h>   /* SSE2 */
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -122,5 +123,218 @@ static inline error_code_t simd_min_uint16(const uint16_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_add_epi16(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint16_t)(a[i] + b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_sub_epi16(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint16_t)(a[i] - b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_mullo_epi16(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = (uint16_t)((uint32_t)a[i] * b[i]);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint16(uint16_t*       out,
+                               const uint16_t* a,
+                               uint16_t        mul,
+                               uint16_t        add,
+                               size_t          len) {
+    __m128i const vmul = _mm_set1_epi16((short)mul);
+    __m128i const vadd = _mm_set1_epi16((short)add);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        x = _mm_mullo_epi16(x, vmul);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_add_epi16(x, vadd));
+    }
+    for (; i < len; i++)
+        out[i] = (uint16_t)((uint32_t)a[i] * mul + add);
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint16(uint16_t*       out,
+                              const uint16_t* a,
+                              uint16_t        lo,
+                              uint16_t        hi,
+                              size_t          len) {
+    /* No unsigned 16-bit min/max before SSE4.1: saturating subtraction
+     * gives x - max(x - hi, 0) and lo + max(x - lo, 0) */
+    __m128i const vlo = _mm_set1_epi16((short)lo);
+    __m128i const vhi = _mm_set1_epi16((short)hi);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        x = _mm_sub_epi16(x, _mm_subs_epu16(x, vhi));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_add_epi16(vlo, _mm_subs_epu16(x, vlo)));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint16(const uint16_t* data,
+                                    size_t          len,
+                                    uint16_t*       out) {
+    uint16_t cur = *out;   /* caller seeds with 0 */
+    size_t   i   = 0u;
+
+    __m128i vmax = _mm_set1_epi16((short)cur);
+    /* max(a, b) = (a -sat b) + b: no unsigned 16-bit max before SSE4.1 */
+    for (; i + 8u <= len; i += 8u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(data + i));
+        vmax = _mm_add_epi16(_mm_subs_epu16(x, vmax), vmax);
+    }
+
+    uint16_t lanes[8];
+    _mm_storeu_si128((__m128i*)lanes, vmax);
+    for (size_t k = 0u; k < 8u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++)
+        if (data[i] > cur) cur = data[i];
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint16(const uint16_t* data,
+                                size_t          len) {
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const bias = _mm_set1_epi16((short)0x8000);
+    __m128i const ones = _mm_set1_epi16(1);
+    __m128i acc        = zero;
+    size_t  i          = 0u;
+
+    /* Bias into signed range so madd can sum 16-bit pairs into 32-bit
+     * lanes; 32768 per element is added back at the end */
+    for (; i + 8u <= len; i += 8u) {
+        __m128i x = _mm_madd_epi16(_mm_xor_si128(_mm_loadu_si128((const __m128i*)(data + i)), bias), ones);
+        __m128i s = _mm_srai_epi32(x, 31);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(x, s));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(x, s));
+    }
+
+    uint64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    int64_t sum = 0 + 32768 * (int64_t)i;
+    for (size_t k = 0u; k < 2u; k++) sum += (int64_t)lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return (uint64_t)sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint16(uint16_t*       out,
+                                const uint16_t* a,
+                                const uint16_t* b,
+                                size_t          len) {
+    /* No unsigned 16-bit min/max before SSE4.1: saturating subtraction
+     * gives x - max(x - y, 0) */
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_sub_epi16(x, _mm_subs_epu16(x, y)));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint16(uint16_t*       out,
+                                const uint16_t* a,
+                                const uint16_t* b,
+                                size_t          len) {
+    /* No unsigned 16-bit min/max before SSE4.1: saturating subtraction
+     * gives y + max(x - y, 0) */
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_add_epi16(y, _mm_subs_epu16(x, y)));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i]) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 8 lanes of x */
+static inline __m128i _sse2_scan_epi16(__m128i x) {
+    x = _mm_add_epi16(x, _mm_slli_si128(x, 2));
+    x = _mm_add_epi16(x, _mm_slli_si128(x, 4));
+    x = _mm_add_epi16(x, _mm_slli_si128(x, 8));
+    return x;
+}
+// --------------------------------------------------------------------------------
+
+static uint16_t simd_scan_uint16(uint16_t*       out,
+                                 const uint16_t* a,
+                                 size_t          len,
+                                 uint16_t        carry,
+                                 bool            exclusive) {
+    /* cv holds the running total in every lane; the exclusive sums are
+     * r - x, which is exact under wrapping arithmetic */
+    __m128i cv = _mm_set1_epi16((short)carry);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        __m128i const x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i const p = _sse2_scan_epi16(x);
+        __m128i const r = _mm_add_epi16(p, cv);
+        __m128i const y = exclusive ? _mm_sub_epi16(r, x) : r;
+        _mm_storeu_si128((__m128i*)(out + i), y);
+        __m128i const h = _mm_shufflehi_epi16(r, 0xFF);
+        cv = _mm_unpackhi_epi64(h, h);
+    }
+    carry = (uint16_t)_mm_cvtsi128_si32(cv);
+    for (; i < len; i++) {
+        uint16_t const prev = carry;
+        carry = (uint16_t)(carry + a[i]);
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SSE2_UINT16_INL */
 
@@ -162,5 +162,560 @@ static inline error_code_t simd_min_float(const float* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128 x = _mm_loadu_ps(a + i);
+        __m128 y = _mm_loadu_ps(b + i);
+        _mm_storeu_ps(out + i, _mm_add_ps(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] + b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128 x = _mm_loadu_ps(a + i);
+        __m128 y = _mm_loadu_ps(b + i);
+        _mm_storeu_ps(out + i, _mm_sub_ps(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] - b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128 x = _mm_loadu_ps(a + i);
+        __m128 y = _mm_loadu_ps(b + i);
+        _mm_storeu_ps(out + i, _mm_mul_ps(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_div_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128 x = _mm_loadu_ps(a + i);
+        __m128 y = _mm_loadu_ps(b + i);
+        _mm_storeu_ps(out + i, _mm_div_ps(x, y));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] / b[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_float(float*       out,
+                              const float* a,
+                              float        mul,
+                              float        add,
+                              size_t       len) {
+    __m128 const vmul = _mm_set1_ps(mul);
+    __m128 const vadd = _mm_set1_ps(add);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128 x = _mm_loadu_ps(a + i);
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(x, vmul), vadd));
+    }
+    for (; i < len; i++)
+        out[i] = a[i] * mul + add;
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_float(float*       out,
+                             const float* a,
+                             float        lo,
+                             float        hi,
+                             size_t       len) {
+    /* min/max return their second operand when either is NaN, so NaN
+     * inputs pass through unchanged */
+    __m128 const vlo = _mm_set1_ps(lo);
+    __m128 const vhi = _mm_set1_ps(hi);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128 x = _mm_loadu_ps(a + i);
+        _mm_storeu_ps(out + i, _mm_max_ps(vlo, _mm_min_ps(vhi, x)));
+    }
+    for (; i < len; i++)
+        out[i] = (a[i] > hi) ? hi : (a[i] < lo) ? lo : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_float(float*       out,
+                           const float* a,
+                           size_t       len) {
+    __m128 const mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128 x = _mm_loadu_ps(a + i);
+        _mm_storeu_ps(out + i, _mm_and_ps(x, mask));
+    }
+    for (; i < len; i++)
+        out[i] = fabsf(a[i]);
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_float(const float* data,
+                                   size_t       len,
+                                   float*       out) {
+    float  cur = *out;   /* caller seeds with -INFINITY */
+    size_t i   = 0u;
+
+    __m128 vmax = _mm_set1_ps(cur);
+    __m128 nan  = _mm_setzero_ps();
+
+    /* _mm_max_ps drops a NaN operand, so NaN lanes are tracked apart */
+    for (; i + 4u <= len; i += 4u) {
+        __m128 x = _mm_loadu_ps(data + i);
+        nan  = _mm_or_ps(nan, _mm_cmpunord_ps(x, x));
+        vmax = _mm_max_ps(vmax, x);
+    }
+    if (_mm_movemask_ps(nan)) { *out = NAN; return NO_ERROR; }
+
+    float lanes[4];
+    _mm_storeu_ps(lanes, vmax);
+    for (size_t k = 0u; k < 4u; k++)
+        if (lanes[k] > cur) cur = lanes[k];
+    for (; i < len; i++) {
+        if (isnan(data[i])) { *out = NAN; return NO_ERROR; }
+        if (data[i] > cur) cur = data[i];
+    }
+    *out = cur;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static float simd_sum_float(const float* data,
+                            size_t       len) {
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    size_t i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 8u <= len; i += 8u) {
+        acc0 = _mm_add_ps(acc0, _mm_loadu_ps(data + i));
+        acc1 = _mm_add_ps(acc1, _mm_loadu_ps(data + i + 4u));
+    }
+    acc0 = _mm_add_ps(acc0, acc1);
+    if (i + 4u <= len) {
+        acc0 = _mm_add_ps(acc0, _mm_loadu_ps(data + i));
+        i   += 4u;
+    }
+
+    float lanes[4];
+    _mm_storeu_ps(lanes, acc0);
+    float sum = 0.0f;
+    for (size_t k = 0u; k < 4u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += data[i];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static float simd_asum_float(const float* data,
+                             size_t       len) {
+    __m128 const mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    size_t i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 8u <= len; i += 8u) {
+        acc0 = _mm_add_ps(acc0, _mm_and_ps(_mm_loadu_ps(data + i), mask));
+        acc1 = _mm_add_ps(acc1, _mm_and_ps(_mm_loadu_ps(data + i + 4u), mask));
+    }
+    acc0 = _mm_add_ps(acc0, acc1);
+    if (i + 4u <= len) {
+        acc0 = _mm_add_ps(acc0, _mm_and_ps(_mm_loadu_ps(data + i), mask));
+        i   += 4u;
+    }
+
+    float lanes[4];
+    _mm_storeu_ps(lanes, acc0);
+    float sum = 0.0f;
+    for (size_t k = 0u; k < 4u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += fabsf(data[i]);
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static float simd_dot_float(const float* a,
+                            const float* b,
+                            size_t       len) {
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    size_t i    = 0u;
+
+    /* Two accumulators hide the add latency */
+    for (; i + 8u <= len; i += 8u) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4u), _mm_loadu_ps(b + i + 4u)));
+    }
+    acc0 = _mm_add_ps(acc0, acc1);
+    if (i + 4u <= len) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        i   += 4u;
+    }
+
+    float lanes[4];
+    _mm_storeu_ps(lanes, acc0);
+    float sum = 0.0f;
+    for (size_t k = 0u; k < 4u; k++) sum += lanes[k];
+    for (; i < len; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_float(float*       out,
+                               const float* a,
+                               const float* b,
+                               size_t       len) {
+    /* min(y, x) returns x when either lane is NaN; NaN lanes of y are
+     * patched back in so NaN propagates from both operands */
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128 x = _mm_loadu_ps(a + i);
+        __m128 y = _mm_loadu_ps(b + i);
+        __m128 r = _mm_min_ps(y, x);
+        __m128 u = _mm_cmpunord_ps(y, y);
+        _mm_storeu_ps(out + i, _mm_or_ps(_mm_and_ps(u, y), _mm_andnot_ps(u, r)));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] < a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_float(float*       out,
+                               const float* a,
+                               const float* b,
+                               size_t       len) {
+    /* max(y, x) returns x when either lane is NaN; NaN lanes of y are
+     * patched back in so NaN propagates from both operands */
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128 x = _mm_loadu_ps(a + i);
+        __m128 y = _mm_loadu_ps(b + i);
+        __m128 r = _mm_max_ps(y, x);
+        __m128 u = _mm_cmpunord_ps(y, y);
+        _mm_storeu_ps(out + i, _mm_or_ps(_mm_and_ps(u, y), _mm_andnot_ps(u, r)));
+    }
+    for (; i < len; i++)
+        out[i] = (b[i] > a[i] || isnan(b[i])) ? b[i] : a[i];
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+/* Inclusive prefix sum of the 4 lanes of x */
+static inline __m128 _sse3_scan_ps(__m128 x) {
+    x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)));
+    x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 8)));
+    return x;
+}
+// --------------------------------------------------------------------------------
+
+/* x moved up one lane, with zero in lane 0 */
+static inline __m128 _sse3_shl1_ps(__m128 x) {
+    return _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4));
+}
+// --------------------------------------------------------------------------------
+
+static float simd_scan_float(float*       out,
+                             const float* a,
+                             size_t       len,
+                             float        carry,
+                             bool         exclusive) {
+    /* cv holds the running total in every lane */
+    __m128 cv = _mm_set1_ps(carry);
+    size_t i = 0u;
+    for (; i + 4u <= len; i += 4u) {
+        __m128 const x = _mm_loadu_ps(a + i);
+        __m128 const p = _sse3_scan_ps(x);
+        __m128 const r = _mm_add_ps(p, cv);
+        __m128 const y = exclusive ? _mm_add_ps(_sse3_shl1_ps(p), cv) : r;
+        _mm_storeu_ps(out + i, y);
+        cv = _mm_shuffle_ps(r, r, 0xFF);
+    }
+    carry = _mm_cvtss_f32(cv);
+    for (; i < len; i++) {
+        float const prev = carry;
+        carry = carry + a[i];
+        out[i] = exclusive ? prev : carry;
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
+// MATRIX KERNELS
+
+/* y[i] += alpha * x[i] */
+static void simd_axpy_float(float*       y,
+                            const float* x,
+                            float        alpha,
+                            size_t       len) {
+    __m128 const av = _mm_set1_ps(alpha);
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        _mm_storeu_ps(y + i,      _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(av, _mm_loadu_ps(x + i))));
+        _mm_storeu_ps(y + i + 4u, _mm_add_ps(_mm_loadu_ps(y + i + 4u), _mm_mul_ps(av, _mm_loadu_ps(x + i + 4u))));
+    }
+    for (; i + 4u <= len; i += 4u)
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(av, _mm_loadu_ps(x + i))));
+    for (; i < len; i++)
+        y[i] += alpha * x[i];
+}
+// --------------------------------------------------------------------------------
+
+/* C[0..4)[0..n) += A[0..4)[0..k) * B[0..k)[0..n), all row-major with leading
+ * dimensions ldc, lda and ldb.  Each 8-column strip keeps its
+ * 4 x 8 block of C in eight registers for the whole k loop */
+static void simd_gemm4_float(float*       c,
+                             size_t       ldc,
+                             const float* a,
+                             size_t       lda,
+                             const float* b,
+                             size_t       ldb,
+                             size_t       k,
+                             size_t       n) {
+    size_t j = 0u;
+    for (; j + 8u <= n; j += 8u) {
+        __m128 c00 = _mm_loadu_ps(c + j), c01 = _mm_loadu_ps(c + j + 4u);
+        __m128 c10 = _mm_loadu_ps(c + ldc + j), c11 = _mm_loadu_ps(c + ldc + j + 4u);
+        __m128 c20 = _mm_loadu_ps(c + 2u * ldc + j), c21 = _mm_loadu_ps(c + 2u * ldc + j + 4u);
+        __m128 c30 = _mm_loadu_ps(c + 3u * ldc + j), c31 = _mm_loadu_ps(c + 3u * ldc + j + 4u);
+        const float* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            __m128 const b0 = _mm_loadu_ps(bp);
+            __m128 const b1 = _mm_loadu_ps(bp + 4u);
+            __m128 av = _mm_set1_ps(a[p]);
+            c00 = _mm_add_ps(c00, _mm_mul_ps(av, b0));
+            c01 = _mm_add_ps(c01, _mm_mul_ps(av, b1));
+            av  = _mm_set1_ps(a[lda + p]);
+            c10 = _mm_add_ps(c10, _mm_mul_ps(av, b0));
+            c11 = _mm_add_ps(c11, _mm_mul_ps(av, b1));
+            av  = _mm_set1_ps(a[2u * lda + p]);
+            c20 = _mm_add_ps(c20, _mm_mul_ps(av, b0));
+            c21 = _mm_add_ps(c21, _mm_mul_ps(av, b1));
+            av  = _mm_set1_ps(a[3u * lda + p]);
+            c30 = _mm_add_ps(c30, _mm_mul_ps(av, b0));
+            c31 = _mm_add_ps(c31, _mm_mul_ps(av, b1));
+        }
+        _mm_storeu_ps(c + j, c00); _mm_storeu_ps(c + j + 4u, c01);
+        _mm_storeu_ps(c + ldc + j, c10); _mm_storeu_ps(c + ldc + j + 4u, c11);
+        _mm_storeu_ps(c + 2u * ldc + j, c20); _mm_storeu_ps(c + 2u * ldc + j + 4u, c21);
+        _mm_storeu_ps(c + 3u * ldc + j, c30); _mm_storeu_ps(c + 3u * ldc + j + 4u, c31);
+    }
+    for (; j + 4u <= n; j += 4u) {
+        __m128 c0 = _mm_loadu_ps(c + j), c1 = _mm_loadu_ps(c + ldc + j);
+        __m128 c2 = _mm_loadu_ps(c + 2u * ldc + j), c3 = _mm_loadu_ps(c + 3u * ldc + j);
+        const float* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            __m128 const bv = _mm_loadu_ps(bp);
+            c0 = _mm_add_ps(c0, _mm_mul_ps(_mm_set1_ps(a[p]), bv));
+            c1 = _mm_add_ps(c1, _mm_mul_ps(_mm_set1_ps(a[lda + p]), bv));
+            c2 = _mm_add_ps(c2, _mm_mul_ps(_mm_set1_ps(a[2u * lda + p]), bv));
+            c3 = _mm_add_ps(c3, _mm_mul_ps(_mm_set1_ps(a[3u * lda + p]), bv));
+        }
+        _mm_storeu_ps(c + j, c0); _mm_storeu_ps(c + ldc + j, c1);
+        _mm_storeu_ps(c + 2u * ldc + j, c2); _mm_storeu_ps(c + 3u * ldc + j, c3);
+    }
+    for (; j < n; j++) {
+        float s0 = c[j], s1 = c[ldc + j], s2 = c[2u * ldc + j], s3 = c[3u * ldc + j];
+        const float* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            s0 += a[p]            * *bp;
+            s1 += a[lda + p]      * *bp;
+            s2 += a[2u * lda + p] * *bp;
+            s3 += a[3u * lda + p] * *bp;
+        }
+        c[j] = s0; c[ldc + j] = s1; c[2u * ldc + j] = s2; c[3u * ldc + j] = s3;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* sum of val[i] * x[idx[i]]: the sparse row (or column) dot product.
+ * This tier has no gather instruction, so the x operands are assembled
+ * lane by lane */
+static float simd_spdot_float(const float*  val,
+                              const size_t* idx,
+                              const float*  x,
+                              size_t        len) {
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    size_t i = 0u;
+    for (; i + 8u <= len; i += 8u) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(val + i),      _mm_set_ps(x[idx[i + 3u]], x[idx[i + 2u]], x[idx[i + 1u]], x[idx[i]])));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(val + i + 4u), _mm_set_ps(x[idx[i + 7u]], x[idx[i + 6u]], x[idx[i + 5u]], x[idx[i + 4u]])));
+    }
+    acc0 = _mm_add_ps(acc0, acc1);
+
+    float lanes[4];
+    _mm_storeu_ps(lanes, acc0);
+    float sum = 0.0f;
+    for (size_t w = 0u; w < 4u; w++) sum += lanes[w];
+    for (; i < len; i++)
+        sum += val[i] * x[idx[i]];
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+/* dst[j * ldd + i] = src[i * lds + j] for i < rows, j < cols: one cache
+ * tile of a matrix transpose.  4 x 4 blocks are transposed in registers with
+ * _MM_TRANSPOSE4_PS. */
+static void simd_transpose_float(float*       dst,
+                                 size_t       ldd,
+                                 const float* src,
+                                 size_t       lds,
+                                 size_t       rows,
+                                 size_t       cols) {
+    size_t i = 0u;
+    for (; i + 4u <= rows; i += 4u) {
+        size_t j = 0u;
+        for (; j + 4u <= cols; j += 4u) {
+            const float* s = src + i * lds + j;
+            float*       d = dst + j * ldd + i;
+            __m128 r0 = _mm_loadu_ps(s);
+            __m128 r1 = _mm_loadu_ps(s + lds);
+            __m128 r2 = _mm_loadu_ps(s + 2u * lds);
+            __m128 r3 = _mm_loadu_ps(s + 3u * lds);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(d,            r0);
+            _mm_storeu_ps(d + ldd,      r1);
+            _mm_storeu_ps(d + 2u * ldd, r2);
+            _mm_storeu_ps(d + 3u * ldd, r3);
+        }
+        for (; j < cols; j++)
+            for (size_t q = 0u; q < 4u; q++)
+                dst[j * ldd + i + q] = src[(i + q) * lds + j];
+    }
+    for (; i < rows; i++)
+        for (size_t j = 0u; j < cols; j++)
+            dst[j * ldd + i] = src[i * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* The same transpose for one band of 16 source rows: dst[j * ldd + q] =
+ * src[q * lds + j] for q < 16, j < cols.  Four 4 x 4 blocks stacked in the
+ * band fill a whole 64-byte destination line, which goes out with
+ * non-temporal stores so the destination is never read into the cache.
+ * dst must be 64-byte aligned and ldd a multiple of 16; the band ends with
+ * a fence. */
+static void simd_transpose_stream_float(float*       dst,
+                                        size_t       ldd,
+                                        const float* src,
+                                        size_t       lds,
+                                        size_t       cols) {
+    size_t j = 0u;
+    for (; j + 4u <= cols; j += 4u) {
+        __m128 r[16];
+        for (size_t h = 0u; h < 16u; h += 4u) {
+            const float* s = src + h * lds + j;
+            __m128 r0 = _mm_loadu_ps(s);
+            __m128 r1 = _mm_loadu_ps(s + lds);
+            __m128 r2 = _mm_loadu_ps(s + 2u * lds);
+            __m128 r3 = _mm_loadu_ps(s + 3u * lds);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            r[h]      = r0;
+            r[h + 1u] = r1;
+            r[h + 2u] = r2;
+            r[h + 3u] = r3;
+        }
+        float* d = dst + j * ldd;
+        for (size_t k = 0u; k < 4u; k++)
+            for (size_t h = 0u; h < 16u; h += 4u)
+                _mm_stream_ps(d + k * ldd + h, r[h + k]);
+    }
+    _mm_sfence();
+    for (; j < cols; j++)
+        for (size_t q = 0u; q < 16u; q++)
+            dst[j * ldd + q] = src[q * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* y[r] += sum over blocks b < nb of row r of block b dotted with
+ * x + col[b] * bc, for r < rows: one block row of a BSR SpMV.  Blocks are
+ * br x bc, row-major and packed back to back.  Block rows are dotted 4
+ * lanes at a time with one horizontal sum per output row. */
+static void simd_bsr_float(float*        y,
+                           const float*  val,
+                           const size_t* col,
+                           const float*  x,
+                           size_t        nb,
+                           size_t        rows,
+                           size_t        br,
+                           size_t        bc) {
+    for (size_t r = 0u; r < rows; r++) {
+        __m128 acc0 = _mm_setzero_ps();
+        float s = 0.0f;
+        for (size_t b = 0u; b < nb; b++) {
+            const float* a  = val + (b * br + r) * bc;
+            const float* xb = x + col[b] * bc;
+            size_t k = 0u;
+            for (; k + 4u <= bc; k += 4u)
+                acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + k), _mm_loadu_ps(xb + k)));
+            for (; k < bc; k++) s += a[k] * xb[k];
+        }
+        float lanes[4];
+        _mm_storeu_ps(lanes, acc0);
+        for (size_t w = 0u; w < 4u; w++) s += lanes[w];
+        y[r] += s;
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* y[i] = sum over j < width of val[j * chunk + i] * x[idx[j * chunk + i]]
+ * for i < chunk: one slice of a SELL-C-sigma SpMV.  The slice is stored
+ * column by column, so consecutive lanes hold consecutive rows.  4 rows
+ * per register; x is gathered with scalar loads, since SSE has no gather. */
+static void simd_sell_float(float*        y,
+                            const float*  val,
+                            const size_t* idx,
+                            const float*  x,
+                            size_t        chunk,
+                            size_t        width) {
+    size_t i = 0u;
+    for (; i + 4u <= chunk; i += 4u) {
+        __m128 acc = _mm_setzero_ps();
+        for (size_t j = 0u; j < width; j++) {
+            const float*  v = val + j * chunk + i;
+            const size_t* c = idx + j * chunk + i;
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(v), _mm_set_ps(x[c[3]], x[c[2]], x[c[1]], x[c[0]])));
+        }
+        _mm_storeu_ps(y + i, acc);
+    }
+    for (; i < chunk; i++) {
+        float s = 0.0f;
+        for (size_t j = 0u; j < width; j++)
+            s += val[j * chunk + i] * x[idx[j * chunk + i]];
+        y[i] = s;
+    }
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SSE3_FLOAT_INL */
 
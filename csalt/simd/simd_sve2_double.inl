@@ -28,6 +28,7 @@
 #define CSALT_SIMD_SVE2_DOUBLE_INL
 
 #include <arm_sve.h>
+#include <arm_neon.h>
 #include <stdint.h>
 #include <stddef.h>
 #include <stdbool.h>
@@ -155,5 +156,373 @@ static inline error_code_t simd_min_double(const double* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svfloat64_t x = svld1_f64(pg, a + i);
+        svfloat64_t y = svld1_f64(pg, b + i);
+        svst1_f64(pg, out + i, svadd_f64_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svfloat64_t x = svld1_f64(pg, a + i);
+        svfloat64_t y = svld1_f64(pg, b + i);
+        svst1_f64(pg, out + i, svsub_f64_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svfloat64_t x = svld1_f64(pg, a + i);
+        svfloat64_t y = svld1_f64(pg, b + i);
+        svst1_f64(pg, out + i, svmul_f64_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_div_double(double*       out,
+                            const double* a,
+                            const double* b,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svfloat64_t x = svld1_f64(pg, a + i);
+        svfloat64_t y = svld1_f64(pg, b + i);
+        svst1_f64(pg, out + i, svdiv_f64_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_double(double*       out,
+                               const double* a,
+                               double        mul,
+                               double        add,
+                               size_t        len) {
+    svfloat64_t const vmul = svdup_n_f64(mul);
+    svfloat64_t const vadd = svdup_n_f64(add);
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svfloat64_t x = svld1_f64(pg, a + i);
+        svst1_f64(pg, out + i, svadd_f64_x(pg, svmul_f64_x(pg, x, vmul), vadd));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_double(double*       out,
+                              const double* a,
+                              double        lo,
+                              double        hi,
+                              size_t        len) {
+    svfloat64_t const vlo = svdup_n_f64(lo);
+    svfloat64_t const vhi = svdup_n_f64(hi);
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svfloat64_t x = svld1_f64(pg, a + i);
+        svst1_f64(pg, out + i, svmax_f64_x(pg, svmin_f64_x(pg, x, vhi), vlo));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_double(double*       out,
+                            const double* a,
+                            size_t        len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svfloat64_t x = svld1_f64(pg, a + i);
+        svst1_f64(pg, out + i, svabs_f64_x(pg, x));
+    }
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_double(const double* data,
+                                    size_t        len,
+                                    double*       out) {
+    svfloat64_t vmax = svdup_n_f64(*out);   /* caller seeds with -INFINITY */
+
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        vmax = svmax_f64_m(pg, vmax, svld1_f64(pg, data + i));
+    }
+
+    /* FMAX and FMAXV propagate NaN */
+    double r = svmaxv_f64(svptrue_b64(), vmax);
+    *out = isnan(r) ? NAN : r;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static double simd_sum_double(const double* data,
+                              size_t        len) {
+    svfloat64_t acc = svdup_n_f64(0.0);
+
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        acc = svadd_f64_m(pg, acc, svld1_f64(pg, data + i));
+    }
+    return svaddv_f64(svptrue_b64(), acc);
+}
+// --------------------------------------------------------------------------------
+
+static double simd_asum_double(const double* data,
+                               size_t        len) {
+    svfloat64_t acc = svdup_n_f64(0.0);
+
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        acc = svadd_f64_m(pg, acc, svabs_f64_x(pg, svld1_f64(pg, data + i)));
+    }
+    return svaddv_f64(svptrue_b64(), acc);
+}
+// --------------------------------------------------------------------------------
+
+static double simd_dot_double(const double* a,
+                              const double* b,
+                              size_t        len) {
+    svfloat64_t acc = svdup_n_f64(0.0);
+
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        acc = svmla_f64_m(pg, acc, svld1_f64(pg, a + i), svld1_f64(pg, b + i));
+    }
+    return svaddv_f64(svptrue_b64(), acc);
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_double(double*       out,
+                                const double* a,
+                                const double* b,
+                                size_t        len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svfloat64_t x = svld1_f64(pg, a + i);
+        svfloat64_t y = svld1_f64(pg, b + i);
+        svst1_f64(pg, out + i, svmin_f64_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_double(double*       out,
+                                const double* a,
+                                const double* b,
+                                size_t        len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svfloat64_t x = svld1_f64(pg, a + i);
+        svfloat64_t y = svld1_f64(pg, b + i);
+        svst1_f64(pg, out + i, svmax_f64_x(pg, x, y));
+    }
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static double simd_scan_double(double*       out,
+                               const double* a,
+                               size_t        len,
+                               double        carry,
+                               bool          exclusive) {
+    /* Log-step scan over the whole vector: lanes at index >= k add the
+     * lane k below them, fetched with svtbl.  The vector length is only
+     * known at run time, so the step count is too */
+    svbool_t const all = svptrue_b64();
+    svuint64_t const iota = svindex_u64(0, 1);
+    uint64_t const vl = svcntd();
+    for (size_t i = 0u; i < len; i += vl) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svfloat64_t p = svld1_f64(pg, a + i);
+        for (uint64_t k = 1u; k < vl; k <<= 1) {
+            svbool_t const up = svcmpge_n_u64(all, iota, (uint64_t)k);
+            svuint64_t const src = svsub_n_u64_x(all, iota, (uint64_t)k);
+            p = svadd_f64_m(up, p, svtbl_f64(p, src));
+        }
+        svfloat64_t const cv = svdup_n_f64(carry);
+        svfloat64_t const r  = svadd_f64_x(all, p, cv);
+        svfloat64_t const y  = exclusive ? svadd_f64_x(all, svinsr_n_f64(p, 0), cv) : r;
+        svst1_f64(pg, out + i, y);
+        carry = svlastb_f64(pg, r);
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
+// MATRIX KERNELS
+
+/* y[i] += alpha * x[i] */
+static void simd_axpy_double(double*       y,
+                             const double* x,
+                             double        alpha,
+                             size_t        len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svfloat64_t yv = svld1_f64(pg, y + i);
+        svst1_f64(pg, y + i, svmla_n_f64_x(pg, yv, svld1_f64(pg, x + i), alpha));
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* C[0..4)[0..n) += A[0..4)[0..k) * B[0..k)[0..n), all row-major with leading
+ * dimensions ldc, lda and ldb.  Each vector-length strip of the 4 rows of C
+ * stays in registers for the whole k loop; the last strip is predicated */
+static void simd_gemm4_double(double*       c,
+                              size_t        ldc,
+                              const double* a,
+                              size_t        lda,
+                              const double* b,
+                              size_t        ldb,
+                              size_t        k,
+                              size_t        n) {
+    for (size_t j = 0u; j < n; j += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)j, (uint64_t)n);
+        svfloat64_t c0 = svld1_f64(pg, c + j);
+        svfloat64_t c1 = svld1_f64(pg, c + ldc + j);
+        svfloat64_t c2 = svld1_f64(pg, c + 2u * ldc + j);
+        svfloat64_t c3 = svld1_f64(pg, c + 3u * ldc + j);
+        const double* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            svfloat64_t const bv = svld1_f64(pg, bp);
+            c0 = svmla_n_f64_x(pg, c0, bv, a[p]);
+            c1 = svmla_n_f64_x(pg, c1, bv, a[lda + p]);
+            c2 = svmla_n_f64_x(pg, c2, bv, a[2u * lda + p]);
+            c3 = svmla_n_f64_x(pg, c3, bv, a[3u * lda + p]);
+        }
+        svst1_f64(pg, c + j, c0);
+        svst1_f64(pg, c + ldc + j, c1);
+        svst1_f64(pg, c + 2u * ldc + j, c2);
+        svst1_f64(pg, c + 3u * ldc + j, c3);
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* sum of val[i] * x[idx[i]]: the sparse row (or column) dot product.
+ * The 64-bit indices feed the hardware gather directly */
+static double simd_spdot_double(const double* val,
+                                const size_t* idx,
+                                const double* x,
+                                size_t        len) {
+    svfloat64_t acc = svdup_n_f64(0.0);
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svuint64_t const iv = svld1_u64(pg, (const uint64_t*)(idx + i));
+        acc = svmla_f64_m(pg, acc, svld1_f64(pg, val + i),
+                          svld1_gather_u64index_f64(pg, x, iv));
+    }
+    return svaddv_f64(svptrue_b64(), acc);
+}
+// --------------------------------------------------------------------------------
+
+/* dst[j * ldd + i] = src[i * lds + j] for i < rows, j < cols: one cache
+ * tile of a matrix transpose.  SVE has no fixed block shape, so 2 x 2 blocks
+ * are transposed in the Advanced SIMD registers every SVE core has. */
+static void simd_transpose_double(double*       dst,
+                                  size_t        ldd,
+                                  const double* src,
+                                  size_t        lds,
+                                  size_t        rows,
+                                  size_t        cols) {
+    size_t i = 0u;
+    for (; i + 2u <= rows; i += 2u) {
+        size_t j = 0u;
+        for (; j + 2u <= cols; j += 2u) {
+            const double* s = src + i * lds + j;
+            double*       d = dst + j * ldd + i;
+            float64x2_t const r0 = vld1q_f64(s);
+            float64x2_t const r1 = vld1q_f64(s + lds);
+            vst1q_f64(d,       vtrn1q_f64(r0, r1));
+            vst1q_f64(d + ldd, vtrn2q_f64(r0, r1));
+        }
+        for (; j < cols; j++)
+            for (size_t q = 0u; q < 2u; q++)
+                dst[j * ldd + i + q] = src[(i + q) * lds + j];
+    }
+    for (; i < rows; i++)
+        for (size_t j = 0u; j < cols; j++)
+            dst[j * ldd + i] = src[i * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* The same transpose for one band of 8 source rows, so each destination
+ * row receives one full 64-byte line at a time.  SVE2 has no streaming store worth
+ * using here, so this is the plain tile transpose over the band. */
+static void simd_transpose_stream_double(double*       dst,
+                                         size_t        ldd,
+                                         const double* src,
+                                         size_t        lds,
+                                         size_t        cols) {
+    simd_transpose_double(dst, ldd, src, lds, 8u, cols);
+}
+// --------------------------------------------------------------------------------
+
+/* y[r] += sum over blocks b < nb of row r of block b dotted with
+ * x + col[b] * bc, for r < rows: one block row of a BSR SpMV.  Blocks are
+ * br x bc, row-major and packed back to back.  Block rows are dotted under
+ * a whilelt predicate, so any block width needs no scalar tail. */
+static void simd_bsr_double(double*       y,
+                            const double* val,
+                            const size_t* col,
+                            const double* x,
+                            size_t        nb,
+                            size_t        rows,
+                            size_t        br,
+                            size_t        bc) {
+    for (size_t r = 0u; r < rows; r++) {
+        svfloat64_t acc = svdup_n_f64(0.0);
+        for (size_t b = 0u; b < nb; b++) {
+            const double* a  = val + (b * br + r) * bc;
+            const double* xb = x + col[b] * bc;
+            for (size_t k = 0u; k < bc; k += svcntd()) {
+                svbool_t pg = svwhilelt_b64((uint64_t)k, (uint64_t)bc);
+                acc = svmla_f64_m(pg, acc, svld1_f64(pg, a + k), svld1_f64(pg, xb + k));
+            }
+        }
+        y[r] += svaddv_f64(svptrue_b64(), acc);
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* y[i] = sum over j < width of val[j * chunk + i] * x[idx[j * chunk + i]]
+ * for i < chunk: one slice of a SELL-C-sigma SpMV.  The slice is stored
+ * column by column, so consecutive lanes hold consecutive rows.  Rows go
+ * one vector length at a time under a whilelt predicate, x gathered with
+ * SVE gather loads. */
+static void simd_sell_double(double*       y,
+                             const double* val,
+                             const size_t* idx,
+                             const double* x,
+                             size_t        chunk,
+                             size_t        width) {
+    for (size_t i = 0u; i < chunk; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)chunk);
+        svfloat64_t acc = svdup_n_f64(0.0);
+        for (size_t j = 0u; j < width; j++) {
+            svuint64_t const iv = svld1_u64(pg, (const uint64_t*)(idx + j * chunk + i));
+            acc = svmla_f64_m(pg, acc, svld1_f64(pg, val + j * chunk + i),
+                              svld1_gather_u64index_f64(pg, x, iv));
+        }
+        svst1_f64(pg, y + i, acc);
+    }
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SVE2_DOUBLE_INL */
 
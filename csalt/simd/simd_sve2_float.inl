@@ -30,8 +30,10 @@
 #include "c_error.h"
 
 #include <arm_sve.h>
+#include <arm_neon.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <math.h>
 #include <stdbool.h>
 #include <float.h>
 #include <mat.h>
@@ -158,5 +160,392 @@ static inline error_code_t simd_min_float(const float* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svfloat32_t x = svld1_f32(pg, a + i);
+        svfloat32_t y = svld1_f32(pg, b + i);
+        svst1_f32(pg, out + i, svadd_f32_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svfloat32_t x = svld1_f32(pg, a + i);
+        svfloat32_t y = svld1_f32(pg, b + i);
+        svst1_f32(pg, out + i, svsub_f32_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svfloat32_t x = svld1_f32(pg, a + i);
+        svfloat32_t y = svld1_f32(pg, b + i);
+        svst1_f32(pg, out + i, svmul_f32_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_div_float(float*       out,
+                           const float* a,
+                           const float* b,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svfloat32_t x = svld1_f32(pg, a + i);
+        svfloat32_t y = svld1_f32(pg, b + i);
+        svst1_f32(pg, out + i, svdiv_f32_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_float(float*       out,
+                              const float* a,
+                              float        mul,
+                              float        add,
+                              size_t       len) {
+    svfloat32_t const vmul = svdup_n_f32(mul);
+    svfloat32_t const vadd = svdup_n_f32(add);
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svfloat32_t x = svld1_f32(pg, a + i);
+        svst1_f32(pg, out + i, svadd_f32_x(pg, svmul_f32_x(pg, x, vmul), vadd));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_float(float*       out,
+                             const float* a,
+                             float        lo,
+                             float        hi,
+                             size_t       len) {
+    svfloat32_t const vlo = svdup_n_f32(lo);
+    svfloat32_t const vhi = svdup_n_f32(hi);
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svfloat32_t x = svld1_f32(pg, a + i);
+        svst1_f32(pg, out + i, svmax_f32_x(pg, svmin_f32_x(pg, x, vhi), vlo));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_float(float*       out,
+                           const float* a,
+                           size_t       len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svfloat32_t x = svld1_f32(pg, a + i);
+        svst1_f32(pg, out + i, svabs_f32_x(pg, x));
+    }
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_float(const float* data,
+                                   size_t       len,
+                                   float*       out) {
+    svfloat32_t vmax = svdup_n_f32(*out);   /* caller seeds with -INFINITY */
+
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        vmax = svmax_f32_m(pg, vmax, svld1_f32(pg, data + i));
+    }
+
+    /* FMAX and FMAXV propagate NaN */
+    float r = svmaxv_f32(svptrue_b32(), vmax);
+    *out = isnan(r) ? NAN : r;
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static float simd_sum_float(const float* data,
+                            size_t       len) {
+    svfloat32_t acc = svdup_n_f32(0.0f);
+
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        acc = svadd_f32_m(pg, acc, svld1_f32(pg, data + i));
+    }
+    return svaddv_f32(svptrue_b32(), acc);
+}
+// --------------------------------------------------------------------------------
+
+static float simd_asum_float(const float* data,
+                             size_t       len) {
+    svfloat32_t acc = svdup_n_f32(0.0f);
+
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        acc = svadd_f32_m(pg, acc, svabs_f32_x(pg, svld1_f32(pg, data + i)));
+    }
+    return svaddv_f32(svptrue_b32(), acc);
+}
+// --------------------------------------------------------------------------------
+
+static float simd_dot_float(const float* a,
+                            const float* b,
+                            size_t       len) {
+    svfloat32_t acc = svdup_n_f32(0.0f);
+
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        acc = svmla_f32_m(pg, acc, svld1_f32(pg, a + i), svld1_f32(pg, b + i));
+    }
+    return svaddv_f32(svptrue_b32(), acc);
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_float(float*       out,
+                               const float* a,
+                               const float* b,
+                               size_t       len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svfloat32_t x = svld1_f32(pg, a + i);
+        svfloat32_t y = svld1_f32(pg, b + i);
+        svst1_f32(pg, out + i, svmin_f32_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_float(float*       out,
+                               const float* a,
+                               const float* b,
+                               size_t       len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svfloat32_t x = svld1_f32(pg, a + i);
+        svfloat32_t y = svld1_f32(pg, b + i);
+        svst1_f32(pg, out + i, svmax_f32_x(pg, x, y));
+    }
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static float simd_scan_float(float*       out,
+                             const float* a,
+                             size_t       len,
+                             float        carry,
+                             bool         exclusive) {
+    /* Log-step scan over the whole vector: lanes at index >= k add the
+     * lane k below them, fetched with svtbl.  The vector length is only
+     * known at run time, so the step count is too */
+    svbool_t const all = svptrue_b32();
+    svuint32_t const iota = svindex_u32(0, 1);
+    uint64_t const vl = svcntw();
+    for (size_t i = 0u; i < len; i += vl) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svfloat32_t p = svld1_f32(pg, a + i);
+        for (uint64_t k = 1u; k < vl; k <<= 1) {
+            svbool_t const up = svcmpge_n_u32(all, iota, (uint32_t)k);
+            svuint32_t const src = svsub_n_u32_x(all, iota, (uint32_t)k);
+            p = svadd_f32_m(up, p, svtbl_f32(p, src));
+        }
+        svfloat32_t const cv = svdup_n_f32(carry);
+        svfloat32_t const r  = svadd_f32_x(all, p, cv);
+        svfloat32_t const y  = exclusive ? svadd_f32_x(all, svinsr_n_f32(p, 0), cv) : r;
+        svst1_f32(pg, out + i, y);
+        carry = svlastb_f32(pg, r);
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
+// MATRIX KERNELS
+
+/* y[i] += alpha * x[i] */
+static void simd_axpy_float(float*       y,
+                            const float* x,
+                            float        alpha,
+                            size_t       len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svfloat32_t yv = svld1_f32(pg, y + i);
+        svst1_f32(pg, y + i, svmla_n_f32_x(pg, yv, svld1_f32(pg, x + i), alpha));
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* C[0..4)[0..n) += A[0..4)[0..k) * B[0..k)[0..n), all row-major with leading
+ * dimensions ldc, lda and ldb.  Each vector-length strip of the 4 rows of C
+ * stays in registers for the whole k loop; the last strip is predicated */
+static void simd_gemm4_float(float*       c,
+                             size_t       ldc,
+                             const float* a,
+                             size_t       lda,
+                             const float* b,
+                             size_t       ldb,
+                             size_t       k,
+                             size_t       n) {
+    for (size_t j = 0u; j < n; j += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)j, (uint64_t)n);
+        svfloat32_t c0 = svld1_f32(pg, c + j);
+        svfloat32_t c1 = svld1_f32(pg, c + ldc + j);
+        svfloat32_t c2 = svld1_f32(pg, c + 2u * ldc + j);
+        svfloat32_t c3 = svld1_f32(pg, c + 3u * ldc + j);
+        const float* bp = b + j;
+        for (size_t p = 0u; p < k; p++, bp += ldb) {
+            svfloat32_t const bv = svld1_f32(pg, bp);
+            c0 = svmla_n_f32_x(pg, c0, bv, a[p]);
+            c1 = svmla_n_f32_x(pg, c1, bv, a[lda + p]);
+            c2 = svmla_n_f32_x(pg, c2, bv, a[2u * lda + p]);
+            c3 = svmla_n_f32_x(pg, c3, bv, a[3u * lda + p]);
+        }
+        svst1_f32(pg, c + j, c0);
+        svst1_f32(pg, c + ldc + j, c1);
+        svst1_f32(pg, c + 2u * ldc + j, c2);
+        svst1_f32(pg, c + 3u * ldc + j, c3);
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* sum of val[i] * x[idx[i]]: the sparse row (or column) dot product.
+ * 64-bit indices only address 64-bit lanes, so each half of a float
+ * vector is gathered as zero-extended words and the two halves are
+ * packed back together with svuzp1 */
+static float simd_spdot_float(const float*  val,
+                              const size_t* idx,
+                              const float*  x,
+                              size_t        len) {
+    svfloat32_t acc = svdup_n_f32(0.0f);
+    uint64_t const half = svcntd();
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svbool_t lo = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svbool_t hi = svwhilelt_b64((uint64_t)i + half, (uint64_t)len);
+        svuint64_t const il = svld1_u64(lo, (const uint64_t*)(idx + i));
+        svuint64_t const ih = svld1_u64(hi, (const uint64_t*)(idx + i + half));
+        svuint64_t const gl = svld1uw_gather_u64index_u64(lo, (const uint32_t*)x, il);
+        svuint64_t const gh = svld1uw_gather_u64index_u64(hi, (const uint32_t*)x, ih);
+        svfloat32_t const g = svuzp1_f32(svreinterpret_f32_u64(gl),
+                                         svreinterpret_f32_u64(gh));
+        acc = svmla_f32_m(pg, acc, svld1_f32(pg, val + i), g);
+    }
+    return svaddv_f32(svptrue_b32(), acc);
+}
+// --------------------------------------------------------------------------------
+
+/* dst[j * ldd + i] = src[i * lds + j] for i < rows, j < cols: one cache
+ * tile of a matrix transpose.  SVE has no fixed block shape, so 4 x 4 blocks
+ * are transposed in the Advanced SIMD registers every SVE core has. */
+static void simd_transpose_float(float*       dst,
+                                 size_t       ldd,
+                                 const float* src,
+                                 size_t       lds,
+                                 size_t       rows,
+                                 size_t       cols) {
+    size_t i = 0u;
+    for (; i + 4u <= rows; i += 4u) {
+        size_t j = 0u;
+        for (; j + 4u <= cols; j += 4u) {
+            const float* s = src + i * lds + j;
+            float*       d = dst + j * ldd + i;
+            float32x4x2_t const t01 = vtrnq_f32(vld1q_f32(s),            vld1q_f32(s + lds));
+            float32x4x2_t const t23 = vtrnq_f32(vld1q_f32(s + 2u * lds), vld1q_f32(s + 3u * lds));
+            vst1q_f32(d,            vcombine_f32(vget_low_f32(t01.val[0]),  vget_low_f32(t23.val[0])));
+            vst1q_f32(d + ldd,      vcombine_f32(vget_low_f32(t01.val[1]),  vget_low_f32(t23.val[1])));
+            vst1q_f32(d + 2u * ldd, vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0])));
+            vst1q_f32(d + 3u * ldd, vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1])));
+        }
+        for (; j < cols; j++)
+            for (size_t q = 0u; q < 4u; q++)
+                dst[j * ldd + i + q] = src[(i + q) * lds + j];
+    }
+    for (; i < rows; i++)
+        for (size_t j = 0u; j < cols; j++)
+            dst[j * ldd + i] = src[i * lds + j];
+}
+// --------------------------------------------------------------------------------
+
+/* The same transpose for one band of 16 source rows, so each destination
+ * row receives one full 64-byte line at a time.  SVE2 has no streaming store worth
+ * using here, so this is the plain tile transpose over the band. */
+static void simd_transpose_stream_float(float*       dst,
+                                        size_t       ldd,
+                                        const float* src,
+                                        size_t       lds,
+                                        size_t       cols) {
+    simd_transpose_float(dst, ldd, src, lds, 16u, cols);
+}
+// --------------------------------------------------------------------------------
+
+/* y[r] += sum over blocks b < nb of row r of block b dotted with
+ * x + col[b] * bc, for r < rows: one block row of a BSR SpMV.  Blocks are
+ * br x bc, row-major and packed back to back.  Block rows are dotted under
+ * a whilelt predicate, so any block width needs no scalar tail. */
+static void simd_bsr_float(float*        y,
+                           const float*  val,
+                           const size_t* col,
+                           const float*  x,
+                           size_t        nb,
+                           size_t        rows,
+                           size_t        br,
+                           size_t        bc) {
+    for (size_t r = 0u; r < rows; r++) {
+        svfloat32_t acc = svdup_n_f32(0.0f);
+        for (size_t b = 0u; b < nb; b++) {
+            const float* a  = val + (b * br + r) * bc;
+            const float* xb = x + col[b] * bc;
+            for (size_t k = 0u; k < bc; k += svcntw()) {
+                svbool_t pg = svwhilelt_b32((uint64_t)k, (uint64_t)bc);
+                acc = svmla_f32_m(pg, acc, svld1_f32(pg, a + k), svld1_f32(pg, xb + k));
+            }
+        }
+        y[r] += svaddv_f32(svptrue_b32(), acc);
+    }
+}
+// --------------------------------------------------------------------------------
+
+/* y[i] = sum over j < width of val[j * chunk + i] * x[idx[j * chunk + i]]
+ * for i < chunk: one slice of a SELL-C-sigma SpMV.  The slice is stored
+ * column by column, so consecutive lanes hold consecutive rows.  Rows go
+ * one vector length at a time under a whilelt predicate, x gathered with
+ * SVE gather loads. */
+static void simd_sell_float(float*        y,
+                            const float*  val,
+                            const size_t* idx,
+                            const float*  x,
+                            size_t        chunk,
+                            size_t        width) {
+    uint64_t const half = svcntd();
+    for (size_t i = 0u; i < chunk; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)chunk);
+        svbool_t lo = svwhilelt_b64((uint64_t)i, (uint64_t)chunk);
+        svbool_t hi = svwhilelt_b64((uint64_t)i + half, (uint64_t)chunk);
+        svfloat32_t acc = svdup_n_f32(0.0f);
+        for (size_t j = 0u; j < width; j++) {
+            const size_t* c = idx + j * chunk + i;
+            svuint64_t const il = svld1_u64(lo, (const uint64_t*)c);
+            svuint64_t const ih = svld1_u64(hi, (const uint64_t*)(c + half));
+            svuint64_t const gl = svld1uw_gather_u64index_u64(lo, (const uint32_t*)x, il);
+            svuint64_t const gh = svld1uw_gather_u64index_u64(hi, (const uint32_t*)x, ih);
+            svfloat32_t const g = svuzp1_f32(svreinterpret_f32_u64(gl),
+                                             svreinterpret_f32_u64(gh));
+            acc = svmla_f32_m(pg, acc, svld1_f32(pg, val + j * chunk + i), g);
+        }
+        svst1_f32(pg, y + i, acc);
+    }
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SVE2_FLOAT_INL */
 
@@ -58,6 +58,80 @@ static inline error_code_t simd_min_int64(const int64_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int64(int64_t*       out,
+                             const int64_t* a,
+                             int64_t        lo,
+                             int64_t        hi,
+                             size_t         len) {
+    svint64_t const vlo = svdup_n_s64(lo);
+    svint64_t const vhi = svdup_n_s64(hi);
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svint64_t x = svld1_s64(pg, a + i);
+        svst1_s64(pg, out + i, svmax_s64_x(pg, svmin_s64_x(pg, x, vhi), vlo));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int64(int64_t*       out,
+                           const int64_t* a,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svint64_t x = svld1_s64(pg, a + i);
+        svst1_s64(pg, out + i, svabs_s64_x(pg, x));
+    }
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int64(const int64_t* data,
+                                   size_t         len,
+                                   int64_t*       out) {
+    svint64_t vmax = svdup_n_s64(*out);   /* caller seeds with INT64_MIN */
+
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        vmax = svmax_s64_m(pg, vmax, svld1_s64(pg, data + i));
+    }
+    *out = svmaxv_s64(svptrue_b64(), vmax);
+    return NO_ERROR;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int64(int64_t*       out,
+                               const int64_t* a,
+                               const int64_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svint64_t x = svld1_s64(pg, a + i);
+        svint64_t y = svld1_s64(pg, b + i);
+        svst1_s64(pg, out + i, svmin_s64_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int64(int64_t*       out,
+                               const int64_t* a,
+                               const int64_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svint64_t x = svld1_s64(pg, a + i);
+        svint64_t y = svld1_s64(pg, b + i);
+        svst1_s64(pg, out + i, svmax_s64_x(pg, x, y));
+    }
+}
 
 #endif /* SIMD_SVE2_MIN_INT64_INL */
 // ================================================================================
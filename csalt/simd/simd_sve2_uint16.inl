@@ -32,6 +32,7 @@
 #include <arm_sve.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -109,5 +110,164 @@ static inline error_code_t simd_min_uint16(const uint16_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        svuint16_t x = svld1_u16(pg, a + i);
+        svuint16_t y = svld1_u16(pg, b + i);
+        svst1_u16(pg, out + i, svadd_u16_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        svuint16_t x = svld1_u16(pg, a + i);
+        svuint16_t y = svld1_u16(pg, b + i);
+        svst1_u16(pg, out + i, svsub_u16_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint16(uint16_t*       out,
+                            const uint16_t* a,
+                            const uint16_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        svuint16_t x = svld1_u16(pg, a + i);
+        svuint16_t y = svld1_u16(pg, b + i);
+        svst1_u16(pg, out + i, svmul_u16_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint16(uint16_t*       out,
+                               const uint16_t* a,
+                               uint16_t        mul,
+                               uint16_t        add,
+                               size_t          len) {
+    svuint16_t const vmul = svdup_n_u16(mul);
+    svuint16_t const vadd = svdup_n_u16(add);
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        svuint16_t x = svld1_u16(pg, a + i);
+        svst1_u16(pg, out + i, svadd_u16_x(pg, svmul_u16_x(pg, x, vmul), vadd));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint16(uint16_t*       out,
+                              const uint16_t* a,
+                              uint16_t        lo,
+                              uint16_t        hi,
+                              size_t          len) {
+    svuint16_t const vlo = svdup_n_u16(lo);
+    svuint16_t const vhi = svdup_n_u16(hi);
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        svuint16_t x = svld1_u16(pg, a + i);
+        svst1_u16(pg, out + i, svmax_u16_x(pg, svmin_u16_x(pg, x, vhi), vlo));
+    }
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint16(const uint16_t* data,
+                                    size_t          len,
+                                    uint16_t*       out) {
+    svuint16_t vmax = svdup_n_u16(*out);   /* caller seeds with 0 */
+
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        vmax = svmax_u16_m(pg, vmax, svld1_u16(pg, data + i));
+    }
+    *out = svmaxv_u16(svptrue_b16(), vmax);
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint16(const uint16_t* data,
+                                size_t          len) {
+    uint64_t sum = 0;
+
+    /* Integer ADDV widens to 64 bits */
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        sum += svaddv_u16(pg, svld1_u16(pg, data + i));
+    }
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint16(uint16_t*       out,
+                                const uint16_t* a,
+                                const uint16_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        svuint16_t x = svld1_u16(pg, a + i);
+        svuint16_t y = svld1_u16(pg, b + i);
+        svst1_u16(pg, out + i, svmin_u16_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint16(uint16_t*       out,
+                                const uint16_t* a,
+                                const uint16_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        svuint16_t x = svld1_u16(pg, a + i);
+        svuint16_t y = svld1_u16(pg, b + i);
+        svst1_u16(pg, out + i, svmax_u16_x(pg, x, y));
+    }
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static uint16_t simd_scan_uint16(uint16_t*       out,
+                                 const uint16_t* a,
+                                 size_t          len,
+                                 uint16_t        carry,
+                                 bool            exclusive) {
+    /* Log-step scan over the whole vector: lanes at index >= k add the
+     * lane k below them, fetched with svtbl.  The vector length is only
+     * known at run time, so the step count is too */
+    svbool_t const all = svptrue_b16();
+    svuint16_t const iota = svindex_u16(0, 1);
+    uint64_t const vl = svcnth();
+    for (size_t i = 0u; i < len; i += vl) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        svuint16_t p = svld1_u16(pg, a + i);
+        for (uint64_t k = 1u; k < vl; k <<= 1) {
+            svbool_t const up = svcmpge_n_u16(all, iota, (uint16_t)k);
+            svuint16_t const src = svsub_n_u16_x(all, iota, (uint16_t)k);
+            p = svadd_u16_m(up, p, svtbl_u16(p, src));
+        }
+        svuint16_t const cv = svdup_n_u16(carry);
+        svuint16_t const r  = svadd_u16_x(all, p, cv);
+        svuint16_t const y  = exclusive ? svadd_u16_x(all, svinsr_n_u16(p, 0), cv) : r;
+        svst1_u16(pg, out + i, y);
+        carry = svlastb_u16(pg, r);
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SVE2_UINT16_INL */
 
@@ -32,6 +32,7 @@
 #include <arm_sve.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -109,5 +110,164 @@ static inline error_code_t simd_min_uint32(const uint32_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svuint32_t x = svld1_u32(pg, a + i);
+        svuint32_t y = svld1_u32(pg, b + i);
+        svst1_u32(pg, out + i, svadd_u32_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svuint32_t x = svld1_u32(pg, a + i);
+        svuint32_t y = svld1_u32(pg, b + i);
+        svst1_u32(pg, out + i, svsub_u32_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint32(uint32_t*       out,
+                            const uint32_t* a,
+                            const uint32_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svuint32_t x = svld1_u32(pg, a + i);
+        svuint32_t y = svld1_u32(pg, b + i);
+        svst1_u32(pg, out + i, svmul_u32_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint32(uint32_t*       out,
+                               const uint32_t* a,
+                               uint32_t        mul,
+                               uint32_t        add,
+                               size_t          len) {
+    svuint32_t const vmul = svdup_n_u32(mul);
+    svuint32_t const vadd = svdup_n_u32(add);
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svuint32_t x = svld1_u32(pg, a + i);
+        svst1_u32(pg, out + i, svadd_u32_x(pg, svmul_u32_x(pg, x, vmul), vadd));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint32(uint32_t*       out,
+                              const uint32_t* a,
+                              uint32_t        lo,
+                              uint32_t        hi,
+                              size_t          len) {
+    svuint32_t const vlo = svdup_n_u32(lo);
+    svuint32_t const vhi = svdup_n_u32(hi);
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svuint32_t x = svld1_u32(pg, a + i);
+        svst1_u32(pg, out + i, svmax_u32_x(pg, svmin_u32_x(pg, x, vhi), vlo));
+    }
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint32(const uint32_t* data,
+                                    size_t          len,
+                                    uint32_t*       out) {
+    svuint32_t vmax = svdup_n_u32(*out);   /* caller seeds with 0 */
+
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        vmax = svmax_u32_m(pg, vmax, svld1_u32(pg, data + i));
+    }
+    *out = svmaxv_u32(svptrue_b32(), vmax);
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint32(const uint32_t* data,
+                                size_t          len) {
+    uint64_t sum = 0;
+
+    /* Integer ADDV widens to 64 bits */
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        sum += svaddv_u32(pg, svld1_u32(pg, data + i));
+    }
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint32(uint32_t*       out,
+                                const uint32_t* a,
+                                const uint32_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svuint32_t x = svld1_u32(pg, a + i);
+        svuint32_t y = svld1_u32(pg, b + i);
+        svst1_u32(pg, out + i, svmin_u32_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint32(uint32_t*       out,
+                                const uint32_t* a,
+                                const uint32_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svuint32_t x = svld1_u32(pg, a + i);
+        svuint32_t y = svld1_u32(pg, b + i);
+        svst1_u32(pg, out + i, svmax_u32_x(pg, x, y));
+    }
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static uint32_t simd_scan_uint32(uint32_t*       out,
+                                 const uint32_t* a,
+                                 size_t          len,
+                                 uint32_t        carry,
+                                 bool            exclusive) {
+    /* Log-step scan over the whole vector: lanes at index >= k add the
+     * lane k below them, fetched with svtbl.  The vector length is only
+     * known at run time, so the step count is too */
+    svbool_t const all = svptrue_b32();
+    svuint32_t const iota = svindex_u32(0, 1);
+    uint64_t const vl = svcntw();
+    for (size_t i = 0u; i < len; i += vl) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svuint32_t p = svld1_u32(pg, a + i);
+        for (uint64_t k = 1u; k < vl; k <<= 1) {
+            svbool_t const up = svcmpge_n_u32(all, iota, (uint32_t)k);
+            svuint32_t const src = svsub_n_u32_x(all, iota, (uint32_t)k);
+            p = svadd_u32_m(up, p, svtbl_u32(p, src));
+        }
+        svuint32_t const cv = svdup_n_u32(carry);
+        svuint32_t const r  = svadd_u32_x(all, p, cv);
+        svuint32_t const y  = exclusive ? svadd_u32_x(all, svinsr_n_u32(p, 0), cv) : r;
+        svst1_u32(pg, out + i, y);
+        carry = svlastb_u32(pg, r);
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SVE2_UINT32_INL */
 
@@ -32,6 +32,7 @@
 #include <arm_sve.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 // ================================================================================ 
 // ================================================================================ 
 
@@ -113,5 +114,151 @@ static inline error_code_t simd_min_uint64(const uint64_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svuint64_t x = svld1_u64(pg, a + i);
+        svuint64_t y = svld1_u64(pg, b + i);
+        svst1_u64(pg, out + i, svadd_u64_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svuint64_t x = svld1_u64(pg, a + i);
+        svuint64_t y = svld1_u64(pg, b + i);
+        svst1_u64(pg, out + i, svsub_u64_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint64(uint64_t*       out,
+                            const uint64_t* a,
+                            const uint64_t* b,
+                            size_t          len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svuint64_t x = svld1_u64(pg, a + i);
+        svuint64_t y = svld1_u64(pg, b + i);
+        svst1_u64(pg, out + i, svmul_u64_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint64(uint64_t*       out,
+                               const uint64_t* a,
+                               uint64_t        mul,
+                               uint64_t        add,
+                               size_t          len) {
+    svuint64_t const vmul = svdup_n_u64(mul);
+    svuint64_t const vadd = svdup_n_u64(add);
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svuint64_t x = svld1_u64(pg, a + i);
+        svst1_u64(pg, out + i, svadd_u64_x(pg, svmul_u64_x(pg, x, vmul), vadd));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint64(uint64_t*       out,
+                              const uint64_t* a,
+                              uint64_t        lo,
+                              uint64_t        hi,
+                              size_t          len) {
+    svuint64_t const vlo = svdup_n_u64(lo);
+    svuint64_t const vhi = svdup_n_u64(hi);
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svuint64_t x = svld1_u64(pg, a + i);
+        svst1_u64(pg, out + i, svmax_u64_x(pg, svmin_u64_x(pg, x, vhi), vlo));
+    }
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint64(const uint64_t* data,
+                                    size_t          len,
+                                    uint64_t*       out) {
+    svuint64_t vmax = svdup_n_u64(*out);   /* caller seeds with 0 */
+
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        vmax = svmax_u64_m(pg, vmax, svld1_u64(pg, data + i));
+    }
+    *out = svmaxv_u64(svptrue_b64(), vmax);
+    return NO_ERROR;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint64(uint64_t*       out,
+                                const uint64_t* a,
+                                const uint64_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svuint64_t x = svld1_u64(pg, a + i);
+        svuint64_t y = svld1_u64(pg, b + i);
+        svst1_u64(pg, out + i, svmin_u64_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint64(uint64_t*       out,
+                                const uint64_t* a,
+                                const uint64_t* b,
+                                size_t          len) {
+    for (size_t i = 0u; i < len; i += svcntd()) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svuint64_t x = svld1_u64(pg, a + i);
+        svuint64_t y = svld1_u64(pg, b + i);
+        svst1_u64(pg, out + i, svmax_u64_x(pg, x, y));
+    }
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static uint64_t simd_scan_uint64(uint64_t*       out,
+                                 const uint64_t* a,
+                                 size_t          len,
+                                 uint64_t        carry,
+                                 bool            exclusive) {
+    /* Log-step scan over the whole vector: lanes at index >= k add the
+     * lane k below them, fetched with svtbl.  The vector length is only
+     * known at run time, so the step count is too */
+    svbool_t const all = svptrue_b64();
+    svuint64_t const iota = svindex_u64(0, 1);
+    uint64_t const vl = svcntd();
+    for (size_t i = 0u; i < len; i += vl) {
+        svbool_t pg = svwhilelt_b64((uint64_t)i, (uint64_t)len);
+        svuint64_t p = svld1_u64(pg, a + i);
+        for (uint64_t k = 1u; k < vl; k <<= 1) {
+            svbool_t const up = svcmpge_n_u64(all, iota, (uint64_t)k);
+            svuint64_t const src = svsub_n_u64_x(all, iota, (uint64_t)k);
+            p = svadd_u64_m(up, p, svtbl_u64(p, src));
+        }
+        svuint64_t const cv = svdup_n_u64(carry);
+        svuint64_t const r  = svadd_u64_x(all, p, cv);
+        svuint64_t const y  = exclusive ? svadd_u64_x(all, svinsr_n_u64(p, 0), cv) : r;
+        svst1_u64(pg, out + i, y);
+        carry = svlastb_u64(pg, r);
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SVE2_UINT64_INL */
 
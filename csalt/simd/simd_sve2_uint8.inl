@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include <string.h>
 #include <arm_sve.h>
 // ================================================================================ 
@@ -176,5 +177,164 @@ static inline error_code_t simd_min_uint8(const uint8_t* data,
 }
 // ================================================================================ 
 // ================================================================================ 
+// ELEMENTWISE ARITHMETIC
+
+static void simd_add_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        svuint8_t x = svld1_u8(pg, a + i);
+        svuint8_t y = svld1_u8(pg, b + i);
+        svst1_u8(pg, out + i, svadd_u8_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_sub_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        svuint8_t x = svld1_u8(pg, a + i);
+        svuint8_t y = svld1_u8(pg, b + i);
+        svst1_u8(pg, out + i, svsub_u8_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_mul_uint8(uint8_t*       out,
+                           const uint8_t* a,
+                           const uint8_t* b,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        svuint8_t x = svld1_u8(pg, a + i);
+        svuint8_t y = svld1_u8(pg, b + i);
+        svst1_u8(pg, out + i, svmul_u8_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_muladd_uint8(uint8_t*       out,
+                              const uint8_t* a,
+                              uint8_t        mul,
+                              uint8_t        add,
+                              size_t         len) {
+    svuint8_t const vmul = svdup_n_u8(mul);
+    svuint8_t const vadd = svdup_n_u8(add);
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        svuint8_t x = svld1_u8(pg, a + i);
+        svst1_u8(pg, out + i, svadd_u8_x(pg, svmul_u8_x(pg, x, vmul), vadd));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_clamp_uint8(uint8_t*       out,
+                             const uint8_t* a,
+                             uint8_t        lo,
+                             uint8_t        hi,
+                             size_t         len) {
+    svuint8_t const vlo = svdup_n_u8(lo);
+    svuint8_t const vhi = svdup_n_u8(hi);
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        svuint8_t x = svld1_u8(pg, a + i);
+        svst1_u8(pg, out + i, svmax_u8_x(pg, svmin_u8_x(pg, x, vhi), vlo));
+    }
+}
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_uint8(const uint8_t* data,
+                                   size_t         len,
+                                   uint8_t*       out) {
+    svuint8_t vmax = svdup_n_u8(*out);   /* caller seeds with 0 */
+
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        vmax = svmax_u8_m(pg, vmax, svld1_u8(pg, data + i));
+    }
+    *out = svmaxv_u8(svptrue_b8(), vmax);
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static uint64_t simd_sum_uint8(const uint8_t* data,
+                               size_t         len) {
+    uint64_t sum = 0;
+
+    /* Integer ADDV widens to 64 bits */
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        sum += svaddv_u8(pg, svld1_u8(pg, data + i));
+    }
+    return sum;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               const uint8_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        svuint8_t x = svld1_u8(pg, a + i);
+        svuint8_t y = svld1_u8(pg, b + i);
+        svst1_u8(pg, out + i, svmin_u8_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               const uint8_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        svuint8_t x = svld1_u8(pg, a + i);
+        svuint8_t y = svld1_u8(pg, b + i);
+        svst1_u8(pg, out + i, svmax_u8_x(pg, x, y));
+    }
+}
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+
+static uint8_t simd_scan_uint8(uint8_t*       out,
+                               const uint8_t* a,
+                               size_t         len,
+                               uint8_t        carry,
+                               bool           exclusive) {
+    /* Log-step scan over the whole vector: lanes at index >= k add the
+     * lane k below them, fetched with svtbl.  The vector length is only
+     * known at run time, so the step count is too */
+    svbool_t const all = svptrue_b8();
+    svuint8_t const iota = svindex_u8(0, 1);
+    uint64_t const vl = svcntb();
+    for (size_t i = 0u; i < len; i += vl) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        svuint8_t p = svld1_u8(pg, a + i);
+        for (uint64_t k = 1u; k < vl; k <<= 1) {
+            svbool_t const up = svcmpge_n_u8(all, iota, (uint8_t)k);
+            svuint8_t const src = svsub_n_u8_x(all, iota, (uint8_t)k);
+            p = svadd_u8_m(up, p, svtbl_u8(p, src));
+        }
+        svuint8_t const cv = svdup_n_u8(carry);
+        svuint8_t const r  = svadd_u8_x(all, p, cv);
+        svuint8_t const y  = exclusive ? svadd_u8_x(all, svinsr_n_u8(p, 0), cv) : r;
+        svst1_u8(pg, out + i, y);
+        carry = svlastb_u8(pg, r);
+    }
+    return carry;
+}
+// ================================================================================
+// ================================================================================
 #endif /* CSALT_SIMD_SVE2_UINT8_INL */
 
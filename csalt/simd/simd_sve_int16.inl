@@ -56,6 +56,93 @@ static inline error_code_t simd_min_int16(const int16_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int16(int16_t*       out,
+                             const int16_t* a,
+                             int16_t        lo,
+                             int16_t        hi,
+                             size_t         len) {
+    svint16_t const vlo = svdup_n_s16(lo);
+    svint16_t const vhi = svdup_n_s16(hi);
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        svint16_t x = svld1_s16(pg, a + i);
+        svst1_s16(pg, out + i, svmax_s16_x(pg, svmin_s16_x(pg, x, vhi), vlo));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int16(int16_t*       out,
+                           const int16_t* a,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        svint16_t x = svld1_s16(pg, a + i);
+        svst1_s16(pg, out + i, svabs_s16_x(pg, x));
+    }
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int16(const int16_t* data,
+                                   size_t         len,
+                                   int16_t*       out) {
+    svint16_t vmax = svdup_n_s16(*out);   /* caller seeds with INT16_MIN */
+
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        vmax = svmax_s16_m(pg, vmax, svld1_s16(pg, data + i));
+    }
+    *out = svmaxv_s16(svptrue_b16(), vmax);
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int16(const int16_t* data,
+                              size_t         len) {
+    int64_t sum = 0;
+
+    /* Integer ADDV widens to 64 bits */
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        sum += svaddv_s16(pg, svld1_s16(pg, data + i));
+    }
+    return sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int16(int16_t*       out,
+                               const int16_t* a,
+                               const int16_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        svint16_t x = svld1_s16(pg, a + i);
+        svint16_t y = svld1_s16(pg, b + i);
+        svst1_s16(pg, out + i, svmin_s16_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int16(int16_t*       out,
+                               const int16_t* a,
+                               const int16_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += svcnth()) {
+        svbool_t pg = svwhilelt_b16((uint64_t)i, (uint64_t)len);
+        svint16_t x = svld1_s16(pg, a + i);
+        svint16_t y = svld1_s16(pg, b + i);
+        svst1_s16(pg, out + i, svmax_s16_x(pg, x, y));
+    }
+}
 
 #endif /* SIMD_SVE_MIN_INT16_INL */
 // ================================================================================
@@ -56,6 +56,93 @@ static inline error_code_t simd_min_int32(const int32_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int32(int32_t*       out,
+                             const int32_t* a,
+                             int32_t        lo,
+                             int32_t        hi,
+                             size_t         len) {
+    svint32_t const vlo = svdup_n_s32(lo);
+    svint32_t const vhi = svdup_n_s32(hi);
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svint32_t x = svld1_s32(pg, a + i);
+        svst1_s32(pg, out + i, svmax_s32_x(pg, svmin_s32_x(pg, x, vhi), vlo));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int32(int32_t*       out,
+                           const int32_t* a,
+                           size_t         len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svint32_t x = svld1_s32(pg, a + i);
+        svst1_s32(pg, out + i, svabs_s32_x(pg, x));
+    }
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int32(const int32_t* data,
+                                   size_t         len,
+                                   int32_t*       out) {
+    svint32_t vmax = svdup_n_s32(*out);   /* caller seeds with INT32_MIN */
+
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        vmax = svmax_s32_m(pg, vmax, svld1_s32(pg, data + i));
+    }
+    *out = svmaxv_s32(svptrue_b32(), vmax);
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int32(const int32_t* data,
+                              size_t         len) {
+    int64_t sum = 0;
+
+    /* Integer ADDV widens to 64 bits */
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        sum += svaddv_s32(pg, svld1_s32(pg, data + i));
+    }
+    return sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int32(int32_t*       out,
+                               const int32_t* a,
+                               const int32_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svint32_t x = svld1_s32(pg, a + i);
+        svint32_t y = svld1_s32(pg, b + i);
+        svst1_s32(pg, out + i, svmin_s32_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int32(int32_t*       out,
+                               const int32_t* a,
+                               const int32_t* b,
+                               size_t         len) {
+    for (size_t i = 0u; i < len; i += svcntw()) {
+        svbool_t pg = svwhilelt_b32((uint64_t)i, (uint64_t)len);
+        svint32_t x = svld1_s32(pg, a + i);
+        svint32_t y = svld1_s32(pg, b + i);
+        svst1_s32(pg, out + i, svmax_s32_x(pg, x, y));
+    }
+}
 
 #endif /* SIMD_SVE_MIN_INT32_INL */
 // ================================================================================
@@ -56,6 +56,93 @@ static inline error_code_t simd_min_int8(const int8_t* data,
     *out = cur_min;
     return NO_ERROR;
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+
+static void simd_clamp_int8(int8_t*       out,
+                            const int8_t* a,
+                            int8_t        lo,
+                            int8_t        hi,
+                            size_t        len) {
+    svint8_t const vlo = svdup_n_s8(lo);
+    svint8_t const vhi = svdup_n_s8(hi);
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        svint8_t x = svld1_s8(pg, a + i);
+        svst1_s8(pg, out + i, svmax_s8_x(pg, svmin_s8_x(pg, x, vhi), vlo));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_abs_int8(int8_t*       out,
+                          const int8_t* a,
+                          size_t        len) {
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        svint8_t x = svld1_s8(pg, a + i);
+        svst1_s8(pg, out + i, svabs_s8_x(pg, x));
+    }
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+
+static error_code_t simd_max_int8(const int8_t* data,
+                                  size_t        len,
+                                  int8_t*       out) {
+    svint8_t vmax = svdup_n_s8(*out);   /* caller seeds with INT8_MIN */
+
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        vmax = svmax_s8_m(pg, vmax, svld1_s8(pg, data + i));
+    }
+    *out = svmaxv_s8(svptrue_b8(), vmax);
+    return NO_ERROR;
+}
+// --------------------------------------------------------------------------------
+
+static int64_t simd_sum_int8(const int8_t* data,
+                             size_t        len) {
+    int64_t sum = 0;
+
+    /* Integer ADDV widens to 64 bits */
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        sum += svaddv_s8(pg, svld1_s8(pg, data + i));
+    }
+    return sum;
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE MINIMUM AND MAXIMUM
+
+static void simd_minimum_int8(int8_t*       out,
+                              const int8_t* a,
+                              const int8_t* b,
+                              size_t        len) {
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        svint8_t x = svld1_s8(pg, a + i);
+        svint8_t y = svld1_s8(pg, b + i);
+        svst1_s8(pg, out + i, svmin_s8_x(pg, x, y));
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void simd_maximum_int8(int8_t*       out,
+                              const int8_t* a,
+                              const int8_t* b,
+                              size_t        len) {
+    for (size_t i = 0u; i < len; i += svcntb()) {
+        svbool_t pg = svwhilelt_b8((uint64_t)i, (uint64_t)len);
+        svint8_t x = svld1_s8(pg, a + i);
+        svint8_t y = svld1_s8(pg, b + i);
+        svst1_s8(pg, out + i, svmax_s8_x(pg, x, y));
+    }
+}
 
 #endif /* SIMD_SVE_MIN_INT8_INL */
 // ================================================================================
@@ -13,13 +13,16 @@
 // Include modules here
 
 #include "c_allocator.h"
+#include "c_string.h"
 #include "test_suite.h"
 
 #include <endian.h>
 #include <stdint.h>
 #include <stdalign.h>
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 
 #include <stdio.h>
 #include <stdarg.h>
@@ -1778,6 +1781,267 @@ static void test_return_arena_with_buddy_roundtrip(void **state) {
 
     free_buddy(buddy);
 }
+// -------------------------------------------------------------------------------- 
+
+static void test_arena_backing_default(void **state) {
+    (void)state;
+
+    arena_expect_t expect = init_darena(4096u, true);
+    assert_true(expect.has_value);
+    arena_t *a = expect.u.value;
+
+    mem_backing_t got = arena_backing(a);
+    assert_int_equal(got.pages, PAGES_DEFAULT);
+    assert_int_equal(got.numa_node, -1);
+
+    char stats[512];
+    assert_true(arena_stats(a, stats, sizeof(stats)));
+    assert_non_null(strstr(stats, "Backing: default pages, NUMA node none"));
+
+    assert_int_equal(arena_backing(NULL).pages, PAGES_DEFAULT);
+    assert_string_equal(page_policy_name(PAGES_HUGETLB), "hugetlb");
+    assert_string_equal(page_policy_name((page_policy_t)7), "unknown");
+
+    free_arena(a);
+}
+// -------------------------------------------------------------------------------- 
+
+static void test_init_dynamic_arena_with_backing_falls_back(void **state) {
+    (void)state;
+
+    /* Hosts without reserved huge pages or THP must still get an arena */
+    mem_backing_t const want = { PAGES_HUGETLB, -1, false };
+    arena_expect_t expect = init_dynamic_arena_with_backing(4096u, true, 0u, 0u, want);
+    assert_true(expect.has_value);
+    arena_t *a = expect.u.value;
+
+    mem_backing_t const got = arena_backing(a);
+    assert_true(got.pages <= PAGES_HUGETLB);
+    assert_int_equal(got.numa_node, -1);
+
+    /* Growth chunks are mapped with the same request */
+    size_t const first = arena_alloc(a);
+    void_ptr_expect_t p = alloc_arena(a, first + 1u, false);
+    assert_true(p.has_value);
+    memset(p.u.value, 0xA5, first + 1u);
+    assert_int_equal(arena_chunk_count(a), 2u);
+    assert_true(arena_backing(a).pages <= got.pages);
+
+    /* Sub-arenas report the pages they were carved from */
+    arena_expect_t sub = init_arena_with_arena(a, 1024u, 0u);
+    assert_true(sub.has_value);
+    assert_int_equal(arena_backing(sub.u.value).pages, arena_backing(a).pages);
+
+    reset_arena(a, true);
+    assert_int_equal(arena_chunk_count(a), 1u);
+    free_arena(a);
+}
+// -------------------------------------------------------------------------------- 
+
+static void test_init_dynamic_arena_with_backing_strict_and_invalid(void **state) {
+    (void)state;
+
+    mem_backing_t const strict = { PAGES_HUGETLB, -1, true };
+    arena_expect_t expect = init_dynamic_arena_with_backing(4096u, false, 0u, 0u, strict);
+    if (expect.has_value) {
+        assert_int_equal(arena_backing(expect.u.value).pages, PAGES_HUGETLB);
+        free_arena(expect.u.value);
+    } else {
+        assert_int_equal(expect.u.error, UNSUPPORTED);
+    }
+
+    /* Node 0 always exists; the bind itself may be refused (no NUMA, seccomp) */
+    mem_backing_t const node0 = { PAGES_DEFAULT, 0, false };
+    expect = init_dynamic_arena_with_backing(4096u, false, 0u, 0u, node0);
+    assert_true(expect.has_value);
+    int const node = arena_backing(expect.u.value).numa_node;
+    assert_true(node == 0 || node == -1);
+    free_arena(expect.u.value);
+
+    mem_backing_t const bad_pages = { (page_policy_t)9, -1, false };
+    expect = init_dynamic_arena_with_backing(4096u, true, 0u, 0u, bad_pages);
+    assert_false(expect.has_value);
+    assert_int_equal(expect.u.error, INVALID_ARG);
+
+    mem_backing_t const bad_node = { PAGES_DEFAULT, -2, false };
+    expect = init_dynamic_arena_with_backing(4096u, true, 0u, 0u, bad_node);
+    assert_false(expect.has_value);
+    assert_int_equal(expect.u.error, INVALID_ARG);
+}
+// -------------------------------------------------------------------------------- 
+
+#define TEST_ARENA_THREADS   8
+#define TEST_ARENA_PER_THREAD 2000u
+
+typedef struct {
+    arena_t  *arena;
+    uint8_t  *ptr[TEST_ARENA_PER_THREAD];
+    size_t    len[TEST_ARENA_PER_THREAD];
+    unsigned  id;
+    bool      ok;
+} arena_worker_t;
+
+static void *arena_worker(void *arg) {
+    arena_worker_t *w = (arena_worker_t *)arg;
+    w->ok = true;
+    for (size_t i = 0u; i < TEST_ARENA_PER_THREAD; i++) {
+        size_t const n = 1u + (i * 37u + w->id * 11u) % 200u;
+        void_ptr_expect_t r = (i % 5u == 0u)
+            ? alloc_arena_aligned(w->arena, n, 64u, false)
+            : alloc_arena(w->arena, n, false);
+        if (!r.has_value) { w->ok = false; return NULL; }
+        memset(r.u.value, (int)w->id, n);
+        w->ptr[i] = (uint8_t *)r.u.value;
+        w->len[i] = n;
+    }
+    return NULL;
+}
+// -------------------------------------------------------------------------------- 
+
+static void test_arena_concurrent_threads(void **state) {
+    (void)state;
+
+    arena_expect_t expect = init_dynamic_arena(4096u, true, 4096u, 0u);
+    assert_true(expect.has_value);
+    arena_t *a = expect.u.value;
+
+    toggle_arena_concurrent(a, true);
+    assert_true(arena_is_concurrent(a));
+
+    static arena_worker_t work[TEST_ARENA_THREADS];
+    pthread_t tid[TEST_ARENA_THREADS];
+    for (unsigned i = 0u; i < TEST_ARENA_THREADS; i++) {
+        work[i] = (arena_worker_t){ .arena = a, .id = i + 1u };
+        assert_int_equal(pthread_create(&tid[i], NULL, arena_worker, &work[i]), 0);
+    }
+    for (unsigned i = 0u; i < TEST_ARENA_THREADS; i++) {
+        assert_int_equal(pthread_join(tid[i], NULL), 0);
+        assert_true(work[i].ok);
+    }
+
+    /* No two threads were handed overlapping bytes */
+    for (unsigned t = 0u; t < TEST_ARENA_THREADS; t++) {
+        for (size_t i = 0u; i < TEST_ARENA_PER_THREAD; i++) {
+            uint8_t const *p = work[t].ptr[i];
+            assert_int_equal((uintptr_t)p % arena_alignment(a), 0u);
+            if (i % 5u == 0u) {
+                assert_int_equal((uintptr_t)p % 64u, 0u);
+            }
+            for (size_t k = 0u; k < work[t].len[i]; k++) {
+                assert_int_equal(p[k], t + 1u);
+            }
+        }
+    }
+    assert_true(arena_chunk_count(a) > 1u);
+    assert_true(arena_size(a) <= arena_alloc(a));
+
+    /* Back to single-threaded bumping after the tail's last reservation */
+    toggle_arena_concurrent(a, false);
+    assert_false(arena_is_concurrent(a));
+    void_ptr_expect_t r = alloc_arena(a, 32u, true);
+    assert_true(r.has_value);
+
+    assert_true(reset_arena(a, true));
+    assert_int_equal(arena_chunk_count(a), 1u);
+    free_arena(a);
+}
+// -------------------------------------------------------------------------------- 
+
+static void test_arena_concurrent_fixed_capacity(void **state) {
+    (void)state;
+
+    static uint8_t buffer[4096] __attribute__((aligned(64)));
+    arena_expect_t expect = init_static_arena(buffer, sizeof(buffer), 0u);
+    assert_true(expect.has_value);
+    arena_t *a = expect.u.value;
+    toggle_arena_concurrent(a, true);
+
+    void_ptr_expect_t first = alloc_arena(a, 100u, false);
+    assert_true(first.has_value);
+    ArenaCheckPoint cp = save_arena(a);
+
+    size_t count = 0u;
+    void_ptr_expect_t r;
+    while ((r = alloc_arena(a, 100u, false)).has_value) {
+        count++;
+    }
+    assert_int_equal(r.u.error, OPERATION_UNAVAILABLE);
+    assert_true(count > 0u);
+
+    /* The failed reservation was clamped back inside the chunk */
+    assert_true(arena_remaining(a) < 112u);
+    assert_true(arena_size(a) <= arena_alloc(a));
+
+    assert_true(restore_arena(a, cp));
+    r = alloc_arena(a, 100u, false);
+    assert_true(r.has_value);
+    assert_ptr_equal(r.u.value, (uint8_t *)first.u.value + 112u);
+
+    assert_false(arena_is_concurrent(NULL));
+    toggle_arena_concurrent(NULL, true);
+}
+// -------------------------------------------------------------------------------- 
+
+/* Every block a chunk hands out lies inside its alloc bytes from base */
+static void _assert_arena_fill_in_bounds(arena_t *a, uint8_t const *base) {
+    size_t count = 0u;
+    void_ptr_expect_t r;
+    while ((r = alloc_arena(a, 16u, false)).has_value) {
+        uint8_t *p = r.u.value;
+        assert_int_equal((uintptr_t)p % arena_alignment(a), 0u);
+        assert_true(p >= base);
+        assert_true(p + 16u <= base + arena_alloc(a));
+        memset(p, 0xA5, 16u);
+        count++;
+    }
+    assert_int_equal(r.u.error, OPERATION_UNAVAILABLE);
+    assert_true(count > 0u);
+    assert_true(arena_size(a) <= arena_alloc(a));
+}
+// -------------------------------------------------------------------------------- 
+
+static void test_arena_concurrent_after_unaligned_cursor(void **state) {
+    (void)state;
+
+    /* A single-threaded 8-byte block leaves the cursor off the 16-byte
+     * alignment before the switch to concurrent mode */
+    arena_expect_t expect = init_dynamic_arena(1000u, false, 0u, 16u);
+    assert_true(expect.has_value);
+    arena_t *a = expect.u.value;
+
+    void_ptr_expect_t first = alloc_arena(a, 8u, false);
+    assert_true(first.has_value);
+    toggle_arena_concurrent(a, true);
+    _assert_arena_fill_in_bounds(a, first.u.value);
+
+    /* Back and forth between the modes from the same chunk */
+    assert_true(reset_arena(a, false));
+    toggle_arena_concurrent(a, false);
+    assert_true(alloc_arena(a, 8u, false).has_value);
+    toggle_arena_concurrent(a, true);
+    assert_true(alloc_arena(a, 16u, false).has_value);
+    toggle_arena_concurrent(a, false);
+    assert_true(alloc_arena(a, 24u, false).has_value);
+    toggle_arena_concurrent(a, true);
+    _assert_arena_fill_in_bounds(a, first.u.value);
+    free_arena(a);
+
+    /* A static arena restored to a single-threaded checkpoint while in
+     * concurrent mode */
+    static uint8_t buffer[4096] __attribute__((aligned(64)));
+    expect = init_static_arena(buffer, sizeof(buffer), 0u);
+    assert_true(expect.has_value);
+    a = expect.u.value;
+
+    first = alloc_arena(a, 8u, false);
+    assert_true(first.has_value);
+    ArenaCheckPoint cp = save_arena(a);
+    toggle_arena_concurrent(a, true);
+    _assert_arena_fill_in_bounds(a, first.u.value);
+
+    assert_true(restore_arena(a, cp));
+    _assert_arena_fill_in_bounds(a, first.u.value);
+}
 // ================================================================================ 
 // ================================================================================ 
 
@@ -1851,6 +2115,14 @@ const struct CMUnitTest test_arena[] = {
 
     cmocka_unit_test(test_init_arena_with_buddy_invalid_args),
     cmocka_unit_test(test_return_arena_with_buddy_roundtrip),
+
+    cmocka_unit_test(test_arena_backing_default),
+    cmocka_unit_test(test_init_dynamic_arena_with_backing_falls_back),
+    cmocka_unit_test(test_init_dynamic_arena_with_backing_strict_and_invalid),
+
+    cmocka_unit_test(test_arena_concurrent_threads),
+    cmocka_unit_test(test_arena_concurrent_fixed_capacity),
+    cmocka_unit_test(test_arena_concurrent_after_unaligned_cursor),
 };
 
 const size_t test_arena_count = sizeof(test_arena) / sizeof(test_arena[0]);
@@ -3630,6 +3902,109 @@ static void test_reset_freelist_after_fragmentation(void **state) {
 }
 // -------------------------------------------------------------------------------- 
 
+static void test_return_freelist_coalesces_fragmented_region(void **state) {
+    (void)state;
+
+    freelist_expect_t fexpect = init_dynamic_freelist(1u << 16, 0u, false);
+    assert_true(fexpect.has_value);
+    freelist_t *fl = fexpect.u.value;
+
+    size_t const capacity = freelist_alloc(fl);
+
+    /* Fill the region with mixed sizes. */
+    enum { N = 256 };
+    void *ptrs[N];
+    size_t count = 0u;
+    for (; count < N; ++count) {
+        void_ptr_expect_t v = alloc_freelist(fl, 24u + (count % 7u) * 40u, false);
+        if (!v.has_value) break;
+        ptrs[count] = v.u.value;
+    }
+    assert_true(count > 64u);
+
+    /* Free odd slots, then even slots in reverse: every return must merge
+       with whatever neighbours are already free. */
+    for (size_t i = 1u; i < count; i += 2u) {
+        return_freelist_element(fl, ptrs[i]);
+    }
+    for (size_t i = count; i-- > 0u; ) {
+        if ((i % 2u) == 0u) return_freelist_element(fl, ptrs[i]);
+    }
+    assert_int_equal(freelist_size(fl), 0u);
+
+    char buf[512];
+    assert_true(freelist_stats(fl, buf, sizeof buf));
+    assert_non_null(strstr(buf, "Free blocks: 1,"));
+    assert_non_null(strstr(buf, "Fragmentation: 0.0%"));
+
+    /* The whole region is one block again. */
+    void_ptr_expect_t big = alloc_freelist(fl, capacity - 64u, false);
+    assert_true(big.has_value);
+    return_freelist_element(fl, big.u.value);
+
+    free_freelist(fl);
+}
+// -------------------------------------------------------------------------------- 
+
+static void test_freelist_stats_reports_fragmentation(void **state) {
+    (void)state;
+
+    uint8_t buffer[8192];
+    freelist_expect_t fexpect = init_static_freelist(buffer, sizeof buffer, 0u);
+    assert_true(fexpect.has_value);
+    freelist_t *fl = fexpect.u.value;
+
+    void_ptr_expect_t a = alloc_freelist(fl, 256u, false);
+    void_ptr_expect_t b = alloc_freelist(fl, 256u, false);
+    void_ptr_expect_t c = alloc_freelist(fl, 256u, false);
+    assert_true(a.has_value && b.has_value && c.has_value);
+
+    /* A hole between two live blocks splits the free space in two. */
+    return_freelist_element(fl, b.u.value);
+
+    char buf[1024];
+    assert_true(freelist_stats(fl, buf, sizeof buf));
+    assert_non_null(strstr(buf, "Free blocks: 2,"));
+    assert_non_null(strstr(buf, "Largest free block:"));
+    assert_non_null(strstr(buf, "Fragmentation:"));
+    assert_null(strstr(buf, "Fragmentation: 0.0%"));
+
+    /* A request that fits the hole reuses it. */
+    void_ptr_expect_t d = alloc_freelist(fl, 200u, false);
+    assert_true(d.has_value);
+    assert_ptr_equal(d.u.value, b.u.value);
+
+    return_freelist_element(fl, a.u.value);
+    return_freelist_element(fl, c.u.value);
+    return_freelist_element(fl, d.u.value);
+    assert_int_equal(freelist_size(fl), 0u);
+}
+// -------------------------------------------------------------------------------- 
+
+static void test_return_freelist_rejects_double_free(void **state) {
+    (void)state;
+
+    uint8_t buffer[4096];
+    freelist_expect_t fexpect = init_static_freelist(buffer, sizeof buffer, 0u);
+    assert_true(fexpect.has_value);
+    freelist_t *fl = fexpect.u.value;
+
+    void_ptr_expect_t a = alloc_freelist(fl, 64u, false);
+    void_ptr_expect_t b = alloc_freelist(fl, 64u, false);
+    assert_true(a.has_value && b.has_value);
+
+    return_freelist_element(fl, b.u.value);
+    size_t const used = freelist_size(fl);
+
+    /* Second return of b is ignored, accounting unchanged. */
+    return_freelist_element(fl, b.u.value);
+    assert_int_equal(freelist_size(fl), used);
+
+    return_freelist_element(fl, a.u.value);
+    assert_int_equal(freelist_size(fl), 0u);
+}
+// -------------------------------------------------------------------------------- 
+
 const struct CMUnitTest test_freelist[] = {
     cmocka_unit_test(test_init_freelist_with_arena_null_arena),
     cmocka_unit_test(test_init_freelist_with_arena_basic),
@@ -3657,6 +4032,9 @@ const struct CMUnitTest test_freelist[] = {
     cmocka_unit_test(test_realloc_freelist_aligned_grow_preserves_data_and_alignment),
     cmocka_unit_test(test_reset_freelist_basic_static),
     cmocka_unit_test(test_reset_freelist_after_fragmentation),
+    cmocka_unit_test(test_return_freelist_coalesces_fragmented_region),
+    cmocka_unit_test(test_freelist_stats_reports_fragmentation),
+    cmocka_unit_test(test_return_freelist_rejects_double_free),
 };
 
 const size_t test_freelist_count = sizeof(test_freelist) / sizeof(test_freelist[0]);
@@ -4661,6 +5039,110 @@ static void test_is_buddy_ptr_sized_foreign_pointer(void **state) {
 }
 // -------------------------------------------------------------------------------- 
 
+static void test_return_buddy_coalesces_fragmented_pool(void **state) {
+    (void)state;
+
+    buddy_expect_t expect = init_buddy_allocator(1u << 16, 64u, 0u);
+    assert_true(expect.has_value);
+    buddy_t *b = expect.u.value;
+
+    /* Fill the pool with minimum blocks */
+    enum { N = (1u << 16) / 64u };
+    void *blocks[N];
+    for (size_t i = 0u; i < N; i++) {
+        void_ptr_expect_t r = alloc_buddy(b, 16u, false);
+        assert_true(r.has_value);
+        blocks[i] = r.u.value;
+    }
+    assert_int_equal(buddy_largest_block(b), 0u);
+
+    /* Free every other block: nothing can merge yet */
+    for (size_t i = 0u; i < N; i += 2u) {
+        assert_true(return_buddy_element(b, blocks[i]));
+    }
+    assert_int_equal(buddy_largest_block(b), 64u);
+
+    /* Free the rest: everything must merge back into one block */
+    for (size_t i = 1u; i < N; i += 2u) {
+        assert_true(return_buddy_element(b, blocks[i]));
+    }
+    assert_int_equal(buddy_alloc(b), 0u);
+    assert_int_equal(buddy_largest_block(b), (size_t)1u << 16);
+
+    free_buddy(b);
+}
+// -------------------------------------------------------------------------------- 
+
+static void test_return_buddy_rejects_double_free(void **state) {
+    (void)state;
+
+    buddy_expect_t expect = init_buddy_allocator(4096u, 64u, 0u);
+    assert_true(expect.has_value);
+    buddy_t *b = expect.u.value;
+
+    void_ptr_expect_t a = alloc_buddy(b, 32u, false);
+    void_ptr_expect_t c = alloc_buddy(b, 32u, false);
+    assert_true(a.has_value && c.has_value);
+
+    /* c keeps a's buddy allocated, so a stays on the free list */
+    assert_true(return_buddy_element(b, a.u.value));
+    size_t const used = buddy_alloc(b);
+    assert_false(return_buddy_element(b, a.u.value));
+    assert_int_equal(buddy_alloc(b), used);
+
+    assert_true(return_buddy_element(b, c.u.value));
+    assert_int_equal(buddy_largest_block(b), 4096u);
+
+    free_buddy(b);
+}
+// -------------------------------------------------------------------------------- 
+
+static void test_init_buddy_with_backing(void **state) {
+    (void)state;
+
+    buddy_expect_t expect = init_buddy_allocator(4096u, 64u, 0u);
+    assert_true(expect.has_value);
+    assert_int_equal(buddy_backing(expect.u.value).pages, PAGES_DEFAULT);
+    assert_int_equal(buddy_backing(expect.u.value).numa_node, -1);
+    free_buddy(expect.u.value);
+
+    mem_backing_t const want = { PAGES_THP, 0, false };
+    expect = init_buddy_allocator_with_backing((size_t)1u << 22, 64u, 0u, want);
+    assert_true(expect.has_value);
+    buddy_t *b = expect.u.value;
+
+    mem_backing_t const got = buddy_backing(b);
+    assert_true(got.pages == PAGES_DEFAULT || got.pages == PAGES_THP);
+    assert_true(got.numa_node == 0 || got.numa_node == -1);
+
+    void_ptr_expect_t p = alloc_buddy(b, (size_t)1u << 20, true);
+    assert_true(p.has_value);
+    memset(p.u.value, 0x5A, (size_t)1u << 20);
+
+    char stats[2048];
+    assert_true(buddy_stats(b, stats, sizeof(stats)));
+    assert_non_null(strstr(stats, "Backing: "));
+    assert_non_null(strstr(stats, page_policy_name(got.pages)));
+
+    assert_true(return_buddy_element(b, p.u.value));
+    free_buddy(b);
+
+    mem_backing_t const strict = { PAGES_HUGETLB, -1, true };
+    expect = init_buddy_allocator_with_backing(4096u, 64u, 0u, strict);
+    if (expect.has_value) {
+        assert_int_equal(buddy_backing(expect.u.value).pages, PAGES_HUGETLB);
+        free_buddy(expect.u.value);
+    } else {
+        assert_int_equal(expect.u.error, UNSUPPORTED);
+    }
+
+    mem_backing_t const bad = { PAGES_DEFAULT, 4096, false };
+    expect = init_buddy_allocator_with_backing(4096u, 64u, 0u, bad);
+    assert_false(expect.has_value);
+    assert_int_equal(expect.u.error, INVALID_ARG);
+}
+// -------------------------------------------------------------------------------- 
+
 const struct CMUnitTest test_buddy_allocator[] = {
     cmocka_unit_test(test_init_buddy_zero_pool),
     cmocka_unit_test(test_init_buddy_zero_min_block),
@@ -4689,6 +5171,10 @@ const struct CMUnitTest test_buddy_allocator[] = {
     cmocka_unit_test(test_realloc_buddy_aligned_from_null),
     cmocka_unit_test(test_realloc_buddy_aligned_to_zero_frees),
     cmocka_unit_test(test_realloc_buddy_aligned_shrink_preserves_data),
+
+    cmocka_unit_test(test_return_buddy_coalesces_fragmented_pool),
+    cmocka_unit_test(test_return_buddy_rejects_double_free),
+    cmocka_unit_test(test_init_buddy_with_backing),
 //     cmocka_unit_test(test_realloc_buddy_aligned_grow_zeroed),
 //     cmocka_unit_test(test_realloc_buddy_aligned_grow_too_large_failure),
 //     cmocka_unit_test(test_realloc_buddy_aligned_zero_align_behavior),
@@ -5524,6 +6010,111 @@ static void test_slab_getters_after_allocs_and_frees(void **state) {
 }
 /* ------------------------------------------------------------------------- */
 
+static void test_return_slab_releases_empty_pages(void **state) {
+    (void)state;
+
+    buddy_expect_t bexpect = init_buddy_allocator(1u << 20, 64u, 0u);
+    assert_true(bexpect.has_value);
+    buddy_t *buddy = bexpect.u.value;
+
+    slab_expect_t sexpect = init_slab_allocator(buddy, 48u, 0u, 1024u);
+    assert_true(sexpect.has_value);
+    slab_t *slab = sexpect.u.value;
+
+    size_t const buddy_before = buddy_alloc(buddy);
+
+    /* Enough objects to span many pages. */
+    enum { N = 400 };
+    void *ptrs[N];
+    for (size_t i = 0; i < N; ++i) {
+        void_ptr_expect_t v = alloc_slab(slab, false);
+        assert_true(v.has_value);
+        ptrs[i] = v.u.value;
+    }
+
+    size_t const buddy_peak = buddy_alloc(buddy);
+    assert_true(slab_total_blocks(slab) >= N);
+    assert_true(buddy_peak > buddy_before);
+
+    for (size_t i = 0; i < N; ++i) {
+        assert_true(return_slab(slab, ptrs[i]));
+    }
+
+    /* Every page but one cached empty page went back to the buddy. */
+    assert_int_equal(slab_in_use_blocks(slab), 0u);
+    assert_int_equal(slab_free_blocks(slab), slab_total_blocks(slab));
+    assert_true(slab_total_blocks(slab) <= N / 4u);
+    assert_true(buddy_alloc(buddy) - buddy_before < (buddy_peak - buddy_before) / 4u);
+
+    /* The first page emptied is the one kept; later ones are gone. */
+    assert_true(is_slab_ptr(slab, ptrs[0]));
+    assert_false(is_slab_ptr(slab, ptrs[N - 1]));
+    void_ptr_expect_t v = alloc_slab(slab, true);
+    assert_true(v.has_value);
+    assert_true(is_slab_ptr(slab, v.u.value));
+    assert_true(return_slab(slab, v.u.value));
+
+    free_buddy(buddy);
+}
+// -------------------------------------------------------------------------------- 
+
+static void test_return_slab_many_pages_interleaved(void **state) {
+    (void)state;
+
+    buddy_expect_t bexpect = init_buddy_allocator(1u << 22, 64u, 0u);
+    assert_true(bexpect.has_value);
+    buddy_t *buddy = bexpect.u.value;
+
+    slab_expect_t sexpect = init_slab_allocator(buddy, 32u, 0u, 0u);
+    assert_true(sexpect.has_value);
+    slab_t *slab = sexpect.u.value;
+
+    enum { N = 4096 };
+    void **ptrs = malloc(N * sizeof(*ptrs));
+    assert_non_null(ptrs);
+
+    for (size_t i = 0; i < N; ++i) {
+        void_ptr_expect_t v = alloc_slab(slab, false);
+        assert_true(v.has_value);
+        ptrs[i] = v.u.value;
+        memset(ptrs[i], (int)(i & 0xFFu), 32u);
+    }
+
+    /* Free every other object: pages stay partly used. */
+    for (size_t i = 0; i < N; i += 2u) {
+        assert_true(return_slab(slab, ptrs[i]));
+    }
+    assert_int_equal(slab_in_use_blocks(slab), N / 2u);
+
+    /* Interior and misaligned pointers are still rejected. */
+    assert_false(return_slab(slab, (uint8_t *)ptrs[1] + 1));
+    assert_false(is_slab_ptr(slab, (uint8_t *)ptrs[1] + 1));
+
+    /* Survivors are intact. */
+    for (size_t i = 1; i < N; i += 2u) {
+        assert_true(is_slab_ptr(slab, ptrs[i]));
+        assert_int_equal(((uint8_t *)ptrs[i])[31], (uint8_t)(i & 0xFFu));
+    }
+
+    /* Refill the holes without growing. */
+    size_t const total = slab_total_blocks(slab);
+    for (size_t i = 0; i < N; i += 2u) {
+        void_ptr_expect_t v = alloc_slab(slab, false);
+        assert_true(v.has_value);
+        ptrs[i] = v.u.value;
+    }
+    assert_int_equal(slab_total_blocks(slab), total);
+
+    for (size_t i = 0; i < N; ++i) {
+        assert_true(return_slab(slab, ptrs[i]));
+    }
+    assert_int_equal(slab_in_use_blocks(slab), 0u);
+
+    free(ptrs);
+    free_buddy(buddy);
+}
+// -------------------------------------------------------------------------------- 
+
 const struct CMUnitTest test_slab_allocator[] = {
     cmocka_unit_test(test_init_slab_null_buddy),
     cmocka_unit_test(test_init_slab_zero_object_size),
@@ -5538,6 +6129,8 @@ const struct CMUnitTest test_slab_allocator[] = {
     cmocka_unit_test(test_return_slab_null_pointer),
     cmocka_unit_test(test_return_slab_invalid_pointer),
     cmocka_unit_test(test_alloc_slab_is_slab_ptr),
+    cmocka_unit_test(test_return_slab_releases_empty_pages),
+    cmocka_unit_test(test_return_slab_many_pages_interleaved),
 
     cmocka_unit_test(test_reset_slab_null),
     cmocka_unit_test(test_reset_slab_basic),
@@ -5553,4 +6146,682 @@ const struct CMUnitTest test_slab_allocator[] = {
 const size_t test_slab_allocator_count = sizeof(test_slab_allocator) / sizeof(test_slab_allocator[0]);
 // ================================================================================
 // ================================================================================
+// TEST THREAD CACHE ALLOCATOR
+
+#define TEST_TCACHE_THREADS 4
+#define TEST_TCACHE_ITERS   20000
+
+static buddy_t *create_tcache_buddy(void) {
+    buddy_expect_t b = init_buddy_allocator(1u << 22, 64u, 0u);
+    assert_true(b.has_value);
+    return b.u.value;
+}
+// --------------------------------------------------------------------------------
+
+static void test_init_tcache_invalid_args(void **state) {
+    (void)state;
+
+    tcache_expect_t none = init_tcache(NULL, NULL, 0u);
+    assert_false(none.has_value);
+    assert_int_equal(none.u.error, INVALID_ARG);
+
+    /* A slab carved from the same buddy pool is rejected */
+    buddy_t *buddy = create_tcache_buddy();
+    slab_expect_t s = init_slab_allocator(buddy, 32u, 0u, 0u);
+    assert_true(s.has_value);
+    tcache_expect_t shared = init_tcache(buddy, s.u.value, 0u);
+    assert_false(shared.has_value);
+    assert_int_equal(shared.u.error, INVALID_ARG);
+
+    tcache_expect_t ok = init_tcache(buddy, NULL, 0u);
+    assert_true(ok.has_value);
+    assert_int_equal(tcache_batch(ok.u.value), 32u);
+    assert_int_equal(tcache_batch(NULL), 0u);
+
+    free_tcache(ok.u.value);
+    free_buddy(buddy);
+}
+// --------------------------------------------------------------------------------
+
+static void test_tcache_reuses_cached_blocks(void **state) {
+    (void)state;
+    buddy_t *buddy = create_tcache_buddy();
+    tcache_expect_t tx = init_tcache(buddy, NULL, 8u);
+    assert_true(tx.has_value);
+    tcache_t *tc = tx.u.value;
+
+    void_ptr_expect_t a = alloc_tcache(tc, 100u, false);
+    assert_true(a.has_value);
+    assert_true(is_buddy_ptr(buddy, a.u.value));
+
+    /* One refill pulled a whole batch of this order from the buddy */
+    assert_int_equal(buddy_alloc(buddy), 8u * 128u);
+
+    assert_true(return_tcache_element(tc, a.u.value));
+    void_ptr_expect_t b = alloc_tcache(tc, 90u, true);
+    assert_true(b.has_value);
+    assert_ptr_equal(a.u.value, b.u.value);
+    for (size_t i = 0u; i < 90u; i++) {
+        assert_int_equal(((uint8_t *)b.u.value)[i], 0u);
+    }
+    assert_true(return_tcache_element(tc, b.u.value));
+
+    /* Flushing hands every cached block back to the buddy */
+    assert_true(flush_tcache(tc));
+    assert_int_equal(buddy_alloc(buddy), 0u);
+
+    free_tcache(tc);
+    free_buddy(buddy);
+}
+// --------------------------------------------------------------------------------
+
+static void test_tcache_routes_slab_and_large_blocks(void **state) {
+    (void)state;
+    buddy_t *buddy      = create_tcache_buddy();
+    buddy_t *slab_buddy = create_tcache_buddy();
+    slab_expect_t s = init_slab_allocator(slab_buddy, 48u, 0u, 0u);
+    assert_true(s.has_value);
+    slab_t *slab = s.u.value;
+
+    tcache_expect_t tx = init_tcache(buddy, slab, 4u);
+    assert_true(tx.has_value);
+    tcache_t *tc = tx.u.value;
+
+    void_ptr_expect_t small = alloc_tcache(tc, 40u, false);
+    assert_true(small.has_value);
+    assert_true(is_slab_ptr(slab, small.u.value));
+
+    void_ptr_expect_t mid = alloc_tcache(tc, 1000u, false);
+    assert_true(mid.has_value);
+    assert_true(is_buddy_ptr(buddy, mid.u.value));
+
+    /* Beyond the cached orders: served directly, no batch taken */
+    size_t const before = buddy_alloc(buddy);
+    void_ptr_expect_t big = alloc_tcache(tc, 100000u, false);
+    assert_true(big.has_value);
+    assert_int_equal(buddy_alloc(buddy) - before, (size_t)1u << 17);
+    assert_true(return_tcache_element(tc, big.u.value));
+    assert_int_equal(buddy_alloc(buddy), before);
+
+    /* Over-aligned requests bypass the magazines */
+    void_ptr_expect_t al = alloc_tcache_aligned(tc, 64u, 256u, false);
+    assert_true(al.has_value);
+    assert_true(((uintptr_t)al.u.value & 255u) == 0u);
+    assert_true(return_tcache_element(tc, al.u.value));
+
+    /* Foreign pointers and misaligned slab addresses are never cached */
+    int on_stack = 0;
+    assert_false(return_tcache_element(tc, &on_stack));
+    assert_false(return_tcache_element(tc, (uint8_t *)small.u.value + 1));
+    void_ptr_expect_t again = alloc_tcache(tc, 40u, false);
+    assert_true(again.has_value);
+    assert_true(is_slab_ptr(slab, again.u.value));
+    assert_true(return_tcache_element(tc, again.u.value));
+
+    assert_true(return_tcache_element(tc, small.u.value));
+    assert_true(return_tcache_element(tc, mid.u.value));
+
+    free_tcache(tc);
+    assert_int_equal(buddy_alloc(buddy), 0u);
+    assert_int_equal(slab_in_use_blocks(slab), 0u);
+
+    free_buddy(slab_buddy);
+    free_buddy(buddy);
+}
+// --------------------------------------------------------------------------------
+
+static void test_tcache_realloc_preserves_data(void **state) {
+    (void)state;
+    buddy_t *buddy = create_tcache_buddy();
+    tcache_expect_t tx = init_tcache(buddy, NULL, 0u);
+    assert_true(tx.has_value);
+    tcache_t *tc = tx.u.value;
+
+    void_ptr_expect_t r = realloc_tcache(tc, NULL, 0u, 32u, false);
+    assert_true(r.has_value);
+    uint8_t *p = r.u.value;
+    for (size_t i = 0u; i < 32u; i++) p[i] = (uint8_t)i;
+
+    /* Fits in the same 64-byte block */
+    r = realloc_tcache(tc, p, 32u, 40u, true);
+    assert_true(r.has_value);
+    assert_ptr_equal(r.u.value, p);
+    assert_int_equal(p[39], 0u);
+
+    r = realloc_tcache(tc, p, 40u, 3000u, true);
+    assert_true(r.has_value);
+    assert_ptr_not_equal(r.u.value, p);
+    p = r.u.value;
+    for (size_t i = 0u; i < 32u; i++) assert_int_equal(p[i], (uint8_t)i);
+    assert_int_equal(p[2999], 0u);
+
+    r = realloc_tcache(tc, p, 3000u, 0u, false);
+    assert_true(r.has_value);
+    assert_null(r.u.value);
+
+    free_tcache(tc);
+    assert_int_equal(buddy_alloc(buddy), 0u);
+    free_buddy(buddy);
+}
+// --------------------------------------------------------------------------------
+
+static void test_tcache_vtable_with_string(void **state) {
+    (void)state;
+    buddy_t *buddy = create_tcache_buddy();
+    tcache_expect_t tx = init_tcache(buddy, NULL, 0u);
+    assert_true(tx.has_value);
+    allocator_vtable_t alloc = tcache_allocator(tx.u.value);
+
+    string_expect_t s = init_string("thread", 0u, alloc);
+    assert_true(s.has_value);
+    for (int i = 0; i < 50; i++) {
+        assert_true(str_concat(s.u.value, " cache"));
+    }
+    assert_int_equal(string_size(s.u.value), 6u + 50u * 6u);
+    return_string(s.u.value);
+
+    char buf[512];
+    assert_true(tcache_stats(tx.u.value, buf, sizeof(buf)));
+    assert_non_null(strstr(buf, "Thread Cache Statistics:"));
+    assert_non_null(strstr(buf, "Threads: 1"));
+
+    alloc.deallocate(alloc.ctx);
+    assert_int_equal(buddy_alloc(buddy), 0u);
+    free_buddy(buddy);
+}
+// --------------------------------------------------------------------------------
+
+typedef struct {
+    allocator_vtable_t alloc;
+    unsigned           seed;
+    bool               ok;
+} tcache_worker_t;
+
+static void *tcache_worker(void *arg) {
+    tcache_worker_t *w = (tcache_worker_t *)arg;
+    void  *live[64] = { NULL };
+    size_t size[64] = { 0u };
+    unsigned x = w->seed;
+    w->ok = true;
+
+    for (size_t i = 0u; i < TEST_TCACHE_ITERS; i++) {
+        x = x * 1103515245u + 12345u;
+        size_t const slot = (x >> 8) % 64u;
+
+        if (live[slot]) {
+            /* Every byte must still carry this slot's pattern */
+            for (size_t k = 0u; k < size[slot]; k++) {
+                if (((uint8_t *)live[slot])[k] != (uint8_t)(slot ^ w->seed)) {
+                    w->ok = false;
+                }
+            }
+            w->alloc.return_element(w->alloc.ctx, live[slot]);
+            live[slot] = NULL;
+        } else {
+            size_t const n = 16u + (x >> 16) % 2000u;
+            void_ptr_expect_t r = w->alloc.allocate(w->alloc.ctx, n, false);
+            if (!r.has_value) { w->ok = false; continue; }
+            memset(r.u.value, (int)(uint8_t)(slot ^ w->seed), n);
+            live[slot] = r.u.value;
+            size[slot] = n;
+        }
+    }
+    for (size_t s = 0u; s < 64u; s++) {
+        if (live[s]) w->alloc.return_element(w->alloc.ctx, live[s]);
+    }
+    return NULL;
+}
+// --------------------------------------------------------------------------------
+
+static void test_tcache_concurrent_threads(void **state) {
+    (void)state;
+    buddy_t *buddy      = create_tcache_buddy();
+    buddy_t *slab_buddy = create_tcache_buddy();
+    slab_expect_t s = init_slab_allocator(slab_buddy, 64u, 0u, 0u);
+    assert_true(s.has_value);
+
+    tcache_expect_t tx = init_tcache(buddy, s.u.value, 16u);
+    assert_true(tx.has_value);
+
+    pthread_t       tid[TEST_TCACHE_THREADS];
+    tcache_worker_t work[TEST_TCACHE_THREADS];
+    for (int i = 0; i < TEST_TCACHE_THREADS; i++) {
+        work[i] = (tcache_worker_t){ .alloc = tcache_allocator(tx.u.value),
+                                     .seed  = 7u + (unsigned)i * 31u };
+        assert_int_equal(pthread_create(&tid[i], NULL, tcache_worker, &work[i]), 0);
+    }
+    for (int i = 0; i < TEST_TCACHE_THREADS; i++) {
+        assert_int_equal(pthread_join(tid[i], NULL), 0);
+        assert_true(work[i].ok);
+    }
+
+    /* Exiting threads drained their magazines */
+    assert_int_equal(buddy_alloc(buddy), 0u);
+    assert_int_equal(slab_in_use_blocks(s.u.value), 0u);
+
+    free_tcache(tx.u.value);
+    free_buddy(slab_buddy);
+    free_buddy(buddy);
+}
+// --------------------------------------------------------------------------------
+
+const struct CMUnitTest test_tcache_allocator[] = {
+    cmocka_unit_test(test_init_tcache_invalid_args),
+    cmocka_unit_test(test_tcache_reuses_cached_blocks),
+    cmocka_unit_test(test_tcache_routes_slab_and_large_blocks),
+    cmocka_unit_test(test_tcache_realloc_preserves_data),
+    cmocka_unit_test(test_tcache_vtable_with_string),
+    cmocka_unit_test(test_tcache_concurrent_threads),
+};
+
+const size_t test_tcache_allocator_count = sizeof(test_tcache_allocator) / sizeof(test_tcache_allocator[0]);
+// ================================================================================
+// ================================================================================
+// TEST TRACING ALLOCATOR
+
+static void test_init_tracer_invalid_args(void **state) {
+    (void)state;
+    allocator_vtable_t inner = heap_allocator();
+    inner.return_element = NULL;
+
+    tracer_expect_t tx = init_tracer(inner, 1u, 0u);
+    assert_false(tx.has_value);
+    assert_int_equal(tx.u.error, INVALID_ARG);
+
+    tracer_summary_t s;
+    assert_false(tracer_summary(NULL, &s));
+    assert_int_equal(tracer_samples(NULL, NULL, 0u), 0u);
+    assert_false(reset_tracer(NULL));
+    assert_int_equal(tracer_write_csv(NULL, stdout), NULL_POINTER);
+    free_tracer(NULL);
+}
+// --------------------------------------------------------------------------------
+
+static void test_tracer_counts_bytes_and_size_classes(void **state) {
+    (void)state;
+    tracer_expect_t tx = init_tracer(heap_allocator(), 0u, 0u);
+    assert_true(tx.has_value);
+    allocator_vtable_t a = tracer_allocator(tx.u.value);
+
+    void_ptr_expect_t p = a.allocate(a.ctx, 100u, false);
+    void_ptr_expect_t q = a.allocate(a.ctx, 8u, true);
+    assert_true(p.has_value && q.has_value);
+    assert_int_equal((uintptr_t)p.u.value % alignof(max_align_t), 0u);
+    memset(p.u.value, 0xAB, 100u);
+
+    p = a.reallocate(a.ctx, p.u.value, 100u, 300u, true);
+    assert_true(p.has_value);
+    assert_int_equal(((uint8_t *)p.u.value)[99], 0xAB);
+    assert_int_equal(((uint8_t *)p.u.value)[100], 0u);
+
+    /* A zero-size request is rejected by the tracer itself */
+    assert_false(a.allocate(a.ctx, 0u, false).has_value);
+
+    tracer_summary_t s;
+    assert_true(tracer_summary(tx.u.value, &s));
+    assert_int_equal(s.events, 4u);
+    assert_int_equal(s.allocs, 2u);
+    assert_int_equal(s.reallocs, 1u);
+    assert_int_equal(s.failures, 1u);
+    assert_int_equal(s.live_bytes, 308u);
+    assert_int_equal(s.peak_live_bytes, 308u);
+    assert_int_equal(s.bytes_allocated, 408u);
+    assert_int_equal(s.bytes_freed, 100u);
+    assert_int_equal(s.size_classes[3], 1u);   /* 8   */
+    assert_int_equal(s.size_classes[7], 1u);   /* 100 */
+    assert_int_equal(s.size_classes[9], 1u);   /* 300 */
+    assert_int_equal(s.samples, 0u);
+
+    a.return_element(a.ctx, p.u.value);
+    a.return_element(a.ctx, q.u.value);
+    a.return_element(a.ctx, NULL);
+
+    assert_true(tracer_summary(tx.u.value, &s));
+    assert_int_equal(s.frees, 2u);
+    assert_int_equal(s.live_bytes, 0u);
+    assert_int_equal(s.peak_live_bytes, 308u);
+    assert_int_equal(s.bytes_freed, 408u);
+
+    free_tracer(tx.u.value);
+}
+// --------------------------------------------------------------------------------
+
+static void test_tracer_aligned_and_realignment(void **state) {
+    (void)state;
+    buddy_t *buddy = create_tcache_buddy();
+    tracer_expect_t tx = init_tracer(buddy_allocator(buddy), 0u, 0u);
+    assert_true(tx.has_value);
+    allocator_vtable_t a = tracer_allocator(tx.u.value);
+
+    void_ptr_expect_t p = a.allocate_aligned(a.ctx, 40u, 64u, false);
+    assert_true(p.has_value);
+    assert_int_equal((uintptr_t)p.u.value % 64u, 0u);
+    for (uint8_t i = 0u; i < 40u; i++) ((uint8_t *)p.u.value)[i] = i;
+
+    /* A stricter alignment changes the header layout and moves the data */
+    p = a.reallocate_aligned(a.ctx, p.u.value, 40u, 200u, true, 256u);
+    assert_true(p.has_value);
+    assert_int_equal((uintptr_t)p.u.value % 256u, 0u);
+    for (uint8_t i = 0u; i < 40u; i++) {
+        assert_int_equal(((uint8_t *)p.u.value)[i], i);
+    }
+    assert_int_equal(((uint8_t *)p.u.value)[199], 0u);
+
+    /* realloc() conventions: size 0 returns the block */
+    void_ptr_expect_t z = a.reallocate(a.ctx, p.u.value, 200u, 0u, false);
+    assert_true(z.has_value);
+    assert_null(z.u.value);
+
+    tracer_summary_t s;
+    assert_true(tracer_summary(tx.u.value, &s));
+    assert_int_equal(s.live_bytes, 0u);
+    assert_int_equal(s.peak_live_bytes, 200u);
+    assert_int_equal(buddy_alloc(buddy), 0u);
+
+    free_tracer(tx.u.value);
+    free_buddy(buddy);
+}
+// --------------------------------------------------------------------------------
+
+static void test_tracer_samples_ring(void **state) {
+    (void)state;
+    tracer_expect_t tx = init_tracer(heap_allocator(), 2u, 4u);
+    assert_true(tx.has_value);
+    allocator_vtable_t a = tracer_allocator(tx.u.value);
+
+    void *p[5];
+    for (size_t i = 0u; i < 5u; i++) {
+        void_ptr_expect_t r = a.allocate(a.ctx, 16u * (i + 1u), false);
+        assert_true(r.has_value);
+        p[i] = r.u.value;
+    }
+    for (size_t i = 0u; i < 5u; i++) {
+        a.return_element(a.ctx, p[i]);
+    }
+
+    /* Events 0, 2, 4, 6, 8 were sampled; the ring keeps the last four */
+    tracer_summary_t s;
+    assert_true(tracer_summary(tx.u.value, &s));
+    assert_int_equal(s.samples, 5u);
+    assert_int_equal(tracer_samples(tx.u.value, NULL, 0u), 4u);
+
+    trace_sample_t out[8];
+    assert_int_equal(tracer_samples(tx.u.value, out, 8u), 4u);
+    assert_int_equal(out[0].seq, 2u);
+    assert_int_equal(out[0].op, TRACE_ALLOC);
+    assert_int_equal(out[0].size, 48u);
+    assert_int_equal(out[0].ptr, (uint64_t)(uintptr_t)p[2]);
+    assert_int_equal(out[3].seq, 8u);
+    assert_int_equal(out[3].op, TRACE_FREE);
+    assert_int_equal(out[3].size, 64u);
+    for (size_t i = 0u; i < 4u; i++) {
+        assert_int_equal(out[i].ok, 1u);
+        assert_true(out[i].site != 0u);
+        if (i) assert_true(out[i].time_ns >= out[i - 1u].time_ns);
+    }
+
+    assert_true(reset_tracer(tx.u.value));
+    assert_int_equal(tracer_samples(tx.u.value, NULL, 0u), 0u);
+    assert_true(tracer_summary(tx.u.value, &s));
+    assert_int_equal(s.events, 0u);
+
+    free_tracer(tx.u.value);
+}
+// --------------------------------------------------------------------------------
+
+static void test_tracer_write_csv_and_binary(void **state) {
+    (void)state;
+    tracer_expect_t tx = init_tracer(heap_allocator(), 1u, 0u);
+    assert_true(tx.has_value);
+    allocator_vtable_t a = tracer_allocator(tx.u.value);
+
+    void_ptr_expect_t r = a.allocate(a.ctx, 24u, false);
+    assert_true(r.has_value);
+    a.return_element(a.ctx, r.u.value);
+
+    FILE *f = tmpfile();
+    assert_non_null(f);
+    assert_int_equal(tracer_write_csv(tx.u.value, f), NO_ERROR);
+    rewind(f);
+    char line[256];
+    assert_non_null(fgets(line, sizeof(line), f));
+    assert_string_equal(line, "seq,time_ns,op,size,ptr,site,ok\n");
+    assert_non_null(fgets(line, sizeof(line), f));
+    assert_non_null(strstr(line, ",alloc,24,0x"));
+    assert_non_null(fgets(line, sizeof(line), f));
+    assert_non_null(strstr(line, ",free,24,0x"));
+    assert_null(fgets(line, sizeof(line), f));
+    fclose(f);
+
+    f = tmpfile();
+    assert_non_null(f);
+    assert_int_equal(tracer_write_binary(tx.u.value, f), NO_ERROR);
+    rewind(f);
+    char     magic[8];
+    uint32_t version[2];
+    uint64_t counters[11u + TRACER_SIZE_CLASSES];
+    uint64_t count = 0u;
+    trace_sample_t rec[2];
+    assert_int_equal(fread(magic, 1u, 8u, f), 8u);
+    assert_memory_equal(magic, "CSALTTRC", 8u);
+    assert_int_equal(fread(version, sizeof(version), 1u, f), 1u);
+    assert_int_equal(version[0], 1u);
+    assert_int_equal(version[1], sizeof(trace_sample_t));
+    assert_int_equal(fread(counters, sizeof(counters), 1u, f), 1u);
+    assert_int_equal(counters[0], 1u);      /* sample_every */
+    assert_int_equal(counters[1], 2u);      /* events       */
+    assert_int_equal(counters[2], 1u);      /* allocs       */
+    assert_int_equal(counters[9], 24u);     /* peak bytes   */
+    assert_int_equal(counters[11u + 5u], 1u);
+    assert_int_equal(fread(&count, sizeof(count), 1u, f), 1u);
+    assert_int_equal(count, 2u);
+    assert_int_equal(fread(rec, sizeof(rec[0]), 2u, f), 2u);
+    assert_int_equal(rec[1].op, TRACE_FREE);
+    fclose(f);
+
+    free_tracer(tx.u.value);
+}
+// --------------------------------------------------------------------------------
+
+static void test_tracer_vtable_with_string(void **state) {
+    (void)state;
+    tracer_expect_t tx = init_tracer(heap_allocator(), 0u, 0u);
+    assert_true(tx.has_value);
+    allocator_vtable_t alloc = tracer_allocator(tx.u.value);
+
+    string_expect_t s = init_string("trace", 0u, alloc);
+    assert_true(s.has_value);
+    for (int i = 0; i < 50; i++) {
+        assert_true(str_concat(s.u.value, " me"));
+    }
+    assert_int_equal(string_size(s.u.value), 5u + 50u * 3u);
+    return_string(s.u.value);
+
+    char buf[1024];
+    assert_true(tracer_stats(tx.u.value, buf, sizeof(buf)));
+    assert_non_null(strstr(buf, "Tracer Statistics:"));
+    assert_non_null(strstr(buf, "Live bytes: 0"));
+    assert_non_null(strstr(buf, "Sampling: off"));
+
+    alloc.deallocate(alloc.ctx);
+}
+// --------------------------------------------------------------------------------
+
+static void test_tracer_concurrent_threads(void **state) {
+    (void)state;
+    buddy_t *buddy = create_tcache_buddy();
+    tcache_expect_t cx = init_tcache(buddy, NULL, 16u);
+    assert_true(cx.has_value);
+    tracer_expect_t tx = init_tracer(tcache_allocator(cx.u.value), 7u, 64u);
+    assert_true(tx.has_value);
+
+    pthread_t       tid[TEST_TCACHE_THREADS];
+    tcache_worker_t work[TEST_TCACHE_THREADS];
+    for (int i = 0; i < TEST_TCACHE_THREADS; i++) {
+        work[i] = (tcache_worker_t){ .alloc = tracer_allocator(tx.u.value),
+                                     .seed  = 3u + (unsigned)i * 17u };
+        assert_int_equal(pthread_create(&tid[i], NULL, tcache_worker, &work[i]), 0);
+    }
+    for (int i = 0; i < TEST_TCACHE_THREADS; i++) {
+        assert_int_equal(pthread_join(tid[i], NULL), 0);
+        assert_true(work[i].ok);
+    }
+
+    tracer_summary_t s;
+    assert_true(tracer_summary(tx.u.value, &s));
+    assert_int_equal(s.allocs, s.frees);
+    assert_int_equal(s.events, s.allocs + s.frees);
+    assert_int_equal(s.live_bytes, 0u);
+    assert_int_equal(s.bytes_allocated, s.bytes_freed);
+    assert_true(s.peak_live_bytes > 0u);
+    /* Each thread samples its own calls, rounding up once per thread */
+    assert_true(s.samples >= s.events / 7u);
+    assert_true(s.samples <= s.events / 7u + TEST_TCACHE_THREADS);
+
+    free_tracer(tx.u.value);
+    free_tcache(cx.u.value);
+    assert_int_equal(buddy_alloc(buddy), 0u);
+    free_buddy(buddy);
+}
+// --------------------------------------------------------------------------------
+
+typedef struct {
+    allocator_vtable_t alloc;
+    size_t             rounds;
+    bool               ok;
+} tracer_worker_t;
+
+static void *tracer_worker(void *arg) {
+    tracer_worker_t *w = arg;
+    w->ok = true;
+    for (size_t i = 0u; i < w->rounds; i++) {
+        void_ptr_expect_t r = w->alloc.allocate(w->alloc.ctx, 32u, false);
+        if (!r.has_value) {
+            w->ok = false;
+            return NULL;
+        }
+        w->alloc.return_element(w->alloc.ctx, r.u.value);
+    }
+    return NULL;
+}
+// --------------------------------------------------------------------------------
+
+static void test_tracer_shards_sum_across_threads(void **state) {
+    (void)state;
+    tracer_expect_t tx = init_tracer(heap_allocator(), 0u, 0u);
+    assert_true(tx.has_value);
+
+    pthread_t       tid[TEST_TCACHE_THREADS];
+    tracer_worker_t work[TEST_TCACHE_THREADS];
+    for (int i = 0; i < TEST_TCACHE_THREADS; i++) {
+        work[i] = (tracer_worker_t){ .alloc  = tracer_allocator(tx.u.value),
+                                     .rounds = 1000u };
+        assert_int_equal(pthread_create(&tid[i], NULL, tracer_worker, &work[i]), 0);
+    }
+    for (int i = 0; i < TEST_TCACHE_THREADS; i++) {
+        assert_int_equal(pthread_join(tid[i], NULL), 0);
+        assert_true(work[i].ok);
+    }
+
+    tracer_summary_t s;
+    assert_true(tracer_summary(tx.u.value, &s));
+    assert_int_equal(s.allocs, 1000u * TEST_TCACHE_THREADS);
+    assert_int_equal(s.frees, 1000u * TEST_TCACHE_THREADS);
+    assert_int_equal(s.events, 2000u * TEST_TCACHE_THREADS);
+    assert_int_equal(s.bytes_allocated, 32000u * TEST_TCACHE_THREADS);
+    assert_int_equal(s.size_classes[5], 1000u * TEST_TCACHE_THREADS);
+    assert_int_equal(s.live_bytes, 0u);
+
+    assert_true(reset_tracer(tx.u.value));
+    assert_true(tracer_summary(tx.u.value, &s));
+    assert_int_equal(s.events, 0u);
+    assert_int_equal(s.size_classes[5], 0u);
+
+    free_tracer(tx.u.value);
+}
+// --------------------------------------------------------------------------------
+
+static void test_tracer_size_table_wraps_pool(void **state) {
+    (void)state;
+    pool_expect_t px = init_dynamic_pool(64u, 16u, 64u, 8192u, 8192u, true, false);
+    assert_true(px.has_value);
+
+    /* A full pool block plus a header does not fit in one block */
+    tracer_expect_t hx = init_tracer(pool_allocator(px.u.value), 0u, 0u);
+    assert_true(hx.has_value);
+    allocator_vtable_t h = tracer_allocator(hx.u.value);
+    assert_false(h.allocate(h.ctx, 64u, false).has_value);
+    free_tracer(hx.u.value);
+
+    tracer_expect_t tx = init_tracer_with_size_table(pool_allocator(px.u.value), 1u, 0u);
+    assert_true(tx.has_value);
+    allocator_vtable_t a = tracer_allocator(tx.u.value);
+
+    /* Enough blocks to grow every table shard past its first size */
+    enum { N = 2000 };
+    void **blocks = malloc(N * sizeof(*blocks));
+    assert_non_null(blocks);
+    for (size_t i = 0u; i < N; i++) {
+        void_ptr_expect_t r = a.allocate(a.ctx, 64u - (i % 4u), false);
+        assert_true(r.has_value);
+        memset(r.u.value, (int)(i & 0xFFu), 64u - (i % 4u));
+        blocks[i] = r.u.value;
+    }
+
+    tracer_summary_t s;
+    assert_true(tracer_summary(tx.u.value, &s));
+    assert_int_equal(s.allocs, N);
+    assert_int_equal(s.failures, 0u);
+    assert_int_equal(s.live_bytes, (64u + 63u + 62u + 61u) * (N / 4u));
+    assert_int_equal(s.peak_live_bytes, s.live_bytes);
+
+    /* Resizing within the block keeps the pointer and updates the size */
+    void_ptr_expect_t r = a.reallocate(a.ctx, blocks[1], 63u, 16u, false);
+    assert_true(r.has_value);
+    blocks[1] = r.u.value;
+
+    for (size_t i = 0u; i < N; i += 2u) {
+        a.return_element(a.ctx, blocks[i]);
+    }
+    for (size_t i = 1u; i < N; i += 2u) {
+        a.return_element(a.ctx, blocks[i]);
+    }
+    free(blocks);
+
+    assert_true(tracer_summary(tx.u.value, &s));
+    assert_int_equal(s.frees, N);
+    assert_int_equal(s.reallocs, 1u);
+    assert_int_equal(s.live_bytes, 0u);
+    assert_int_equal(s.bytes_freed, s.bytes_allocated);
+    assert_int_equal(s.failures, 0u);
+
+    /* A pointer the tracer never handed out is forwarded and reported */
+    pool_t *pool = px.u.value;
+    void_ptr_expect_t stray = alloc_pool(pool, false);
+    assert_true(stray.has_value);
+    a.return_element(a.ctx, stray.u.value);
+    assert_true(tracer_summary(tx.u.value, &s));
+    assert_int_equal(s.failures, 1u);
+    assert_int_equal(s.frees, N);
+
+    free_tracer(tx.u.value);
+    free_pool(pool);
+}
+// --------------------------------------------------------------------------------
+
+const struct CMUnitTest test_tracer_allocator[] = {
+    cmocka_unit_test(test_init_tracer_invalid_args),
+    cmocka_unit_test(test_tracer_counts_bytes_and_size_classes),
+    cmocka_unit_test(test_tracer_aligned_and_realignment),
+    cmocka_unit_test(test_tracer_samples_ring),
+    cmocka_unit_test(test_tracer_write_csv_and_binary),
+    cmocka_unit_test(test_tracer_vtable_with_string),
+    cmocka_unit_test(test_tracer_concurrent_threads),
+    cmocka_unit_test(test_tracer_shards_sum_across_threads),
+    cmocka_unit_test(test_tracer_size_table_wraps_pool),
+};
+
+const size_t test_tracer_allocator_count = sizeof(test_tracer_allocator) / sizeof(test_tracer_allocator[0]);
+// ================================================================================
+// ================================================================================
 // eof
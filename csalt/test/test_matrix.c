@@ -15,6 +15,8 @@
 #include <stdarg.h>
 #include <stddef.h>
 #include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
 #include <cmocka.h>
 
 #include "c_matrix.h"
@@ -69,7 +71,7 @@ typedef struct {
 } test_record_t;
 
 // Use a test-local custom dtype id that should not collide with builtins.
-#define TEST_RECORD_TYPE (USER_BASE_TYPE + 10u)
+#define TEST_RECORD_TYPE (USER_BASE_TYPE + 20u)
 // --------------------------------------------------------------------------------
 
 static void _ensure_test_record_dtype_registered(void) {
@@ -2704,6 +2706,1311 @@ static void test_transpose_dense_custom_struct_preserves_values(void** state) {
     return_matrix(tr);
     return_matrix(src);
 }
+// ================================================================================
+// Group 18: matrix products
+// ================================================================================
+
+/* Small integers keep every float / double product exact, so the SIMD and
+ * threaded results can be compared against a naive loop with ==.  Entries
+ * where (i + 2j + seed) % sparsity != 0 are zero. */
+static double _product_entry(size_t i, size_t j, size_t seed, size_t sparsity) {
+    if (sparsity > 1u && (i + 2u * j + seed) % sparsity != 0u) return 0.0;
+    return (double)((i * 7u + j * 3u + seed) % 11u) - 5.0;
+}
+
+// --------------------------------------------------------------------------------
+
+static matrix_t* _make_product_matrix(size_t rows, size_t cols, dtype_id_t dtype,
+                                      size_t seed, size_t sparsity) {
+    matrix_expect_t r = init_dense_matrix(rows, cols, dtype, heap_allocator());
+    assert_true(r.has_value);
+    for (size_t i = 0u; i < rows; i++) {
+        for (size_t j = 0u; j < cols; j++) {
+            double const d = _product_entry(i, j, seed, sparsity);
+            float  const f = (float)d;
+            if (d == 0.0) continue;
+            assert_int_equal(set_matrix(r.u.value, i, j,
+                                        dtype == FLOAT_TYPE ? (const void*)&f
+                                                            : (const void*)&d),
+                             NO_ERROR);
+        }
+    }
+    return r.u.value;
+}
+
+// --------------------------------------------------------------------------------
+
+static double _matrix_entry_as_double(const matrix_t* mat, size_t i, size_t j) {
+    double d = 0.0;
+    float  f = 0.0f;
+    if (matrix_dtype(mat) == FLOAT_TYPE) {
+        assert_int_equal(get_matrix(mat, i, j, &f), NO_ERROR);
+        return (double)f;
+    }
+    assert_int_equal(get_matrix(mat, i, j, &d), NO_ERROR);
+    return d;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Check c == a * b entry by entry against a naive triple loop */
+static void _assert_product(const matrix_t* c, const matrix_t* a, const matrix_t* b) {
+    for (size_t i = 0u; i < matrix_rows(a); i++) {
+        for (size_t j = 0u; j < matrix_cols(b); j++) {
+            double ref = 0.0;
+            for (size_t p = 0u; p < matrix_cols(a); p++)
+                ref += _matrix_entry_as_double(a, i, p) * _matrix_entry_as_double(b, p, j);
+            assert_true(_matrix_entry_as_double(c, i, j) == ref);
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+/* Check y == op(a) x for a column vector x and y */
+static void _assert_gemv(const matrix_t* y, const matrix_t* a, const matrix_t* x,
+                         bool transpose) {
+    size_t const out = transpose ? matrix_cols(a) : matrix_rows(a);
+    size_t const in  = transpose ? matrix_rows(a) : matrix_cols(a);
+    for (size_t i = 0u; i < out; i++) {
+        double ref = 0.0;
+        for (size_t p = 0u; p < in; p++) {
+            double const av = transpose ? _matrix_entry_as_double(a, p, i)
+                                        : _matrix_entry_as_double(a, i, p);
+            ref += av * _matrix_entry_as_double(x, p, 0u);
+        }
+        assert_true(_matrix_entry_as_double(y, i, 0u) == ref);
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_matrix_multiply_vector_rejects_bad_arguments(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    matrix_t* a  = _make_product_matrix(3u, 4u, DOUBLE_TYPE, 0u, 1u);
+    matrix_t* x  = init_col_vector(4u, DOUBLE_TYPE, alloc).u.value;
+    matrix_t* y  = init_col_vector(3u, DOUBLE_TYPE, alloc).u.value;
+    matrix_t* xf = init_col_vector(4u, FLOAT_TYPE, alloc).u.value;
+    matrix_t* ai = _make_dense_int32_matrix(3u, 4u);
+    matrix_t* xi = init_col_vector(4u, INT32_TYPE, alloc).u.value;
+    matrix_t* yi = init_col_vector(3u, INT32_TYPE, alloc).u.value;
+
+    assert_int_equal(matrix_multiply_vector(NULL, a, x, false, 1u), NULL_POINTER);
+    assert_int_equal(matrix_multiply_vector(y, NULL, x, false, 1u), NULL_POINTER);
+    assert_int_equal(matrix_multiply_vector(y, a, NULL, false, 1u), NULL_POINTER);
+    assert_int_equal(matrix_multiply_vector(x, a, x, false, 1u), INVALID_ARG);
+    assert_int_equal(matrix_multiply_vector(y, a, xf, false, 1u), TYPE_MISMATCH);
+    assert_int_equal(matrix_multiply_vector(yi, ai, xi, false, 1u), TYPE_MISMATCH);
+
+    /* Lengths are swapped for the transpose */
+    assert_int_equal(matrix_multiply_vector(y, a, x, true, 1u), SIZE_MISMATCH);
+    assert_int_equal(matrix_multiply_vector(x, a, y, true, 1u), NO_ERROR);
+
+    matrix_expect_t coo = convert_matrix(a, COO_MATRIX, alloc);
+    assert_true(coo.has_value);
+    assert_int_equal(matrix_multiply_vector(y, coo.u.value, x, false, 1u), INVALID_ARG);
+
+    return_matrix(coo.u.value);
+    return_matrix(yi);
+    return_matrix(xi);
+    return_matrix(ai);
+    return_matrix(xf);
+    return_matrix(y);
+    return_matrix(x);
+    return_matrix(a);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_matrix_multiply_vector_dense_matches_reference(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+    dtype_id_t const types[] = { FLOAT_TYPE, DOUBLE_TYPE };
+
+    for (size_t t = 0u; t < 2u; t++) {
+        matrix_t* a  = _make_product_matrix(301u, 203u, types[t], 1u, 1u);
+        matrix_t* x  = _make_product_matrix(203u, 1u, types[t], 2u, 1u);
+        matrix_t* xt = _make_product_matrix(301u, 1u, types[t], 3u, 1u);
+        matrix_t* y  = init_col_vector(301u, types[t], alloc).u.value;
+        matrix_t* yt = init_col_vector(203u, types[t], alloc).u.value;
+
+        assert_int_equal(matrix_multiply_vector(y, a, x, false, 4u), NO_ERROR);
+        _assert_gemv(y, a, x, false);
+
+        assert_int_equal(matrix_multiply_vector(yt, a, xt, true, 4u), NO_ERROR);
+        _assert_gemv(yt, a, xt, true);
+
+        return_matrix(yt);
+        return_matrix(y);
+        return_matrix(xt);
+        return_matrix(x);
+        return_matrix(a);
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_matrix_multiply_vector_sparse_matches_reference(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+    dtype_id_t const types[] = { FLOAT_TYPE, DOUBLE_TYPE };
+    matrix_format_t const formats[] = { CSR_MATRIX, CSC_MATRIX };
+
+    for (size_t t = 0u; t < 2u; t++) {
+        matrix_t* dense = _make_product_matrix(257u, 129u, types[t], 0u, 5u);
+        matrix_t* x     = _make_product_matrix(129u, 1u, types[t], 4u, 1u);
+        matrix_t* xt    = _make_product_matrix(257u, 1u, types[t], 5u, 1u);
+        matrix_t* y     = init_col_vector(257u, types[t], alloc).u.value;
+        matrix_t* yt    = init_col_vector(129u, types[t], alloc).u.value;
+
+        for (size_t f = 0u; f < 2u; f++) {
+            matrix_expect_t s = convert_matrix(dense, formats[f], alloc);
+            assert_true(s.has_value);
+
+            assert_int_equal(matrix_multiply_vector(y, s.u.value, x, false, 3u), NO_ERROR);
+            _assert_gemv(y, dense, x, false);
+
+            assert_int_equal(matrix_multiply_vector(yt, s.u.value, xt, true, 3u), NO_ERROR);
+            _assert_gemv(yt, dense, xt, true);
+
+            return_matrix(s.u.value);
+        }
+
+        return_matrix(yt);
+        return_matrix(y);
+        return_matrix(xt);
+        return_matrix(x);
+        return_matrix(dense);
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_matrix_multiply_rejects_bad_arguments(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    matrix_t* a = _make_product_matrix(2u, 3u, FLOAT_TYPE, 0u, 1u);
+    matrix_t* b = _make_product_matrix(3u, 4u, FLOAT_TYPE, 0u, 1u);
+    matrix_t* d = _make_product_matrix(3u, 4u, DOUBLE_TYPE, 0u, 1u);
+    matrix_t* c = _make_product_matrix(2u, 5u, FLOAT_TYPE, 0u, 1u);
+
+    matrix_expect_t r = matrix_multiply(NULL, b, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, NULL_POINTER);
+
+    r = matrix_multiply(a, d, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, TYPE_MISMATCH);
+
+    r = matrix_multiply(b, a, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, SIZE_MISMATCH);
+
+    assert_int_equal(matrix_multiply_into(c, a, b, 1u), SIZE_MISMATCH);
+    assert_int_equal(matrix_multiply_into(a, a, b, 1u), INVALID_ARG);
+
+    matrix_expect_t csc = convert_matrix(a, CSC_MATRIX, alloc);
+    assert_true(csc.has_value);
+    r = matrix_multiply(csc.u.value, b, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, INVALID_ARG);
+
+    return_matrix(csc.u.value);
+    return_matrix(c);
+    return_matrix(d);
+    return_matrix(b);
+    return_matrix(a);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_matrix_multiply_dense_matches_reference(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+    dtype_id_t const types[] = { FLOAT_TYPE, DOUBLE_TYPE };
+
+    /* k crosses the GEMM_KC panel depth, n the SIMD width tails, and m
+     * leaves a 1-3 row remainder after the 4-row blocks */
+    for (size_t t = 0u; t < 2u; t++) {
+        matrix_t* a = _make_product_matrix(67u, 301u, types[t], 1u, 1u);
+        matrix_t* b = _make_product_matrix(301u, 37u, types[t], 2u, 1u);
+
+        matrix_expect_t r = matrix_multiply(a, b, 4u, alloc);
+        assert_true(r.has_value);
+        assert_int_equal((int)matrix_rows(r.u.value), 67);
+        assert_int_equal((int)matrix_cols(r.u.value), 37);
+        _assert_product(r.u.value, a, b);
+
+        /* The result is overwritten, not accumulated into */
+        assert_int_equal(matrix_multiply_into(r.u.value, a, b, 1u), NO_ERROR);
+        _assert_product(r.u.value, a, b);
+
+        return_matrix(r.u.value);
+        return_matrix(b);
+        return_matrix(a);
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_matrix_multiply_csr_dense_matches_reference(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    matrix_t* dense = _make_product_matrix(131u, 97u, DOUBLE_TYPE, 0u, 4u);
+    matrix_t* b     = _make_product_matrix(97u, 19u, DOUBLE_TYPE, 3u, 1u);
+    matrix_t* bv    = _make_product_matrix(97u, 1u, DOUBLE_TYPE, 5u, 1u);
+
+    matrix_expect_t csr = convert_matrix(dense, CSR_MATRIX, alloc);
+    assert_true(csr.has_value);
+
+    matrix_expect_t r = matrix_multiply(csr.u.value, b, 3u, alloc);
+    assert_true(r.has_value);
+    _assert_product(r.u.value, dense, b);
+
+    /* A single-column B takes the SpMV path */
+    matrix_expect_t rv = matrix_multiply(csr.u.value, bv, 3u, alloc);
+    assert_true(rv.has_value);
+    _assert_product(rv.u.value, dense, bv);
+
+    return_matrix(rv.u.value);
+    return_matrix(r.u.value);
+    return_matrix(csr.u.value);
+    return_matrix(bv);
+    return_matrix(b);
+    return_matrix(dense);
+}
+
+// ================================================================================
+// Group 19: sparse products and sums
+// ================================================================================
+
+/* Check that every row (column) of a compressed matrix has strictly
+ * increasing indices */
+static void _assert_compressed_sorted(const matrix_t* mat) {
+    bool const    csr   = matrix_format(mat) == CSR_MATRIX;
+    size_t const  lines = csr ? matrix_rows(mat) : matrix_cols(mat);
+    const size_t* ptr   = csr ? mat->rep.csr.row_ptr : mat->rep.csc.col_ptr;
+    const size_t* idx   = csr ? mat->rep.csr.col_idx : mat->rep.csc.row_idx;
+    for (size_t i = 0u; i < lines; i++)
+        for (size_t p = ptr[i] + 1u; p < ptr[i + 1u]; p++)
+            assert_true(idx[p - 1u] < idx[p]);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_matrix_sparse_multiply_rejects_bad_arguments(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    matrix_t* dense = _make_product_matrix(4u, 4u, DOUBLE_TYPE, 0u, 2u);
+    matrix_t* wide  = _make_product_matrix(5u, 4u, DOUBLE_TYPE, 0u, 2u);
+    matrix_t* ints  = _make_dense_int32_matrix(4u, 4u);
+    matrix_t* csr   = convert_matrix(dense, CSR_MATRIX, alloc).u.value;
+    matrix_t* csc   = convert_matrix(dense, CSC_MATRIX, alloc).u.value;
+    matrix_t* csr5  = convert_matrix(wide, CSR_MATRIX, alloc).u.value;
+    matrix_t* icsr  = convert_matrix(ints, CSR_MATRIX, alloc).u.value;
+
+    matrix_expect_t r = matrix_sparse_multiply(NULL, csr, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, NULL_POINTER);
+
+    r = matrix_sparse_multiply(csr, csc, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, INVALID_ARG);
+
+    r = matrix_sparse_multiply(dense, dense, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, INVALID_ARG);
+
+    r = matrix_sparse_multiply(csr, csr5, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, SIZE_MISMATCH);
+
+    r = matrix_sparse_multiply(icsr, icsr, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, TYPE_MISMATCH);
+
+    /* The structure alone is dtype-agnostic */
+    r = matrix_spgemm_symbolic(icsr, icsr, 1u, alloc);
+    assert_true(r.has_value);
+    assert_int_equal(matrix_spgemm_numeric(r.u.value, icsr, icsr, 1u), TYPE_MISMATCH);
+    return_matrix(r.u.value);
+
+    r = matrix_sparse_add(csr, csc, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, INVALID_ARG);
+
+    r = matrix_sparse_subtract(csr, csr5, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, SIZE_MISMATCH);
+
+    return_matrix(icsr);
+    return_matrix(csr5);
+    return_matrix(csc);
+    return_matrix(csr);
+    return_matrix(ints);
+    return_matrix(wide);
+    return_matrix(dense);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_matrix_sparse_multiply_matches_dense_product(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+    dtype_id_t const types[] = { FLOAT_TYPE, DOUBLE_TYPE };
+    matrix_format_t const formats[] = { CSR_MATRIX, CSC_MATRIX };
+
+    for (size_t t = 0u; t < 2u; t++) {
+        matrix_t* a = _make_product_matrix(61u, 47u, types[t], 1u, 4u);
+        matrix_t* b = _make_product_matrix(47u, 53u, types[t], 2u, 3u);
+
+        for (size_t f = 0u; f < 2u; f++) {
+            matrix_t* sa = convert_matrix(a, formats[f], alloc).u.value;
+            matrix_t* sb = convert_matrix(b, formats[f], alloc).u.value;
+
+            /* matrix_multiply keeps two same-format sparse operands sparse */
+            matrix_expect_t r = matrix_multiply(sa, sb, 4u, alloc);
+            assert_true(r.has_value);
+            assert_int_equal((int)matrix_format(r.u.value), (int)formats[f]);
+            assert_int_equal((int)matrix_rows(r.u.value), 61);
+            assert_int_equal((int)matrix_cols(r.u.value), 53);
+            _assert_compressed_sorted(r.u.value);
+            _assert_product(r.u.value, a, b);
+
+            return_matrix(r.u.value);
+            return_matrix(sb);
+            return_matrix(sa);
+        }
+        return_matrix(b);
+        return_matrix(a);
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_matrix_spgemm_numeric_reuses_structure(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    matrix_t* a  = _make_product_matrix(33u, 29u, DOUBLE_TYPE, 3u, 5u);
+    matrix_t* b  = _make_product_matrix(29u, 31u, DOUBLE_TYPE, 4u, 5u);
+    matrix_t* sa = convert_matrix(a, CSR_MATRIX, alloc).u.value;
+    matrix_t* sb = convert_matrix(b, CSR_MATRIX, alloc).u.value;
+
+    matrix_expect_t s = matrix_spgemm_symbolic(sa, sb, 2u, alloc);
+    assert_true(s.has_value);
+    matrix_t* c = s.u.value;
+    size_t const nnz = matrix_nnz(c);
+
+    assert_int_equal(matrix_spgemm_numeric(c, sa, sb, 2u), NO_ERROR);
+    _assert_product(c, a, b);
+
+    /* New values on the same structure: A scaled by 3 */
+    double* av = (double*)sa->rep.csr.values;
+    for (size_t p = 0u; p < matrix_nnz(sa); p++) av[p] *= 3.0;
+    matrix_t* a3 = convert_matrix(sa, DENSE_MATRIX, alloc).u.value;
+
+    assert_int_equal(matrix_spgemm_numeric(c, sa, sb, 2u), NO_ERROR);
+    assert_int_equal((int)matrix_nnz(c), (int)nnz);
+    _assert_product(c, a3, b);
+
+    /* A denser A reaches entries outside the structure */
+    matrix_t* full  = _make_product_matrix(33u, 29u, DOUBLE_TYPE, 3u, 1u);
+    matrix_t* sfull = convert_matrix(full, CSR_MATRIX, alloc).u.value;
+    assert_int_equal(matrix_spgemm_numeric(c, sfull, sb, 2u), ILLEGAL_STATE);
+
+    return_matrix(sfull);
+    return_matrix(full);
+    return_matrix(a3);
+    return_matrix(c);
+    return_matrix(sb);
+    return_matrix(sa);
+    return_matrix(b);
+    return_matrix(a);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_matrix_sparse_multiply_wide_operand_uses_hash_accumulator(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    /* More columns than the dense accumulator covers */
+    size_t const wide = (1u << 18) + 7u;
+    matrix_t* a = init_coo_matrix(3u, 4u, 8u, DOUBLE_TYPE, true, alloc).u.value;
+    matrix_t* b = init_coo_matrix(4u, wide, 8u, DOUBLE_TYPE, true, alloc).u.value;
+
+    double const a00 = 2.0, a02 = 3.0, a21 = -1.0, a23 = 4.0;
+    double const b00 = 5.0, b0w = 7.0, b12 = 1.5, b2w = 2.0, b30 = -2.0;
+    assert_int_equal(push_back_coo_matrix(a, 0u, 0u, &a00), NO_ERROR);
+    assert_int_equal(push_back_coo_matrix(a, 0u, 2u, &a02), NO_ERROR);
+    assert_int_equal(push_back_coo_matrix(a, 2u, 1u, &a21), NO_ERROR);
+    assert_int_equal(push_back_coo_matrix(a, 2u, 3u, &a23), NO_ERROR);
+    assert_int_equal(push_back_coo_matrix(b, 0u, 0u, &b00), NO_ERROR);
+    assert_int_equal(push_back_coo_matrix(b, 0u, wide - 1u, &b0w), NO_ERROR);
+    assert_int_equal(push_back_coo_matrix(b, 1u, 2u, &b12), NO_ERROR);
+    assert_int_equal(push_back_coo_matrix(b, 2u, wide - 1u, &b2w), NO_ERROR);
+    assert_int_equal(push_back_coo_matrix(b, 3u, 0u, &b30), NO_ERROR);
+
+    matrix_t* sa = convert_matrix(a, CSR_MATRIX, alloc).u.value;
+    matrix_t* sb = convert_matrix(b, CSR_MATRIX, alloc).u.value;
+
+    matrix_expect_t r = matrix_sparse_multiply(sa, sb, 1u, alloc);
+    assert_true(r.has_value);
+    matrix_t* c = r.u.value;
+    _assert_compressed_sorted(c);
+
+    /* Row 0: 2*[5 .. 7] + 3*[.. 2] ; row 2: -1*[.. 1.5 ..] + 4*[-2 ..] */
+    assert_int_equal((int)matrix_nnz(c), 4);
+    double out = 0.0;
+    assert_int_equal(get_matrix(c, 0u, 0u, &out), NO_ERROR);
+    assert_true(out == 10.0);
+    assert_int_equal(get_matrix(c, 0u, wide - 1u, &out), NO_ERROR);
+    assert_true(out == 20.0);
+    assert_int_equal(get_matrix(c, 2u, 0u, &out), NO_ERROR);
+    assert_true(out == -8.0);
+    assert_int_equal(get_matrix(c, 2u, 2u, &out), NO_ERROR);
+    assert_true(out == -1.5);
+    assert_int_equal(get_matrix(c, 1u, 0u, &out), NO_ERROR);
+    assert_true(out == 0.0);
+
+    return_matrix(c);
+    return_matrix(sb);
+    return_matrix(sa);
+    return_matrix(b);
+    return_matrix(a);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_matrix_sparse_add_and_subtract_merge_structures(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+    dtype_id_t const types[] = { FLOAT_TYPE, DOUBLE_TYPE };
+    matrix_format_t const formats[] = { CSR_MATRIX, CSC_MATRIX };
+
+    for (size_t t = 0u; t < 2u; t++) {
+        matrix_t* a = _make_product_matrix(37u, 41u, types[t], 1u, 3u);
+        matrix_t* b = _make_product_matrix(37u, 41u, types[t], 2u, 4u);
+
+        /* Union of the two structures */
+        size_t expected_nnz = 0u;
+        for (size_t i = 0u; i < 37u; i++)
+            for (size_t j = 0u; j < 41u; j++)
+                expected_nnz += (_matrix_entry_as_double(a, i, j) != 0.0 ||
+                                 _matrix_entry_as_double(b, i, j) != 0.0);
+
+        for (size_t f = 0u; f < 2u; f++) {
+            matrix_t* sa = convert_matrix(a, formats[f], alloc).u.value;
+            matrix_t* sb = convert_matrix(b, formats[f], alloc).u.value;
+
+            matrix_expect_t sum = matrix_sparse_add(sa, sb, 3u, alloc);
+            matrix_expect_t dif = matrix_sparse_subtract(sa, sb, 3u, alloc);
+            assert_true(sum.has_value);
+            assert_true(dif.has_value);
+            assert_int_equal((int)matrix_format(sum.u.value), (int)formats[f]);
+            assert_int_equal((int)matrix_nnz(sum.u.value), (int)expected_nnz);
+            assert_int_equal((int)matrix_nnz(dif.u.value), (int)expected_nnz);
+            _assert_compressed_sorted(sum.u.value);
+            _assert_compressed_sorted(dif.u.value);
+
+            for (size_t i = 0u; i < 37u; i++) {
+                for (size_t j = 0u; j < 41u; j++) {
+                    double const x = _matrix_entry_as_double(a, i, j);
+                    double const y = _matrix_entry_as_double(b, i, j);
+                    assert_true(_matrix_entry_as_double(sum.u.value, i, j) == x + y);
+                    assert_true(_matrix_entry_as_double(dif.u.value, i, j) == x - y);
+                }
+            }
+
+            return_matrix(dif.u.value);
+            return_matrix(sum.u.value);
+            return_matrix(sb);
+            return_matrix(sa);
+        }
+        return_matrix(b);
+        return_matrix(a);
+    }
+}
+
+// ================================================================================
+// Group 20: convert_coo_matrix
+// ================================================================================
+
+/* A COO matrix whose triplets are written straight into its arrays, as an
+ * ingest path would, so repeated (row, col) pairs survive */
+static matrix_t* _make_raw_coo_matrix(size_t rows, size_t cols, dtype_id_t dtype,
+                                      const size_t* r, const size_t* c,
+                                      const void* values, size_t n) {
+    matrix_expect_t m = init_coo_matrix(rows, cols, n, dtype, false, heap_allocator());
+    assert_true(m.has_value);
+    coo_matrix_t* coo = &m.u.value->rep.coo;
+    memcpy(coo->row_idx, r, n * sizeof(size_t));
+    memcpy(coo->col_idx, c, n * sizeof(size_t));
+    memcpy(coo->values, values, n * m.u.value->data_size);
+    coo->nnz = n;
+    return m.u.value;
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_convert_coo_matrix_rejects_bad_arguments(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    matrix_t* dense = _make_dense_int32_matrix(2u, 2u);
+    matrix_t* rec   = _make_coo_record_matrix(2u, 2u, 1u, true);
+    matrix_t* coo   = _make_coo_int32_matrix(2u, 2u, 1u, true);
+
+    matrix_expect_t r = convert_coo_matrix(NULL, CSR_MATRIX, COO_DUPLICATE_SUM, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, NULL_POINTER);
+
+    r = convert_coo_matrix(dense, CSR_MATRIX, COO_DUPLICATE_SUM, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, ILLEGAL_STATE);
+
+    r = convert_coo_matrix(coo, DENSE_MATRIX, COO_DUPLICATE_SUM, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, ILLEGAL_STATE);
+
+    r = convert_coo_matrix(coo, CSR_MATRIX, (coo_duplicate_t)3, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, INVALID_ARG);
+
+    r = convert_coo_matrix(rec, CSC_MATRIX, COO_DUPLICATE_SUM, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, TYPE_MISMATCH);
+
+    /* Records can still be converted when nothing is summed */
+    r = convert_coo_matrix(rec, CSC_MATRIX, COO_DUPLICATE_FIRST, 1u, alloc);
+    assert_true(r.has_value);
+    return_matrix(r.u.value);
+
+    /* An empty COO matrix converts to an empty compressed one */
+    r = convert_coo_matrix(coo, CSR_MATRIX, COO_DUPLICATE_LAST, 1u, alloc);
+    assert_true(r.has_value);
+    assert_int_equal((int)matrix_nnz(r.u.value), 0);
+    return_matrix(r.u.value);
+
+    return_matrix(coo);
+    return_matrix(rec);
+    return_matrix(dense);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_convert_coo_matrix_resolves_duplicates(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    /* (1, 2) three times, (0, 1) twice cancelling, (2, 0) once */
+    size_t  const rows[] = { 1u, 0u, 2u, 1u, 0u, 1u };
+    size_t  const cols[] = { 2u, 1u, 0u, 2u, 1u, 2u };
+    int32_t const vals[] = { 4, 7, 9, 5, -7, 6 };
+    matrix_t* coo = _make_raw_coo_matrix(3u, 3u, INT32_TYPE, rows, cols, vals, 6u);
+
+    matrix_format_t const formats[] = { CSR_MATRIX, CSC_MATRIX };
+    for (size_t f = 0u; f < 2u; f++) {
+        int32_t out = 0;
+
+        matrix_expect_t last  = convert_coo_matrix(coo, formats[f], COO_DUPLICATE_LAST, 1u, alloc);
+        matrix_expect_t first = convert_coo_matrix(coo, formats[f], COO_DUPLICATE_FIRST, 1u, alloc);
+        matrix_expect_t sum   = convert_coo_matrix(coo, formats[f], COO_DUPLICATE_SUM, 1u, alloc);
+        assert_true(last.has_value && first.has_value && sum.has_value);
+        _assert_compressed_sorted(last.u.value);
+        _assert_compressed_sorted(sum.u.value);
+
+        assert_int_equal(get_matrix(last.u.value, 1u, 2u, &out), NO_ERROR);
+        assert_int_equal(out, 6);
+        assert_int_equal(get_matrix(last.u.value, 0u, 1u, &out), NO_ERROR);
+        assert_int_equal(out, -7);
+        assert_int_equal((int)matrix_nnz(last.u.value), 3);
+
+        assert_int_equal(get_matrix(first.u.value, 1u, 2u, &out), NO_ERROR);
+        assert_int_equal(out, 4);
+        assert_int_equal(get_matrix(first.u.value, 0u, 1u, &out), NO_ERROR);
+        assert_int_equal(out, 7);
+
+        /* The cancelled pair is not stored */
+        assert_int_equal(get_matrix(sum.u.value, 1u, 2u, &out), NO_ERROR);
+        assert_int_equal(out, 15);
+        assert_int_equal(get_matrix(sum.u.value, 2u, 0u, &out), NO_ERROR);
+        assert_int_equal(out, 9);
+        assert_int_equal((int)matrix_nnz(sum.u.value), 2);
+
+        return_matrix(sum.u.value);
+        return_matrix(first.u.value);
+        return_matrix(last.u.value);
+    }
+
+    /* convert_matrix keeps the last write, as the dense round trip did */
+    matrix_expect_t csr = convert_matrix(coo, CSR_MATRIX, alloc);
+    assert_true(csr.has_value);
+    int32_t out = 0;
+    assert_int_equal(get_matrix(csr.u.value, 1u, 2u, &out), NO_ERROR);
+    assert_int_equal(out, 6);
+    return_matrix(csr.u.value);
+
+    return_matrix(coo);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_convert_coo_matrix_parallel_matches_reference(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    /* Enough entries per row and column for several threads */
+    size_t const m = 97u, n = 89u, count = 150000u;
+    size_t* rows = malloc(count * sizeof(size_t));
+    size_t* cols = malloc(count * sizeof(size_t));
+    double* vals = malloc(count * sizeof(double));
+    double* sum  = calloc(m * n, sizeof(double));
+    double* last = calloc(m * n, sizeof(double));
+    assert_non_null(rows);
+    assert_non_null(cols);
+    assert_non_null(vals);
+    assert_non_null(sum);
+    assert_non_null(last);
+
+    uint64_t s = 0x2545F4914F6CDD1Dull;
+    for (size_t e = 0u; e < count; e++) {
+        s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+        rows[e] = (size_t)(s % m);
+        cols[e] = (size_t)((s >> 20) % n);
+        vals[e] = (double)((s >> 40) % 7u) + 1.0;
+        sum[rows[e] * n + cols[e]]  += vals[e];
+        last[rows[e] * n + cols[e]]  = vals[e];
+    }
+    matrix_t* coo = _make_raw_coo_matrix(m, n, DOUBLE_TYPE, rows, cols, vals, count);
+
+    matrix_format_t const formats[] = { CSR_MATRIX, CSC_MATRIX };
+    for (size_t f = 0u; f < 2u; f++) {
+        matrix_expect_t rs = convert_coo_matrix(coo, formats[f], COO_DUPLICATE_SUM, 4u, alloc);
+        matrix_expect_t rl = convert_coo_matrix(coo, formats[f], COO_DUPLICATE_LAST, 4u, alloc);
+        assert_true(rs.has_value);
+        assert_true(rl.has_value);
+        _assert_compressed_sorted(rs.u.value);
+        _assert_compressed_sorted(rl.u.value);
+
+        for (size_t i = 0u; i < m; i++) {
+            for (size_t j = 0u; j < n; j++) {
+                assert_true(_matrix_entry_as_double(rs.u.value, i, j) == sum[i * n + j]);
+                assert_true(_matrix_entry_as_double(rl.u.value, i, j) == last[i * n + j]);
+            }
+        }
+        return_matrix(rl.u.value);
+        return_matrix(rs.u.value);
+    }
+
+    return_matrix(coo);
+    free(last);
+    free(sum);
+    free(vals);
+    free(cols);
+    free(rows);
+}
+
+// ================================================================================
+// Group 21: tiled dense transpose
+// ================================================================================
+
+/* Fill a dense matrix with the byte pattern of its element index, so every
+ * element of every size is distinct */
+static matrix_t* _make_indexed_dense_matrix(size_t rows, size_t cols, dtype_id_t dtype) {
+    matrix_expect_t r = init_dense_matrix(rows, cols, dtype, heap_allocator());
+    assert_true(r.has_value);
+    matrix_t* mat = r.u.value;
+    size_t const ds = matrix_data_size(mat);
+    for (size_t e = 0u; e < rows * cols; e++)
+        for (size_t b = 0u; b < ds; b++)
+            mat->rep.dense.data[e * ds + b] = (uint8_t)((e * 7u + b * 131u) ^ (e >> 8));
+    return mat;
+}
+
+// --------------------------------------------------------------------------------
+
+/* Check t holds the transpose of s, compared byte for byte */
+static void _assert_dense_transposed(const matrix_t* t, const matrix_t* s) {
+    size_t const ds = matrix_data_size(s);
+    assert_int_equal((int)matrix_rows(t), (int)matrix_cols(s));
+    assert_int_equal((int)matrix_cols(t), (int)matrix_rows(s));
+    for (size_t i = 0u; i < matrix_rows(s); i++)
+        for (size_t j = 0u; j < matrix_cols(s); j++)
+            assert_memory_equal(t->rep.dense.data + (j * matrix_rows(s) + i) * ds,
+                                s->rep.dense.data + (i * matrix_cols(s) + j) * ds, ds);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_transpose_dense_tiled_all_element_sizes(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    /* 4- and 8-byte elements take the SIMD tile kernels, the rest the
+     * generic copy; the shape leaves partial tiles on both edges */
+    dtype_id_t const types[] = { FLOAT_TYPE, DOUBLE_TYPE, INT16_TYPE, INT64_TYPE };
+    for (size_t t = 0u; t < 4u; t++) {
+        matrix_t* src = _make_indexed_dense_matrix(131u, 77u, types[t]);
+        matrix_expect_t r = transpose_matrix(src, alloc);
+        assert_true(r.has_value);
+        _assert_dense_transposed(r.u.value, src);
+        return_matrix(r.u.value);
+        return_matrix(src);
+    }
+
+    matrix_t* rec = _make_dense_record_matrix(67u, 70u);
+    for (size_t e = 0u; e < 67u * 70u; e++)
+        ((test_record_t*)rec->rep.dense.data)[e] = (test_record_t){ (int)e, 0.5 * (double)e, (unsigned)e };
+    matrix_expect_t r = transpose_matrix(rec, alloc);
+    assert_true(r.has_value);
+    _assert_dense_transposed(r.u.value, rec);
+    return_matrix(r.u.value);
+    return_matrix(rec);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_transpose_dense_streams_large_results(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    /* Over 1 MiB with source columns a whole number of 64-byte lines, so
+     * the result goes through the streaming band kernels; heap blocks are
+     * not line aligned, and 517 columns leave a partial block and a
+     * partial kernel step */
+    dtype_id_t const types[] = { FLOAT_TYPE, DOUBLE_TYPE };
+    size_t const     rows[]  = { 528u, 264u };
+    for (size_t t = 0u; t < 2u; t++) {
+        matrix_t* src = _make_indexed_dense_matrix(rows[t], 517u, types[t]);
+        matrix_expect_t r = transpose_matrix(src, alloc);
+        assert_true(r.has_value);
+        _assert_dense_transposed(r.u.value, src);
+        return_matrix(r.u.value);
+        return_matrix(src);
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_transpose_matrix_inplace_rejects_bad_arguments(void** state) {
+    (void)state;
+
+    matrix_t* rect = _make_dense_int32_matrix(3u, 4u);
+    matrix_t* coo  = _make_coo_int32_matrix(3u, 3u, 2u, true);
+
+    assert_int_equal(transpose_matrix_inplace(NULL), NULL_POINTER);
+    assert_int_equal(transpose_matrix_inplace(rect), INVALID_ARG);
+    assert_int_equal(transpose_matrix_inplace(coo), ILLEGAL_STATE);
+
+    return_matrix(coo);
+    return_matrix(rect);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_transpose_matrix_inplace_matches_out_of_place(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    dtype_id_t const types[] = { FLOAT_TYPE, DOUBLE_TYPE, INT16_TYPE };
+    size_t const     sizes[] = { 1u, 63u, 150u };
+    for (size_t t = 0u; t < 3u; t++) {
+        for (size_t k = 0u; k < 3u; k++) {
+            matrix_t* mat = _make_indexed_dense_matrix(sizes[k], sizes[k], types[t]);
+            matrix_t* ref = copy_matrix(mat, alloc).u.value;
+
+            assert_int_equal(transpose_matrix_inplace(mat), NO_ERROR);
+            _assert_dense_transposed(mat, ref);
+
+            /* Twice is the identity */
+            assert_int_equal(transpose_matrix_inplace(mat), NO_ERROR);
+            assert_memory_equal(mat->rep.dense.data, ref->rep.dense.data,
+                                sizes[k] * sizes[k] * matrix_data_size(mat));
+
+            return_matrix(ref);
+            return_matrix(mat);
+        }
+    }
+}
+
+// ================================================================================
+// Group 22: BSR and SELL-C-sigma formats
+// ================================================================================
+
+static void test_convert_blocked_formats_reject_bad_arguments(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+    matrix_t* a = _make_product_matrix(5u, 7u, FLOAT_TYPE, 0u, 2u);
+
+    matrix_expect_t r = convert_to_bsr_matrix(NULL, 2u, 2u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, NULL_POINTER);
+
+    r = convert_to_bsr_matrix(a, 0u, 2u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, INVALID_ARG);
+
+    r = convert_to_sell_matrix(NULL, 8u, 8u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, NULL_POINTER);
+
+    /* chunk must be 1..64, sigma 1 or a multiple of chunk */
+    r = convert_to_sell_matrix(a, 0u, 8u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, INVALID_ARG);
+    r = convert_to_sell_matrix(a, 65u, 65u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, INVALID_ARG);
+    r = convert_to_sell_matrix(a, 8u, 12u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, INVALID_ARG);
+
+    /* Neither format accepts scattered writes */
+    r = convert_to_bsr_matrix(a, 2u, 3u, alloc);
+    assert_true(r.has_value);
+    float const one = 1.0f;
+    assert_int_equal(set_matrix(r.u.value, 0u, 0u, &one), ILLEGAL_STATE);
+    return_matrix(r.u.value);
+
+    r = convert_to_sell_matrix(a, 4u, 8u, alloc);
+    assert_true(r.has_value);
+    assert_int_equal(set_matrix(r.u.value, 0u, 0u, &one), ILLEGAL_STATE);
+    return_matrix(r.u.value);
+
+    return_matrix(a);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_convert_blocked_formats_round_trip(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+    dtype_id_t const types[] = { FLOAT_TYPE, DOUBLE_TYPE, INT32_TYPE };
+
+    for (size_t t = 0u; t < 3u; t++) {
+        /* Neither 37 nor 29 is a multiple of any block shape or chunk */
+        matrix_t* dense = (types[t] == INT32_TYPE)
+                        ? _make_indexed_dense_matrix(37u, 29u, INT32_TYPE)
+                        : _make_product_matrix(37u, 29u, types[t], 7u, 3u);
+        matrix_expect_t csr = convert_matrix(dense, CSR_MATRIX, alloc);
+        assert_true(csr.has_value);
+
+        matrix_expect_t bsr = convert_to_bsr_matrix(dense, 3u, 4u, alloc);
+        assert_true(bsr.has_value);
+        assert_int_equal(matrix_format(bsr.u.value), BSR_MATRIX);
+        assert_int_equal((int)bsr.u.value->rep.bsr.block_rows, 3);
+        assert_int_equal((int)bsr.u.value->rep.bsr.block_cols, 4);
+        assert_true(matrix_equal(bsr.u.value, dense));
+
+        matrix_expect_t sell = convert_to_sell_matrix(csr.u.value, 8u, 16u, alloc);
+        assert_true(sell.has_value);
+        assert_int_equal(matrix_format(sell.u.value), SELL_MATRIX);
+        assert_int_equal((int)matrix_nnz(sell.u.value), (int)matrix_nnz(csr.u.value));
+        assert_true(matrix_equal(sell.u.value, dense));
+
+        /* Back out through every other format */
+        matrix_format_t const formats[] = { DENSE_MATRIX, COO_MATRIX, CSR_MATRIX, CSC_MATRIX };
+        for (size_t f = 0u; f < 4u; f++) {
+            matrix_expect_t b = convert_matrix(bsr.u.value, formats[f], alloc);
+            matrix_expect_t s = convert_matrix(sell.u.value, formats[f], alloc);
+            assert_true(b.has_value);
+            assert_true(s.has_value);
+            assert_int_equal(matrix_format(b.u.value), formats[f]);
+            assert_int_equal(matrix_format(s.u.value), formats[f]);
+            assert_true(matrix_equal(b.u.value, dense));
+            assert_true(matrix_equal(s.u.value, dense));
+            return_matrix(s.u.value);
+            return_matrix(b.u.value);
+        }
+
+        /* BSR -> SELL and back uses the default shapes */
+        matrix_expect_t s2 = convert_matrix(bsr.u.value, SELL_MATRIX, alloc);
+        assert_true(s2.has_value);
+        assert_int_equal((int)s2.u.value->rep.sell.chunk, 8);
+        assert_true(matrix_equal(s2.u.value, dense));
+        matrix_expect_t b2 = convert_matrix(s2.u.value, BSR_MATRIX, alloc);
+        assert_true(b2.has_value);
+        assert_int_equal((int)b2.u.value->rep.bsr.block_rows, 4);
+        assert_true(matrix_equal(b2.u.value, dense));
+
+        matrix_expect_t bc = copy_matrix(bsr.u.value, alloc);
+        matrix_expect_t sc = copy_matrix(sell.u.value, alloc);
+        assert_true(bc.has_value);
+        assert_true(sc.has_value);
+        assert_true(matrix_equal(bc.u.value, dense));
+        assert_true(matrix_equal(sc.u.value, dense));
+
+        return_matrix(sc.u.value);
+        return_matrix(bc.u.value);
+        return_matrix(b2.u.value);
+        return_matrix(s2.u.value);
+        return_matrix(sell.u.value);
+        return_matrix(bsr.u.value);
+        return_matrix(csr.u.value);
+        return_matrix(dense);
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_transpose_blocked_formats_preserves_values(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    matrix_t*       dense = _make_product_matrix(23u, 17u, DOUBLE_TYPE, 2u, 2u);
+    matrix_expect_t ref   = transpose_matrix(dense, alloc);
+    matrix_expect_t bsr   = convert_to_bsr_matrix(dense, 2u, 5u, alloc);
+    matrix_expect_t sell  = convert_to_sell_matrix(dense, 4u, 1u, alloc);
+    assert_true(ref.has_value);
+    assert_true(bsr.has_value);
+    assert_true(sell.has_value);
+
+    matrix_expect_t bt = transpose_matrix(bsr.u.value, alloc);
+    matrix_expect_t st = transpose_matrix(sell.u.value, alloc);
+    assert_true(bt.has_value);
+    assert_true(st.has_value);
+    assert_int_equal(matrix_format(bt.u.value), BSR_MATRIX);
+    assert_int_equal((int)bt.u.value->rep.bsr.block_rows, 5);
+    assert_int_equal((int)bt.u.value->rep.bsr.block_cols, 2);
+    assert_int_equal(matrix_format(st.u.value), SELL_MATRIX);
+    assert_int_equal((int)st.u.value->rep.sell.chunk, 4);
+    assert_true(matrix_equal(bt.u.value, ref.u.value));
+    assert_true(matrix_equal(st.u.value, ref.u.value));
+
+    return_matrix(st.u.value);
+    return_matrix(bt.u.value);
+    return_matrix(sell.u.value);
+    return_matrix(bsr.u.value);
+    return_matrix(ref.u.value);
+    return_matrix(dense);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_matrix_multiply_vector_blocked_matches_reference(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+    dtype_id_t const types[] = { FLOAT_TYPE, DOUBLE_TYPE };
+
+    /* Block shapes that divide, straddle and exceed the SIMD width, and
+     * chunks of one, a partial vector and several vectors */
+    size_t const blocks[][2] = { { 1u, 1u }, { 2u, 3u }, { 4u, 4u }, { 3u, 8u }, { 5u, 17u } };
+    size_t const chunks[][2] = { { 1u, 1u }, { 3u, 3u }, { 8u, 64u }, { 16u, 256u }, { 64u, 64u } };
+
+    for (size_t t = 0u; t < 2u; t++) {
+        matrix_t* dense = _make_product_matrix(257u, 131u, types[t], 0u, 5u);
+        matrix_t* x     = _make_product_matrix(131u, 1u, types[t], 4u, 1u);
+        matrix_t* xt    = _make_product_matrix(257u, 1u, types[t], 5u, 1u);
+        matrix_t* y     = init_col_vector(257u, types[t], alloc).u.value;
+        matrix_t* yt    = init_col_vector(131u, types[t], alloc).u.value;
+
+        for (size_t k = 0u; k < 5u; k++) {
+            matrix_expect_t b = convert_to_bsr_matrix(dense, blocks[k][0], blocks[k][1], alloc);
+            assert_true(b.has_value);
+            assert_int_equal(matrix_multiply_vector(y, b.u.value, x, false, 3u), NO_ERROR);
+            _assert_gemv(y, dense, x, false);
+            assert_int_equal(matrix_multiply_vector(yt, b.u.value, xt, true, 3u), NO_ERROR);
+            _assert_gemv(yt, dense, xt, true);
+            return_matrix(b.u.value);
+
+            matrix_expect_t s = convert_to_sell_matrix(dense, chunks[k][0], chunks[k][1], alloc);
+            assert_true(s.has_value);
+            assert_int_equal(matrix_multiply_vector(y, s.u.value, x, false, 3u), NO_ERROR);
+            _assert_gemv(y, dense, x, false);
+            assert_int_equal(matrix_multiply_vector(yt, s.u.value, xt, true, 3u), NO_ERROR);
+            _assert_gemv(yt, dense, xt, true);
+            return_matrix(s.u.value);
+        }
+
+        return_matrix(yt);
+        return_matrix(y);
+        return_matrix(xt);
+        return_matrix(x);
+        return_matrix(dense);
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_convert_blocked_formats_empty_matrix(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    matrix_expect_t coo = init_coo_matrix(9u, 6u, 4u, FLOAT_TYPE, false, alloc);
+    assert_true(coo.has_value);
+    matrix_expect_t bsr  = convert_to_bsr_matrix(coo.u.value, 4u, 4u, alloc);
+    matrix_expect_t sell = convert_to_sell_matrix(coo.u.value, 4u, 4u, alloc);
+    assert_true(bsr.has_value);
+    assert_true(sell.has_value);
+    assert_int_equal((int)matrix_nnz(bsr.u.value), 0);
+    assert_int_equal((int)matrix_nnz(sell.u.value), 0);
+    assert_true(is_zero_matrix(bsr.u.value));
+    assert_true(is_zero_matrix(sell.u.value));
+
+    /* Stale output must be overwritten even with no stored entries */
+    matrix_t* x  = _make_product_matrix(6u, 1u, FLOAT_TYPE, 1u, 1u);
+    matrix_t* yb = _make_product_matrix(9u, 1u, FLOAT_TYPE, 1u, 1u);
+    matrix_t* ys = _make_product_matrix(9u, 1u, FLOAT_TYPE, 1u, 1u);
+    assert_int_equal(matrix_multiply_vector(yb, bsr.u.value, x, false, 1u), NO_ERROR);
+    assert_int_equal(matrix_multiply_vector(ys, sell.u.value, x, false, 1u), NO_ERROR);
+    assert_true(is_zero_matrix(yb));
+    assert_true(is_zero_matrix(ys));
+
+    return_matrix(ys);
+    return_matrix(yb);
+    return_matrix(x);
+    return_matrix(sell.u.value);
+    return_matrix(bsr.u.value);
+    return_matrix(coo.u.value);
+}
+
+// ================================================================================
+// Group 23: hash-indexed COO assembly
+// ================================================================================
+
+static void test_coo_assembly_rejects_bad_arguments(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    matrix_t* dense = _make_dense_int32_matrix(2u, 2u);
+    matrix_t* rec   = _make_coo_record_matrix(2u, 2u, 1u, true);
+    matrix_t* coo   = _make_coo_int32_matrix(2u, 2u, 1u, true);
+
+    assert_int_equal(begin_coo_assembly(NULL, COO_DUPLICATE_SUM), NULL_POINTER);
+    assert_int_equal(begin_coo_assembly(dense, COO_DUPLICATE_SUM), ILLEGAL_STATE);
+    assert_int_equal(begin_coo_assembly(coo, (coo_duplicate_t)7), INVALID_ARG);
+    assert_int_equal(begin_coo_assembly(rec, COO_DUPLICATE_SUM), TYPE_MISMATCH);
+    assert_int_equal(begin_coo_assembly(rec, COO_DUPLICATE_FIRST), NO_ERROR);
+
+    /* Finalizing needs an assembling COO matrix */
+    assert_int_equal(finalize_coo_assembly(NULL), NULL_POINTER);
+    assert_int_equal(finalize_coo_assembly(dense), ILLEGAL_STATE);
+    assert_int_equal(finalize_coo_assembly(coo), ILLEGAL_STATE);
+
+    matrix_expect_t r = finalize_coo_assembly_compressed(NULL, CSR_MATRIX, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, NULL_POINTER);
+    r = finalize_coo_assembly_compressed(coo, CSR_MATRIX, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, ILLEGAL_STATE);
+    r = finalize_coo_assembly_compressed(rec, DENSE_MATRIX, 1u, alloc);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, ILLEGAL_STATE);
+
+    /* A failed finalize leaves the matrix assembling */
+    assert_int_equal(finalize_coo_assembly(rec), NO_ERROR);
+    assert_null(rec->rep.coo.index);
+
+    return_matrix(coo);
+    return_matrix(rec);
+    return_matrix(dense);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_coo_assembly_sums_random_inserts(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+    size_t const rows = 97u, cols = 89u, inserts = 20000u;
+
+    /* Exact in double: every contribution is a small integer */
+    double* ref     = calloc(rows * cols, sizeof(double));
+    bool*   touched = calloc(rows * cols, sizeof(bool));
+    assert_non_null(ref);
+    assert_non_null(touched);
+
+    matrix_expect_t m = init_coo_matrix(rows, cols, 1u, DOUBLE_TYPE, true, alloc);
+    assert_true(m.has_value);
+    matrix_t* coo = m.u.value;
+    assert_int_equal(begin_coo_assembly(coo, COO_DUPLICATE_SUM), NO_ERROR);
+
+    size_t seed = 12345u;
+    for (size_t k = 0u; k < inserts; k++) {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        size_t const i = (seed >> 33) % rows;
+        size_t const j = (seed >> 17) % 61u * 7u % cols;
+        double const v = (double)(k % 5u) - 2.0;
+        assert_int_equal(set_matrix(coo, i, j, &v), NO_ERROR);
+        ref[i * cols + j] += v;
+        touched[i * cols + j] = true;
+    }
+
+    /* One entry per distinct (row, col); lookups go through the hash */
+    size_t distinct = 0u;
+    for (size_t e = 0u; e < rows * cols; e++) {
+        double out = -1.0;
+        assert_int_equal(get_matrix(coo, e / cols, e % cols, &out), NO_ERROR);
+        assert_true(out == ref[e]);
+        distinct += touched[e];
+    }
+    assert_int_equal((int)matrix_nnz(coo), (int)distinct);
+    assert_true(matrix_storage_bytes(coo) > coo->rep.coo.cap * (2u * sizeof(size_t) + sizeof(double)));
+
+    assert_int_equal(finalize_coo_assembly(coo), NO_ERROR);
+    assert_null(coo->rep.coo.index);
+    assert_true(coo->rep.coo.sorted);
+    for (size_t e = 1u; e < coo->rep.coo.nnz; e++) {
+        size_t const a = coo->rep.coo.row_idx[e - 1u] * cols + coo->rep.coo.col_idx[e - 1u];
+        size_t const b = coo->rep.coo.row_idx[e] * cols + coo->rep.coo.col_idx[e];
+        assert_true(a < b);
+    }
+    for (size_t e = 0u; e < rows * cols; e++) {
+        double out = -1.0;
+        assert_int_equal(get_matrix(coo, e / cols, e % cols, &out), NO_ERROR);
+        assert_true(out == ref[e]);
+    }
+
+    return_matrix(coo);
+    free(touched);
+    free(ref);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_coo_assembly_merges_existing_entries(void** state) {
+    (void)state;
+
+    /* (1, 2) appears three times and (0, 0) twice before assembly */
+    size_t const  r[] = { 1u, 0u, 1u, 3u, 0u, 1u };
+    size_t const  c[] = { 2u, 0u, 2u, 1u, 0u, 2u };
+    int32_t const v[] = { 10, 1, 20, 5, 2, 30 };
+    coo_duplicate_t const policies[] = { COO_DUPLICATE_LAST, COO_DUPLICATE_FIRST,
+                                         COO_DUPLICATE_SUM };
+    int32_t const expect_12[] = { 30, 10, 60 };
+    int32_t const expect_00[] = { 2, 1, 3 };
+    /* Then (0, 0) += 4 through set_matrix */
+    int32_t const after_00[] = { 4, 1, 7 };
+
+    for (size_t p = 0u; p < 3u; p++) {
+        matrix_t* coo = _make_raw_coo_matrix(4u, 3u, INT32_TYPE, r, c, v, 6u);
+        assert_int_equal(begin_coo_assembly(coo, policies[p]), NO_ERROR);
+        assert_int_equal((int)matrix_nnz(coo), 3);
+
+        int32_t out = 0;
+        assert_int_equal(get_matrix(coo, 1u, 2u, &out), NO_ERROR);
+        assert_int_equal(out, expect_12[p]);
+        assert_int_equal(get_matrix(coo, 0u, 0u, &out), NO_ERROR);
+        assert_int_equal(out, expect_00[p]);
+
+        int32_t const four = 4;
+        assert_int_equal(set_matrix(coo, 0u, 0u, &four), NO_ERROR);
+        assert_int_equal(get_matrix(coo, 0u, 0u, &out), NO_ERROR);
+        assert_int_equal(out, after_00[p]);
+
+        /* Merging freed three slots; growth is off */
+        assert_int_equal(push_back_coo_matrix(coo, 2u, 2u, &four), NO_ERROR);
+        assert_int_equal(push_back_coo_matrix(coo, 3u, 2u, &four), NO_ERROR);
+        assert_int_equal(push_back_coo_matrix(coo, 2u, 0u, &four), NO_ERROR);
+        assert_int_equal(push_back_coo_matrix(coo, 3u, 0u, &four), CAPACITY_OVERFLOW);
+        assert_int_equal((int)matrix_nnz(coo), 6);
+
+        return_matrix(coo);
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_coo_assembly_survives_structural_operations(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+
+    matrix_t* coo = _make_coo_int32_matrix(6u, 5u, 2u, true);
+    assert_int_equal(begin_coo_assembly(coo, COO_DUPLICATE_SUM), NO_ERROR);
+
+    int32_t const one = 1;
+    int32_t       out = 0;
+    assert_int_equal(set_matrix(coo, 4u, 1u, &one), NO_ERROR);
+
+    /* A swap re-keys the entry even when it is the only one */
+    assert_int_equal(swap_matrix_rows(coo, 4u, 2u), NO_ERROR);
+    assert_int_equal(set_matrix(coo, 2u, 1u, &one), NO_ERROR);
+    assert_int_equal((int)matrix_nnz(coo), 1);
+    assert_int_equal(get_matrix(coo, 2u, 1u, &out), NO_ERROR);
+    assert_int_equal(out, 2);
+
+    for (size_t i = 0u; i < 6u; i++)
+        for (size_t j = 0u; j < 5u; j++)
+            assert_int_equal(set_matrix(coo, 5u - i, 4u - j, &one), NO_ERROR);
+    assert_int_equal(swap_matrix_cols(coo, 0u, 1u), NO_ERROR);
+    assert_int_equal(sort_coo_matrix(coo), NO_ERROR);
+    assert_int_equal(set_matrix(coo, 2u, 0u, &one), NO_ERROR);
+    assert_int_equal((int)matrix_nnz(coo), 30);
+    assert_int_equal(get_matrix(coo, 2u, 0u, &out), NO_ERROR);
+    assert_int_equal(out, 4);
+
+    /* Copies are plain COO matrices */
+    matrix_expect_t cp = copy_matrix(coo, alloc);
+    assert_true(cp.has_value);
+    assert_null(cp.u.value->rep.coo.index);
+    assert_true(matrix_equal(cp.u.value, coo));
+    return_matrix(cp.u.value);
+
+    assert_int_equal(clear_matrix(coo), NO_ERROR);
+    assert_non_null(coo->rep.coo.index);
+    assert_int_equal(set_matrix(coo, 2u, 0u, &one), NO_ERROR);
+    assert_int_equal(get_matrix(coo, 2u, 0u, &out), NO_ERROR);
+    assert_int_equal(out, 1);
+    assert_int_equal((int)matrix_nnz(coo), 1);
+
+    return_matrix(coo);
+}
+
+// --------------------------------------------------------------------------------
+
+static void test_coo_assembly_finalizes_to_compressed(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+    matrix_format_t const formats[] = { CSR_MATRIX, CSC_MATRIX };
+
+    for (size_t f = 0u; f < 2u; f++) {
+        matrix_expect_t m = init_coo_matrix(40u, 30u, 8u, FLOAT_TYPE, true, alloc);
+        assert_true(m.has_value);
+        matrix_t* coo = m.u.value;
+        matrix_t* ref = _make_product_matrix(40u, 30u, FLOAT_TYPE, 0u, 1u);
+        assert_int_equal(begin_coo_assembly(coo, COO_DUPLICATE_SUM), NO_ERROR);
+
+        /* Every entry arrives as two halves, in reverse order; the pair
+         * at (0, 0) cancels and must not be stored */
+        for (size_t e = 40u * 30u; e-- > 0u;) {
+            size_t const i = e / 30u, j = e % 30u;
+            float half = 0.0f;
+            assert_int_equal(get_matrix(ref, i, j, &half), NO_ERROR);
+            half *= 0.5f;
+            if (e == 0u) half = 1.0f;
+            assert_int_equal(set_matrix(coo, i, j, &half), NO_ERROR);
+            if (e == 0u) half = -1.0f;
+            assert_int_equal(set_matrix(coo, i, j, &half), NO_ERROR);
+        }
+        float const zero = 0.0f;
+        assert_int_equal(set_matrix(ref, 0u, 0u, &zero), NO_ERROR);
+        matrix_expect_t want = convert_matrix(ref, formats[f], alloc);
+        assert_true(want.has_value);
+
+        matrix_expect_t r = finalize_coo_assembly_compressed(coo, formats[f], 2u, alloc);
+        assert_true(r.has_value);
+        assert_int_equal(matrix_format(r.u.value), formats[f]);
+        assert_true(matrix_equal(r.u.value, ref));
+        assert_int_equal((int)matrix_nnz(r.u.value), (int)matrix_nnz(want.u.value));
+        assert_int_equal((int)matrix_nnz(coo), 40 * 30);
+
+        /* The source is a plain COO matrix again */
+        assert_null(coo->rep.coo.index);
+        assert_int_equal(finalize_coo_assembly(coo), ILLEGAL_STATE);
+
+        return_matrix(r.u.value);
+        return_matrix(want.u.value);
+        return_matrix(ref);
+        return_matrix(coo);
+    }
+}
+
 // ================================================================================
 // Test registry
 // ================================================================================
@@ -2882,6 +4189,46 @@ const struct CMUnitTest test_matrix[] = {
     cmocka_unit_test(test_transpose_csr_preserves_logical_values),
     cmocka_unit_test(test_transpose_csc_preserves_logical_values),
     cmocka_unit_test(test_transpose_dense_custom_struct_preserves_values),
+
+    /* Group 18: matrix products */
+    cmocka_unit_test(test_matrix_multiply_vector_rejects_bad_arguments),
+    cmocka_unit_test(test_matrix_multiply_vector_dense_matches_reference),
+    cmocka_unit_test(test_matrix_multiply_vector_sparse_matches_reference),
+    cmocka_unit_test(test_matrix_multiply_rejects_bad_arguments),
+    cmocka_unit_test(test_matrix_multiply_dense_matches_reference),
+    cmocka_unit_test(test_matrix_multiply_csr_dense_matches_reference),
+
+    /* Group 19: sparse products and sums */
+    cmocka_unit_test(test_matrix_sparse_multiply_rejects_bad_arguments),
+    cmocka_unit_test(test_matrix_sparse_multiply_matches_dense_product),
+    cmocka_unit_test(test_matrix_spgemm_numeric_reuses_structure),
+    cmocka_unit_test(test_matrix_sparse_multiply_wide_operand_uses_hash_accumulator),
+    cmocka_unit_test(test_matrix_sparse_add_and_subtract_merge_structures),
+
+    /* Group 20: convert_coo_matrix */
+    cmocka_unit_test(test_convert_coo_matrix_rejects_bad_arguments),
+    cmocka_unit_test(test_convert_coo_matrix_resolves_duplicates),
+    cmocka_unit_test(test_convert_coo_matrix_parallel_matches_reference),
+
+    /* Group 21: tiled dense transpose */
+    cmocka_unit_test(test_transpose_dense_tiled_all_element_sizes),
+    cmocka_unit_test(test_transpose_dense_streams_large_results),
+    cmocka_unit_test(test_transpose_matrix_inplace_rejects_bad_arguments),
+    cmocka_unit_test(test_transpose_matrix_inplace_matches_out_of_place),
+
+    /* Group 22: BSR and SELL-C-sigma formats */
+    cmocka_unit_test(test_convert_blocked_formats_reject_bad_arguments),
+    cmocka_unit_test(test_convert_blocked_formats_round_trip),
+    cmocka_unit_test(test_transpose_blocked_formats_preserves_values),
+    cmocka_unit_test(test_matrix_multiply_vector_blocked_matches_reference),
+    cmocka_unit_test(test_convert_blocked_formats_empty_matrix),
+
+    /* Group 23: hash-indexed COO assembly */
+    cmocka_unit_test(test_coo_assembly_rejects_bad_arguments),
+    cmocka_unit_test(test_coo_assembly_sums_random_inserts),
+    cmocka_unit_test(test_coo_assembly_merges_existing_entries),
+    cmocka_unit_test(test_coo_assembly_survives_structural_operations),
+    cmocka_unit_test(test_coo_assembly_finalizes_to_compressed),
 };
 
 const size_t test_matrix_count =
@@ -2889,6 +4236,11 @@ const size_t test_matrix_count =
 // ================================================================================ 
 // ================================================================================ 
 
+/* The typed suites below exercise float_matrix_t, int32_matrix_t and the
+ * other per-type matrix wrappers, which the typed headers do not declare
+ * yet.  They stay out of the build until those wrappers exist. */
+#if defined(CSALT_TYPED_MATRIX_TESTS)
+
 /* =============================================================================
  * Helpers
  * ========================================================================== */
@@ -20766,6 +22118,7 @@ const struct CMUnitTest test_int64_matrix[] = {
 
 const size_t test_int64_matrix_count =
     sizeof(test_int64_matrix) / sizeof(test_int64_matrix[0]);
+#endif /* CSALT_TYPED_MATRIX_TESTS */
 // ================================================================================
 // ================================================================================
 // eof
@@ -0,0 +1,429 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_simd.c
+// - Purpose: Tests for runtime SIMD tier selection (c_simd.h).  Every tier
+//            the host supports is activated in turn and checked against the
+//            same expected results, so the lower tiers are exercised on a
+//            modern build machine as well.
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 16, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2026, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "c_simd.h"
+#include "c_float.h"
+#include "c_int8.h"
+#include "c_uint8.h"
+#include "c_uint16.h"
+#include "c_int16.h"
+#include "c_uint64.h"
+#include "c_string.h"
+#include "c_allocator.h"
+#include "test_suite.h"
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <cmocka.h>
+// ================================================================================
+// ================================================================================
+
+static const simd_isa_t all_isas[] = {
+    SIMD_SCALAR, SIMD_SSE2, SIMD_SSSE3, SIMD_SSE41, SIMD_AVX, SIMD_AVX2,
+    SIMD_AVX512, SIMD_NEON, SIMD_SVE, SIMD_SVE2
+};
+static const size_t all_isas_count = sizeof(all_isas) / sizeof(all_isas[0]);
+// ================================================================================
+// ================================================================================
+// TEST QUERY FUNCTIONS
+
+static void test_simd_isa_name_known_and_unknown(void** state) {
+    (void)state;
+    assert_string_equal(simd_isa_name(SIMD_SCALAR), "scalar");
+    assert_string_equal(simd_isa_name(SIMD_SSE2),   "sse2");
+    assert_string_equal(simd_isa_name(SIMD_AVX2),   "avx2");
+    assert_string_equal(simd_isa_name(SIMD_AVX512), "avx512");
+    assert_string_equal(simd_isa_name(SIMD_SVE2),   "sve2");
+    assert_string_equal(simd_isa_name((simd_isa_t)99), "unknown");
+}
+// --------------------------------------------------------------------------------
+
+static void test_simd_active_isa_is_available(void** state) {
+    (void)state;
+    simd_isa_t active = simd_active_isa();
+    assert_true(simd_isa_available(active));
+    assert_true(strcmp(simd_isa_name(active), "unknown") != 0);
+}
+// --------------------------------------------------------------------------------
+
+static void test_simd_select_unavailable_is_rejected(void** state) {
+    (void)state;
+    simd_isa_t before = simd_active_isa();
+
+    for (size_t i = 0u; i < all_isas_count; i++) {
+        if (simd_isa_available(all_isas[i])) continue;
+        assert_int_equal(simd_select_isa(all_isas[i]), UNSUPPORTED);
+        assert_int_equal(simd_active_isa(), before);
+    }
+    assert_int_equal(simd_select_isa((simd_isa_t)99), UNSUPPORTED);
+}
+// ================================================================================
+// ================================================================================
+// TEST EVERY AVAILABLE TIER AGAINST THE SAME EXPECTATIONS
+
+static void test_simd_float_kernels_agree_across_tiers(void** state) {
+    (void)state;
+    allocator_vtable_t a = heap_allocator();
+    float_tensor_expect_t r = init_float_array(67u, false, a);
+    assert_true(r.has_value);
+    float_tensor_t* t = r.u.value;
+
+    /* 67 elements leaves a tail after every vector width */
+    for (size_t i = 0u; i < 67u; i++) {
+        assert_int_equal(push_back_float_array(t, (float)(100 - (int)i)), NO_ERROR);
+    }
+
+    simd_isa_t original = simd_active_isa();
+    for (size_t k = 0u; k < all_isas_count; k++) {
+        if (simd_select_isa(all_isas[k]) != NO_ERROR) continue;
+        assert_int_equal(simd_active_isa(), all_isas[k]);
+
+        float  min_val = 0.0f;
+        size_t index   = 0u;
+        assert_int_equal(min_float_tensor(t, &min_val), NO_ERROR);
+        assert_float_equal(min_val, 34.0f, 0.0f);
+        assert_int_equal(float_tensor_lsearch(t, &index, 35.0f, 0.0f), NO_ERROR);
+        assert_int_equal(index, 65u);
+        assert_true(float_tensors_equal(t, t, 0.0f, true));
+    }
+    assert_int_equal(simd_select_isa(original), NO_ERROR);
+
+    return_float_tensor(t);
+}
+// --------------------------------------------------------------------------------
+
+static void test_simd_uint8_min_agrees_across_tiers(void** state) {
+    (void)state;
+    allocator_vtable_t a = heap_allocator();
+    uint8_tensor_expect_t r = init_uint8_array(131u, false, a);
+    assert_true(r.has_value);
+    uint8_tensor_t* t = r.u.value;
+
+    for (size_t i = 0u; i < 131u; i++) {
+        assert_int_equal(push_back_uint8_array(t, (uint8_t)(200u - (i % 97u))),
+                         NO_ERROR);
+    }
+
+    simd_isa_t original = simd_active_isa();
+    for (size_t k = 0u; k < all_isas_count; k++) {
+        if (simd_select_isa(all_isas[k]) != NO_ERROR) continue;
+
+        uint8_t min_val = 0u;
+        assert_int_equal(min_uint8_tensor(t, &min_val), NO_ERROR);
+        assert_int_equal(min_val, 104u);
+    }
+    assert_int_equal(simd_select_isa(original), NO_ERROR);
+
+    return_uint8_tensor(t);
+}
+// --------------------------------------------------------------------------------
+
+static void test_simd_arithmetic_agrees_across_tiers(void** state) {
+    (void)state;
+    allocator_vtable_t a = heap_allocator();
+    int16_tensor_expect_t  ri = init_int16_array(67u, false, a);
+    int16_tensor_expect_t  ro = init_int16_array(67u, false, a);
+    uint64_tensor_expect_t ru = init_uint64_array(67u, false, a);
+    uint64_tensor_expect_t rw = init_uint64_array(67u, false, a);
+    assert_true(ri.has_value && ro.has_value && ru.has_value && rw.has_value);
+    int16_tensor_t*  x = ri.u.value;
+    int16_tensor_t*  y = ro.u.value;
+    uint64_tensor_t* u = ru.u.value;
+    uint64_tensor_t* w = rw.u.value;
+
+    for (size_t i = 0u; i < 67u; i++) {
+        assert_int_equal(push_back_int16_array(x, (int16_t)(i * 1000u - 30000u)),
+                         NO_ERROR);
+        assert_int_equal(push_back_uint64_array(u, ((uint64_t)i << 40) + i), NO_ERROR);
+    }
+    const int16_t*  ys = (const int16_t*)y->base->data;
+    const uint64_t* ws = (const uint64_t*)w->base->data;
+
+    simd_isa_t original = simd_active_isa();
+    for (size_t k = 0u; k < all_isas_count; k++) {
+        if (simd_select_isa(all_isas[k]) != NO_ERROR) continue;
+
+        assert_int_equal(mul_int16_tensor(y, x, x), NO_ERROR);
+        assert_int_equal(ys[66], (int16_t)(uint16_t)(36000u * 36000u));
+        assert_int_equal(clamp_int16_tensor(y, x, -100, 5000), NO_ERROR);
+        assert_int_equal(ys[0], -100);
+        assert_int_equal(ys[30], 0);
+        assert_int_equal(ys[40], 5000);   /* 10000 */
+        assert_int_equal(ys[66], -100);   /* 36000 wrapped negative */
+        assert_int_equal(abs_int16_tensor(y, x), NO_ERROR);
+        assert_int_equal(ys[1], 29000);
+
+        assert_int_equal(mul_uint64_tensor(w, u, u), NO_ERROR);
+        assert_true(ws[66] == (((uint64_t)66 << 40) + 66u) * (((uint64_t)66 << 40) + 66u));
+        assert_int_equal(muladd_uint64_tensor(w, u, 3u, 5u), NO_ERROR);
+        assert_true(ws[65] == (((uint64_t)65 << 40) + 65u) * 3u + 5u);
+        assert_int_equal(clamp_uint64_tensor(w, u, 10u, (uint64_t)1 << 41), NO_ERROR);
+        assert_true(ws[0] == 10u && ws[1] == ((uint64_t)1 << 40) + 1u);
+        assert_true(ws[66] == (uint64_t)1 << 41);
+    }
+    assert_int_equal(simd_select_isa(original), NO_ERROR);
+
+    return_uint64_tensor(w);
+    return_uint64_tensor(u);
+    return_int16_tensor(y);
+    return_int16_tensor(x);
+}
+// --------------------------------------------------------------------------------
+
+static void test_simd_reductions_agree_across_tiers(void** state) {
+    (void)state;
+    allocator_vtable_t a = heap_allocator();
+    int8_tensor_expect_t   rb = init_int8_array(131u, false, a);
+    uint16_tensor_expect_t rh = init_uint16_array(131u, false, a);
+    float_tensor_expect_t  rf = init_float_array(131u, false, a);
+    assert_true(rb.has_value && rh.has_value && rf.has_value);
+    int8_tensor_t*   b = rb.u.value;
+    uint16_tensor_t* h = rh.u.value;
+    float_tensor_t*  f = rf.u.value;
+
+    int64_t  bref = 0;
+    uint64_t href = 0u;
+    for (size_t i = 0u; i < 131u; i++) {
+        int8_t   bv = (int8_t)(i * 37u);
+        uint16_t hv = (uint16_t)(60000u + i);
+        assert_int_equal(push_back_int8_array(b, bv), NO_ERROR);
+        assert_int_equal(push_back_uint16_array(h, hv), NO_ERROR);
+        assert_int_equal(push_back_float_array(f, (float)i - 65.0f), NO_ERROR);
+        bref += bv;
+        href += hv;
+    }
+    ((float*)f->base->data)[77] = 1000.0f;
+
+    simd_isa_t original = simd_active_isa();
+    for (size_t k = 0u; k < all_isas_count; k++) {
+        if (simd_select_isa(all_isas[k]) != NO_ERROR) continue;
+
+        int64_t  bs = 0;
+        uint64_t hs = 0u;
+        float    fs = 0.0f;
+        size_t   idx = 0u;
+        assert_int_equal(sum_int8_tensor(b, &bs), NO_ERROR);
+        assert_true(bs == bref);
+        assert_int_equal(sum_uint16_tensor(h, &hs), NO_ERROR);
+        assert_true(hs == href);
+        assert_int_equal(sum_float_tensor(f, &fs), NO_ERROR);
+        assert_float_equal(fs, 1000.0f - 12.0f, 0.0f);   /* 0 + 1000 - 12 */
+        assert_int_equal(max_float_tensor(f, &fs), NO_ERROR);
+        assert_float_equal(fs, 1000.0f, 0.0f);
+        assert_int_equal(argmax_float_tensor(f, &idx), NO_ERROR);
+        assert_int_equal(idx, 77u);
+    }
+    assert_int_equal(simd_select_isa(original), NO_ERROR);
+
+    return_float_tensor(f);
+    return_uint16_tensor(h);
+    return_int8_tensor(b);
+}
+// --------------------------------------------------------------------------------
+
+/** Axis 0 folds run the elementwise minimum/maximum kernels on every tier. */
+static void test_simd_axis_reductions_agree_across_tiers(void** state) {
+    (void)state;
+    const size_t shape[] = { 3u, 67u };
+    tensor_expect_t rh = init_tensor(2u, shape, UINT16_TYPE, heap_allocator());
+    tensor_expect_t rq = init_tensor(2u, shape, INT64_TYPE, heap_allocator());
+    tensor_expect_t rf = init_tensor(2u, shape, FLOAT_TYPE, heap_allocator());
+    assert_true(rh.has_value && rq.has_value && rf.has_value);
+    uint16_t* h = (uint16_t*)rh.u.value->data;
+    int64_t*  q = (int64_t*)rq.u.value->data;
+    float*    f = (float*)rf.u.value->data;
+    for (size_t i = 0u; i < 3u * 67u; i++) {
+        h[i] = (uint16_t)(i * 40503u);
+        q[i] = ((i * 2654435761u) & 1u) ? -(int64_t)(i << 33) : (int64_t)(i << 33);
+        f[i] = (float)((i * 37u) % 101u) - 50.0f;
+    }
+    f[67u + 66u] = NAN;
+
+    simd_isa_t original = simd_active_isa();
+    for (size_t k = 0u; k < all_isas_count; k++) {
+        if (simd_select_isa(all_isas[k]) != NO_ERROR) continue;
+
+        tensor_expect_t a = reduce_tensor_axis(rh.u.value, 0u, REDUCE_MIN,
+                                               (allocator_vtable_t){ 0 });
+        tensor_expect_t b = reduce_tensor_axis(rq.u.value, 0u, REDUCE_MAX,
+                                               (allocator_vtable_t){ 0 });
+        tensor_expect_t c = reduce_tensor_axis(rf.u.value, 0u, REDUCE_MIN,
+                                               (allocator_vtable_t){ 0 });
+        assert_true(a.has_value && b.has_value && c.has_value);
+        const uint16_t* ah = (const uint16_t*)a.u.value->data;
+        const int64_t*  bq = (const int64_t*)b.u.value->data;
+        const float*    cf = (const float*)c.u.value->data;
+        for (size_t j = 0u; j < 67u; j++) {
+            uint16_t eh = h[j];
+            int64_t  eq = q[j];
+            float    ef = f[j];
+            for (size_t r = 1u; r < 3u; r++) {
+                if (h[r * 67u + j] < eh) eh = h[r * 67u + j];
+                if (q[r * 67u + j] > eq) eq = q[r * 67u + j];
+                if (f[r * 67u + j] < ef) ef = f[r * 67u + j];
+            }
+            assert_int_equal(ah[j], eh);
+            assert_true(bq[j] == eq);
+            if (j == 66u) assert_true(isnan(cf[j]));
+            else          assert_float_equal(cf[j], ef, 0.0f);
+        }
+        return_tensor(c.u.value);
+        return_tensor(b.u.value);
+        return_tensor(a.u.value);
+    }
+    assert_int_equal(simd_select_isa(original), NO_ERROR);
+
+    return_tensor(rf.u.value);
+    return_tensor(rq.u.value);
+    return_tensor(rh.u.value);
+}
+// --------------------------------------------------------------------------------
+
+static void test_simd_prefix_sums_agree_across_tiers(void** state) {
+    (void)state;
+    /* 131 elements: two full 64-byte vectors of uint8 plus a ragged tail */
+    const size_t n = 131u;
+    const size_t shape[] = { n };
+    const dtype_id_t types[] = { UINT8_TYPE, UINT16_TYPE, INT32_TYPE, UINT64_TYPE,
+                                 FLOAT_TYPE, DOUBLE_TYPE };
+    const size_t ntypes = sizeof(types) / sizeof(types[0]);
+    tensor_t* src[6];
+    tensor_t* dst[6];
+    for (size_t k = 0u; k < ntypes; k++) {
+        tensor_expect_t a = init_tensor(1u, shape, types[k], heap_allocator());
+        tensor_expect_t b = init_tensor(1u, shape, types[k], heap_allocator());
+        assert_true(a.has_value && b.has_value);
+        src[k] = a.u.value;
+        dst[k] = b.u.value;
+    }
+    for (size_t i = 0u; i < n; i++) {
+        uint32_t const v = (uint32_t)(i * 2654435761u);
+        ((uint8_t*)src[0]->data)[i]  = (uint8_t)v;
+        ((uint16_t*)src[1]->data)[i] = (uint16_t)(v >> 7);
+        ((int32_t*)src[2]->data)[i]  = (int32_t)v;
+        ((uint64_t*)src[3]->data)[i] = (uint64_t)v << 31;
+        ((float*)src[4]->data)[i]    = (float)(v % 97u) - 48.0f;
+        ((double*)src[5]->data)[i]   = (double)(v % 1009u) * 0.25;
+    }
+
+    simd_isa_t original = simd_active_isa();
+    for (size_t k = 0u; k < all_isas_count; k++) {
+        if (simd_select_isa(all_isas[k]) != NO_ERROR) continue;
+
+        for (int mode = SCAN_INCLUSIVE; mode <= SCAN_EXCLUSIVE; mode++) {
+            for (size_t t = 0u; t < ntypes; t++)
+                assert_int_equal(cumulative_sum_tensor(dst[t], src[t], (scan_mode_t)mode,
+                                                       1u), NO_ERROR);
+            uint8_t  r8  = 0u;
+            uint16_t r16 = 0u;
+            uint32_t r32 = 0u;
+            uint64_t r64 = 0u;
+            float    rf  = 0.0f;
+            double   rd  = 0.0;
+            bool const ex = (mode == SCAN_EXCLUSIVE);
+            for (size_t i = 0u; i < n; i++) {
+                if (ex) {
+                    assert_int_equal(((uint8_t*)dst[0]->data)[i], r8);
+                    assert_int_equal(((uint16_t*)dst[1]->data)[i], r16);
+                    assert_true((uint32_t)((int32_t*)dst[2]->data)[i] == r32);
+                    assert_true(((uint64_t*)dst[3]->data)[i] == r64);
+                    assert_float_equal(((float*)dst[4]->data)[i], rf, 0.0f);
+                    assert_float_equal(((double*)dst[5]->data)[i], rd, 0.0);
+                }
+                r8  = (uint8_t)(r8 + ((uint8_t*)src[0]->data)[i]);
+                r16 = (uint16_t)(r16 + ((uint16_t*)src[1]->data)[i]);
+                r32 += (uint32_t)((int32_t*)src[2]->data)[i];
+                r64 += ((uint64_t*)src[3]->data)[i];
+                rf  += ((float*)src[4]->data)[i];
+                rd  += ((double*)src[5]->data)[i];
+                if (!ex) {
+                    assert_int_equal(((uint8_t*)dst[0]->data)[i], r8);
+                    assert_int_equal(((uint16_t*)dst[1]->data)[i], r16);
+                    assert_true((uint32_t)((int32_t*)dst[2]->data)[i] == r32);
+                    assert_true(((uint64_t*)dst[3]->data)[i] == r64);
+                    assert_float_equal(((float*)dst[4]->data)[i], rf, 0.0f);
+                    assert_float_equal(((double*)dst[5]->data)[i], rd, 0.0);
+                }
+            }
+        }
+    }
+    assert_int_equal(simd_select_isa(original), NO_ERROR);
+
+    for (size_t k = 0u; k < ntypes; k++) {
+        return_tensor(dst[k]);
+        return_tensor(src[k]);
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void test_simd_string_kernels_agree_across_tiers(void** state) {
+    (void)state;
+    allocator_vtable_t a = heap_allocator();
+
+    /* Long enough to cross 64-byte blocks with the match in the tail */
+    const char* text = "the quick brown fox jumps over the lazy dog, "
+                       "then the quick brown fox naps beside the needle.";
+    simd_isa_t original = simd_active_isa();
+
+    for (size_t k = 0u; k < all_isas_count; k++) {
+        if (simd_select_isa(all_isas[k]) != NO_ERROR) continue;
+
+        string_expect_t h = init_string(text, 0u, a);
+        string_expect_t n = init_string("needle", 0u, a);
+        string_expect_t d = init_string(" ,.", 0u, a);
+        assert_true(h.has_value && n.has_value && d.has_value);
+
+        assert_int_equal(find_substr(h.u.value, n.u.value, NULL, NULL, FORWARD),
+                         strlen(text) - 7u);
+        assert_int_equal(token_count(h.u.value, d.u.value, NULL, NULL), 18u);
+
+        to_uppercase(h.u.value, NULL, NULL);
+        assert_string_equal(const_string(h.u.value),
+                            "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, "
+                            "THEN THE QUICK BROWN FOX NAPS BESIDE THE NEEDLE.");
+
+        return_string(d.u.value);
+        return_string(n.u.value);
+        return_string(h.u.value);
+    }
+    assert_int_equal(simd_select_isa(original), NO_ERROR);
+}
+// ================================================================================
+// ================================================================================
+
+const struct CMUnitTest test_simd[] = {
+    cmocka_unit_test(test_simd_isa_name_known_and_unknown),
+    cmocka_unit_test(test_simd_active_isa_is_available),
+    cmocka_unit_test(test_simd_select_unavailable_is_rejected),
+    cmocka_unit_test(test_simd_float_kernels_agree_across_tiers),
+    cmocka_unit_test(test_simd_uint8_min_agrees_across_tiers),
+    cmocka_unit_test(test_simd_arithmetic_agrees_across_tiers),
+    cmocka_unit_test(test_simd_reductions_agree_across_tiers),
+    cmocka_unit_test(test_simd_axis_reductions_agree_across_tiers),
+    cmocka_unit_test(test_simd_prefix_sums_agree_across_tiers),
+    cmocka_unit_test(test_simd_string_kernels_agree_across_tiers),
+};
+
+const size_t test_simd_count = sizeof(test_simd) / sizeof(test_simd[0]);
+// ================================================================================
+// ================================================================================
+// eof
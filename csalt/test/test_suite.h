@@ -57,6 +57,19 @@ extern const size_t test_error_count;
 // ================================================================================ 
 // ================================================================================ 
 
+/**
+ * @brief Test suite for runtime SIMD tier selection
+ * 
+ * Covers:
+ * - Tier names and availability queries
+ * - Rejection of tiers the host or build cannot run
+ * - Float, uint8 and string kernels on every available tier
+ */
+extern const struct CMUnitTest test_simd[];
+extern const size_t test_simd_count;
+// ================================================================================ 
+// ================================================================================ 
+
 /**
  * @brief Test suite for pool allocator functionality
  * 
@@ -101,6 +114,31 @@ extern const size_t test_slab_allocator_count;
 // ================================================================================ 
 // ================================================================================ 
 
+/**
+ * @brief Test suite for the thread cache allocator front-end
+ * 
+ * Covers:
+ * - Magazine reuse, routing to slab / buddy backends and realloc
+ * - Use through allocator_vtable_t and from several threads at once
+ */
+extern const struct CMUnitTest test_tcache_allocator[];
+extern const size_t test_tcache_allocator_count;
+// ================================================================================ 
+// ================================================================================ 
+
+/**
+ * @brief Test suite for the tracing allocator decorator
+ * 
+ * Covers:
+ * - Call counts, byte totals, live high-water mark and size classes
+ * - Aligned blocks, sampling ring buffer and CSV / binary dumps
+ * - Use through allocator_vtable_t and from several threads at once
+ */
+extern const struct CMUnitTest test_tracer_allocator[];
+extern const size_t test_tracer_allocator_count;
+// ================================================================================ 
+// ================================================================================ 
+
 extern const struct CMUnitTest test_string[];
 extern const size_t test_string_count;
 // ================================================================================ 
@@ -243,13 +281,13 @@ extern const size_t test_ldouble_tensor_count;
 //
 // extern const struct CMUnitTest test_avl[];
 // extern const size_t test_avl_count;
-// // ================================================================================ 
-// // ================================================================================ 
-//
-// extern const struct CMUnitTest test_matrix[];
-// extern const size_t test_matrix_count;
-// // ================================================================================ 
-// // ================================================================================ 
+// ================================================================================ 
+// ================================================================================ 
+
+extern const struct CMUnitTest test_matrix[];
+extern const size_t test_matrix_count;
+// ================================================================================ 
+// ================================================================================ 
 //
 // extern const struct CMUnitTest test_float_matrix[];
 // extern const size_t test_float_matrix_count;
@@ -17,6 +17,8 @@
 #include <stdint.h>
 #include <cmocka.h>
 #include <math.h>       /* NAN, isnan — used when checking float zero-init */
+#include <stdio.h>      /* fopen, remove — tensor file tests */
+#include <unistd.h>     /* truncate */
 
 #include "c_tensor.h"   /* tensor_t, tensor_expect_t, init_tensor, return_tensor */
 #include "c_allocator.h"
@@ -3010,6 +3012,163 @@ static void test_pop_interleaved(void** state) {
 
 // -------------------------------------------------------------------------------- 
 
+// ================================================================================
+// ================================================================================
+// BULK PUSH / POP (push_back_n_tensor / push_at_n_tensor / pop_back_n_tensor)
+// ================================================================================
+
+/** Guards: NULL, wrong mode, wrong dtype, bad index, overlapping source. */
+static void test_bulk_push_pop_guards(void** state) {
+    (void)state;
+    tensor_expect_t r = _make_array(4u, INT32_TYPE, true);
+    assert_true(r.has_value);
+    tensor_t* t = r.u.value;
+    int32_t vals[] = { 1, 2, 3 };
+
+    size_expect_t e = push_back_n_tensor(NULL, vals, 3u, INT32_TYPE);
+    assert_false(e.has_value);
+    assert_int_equal(e.u.error, NULL_POINTER);
+    e = push_back_n_tensor(t, NULL, 3u, INT32_TYPE);
+    assert_int_equal(e.u.error, NULL_POINTER);
+    e = push_back_n_tensor(t, vals, 3u, FLOAT_TYPE);
+    assert_int_equal(e.u.error, TYPE_MISMATCH);
+    e = push_at_n_tensor(t, vals, 3u, 1u, INT32_TYPE);
+    assert_int_equal(e.u.error, OUT_OF_BOUNDS);
+    e = pop_back_n_tensor(t, NULL, 2u, INT32_TYPE);
+    assert_int_equal(e.u.error, EMPTY);
+
+    /* count == 0 is a no-op */
+    e = push_back_n_tensor(t, vals, 0u, INT32_TYPE);
+    assert_true(e.has_value);
+    assert_int_equal(e.u.value, 0u);
+
+    /* push_at_n must reject a source inside its own buffer */
+    assert_true(push_back_n_tensor(t, vals, 3u, INT32_TYPE).has_value);
+    e = push_at_n_tensor(t, t->data, 2u, 1u, INT32_TYPE);
+    assert_int_equal(e.u.error, INVALID_ARG);
+    assert_int_equal(t->len, 3u);
+
+    tensor_expect_t m = _make_tensor(1u, (size_t[]){ 4u }, INT32_TYPE);
+    assert_true(m.has_value);
+    e = push_back_n_tensor(m.u.value, vals, 3u, INT32_TYPE);
+    assert_int_equal(e.u.error, PRECONDITION_FAIL);
+    return_tensor(m.u.value);
+
+    return_tensor(t);
+}
+
+/** A growable array takes the whole run with a single reallocation. */
+static void test_push_back_n_grows_once(void** state) {
+    (void)state;
+    tensor_expect_t r = _make_array(2u, INT32_TYPE, true);
+    assert_true(r.has_value);
+    tensor_t* t = r.u.value;
+
+    int32_t vals[100];
+    for (size_t i = 0u; i < 100u; i++) vals[i] = (int32_t)i;
+
+    size_expect_t e = push_back_n_tensor(t, vals, 100u, INT32_TYPE);
+    assert_true(e.has_value);
+    assert_int_equal(e.u.value, 100u);
+    assert_int_equal(t->len, 100u);
+    /* tiered growth from 2 is 4, so the buffer is sized exactly to fit */
+    assert_int_equal(t->alloc, 100u);
+    assert_memory_equal(t->data, vals, sizeof(vals));
+
+    return_tensor(t);
+}
+
+/** A fixed-capacity array takes only what fits and reports the count. */
+static void test_push_back_n_partial_when_fixed(void** state) {
+    (void)state;
+    tensor_expect_t r = _make_array(5u, INT32_TYPE, false);
+    assert_true(r.has_value);
+    tensor_t* t = r.u.value;
+
+    int32_t vals[] = { 1, 2, 3, 4 };
+    size_expect_t e = push_back_n_tensor(t, vals, 4u, INT32_TYPE);
+    assert_int_equal(e.u.value, 4u);
+    e = push_back_n_tensor(t, vals, 4u, INT32_TYPE);
+    assert_true(e.has_value);
+    assert_int_equal(e.u.value, 1u);
+    assert_int_equal(t->len, 5u);
+
+    e = push_back_n_tensor(t, vals, 4u, INT32_TYPE);
+    assert_false(e.has_value);
+    assert_int_equal(e.u.error, CAPACITY_OVERFLOW);
+    e = push_at_n_tensor(t, vals, 4u, 0u, INT32_TYPE);
+    assert_int_equal(e.u.error, CAPACITY_OVERFLOW);
+
+    return_tensor(t);
+}
+
+/** Extending an array with its own contents survives the reallocation. */
+static void test_push_back_n_self_alias(void** state) {
+    (void)state;
+    tensor_expect_t r = _make_array(3u, INT32_TYPE, true);
+    assert_true(r.has_value);
+    tensor_t* t = r.u.value;
+
+    int32_t vals[] = { 7, 8, 9 };
+    assert_true(push_back_n_tensor(t, vals, 3u, INT32_TYPE).has_value);
+    size_expect_t e = push_back_n_tensor(t, t->data, 3u, INT32_TYPE);
+    assert_int_equal(e.u.value, 3u);
+
+    int32_t expected[] = { 7, 8, 9, 7, 8, 9 };
+    assert_int_equal(t->len, 6u);
+    assert_memory_equal(t->data, expected, sizeof(expected));
+
+    return_tensor(t);
+}
+
+/** Insert at front, middle and end; the tail shifts as a block. */
+static void test_push_at_n_positions(void** state) {
+    (void)state;
+    tensor_expect_t r = _make_array(2u, INT32_TYPE, true);
+    assert_true(r.has_value);
+    tensor_t* t = r.u.value;
+
+    int32_t base[]  = { 1, 5 };
+    int32_t mid[]   = { 2, 3, 4 };
+    int32_t front[] = { -1, 0 };
+    int32_t back[]  = { 6 };
+    assert_int_equal(push_at_n_tensor(t, base,  2u, 0u, INT32_TYPE).u.value, 2u);
+    assert_int_equal(push_at_n_tensor(t, mid,   3u, 1u, INT32_TYPE).u.value, 3u);
+    assert_int_equal(push_at_n_tensor(t, front, 2u, 0u, INT32_TYPE).u.value, 2u);
+    assert_int_equal(push_at_n_tensor(t, back,  1u, t->len, INT32_TYPE).u.value, 1u);
+
+    int32_t expected[] = { -1, 0, 1, 2, 3, 4, 5, 6 };
+    assert_int_equal(t->len, 8u);
+    assert_memory_equal(t->data, expected, sizeof(expected));
+
+    return_tensor(t);
+}
+
+/** pop_back_n returns elements in original order and clamps to len. */
+static void test_pop_back_n(void** state) {
+    (void)state;
+    tensor_expect_t r = _make_array(8u, INT32_TYPE, false);
+    assert_true(r.has_value);
+    tensor_t* t = r.u.value;
+
+    int32_t vals[] = { 10, 20, 30, 40, 50 };
+    assert_true(push_back_n_tensor(t, vals, 5u, INT32_TYPE).has_value);
+
+    int32_t out[8] = { 0 };
+    size_expect_t e = pop_back_n_tensor(t, out, 2u, INT32_TYPE);
+    assert_int_equal(e.u.value, 2u);
+    assert_int_equal(out[0], 40);
+    assert_int_equal(out[1], 50);
+    assert_int_equal(t->len, 3u);
+
+    e = pop_back_n_tensor(t, out, 8u, INT32_TYPE);
+    assert_int_equal(e.u.value, 3u);
+    assert_memory_equal(out, vals, 3u * sizeof(int32_t));
+    assert_int_equal(t->len, 0u);
+
+    return_tensor(t);
+}
+
 // ================================================================================
 // ================================================================================
 // CONCAT TENSOR ARRAY (concat_tensor_array)
@@ -4435,9 +4594,1240 @@ static void test_sort_then_reverse_round_trip(void** state) {
  
     return_tensor(t);
 }
+
 // ================================================================================
 // ================================================================================
-// TEST SUITE REGISTRY
+// PARALLEL SORT TENSOR (parallel_sort_tensor)
+// ================================================================================
+
+/** Fill an int32 array with a deterministic pseudo-random sequence. */
+static tensor_t* _make_random_int32(size_t n, uint32_t seed, int32_t modulus) {
+    tensor_expect_t r = _make_array(n, INT32_TYPE, false);
+    assert_true(r.has_value);
+    tensor_t* t = r.u.value;
+    for (size_t i = 0u; i < n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        int32_t v = (int32_t)(seed >> 8) % modulus;
+        assert_int_equal(push_back_tensor(t, &v, INT32_TYPE), NO_ERROR);
+    }
+    return t;
+}
+
+static void_ptr_expect_t _failing_alloc(void* ctx, size_t size, bool zeroed) {
+    (void)ctx; (void)size; (void)zeroed;
+    return (void_ptr_expect_t){ .has_value = false, .u.error = BAD_ALLOC };
+}
+
+/** NULL arguments and short tensors are rejected like sort_tensor. */
+static void test_parallel_sort_tensor_guards(void** state) {
+    (void)state;
+    allocator_vtable_t alloc = heap_allocator();
+    assert_int_equal(parallel_sort_tensor(NULL, _cmp_int32, FORWARD, 2u, alloc),
+                     NULL_POINTER);
+
+    tensor_t* t = _make_random_int32(1u, 1u, 100);
+    assert_int_equal(parallel_sort_tensor(t, NULL, FORWARD, 2u, alloc), NULL_POINTER);
+
+    allocator_vtable_t empty = { 0 };
+    assert_int_equal(parallel_sort_tensor(t, _cmp_int32, FORWARD, 2u, empty),
+                     NULL_POINTER);
+    assert_int_equal(parallel_sort_tensor(t, _cmp_int32, FORWARD, 2u, alloc), EMPTY);
+    return_tensor(t);
+}
+
+/** A scratch allocation failure leaves the data untouched. */
+static void test_parallel_sort_tensor_scratch_failure(void** state) {
+    (void)state;
+    tensor_t* t = _make_random_int32(64u, 7u, 1000);
+    int32_t before[64];
+    memcpy(before, t->data, sizeof(before));
+
+    allocator_vtable_t failing = heap_allocator();
+    failing.allocate = _failing_alloc;
+    assert_int_equal(parallel_sort_tensor(t, _cmp_int32, FORWARD, 4u, failing),
+                     OUT_OF_MEMORY);
+    assert_memory_equal(t->data, before, sizeof(before));
+    return_tensor(t);
+}
+
+/**
+ * Large inputs, including thread counts that are not powers of two, must
+ * match the single-threaded sort exactly in both directions.
+ */
+static void test_parallel_sort_tensor_matches_sort_tensor(void** state) {
+    (void)state;
+    const size_t n = 100003u;
+    const size_t threads[] = { 0u, 1u, 3u, 4u, 7u };
+
+    for (size_t d = 0u; d < 2u; d++) {
+        direction_t dir = d ? REVERSE : FORWARD;
+        tensor_t* ref = _make_random_int32(n, 42u, 1 << 30);
+        assert_int_equal(sort_tensor(ref, _cmp_int32, dir), NO_ERROR);
+
+        for (size_t k = 0u; k < sizeof(threads) / sizeof(threads[0]); k++) {
+            tensor_t* t = _make_random_int32(n, 42u, 1 << 30);
+            assert_int_equal(parallel_sort_tensor(t, _cmp_int32, dir, threads[k],
+                                                  heap_allocator()), NO_ERROR);
+            assert_int_equal(t->len, n);
+            assert_memory_equal(t->data, ref->data, n * sizeof(int32_t));
+            return_tensor(t);
+        }
+        return_tensor(ref);
+    }
+}
+
+/**
+ * Heavily duplicated keys across several runs: equal elements must keep
+ * their original order in both directions (the sort is stable).
+ */
+static void test_parallel_sort_tensor_stable_with_duplicates(void** state) {
+    (void)state;
+    assert_true(ensure_dtype_registered(&vec3_desc));
+    const size_t n = 20000u;
+
+    for (size_t d = 0u; d < 2u; d++) {
+        direction_t dir = d ? REVERSE : FORWARD;
+        const size_t shape[] = { n };
+        tensor_expect_t r = init_tensor(1u, shape, VEC3_TYPE, heap_allocator());
+        assert_true(r.has_value);
+        tensor_t* t = r.u.value;
+
+        for (size_t i = 0u; i < n; i++) {
+            vec3_t v = { (float)((i * 7919u) % 5u), (float)i, 0.0f };
+            assert_int_equal(set_tensor_index(t, i, &v, VEC3_TYPE), NO_ERROR);
+        }
+
+        assert_int_equal(parallel_sort_tensor(t, _cmp_vec3_by_x, dir, 4u,
+                                              heap_allocator()), NO_ERROR);
+
+        const vec3_t* v = (const vec3_t*)t->data;
+        for (size_t i = 1u; i < n; i++) {
+            if (v[i - 1u].x == v[i].x) {
+                assert_true(v[i - 1u].y < v[i].y);
+            } else if (dir == FORWARD) {
+                assert_true(v[i - 1u].x < v[i].x);
+            } else {
+                assert_true(v[i - 1u].x > v[i].x);
+            }
+        }
+        return_tensor(t);
+    }
+}
+// ================================================================================
+// ================================================================================
+// RADIX SORT TENSOR (radix_sort_tensor)
+// ================================================================================
+
+/** Argument, dtype and scratch checks. */
+static void test_radix_sort_tensor_guards(void** state) {
+    (void)state;
+    int32_t scratch[65];
+    assert_int_equal(radix_sort_tensor(NULL, FORWARD, NULL, 0u), NULL_POINTER);
+
+    tensor_t* t = _make_random_int32(1u, 1u, 100);
+    assert_int_equal(radix_sort_tensor(t, FORWARD, NULL, 0u), EMPTY);
+    return_tensor(t);
+
+    t = _make_random_int32(64u, 3u, 1000);
+    int32_t before[64];
+    memcpy(before, t->data, sizeof(before));
+    assert_int_equal(radix_sort_tensor(t, FORWARD, scratch, 63u * sizeof(int32_t)),
+                     SIZE_MISMATCH);
+    assert_int_equal(radix_sort_tensor(t, FORWARD, (uint8_t*)scratch + 1u,
+                                       64u * sizeof(int32_t)), ALIGNMENT_ERROR);
+    assert_memory_equal(t->data, before, sizeof(before));
+    return_tensor(t);
+
+    assert_true(ensure_dtype_registered(&vec3_desc));
+    const size_t shape[] = { 4u };
+    tensor_expect_t r = init_tensor(1u, shape, VEC3_TYPE, heap_allocator());
+    assert_true(r.has_value);
+    assert_int_equal(radix_sort_tensor(r.u.value, FORWARD, NULL, 0u), TYPE_MISMATCH);
+    return_tensor(r.u.value);
+}
+
+/** Signed 32-bit data matches the comparison sort with and without scratch. */
+static void test_radix_sort_tensor_int32_matches_sort_tensor(void** state) {
+    (void)state;
+    const size_t n = 10007u;
+    allocator_vtable_t a = heap_allocator();
+    void_ptr_expect_t buf = a.allocate(a.ctx, n * sizeof(int32_t), false);
+    assert_true(buf.has_value);
+
+    for (size_t d = 0u; d < 2u; d++) {
+        direction_t dir = d ? REVERSE : FORWARD;
+        tensor_t* ref = _make_random_int32(n, 11u, 1 << 30);
+        for (size_t i = 0u; i < n; i += 3u) ((int32_t*)ref->data)[i] *= -1;
+        tensor_t* t1 = _make_random_int32(n, 11u, 1 << 30);
+        tensor_t* t2 = _make_random_int32(n, 11u, 1 << 30);
+        memcpy(t1->data, ref->data, n * sizeof(int32_t));
+        memcpy(t2->data, ref->data, n * sizeof(int32_t));
+
+        assert_int_equal(sort_tensor(ref, _cmp_int32, dir), NO_ERROR);
+        assert_int_equal(radix_sort_tensor(t1, dir, buf.u.value,
+                                           n * sizeof(int32_t)), NO_ERROR);
+        assert_int_equal(radix_sort_tensor(t2, dir, NULL, 0u), NO_ERROR);
+        assert_memory_equal(t1->data, ref->data, n * sizeof(int32_t));
+        assert_memory_equal(t2->data, ref->data, n * sizeof(int32_t));
+
+        return_tensor(t2);
+        return_tensor(t1);
+        return_tensor(ref);
+    }
+    a.return_element(a.ctx, buf.u.value);
+}
+
+/** Mixed-sign float and double values, including infinities and -0.0. */
+static void test_radix_sort_tensor_floating_point(void** state) {
+    (void)state;
+    const float  fv[] = { 3.5f, -0.0f, -1.25f, INFINITY, 0.0f, -INFINITY,
+                          1e-30f, -7.0f, 2.0f, -1e30f, 0.5f };
+    const float  fe[] = { -INFINITY, -1e30f, -7.0f, -1.25f, -0.0f, 0.0f,
+                          1e-30f, 0.5f, 2.0f, 3.5f, INFINITY };
+    const double dv[] = { 1.0, -2.5, 1e300, -1e-300, 0.0, -3.0, 2.5 };
+    const double de[] = { -3.0, -2.5, -1e-300, 0.0, 1.0, 2.5, 1e300 };
+    const size_t nf = sizeof(fv) / sizeof(fv[0]);
+    const size_t nd = sizeof(dv) / sizeof(dv[0]);
+
+    for (size_t d = 0u; d < 2u; d++) {
+        direction_t dir = d ? REVERSE : FORWARD;
+
+        tensor_expect_t rf = _make_array(nf, FLOAT_TYPE, false);
+        assert_true(rf.has_value);
+        for (size_t i = 0u; i < nf; i++)
+            assert_int_equal(push_back_tensor(rf.u.value, &fv[i], FLOAT_TYPE), NO_ERROR);
+        assert_int_equal(radix_sort_tensor(rf.u.value, dir, NULL, 0u), NO_ERROR);
+        const float* fo = (const float*)rf.u.value->data;
+        for (size_t i = 0u; i < nf; i++) {
+            float want = fe[dir == FORWARD ? i : nf - 1u - i];
+            assert_memory_equal(&fo[i], &want, sizeof(float));
+        }
+        return_tensor(rf.u.value);
+
+        tensor_expect_t rd = _make_array(nd, DOUBLE_TYPE, false);
+        assert_true(rd.has_value);
+        for (size_t i = 0u; i < nd; i++)
+            assert_int_equal(push_back_tensor(rd.u.value, &dv[i], DOUBLE_TYPE), NO_ERROR);
+        assert_int_equal(radix_sort_tensor(rd.u.value, dir, NULL, 0u), NO_ERROR);
+        const double* dout = (const double*)rd.u.value->data;
+        for (size_t i = 0u; i < nd; i++)
+            assert_true(dout[i] == de[dir == FORWARD ? i : nd - 1u - i]);
+        return_tensor(rd.u.value);
+    }
+}
+
+/** Narrow and wide integer types, including a range that skips passes. */
+static void test_radix_sort_tensor_integer_widths(void** state) {
+    (void)state;
+    const size_t n = 1000u;
+
+    tensor_expect_t r8 = _make_array(n, INT8_TYPE, false);
+    tensor_expect_t r16 = _make_array(n, UINT16_TYPE, false);
+    tensor_expect_t r64 = _make_array(n, INT64_TYPE, false);
+    assert_true(r8.has_value && r16.has_value && r64.has_value);
+
+    uint32_t seed = 5u;
+    for (size_t i = 0u; i < n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        int8_t   a = (int8_t)(seed >> 24);
+        uint16_t b = (uint16_t)(seed >> 16);
+        int64_t  c = (int64_t)(seed >> 28) - 8;   /* only the low byte varies */
+        assert_int_equal(push_back_tensor(r8.u.value,  &a, INT8_TYPE),   NO_ERROR);
+        assert_int_equal(push_back_tensor(r16.u.value, &b, UINT16_TYPE), NO_ERROR);
+        assert_int_equal(push_back_tensor(r64.u.value, &c, INT64_TYPE),  NO_ERROR);
+    }
+
+    assert_int_equal(radix_sort_tensor(r8.u.value,  FORWARD, NULL, 0u), NO_ERROR);
+    assert_int_equal(radix_sort_tensor(r16.u.value, REVERSE, NULL, 0u), NO_ERROR);
+    assert_int_equal(radix_sort_tensor(r64.u.value, FORWARD, NULL, 0u), NO_ERROR);
+
+    const int8_t*   a = (const int8_t*)r8.u.value->data;
+    const uint16_t* b = (const uint16_t*)r16.u.value->data;
+    const int64_t*  c = (const int64_t*)r64.u.value->data;
+    for (size_t i = 1u; i < n; i++) {
+        assert_true(a[i - 1u] <= a[i]);
+        assert_true(b[i - 1u] >= b[i]);
+        assert_true(c[i - 1u] <= c[i]);
+    }
+    assert_int_equal(c[0], -8);
+    assert_int_equal(c[n - 1u], 7);
+
+    return_tensor(r64.u.value);
+    return_tensor(r16.u.value);
+    return_tensor(r8.u.value);
+}
+// ================================================================================
+// ================================================================================
+// TENSOR VIEWS
+// ================================================================================
+
+/** 4 x 6 int32 tensor holding 10 * row + col. */
+static tensor_t* _make_view_matrix(void) {
+    const size_t shape[] = { 4u, 6u };
+    tensor_expect_t r = init_tensor(2u, shape, INT32_TYPE, heap_allocator());
+    assert_true(r.has_value);
+    int32_t* d = (int32_t*)r.u.value->data;
+    for (size_t i = 0u; i < 4u; i++)
+        for (size_t j = 0u; j < 6u; j++)
+            d[i * 6u + j] = (int32_t)(10u * i + j);
+    return r.u.value;
+}
+
+static int32_t _view_at(const tensor_view_t* v, size_t i, size_t j) {
+    const size_t idx[] = { i, j };
+    int32_t out = -1;
+    assert_int_equal(get_tensor_view_nd_index(v, idx, &out, INT32_TYPE), NO_ERROR);
+    return out;
+}
+
+/** Argument checks and the 1-D view of a dynamic array. */
+static void test_tensor_view_init_guards(void** state) {
+    (void)state;
+    allocator_vtable_t none = { 0 };
+    tensor_view_expect_t r = init_tensor_view(NULL, none);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, NULL_POINTER);
+
+    tensor_expect_t a = _make_array(8u, INT32_TYPE, false);
+    assert_true(a.has_value);
+    r = init_tensor_view(a.u.value, none);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, EMPTY);
+
+    for (int32_t i = 0; i < 5; i++)
+        assert_int_equal(push_back_tensor(a.u.value, &i, INT32_TYPE), NO_ERROR);
+    r = init_tensor_view(a.u.value, none);
+    assert_true(r.has_value);
+    assert_int_equal(r.u.value->ndim, 1u);
+    assert_int_equal(r.u.value->shape[0], 5u);
+    assert_int_equal(r.u.value->len, 5u);
+    assert_true(is_tensor_view_contiguous(r.u.value));
+
+    size_t idx = 5u;
+    int32_t out = 0;
+    assert_int_equal(get_tensor_view_nd_index(r.u.value, &idx, &out, INT32_TYPE),
+                     OUT_OF_BOUNDS);
+    idx = 4u;
+    assert_int_equal(get_tensor_view_nd_index(r.u.value, &idx, &out, FLOAT_TYPE),
+                     TYPE_MISMATCH);
+    assert_int_equal(get_tensor_view_nd_index(r.u.value, &idx, &out, INT32_TYPE),
+                     NO_ERROR);
+    assert_int_equal(out, 4);
+
+    return_tensor_view(r.u.value);
+    return_tensor_view(NULL);
+    return_tensor(a.u.value);
+}
+
+/** Slicing rewrites offset and strides and shares the base buffer. */
+static void test_tensor_view_slice_shares_data(void** state) {
+    (void)state;
+    tensor_t* t = _make_view_matrix();
+    tensor_view_expect_t full = init_tensor_view(t, (allocator_vtable_t){ 0 });
+    assert_true(full.has_value);
+
+    tensor_view_expect_t bad = slice_tensor_view(full.u.value, 2u, 0u, 1u, 1u);
+    assert_int_equal(bad.u.error, OUT_OF_BOUNDS);
+    bad = slice_tensor_view(full.u.value, 1u, 0u, 7u, 1u);
+    assert_int_equal(bad.u.error, OUT_OF_BOUNDS);
+    bad = slice_tensor_view(full.u.value, 1u, 3u, 3u, 1u);
+    assert_int_equal(bad.u.error, INVALID_ARG);
+    bad = slice_tensor_view(full.u.value, 1u, 0u, 6u, 0u);
+    assert_int_equal(bad.u.error, INVALID_ARG);
+
+    tensor_view_expect_t rows = slice_tensor_view(full.u.value, 0u, 1u, 4u, 1u);
+    assert_true(rows.has_value);
+    tensor_view_expect_t cols = slice_tensor_view(rows.u.value, 1u, 1u, 6u, 2u);
+    assert_true(cols.has_value);
+    return_tensor_view(rows.u.value);
+
+    tensor_view_t* v = cols.u.value;
+    assert_ptr_equal(v->base, t);
+    assert_int_equal(v->shape[0], 3u);
+    assert_int_equal(v->shape[1], 3u);
+    assert_int_equal(v->len, 9u);
+    assert_false(is_tensor_view_contiguous(v));
+    for (size_t i = 0u; i < 3u; i++)
+        for (size_t j = 0u; j < 3u; j++)
+            assert_int_equal(_view_at(v, i, j), (int32_t)(10u * (i + 1u) + 2u * j + 1u));
+
+    /* Writes to the base are visible through the view */
+    ((int32_t*)t->data)[1u * 6u + 1u] = -5;
+    assert_int_equal(_view_at(v, 0u, 0u), -5);
+
+    return_tensor_view(v);
+    return_tensor_view(full.u.value);
+    return_tensor(t);
+}
+
+/** Transpose and permute swap strides; materialize copies in view order. */
+static void test_tensor_view_transpose_and_materialize(void** state) {
+    (void)state;
+    tensor_t* t = _make_view_matrix();
+    tensor_view_expect_t full = init_tensor_view(t, (allocator_vtable_t){ 0 });
+    assert_true(full.has_value);
+    assert_true(is_tensor_view_contiguous(full.u.value));
+
+    const uint8_t dup[] = { 0u, 0u };
+    tensor_view_expect_t bad = permute_tensor_view(full.u.value, dup);
+    assert_int_equal(bad.u.error, INVALID_ARG);
+
+    tensor_view_expect_t tr = transpose_tensor_view(full.u.value);
+    assert_true(tr.has_value);
+    assert_int_equal(tr.u.value->shape[0], 6u);
+    assert_int_equal(tr.u.value->shape[1], 4u);
+    assert_false(is_tensor_view_contiguous(tr.u.value));
+    assert_int_equal(_view_at(tr.u.value, 5u, 2u), 25);
+
+    tensor_expect_t m = materialize_tensor_view(tr.u.value, (allocator_vtable_t){ 0 });
+    assert_true(m.has_value);
+    assert_int_equal(m.u.value->mode, TENSOR_STRUCT);
+    assert_int_equal(m.u.value->shape[0], 6u);
+    assert_int_equal(m.u.value->strides[0], 4u * sizeof(int32_t));
+    const int32_t* d = (const int32_t*)m.u.value->data;
+    for (size_t i = 0u; i < 6u; i++)
+        for (size_t j = 0u; j < 4u; j++)
+            assert_int_equal(d[i * 4u + j], (int32_t)(10u * j + i));
+    return_tensor(m.u.value);
+
+    /* Contiguous row slice takes the single-memcpy path */
+    tensor_view_expect_t row = slice_tensor_view(full.u.value, 0u, 2u, 3u, 1u);
+    assert_true(row.has_value);
+    assert_true(is_tensor_view_contiguous(row.u.value));
+    m = materialize_tensor_view(row.u.value, heap_allocator());
+    assert_true(m.has_value);
+    assert_memory_equal(m.u.value->data, t->data + 12u * sizeof(int32_t),
+                        6u * sizeof(int32_t));
+    return_tensor(m.u.value);
+
+    return_tensor_view(row.u.value);
+    return_tensor_view(tr.u.value);
+    return_tensor_view(full.u.value);
+    return_tensor(t);
+}
+
+/** Reshape succeeds whenever the strides allow it and refuses otherwise. */
+static void test_tensor_view_reshape(void** state) {
+    (void)state;
+    tensor_t* t = _make_view_matrix();
+    tensor_view_expect_t full = init_tensor_view(t, (allocator_vtable_t){ 0 });
+    assert_true(full.has_value);
+
+    const size_t three[] = { 2u, 3u, 4u };
+    tensor_view_expect_t r = reshape_tensor_view(full.u.value, 3u, three);
+    assert_true(r.has_value);
+    const size_t idx[] = { 1u, 2u, 3u };   /* flat 23 -> row 3, col 5 */
+    int32_t out = 0;
+    assert_int_equal(get_tensor_view_nd_index(r.u.value, idx, &out, INT32_TYPE),
+                     NO_ERROR);
+    assert_int_equal(out, 35);
+    return_tensor_view(r.u.value);
+
+    const size_t wrong[] = { 5u, 5u };
+    r = reshape_tensor_view(full.u.value, 2u, wrong);
+    assert_int_equal(r.u.error, SIZE_MISMATCH);
+
+    /* A transposed matrix cannot be flattened without a copy */
+    const size_t flat[] = { 24u };
+    tensor_view_expect_t tr = transpose_tensor_view(full.u.value);
+    assert_true(tr.has_value);
+    r = reshape_tensor_view(tr.u.value, 1u, flat);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, ILLEGAL_STATE);
+    return_tensor_view(tr.u.value);
+
+    /* A column slice can still be split along its rows */
+    tensor_view_expect_t col = slice_tensor_view(full.u.value, 1u, 4u, 5u, 1u);
+    assert_true(col.has_value);
+    const size_t split[] = { 2u, 2u, 1u };
+    r = reshape_tensor_view(col.u.value, 3u, split);
+    assert_true(r.has_value);
+    const size_t last[] = { 1u, 1u, 0u };
+    assert_int_equal(get_tensor_view_nd_index(r.u.value, last, &out, INT32_TYPE),
+                     NO_ERROR);
+    assert_int_equal(out, 34);
+    return_tensor_view(r.u.value);
+    return_tensor_view(col.u.value);
+
+    return_tensor_view(full.u.value);
+    return_tensor(t);
+}
+
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE PREPARATION (prepare_elementwise_tensor)
+// ================================================================================
+
+/** Operand checks are done before out is touched. */
+static void test_prepare_elementwise_tensor_guards(void** state) {
+    (void)state;
+    tensor_t* a = _make_random_int32(8u, 5u, 100);
+    tensor_t* b = _make_random_int32(8u, 6u, 100);
+    tensor_t* s = _make_random_int32(4u, 7u, 100);
+    tensor_expect_t fr = _make_array(8u, FLOAT_TYPE, false);
+    tensor_expect_t er = _make_array(8u, INT32_TYPE, false);
+    assert_true(fr.has_value && er.has_value);
+
+    assert_int_equal(prepare_elementwise_tensor(NULL, a, b), NULL_POINTER);
+    assert_int_equal(prepare_elementwise_tensor(a, NULL, b), NULL_POINTER);
+    assert_int_equal(prepare_elementwise_tensor(fr.u.value, a, b), TYPE_MISMATCH);
+    assert_int_equal(prepare_elementwise_tensor(a, a, fr.u.value), TYPE_MISMATCH);
+    assert_int_equal(prepare_elementwise_tensor(a, er.u.value, NULL), EMPTY);
+    assert_int_equal(prepare_elementwise_tensor(a, a, s), SIZE_MISMATCH);
+
+    /* Exact aliasing is allowed; a shifted window over the same buffer is not */
+    assert_int_equal(prepare_elementwise_tensor(a, a, b), NO_ERROR);
+    tensor_t shifted = *b;
+    shifted.data = b->data + b->data_size;
+    assert_int_equal(prepare_elementwise_tensor(&shifted, b, NULL), INVALID_ARG);
+
+    return_tensor(er.u.value);
+    return_tensor(fr.u.value);
+    return_tensor(s);
+    return_tensor(b);
+    return_tensor(a);
+}
+// --------------------------------------------------------------------------------
+
+/** An array out is resized to the operand length, growing a dynamic one;
+ *  a short fixed array is rejected. */
+static void test_prepare_elementwise_tensor_resizes_array(void** state) {
+    (void)state;
+    tensor_t* a = _make_random_int32(8u, 5u, 100);
+    tensor_expect_t big   = _make_array(16u, INT32_TYPE, false);
+    tensor_expect_t small = _make_array(4u, INT32_TYPE, true);
+    tensor_expect_t tight = _make_array(4u, INT32_TYPE, false);
+    assert_true(big.has_value && small.has_value && tight.has_value);
+
+    assert_int_equal(prepare_elementwise_tensor(big.u.value, a, NULL), NO_ERROR);
+    assert_int_equal(big.u.value->len, 8u);
+
+    /* A dynamic array grows to fit, a fixed one must already have room */
+    assert_int_equal(prepare_elementwise_tensor(small.u.value, a, NULL), NO_ERROR);
+    assert_int_equal(small.u.value->len, 8u);
+    assert_true(small.u.value->alloc >= 8u);
+    memcpy(small.u.value->data, a->data, 8u * sizeof(int32_t));
+    assert_int_equal(prepare_elementwise_tensor(tight.u.value, a, NULL), SIZE_MISMATCH);
+    assert_int_equal(tight.u.value->len, 0u);
+
+    /* A fixed-shape out must already match */
+    const size_t shape[] = { 2u, 2u };
+    tensor_expect_t fixed = _make_tensor(2u, shape, INT32_TYPE);
+    assert_true(fixed.has_value);
+    assert_int_equal(prepare_elementwise_tensor(fixed.u.value, a, NULL), SIZE_MISMATCH);
+
+    return_tensor(fixed.u.value);
+    return_tensor(tight.u.value);
+    return_tensor(small.u.value);
+    return_tensor(big.u.value);
+    return_tensor(a);
+}
+
+// ================================================================================
+// ================================================================================
+// AXIS REDUCTIONS
+// ================================================================================
+
+static void test_reduce_tensor_axis_guards(void** state) {
+    (void)state;
+    allocator_vtable_t inherit = { 0 };
+    const size_t shape[] = { 2u, 3u };
+    tensor_expect_t r = _make_tensor(2u, shape, INT32_TYPE);
+    tensor_expect_t b = _make_tensor(2u, shape, BOOL_TYPE);
+    tensor_expect_t e = _make_array(4u, INT32_TYPE, false);
+    assert_true(r.has_value && b.has_value && e.has_value);
+
+    assert_int_equal(reduce_tensor_axis(NULL, 0u, REDUCE_SUM, inherit).u.error,
+                     NULL_POINTER);
+    assert_int_equal(reduce_tensor_axis(r.u.value, 2u, REDUCE_SUM, inherit).u.error,
+                     OUT_OF_BOUNDS);
+    assert_int_equal(reduce_tensor_axis(r.u.value, 0u, (reduce_op_t)9, inherit).u.error,
+                     INVALID_ARG);
+    assert_int_equal(reduce_tensor_axis(b.u.value, 0u, REDUCE_MAX, inherit).u.error,
+                     TYPE_MISMATCH);
+    assert_int_equal(reduce_tensor_axis(e.u.value, 0u, REDUCE_MAX, inherit).u.error,
+                     EMPTY);
+
+    return_tensor(e.u.value);
+    return_tensor(b.u.value);
+    return_tensor(r.u.value);
+}
+// --------------------------------------------------------------------------------
+
+/** 3 x 4 int32 matrix holding 10 * row - col; every op along both axes. */
+static void test_reduce_tensor_axis_int32_matrix(void** state) {
+    (void)state;
+    allocator_vtable_t inherit = { 0 };
+    const size_t shape[] = { 3u, 4u };
+    tensor_expect_t r = _make_tensor(2u, shape, INT32_TYPE);
+    assert_true(r.has_value);
+    int32_t* d = (int32_t*)r.u.value->data;
+    for (size_t i = 0u; i < 3u; i++)
+        for (size_t j = 0u; j < 4u; j++) d[i * 4u + j] = (int32_t)(10 * i) - (int32_t)j;
+
+    const struct { uint8_t axis; reduce_op_t op; int32_t e[4]; } cases[] = {
+        { 0u, REDUCE_SUM,  { 30, 27, 24, 21 } },
+        { 0u, REDUCE_MIN,  { 0, -1, -2, -3 } },
+        { 0u, REDUCE_MAX,  { 20, 19, 18, 17 } },
+        { 0u, REDUCE_MEAN, { 10, 9, 8, 7 } },
+        { 1u, REDUCE_SUM,  { -6, 34, 74 } },
+        { 1u, REDUCE_MIN,  { -3, 7, 17 } },
+        { 1u, REDUCE_MAX,  { 0, 10, 20 } },
+        { 1u, REDUCE_MEAN, { -1, 8, 18 } },   /* -1.5, 8.5, 18.5 truncated */
+    };
+    for (size_t k = 0u; k < sizeof(cases) / sizeof(cases[0]); k++) {
+        tensor_expect_t o = reduce_tensor_axis(r.u.value, cases[k].axis, cases[k].op,
+                                               inherit);
+        assert_true(o.has_value);
+        size_t const n = (cases[k].axis == 0u) ? 4u : 3u;
+        assert_int_equal(o.u.value->ndim, 1u);
+        assert_int_equal(o.u.value->shape[0], n);
+        const int32_t* x = (const int32_t*)o.u.value->data;
+        for (size_t i = 0u; i < n; i++) assert_int_equal(x[i], cases[k].e[i]);
+        return_tensor(o.u.value);
+    }
+    return_tensor(r.u.value);
+}
+// --------------------------------------------------------------------------------
+
+/** Middle axis of a 3-D tensor and an inner extent spanning several strips. */
+static void test_reduce_tensor_axis_strips_match_reference(void** state) {
+    (void)state;
+    const size_t shape[] = { 2u, 5u, 1100u };
+    tensor_expect_t r = _make_tensor(3u, shape, INT16_TYPE);
+    assert_true(r.has_value);
+    int16_t* d = (int16_t*)r.u.value->data;
+    for (size_t i = 0u; i < 2u * 5u * 1100u; i++)
+        d[i] = (int16_t)((int)((i * 7919u) % 2001u) - 1000);
+
+    const reduce_op_t ops[] = { REDUCE_SUM, REDUCE_MIN, REDUCE_MAX, REDUCE_MEAN };
+    for (size_t k = 0u; k < 4u; k++) {
+        tensor_expect_t o = reduce_tensor_axis(r.u.value, 1u, ops[k], heap_allocator());
+        assert_true(o.has_value);
+        assert_int_equal(o.u.value->ndim, 2u);
+        assert_int_equal(o.u.value->shape[0], 2u);
+        assert_int_equal(o.u.value->shape[1], 1100u);
+        const int16_t* x = (const int16_t*)o.u.value->data;
+        for (size_t a = 0u; a < 2u; a++) {
+            for (size_t c = 0u; c < 1100u; c++) {
+                int32_t sum = 0, lo = INT16_MAX, hi = INT16_MIN;
+                for (size_t j = 0u; j < 5u; j++) {
+                    int16_t v = d[(a * 5u + j) * 1100u + c];
+                    sum += v;
+                    if (v < lo) lo = v;
+                    if (v > hi) hi = v;
+                }
+                int32_t e = (ops[k] == REDUCE_SUM) ? sum : (ops[k] == REDUCE_MIN) ? lo :
+                            (ops[k] == REDUCE_MAX) ? hi : sum / 5;
+                assert_int_equal(x[a * 1100u + c], (int16_t)e);
+            }
+        }
+        return_tensor(o.u.value);
+    }
+    return_tensor(r.u.value);
+}
+// --------------------------------------------------------------------------------
+
+static void test_reduce_tensor_axis_float_nan_and_array(void** state) {
+    (void)state;
+    allocator_vtable_t inherit = { 0 };
+    const size_t shape[] = { 3u, 4u };
+    tensor_expect_t r = _make_tensor(2u, shape, FLOAT_TYPE);
+    assert_true(r.has_value);
+    float* d = (float*)r.u.value->data;
+    for (size_t i = 0u; i < 12u; i++) d[i] = (float)i;
+    d[6] = NAN;   /* row 1, column 2 */
+
+    tensor_expect_t o = reduce_tensor_axis(r.u.value, 0u, REDUCE_MAX, inherit);
+    assert_true(o.has_value);
+    const float* x = (const float*)o.u.value->data;
+    assert_float_equal(x[0], 8.0f, 0.0f);
+    assert_float_equal(x[3], 11.0f, 0.0f);
+    assert_true(isnan(x[2]));
+    return_tensor(o.u.value);
+
+    o = reduce_tensor_axis(r.u.value, 1u, REDUCE_MIN, inherit);
+    assert_true(o.has_value);
+    x = (const float*)o.u.value->data;
+    assert_float_equal(x[0], 0.0f, 0.0f);
+    assert_true(isnan(x[1]));
+    assert_float_equal(x[2], 8.0f, 0.0f);
+    return_tensor(o.u.value);
+
+    /* An array reduces over its live elements into shape {1} */
+    tensor_expect_t a = _make_array(16u, FLOAT_TYPE, false);
+    assert_true(a.has_value);
+    for (size_t i = 0u; i < 5u; i++) {
+        float v = (float)i + 0.5f;
+        assert_int_equal(push_back_tensor(a.u.value, &v, FLOAT_TYPE), NO_ERROR);
+    }
+    o = reduce_tensor_axis(a.u.value, 0u, REDUCE_MEAN, inherit);
+    assert_true(o.has_value);
+    assert_int_equal(o.u.value->ndim, 1u);
+    assert_int_equal(o.u.value->shape[0], 1u);
+    assert_float_equal(((const float*)o.u.value->data)[0], 2.5f, 1e-6f);
+    return_tensor(o.u.value);
+
+    return_tensor(a.u.value);
+    return_tensor(r.u.value);
+}
+// --------------------------------------------------------------------------------
+
+/** 64-bit means accumulate exactly and report overflow on either path. */
+static void test_reduce_tensor_axis_int64_mean_overflow(void** state) {
+    (void)state;
+    allocator_vtable_t inherit = { 0 };
+    const size_t shape[] = { 2u, 2u };
+    tensor_expect_t r = _make_tensor(2u, shape, INT64_TYPE);
+    assert_true(r.has_value);
+    int64_t* d = (int64_t*)r.u.value->data;
+    d[0] = INT64_MAX;  d[1] = 1;
+    d[2] = INT64_MAX;  d[3] = 3;
+
+    assert_int_equal(reduce_tensor_axis(r.u.value, 0u, REDUCE_MEAN, inherit).u.error,
+                     NUMERIC_OVERFLOW);
+    assert_int_equal(reduce_tensor_axis(r.u.value, 1u, REDUCE_MEAN, inherit).u.error,
+                     NUMERIC_OVERFLOW);
+
+    /* Sums wrap instead */
+    tensor_expect_t o = reduce_tensor_axis(r.u.value, 0u, REDUCE_SUM, inherit);
+    assert_true(o.has_value);
+    assert_true(((const int64_t*)o.u.value->data)[0] == -2);
+    assert_true(((const int64_t*)o.u.value->data)[1] == 4);
+    return_tensor(o.u.value);
+
+    d[0] = INT64_MAX - 1;
+    d[2] = -3;
+    o = reduce_tensor_axis(r.u.value, 1u, REDUCE_MEAN, inherit);
+    assert_true(o.has_value);
+    assert_true(((const int64_t*)o.u.value->data)[0] == INT64_MAX / 2);
+    assert_true(((const int64_t*)o.u.value->data)[1] == 0);
+    return_tensor(o.u.value);
+
+    return_tensor(r.u.value);
+}
+
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS (cumulative_sum_tensor)
+// ================================================================================
+
+/** Argument, dtype and shape errors are reported before anything is written. */
+static void test_cumulative_sum_tensor_guards(void** state) {
+    (void)state;
+    const size_t shape[] = { 4u };
+    tensor_expect_t a = _make_tensor(1u, shape, INT32_TYPE);
+    tensor_expect_t f = _make_tensor(1u, shape, FLOAT_TYPE);
+    tensor_expect_t c = _make_tensor(1u, shape, CHAR_TYPE);
+    tensor_expect_t e = _make_array(4u, INT32_TYPE, false);
+    assert_true(a.has_value && f.has_value && c.has_value && e.has_value);
+
+    assert_int_equal(cumulative_sum_tensor(NULL, a.u.value, SCAN_INCLUSIVE, 1u),
+                     NULL_POINTER);
+    assert_int_equal(cumulative_sum_tensor(a.u.value, NULL, SCAN_INCLUSIVE, 1u),
+                     NULL_POINTER);
+    assert_int_equal(cumulative_sum_tensor(a.u.value, a.u.value, (scan_mode_t)2, 1u),
+                     INVALID_ARG);
+    assert_int_equal(cumulative_sum_tensor(c.u.value, c.u.value, SCAN_INCLUSIVE, 1u),
+                     TYPE_MISMATCH);
+    assert_int_equal(cumulative_sum_tensor(f.u.value, a.u.value, SCAN_INCLUSIVE, 1u),
+                     TYPE_MISMATCH);
+    assert_int_equal(cumulative_sum_tensor(a.u.value, e.u.value, SCAN_INCLUSIVE, 1u),
+                     EMPTY);
+
+    /* A fixed-shape destination must already match */
+    const size_t big[] = { 8u };
+    tensor_expect_t b = _make_tensor(1u, big, INT32_TYPE);
+    assert_true(b.has_value);
+    assert_int_equal(cumulative_sum_tensor(a.u.value, b.u.value, SCAN_INCLUSIVE, 1u),
+                     SIZE_MISMATCH);
+
+    return_tensor(b.u.value);
+    return_tensor(e.u.value);
+    return_tensor(c.u.value);
+    return_tensor(f.u.value);
+    return_tensor(a.u.value);
+}
+// --------------------------------------------------------------------------------
+
+/** Inclusive and exclusive scans of a small int32 matrix, in place and out. */
+static void test_cumulative_sum_tensor_int32_modes(void** state) {
+    (void)state;
+    const size_t shape[] = { 2u, 3u };
+    tensor_expect_t a = _make_tensor(2u, shape, INT32_TYPE);
+    tensor_expect_t o = _make_array(8u, INT32_TYPE, false);
+    assert_true(a.has_value && o.has_value);
+    int32_t* x = (int32_t*)a.u.value->data;
+    const int32_t v[] = { 3, -1, 4, 1, -5, 9 };
+    memcpy(x, v, sizeof(v));
+
+    /* An array destination is resized to a's length */
+    assert_int_equal(cumulative_sum_tensor(o.u.value, a.u.value, SCAN_EXCLUSIVE, 1u),
+                     NO_ERROR);
+    assert_int_equal(o.u.value->len, 6u);
+    const int32_t ex[] = { 0, 3, 2, 6, 7, 2 };
+    assert_memory_equal(o.u.value->data, ex, sizeof(ex));
+
+    assert_int_equal(cumulative_sum_tensor(a.u.value, a.u.value, SCAN_INCLUSIVE, 0u),
+                     NO_ERROR);
+    const int32_t in[] = { 3, 2, 6, 7, 2, 11 };
+    assert_memory_equal(x, in, sizeof(in));
+
+    return_tensor(o.u.value);
+    return_tensor(a.u.value);
+}
+// --------------------------------------------------------------------------------
+
+/** Integer scans wrap, and LDOUBLE takes the scalar path. */
+static void test_cumulative_sum_tensor_wraps_and_ldouble(void** state) {
+    (void)state;
+    const size_t shape[] = { 37u };
+    tensor_expect_t a = _make_tensor(1u, shape, INT8_TYPE);
+    tensor_expect_t l = _make_tensor(1u, shape, LDOUBLE_TYPE);
+    assert_true(a.has_value && l.has_value);
+    int8_t*      x = (int8_t*)a.u.value->data;
+    long double* y = (long double*)l.u.value->data;
+    for (size_t i = 0u; i < 37u; i++) {
+        x[i] = 100;
+        y[i] = 0.5L * (long double)i;
+    }
+
+    assert_int_equal(cumulative_sum_tensor(a.u.value, a.u.value, SCAN_INCLUSIVE, 1u),
+                     NO_ERROR);
+    int8_t run = 0;
+    for (size_t i = 0u; i < 37u; i++) {
+        run = (int8_t)(uint8_t)((uint8_t)run + 100u);
+        assert_int_equal(x[i], run);
+    }
+
+    assert_int_equal(cumulative_sum_tensor(l.u.value, l.u.value, SCAN_EXCLUSIVE, 1u),
+                     NO_ERROR);
+    assert_true(y[0] == 0.0L);
+    assert_true(y[36] == 0.25L * 36.0L * 35.0L);
+
+    return_tensor(l.u.value);
+    return_tensor(a.u.value);
+}
+// --------------------------------------------------------------------------------
+
+/** The blocked multi-thread scan matches a serial reference for every
+ *  thread count, including ones that do not divide the length. */
+static void test_cumulative_sum_tensor_parallel_matches_serial(void** state) {
+    (void)state;
+    const size_t n = 4u * 65536u + 1237u;
+    const size_t shape[] = { n };
+    tensor_expect_t a = _make_tensor(1u, shape, UINT32_TYPE);
+    tensor_expect_t o = _make_tensor(1u, shape, UINT32_TYPE);
+    tensor_expect_t d = _make_tensor(1u, shape, DOUBLE_TYPE);
+    tensor_expect_t q = _make_tensor(1u, shape, INT64_TYPE);
+    assert_true(a.has_value && o.has_value && d.has_value && q.has_value);
+    uint32_t* x  = (uint32_t*)a.u.value->data;
+    uint32_t* z  = (uint32_t*)o.u.value->data;
+    double*   dx = (double*)d.u.value->data;
+    int64_t*  qx = (int64_t*)q.u.value->data;
+    uint32_t seed = 7u;
+    for (size_t i = 0u; i < n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        x[i]  = seed;
+        dx[i] = (double)(seed >> 24);          /* small integers: sums are exact */
+        qx[i] = (seed & 1u) ? -(int64_t)(seed >> 4) : (int64_t)seed << 20;
+    }
+
+    const size_t threads[] = { 1u, 2u, 3u, 4u };
+    for (size_t t = 0u; t < 4u; t++) {
+        assert_int_equal(cumulative_sum_tensor(o.u.value, a.u.value, SCAN_EXCLUSIVE,
+                                               threads[t]), NO_ERROR);
+        uint32_t run = 0u;
+        for (size_t i = 0u; i < n; i++) {
+            if (z[i] != run) fail_msg("uint32 exclusive, %zu threads, i = %zu",
+                                      threads[t], i);
+            run += x[i];
+        }
+    }
+
+    assert_int_equal(cumulative_sum_tensor(d.u.value, d.u.value, SCAN_INCLUSIVE, 3u),
+                     NO_ERROR);
+    assert_int_equal(cumulative_sum_tensor(q.u.value, q.u.value, SCAN_INCLUSIVE, 4u),
+                     NO_ERROR);
+    seed = 7u;
+    double   dr = 0.0;
+    uint64_t qr = 0u;
+    for (size_t i = 0u; i < n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        dr += (double)(seed >> 24);
+        qr += (seed & 1u) ? 0u - (uint64_t)(seed >> 4) : (uint64_t)seed << 20;
+        if (dx[i] != dr)           fail_msg("double inclusive, i = %zu", i);
+        if ((uint64_t)qx[i] != qr) fail_msg("int64 inclusive, i = %zu", i);
+    }
+
+    return_tensor(q.u.value);
+    return_tensor(d.u.value);
+    return_tensor(o.u.value);
+    return_tensor(a.u.value);
+}
+
+// ================================================================================
+// ================================================================================
+// BROADCASTING (broadcast_tensor)
+// ================================================================================
+
+/** Shapes align on the right; extent-1 axes stretch and mismatches fail. */
+static void test_broadcast_tensor_shape(void** state) {
+    (void)state;
+    const size_t col_shape[] = { 4u, 1u };
+    const size_t row_shape[] = { 3u };
+    const size_t bad_shape[] = { 2u, 5u };
+    tensor_expect_t col = _make_tensor(2u, col_shape, FLOAT_TYPE);
+    tensor_expect_t row = _make_tensor(1u, row_shape, FLOAT_TYPE);
+    tensor_expect_t bad = _make_tensor(2u, bad_shape, FLOAT_TYPE);
+    tensor_expect_t e   = _make_array(4u, FLOAT_TYPE, false);
+    assert_true(col.has_value && row.has_value && bad.has_value && e.has_value);
+
+    size_t  shape[4];
+    uint8_t ndim = 0u;
+    assert_int_equal(broadcast_tensor_shape(col.u.value, row.u.value, shape, &ndim),
+                     NO_ERROR);
+    assert_int_equal(ndim, 2u);
+    assert_int_equal(shape[0], 4u);
+    assert_int_equal(shape[1], 3u);
+
+    assert_int_equal(broadcast_tensor_shape(row.u.value, bad.u.value, shape, &ndim),
+                     SIZE_MISMATCH);
+    assert_int_equal(broadcast_tensor_shape(row.u.value, e.u.value, shape, &ndim),
+                     EMPTY);
+    assert_int_equal(broadcast_tensor_shape(NULL, row.u.value, shape, &ndim),
+                     NULL_POINTER);
+    assert_int_equal(broadcast_tensor_shape(col.u.value, row.u.value, NULL, &ndim),
+                     NULL_POINTER);
+
+    return_tensor(e.u.value);
+    return_tensor(bad.u.value);
+    return_tensor(row.u.value);
+    return_tensor(col.u.value);
+}
+// --------------------------------------------------------------------------------
+
+/** Argument, dtype, shape and divisor errors leave out untouched. */
+static void test_broadcast_tensor_guards(void** state) {
+    (void)state;
+    const size_t a_shape[] = { 2u, 3u };
+    const size_t b_shape[] = { 1u, 3u };
+    const size_t o_shape[] = { 3u, 2u };
+    tensor_expect_t a = _make_tensor(2u, a_shape, INT32_TYPE);
+    tensor_expect_t b = _make_tensor(2u, b_shape, INT32_TYPE);
+    tensor_expect_t o = _make_tensor(2u, o_shape, INT32_TYPE);
+    tensor_expect_t f = _make_tensor(2u, a_shape, FLOAT_TYPE);
+    tensor_expect_t c = _make_tensor(2u, a_shape, CHAR_TYPE);
+    assert_true(a.has_value && b.has_value && o.has_value && f.has_value && c.has_value);
+
+    assert_int_equal(broadcast_tensor(NULL, a.u.value, b.u.value, BINARY_ADD),
+                     NULL_POINTER);
+    assert_int_equal(broadcast_tensor(a.u.value, a.u.value, NULL, BINARY_ADD),
+                     NULL_POINTER);
+    assert_int_equal(broadcast_tensor(a.u.value, a.u.value, b.u.value, (binary_op_t)6),
+                     INVALID_ARG);
+    assert_int_equal(broadcast_tensor(c.u.value, c.u.value, c.u.value, BINARY_ADD),
+                     TYPE_MISMATCH);
+    assert_int_equal(broadcast_tensor(f.u.value, a.u.value, b.u.value, BINARY_ADD),
+                     TYPE_MISMATCH);
+
+    /* {3, 2} is not the broadcast shape {2, 3}, though it holds as many */
+    assert_int_equal(broadcast_tensor(o.u.value, a.u.value, b.u.value, BINARY_ADD),
+                     SIZE_MISMATCH);
+    assert_int_equal(broadcast_tensor(a.u.value, a.u.value, o.u.value, BINARY_ADD),
+                     SIZE_MISMATCH);
+
+    int32_t* y = (int32_t*)b.u.value->data;
+    int32_t* x = (int32_t*)a.u.value->data;
+    y[0] = 1; y[1] = 0; y[2] = 3;
+    for (size_t i = 0u; i < 6u; i++) x[i] = 7;
+    assert_int_equal(broadcast_tensor(a.u.value, a.u.value, b.u.value, BINARY_DIV),
+                     DIV_BY_ZERO);
+    for (size_t i = 0u; i < 6u; i++) assert_int_equal(x[i], 7);
+
+    return_tensor(c.u.value);
+    return_tensor(f.u.value);
+    return_tensor(o.u.value);
+    return_tensor(b.u.value);
+    return_tensor(a.u.value);
+}
+// --------------------------------------------------------------------------------
+
+/** A {N, 1} column against a {1, M} row gives the full {N, M} table for
+ *  every operation, with neither input expanded. */
+static void test_broadcast_tensor_float_outer(void** state) {
+    (void)state;
+    const size_t col_shape[] = { 5u, 1u };
+    const size_t row_shape[] = { 1u, 37u };
+    const size_t out_shape[] = { 5u, 37u };
+    tensor_expect_t c = _make_tensor(2u, col_shape, FLOAT_TYPE);
+    tensor_expect_t r = _make_tensor(2u, row_shape, FLOAT_TYPE);
+    tensor_expect_t o = _make_tensor(2u, out_shape, FLOAT_TYPE);
+    assert_true(c.has_value && r.has_value && o.has_value);
+    float* x = (float*)c.u.value->data;
+    float* y = (float*)r.u.value->data;
+    const float* z = (const float*)o.u.value->data;
+    for (size_t i = 0u; i < 5u; i++)  x[i] = (float)i - 2.0f;
+    for (size_t j = 0u; j < 37u; j++) y[j] = 0.25f * (float)j + 1.0f;
+
+    for (int op = BINARY_ADD; op <= BINARY_MAX; op++) {
+        assert_int_equal(broadcast_tensor(o.u.value, c.u.value, r.u.value,
+                                          (binary_op_t)op), NO_ERROR);
+        for (size_t i = 0u; i < 5u; i++) {
+            for (size_t j = 0u; j < 37u; j++) {
+                float const p = x[i];
+                float const q = y[j];
+                float want;
+                switch ((binary_op_t)op) {
+                    case BINARY_ADD: want = p + q; break;
+                    case BINARY_SUB: want = p - q; break;
+                    case BINARY_MUL: want = p * q; break;
+                    case BINARY_DIV: want = p / q; break;
+                    case BINARY_MIN: want = (q < p) ? q : p; break;
+                    default:         want = (q > p) ? q : p; break;
+                }
+                assert_float_equal(z[i * 37u + j], want, 0.0f);
+            }
+        }
+    }
+
+    /* The row may also sit on the left: {1, 37} - {5, 1} */
+    assert_int_equal(broadcast_tensor(o.u.value, r.u.value, c.u.value, BINARY_SUB),
+                     NO_ERROR);
+    assert_float_equal(z[3u * 37u + 10u], y[10] - x[3], 0.0f);
+
+    return_tensor(o.u.value);
+    return_tensor(r.u.value);
+    return_tensor(c.u.value);
+}
+// --------------------------------------------------------------------------------
+
+/** Broadcasting along a middle axis and a long inner axis (longer than one
+ *  splat strip) matches an index-by-index reference, in place on a. */
+static void test_broadcast_tensor_int32_matches_reference(void** state) {
+    (void)state;
+    const size_t a_shape[] = { 3u, 4u, 1100u };
+    const size_t b_shape[] = { 3u, 1u, 1u };
+    const size_t c_shape[] = { 4u, 1u };
+    const size_t n = 3u * 4u * 1100u;
+    tensor_expect_t a = _make_tensor(3u, a_shape, INT32_TYPE);
+    tensor_expect_t b = _make_tensor(3u, b_shape, INT32_TYPE);
+    tensor_expect_t c = _make_tensor(2u, c_shape, INT32_TYPE);
+    tensor_expect_t r = _make_tensor(3u, a_shape, INT32_TYPE);
+    assert_true(a.has_value && b.has_value && c.has_value && r.has_value);
+    int32_t* x = (int32_t*)a.u.value->data;
+    int32_t* y = (int32_t*)b.u.value->data;
+    int32_t* w = (int32_t*)c.u.value->data;
+    int32_t* ref = (int32_t*)r.u.value->data;
+    for (size_t i = 0u; i < n; i++) x[i] = (int32_t)((uint32_t)(i * 2654435761u) >> 8) - 8000000;
+    y[0] = 7; y[1] = -3; y[2] = 1000;
+    w[0] = -1; w[1] = 2; w[2] = 5; w[3] = INT32_MIN;
+    memcpy(ref, x, n * sizeof(int32_t));
+
+    /* a *= b over {3, 4, 1100} x {3, 1, 1} */
+    assert_int_equal(broadcast_tensor(a.u.value, a.u.value, b.u.value, BINARY_MUL),
+                     NO_ERROR);
+    for (size_t i = 0u; i < n; i++) {
+        ref[i] = (int32_t)((uint32_t)ref[i] * (uint32_t)y[i / 4400u]);
+        if (x[i] != ref[i]) fail_msg("mul, i = %zu", i);
+    }
+
+    /* a /= c over {3, 4, 1100} x {4, 1}; INT32_MIN / -1 wraps */
+    x[0] = INT32_MIN;
+    ref[0] = INT32_MIN;
+    assert_int_equal(broadcast_tensor(a.u.value, a.u.value, c.u.value, BINARY_DIV),
+                     NO_ERROR);
+    for (size_t i = 0u; i < n; i++) {
+        int32_t const d = w[(i / 1100u) % 4u];
+        ref[i] = (d == -1) ? (int32_t)(0u - (uint32_t)ref[i]) : ref[i] / d;
+        if (x[i] != ref[i]) fail_msg("div, i = %zu", i);
+    }
+    assert_int_equal(x[0], INT32_MIN);
+
+    return_tensor(r.u.value);
+    return_tensor(c.u.value);
+    return_tensor(b.u.value);
+    return_tensor(a.u.value);
+}
+// --------------------------------------------------------------------------------
+
+/** An array out is resized to a 1-D result; a scalar operand broadcasts
+ *  everywhere; LDOUBLE min propagates NaN. */
+static void test_broadcast_tensor_array_scalar_ldouble(void** state) {
+    (void)state;
+    const size_t one[] = { 1u };
+    tensor_expect_t v = _make_array(8u, UINT8_TYPE, false);
+    tensor_expect_t s = _make_tensor(1u, one, UINT8_TYPE);
+    tensor_expect_t o = _make_array(8u, UINT8_TYPE, false);
+    assert_true(v.has_value && s.has_value && o.has_value);
+    uint8_t* x = (uint8_t*)v.u.value->data;
+    for (size_t i = 0u; i < 6u; i++) x[i] = (uint8_t)(250u + i);
+    v.u.value->len = 6u;
+    *(uint8_t*)s.u.value->data = 10u;
+
+    assert_int_equal(broadcast_tensor(o.u.value, v.u.value, s.u.value, BINARY_ADD),
+                     NO_ERROR);
+    assert_int_equal(o.u.value->len, 6u);
+    const uint8_t want[] = { 4u, 5u, 6u, 7u, 8u, 9u };
+    assert_memory_equal(o.u.value->data, want, sizeof(want));
+
+    const size_t l_shape[] = { 2u, 2u };
+    const size_t m_shape[] = { 2u };
+    tensor_expect_t l = _make_tensor(2u, l_shape, LDOUBLE_TYPE);
+    tensor_expect_t m = _make_tensor(1u, m_shape, LDOUBLE_TYPE);
+    assert_true(l.has_value && m.has_value);
+    long double* p = (long double*)l.u.value->data;
+    long double* q = (long double*)m.u.value->data;
+    p[0] = 1.0L; p[1] = 5.0L; p[2] = NAN; p[3] = -2.0L;
+    q[0] = 3.0L; q[1] = 4.0L;
+    assert_int_equal(broadcast_tensor(l.u.value, l.u.value, m.u.value, BINARY_MIN),
+                     NO_ERROR);
+    assert_true(p[0] == 1.0L);
+    assert_true(p[1] == 4.0L);
+    assert_true(isnan(p[2]));
+    assert_true(p[3] == -2.0L);
+
+    return_tensor(m.u.value);
+    return_tensor(l.u.value);
+    return_tensor(o.u.value);
+    return_tensor(s.u.value);
+    return_tensor(v.u.value);
+}
+
+// ================================================================================
+// ================================================================================
+// FILE STORAGE (write_tensor_file, map_tensor_file)
+// ================================================================================
+
+#define TENSOR_TEST_FILE "csalt_test_tensor_file.tns"
+
+/** A written tensor maps back with the same dtype, shape, strides and
+ *  bytes, with its data aligned inside the mapping and not copied. */
+static void test_tensor_file_round_trip(void** state) {
+    (void)state;
+    const size_t shape[] = { 3u, 5u, 7u };
+    tensor_expect_t a = _make_tensor(3u, shape, DOUBLE_TYPE);
+    assert_true(a.has_value);
+    double* x = (double*)a.u.value->data;
+    for (size_t i = 0u; i < 105u; i++) x[i] = 0.5 * (double)i - 3.0;
+
+    assert_int_equal(write_tensor_file(a.u.value, TENSOR_TEST_FILE, 0u), NO_ERROR);
+    tensor_expect_t m = map_tensor_file(TENSOR_TEST_FILE, heap_allocator());
+    assert_true(m.has_value);
+    tensor_t* t = m.u.value;
+
+    assert_int_equal(t->dtype, DOUBLE_TYPE);
+    assert_int_equal(t->mode, TENSOR_STRUCT);
+    assert_int_equal(t->ndim, 3u);
+    assert_int_equal(t->len, 105u);
+    for (uint8_t i = 0u; i < 3u; i++) {
+        assert_int_equal(t->shape[i], a.u.value->shape[i]);
+        assert_int_equal(t->strides[i], a.u.value->strides[i]);
+    }
+    assert_int_equal((uintptr_t)t->data % TENSOR_FILE_ALIGNMENT, 0u);
+    assert_memory_equal(t->data, x, 105u * sizeof(double));
+
+    const size_t idx[] = { 2u, 4u, 6u };
+    double v = 0.0;
+    assert_int_equal(get_tensor_nd_index(t, idx, &v, DOUBLE_TYPE), NO_ERROR);
+    assert_true(v == x[104]);
+
+    /* The mapping is fixed-shape; a copy is writable */
+    assert_int_equal(push_back_tensor(t, &v, DOUBLE_TYPE), PRECONDITION_FAIL);
+    tensor_expect_t c = copy_tensor(t, NULL);
+    assert_true(c.has_value);
+    double const w = 42.0;
+    assert_int_equal(set_tensor_index(c.u.value, 0u, &w, DOUBLE_TYPE), NO_ERROR);
+
+    /* In-place operations write private copies of the mapped pages */
+    assert_int_equal(sort_tensor(t, _cmp_double, REVERSE), NO_ERROR);
+    assert_true(((double*)t->data)[0] == x[104]);
+    assert_true(((double*)t->data)[104] == x[0]);
+
+    /* The copy keeps the allocator alive after the mapping is returned */
+    return_tensor(t);
+    assert_true(((double*)c.u.value->data)[1] == x[1]);
+    return_tensor(c.u.value);
+
+    /* ... and the file itself is untouched */
+    m = map_tensor_file(TENSOR_TEST_FILE, heap_allocator());
+    assert_true(m.has_value);
+    assert_memory_equal(m.u.value->data, x, 105u * sizeof(double));
+    return_tensor(m.u.value);
+
+    return_tensor(a.u.value);
+    remove(TENSOR_TEST_FILE);
+}
+// --------------------------------------------------------------------------------
+
+/** An array is stored as its live elements, at a page-sized alignment. */
+static void test_tensor_file_array_alignment(void** state) {
+    (void)state;
+    tensor_expect_t a = _make_array(16u, INT16_TYPE, false);
+    assert_true(a.has_value);
+    for (int16_t i = 0; i < 11; i++) {
+        int16_t const v = (int16_t)(i * -300);
+        assert_int_equal(push_back_tensor(a.u.value, &v, INT16_TYPE), NO_ERROR);
+    }
+
+    assert_int_equal(write_tensor_file(a.u.value, TENSOR_TEST_FILE, 4096u), NO_ERROR);
+    tensor_expect_t m = map_tensor_file(TENSOR_TEST_FILE, heap_allocator());
+    assert_true(m.has_value);
+    assert_int_equal(m.u.value->ndim, 1u);
+    assert_int_equal(m.u.value->shape[0], 11u);
+    assert_int_equal(m.u.value->len, 11u);
+    assert_int_equal((uintptr_t)m.u.value->data % 4096u, 0u);
+    assert_memory_equal(m.u.value->data, a.u.value->data, 11u * sizeof(int16_t));
+
+    return_tensor(m.u.value);
+    return_tensor(a.u.value);
+    remove(TENSOR_TEST_FILE);
+}
+// --------------------------------------------------------------------------------
+
+/** Bad arguments, missing files and damaged headers are reported. */
+static void test_tensor_file_errors(void** state) {
+    (void)state;
+    const size_t shape[] = { 4u, 4u };
+    tensor_expect_t a = _make_tensor(2u, shape, UINT32_TYPE);
+    tensor_expect_t e = _make_array(4u, UINT32_TYPE, false);
+    assert_true(a.has_value && e.has_value);
+    allocator_vtable_t heap = heap_allocator();
+
+    assert_int_equal(write_tensor_file(NULL, TENSOR_TEST_FILE, 0u), NULL_POINTER);
+    assert_int_equal(write_tensor_file(a.u.value, NULL, 0u), NULL_POINTER);
+    assert_int_equal(write_tensor_file(e.u.value, TENSOR_TEST_FILE, 0u), EMPTY);
+    assert_int_equal(write_tensor_file(a.u.value, TENSOR_TEST_FILE, 48u), INVALID_ARG);
+    assert_int_equal(write_tensor_file(a.u.value, TENSOR_TEST_FILE, 8192u), INVALID_ARG);
+    assert_int_equal(write_tensor_file(a.u.value, "no_such_dir/x.tns", 0u), FILE_OPEN);
+
+    tensor_expect_t r = map_tensor_file(NULL, heap);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, NULL_POINTER);
+    r = map_tensor_file("no_such_file.tns", heap);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, FILE_OPEN);
+
+    /* Not a tensor file */
+    FILE* f = fopen(TENSOR_TEST_FILE, "wb");
+    assert_non_null(f);
+    for (int i = 0; i < 100; i++) fputc('x', f);
+    fclose(f);
+    r = map_tensor_file(TENSOR_TEST_FILE, heap);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, FORMAT_INVALID);
+
+    /* A valid header whose data has been cut short */
+    assert_int_equal(write_tensor_file(a.u.value, TENSOR_TEST_FILE, 0u), NO_ERROR);
+    assert_int_equal(truncate(TENSOR_TEST_FILE, 128 + 4 * 15), 0);   /* 15 of 16 */
+    r = map_tensor_file(TENSOR_TEST_FILE, heap);
+    assert_false(r.has_value);
+    assert_int_equal(r.u.error, FORMAT_INVALID);
+
+    return_tensor(e.u.value);
+    return_tensor(a.u.value);
+    remove(TENSOR_TEST_FILE);
+}
 
 const struct CMUnitTest test_tensor[] = {
     /* init — guard tests */
@@ -4659,6 +6049,14 @@ const struct CMUnitTest test_tensor[] = {
     cmocka_unit_test(test_push_back_pop_back_lifo),
     cmocka_unit_test(test_pop_interleaved),
 
+    /* bulk push / pop */
+    cmocka_unit_test(test_bulk_push_pop_guards),
+    cmocka_unit_test(test_push_back_n_grows_once),
+    cmocka_unit_test(test_push_back_n_partial_when_fixed),
+    cmocka_unit_test(test_push_back_n_self_alias),
+    cmocka_unit_test(test_push_at_n_positions),
+    cmocka_unit_test(test_pop_back_n),
+
     /* concat_tensor_array — null/guard */
     cmocka_unit_test(test_concat_null),
     cmocka_unit_test(test_concat_type_mismatch_dtype_arg),
@@ -4752,6 +6150,53 @@ const struct CMUnitTest test_tensor[] = {
  
     /* sort_tensor — interaction with reverse_tensor */
     cmocka_unit_test(test_sort_then_reverse_round_trip),
+
+    /* parallel_sort_tensor */
+    cmocka_unit_test(test_parallel_sort_tensor_guards),
+    cmocka_unit_test(test_parallel_sort_tensor_scratch_failure),
+    cmocka_unit_test(test_parallel_sort_tensor_matches_sort_tensor),
+    cmocka_unit_test(test_parallel_sort_tensor_stable_with_duplicates),
+
+    /* radix_sort_tensor */
+    cmocka_unit_test(test_radix_sort_tensor_guards),
+    cmocka_unit_test(test_radix_sort_tensor_int32_matches_sort_tensor),
+    cmocka_unit_test(test_radix_sort_tensor_floating_point),
+    cmocka_unit_test(test_radix_sort_tensor_integer_widths),
+
+    /* tensor views */
+    cmocka_unit_test(test_tensor_view_init_guards),
+    cmocka_unit_test(test_tensor_view_slice_shares_data),
+    cmocka_unit_test(test_tensor_view_transpose_and_materialize),
+    cmocka_unit_test(test_tensor_view_reshape),
+
+    /* elementwise preparation */
+    cmocka_unit_test(test_prepare_elementwise_tensor_guards),
+    cmocka_unit_test(test_prepare_elementwise_tensor_resizes_array),
+
+    /* axis reductions */
+    cmocka_unit_test(test_reduce_tensor_axis_guards),
+    cmocka_unit_test(test_reduce_tensor_axis_int32_matrix),
+    cmocka_unit_test(test_reduce_tensor_axis_strips_match_reference),
+    cmocka_unit_test(test_reduce_tensor_axis_float_nan_and_array),
+    cmocka_unit_test(test_reduce_tensor_axis_int64_mean_overflow),
+
+    /* prefix sums */
+    cmocka_unit_test(test_cumulative_sum_tensor_guards),
+    cmocka_unit_test(test_cumulative_sum_tensor_int32_modes),
+    cmocka_unit_test(test_cumulative_sum_tensor_wraps_and_ldouble),
+    cmocka_unit_test(test_cumulative_sum_tensor_parallel_matches_serial),
+
+    /* broadcasting */
+    cmocka_unit_test(test_broadcast_tensor_shape),
+    cmocka_unit_test(test_broadcast_tensor_guards),
+    cmocka_unit_test(test_broadcast_tensor_float_outer),
+    cmocka_unit_test(test_broadcast_tensor_int32_matches_reference),
+    cmocka_unit_test(test_broadcast_tensor_array_scalar_ldouble),
+
+    /* file storage */
+    cmocka_unit_test(test_tensor_file_round_trip),
+    cmocka_unit_test(test_tensor_file_array_alignment),
+    cmocka_unit_test(test_tensor_file_errors),
 };
 
 const size_t test_tensor_count = sizeof(test_tensor) / sizeof(test_tensor[0]);
@@ -5433,6 +6878,28 @@ static void test_pop_at_uint8_array_value(void** state) {
 
     return_uint8_tensor(arr);
 }
+
+static void test_bulk_uint8_array(void** state) {
+    (void)state;
+    uint8_tensor_t* arr = _make_uint8_array(2u, true);
+    assert_non_null(arr);
+    assert_false(push_back_n_uint8_array(NULL, NULL, 0u).has_value);
+
+    const uint8_t run[] = { 1u, 2u, 6u, 7u };
+    const uint8_t mid[] = { 3u, 4u, 5u };
+    assert_int_equal(push_back_n_uint8_array(arr, run, 4u).u.value, 4u);
+    assert_int_equal(push_at_n_uint8_array(arr, mid, 3u, 2u).u.value, 3u);
+    assert_int_equal(uint8_tensor_size(arr), 7u);
+
+    uint8_t tail[3] = { 0u };
+    assert_int_equal(pop_back_n_uint8_array(arr, tail, 3u).u.value, 3u);
+    assert_int_equal(tail[0], 5u);
+    assert_int_equal(tail[2], 7u);
+    const uint8_t expected[] = { 1u, 2u, 3u, 4u };
+    assert_memory_equal(arr->base->data, expected, 4u);
+
+    return_uint8_tensor(arr);
+}
 // -------------------------------------------------------------------------------- 
 
 // ================================================================================
@@ -7141,6 +8608,90 @@ static void test_min_uint8_tensor_descending_ramp(void** state) {
  
     return_uint8_tensor(arr);
 }
+// ================================================================================
+// ================================================================================
+// AXIS REDUCTIONS
+// ================================================================================
+
+/** uint8 sums wrap; means widen before dividing. */
+static void test_reduce_uint8_tensor_axis(void** state) {
+    (void)state;
+    const size_t shape[] = { 3u, 2u };
+    uint8_tensor_expect_t r = init_uint8_tensor(2u, shape, heap_allocator());
+    assert_true(r.has_value);
+    const uint8_t v[] = { 200, 1, 100, 2, 50, 3 };
+    for (size_t i = 0u; i < 6u; i++)
+        assert_int_equal(set_uint8_tensor_index(r.u.value, i, v[i]), NO_ERROR);
+
+    uint8_tensor_expect_t o = reduce_uint8_tensor_axis(r.u.value, 0u, REDUCE_SUM,
+                                                       (allocator_vtable_t){ 0 });
+    assert_true(o.has_value);
+    const uint8_t* x = (const uint8_t*)o.u.value->base->data;
+    assert_int_equal(x[0], 94);   /* 350 mod 256 */
+    assert_int_equal(x[1], 6);
+    return_uint8_tensor(o.u.value);
+
+    o = reduce_uint8_tensor_axis(r.u.value, 0u, REDUCE_MEAN, (allocator_vtable_t){ 0 });
+    assert_true(o.has_value);
+    x = (const uint8_t*)o.u.value->base->data;
+    assert_int_equal(x[0], 116);
+    assert_int_equal(x[1], 2);
+    return_uint8_tensor(o.u.value);
+
+    return_uint8_tensor(r.u.value);
+}
+
+// ================================================================================
+// ================================================================================
+// PREFIX SUMS
+// ================================================================================
+
+/** uint8 running totals wrap; the exclusive form starts at zero. */
+static void test_cumulative_sum_uint8_tensor(void** state) {
+    (void)state;
+    uint8_tensor_t* a = _make_uint8_array_filled(70u, 0u);
+    uint8_tensor_t* o = _make_uint8_array(70u, false);
+    uint8_t* x = (uint8_t*)a->base->data;
+    for (size_t i = 0u; i < 70u; i++) x[i] = (uint8_t)(i * 7u);
+
+    assert_int_equal(cumulative_sum_uint8_tensor(NULL, a, SCAN_INCLUSIVE, 1u),
+                     NULL_POINTER);
+    assert_int_equal(cumulative_sum_uint8_tensor(o, a, SCAN_EXCLUSIVE, 1u), NO_ERROR);
+    assert_int_equal(o->base->len, 70u);
+    const uint8_t* z = (const uint8_t*)o->base->data;
+    uint8_t run = 0u;
+    for (size_t i = 0u; i < 70u; i++) {
+        assert_int_equal(z[i], run);
+        run = (uint8_t)(run + x[i]);
+    }
+
+    return_uint8_tensor(o);
+    return_uint8_tensor(a);
+}
+
+// ================================================================================
+// ================================================================================
+// BROADCASTING
+// ================================================================================
+
+/** uint8 array minus a one-element tensor wraps in every lane. */
+static void test_broadcast_uint8_tensor(void** state) {
+    (void)state;
+    uint8_tensor_t* a = _make_uint8_array_filled(40u, 0u);
+    const size_t one[] = { 1u };
+    uint8_tensor_expect_t s = init_uint8_tensor(1u, one, heap_allocator());
+    assert_true(s.has_value);
+    assert_int_equal(set_uint8_tensor_index(s.u.value, 0u, 5u), NO_ERROR);
+
+    assert_int_equal(broadcast_uint8_tensor(a, a, NULL, BINARY_SUB), NULL_POINTER);
+    assert_int_equal(broadcast_uint8_tensor(a, a, s.u.value, BINARY_SUB), NO_ERROR);
+    const uint8_t* x = (const uint8_t*)a->base->data;
+    for (size_t i = 0u; i < 40u; i++) assert_int_equal(x[i], (uint8_t)(i - 5u));
+
+    return_uint8_tensor(s.u.value);
+    return_uint8_tensor(a);
+}
+
 // ================================================================================
 // ================================================================================
 // TEST SUITE REGISTRY
@@ -7226,6 +8777,7 @@ const struct CMUnitTest test_uint8_tensor[] = {
     cmocka_unit_test(test_pop_back_uint8_array_value),
     cmocka_unit_test(test_pop_front_uint8_array_value),
     cmocka_unit_test(test_pop_at_uint8_array_value),
+    cmocka_unit_test(test_bulk_uint8_array),
 
     /* uint8_tensor_lsearch — null/guard */
     cmocka_unit_test(test_find_uint8_tensor_null_tensor),
@@ -7381,6 +8933,15 @@ const struct CMUnitTest test_uint8_tensor[] = {
     /* min_uint8_tensor — TENSOR_STRUCT (N-D) mode */
     cmocka_unit_test(test_min_uint8_tensor_nd_4x4),
     cmocka_unit_test(test_min_uint8_tensor_nd_2x3x4),
+
+    /* axis reductions */
+    cmocka_unit_test(test_reduce_uint8_tensor_axis),
+
+    /* prefix sums */
+    cmocka_unit_test(test_cumulative_sum_uint8_tensor),
+
+    /* broadcasting */
+    cmocka_unit_test(test_broadcast_uint8_tensor),
 };
 
 const size_t test_uint8_tensor_count = sizeof(test_uint8_tensor) /
@@ -9859,22 +11420,99 @@ static void test_min_int8_tensor_nd_2x3x4(void** state) {
  */
 static void test_min_int8_tensor_descending_ramp(void** state) {
     (void)state;
-    allocator_vtable_t alloc = heap_allocator();
-    int8_tensor_expect_t r   = init_int8_array(260u, false, alloc);
-    assert_true(r.has_value);
-    int8_tensor_t* arr = r.u.value;
- 
-    /* 100, 99, 98, ... , -99  — 200 elements, min is -99 at index 199 */
-    for (int i = 0; i < 200; i++) {
-        push_back_int8_array(arr, (int8_t)(100 - i));
+    allocator_vtable_t alloc = heap_allocator();
+    int8_tensor_expect_t r   = init_int8_array(260u, false, alloc);
+    assert_true(r.has_value);
+    int8_tensor_t* arr = r.u.value;
+ 
+    /* 100, 99, 98, ... , -99  — 200 elements, min is -99 at index 199 */
+    for (int i = 0; i < 200; i++) {
+        push_back_int8_array(arr, (int8_t)(100 - i));
+    }
+ 
+    int8_t val = 0;
+    assert_int_equal(min_int8_tensor(arr, &val), NO_ERROR);
+    assert_int_equal(val, -99);
+ 
+    return_int8_tensor(arr);
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+// ================================================================================
+
+/** 8-bit lanes have no native multiply on x86; check the emulation. */
+static void test_int8_tensor_mul_and_abs(void** state) {
+    (void)state;
+    int8_tensor_expect_t ra = init_int8_array(70u, false, heap_allocator());
+    int8_tensor_expect_t rb = init_int8_array(70u, false, heap_allocator());
+    assert_true(ra.has_value && rb.has_value);
+    int8_tensor_t* a = ra.u.value;
+    int8_tensor_t* b = rb.u.value;
+    for (int i = 0; i < 70; i++) {
+        assert_int_equal(push_back_int8_array(a, (int8_t)(i * 7 - 128)), NO_ERROR);
+        assert_int_equal(push_back_int8_array(b, (int8_t)(i - 35)), NO_ERROR);
+    }
+    const int8_t* x = (const int8_t*)a->base->data;
+    const int8_t* y = (const int8_t*)b->base->data;
+
+    int8_tensor_expect_t ro = init_int8_array(70u, false, heap_allocator());
+    assert_true(ro.has_value);
+    int8_tensor_t* out = ro.u.value;
+    const int8_t* z = (const int8_t*)out->base->data;
+
+    assert_int_equal(mul_int8_tensor(out, a, b), NO_ERROR);
+    for (size_t i = 0u; i < 70u; i++) {
+        assert_int_equal(z[i], (int8_t)(uint8_t)((unsigned)x[i] * (unsigned)y[i]));
+    }
+
+    assert_int_equal(abs_int8_tensor(out, a), NO_ERROR);
+    assert_int_equal(z[0], INT8_MIN);
+    for (size_t i = 1u; i < 70u; i++) {
+        assert_int_equal(z[i], x[i] < 0 ? -x[i] : x[i]);
+    }
+
+    assert_int_equal(clamp_int8_tensor(out, b, -3, 3), NO_ERROR);
+    assert_int_equal(z[0], -3);
+    assert_int_equal(z[34], -1);
+    assert_int_equal(z[69], 3);
+
+    return_int8_tensor(out);
+    return_int8_tensor(b);
+    return_int8_tensor(a);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+// ================================================================================
+
+/** The biased SAD sum covers the full range and every tail length. */
+static void test_int8_tensor_sum_and_max_tails(void** state) {
+    (void)state;
+    for (size_t n = 1u; n <= 130u; n++) {
+        int8_tensor_t* a = _make_int8_array(n, false);
+        int64_t ref  = 0;
+        int8_t  hi   = INT8_MIN;
+        for (size_t i = 0u; i < n; i++) {
+            int8_t v = (i % 3u == 0u) ? INT8_MIN : (int8_t)(127 - (int)(i % 50u));
+            assert_int_equal(push_back_int8_array(a, v), NO_ERROR);
+            ref += v;
+            if (v > hi) hi = v;
+        }
+        int64_t s = 0;
+        int8_t  m = 0;
+        size_t  idx = 0u;
+        assert_int_equal(sum_int8_tensor(a, &s), NO_ERROR);
+        assert_true(s == ref);
+        assert_int_equal(max_int8_tensor(a, &m), NO_ERROR);
+        assert_int_equal(m, hi);
+        assert_int_equal(argmin_int8_tensor(a, &idx), NO_ERROR);
+        assert_int_equal(idx, 0u);
+        return_int8_tensor(a);
     }
- 
-    int8_t val = 0;
-    assert_int_equal(min_int8_tensor(arr, &val), NO_ERROR);
-    assert_int_equal(val, -99);
- 
-    return_int8_tensor(arr);
 }
+
 // ================================================================================
 // ================================================================================
 // TEST SUITE REGISTRY
@@ -10126,6 +11764,12 @@ const struct CMUnitTest test_int8_tensor[] = {
     /* min_int8_tensor — TENSOR_STRUCT (N-D) mode */
     cmocka_unit_test(test_min_int8_tensor_nd_4x4),
     cmocka_unit_test(test_min_int8_tensor_nd_2x3x4),
+
+    /* elementwise arithmetic */
+    cmocka_unit_test(test_int8_tensor_mul_and_abs),
+
+    /* reductions */
+    cmocka_unit_test(test_int8_tensor_sum_and_max_tails),
 };
 
 const size_t test_int8_tensor_count = sizeof(test_int8_tensor) /
@@ -12509,6 +14153,36 @@ static void test_min_uint16_tensor_descending_ramp(void** state) {
  
     return_uint16_tensor(arr);
 }
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+// ================================================================================
+
+/** Sums widen past 32 bits and the biased madd path keeps the top bit. */
+static void test_uint16_tensor_sum_widens(void** state) {
+    (void)state;
+    uint16_tensor_t* a = _make_uint16_array(70000u, false);
+    for (size_t i = 0u; i < 70000u; i++) {
+        assert_int_equal(push_back_uint16_array(a, (uint16_t)(UINT16_MAX - (i & 1u))),
+                         NO_ERROR);
+    }
+    uint64_t s = 0u;
+    uint16_t m = 0u;
+    size_t   idx = 0u;
+    assert_int_equal(sum_uint16_tensor(a, &s), NO_ERROR);
+    assert_true(s == 70000ull * UINT16_MAX - 35000u);
+    assert_int_equal(max_uint16_tensor(a, &m), NO_ERROR);
+    assert_int_equal(m, UINT16_MAX);
+    assert_int_equal(argmin_uint16_tensor(a, &idx), NO_ERROR);
+    assert_int_equal(idx, 1u);
+
+    double mean = 0.0;
+    assert_int_equal(mean_uint16_tensor(a, &mean), NO_ERROR);
+    assert_float_equal(mean, UINT16_MAX - 0.5, 1e-9);
+
+    return_uint16_tensor(a);
+}
+
 // ================================================================================
 // ================================================================================
 // TEST SUITE REGISTRY
@@ -12749,6 +14423,9 @@ const struct CMUnitTest test_uint16_tensor[] = {
     /* min_uint16_tensor — TENSOR_STRUCT (N-D) mode */
     cmocka_unit_test(test_min_uint16_tensor_nd_4x4),
     cmocka_unit_test(test_min_uint16_tensor_nd_2x3x4),
+
+    /* reductions */
+    cmocka_unit_test(test_uint16_tensor_sum_widens),
 };
 
 const size_t test_uint16_tensor_count = sizeof(test_uint16_tensor) /
@@ -20591,6 +22268,168 @@ static void test_min_int32_tensor_descending_ramp(void** state) {
  
     return_int32_tensor(arr);
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+// ================================================================================
+
+static int32_tensor_t* _make_int32_values(const int32_t* v, size_t n) {
+    int32_tensor_expect_t r = init_int32_array(n, false, heap_allocator());
+    assert_true(r.has_value);
+    for (size_t i = 0u; i < n; i++) {
+        assert_int_equal(push_back_int32_array(r.u.value, v[i]), NO_ERROR);
+    }
+    return r.u.value;
+}
+// --------------------------------------------------------------------------------
+
+/** Signed add and mul share the unsigned kernels and wrap the same way. */
+static void test_int32_tensor_arithmetic_wraps(void** state) {
+    (void)state;
+    const int32_t av[] = { INT32_MAX, -5, 7, INT32_MIN, 100, -100, 3, 0, 65536 };
+    const int32_t bv[] = { 1, -6, -7, -1, 3, 3, -3, 9, 65536 };
+    int32_tensor_t* a   = _make_int32_values(av, 9u);
+    int32_tensor_t* b   = _make_int32_values(bv, 9u);
+    int32_tensor_t* out = _make_int32_values(av, 9u);
+    const int32_t* z = (const int32_t*)out->base->data;
+
+    assert_int_equal(add_int32_tensor(out, a, b), NO_ERROR);
+    assert_int_equal(z[0], INT32_MIN);
+    assert_int_equal(z[1], -11);
+    assert_int_equal(z[3], INT32_MAX);
+
+    assert_int_equal(sub_int32_tensor(out, a, b), NO_ERROR);
+    assert_int_equal(z[2], 14);
+    assert_int_equal(z[3], INT32_MIN + 1);
+
+    assert_int_equal(mul_int32_tensor(out, a, b), NO_ERROR);
+    assert_int_equal(z[1], 30);
+    assert_int_equal(z[5], -300);
+    assert_int_equal(z[8], 0);   /* 2^32 keeps no low bits */
+
+    assert_int_equal(muladd_int32_tensor(out, a, -2, 1), NO_ERROR);
+    assert_int_equal(z[1], 11);
+    assert_int_equal(z[4], -199);
+
+    return_int32_tensor(out);
+    return_int32_tensor(b);
+    return_int32_tensor(a);
+}
+// --------------------------------------------------------------------------------
+
+/** Division truncates, wraps INT32_MIN / -1 and rejects zero up front. */
+static void test_int32_tensor_div(void** state) {
+    (void)state;
+    const int32_t av[] = { 7, -7, 7, INT32_MIN, 0 };
+    const int32_t bv[] = { 2, 2, -2, -1, 5 };
+    const int32_t zv[] = { 1, 1, 0, 1, 1 };
+    int32_tensor_t* a   = _make_int32_values(av, 5u);
+    int32_tensor_t* b   = _make_int32_values(bv, 5u);
+    int32_tensor_t* zb  = _make_int32_values(zv, 5u);
+    int32_tensor_t* out = _make_int32_values(zv, 5u);
+    const int32_t* z = (const int32_t*)out->base->data;
+
+    assert_int_equal(div_int32_tensor(out, a, b), NO_ERROR);
+    assert_int_equal(z[0], 3);
+    assert_int_equal(z[1], -3);
+    assert_int_equal(z[2], -3);
+    assert_int_equal(z[3], INT32_MIN);
+    assert_int_equal(z[4], 0);
+
+    assert_int_equal(div_int32_tensor(out, b, zb), DIV_BY_ZERO);
+    assert_int_equal(z[0], 3);   /* untouched */
+
+    return_int32_tensor(out);
+    return_int32_tensor(zb);
+    return_int32_tensor(b);
+    return_int32_tensor(a);
+}
+// --------------------------------------------------------------------------------
+
+static void test_int32_tensor_clamp_and_abs(void** state) {
+    (void)state;
+    int32_t v[37];
+    for (size_t i = 0u; i < 37u; i++) v[i] = (int32_t)i * 10 - 180;
+    v[36] = INT32_MIN;
+    int32_tensor_t* a = _make_int32_values(v, 37u);
+    const int32_t* x = (const int32_t*)a->base->data;
+
+    assert_int_equal(clamp_int32_tensor(a, a, -50, 50), NO_ERROR);
+    for (size_t i = 0u; i < 36u; i++) {
+        int32_t e = v[i] < -50 ? -50 : v[i] > 50 ? 50 : v[i];
+        assert_int_equal(x[i], e);
+    }
+    assert_int_equal(x[36], -50);
+    assert_int_equal(clamp_int32_tensor(a, a, 1, 0), INVALID_ARG);
+
+    int32_tensor_t* b = _make_int32_values(v, 37u);
+    assert_int_equal(abs_int32_tensor(b, b), NO_ERROR);
+    const int32_t* y = (const int32_t*)b->base->data;
+    assert_int_equal(y[0], 180);
+    assert_int_equal(y[18], 0);
+    assert_int_equal(y[35], 170);
+    assert_int_equal(y[36], INT32_MIN);
+
+    return_int32_tensor(b);
+    return_int32_tensor(a);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+// ================================================================================
+
+static void test_int32_tensor_sum_mean_and_dot_widen(void** state) {
+    (void)state;
+    int32_t v[41];
+    for (size_t i = 0u; i < 41u; i++) v[i] = (i & 1u) ? INT32_MAX : INT32_MAX - 1;
+    int32_tensor_t* a = _make_int32_values(v, 41u);
+
+    int64_t s = 0;
+    assert_int_equal(sum_int32_tensor(a, &s), NO_ERROR);
+    assert_true(s == 41ll * INT32_MAX - 21);
+    /* 41 products near 2^62 cannot fit an int64_t accumulator */
+    assert_int_equal(dot_int32_tensor(a, a, &s), NUMERIC_OVERFLOW);
+
+    double d = 0.0;
+    assert_int_equal(mean_int32_tensor(a, &d), NO_ERROR);
+    assert_float_equal(d, ((double)INT32_MAX * 41.0 - 21.0) / 41.0, 1e-6);
+
+    const int32_t w[] = { 3, -4 };
+    int32_tensor_t* b = _make_int32_values(w, 2u);
+    assert_int_equal(l1_norm_int32_tensor(b, &d), NO_ERROR);
+    assert_float_equal(d, 7.0, 0.0);
+    assert_int_equal(l2_norm_int32_tensor(b, &d), NO_ERROR);
+    assert_float_equal(d, 5.0, 1e-12);
+    assert_int_equal(dot_int32_tensor(b, b, &s), NO_ERROR);
+    assert_true(s == 25);
+    assert_int_equal(dot_int32_tensor(a, b, &s), SIZE_MISMATCH);
+
+    return_int32_tensor(b);
+    return_int32_tensor(a);
+}
+// --------------------------------------------------------------------------------
+
+static void test_int32_tensor_arg_extrema_first_occurrence(void** state) {
+    (void)state;
+    int32_t v[37];
+    for (size_t i = 0u; i < 37u; i++) v[i] = (int32_t)(i % 7u);
+    v[12] = INT32_MIN;
+    v[30] = INT32_MIN;
+    int32_tensor_t* a = _make_int32_values(v, 37u);
+
+    size_t  idx = 0u;
+    int32_t m   = 0;
+    assert_int_equal(argmin_int32_tensor(a, &idx), NO_ERROR);
+    assert_int_equal(idx, 12u);
+    assert_int_equal(argmax_int32_tensor(a, &idx), NO_ERROR);
+    assert_int_equal(idx, 6u);
+    assert_int_equal(max_int32_tensor(a, &m), NO_ERROR);
+    assert_int_equal(m, 6);
+
+    return_int32_tensor(a);
+}
+
 // ================================================================================
 // ================================================================================
 // TEST SUITE REGISTRY
@@ -20834,6 +22673,15 @@ const struct CMUnitTest test_int32_tensor[] = {
     /* min_int32_tensor — TENSOR_STRUCT (N-D) mode */
     cmocka_unit_test(test_min_int32_tensor_nd_4x4),
     cmocka_unit_test(test_min_int32_tensor_nd_2x3x4),
+
+    /* elementwise arithmetic */
+    cmocka_unit_test(test_int32_tensor_arithmetic_wraps),
+    cmocka_unit_test(test_int32_tensor_div),
+    cmocka_unit_test(test_int32_tensor_clamp_and_abs),
+
+    /* reductions */
+    cmocka_unit_test(test_int32_tensor_sum_mean_and_dot_widen),
+    cmocka_unit_test(test_int32_tensor_arg_extrema_first_occurrence),
 };
 
 const size_t test_int32_tensor_count = sizeof(test_int32_tensor) /
@@ -23919,6 +25767,74 @@ static void test_sort_int64_tensor_reverse(void** state) {
     return_int64_tensor(arr);
 }
 
+// ---- parallel_sort_int64_tensor ------------------------------------------------
+
+static void test_parallel_sort_int64_tensor_null(void** state) {
+    (void)state;
+    assert_int_equal(parallel_sort_int64_tensor(NULL, FORWARD, 2u, heap_allocator()),
+                     NULL_POINTER);
+}
+
+static void test_parallel_sort_int64_tensor_reverse(void** state) {
+    (void)state;
+    const size_t n = 50000u;
+    int64_tensor_t* arr = _make_int64_array(n, false);
+    assert_non_null(arr);
+
+    uint64_t x = 88172645463325252ull;
+    for (size_t i = 0u; i < n; i++) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        assert_int_equal(push_back_int64_array(arr, (int64_t)x), NO_ERROR);
+    }
+
+    assert_int_equal(parallel_sort_int64_tensor(arr, REVERSE, 4u, heap_allocator()),
+                     NO_ERROR);
+
+    int64_t prev = 0, curr = 0;
+    assert_int_equal(get_int64_tensor_index(arr, 0u, &prev), NO_ERROR);
+    for (size_t i = 1u; i < n; i++) {
+        assert_int_equal(get_int64_tensor_index(arr, i, &curr), NO_ERROR);
+        assert_true(prev >= curr);
+        prev = curr;
+    }
+
+    return_int64_tensor(arr);
+}
+
+// ---- radix_sort_int64_tensor ---------------------------------------------------
+
+static void test_radix_sort_int64_tensor_null(void** state) {
+    (void)state;
+    assert_int_equal(radix_sort_int64_tensor(NULL, FORWARD, NULL, 0u), NULL_POINTER);
+}
+
+static void test_radix_sort_int64_tensor_reverse(void** state) {
+    (void)state;
+    const size_t n = 5000u;
+    int64_tensor_t* arr = _make_int64_array(n, false);
+    assert_non_null(arr);
+
+    uint64_t x = 88172645463325252ull;
+    for (size_t i = 0u; i < n; i++) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        assert_int_equal(push_back_int64_array(arr, (int64_t)x), NO_ERROR);
+    }
+
+    int64_t scratch[5000];
+    assert_int_equal(radix_sort_int64_tensor(arr, REVERSE, scratch, sizeof(scratch)),
+                     NO_ERROR);
+
+    int64_t prev = 0, curr = 0;
+    assert_int_equal(get_int64_tensor_index(arr, 0u, &prev), NO_ERROR);
+    for (size_t i = 1u; i < n; i++) {
+        assert_int_equal(get_int64_tensor_index(arr, i, &curr), NO_ERROR);
+        assert_true(prev >= curr);
+        prev = curr;
+    }
+
+    return_int64_tensor(arr);
+}
+
 // ================================================================================
 // ================================================================================
 // SET AND GET DATA
@@ -25864,6 +27780,36 @@ static void test_min_int64_tensor_descending_ramp(void** state) {
  
     return_int64_tensor(arr);
 }
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+// ================================================================================
+
+/** 64-bit sums and dots are checked rather than allowed to wrap. */
+static void test_int64_tensor_sum_and_dot_overflow(void** state) {
+    (void)state;
+    int64_tensor_t* a = _make_int64_array(4u, false);
+    assert_int_equal(push_back_int64_array(a, INT64_MAX - 10), NO_ERROR);
+    assert_int_equal(push_back_int64_array(a, 10), NO_ERROR);
+
+    int64_t s = 0;
+    assert_int_equal(sum_int64_tensor(a, &s), NO_ERROR);
+    assert_true(s == INT64_MAX);
+    assert_int_equal(push_back_int64_array(a, 1), NO_ERROR);
+    assert_int_equal(sum_int64_tensor(a, &s), NUMERIC_OVERFLOW);
+    assert_int_equal(dot_int64_tensor(a, a, &s), NUMERIC_OVERFLOW);
+
+    int64_tensor_t* b = _make_int64_array_filled(9u, -4);
+    assert_int_equal(dot_int64_tensor(b, b, &s), NO_ERROR);
+    assert_true(s == 60);   /* 16+9+4+1+0+1+4+9+16 */
+    size_t idx = 0u;
+    assert_int_equal(argmax_int64_tensor(b, &idx), NO_ERROR);
+    assert_int_equal(idx, 8u);
+
+    return_int64_tensor(b);
+    return_int64_tensor(a);
+}
+
 // ================================================================================
 // ================================================================================
 // TEST SUITE REGISTRY
@@ -25929,6 +27875,10 @@ const struct CMUnitTest test_int64_tensor[] = {
     cmocka_unit_test(test_reverse_int64_tensor_value),
     cmocka_unit_test(test_sort_int64_tensor_forward),
     cmocka_unit_test(test_sort_int64_tensor_reverse),
+    cmocka_unit_test(test_parallel_sort_int64_tensor_null),
+    cmocka_unit_test(test_parallel_sort_int64_tensor_reverse),
+    cmocka_unit_test(test_radix_sort_int64_tensor_null),
+    cmocka_unit_test(test_radix_sort_int64_tensor_reverse),
 
     /* set/get — null guards */
     cmocka_unit_test(test_set_get_int64_tensor_index_null),
@@ -26105,6 +28055,9 @@ const struct CMUnitTest test_int64_tensor[] = {
     /* min_int64_tensor — TENSOR_STRUCT (N-D) mode */
     cmocka_unit_test(test_min_int64_tensor_nd_4x4),
     cmocka_unit_test(test_min_int64_tensor_nd_2x3x4),
+
+    /* reductions */
+    cmocka_unit_test(test_int64_tensor_sum_and_dot_overflow),
 };
 
 const size_t test_int64_tensor_count = sizeof(test_int64_tensor) /
@@ -26786,6 +28739,27 @@ static void test_pop_at_float_array_value(void** state) {
 
     return_float_tensor(arr);
 }
+
+static void test_bulk_float_array(void** state) {
+    (void)state;
+    float_tensor_t* arr = _make_float_array(4u, false);
+    assert_non_null(arr);
+
+    /* Fixed capacity: only four of the six values fit */
+    const float run[] = { 0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f };
+    size_expect_t e = push_back_n_float_array(arr, run, 6u);
+    assert_true(e.has_value);
+    assert_int_equal(e.u.value, 4u);
+    assert_int_equal(push_back_n_float_array(arr, run, 1u).u.error,
+                     CAPACITY_OVERFLOW);
+
+    float tail[4] = { 0.0f };
+    assert_int_equal(pop_back_n_float_array(arr, tail, 4u).u.value, 4u);
+    assert_memory_equal(tail, run, sizeof(tail));
+    assert_int_equal(pop_back_n_float_array(arr, tail, 1u).u.error, EMPTY);
+
+    return_float_tensor(arr);
+}
 // -------------------------------------------------------------------------------- 
 
 // ================================================================================
@@ -29055,6 +31029,323 @@ static void test_min_float_tensor_descending_ramp(void** state) {
  
     return_float_tensor(arr);
 }
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE ARITHMETIC
+// ================================================================================
+
+static float_tensor_t* _make_float_ramp(size_t n, float start, float step) {
+    float_tensor_expect_t r = init_float_array(n, false, heap_allocator());
+    assert_true(r.has_value);
+    for (size_t i = 0u; i < n; i++) {
+        assert_int_equal(push_back_float_array(r.u.value, start + (float)i * step),
+                         NO_ERROR);
+    }
+    return r.u.value;
+}
+// --------------------------------------------------------------------------------
+
+/** Lengths around every vector width agree with a scalar reference. */
+static void test_float_tensor_arithmetic_tail_lengths(void** state) {
+    (void)state;
+    const size_t lens[] = { 1u, 3u, 7u, 15u, 16u, 17u, 67u };
+
+    for (size_t k = 0u; k < sizeof(lens) / sizeof(lens[0]); k++) {
+        size_t n = lens[k];
+        float_tensor_t* a   = _make_float_ramp(n, -8.0f, 0.25f);
+        float_tensor_t* b   = _make_float_ramp(n, 1.0f, 0.5f);
+        float_tensor_t* out = _make_float_ramp(n, 0.0f, 0.0f);
+        const float* x = (const float*)a->base->data;
+        const float* y = (const float*)b->base->data;
+        const float* z = (const float*)out->base->data;
+
+        assert_int_equal(add_float_tensor(out, a, b), NO_ERROR);
+        for (size_t i = 0u; i < n; i++) assert_true(z[i] == x[i] + y[i]);
+        assert_int_equal(sub_float_tensor(out, a, b), NO_ERROR);
+        for (size_t i = 0u; i < n; i++) assert_true(z[i] == x[i] - y[i]);
+        assert_int_equal(mul_float_tensor(out, a, b), NO_ERROR);
+        for (size_t i = 0u; i < n; i++) assert_true(z[i] == x[i] * y[i]);
+        assert_int_equal(div_float_tensor(out, a, b), NO_ERROR);
+        for (size_t i = 0u; i < n; i++) assert_true(z[i] == x[i] / y[i]);
+        assert_int_equal(muladd_float_tensor(out, a, 2.0f, -1.0f), NO_ERROR);
+        for (size_t i = 0u; i < n; i++) assert_true(z[i] == x[i] * 2.0f - 1.0f);
+
+        return_float_tensor(out);
+        return_float_tensor(b);
+        return_float_tensor(a);
+    }
+}
+// --------------------------------------------------------------------------------
+
+/** In-place updates and NULL / length guards. */
+static void test_float_tensor_arithmetic_in_place(void** state) {
+    (void)state;
+    float_tensor_t* acc = _make_float_ramp(9u, 1.0f, 1.0f);
+    float_tensor_t* x   = _make_float_ramp(9u, 0.5f, 0.0f);
+    float_tensor_t* s   = _make_float_ramp(4u, 0.0f, 0.0f);
+
+    assert_int_equal(add_float_tensor(acc, acc, x), NO_ERROR);
+    assert_true(((float*)acc->base->data)[8] == 9.5f);
+    assert_int_equal(mul_float_tensor(acc, acc, acc), NO_ERROR);
+    assert_true(((float*)acc->base->data)[0] == 2.25f);
+
+    assert_int_equal(add_float_tensor(NULL, acc, x), NULL_POINTER);
+    assert_int_equal(sub_float_tensor(acc, NULL, x), NULL_POINTER);
+    assert_int_equal(mul_float_tensor(acc, acc, s), SIZE_MISMATCH);
+
+    return_float_tensor(s);
+    return_float_tensor(x);
+    return_float_tensor(acc);
+}
+// --------------------------------------------------------------------------------
+
+static void test_float_tensor_clamp_and_abs(void** state) {
+    (void)state;
+    float_tensor_t* a = _make_float_ramp(19u, -9.0f, 1.0f);
+    float* x = (float*)a->base->data;
+    x[3]  = NAN;
+    x[18] = -0.0f;
+
+    float_tensor_expect_t r = init_float_array(32u, false, heap_allocator());
+    assert_true(r.has_value);
+    float_tensor_t* out = r.u.value;
+    const float* z = (const float*)out->base->data;
+
+    assert_int_equal(clamp_float_tensor(out, a, -2.0f, 4.0f), NO_ERROR);
+    assert_int_equal(float_tensor_size(out), 19u);
+    assert_true(z[0] == -2.0f);
+    assert_true(isnan(z[3]));
+    assert_true(z[9] == 0.0f);
+    assert_true(z[17] == 4.0f);
+
+    assert_int_equal(clamp_float_tensor(out, a, 1.0f, -1.0f), INVALID_ARG);
+    assert_int_equal(clamp_float_tensor(out, a, NAN, 1.0f), INVALID_ARG);
+
+    assert_int_equal(abs_float_tensor(a, a), NO_ERROR);
+    assert_true(x[0] == 9.0f);
+    assert_true(isnan(x[3]));
+    assert_false(signbit(x[18]));
+
+    return_float_tensor(out);
+    return_float_tensor(a);
+}
+
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+// ================================================================================
+
+/** Pairwise sums stay close to a double reference across block boundaries. */
+static void test_float_tensor_reductions_match_reference(void** state) {
+    (void)state;
+    const size_t lens[] = { 1u, 7u, 16u, 17u, 67u, 256u, 257u, 1000u, 4099u };
+
+    for (size_t k = 0u; k < sizeof(lens) / sizeof(lens[0]); k++) {
+        size_t n = lens[k];
+        float_tensor_t* a = _make_float_ramp(n, -3.0f, 0.01f);
+        float_tensor_t* b = _make_float_ramp(n, 0.5f, 0.002f);
+        const float* x = (const float*)a->base->data;
+        const float* y = (const float*)b->base->data;
+
+        double sum = 0.0, l1 = 0.0, l2 = 0.0, dot = 0.0;
+        for (size_t i = 0u; i < n; i++) {
+            sum += x[i];
+            l1  += fabs((double)x[i]);
+            l2  += (double)x[i] * x[i];
+            dot += (double)x[i] * y[i];
+        }
+        float v = 0.0f;
+        assert_int_equal(sum_float_tensor(a, &v), NO_ERROR);
+        assert_float_equal(v, sum, 1e-5 * l1 + 1e-6);
+        assert_int_equal(mean_float_tensor(a, &v), NO_ERROR);
+        assert_float_equal(v, sum / (double)n, 1e-5 * l1 / (double)n + 1e-6);
+        assert_int_equal(l1_norm_float_tensor(a, &v), NO_ERROR);
+        assert_float_equal(v, l1, 1e-5 * l1);
+        assert_int_equal(l2_norm_float_tensor(a, &v), NO_ERROR);
+        assert_float_equal(v, sqrt(l2), 1e-5 * sqrt(l2));
+        assert_int_equal(dot_float_tensor(a, b, &v), NO_ERROR);
+        assert_float_equal(v, dot, 1e-5 * (fabs(dot) + l1));
+
+        return_float_tensor(b);
+        return_float_tensor(a);
+    }
+}
+// --------------------------------------------------------------------------------
+
+/** max propagates NaN; argmin/argmax report the first occurrence. */
+static void test_float_tensor_max_and_arg_extrema(void** state) {
+    (void)state;
+    float_tensor_t* a = _make_float_ramp(37u, 0.0f, 0.0f);
+    float* x = (float*)a->base->data;
+    x[5]  = -2.0f;
+    x[9]  = 4.0f;
+    x[20] = -2.0f;
+    x[33] = 4.0f;
+
+    float  v   = 0.0f;
+    size_t idx = 0u;
+    assert_int_equal(max_float_tensor(a, &v), NO_ERROR);
+    assert_float_equal(v, 4.0f, 0.0f);
+    assert_int_equal(argmin_float_tensor(a, &idx), NO_ERROR);
+    assert_int_equal(idx, 5u);
+    assert_int_equal(argmax_float_tensor(a, &idx), NO_ERROR);
+    assert_int_equal(idx, 9u);
+
+    x[30] = INFINITY;
+    x[31] = -INFINITY;
+    assert_int_equal(argmax_float_tensor(a, &idx), NO_ERROR);
+    assert_int_equal(idx, 30u);
+    assert_int_equal(argmin_float_tensor(a, &idx), NO_ERROR);
+    assert_int_equal(idx, 31u);
+
+    x[34] = NAN;
+    assert_int_equal(max_float_tensor(a, &v), NO_ERROR);
+    assert_true(isnan(v));
+    assert_int_equal(argmax_float_tensor(a, &idx), NO_ERROR);
+    assert_int_equal(idx, 34u);
+
+    return_float_tensor(a);
+}
+// --------------------------------------------------------------------------------
+
+static void test_float_tensor_reductions_reject_bad_input(void** state) {
+    (void)state;
+    float_tensor_t* a = _make_float_ramp(4u, 1.0f, 1.0f);
+    float_tensor_t* b = _make_float_ramp(5u, 1.0f, 1.0f);
+    float_tensor_t* e = _make_float_array(4u, false);
+    float  v   = 0.0f;
+    size_t idx = 0u;
+
+    assert_int_equal(sum_float_tensor(NULL, &v), NULL_POINTER);
+    assert_int_equal(sum_float_tensor(a, NULL), NULL_POINTER);
+    assert_int_equal(mean_float_tensor(e, &v), EMPTY);
+    assert_int_equal(argmax_float_tensor(e, &idx), EMPTY);
+    assert_int_equal(dot_float_tensor(a, b, &v), SIZE_MISMATCH);
+    assert_int_equal(dot_float_tensor(a, NULL, &v), NULL_POINTER);
+
+    return_float_tensor(e);
+    return_float_tensor(b);
+    return_float_tensor(a);
+}
+
+// --------------------------------------------------------------------------------
+/** The typed wrapper keeps the dtype and drops the reduced axis. */
+static void test_reduce_float_tensor_axis(void** state) {
+    (void)state;
+    const size_t shape[] = { 2u, 3u };
+    float_tensor_expect_t r = init_float_tensor(2u, shape, heap_allocator());
+    assert_true(r.has_value);
+    for (size_t i = 0u; i < 6u; i++)
+        assert_int_equal(set_float_tensor_index(r.u.value, i, (float)i * 0.5f), NO_ERROR);
+
+    float_tensor_expect_t o = reduce_float_tensor_axis(r.u.value, 0u, REDUCE_SUM,
+                                                       (allocator_vtable_t){ 0 });
+    assert_true(o.has_value);
+    assert_int_equal(float_tensor_ndim(o.u.value), 1u);
+    assert_int_equal(float_tensor_size(o.u.value), 3u);
+    const float* x = (const float*)o.u.value->base->data;
+    assert_float_equal(x[0], 1.5f, 0.0f);
+    assert_float_equal(x[2], 3.5f, 0.0f);
+    return_float_tensor(o.u.value);
+
+    o = reduce_float_tensor_axis(r.u.value, 1u, REDUCE_MEAN, (allocator_vtable_t){ 0 });
+    assert_true(o.has_value);
+    x = (const float*)o.u.value->base->data;
+    assert_float_equal(x[0], 0.5f, 1e-6f);
+    assert_float_equal(x[1], 2.0f, 1e-6f);
+    return_float_tensor(o.u.value);
+
+    o = reduce_float_tensor_axis(NULL, 0u, REDUCE_SUM, (allocator_vtable_t){ 0 });
+    assert_false(o.has_value);
+    assert_int_equal(o.u.error, NULL_POINTER);
+
+    return_float_tensor(r.u.value);
+}
+// --------------------------------------------------------------------------------
+
+/** float scans in place: half-integer steps keep every sum exact. */
+static void test_cumulative_sum_float_tensor(void** state) {
+    (void)state;
+    const size_t shape[] = { 3u, 7u };
+    float_tensor_expect_t r = init_float_tensor(2u, shape, heap_allocator());
+    assert_true(r.has_value);
+    for (size_t i = 0u; i < 21u; i++)
+        assert_int_equal(set_float_tensor_index(r.u.value, i, 0.5f), NO_ERROR);
+
+    assert_int_equal(cumulative_sum_float_tensor(r.u.value, r.u.value,
+                                                 SCAN_INCLUSIVE, 0u), NO_ERROR);
+    const float* x = (const float*)r.u.value->base->data;
+    for (size_t i = 0u; i < 21u; i++)
+        assert_float_equal(x[i], 0.5f * (float)(i + 1u), 0.0f);
+
+    assert_int_equal(cumulative_sum_float_tensor(r.u.value, NULL, SCAN_INCLUSIVE, 0u),
+                     NULL_POINTER);
+    return_float_tensor(r.u.value);
+}
+// --------------------------------------------------------------------------------
+
+/** float outer product of a {3, 1} column and a {1, 4} row. */
+static void test_broadcast_float_tensor(void** state) {
+    (void)state;
+    const size_t col_shape[] = { 3u, 1u };
+    const size_t row_shape[] = { 1u, 4u };
+    const size_t out_shape[] = { 3u, 4u };
+    float_tensor_expect_t c = init_float_tensor(2u, col_shape, heap_allocator());
+    float_tensor_expect_t r = init_float_tensor(2u, row_shape, heap_allocator());
+    float_tensor_expect_t o = init_float_tensor(2u, out_shape, heap_allocator());
+    assert_true(c.has_value && r.has_value && o.has_value);
+    for (size_t i = 0u; i < 3u; i++)
+        assert_int_equal(set_float_tensor_index(c.u.value, i, (float)(i + 1u)), NO_ERROR);
+    for (size_t j = 0u; j < 4u; j++)
+        assert_int_equal(set_float_tensor_index(r.u.value, j, 0.5f * (float)j), NO_ERROR);
+
+    assert_int_equal(broadcast_float_tensor(o.u.value, c.u.value, r.u.value,
+                                            BINARY_MUL), NO_ERROR);
+    const float* z = (const float*)o.u.value->base->data;
+    for (size_t i = 0u; i < 3u; i++)
+        for (size_t j = 0u; j < 4u; j++)
+            assert_float_equal(z[i * 4u + j], (float)(i + 1u) * 0.5f * (float)j, 0.0f);
+
+    /* The {3, 4} result cannot be written into the {3, 1} column */
+    assert_int_equal(broadcast_float_tensor(c.u.value, c.u.value, r.u.value,
+                                            BINARY_MUL), SIZE_MISMATCH);
+
+    return_float_tensor(o.u.value);
+    return_float_tensor(r.u.value);
+    return_float_tensor(c.u.value);
+}
+// --------------------------------------------------------------------------------
+
+/** A float tensor written to disk maps back as a float tensor and is
+ *  rejected by the loader of another type. */
+static void test_map_float_tensor_file(void** state) {
+    (void)state;
+    const char* path = "csalt_test_float_tensor.tns";
+    const size_t shape[] = { 4u, 6u };
+    float_tensor_expect_t r = init_float_tensor(2u, shape, heap_allocator());
+    assert_true(r.has_value);
+    for (size_t i = 0u; i < 24u; i++)
+        assert_int_equal(set_float_tensor_index(r.u.value, i, 1.5f * (float)i), NO_ERROR);
+
+    assert_int_equal(write_float_tensor_file(NULL, path, 0u), NULL_POINTER);
+    assert_int_equal(write_float_tensor_file(r.u.value, path, 0u), NO_ERROR);
+
+    float_tensor_expect_t m = map_float_tensor_file(path, heap_allocator());
+    assert_true(m.has_value);
+    assert_int_equal(float_tensor_size(m.u.value), 24u);
+    float v = 0.0f;
+    assert_int_equal(get_float_tensor_index(m.u.value, 23u, &v), NO_ERROR);
+    assert_float_equal(v, 34.5f, 0.0f);
+
+    double_tensor_expect_t d = map_double_tensor_file(path, heap_allocator());
+    assert_false(d.has_value);
+    assert_int_equal(d.u.error, TYPE_MISMATCH);
+
+    return_float_tensor(m.u.value);
+    return_float_tensor(r.u.value);
+    remove(path);
+}
+
 // ================================================================================
 // ================================================================================
 // TEST SUITE REGISTRY
@@ -29140,6 +31431,7 @@ const struct CMUnitTest test_float_tensor[] = {
     cmocka_unit_test(test_pop_back_float_array_value),
     cmocka_unit_test(test_pop_front_float_array_value),
     cmocka_unit_test(test_pop_at_float_array_value),
+    cmocka_unit_test(test_bulk_float_array),
 
     /* lsearch null/guard */
     cmocka_unit_test(test_float_lsearch_null_tensor),
@@ -29337,6 +31629,20 @@ const struct CMUnitTest test_float_tensor[] = {
     cmocka_unit_test(test_min_float_tensor_nd_4x4),
     cmocka_unit_test(test_min_float_tensor_nd_2x3x4),
     cmocka_unit_test(test_min_float_tensor_nd_4x4_with_nan),
+
+    /* elementwise arithmetic */
+    cmocka_unit_test(test_float_tensor_arithmetic_tail_lengths),
+    cmocka_unit_test(test_float_tensor_arithmetic_in_place),
+    cmocka_unit_test(test_float_tensor_clamp_and_abs),
+
+    /* reductions */
+    cmocka_unit_test(test_float_tensor_reductions_match_reference),
+    cmocka_unit_test(test_float_tensor_max_and_arg_extrema),
+    cmocka_unit_test(test_float_tensor_reductions_reject_bad_input),
+    cmocka_unit_test(test_reduce_float_tensor_axis),
+    cmocka_unit_test(test_cumulative_sum_float_tensor),
+    cmocka_unit_test(test_broadcast_float_tensor),
+    cmocka_unit_test(test_map_float_tensor_file),
 };
 
 const size_t test_float_tensor_count = sizeof(test_float_tensor) /
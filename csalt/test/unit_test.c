@@ -39,11 +39,14 @@ int main(void) {
     // Define all test suites to run
     const TestSuite suites[] = {
         {"Error Handling",  test_error, test_error_count},
+        {"SIMD Dispatch",  test_simd, test_simd_count},
         {"Arena Allocator", test_arena, test_arena_count},
         {"Pool Allocator", test_pool, test_pool_count},
         {"Freelist Allocator",  test_freelist, test_freelist_count},
         {"Buddy Allocator",  test_buddy_allocator, test_buddy_allocator_count},
         {"Slab Allocator",  test_slab_allocator, test_slab_allocator_count},
+        {"Thread Cache Allocator",  test_tcache_allocator, test_tcache_allocator_count},
+        {"Tracing Allocator",  test_tracer_allocator, test_tracer_allocator_count},
         {"String Implementation", test_string, test_string_count},
         {"Types Implementation", test_dtypes, test_dtypes_count},
         {"Generic Tensor", test_tensor, test_tensor_count},
@@ -58,6 +61,7 @@ int main(void) {
         {"Float Tensor", test_float_tensor, test_float_tensor_count},
         {"Double Tensor", test_double_tensor, test_double_tensor_count},
         {"Long Double Tensor", test_ldouble_tensor, test_ldouble_tensor_count},
+        {"Generic Matrix", test_matrix, test_matrix_count},
         // {"String Array", test_string_array, test_string_array_count},
         // {"Uint8 Dict", test_uint8_dict, test_uint8_dict_count},
         // {"Int8 Dict", test_int8_dict, test_int8_dict_count},
@@ -73,7 +77,6 @@ int main(void) {
         // {"Singly Linked List", test_slist, test_slist_count},
         // {"Heap", test_heap, test_heap_count},
         // {"AVL", test_avl, test_avl_count},
-        // {"Generic Matrix", test_matrix, test_matrix_count},
         // {"Float Matrix", test_float_matrix, test_float_matrix_count},
         // {"Double Matrix", test_double_matrix, test_double_matrix_count},
         // {"LDouble Matrix", test_ldouble_matrix, test_ldouble_matrix_count},